@@ -74,6 +74,12 @@ static PyMethodDef gPyROOTMethods[] = {
     (char *)"Add equality and inequality comparison operators to TObject"},
    {(char *)"BranchPyz", (PyCFunction)PyROOT::BranchPyz, METH_VARARGS,
     (char *)"Fully enable the use of TTree::Branch from Python"},
+   {(char *)"ReadBranchColumn", (PyCFunction)PyROOT::ReadBranchColumn, METH_VARARGS,
+    (char *)"Read the values of a TTree branch in bulk into a buffer for NumPy"},
+#ifndef _MSC_VER
+   {(char *)"ProcessTreeMP", (PyCFunction)PyROOT::ProcessTreeMP, METH_VARARGS,
+    (char *)"Run a Python function over a TTree or TChain on a pool of processes and merge the results"},
+#endif
    {(char *)"AddPrettyPrintingPyz", (PyCFunction)PyROOT::AddPrettyPrintingPyz, METH_VARARGS,
     (char *)"Add pretty printing pythonization"},
    {(char *)"InitApplication", (PyCFunction)PyROOT::RPyROOTApplication::InitApplication, METH_VARARGS,
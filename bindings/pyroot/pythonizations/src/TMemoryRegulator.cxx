@@ -26,6 +26,22 @@ PyROOT::TMemoryRegulator::TMemoryRegulator()
       [this](Cppyy::TCppObject_t cppobj, Cppyy::TCppType_t klass) { return this->UnregisterHook(cppobj, klass); });
 }
 
+////////////////////////////////////////////////////////////////////////////
+/// \brief Tell whether a class derives from TObject.
+/// \param[in] klass Class id.
+///
+/// The hooks run for every proxy that Cppyy binds, so the answer is cached
+/// per class instead of walking the list of base classes every time.
+bool PyROOT::TMemoryRegulator::IsTObjectType(Cppyy::TCppType_t klass)
+{
+   static Cppyy::TCppType_t tobjectTypeID = (Cppyy::TCppType_t)Cppyy::GetScope("TObject");
+
+   auto it = fTObjectTypes.find(klass);
+   if (it == fTObjectTypes.end())
+      it = fTObjectTypes.emplace(klass, Cppyy::IsSubtype(klass, tobjectTypeID)).first;
+   return it->second;
+}
+
 ////////////////////////////////////////////////////////////////////////////
 /// \brief Register a hook that Cppyy runs when constructing an object.
 /// \param[in] cppobj Address of the object.
@@ -34,9 +50,7 @@ PyROOT::TMemoryRegulator::TMemoryRegulator()
 ///         Cppyy if we want to continue running RegisterPyObject
 std::pair<bool, bool> PyROOT::TMemoryRegulator::RegisterHook(Cppyy::TCppObject_t cppobj, Cppyy::TCppType_t klass)
 {
-   static Cppyy::TCppType_t tobjectTypeID = (Cppyy::TCppType_t)Cppyy::GetScope("TObject");
-
-   if (Cppyy::IsSubtype(klass, tobjectTypeID)) {
+   if (IsTObjectType(klass)) {
       fObjectMap.insert({cppobj, klass});
    }
 
@@ -51,12 +65,8 @@ std::pair<bool, bool> PyROOT::TMemoryRegulator::RegisterHook(Cppyy::TCppObject_t
 ///         Cppyy if we want to continue running UnRegisterPyObject
 std::pair<bool, bool> PyROOT::TMemoryRegulator::UnregisterHook(Cppyy::TCppObject_t cppobj, Cppyy::TCppType_t klass)
 {
-
-   static Cppyy::TCppType_t tobjectTypeID = (Cppyy::TCppType_t)Cppyy::GetScope("TObject");
-
-   if (Cppyy::IsSubtype(klass, tobjectTypeID)) {
-      if (auto it = fObjectMap.find(cppobj); it != fObjectMap.end())
-         fObjectMap.erase(it);
+   if (IsTObjectType(klass)) {
+      fObjectMap.erase(cppobj);
    }
 
    return {true, true};
@@ -64,6 +64,9 @@ class TMemoryRegulator final {
    using ObjectMap_t = std::unordered_map<Cppyy::TCppObject_t, Cppyy::TCppType_t>;
 
    ObjectMap_t fObjectMap{}; // key: object address; value: object class id
+   std::unordered_map<Cppyy::TCppType_t, bool> fTObjectTypes{}; // key: class id; value: whether it inherits from TObject
+
+   bool IsTObjectType(Cppyy::TCppType_t klass);
 
    std::pair<bool, bool> RegisterHook(Cppyy::TCppObject_t, Cppyy::TCppType_t);
 
@@ -0,0 +1,127 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// Bindings
+#include "../../cppyy/CPyCppyy/src/CPyCppyy.h"
+#include "../../cppyy/CPyCppyy/src/CPPInstance.h"
+
+#include "CPyCppyy/API.h"
+
+#include "PyROOTPythonize.h"
+
+// ROOT
+#include "TChain.h"
+#include "TClass.h"
+#include "TTree.h"
+#include "TTreeReader.h"
+#include "ROOT/TTreeProcessorMP.hxx"
+
+#include <functional>
+#include <string>
+
+namespace {
+
+// Get the TClass of the C++ object proxied by pyobj
+TClass *GetTClass(const PyObject *pyobj)
+{
+   return TClass::GetClass(Cppyy::GetScopedFinalName(((CPyCppyy::CPPInstance *)pyobj)->ObjectIsA()).c_str());
+}
+
+// Call the Python function on the reader of a worker and hand over the
+// TObject it returns to C++, which serializes it to the client
+TObject *CallOnReader(PyObject *pyfunc, TTreeReader &reader)
+{
+   PyObject *pyreader = CPyCppyy::Instance_FromVoidPtr(&reader, "TTreeReader");
+   if (!pyreader) {
+      PyErr_Print();
+      return nullptr;
+   }
+   PyObject *result = PyObject_CallFunctionObjArgs(pyfunc, pyreader, nullptr);
+   Py_DECREF(pyreader);
+   if (!result) {
+      PyErr_Print();
+      return nullptr;
+   }
+
+   TObject *obj = nullptr;
+   if (CPyCppyy::Instance_Check(result)) {
+      obj = (TObject *)GetTClass(result)->DynamicCast(TObject::Class(), CPyCppyy::Instance_AsVoidPtr(result));
+      if (obj)
+         ((CPyCppyy::CPPInstance *)result)->CppOwns();
+   }
+   if (!obj && result != Py_None)
+      PySys_WriteStderr("ProcessTreeMP: the processing function must return a TObject or None\n");
+   Py_DECREF(result);
+   return obj;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Run a Python function over a TTree or TChain on a pool of processes.
+/// \param[in] self Always null, since this is a module function.
+/// \param[in] args Pointer to a Python tuple object containing the tree or
+/// chain proxy, the Python function, and optionally the number of worker
+/// processes (by default, the number of cores) and, for chains, the name of
+/// the tree in the files.
+///
+/// This gives the loops written in Python over a TTreeReader a parallel
+/// version without rewriting them. The work is done by ROOT::TTreeProcessorMP:
+/// each forked worker calls the function on a TTreeReader restricted to its
+/// range of entries (a whole file when there are more files than workers).
+/// The function returns a mergeable TObject, typically a histogram it filled,
+/// and the results of all the workers are merged with TObject::Merge():
+/// ~~~{.py}
+/// def fill(reader):
+///    x = ROOT.TTreeReaderValue['double'](reader, 'x')
+///    h = ROOT.TH1D('h', 'x', 100, 0, 1)
+///    while reader.Next():
+///       h.Fill(x.__deref__())
+///    return h
+///
+/// h = ROOT.libROOTPythonizations.ProcessTreeMP(chain, fill, 8)
+/// ~~~
+/// Python owns the merged result. Since the workers are forked, the function
+/// can use any state of the calling process, but the changes it makes to that
+/// state are lost.
+PyObject *PyROOT::ProcessTreeMP(PyObject * /* self */, PyObject *args)
+{
+   PyObject *pytree = nullptr;
+   PyObject *pyfunc = nullptr;
+   unsigned int nWorkers = 0;
+   const char *treeName = "";
+
+   if (!PyArg_ParseTuple(args, "OO|Is:ProcessTreeMP", &pytree, &pyfunc, &nWorkers, &treeName))
+      return nullptr;
+
+   if (!CPyCppyy::Instance_Check(pytree)) {
+      PyErr_SetString(PyExc_TypeError, "ProcessTreeMP: expected a TTree or a TChain as first argument");
+      return nullptr;
+   }
+   if (!PyCallable_Check(pyfunc)) {
+      PyErr_SetString(PyExc_TypeError, "ProcessTreeMP: expected a callable as second argument");
+      return nullptr;
+   }
+   auto tree = (TTree *)GetTClass(pytree)->DynamicCast(TTree::Class(), CPyCppyy::Instance_AsVoidPtr(pytree));
+   if (!tree) {
+      PyErr_SetString(PyExc_ReferenceError, "attempt to access a null-pointer");
+      return nullptr;
+   }
+
+   auto procFunc = [pyfunc](TTreeReader &reader) { return CallOnReader(pyfunc, reader); };
+   ROOT::TTreeProcessorMP processor(nWorkers);
+   TObject *result = nullptr;
+   if (auto chain = dynamic_cast<TChain *>(tree))
+      result = processor.Process(*chain, procFunc, treeName);
+   else
+      result = processor.Process(*tree, procFunc);
+
+   if (!result)
+      Py_RETURN_NONE;
+   return CPyCppyy::Instance_FromVoidPtr(result, result->IsA()->GetName(), true);
+}
@@ -29,10 +29,14 @@
 #include "TLeaf.h"
 #include "TLeafElement.h"
 #include "TLeafObject.h"
+#include "TBufferFile.h"
+#include "TMath.h"
 #include "TStreamerElement.h"
 #include "TStreamerInfo.h"
 
 #include <algorithm>
+#include <cstring>
+#include <memory>
 #include <sstream>
 
 namespace {
@@ -375,3 +379,209 @@ PyObject *PyROOT::BranchPyz(PyObject * /* self */, PyObject *args)
    // Not the overload we wanted to pythonize, return None
    Py_RETURN_NONE;
 }
+
+namespace {
+
+// A contiguous column of branch values which exposes its memory through the
+// Python buffer protocol, so that numpy.asarray() can wrap it without a copy.
+// The memory is either the basket buffer itself, adopted from the branch by
+// the bulk read, or a single allocation filled with one copy per basket.
+struct BranchColumn {
+   PyObject_HEAD
+   TBufferFile *fBuffer; // basket memory backing the column, if it fits in one basket
+   char *fOwned;         // contiguous memory backing the column, otherwise
+   char *fData;
+   const char *fFormat;
+   Py_ssize_t fItemSize;
+   int fNdim;
+   Py_ssize_t fShape[2];
+   Py_ssize_t fStrides[2];
+};
+
+int BranchColumnGetBuffer(PyObject *self, Py_buffer *view, int flags)
+{
+   auto column = reinterpret_cast<BranchColumn *>(self);
+   view->buf = column->fData;
+   view->obj = self;
+   Py_INCREF(self);
+   view->len = column->fShape[0] * column->fStrides[0];
+   view->itemsize = column->fItemSize;
+   view->readonly = 0;
+   view->ndim = column->fNdim;
+   view->format = (flags & PyBUF_FORMAT) ? const_cast<char *>(column->fFormat) : nullptr;
+   view->shape = (flags & PyBUF_ND) ? column->fShape : nullptr;
+   view->strides = (flags & PyBUF_STRIDES) ? column->fStrides : nullptr;
+   view->suboffsets = nullptr;
+   view->internal = nullptr;
+   return 0;
+}
+
+void BranchColumnDealloc(PyObject *self)
+{
+   auto column = reinterpret_cast<BranchColumn *>(self);
+   delete column->fBuffer;
+   delete[] column->fOwned;
+   Py_TYPE(self)->tp_free(self);
+}
+
+PyTypeObject *GetBranchColumnType()
+{
+   static PyBufferProcs bufferProcs = {BranchColumnGetBuffer, nullptr};
+   static PyTypeObject type = [] {
+      PyTypeObject t{PyVarObject_HEAD_INIT(nullptr, 0)};
+      t.tp_name = "ROOT._BranchColumn";
+      t.tp_basicsize = sizeof(BranchColumn);
+      t.tp_dealloc = BranchColumnDealloc;
+      t.tp_as_buffer = &bufferProcs;
+      t.tp_flags = Py_TPFLAGS_DEFAULT;
+      t.tp_doc = "Column of TTree branch values read in bulk, to be wrapped with numpy.asarray()";
+      return t;
+   }();
+   static bool ready = PyType_Ready(&type) == 0;
+   return ready ? &type : nullptr;
+}
+
+// Return the struct module format character of the values of a leaf that can
+// be read in bulk, or nullptr if the leaf type is not supported
+const char *GetBulkReadFormat(TLeaf *leaf)
+{
+   static const std::pair<const char *, const char *> formats[] = {
+      {"Bool_t", "?"},  {"Char_t", "b"},   {"UChar_t", "B"},   {"Short_t", "h"},
+      {"UShort_t", "H"}, {"Int_t", "i"},   {"UInt_t", "I"},    {"Long_t", "l"},
+      {"ULong_t", "L"},  {"Long64_t", "q"}, {"ULong64_t", "Q"}, {"Float_t", "f"},
+      {"Double_t", "d"}};
+   if (leaf->GetDeserializeType() == TLeaf::DeserializeType::kExternal)
+      return nullptr;
+   for (const auto &format : formats) {
+      if (std::strcmp(leaf->GetTypeName(), format.first) == 0)
+         return format.second;
+   }
+   return nullptr;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Read the values of a branch in bulk, for NumPy.
+/// \param[in] self Always null, since this is a module function.
+/// \param[in] args Pointer to a Python tuple object containing the tree
+/// proxy, the branch name and optionally the first and one past the last
+/// entry to read (by default, all the entries of the branch).
+///
+/// The branch must have a single leaf of a fundamental type, or a fixed-size
+/// array of it. Its baskets are read with TBranch::GetBulkEntries(), which
+/// byte swaps them in place, so that the values are never copied one entry
+/// at a time. The result is a memoryview of shape (nEntries,), or
+/// (nEntries, arraySize) for arrays, that can be wrapped without a copy:
+/// ~~~{.py}
+/// x = numpy.asarray(ROOT.libROOTPythonizations.ReadBranchColumn(t, 'x'))
+/// ~~~
+/// When the entries all belong to one basket, the memoryview is backed by the
+/// basket memory, which the branch hands over; otherwise each basket is copied
+/// once into a contiguous buffer. TChains are not supported.
+PyObject *PyROOT::ReadBranchColumn(PyObject * /* self */, PyObject *args)
+{
+   PyObject *pytree = nullptr;
+   PyObject *pyname = nullptr;
+   long long start = 0;
+   long long stop = -1;
+
+   if (!PyArg_ParseTuple(args, "OU|LL:ReadBranchColumn", &pytree, &pyname, &start, &stop))
+      return nullptr;
+
+   const char *name = PyUnicode_AsUTF8(pyname);
+   if (!name)
+      return nullptr;
+
+   if (!CPyCppyy::Instance_Check(pytree)) {
+      PyErr_SetString(PyExc_TypeError, "ReadBranchColumn: expected a TTree as first argument");
+      return nullptr;
+   }
+   auto tree = (TTree *)GetTClass(pytree)->DynamicCast(TTree::Class(), CPyCppyy::Instance_AsVoidPtr(pytree));
+   if (!tree) {
+      PyErr_SetString(PyExc_ReferenceError, "attempt to access a null-pointer");
+      return nullptr;
+   }
+   if (tree->GetTree() != tree) {
+      PyErr_SetString(PyExc_TypeError, "ReadBranchColumn: TChains are not supported");
+      return nullptr;
+   }
+
+   TBranch *branch = SearchForBranch(tree, name);
+   if (!branch) {
+      PyErr_Format(PyExc_ValueError, "ReadBranchColumn: no branch named \'%s\'", name);
+      return nullptr;
+   }
+   TLeaf *leaf = branch->GetNleaves() == 1 ? static_cast<TLeaf *>(branch->GetListOfLeaves()->At(0)) : nullptr;
+   const char *format = leaf && !leaf->GetLeafCount() ? GetBulkReadFormat(leaf) : nullptr;
+   if (!format || !branch->GetBulkRead().SupportsBulkRead()) {
+      PyErr_Format(PyExc_TypeError,
+                   "ReadBranchColumn: branch \'%s\' is not a fundamental type or a fixed-size array of it", name);
+      return nullptr;
+   }
+
+   const Long64_t nEntries = branch->GetEntries();
+   if (stop < 0 || stop > nEntries)
+      stop = nEntries;
+   if (start < 0 || start > stop) {
+      PyErr_Format(PyExc_IndexError, "ReadBranchColumn: invalid entry range [%lld, %lld)", start, stop);
+      return nullptr;
+   }
+
+   PyTypeObject *columnType = GetBranchColumnType();
+   if (!columnType)
+      return nullptr;
+   auto column = PyObject_New(BranchColumn, columnType);
+   if (!column)
+      return nullptr;
+   column->fBuffer = nullptr;
+   column->fOwned = nullptr;
+   column->fFormat = format;
+   column->fItemSize = leaf->GetLenType();
+   column->fNdim = leaf->GetLenStatic() > 1 ? 2 : 1;
+   column->fShape[0] = stop - start;
+   column->fShape[1] = leaf->GetLenStatic();
+   column->fStrides[1] = column->fItemSize;
+   column->fStrides[0] = column->fItemSize * column->fShape[1];
+   // Released on error, or once the memoryview holds its own reference
+   std::unique_ptr<PyObject, void (*)(PyObject *)> owner((PyObject *)column, [](PyObject *o) { Py_DECREF(o); });
+
+   const Long64_t entrySize = column->fStrides[0];
+   auto buffer = std::make_unique<TBufferFile>(TBuffer::kWrite, 32 * 1024);
+   column->fData = buffer->Buffer();
+
+   if (start < stop) {
+      const Int_t lastBasket = branch->GetWriteBasket();
+      const Long64_t *basketEntry = branch->GetBasketEntry();
+      const Int_t firstBasket = TMath::BinarySearch(Long64_t(lastBasket + 1), basketEntry, Long64_t(start));
+      const Long64_t nextBasketEntry = firstBasket < lastBasket ? basketEntry[firstBasket + 1] : nEntries;
+      const bool inOneBasket = stop <= nextBasketEntry;
+      if (!inOneBasket)
+         column->fOwned = new char[(stop - start) * entrySize];
+
+      Long64_t basketFirst = basketEntry[firstBasket];
+      while (basketFirst < stop) {
+         const Int_t nRead = branch->GetBulkRead().GetBulkEntries(basketFirst, *buffer);
+         if (nRead <= 0) {
+            PyErr_Format(PyExc_RuntimeError, "ReadBranchColumn: bulk read of branch \'%s\' failed at entry %lld",
+                         name, basketFirst);
+            return nullptr;
+         }
+         const Long64_t lo = std::max<Long64_t>(start, basketFirst);
+         const Long64_t hi = std::min<Long64_t>(stop, basketFirst + nRead);
+         char *values = buffer->GetCurrent() + (lo - basketFirst) * entrySize;
+         if (inOneBasket)
+            column->fData = values;
+         else
+            std::memcpy(column->fOwned + (lo - start) * entrySize, values, (hi - lo) * entrySize);
+         basketFirst += nRead;
+      }
+      if (!inOneBasket)
+         column->fData = column->fOwned;
+   }
+   // Keep the basket memory alive only if the column points into it
+   if (column->fData != column->fOwned)
+      column->fBuffer = buffer.release();
+
+   return PyMemoryView_FromObject(owner.get());
+}
@@ -583,4 +583,32 @@ inline Long64_t  net2host(Long64_t x)  { return host2net(x); }
 inline Float_t   net2host(Float_t x)   { return host2net(x); }
 inline Double_t  net2host(Double_t x)  { return host2net(x); }
 
+//______________________________________________________________________________
+// Array versions of frombuf() for 2, 4 and 8 byte wide types: convert n values
+// stored in network byte order at `from` into host byte order at `to`. `to` may
+// be equal to `from` in order to convert a buffer in place. The loops work on
+// unsigned integers without unions or volatile accesses such that the compiler
+// can vectorize the byte swapping.
+template <typename UIntT>
+inline void frombufarray(void *to, const void *from, Long64_t n)
+{
+#ifdef R__BYTESWAP
+   auto src = static_cast<const char *>(from);
+   auto dst = static_cast<char *>(to);
+   for (Long64_t i = 0; i < n; ++i) {
+      UIntT x;
+      memcpy(&x, src + i * sizeof(UIntT), sizeof(UIntT));
+      x = host2net(x);
+      memcpy(dst + i * sizeof(UIntT), &x, sizeof(UIntT));
+   }
+#else
+   if (to != from)
+      memmove(to, from, n * sizeof(UIntT));
+#endif
+}
+
+inline void frombufarray16(void *to, const void *from, Long64_t n) { frombufarray<UShort_t>(to, from, n); }
+inline void frombufarray32(void *to, const void *from, Long64_t n) { frombufarray<UInt_t>(to, from, n); }
+inline void frombufarray64(void *to, const void *from, Long64_t n) { frombufarray<ULong64_t>(to, from, n); }
+
 #endif
@@ -2309,31 +2309,40 @@ TObjArray *TString::Tokenize(const TString &delim) const
 
 void TString::FormImp(const char *fmt, va_list ap)
 {
-   Ssiz_t buflen = 20 + 20 * strlen(fmt);    // pick a number, any strictly positive number
-   buflen = Clobber(buflen); // Update buflen, as Clobber clamps length to MaxSize (if Fatal does not abort)
-
    va_list sap;
    R__VA_COPY(sap, ap);
 
-   int n, vc = 0;
-again:
-   n = vsnprintf(GetPointer(), buflen, fmt, ap);
+   // Most formatted strings are short: format them on the stack first, so that
+   // they only need their final buffer, if any, and do not allocate at all when
+   // they fit in the small string.
+   char localBuffer[256];
+   int n = vsnprintf(localBuffer, sizeof(localBuffer), fmt, ap);
+   if (n >= 0 && n < (int)sizeof(localBuffer)) {
+      va_end(sap);
+      const Ssiz_t len = strlen(localBuffer);
+      Clobber(len);
+      memcpy(GetPointer(), localBuffer, len + 1);
+      SetSize(len);
+      return;
+   }
+
    // old vsnprintf's return -1 if string is truncated new ones return
    // total number of characters that would have been written
+   Ssiz_t buflen = (n == -1) ? 2 * sizeof(localBuffer) : n + 1;
+again:
+   buflen = Clobber(buflen); // Update buflen, as Clobber clamps length to MaxSize (if Fatal does not abort)
+   va_end(ap);
+   R__VA_COPY(ap, sap);
+   n = vsnprintf(GetPointer(), buflen, fmt, ap);
    if (n == -1 || n >= buflen) {
       if (n == -1)
          buflen *= 2;
       else
          buflen = n+1;
-      buflen = Clobber(buflen);
-      va_end(ap);
-      R__VA_COPY(ap, sap);
-      vc = 1;
       goto again;
    }
    va_end(sap);
-   if (vc)
-      va_end(ap);
+   va_end(ap);
 
    SetSize(strlen(Data()));
 }
@@ -16,6 +16,8 @@
 TVirtualPS is an abstract interface to Postscript, PDF, SVG. TeX etc... drivers
 */
 
+#include <algorithm>
+#include <cstdio>
 #include <fstream>
 #include "strlcpy.h"
 #include "TVirtualPS.h"
@@ -170,13 +172,10 @@ void TVirtualPS::PrintFast(Int_t len, const char *str)
 
 void TVirtualPS::WriteInteger(Int_t n, Bool_t space )
 {
+   // numbers never contain the '@' line break of PrintStr, so they go directly to PrintFast
    char str[15];
-   if (space) {
-      snprintf(str,15," %d", n);
-   } else {
-      snprintf(str,15,"%d", n);
-   }
-   PrintStr(str);
+   Int_t len = snprintf(str, 15, space ? " %d" : "%d", n);
+   PrintFast(std::min(len, 14), str);
 }
 
 
@@ -186,12 +185,8 @@ void TVirtualPS::WriteInteger(Int_t n, Bool_t space )
 void TVirtualPS::WriteReal(Float_t z, Bool_t space)
 {
    char str[15];
-   if (space) {
-      snprintf(str,15," %g", z);
-   } else {
-      snprintf(str,15,"%g", z);
-   }
-   PrintStr(str);
+   Int_t len = snprintf(str, 15, space ? " %g" : "%g", z);
+   PrintFast(std::min(len, 14), str);
 }
 
 
@@ -4,6 +4,8 @@
 
 #include "TString.h"
 
+#include <string>
+
 TEST(TString, Basics)
 {
    TString *s = nullptr;
@@ -15,3 +17,23 @@ TEST(TString, Basics)
    ROOT_EXPECT_ERROR(a.Append("s", -5), "TString::Replace", "Negative number of replacement characters!");
    EXPECT_STREQ("test", a);
 }
+
+TEST(TString, Form)
+{
+   TString s = TString::Format("%s_%d", "branch", 42);
+   EXPECT_STREQ("branch_42", s);
+   EXPECT_EQ(9, s.Length());
+
+   // Longer than the stack buffer used for short results
+   const std::string longArg(1000, 'x');
+   s.Form("[%s]", longArg.c_str());
+   EXPECT_EQ(1002, s.Length());
+   EXPECT_EQ('[', s[0]);
+   EXPECT_EQ(']', s[1001]);
+   EXPECT_EQ(TString('x', 1000), s(1, 1000));
+
+   // Shrinks back into the small string
+   s.Form("%d", 7);
+   EXPECT_STREQ("7", s);
+   EXPECT_EQ(1, s.Length());
+}
@@ -371,11 +371,16 @@ void TObjArray::Delete(Option_t * /* opt */)
 
    // Since we set fCont[i] only after the deletion is completed, we do not
    // lose the connection and thus do not need to take any special action.
-   for (Int_t i = 0; i < fSize; i++) {
+   // The objects are deleted from the last one and fLast follows, so that the
+   // RecursiveRemove triggered by each deletion only scans the entries that are
+   // still alive instead of the whole array.
+   for (Int_t i = GetAbsLast(); i >= 0; i--) {
       if (fCont[i] && fCont[i]->IsOnHeap()) {
          TCollection::GarbageCollect(fCont[i]);
          fCont[i] = nullptr;
       }
+      if (fLast == i && !fCont[i])
+         fLast = i - 1;
    }
 
    Init(fSize, fLowerBound);
@@ -674,7 +679,9 @@ void TObjArray::RecursiveRemove(TObject *obj)
    // invalidate fatally the cursor (e.g. might skip some items)
    R__COLLECTION_WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
-   for (int i = 0; i < fSize; i++) {
+   // Slots past the last entry are empty, no need to scan the whole capacity
+   const Int_t last = GetAbsLast();
+   for (int i = 0; i <= last; i++) {
       if (fCont[i] && !ROOT::Detail::HasBeenDeleted(fCont[i]) && fCont[i]->IsEqual(obj)) {
          fCont[i] = nullptr;
          // recalculate array size
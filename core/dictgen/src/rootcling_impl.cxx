@@ -33,6 +33,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <numeric>
+#include <iterator>
 
 
 #ifdef _WIN32
@@ -2892,6 +2893,20 @@ void GenerateNecessaryIncludes(std::ostream &dictStream,
 /// temporary.
 
 class tempFileNamesCatalog {
+   /////////////////////////////////////////////////////////////////////////////
+   /// Returns true if the two files exist and have identical content.
+
+   static bool haveSameContent(const char *name1, const char *name2) {
+      std::ifstream file1(name1, std::ios::binary | std::ios::ate);
+      std::ifstream file2(name2, std::ios::binary | std::ios::ate);
+      if (!file1 || !file2 || file1.tellg() != file2.tellg())
+         return false;
+      file1.seekg(0);
+      file2.seekg(0);
+      return std::equal(std::istreambuf_iterator<char>(file1), std::istreambuf_iterator<char>(),
+                        std::istreambuf_iterator<char>(file2));
+   }
+
 public:
    //______________________________________________
    tempFileNamesCatalog(): m_size(0), m_emptyString("") {};
@@ -2916,8 +2931,10 @@ public:
       m_tempNames.push_back(tmpNameStr);
       ROOT::TMetaUtils::Info(nullptr, "File %s added to the tmp catalog.\n", name);
 
-      // This is to allow update of existing files
-      if (0 == std::rename(name , tmpName)) {
+      // This is to allow update of existing files. The original is copied rather
+      // than moved, so that commit() can leave it untouched if the new content is
+      // identical and the build system does not recompile an unchanged dictionary.
+      if (llvm::sys::fs::exists(nameStr) && !llvm::sys::fs::copy_file(nameStr, tmpNameStr)) {
          ROOT::TMetaUtils::Info(nullptr, "File %s existing. Preserved as %s.\n", name, tmpName);
       }
 
@@ -2967,6 +2984,15 @@ public:
          // accessing it from a Linux VM via a shared folder
          if (ifile.is_open())
             ifile.close();
+         // Keep the existing file, and its timestamp, if nothing changed
+         if (haveSameContent(tmpName, name)) {
+            ROOT::TMetaUtils::Info(nullptr, "File %s unchanged, not replaced.\n", name);
+            if (0 != std::remove(tmpName)) {
+               ROOT::TMetaUtils::Error(nullptr, "Removing %s!\n", tmpName);
+               retval++;
+            }
+            continue;
+         }
 #ifdef WIN32
          // Sometimes files cannot be renamed on Windows if they don't have
          // been released by the system. So just copy them and try to delete
@@ -0,0 +1,93 @@
+/// \file ROOT/RTraceSpan.hxx
+/// \ingroup Base
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RTraceSpan
+#define ROOT_RTraceSpan
+
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+namespace ROOT {
+namespace Internal {
+
+/**
+ Collection of timed spans of the I/O and implicit multi-threading hot paths, written as a Chrome trace
+ (JSON Trace Event Format), which can be opened in Perfetto (ui.perfetto.dev) or chrome://tracing to see
+ what every thread did over time.
+
+ The spans are only compiled in when ROOT is built with `R__ENABLE_TRACING` defined (cmake `-Dtracing=ON`); otherwise
+ R__TRACE_SPAN expands to nothing. Even then, spans are only recorded once tracing is enabled, either with
+ RTrace::Enable() or by setting the `ROOT_TRACE_FILE` environment variable to the file the trace is written to at exit.
+
+ Each thread appends its spans to its own buffer, so that recording a span does not contend with other threads.
+ */
+class RTrace {
+   static std::atomic<bool> fgEnabled;
+
+public:
+   /// Whether spans are currently recorded.
+   static bool IsEnabled() { return fgEnabled.load(std::memory_order_relaxed); }
+   static void Enable() { fgEnabled = true; }
+   static void Disable() { fgEnabled = false; }
+
+   /// Nanoseconds since the start of the trace clock.
+   static std::int64_t Now();
+   /// Record a span of the calling thread. `name` and `category` must be string literals or outlive the trace.
+   static void AddSpan(const char *name, const char *category, std::int64_t startNs, std::int64_t endNs);
+   /// Discard the spans recorded so far.
+   static void Clear();
+   /// Write the spans recorded so far, as a Chrome trace JSON object.
+   static void Write(std::ostream &out);
+   /// Write the spans recorded so far to a file; return false if it cannot be written.
+   static bool Write(const std::string &fileName);
+};
+
+/**
+ Record a span from its construction to its destruction in the trace of the calling thread, if tracing is enabled.
+ Use it through R__TRACE_SPAN.
+ */
+class RTraceSpan {
+   const char *fName;
+   const char *fCategory;
+   std::int64_t fStart = -1;
+
+public:
+   RTraceSpan(const char *category, const char *name) : fName(name), fCategory(category)
+   {
+      if (RTrace::IsEnabled())
+         fStart = RTrace::Now();
+   }
+   RTraceSpan(const RTraceSpan &) = delete;
+   RTraceSpan &operator=(const RTraceSpan &) = delete;
+   ~RTraceSpan()
+   {
+      if (fStart >= 0)
+         RTrace::AddSpan(fName, fCategory, fStart, RTrace::Now());
+   }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#define R__TRACE_CONCAT_IMPL(a, b) a##b
+#define R__TRACE_CONCAT(a, b) R__TRACE_CONCAT_IMPL(a, b)
+
+#ifdef R__ENABLE_TRACING
+/// Trace the enclosing scope as a span with the given category and name (string literals).
+#define R__TRACE_SPAN(category, name) \
+   ::ROOT::Internal::RTraceSpan R__TRACE_CONCAT(R__traceSpan, __LINE__)(category, name)
+#else
+#define R__TRACE_SPAN(category, name) ((void)0)
+#endif
+
+#endif // ROOT_RTraceSpan
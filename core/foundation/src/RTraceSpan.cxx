@@ -0,0 +1,183 @@
+/// \file RTraceSpan.cxx
+/// \ingroup Base
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RTraceSpan.hxx"
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#define R__TRACE_GETPID _getpid
+#else
+#include <unistd.h>
+#define R__TRACE_GETPID getpid
+#endif
+
+using ROOT::Internal::RTrace;
+
+std::atomic<bool> RTrace::fgEnabled{false};
+
+namespace {
+
+struct RSpan {
+   const char *fName;
+   const char *fCategory;
+   std::int64_t fStartNs;
+   std::int64_t fEndNs;
+};
+
+/// The spans of one thread. Only its thread appends to it, the mutex is contended only while the trace is written.
+struct RThreadSpans {
+   std::mutex fMutex;
+   std::vector<RSpan> fSpans;
+   unsigned int fThreadId = 0;
+};
+
+/// The span buffers of all the threads that recorded spans, also of those which have terminated.
+struct RTraceRegistry {
+   std::mutex fMutex;
+   std::vector<std::shared_ptr<RThreadSpans>> fThreads;
+   const std::chrono::steady_clock::time_point fStart = std::chrono::steady_clock::now();
+};
+
+RTraceRegistry &GetRegistry()
+{
+   static RTraceRegistry registry;
+   return registry;
+}
+
+RThreadSpans &GetThreadSpans()
+{
+   thread_local std::shared_ptr<RThreadSpans> spans = [] {
+      auto threadSpans = std::make_shared<RThreadSpans>();
+      auto &registry = GetRegistry();
+      std::lock_guard<std::mutex> lock(registry.fMutex);
+      threadSpans->fThreadId = registry.fThreads.size() + 1;
+      registry.fThreads.emplace_back(threadSpans);
+      return threadSpans;
+   }();
+   return *spans;
+}
+
+void WriteJSONString(std::ostream &out, const char *str)
+{
+   out << '"';
+   for (; *str; ++str) {
+      const char c = *str;
+      if (c == '"' || c == '\\')
+         out << '\\' << c;
+      else if (static_cast<unsigned char>(c) < 0x20)
+         out << ' ';
+      else
+         out << c;
+   }
+   out << '"';
+}
+
+/// The trace event format has timestamps in microseconds, keep the nanosecond resolution as decimals
+void WriteMicroseconds(std::ostream &out, std::int64_t ns)
+{
+   const char decimals[] = {'.', char('0' + ns / 100 % 10), char('0' + ns / 10 % 10), char('0' + ns % 10)};
+   out << ns / 1000;
+   out.write(decimals, sizeof(decimals));
+}
+
+/// Enable tracing if ROOT_TRACE_FILE is set, and write the trace to that file at exit.
+struct RTraceAtExit {
+   std::string fFileName;
+
+   RTraceAtExit()
+   {
+      // construct the registry first, so that it is still alive when the trace is written
+      GetRegistry();
+      if (const char *fileName = std::getenv("ROOT_TRACE_FILE")) {
+         fFileName = fileName;
+         if (!fFileName.empty())
+            RTrace::Enable();
+      }
+   }
+
+   ~RTraceAtExit()
+   {
+      if (!fFileName.empty())
+         RTrace::Write(fFileName);
+   }
+} gTraceAtExit;
+
+} // anonymous namespace
+
+std::int64_t RTrace::Now()
+{
+   return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - GetRegistry().fStart)
+      .count();
+}
+
+void RTrace::AddSpan(const char *name, const char *category, std::int64_t startNs, std::int64_t endNs)
+{
+   auto &threadSpans = GetThreadSpans();
+   std::lock_guard<std::mutex> lock(threadSpans.fMutex);
+   threadSpans.fSpans.push_back({name, category, startNs, endNs});
+}
+
+void RTrace::Clear()
+{
+   auto &registry = GetRegistry();
+   std::lock_guard<std::mutex> lock(registry.fMutex);
+   for (auto &threadSpans : registry.fThreads) {
+      std::lock_guard<std::mutex> threadLock(threadSpans->fMutex);
+      threadSpans->fSpans.clear();
+   }
+}
+
+void RTrace::Write(std::ostream &out)
+{
+   const auto pid = R__TRACE_GETPID();
+   auto &registry = GetRegistry();
+   std::lock_guard<std::mutex> lock(registry.fMutex);
+
+   // Complete events ("X") with timestamps and durations in microseconds, and the thread names as metadata events
+   out << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+   const char *sep = "\n";
+   for (auto &threadSpans : registry.fThreads) {
+      std::lock_guard<std::mutex> threadLock(threadSpans->fMutex);
+      out << sep << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": " << pid
+          << ", \"tid\": " << threadSpans->fThreadId << ", \"args\": {\"name\": \"thread "
+          << threadSpans->fThreadId << "\"}}";
+      sep = ",\n";
+      for (const auto &span : threadSpans->fSpans) {
+         out << sep << "{\"name\": ";
+         WriteJSONString(out, span.fName);
+         out << ", \"cat\": ";
+         WriteJSONString(out, span.fCategory);
+         out << ", \"ph\": \"X\", \"ts\": ";
+         WriteMicroseconds(out, span.fStartNs);
+         out << ", \"dur\": ";
+         WriteMicroseconds(out, span.fEndNs - span.fStartNs);
+         out << ", \"pid\": " << pid << ", \"tid\": " << threadSpans->fThreadId << "}";
+      }
+   }
+   out << "\n]}\n";
+}
+
+bool RTrace::Write(const std::string &fileName)
+{
+   std::ofstream out(fileName);
+   if (!out)
+      return false;
+   Write(out);
+   return static_cast<bool>(out);
+}
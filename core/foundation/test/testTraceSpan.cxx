@@ -0,0 +1,52 @@
+#define R__ENABLE_TRACING
+#include "ROOT/RTraceSpan.hxx"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+using ROOT::Internal::RTrace;
+
+namespace {
+std::string WriteTrace()
+{
+   std::ostringstream out;
+   RTrace::Write(out);
+   return out.str();
+}
+} // anonymous namespace
+
+TEST(RTraceSpan, Disabled)
+{
+   RTrace::Disable();
+   RTrace::Clear();
+   {
+      R__TRACE_SPAN("test", "DisabledSpan");
+   }
+   EXPECT_EQ(WriteTrace().find("DisabledSpan"), std::string::npos);
+}
+
+TEST(RTraceSpan, ChromeTrace)
+{
+   RTrace::Clear();
+   RTrace::Enable();
+   {
+      R__TRACE_SPAN("test", "MainSpan");
+      std::thread t([] { R__TRACE_SPAN("test", "Worker \"quoted\" span"); });
+      t.join();
+   }
+   RTrace::Disable();
+
+   const auto trace = WriteTrace();
+   EXPECT_EQ(trace.find("{\"displayTimeUnit\": \"ns\", \"traceEvents\": ["), 0u) << trace;
+   EXPECT_NE(trace.find("{\"name\": \"MainSpan\", \"cat\": \"test\", \"ph\": \"X\", \"ts\": "), std::string::npos)
+      << trace;
+   EXPECT_NE(trace.find("{\"name\": \"Worker \\\"quoted\\\" span\", \"cat\": \"test\""), std::string::npos) << trace;
+   EXPECT_NE(trace.find("\"ph\": \"M\""), std::string::npos) << trace;
+   EXPECT_EQ(trace.substr(trace.size() - 4), "\n]}\n");
+
+   RTrace::Clear();
+   EXPECT_EQ(WriteTrace().find("MainSpan"), std::string::npos);
+}
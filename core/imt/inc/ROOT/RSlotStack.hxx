@@ -11,14 +11,13 @@
 #ifndef ROOT_RSLOTSTACK
 #define ROOT_RSLOTSTACK
 
-#include <ROOT/TSpinMutex.hxx>
-
-#include <stack>
+#include <atomic>
+#include <memory>
 
 namespace ROOT {
 namespace Internal {
 
-/// A thread-safe stack of N indexes (0 to size - 1).
+/// A thread-safe pool of N indexes (0 to size - 1).
 /// RSlotStack can be used to safely assign a "processing slot" number to
 /// each thread in multi-thread applications.
 /// In release builds, pop and push operations are unchecked, potentially
@@ -26,12 +25,26 @@ namespace Internal {
 /// requested.
 /// An important design assumption is that a slot will almost always be available
 /// when a thread asks for it, and if it is not available it will be very soon,
-/// therefore a spinlock is used for synchronization.
+/// therefore the slots are taken with atomic operations, without locking.
+/// A thread gets back the slot it returned last if it is still free, so that the
+/// per-slot state of the caller stays in the cache of the thread's core.
 class RSlotStack {
 private:
+   /// Flag of a slot, on its own cache line to avoid false sharing
+   struct alignas(64) RSlot {
+      std::atomic<bool> fInUse{false};
+   };
+
    const unsigned int fSize;
-   std::stack<unsigned int> fStack;
-   ROOT::TSpinMutex fMutex;
+   const unsigned int fId;              ///< Unique identifier, to recognize the slot a thread used last
+   std::unique_ptr<RSlot[]> fSlots;
+   std::atomic<unsigned int> fNInUse{0}; ///< Number of slots in use, only checked in debug builds
+
+   bool TryGetSlot(unsigned int slot)
+   {
+      return !fSlots[slot].fInUse.load(std::memory_order_relaxed) &&
+             !fSlots[slot].fInUse.exchange(true, std::memory_order_acquire);
+   }
 
 public:
    RSlotStack() = delete;
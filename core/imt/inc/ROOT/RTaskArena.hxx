@@ -25,6 +25,7 @@
 
 #include "RConfigure.h"
 #include <memory>
+#include <string>
 
 // exclude in case ROOT does not have IMT support
 #ifndef R__USE_IMT
@@ -53,6 +54,23 @@ namespace Internal {
 ////////////////////////////////////////////////////////////////////////////////
 int LogicalCPUBandwidthControl();
 
+////////////////////////////////////////////////////////////////////////////////
+/// Binds the worker threads of the global task arena to a set of logical CPUs.
+///
+///  - The set is given in the format of the Linux cpulist files, e.g. "0-31,64-95";
+///    an empty list removes the binding
+///  - If numaGroups is true, the workers are split in one group per NUMA node,
+///    each group bound to the CPUs of the set on that node, so that the memory
+///    the workers allocate stays local to their node
+///  - Takes effect on the next creation of the global task arena, whose number of
+///    workers is then limited to the number of CPUs in the set
+///  - Defaults to the environment variables `ROOT_IMT_CPUSET` and `ROOT_IMT_NUMA`
+///  - Only supported on Linux
+////////////////////////////////////////////////////////////////////////////////
+void SetTaskArenaCPUSet(const std::string &cpuList, bool numaGroups = true);
+
+class RCPUBindingObserver;
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Wrapper for tbb::task_arena.
@@ -69,6 +87,7 @@ private:
    RTaskArenaWrapper(unsigned maxConcurrency = 0);
    friend std::shared_ptr<ROOT::Internal::RTaskArenaWrapper> GetGlobalTaskArena(unsigned maxConcurrency);
    std::unique_ptr<ROOT::ROpaqueTaskArena> fTBBArena;
+   std::unique_ptr<RCPUBindingObserver> fCPUBinding; // destroyed before the arena it observes
    static unsigned fNWorkers;
 };
 
@@ -0,0 +1,64 @@
+// @(#)root/thread:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TTaskGraph
+#define ROOT_TTaskGraph
+
+#include "ROOT/TTaskGroup.hxx"
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+
+class TTaskGraph {
+   /**
+   \class ROOT::Experimental::TTaskGraph
+   \ingroup Parallelism
+   \brief A class to run a graph of work items with dependencies.
+
+   Each work item added to a TTaskGraph starts as soon as the items it depends on are completed.
+   */
+public:
+   using TaskId_t = std::size_t;
+
+private:
+   struct TNode {
+      std::function<void(void)> fTask;
+      std::vector<TaskId_t> fSuccessors; ///< Tasks depending on this one
+      unsigned fNDependencies = 0;       ///< Number of tasks this one depends on
+   };
+
+   std::vector<TNode> fNodes;
+   std::unique_ptr<std::atomic<unsigned>[]> fPending; ///< Number of dependencies not yet completed, per task
+   std::unique_ptr<TTaskGroup> fTaskGroup;            ///< Group running the tasks, if IMT is enabled
+   bool fRunning = false;
+
+   void Execute(TaskId_t id);
+
+public:
+   TTaskGraph() = default;
+   TTaskGraph(const TTaskGraph &) = delete;
+   TTaskGraph &operator=(const TTaskGraph &) = delete;
+   ~TTaskGraph();
+
+   TaskId_t AddTask(const std::function<void(void)> &task, const std::vector<TaskId_t> &dependencies = {});
+   std::size_t GetNTasks() const { return fNodes.size(); }
+   void Run();
+   void Wait();
+};
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
@@ -25,13 +25,17 @@
 #include "ROOT/TExecutorCRTP.hxx"
 #include "ROOT/TSeq.hxx"
 #include "ROOT/TypeTraits.hxx" // InvokeResult
+#include "ROOT/RSlotStack.hxx"
 #include "RTaskArena.hxx"
 #include "TError.h"
 
+#include <algorithm> //std::min
 #include <functional> //std::function
 #include <initializer_list>
 #include <memory>
 #include <numeric> //std::accumulate
+#include <optional>
+#include <stdexcept>
 #include <type_traits> //std::enable_if
 #include <utility> //std::move
 #include <vector>
@@ -91,6 +95,19 @@ namespace ROOT {
       template <class F, class T, class R, class Cond = validMapReturnCond<F, T>>
       auto MapReduce(F func, const std::vector<T> &args, R redfunc, unsigned nChunks) -> InvokeResult_t<F, T>;
 
+      // StreamingMapReduce
+      //
+      // Variant of MapReduce folding each result as soon as it is computed into one of at most
+      // nPartials partial results, so that the memory does not grow with the number of tasks.
+      template <class F, class R, class Cond = validMapReturnCond<F>>
+      auto StreamingMapReduce(F func, unsigned nTimes, R redfunc, unsigned nPartials = 0) -> InvokeResult_t<F>;
+      template <class F, class INTEGER, class R, class Cond = validMapReturnCond<F, INTEGER>>
+      auto StreamingMapReduce(F func, ROOT::TSeq<INTEGER> args, R redfunc, unsigned nPartials = 0)
+         -> InvokeResult_t<F, INTEGER>;
+      template <class F, class T, class R, class Cond = validMapReturnCond<F, T>>
+      auto StreamingMapReduce(F func, const std::vector<T> &args, R redfunc, unsigned nPartials = 0)
+         -> InvokeResult_t<F, T>;
+
       using TExecutorCRTP<TThreadExecutor>::Reduce;
       template<class T, class R> auto Reduce(const std::vector<T> &objs, R redfunc) -> decltype(redfunc(objs));
       template<class T, class BINARYOP> auto Reduce(const std::vector<T> &objs, BINARYOP redfunc) -> decltype(redfunc(objs.front(), objs.front()));
@@ -129,6 +146,10 @@ namespace ROOT {
       float  ParallelReduce(const std::vector<float> &objs, const std::function<float(float a, float b)> &redfunc);
       template<class T, class R>
       auto SeqReduce(const std::vector<T> &objs, R redfunc) -> decltype(redfunc(objs));
+      template <class T, class R>
+      static T ReducePair(T &&a, T &&b, R &redfunc);
+      template <class T, class F, class R>
+      T StreamingMapReduceImpl(unsigned nTimes, F &func, R &redfunc, unsigned nPartials);
 
       /// Pointer to the TBB task arena wrapper
       std::shared_ptr<ROOT::Internal::RTaskArenaWrapper> fTaskArenaW = nullptr;
@@ -560,6 +581,111 @@ namespace ROOT {
       return Reduce(Map(func, args, redfunc, nChunks), redfunc);
    }
 
+   //////////////////////////////////////////////////////////////////////////
+   /// \brief Execute a function without arguments several times in parallel and accumulate the results into a
+   /// single value, folding each result as soon as it is computed.
+   ///
+   /// Unlike MapReduce, the results are not stored until the end of the Map: each of them is folded
+   /// into one of at most `nPartials` partial results, which are then combined by a parallel tree reduction.
+   /// The memory used is therefore independent of `nTimes`, which is useful when func returns large
+   /// objects such as histograms. The order in which the results are combined is not defined.
+   ///
+   /// \param func Function to be executed, returning the objects to combine.
+   /// \param nTimes Number of times function should be called. Must be larger than zero.
+   /// \param redfunc Reduction function, combining either two objects (binary function) or a vector of objects.
+   /// \param nPartials Maximum number of partial results, by default the number of workers.
+   /// \return The result of combining all the objects returned by func.
+   template <class F, class R, class Cond>
+   auto TThreadExecutor::StreamingMapReduce(F func, unsigned nTimes, R redfunc, unsigned nPartials)
+      -> InvokeResult_t<F>
+   {
+      auto mapFunc = [&func](unsigned) { return func(); };
+      return StreamingMapReduceImpl<InvokeResult_t<F>>(nTimes, mapFunc, redfunc, nPartials);
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// \brief Execute a function in parallel over a sequence of indexes and accumulate the results into a
+   /// single value, folding each result as soon as it is computed.
+   ///
+   /// \copydetails StreamingMapReduce(F func,unsigned nTimes,R redfunc,unsigned nPartials)
+   template <class F, class INTEGER, class R, class Cond>
+   auto TThreadExecutor::StreamingMapReduce(F func, ROOT::TSeq<INTEGER> args, R redfunc, unsigned nPartials)
+      -> InvokeResult_t<F, INTEGER>
+   {
+      auto mapFunc = [&func, &args](unsigned i) { return func(args[static_cast<INTEGER>(i)]); };
+      return StreamingMapReduceImpl<InvokeResult_t<F, INTEGER>>(args.size(), mapFunc, redfunc, nPartials);
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// \brief Execute a function in parallel over the elements of an immutable vector and accumulate the results
+   /// into a single value, folding each result as soon as it is computed.
+   ///
+   /// \copydetails StreamingMapReduce(F func,unsigned nTimes,R redfunc,unsigned nPartials)
+   template <class F, class T, class R, class Cond>
+   auto TThreadExecutor::StreamingMapReduce(F func, const std::vector<T> &args, R redfunc, unsigned nPartials)
+      -> InvokeResult_t<F, T>
+   {
+      auto mapFunc = [&func, &args](unsigned i) { return func(args[i]); };
+      return StreamingMapReduceImpl<InvokeResult_t<F, T>>(args.size(), mapFunc, redfunc, nPartials);
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// \brief Combine two objects with a binary reduction function, or with a reduction function taking a vector.
+   template <class T, class R>
+   T TThreadExecutor::ReducePair(T &&a, T &&b, R &redfunc)
+   {
+      if constexpr (std::is_invocable_r<T, R &, T, T>::value) {
+         return redfunc(std::move(a), std::move(b));
+      } else {
+         std::vector<T> objs;
+         objs.reserve(2);
+         objs.emplace_back(std::move(a));
+         objs.emplace_back(std::move(b));
+         static_assert(std::is_same<decltype(redfunc(objs)), T>::value, "redfunc does not have the correct signature");
+         return redfunc(objs);
+      }
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// \brief Implementation of StreamingMapReduce, calling func(i) for i in [0, nTimes).
+   ///
+   /// Each task folds its result into a partial result taken from a stack of slots, so that the folds
+   /// of different tasks run in parallel, load-balanced by the scheduler, and a slot is never used by
+   /// two tasks at the same time. The partial results are then combined pairwise in log2(nPartials) steps.
+   template <class T, class F, class R>
+   T TThreadExecutor::StreamingMapReduceImpl(unsigned nTimes, F &func, R &redfunc, unsigned nPartials)
+   {
+      if (nTimes == 0)
+         throw std::invalid_argument("TThreadExecutor::StreamingMapReduce: there are no objects to reduce.");
+      if (nPartials == 0)
+         nPartials = GetPoolSize();
+      nPartials = std::max(1u, std::min(nPartials, nTimes));
+
+      std::vector<std::optional<T>> partials(nPartials);
+      ROOT::Internal::RSlotStack slots(nPartials);
+      ParallelFor(0U, nTimes, 1, [&](unsigned int i) {
+         T result = func(i);
+         ROOT::Internal::RSlotStackRAII slot(slots);
+         auto &partial = partials[slot.fSlot];
+         if (partial)
+            partial = ReducePair(std::move(*partial), std::move(result), redfunc);
+         else
+            partial.emplace(std::move(result));
+      });
+
+      // the slots which were never used are empty, move the partial results to the front
+      auto last = std::remove_if(partials.begin(), partials.end(), [](const std::optional<T> &p) { return !p; });
+      partials.erase(last, partials.end());
+      const unsigned nFilled = partials.size();
+      for (unsigned stride = 1; stride < nFilled; stride *= 2) {
+         ParallelFor(0U, nFilled - stride, 2 * stride, [&](unsigned int i) {
+            partials[i] = ReducePair(std::move(*partials[i]), std::move(*partials[i + stride]), redfunc);
+            partials[i + stride].reset();
+         });
+      }
+      return std::move(*partials.front());
+   }
+
    //////////////////////////////////////////////////////////////////////////
    /// \copydoc ROOT::Internal::TExecutor::Reduce(const std::vector<T> &objs,R redfunc)
    template<class T, class R>
@@ -8,31 +8,57 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
-#include <ROOT/TSeq.hxx>
 #include <ROOT/RSlotStack.hxx>
 
 #include <cassert>
-#include <mutex> // std::lock_guard
+#include <functional> // std::hash
+#include <thread>     // std::this_thread
 
-ROOT::Internal::RSlotStack::RSlotStack(unsigned int size) : fSize(size)
+namespace {
+std::atomic<unsigned int> gNextSlotStackId{1};
+
+// The slot stack and the slot the current thread returned last
+struct RLastSlot {
+   unsigned int fStackId = 0;
+   unsigned int fSlot = 0;
+};
+thread_local RLastSlot gLastSlot;
+} // namespace
+
+ROOT::Internal::RSlotStack::RSlotStack(unsigned int size)
+   : fSize(size), fId(gNextSlotStackId++), fSlots(new RSlot[size])
 {
-   for (auto i : ROOT::TSeqU(size))
-      fStack.push(i);
 }
 
 void ROOT::Internal::RSlotStack::ReturnSlot(unsigned int slot)
 {
-   std::lock_guard<ROOT::TSpinMutex> guard(fMutex);
-   assert(fStack.size() < fSize && "Trying to put back a slot to a full stack!");
-   (void)fSize;
-   fStack.push(slot);
+#ifndef NDEBUG
+   const auto nInUse = fNInUse--;
+   assert(nInUse > 0 && "Trying to put back a slot to a full stack!");
+#endif
+   const bool wasInUse = fSlots[slot].fInUse.exchange(false, std::memory_order_release);
+   assert(wasInUse && "Trying to put back a slot to a full stack!");
+   (void)wasInUse;
+   gLastSlot = {fId, slot};
 }
 
 unsigned int ROOT::Internal::RSlotStack::GetSlot()
 {
-   std::lock_guard<ROOT::TSpinMutex> guard(fMutex);
-   assert(!fStack.empty() && "Trying to pop a slot from an empty stack!");
-   const auto slot = fStack.top();
-   fStack.pop();
-   return slot;
+#ifndef NDEBUG
+   const auto nInUse = fNInUse++;
+   assert(nInUse < fSize && "Trying to pop a slot from an empty stack!");
+#endif
+   // prefer the slot this thread used last, then look for a free one starting from it;
+   // threads without a previous slot start from different places to avoid contention
+   const unsigned int first = (gLastSlot.fStackId == fId)
+                                 ? gLastSlot.fSlot
+                                 : std::hash<std::thread::id>{}(std::this_thread::get_id()) % fSize;
+   while (true) {
+      for (unsigned int i = 0; i < fSize; ++i) {
+         const unsigned int slot = (first + i) % fSize;
+         if (TryGetSlot(slot))
+            return slot;
+      }
+      std::this_thread::yield();
+   }
 }
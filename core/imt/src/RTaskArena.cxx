@@ -7,14 +7,24 @@
 #include "TROOT.h"
 #include "TSystem.h"
 #include "TThread.h"
+#include <algorithm>
+#include <cstdlib>
 #include <fstream>
 #include <mutex>
+#include <sstream>
 #include <string>
 #include <thread>
+#include <vector>
 #include "tbb/task_arena.h"
+#include "tbb/task_scheduler_observer.h"
 #define TBB_PREVIEW_GLOBAL_CONTROL 1 // required for TBB versions preceding 2019_U4
 #include "tbb/global_control.h"
 
+#ifdef R__LINUX
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 //////////////////////////////////////////////////////////////////////////
 ///
 /// \class ROOT::Internal::RTaskArenaWrapper
@@ -42,9 +52,192 @@
 ///
 //////////////////////////////////////////////////////////////////////////
 
+namespace {
+
+using CPUGroups_t = std::vector<std::vector<unsigned>>;
+
+/// CPU binding requested with ROOT::Internal::SetTaskArenaCPUSet()
+struct RCPUSetConfig {
+   bool fIsSet = false;
+   std::string fCPUList;
+   bool fNUMAGroups = true;
+};
+
+RCPUSetConfig &GetCPUSetConfig(std::unique_lock<std::mutex> &lock)
+{
+   static std::mutex m;
+   static RCPUSetConfig config;
+   lock = std::unique_lock<std::mutex>(m);
+   return config;
+}
+
+#ifdef R__LINUX
+/// Parses a list of CPUs in the format of the Linux cpulist files, e.g. "0-3,8,10-11".
+bool ParseCPUList(const std::string &cpuList, std::vector<unsigned> &cpus)
+{
+   std::istringstream stream(cpuList);
+   std::string range;
+   while (std::getline(stream, range, ',')) {
+      if (range.find_first_not_of(" \t\n") == std::string::npos)
+         continue;
+      char *end = nullptr;
+      const long first = std::strtol(range.c_str(), &end, 10);
+      if (end == range.c_str())
+         return false;
+      long last = first;
+      if (*end == '-') {
+         const char *start = end + 1;
+         last = std::strtol(start, &end, 10);
+         if (end == start)
+            return false;
+      }
+      while (*end == ' ' || *end == '\t' || *end == '\n')
+         ++end;
+      if (*end != '\0' || first < 0 || last < first || last >= CPU_SETSIZE)
+         return false;
+      for (long cpu = first; cpu <= last; ++cpu)
+         cpus.push_back(cpu);
+   }
+   std::sort(cpus.begin(), cpus.end());
+   cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+   return true;
+}
+
+/// Splits a set of CPUs in groups of CPUs belonging to the same NUMA node.
+CPUGroups_t GroupByNUMANode(const std::vector<unsigned> &cpus)
+{
+   CPUGroups_t groups;
+   std::ifstream fNodes("/sys/devices/system/node/possible");
+   std::string line;
+   std::vector<unsigned> nodes;
+   if (std::getline(fNodes, line) && ParseCPUList(line, nodes)) {
+      for (auto node : nodes) {
+         std::ifstream fNode("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+         std::vector<unsigned> nodeCpus;
+         if (!std::getline(fNode, line) || !ParseCPUList(line, nodeCpus))
+            continue;
+         std::vector<unsigned> group;
+         std::set_intersection(cpus.begin(), cpus.end(), nodeCpus.begin(), nodeCpus.end(), std::back_inserter(group));
+         if (!group.empty())
+            groups.push_back(std::move(group));
+      }
+   }
+   if (groups.empty())
+      groups.push_back(cpus);
+   return groups;
+}
+
+// Affinity of the thread before it entered the task arena, restored when it leaves it
+thread_local cpu_set_t gSavedAffinity;
+thread_local int gArenaDepth = 0;
+#endif
+
+/// Returns the groups of CPUs to which the workers of the task arena are bound,
+/// empty if there is no binding.
+CPUGroups_t GetCPUGroups()
+{
+   std::string cpuList;
+   bool numaGroups = false;
+   {
+      std::unique_lock<std::mutex> lock;
+      const auto &config = GetCPUSetConfig(lock);
+      if (config.fIsSet) {
+         cpuList = config.fCPUList;
+         numaGroups = config.fNUMAGroups;
+      } else {
+         const char *envCPUSet = gSystem->Getenv("ROOT_IMT_CPUSET");
+         const char *envNUMA = gSystem->Getenv("ROOT_IMT_NUMA");
+         if (!envCPUSet && !envNUMA)
+            return {};
+         cpuList = envCPUSet ? envCPUSet : "";
+         numaGroups = envNUMA ? std::atoi(envNUMA) != 0 : true;
+      }
+   }
+   if (cpuList.empty() && !numaGroups)
+      return {};
+
+#ifdef R__LINUX
+   std::vector<unsigned> cpus;
+   if (cpuList.empty()) {
+      // all the CPUs available to the process
+      cpu_set_t affinity;
+      if (sched_getaffinity(0, sizeof(cpu_set_t), &affinity) != 0)
+         return {};
+      for (unsigned cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+         if (CPU_ISSET(cpu, &affinity))
+            cpus.push_back(cpu);
+      }
+   } else if (!ParseCPUList(cpuList, cpus) || cpus.empty()) {
+      Error("ROOT::Internal::RTaskArenaWrapper", "cannot parse the list of CPUs \"%s\"; ignoring.", cpuList.c_str());
+      return {};
+   }
+   return numaGroups ? GroupByNUMANode(cpus) : CPUGroups_t{cpus};
+#else
+   Warning("ROOT::Internal::RTaskArenaWrapper", "binding the workers to a set of CPUs is only supported on Linux");
+   return {};
+#endif
+}
+
+} // anonymous namespace
+
 namespace ROOT {
 namespace Internal {
 
+////////////////////////////////////////////////////////////////////////////////
+/// Binds the threads entering a task arena to a group of CPUs. The workers are
+/// assigned to the groups by blocks of consecutive arena slots, and get back their
+/// previous affinity when leaving the arena.
+////////////////////////////////////////////////////////////////////////////////
+class RCPUBindingObserver : public tbb::task_scheduler_observer {
+public:
+   RCPUBindingObserver(tbb::task_arena &arena, CPUGroups_t groups, unsigned nWorkers)
+      : tbb::task_scheduler_observer(arena), fGroups(std::move(groups)), fNWorkers(std::max(nWorkers, 1u))
+   {
+      observe(true);
+   }
+   ~RCPUBindingObserver() override { observe(false); }
+
+   void on_scheduler_entry(bool) override
+   {
+#ifdef R__LINUX
+      if (gArenaDepth++ > 0)
+         return;
+      const int slot = tbb::this_task_arena::current_thread_index();
+      if (slot < 0 || pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &gSavedAffinity) != 0) {
+         --gArenaDepth;
+         return;
+      }
+      const auto igroup = std::min<std::size_t>(slot * fGroups.size() / fNWorkers, fGroups.size() - 1);
+      cpu_set_t affinity;
+      CPU_ZERO(&affinity);
+      for (auto cpu : fGroups[igroup])
+         CPU_SET(cpu, &affinity);
+      pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &affinity);
+#endif
+   }
+
+   void on_scheduler_exit(bool) override
+   {
+#ifdef R__LINUX
+      if (gArenaDepth > 0 && --gArenaDepth == 0)
+         pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &gSavedAffinity);
+#endif
+   }
+
+private:
+   const CPUGroups_t fGroups;
+   const unsigned fNWorkers;
+};
+
+void SetTaskArenaCPUSet(const std::string &cpuList, bool numaGroups)
+{
+   std::unique_lock<std::mutex> lock;
+   auto &config = GetCPUSetConfig(lock);
+   config.fIsSet = true;
+   config.fCPUList = cpuList;
+   config.fNUMAGroups = numaGroups;
+}
+
 // Honor environment variable `ROOT_MAX_THREADS` if set.
 // Also honor cgroup quotas if set: see https://github.com/oneapi-src/oneTBB/issues/190
 int LogicalCPUBandwidthControl()
@@ -89,11 +282,19 @@ int LogicalCPUBandwidthControl()
 /// * Checks for CPU bandwidth control and avoids oversubscribing
 /// * If no BC in place and maxConcurrency<1, defaults to the default tbb number of threads,
 /// which is CPU affinity aware
+/// * Binds the workers to the CPUs set with SetTaskArenaCPUSet(), if any, and limits
+/// their number to the number of these CPUs
 ////////////////////////////////////////////////////////////////////////////////
 RTaskArenaWrapper::RTaskArenaWrapper(unsigned maxConcurrency) : fTBBArena(new ROpaqueTaskArena{})
 {
    const unsigned tbbDefaultNumberThreads = fTBBArena->max_concurrency(); // not initialized, automatic state
    maxConcurrency = maxConcurrency > 0 ? std::min(maxConcurrency, tbbDefaultNumberThreads) : tbbDefaultNumberThreads;
+   auto cpuGroups = GetCPUGroups();
+   unsigned boundCpus = 0;
+   for (const auto &group : cpuGroups)
+      boundCpus += group.size();
+   if (boundCpus > 0 && maxConcurrency > boundCpus)
+      maxConcurrency = boundCpus;
    const unsigned bcCpus = LogicalCPUBandwidthControl();
    if (maxConcurrency > bcCpus) {
       Warning("RTaskArenaWrapper", "CPU Bandwith Control Active. Proceeding with %d threads accordingly", bcCpus);
@@ -104,6 +305,8 @@ RTaskArenaWrapper::RTaskArenaWrapper(unsigned maxConcurrency) : fTBBArena(new RO
                                    "from this task arena available for execution.");
    }
    fTBBArena->initialize(maxConcurrency);
+   if (!cpuGroups.empty())
+      fCPUBinding.reset(new RCPUBindingObserver(*fTBBArena, std::move(cpuGroups), maxConcurrency));
    fNWorkers = maxConcurrency;
    ROOT::EnableThreadSafety();
 }
@@ -0,0 +1,119 @@
+// @(#)root/thread:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/TTaskGraph.hxx"
+
+#include "TROOT.h"
+
+#include <stdexcept>
+#include <string>
+
+/**
+\class ROOT::Experimental::TTaskGraph
+\ingroup Parallelism
+\brief A class to run a graph of work items with dependencies.
+
+The work items are added with AddTask(), together with the list of the items they
+depend on, which must have been added before: the graph is therefore acyclic.
+Run() starts the items without dependencies and returns; each item is then started
+as soon as all the items it depends on are completed. Wait() blocks until all the
+items are completed, after which the graph can be run again.
+
+If implicit multi-threading is enabled, the items run on ROOT's task arena through a
+TTaskGroup, otherwise Run() executes them sequentially in the order they were added.
+This allows to express pipelines, e.g. reading, decompressing and processing chunks
+of data, where the steps of different chunks overlap:
+~~~{.cpp}
+ROOT::Experimental::TTaskGraph graph;
+for (auto &chunk : chunks) {
+   auto read = graph.AddTask([&chunk] { chunk.Read(); });
+   auto unzip = graph.AddTask([&chunk] { chunk.Unzip(); }, {read});
+   graph.AddTask([&chunk] { chunk.Process(); }, {unzip});
+}
+graph.Run();
+graph.Wait();
+~~~
+*/
+
+namespace ROOT {
+namespace Experimental {
+
+TTaskGraph::~TTaskGraph()
+{
+   Wait();
+}
+
+/////////////////////////////////////////////////////////////////////////////
+/// Add to the graph an item of work, which will run once the items it depends
+/// on are completed. Returns the identifier of the item, to be used in the
+/// dependencies of the items added later.
+/// Items cannot be added while the graph is running.
+TTaskGraph::TaskId_t TTaskGraph::AddTask(const std::function<void(void)> &task, const std::vector<TaskId_t> &dependencies)
+{
+   if (fRunning)
+      throw std::runtime_error("TTaskGraph::AddTask: cannot add a task to a running graph.");
+   const TaskId_t id = fNodes.size();
+   for (auto dep : dependencies) {
+      if (dep >= id)
+         throw std::invalid_argument("TTaskGraph::AddTask: unknown dependency " + std::to_string(dep) + ".");
+   }
+   fNodes.push_back({task, {}, static_cast<unsigned>(dependencies.size())});
+   for (auto dep : dependencies)
+      fNodes[dep].fSuccessors.push_back(id);
+   return id;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+/// Run a task, then start the tasks for which it was the last dependency.
+void TTaskGraph::Execute(TaskId_t id)
+{
+   fNodes[id].fTask();
+   for (auto succ : fNodes[id].fSuccessors) {
+      if (--fPending[succ] == 0)
+         fTaskGroup->Run([this, succ] { Execute(succ); });
+   }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+/// Start the execution of the graph. With implicit multi-threading enabled the
+/// method returns immediately, otherwise all the tasks are run before returning.
+void TTaskGraph::Run()
+{
+   if (fRunning)
+      throw std::runtime_error("TTaskGraph::Run: the graph is already running.");
+   fRunning = true;
+   if (!ROOT::IsImplicitMTEnabled()) {
+      // the dependencies of a task were added before it
+      for (auto &node : fNodes)
+         node.fTask();
+      return;
+   }
+   fPending.reset(new std::atomic<unsigned>[fNodes.size()]);
+   for (TaskId_t id = 0; id < fNodes.size(); ++id)
+      fPending[id] = fNodes[id].fNDependencies;
+   fTaskGroup.reset(new TTaskGroup());
+   for (TaskId_t id = 0; id < fNodes.size(); ++id) {
+      if (fNodes[id].fNDependencies == 0)
+         fTaskGroup->Run([this, id] { Execute(id); });
+   }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+/// Wait until all the tasks of the graph are completed. This method is blocking.
+void TTaskGraph::Wait()
+{
+   if (fTaskGroup)
+      fTaskGroup->Wait();
+   fTaskGroup.reset();
+   fPending.reset();
+   fRunning = false;
+}
+} // namespace Experimental
+} // namespace ROOT
@@ -11,8 +11,14 @@
 #include <chrono>
 #include <condition_variable>
 #include <mutex>
+#include <numeric>
+#include <string>
 #include "gtest/gtest.h"
 
+#ifdef R__LINUX
+#include <sched.h>
+#endif
+
 #ifdef R__USE_IMT
 
 const unsigned maxConcurrency = ROOT::Internal::LogicalCPUBandwidthControl();
@@ -298,4 +304,58 @@ TEST(TThreadExecutor, TSeqActions)
    EXPECT_EQ(redfunc(ttex.Map(func, ROOT::TSeqI(5, 2, -2))), 8);
 }
 
+TEST(TThreadExecutor, StreamingMapReduce)
+{
+   ROOT::TThreadExecutor ttex(plausibleNCores(randGenerator));
+   auto sumfunc = [](long a, long b) { return a + b; };
+   auto redfunc = [](const std::vector<long> &v) { return std::accumulate(v.begin(), v.end(), 0l); };
+
+   for (unsigned nPartials : {0u, 1u, 3u, 100u}) {
+      EXPECT_EQ(ttex.StreamingMapReduce([] { return 1l; }, 10, sumfunc, nPartials), 10);
+      EXPECT_EQ(ttex.StreamingMapReduce([](long i) { return i; }, ROOT::TSeqL(2, 5), sumfunc, nPartials), 9);
+      EXPECT_EQ(ttex.StreamingMapReduce([](long i) { return i; }, ROOT::TSeqL(5, 2, -2), redfunc, nPartials), 8);
+      const std::vector<long> args(1000, 2);
+      EXPECT_EQ(ttex.StreamingMapReduce([](long i) { return 3 * i; }, args, redfunc, nPartials), 6000);
+   }
+
+   // large results are folded as they are computed
+   auto histos = [] { return std::vector<double>(1000, 1.); };
+   auto merge = [](std::vector<double> a, const std::vector<double> &b) {
+      for (std::size_t i = 0; i < a.size(); ++i)
+         a[i] += b[i];
+      return a;
+   };
+   const auto sum = ttex.StreamingMapReduce(histos, 500, merge);
+   EXPECT_EQ(sum.size(), 1000u);
+   EXPECT_EQ(sum.front(), 500.);
+   EXPECT_EQ(sum.back(), 500.);
+
+   EXPECT_THROW(ttex.StreamingMapReduce([] { return 1l; }, 0, sumfunc), std::invalid_argument);
+}
+
+#ifdef R__LINUX
+TEST(RTaskArena, CPUBinding)
+{
+   cpu_set_t affinity;
+   ASSERT_EQ(sched_getaffinity(0, sizeof(cpu_set_t), &affinity), 0);
+   int cpu = 0;
+   while (!CPU_ISSET(cpu, &affinity))
+      ++cpu;
+
+   ROOT::Internal::SetTaskArenaCPUSet(std::to_string(cpu), false);
+   {
+      auto gTAInstance = ROOT::Internal::GetGlobalTaskArena();
+      EXPECT_EQ(ROOT::Internal::RTaskArenaWrapper::TaskArenaSize(), 1u);
+      ROOT::TThreadExecutor ttex;
+      ttex.Foreach([cpu]() { EXPECT_EQ(sched_getcpu(), cpu); }, 10);
+   }
+   ROOT::Internal::SetTaskArenaCPUSet("", false);
+
+   // the thread gets back its affinity when leaving the arena
+   cpu_set_t after;
+   ASSERT_EQ(sched_getaffinity(0, sizeof(cpu_set_t), &after), 0);
+   EXPECT_TRUE(CPU_EQUAL(&affinity, &after));
+}
+#endif
+
 #endif
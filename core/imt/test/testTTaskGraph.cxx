@@ -0,0 +1,73 @@
+#include "TROOT.h"
+
+#include "gtest/gtest.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TTaskGraph.hxx"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace ROOT::Experimental;
+
+// Each stage of a chunk must see the previous stage completed
+void RunPipeline(TTaskGraph &graph, std::vector<std::atomic<int>> &stages)
+{
+   for (auto &stage : stages) {
+      auto read = graph.AddTask([&stage] { EXPECT_EQ(stage++, 0); });
+      auto unzip = graph.AddTask([&stage] { EXPECT_EQ(stage++, 1); }, {read});
+      graph.AddTask([&stage] { EXPECT_EQ(stage++, 2); }, {unzip});
+   }
+   graph.Run();
+   graph.Wait();
+   for (auto &stage : stages)
+      EXPECT_EQ(stage, 3);
+}
+
+TEST(TTaskGraph, Pipeline)
+{
+   ROOT::EnableImplicitMT(4);
+   TTaskGraph graph;
+   std::vector<std::atomic<int>> stages(100);
+   RunPipeline(graph, stages);
+   ROOT::DisableImplicitMT();
+}
+
+TEST(TTaskGraph, Sequential)
+{
+   TTaskGraph graph;
+   std::vector<std::atomic<int>> stages(10);
+   RunPipeline(graph, stages);
+}
+
+TEST(TTaskGraph, Join)
+{
+   ROOT::EnableImplicitMT(4);
+   std::atomic<int> ndone{0};
+   int result = -1;
+   TTaskGraph graph;
+   std::vector<TTaskGraph::TaskId_t> deps;
+   for (int i = 0; i < 50; ++i)
+      deps.push_back(graph.AddTask([&ndone] { ++ndone; }));
+   graph.AddTask([&] { result = ndone; }, deps);
+   EXPECT_EQ(graph.GetNTasks(), 51u);
+
+   // the graph can be run several times
+   for (int i = 1; i <= 2; ++i) {
+      graph.Run();
+      graph.Wait();
+      EXPECT_EQ(result, 50 * i);
+   }
+   ROOT::DisableImplicitMT();
+}
+
+TEST(TTaskGraph, InvalidDependency)
+{
+   TTaskGraph graph;
+   auto first = graph.AddTask([] {});
+   EXPECT_THROW(graph.AddTask([] {}, {first + 1}), std::invalid_argument);
+   EXPECT_EQ(graph.GetNTasks(), 1u);
+}
+
+#endif
@@ -95,6 +95,7 @@ In order to access the name of a class within the ROOT type system, the method T
 #include <string>
 #include <map>
 #include <typeinfo>
+#include <unordered_map>
 #include <cmath>
 #include <cassert>
 #include <vector>
@@ -488,6 +489,45 @@ DeclIdMap_t *TClass::GetDeclIdMap() {
 #endif
 }
 
+namespace {
+
+/// Incremented whenever a TClass is removed from the maps of classes, is unloaded or is deleted, which invalidates
+/// the TClass pointers cached by the threads for TClass::GetClass(const std::type_info &).
+std::atomic<ULong64_t> gTypeInfoCacheGeneration{0};
+
+/// Set when the cache of the thread has been destroyed, as classes can still be looked up during the teardown.
+thread_local bool gTypeInfoCacheDestroyed = false;
+
+/// Per-thread cache of the loaded classes returned by TClass::GetClass(const std::type_info &), which is looked up
+/// without taking ROOT::gCoreMutex.
+struct TTypeInfoCache {
+   ULong64_t fGeneration = 0;
+   std::unordered_map<const std::type_info *, TClass *> fClasses;
+
+   ~TTypeInfoCache() { gTypeInfoCacheDestroyed = true; }
+
+   /// Returns the cache of this thread, up to date with the removal of classes, or nullptr during the thread teardown.
+   static TTypeInfoCache *Get()
+   {
+      if (gTypeInfoCacheDestroyed)
+         return nullptr;
+      thread_local TTypeInfoCache cache;
+      const auto generation = gTypeInfoCacheGeneration.load(std::memory_order_acquire);
+      if (cache.fGeneration != generation) {
+         cache.fClasses.clear();
+         cache.fGeneration = generation;
+      }
+      return &cache;
+   }
+};
+
+void InvalidateTypeInfoCaches()
+{
+   gTypeInfoCacheGeneration.fetch_add(1, std::memory_order_acq_rel);
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// static: Add a class to the list and map of classes.
 
@@ -522,6 +562,7 @@ void TClass::RemoveClass(TClass *oldcl)
    if (!oldcl) return;
 
    R__LOCKGUARD(gInterpreterMutex);
+   InvalidateTypeInfoCaches();
    gROOT->GetListOfClasses()->Remove(oldcl);
    if (oldcl->GetTypeInfo()) {
       GetIdMap()->Remove(oldcl->GetTypeInfo()->name());
@@ -1661,6 +1702,8 @@ TClass::~TClass()
 {
    R__LOCKGUARD(gInterpreterMutex);
 
+   InvalidateTypeInfoCaches();
+
    // Remove from the typedef hashtables.
    if (fgClassTypedefHash && TestBit (kHasNameMapNode)) {
       TString resolvedThis = TClassEdit::ResolveTypedef (GetName(), kTRUE);
@@ -3256,12 +3299,24 @@ TClass *TClass::GetClass(const std::type_info& typeinfo, Bool_t load, Bool_t /*
    if (!gROOT->GetListOfClasses())
       return nullptr;
 
+   // Fast path for the classes that this thread already looked up
+   auto cache = TTypeInfoCache::Get();
+   if (cache) {
+      auto cached = cache->fClasses.find(&typeinfo);
+      if (cached != cache->fClasses.end())
+         return cached->second;
+   }
+
    //protect access to TROOT::GetIdMap
    R__READ_LOCKGUARD(ROOT::gCoreMutex);
 
    TClass* cl = GetIdMap()->Find(typeinfo.name());
 
-   if (cl && cl->IsLoaded()) return cl;
+   if (cl && cl->IsLoaded()) {
+      if (cache)
+         cache->fClasses.emplace(&typeinfo, cl);
+      return cl;
+   }
 
    R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
@@ -6313,6 +6368,7 @@ void TClass::SetUnloaded()
       return;
    }
    SetBit(kUnloading);
+   InvalidateTypeInfoCaches();
 
    //R__ASSERT(fState == kLoaded);
    if (fState != kLoaded) {
@@ -1,6 +1,11 @@
 #include "TClass.h"
 #include "THashTable.h"
 #include "TInterpreter.h"
+#include "TNamed.h"
+#include "TROOT.h"
+
+#include <thread>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -22,3 +27,27 @@ TEST(TClass, DictCheck)
 
    EXPECT_STREQ(errMsg.c_str(), "Missing dictionary for C, ") << errMsg;
 }
+
+TEST(TClass, GetClassFromTypeInfoConcurrently)
+{
+   ROOT::EnableThreadSafety();
+   TClass *expected = TNamed::Class();
+
+   std::vector<std::thread> threads;
+   std::vector<int> nMismatches(4, 0);
+   for (auto &n : nMismatches) {
+      threads.emplace_back([&n, expected]() {
+         // the second and later lookups of each thread are served by its cache
+         for (int i = 0; i < 1000; ++i) {
+            if (TClass::GetClass(typeid(TNamed)) != expected)
+               ++n;
+         }
+      });
+   }
+   for (auto &t : threads)
+      t.join();
+   for (auto n : nMismatches)
+      EXPECT_EQ(n, 0);
+
+   EXPECT_EQ(TClass::GetClass(typeid(TNamed)), expected);
+}
@@ -5573,7 +5573,8 @@ int TCling::ReadRootmapFile(const char *rootmapfile, TUniqueString *uniqueString
             }
             if (!lineDirective.empty())
                uniqueString->Append(lineDirective);
-            uniqueString->Append(line + '\n');
+            line += '\n';
+            uniqueString->Append(line);
          }
       }
       const char firstChar = line[0];
@@ -5850,8 +5851,14 @@ Int_t TCling::LoadLibraryMap(const char* rootmapfile)
    TEnvRec* rec;
    TIter next(fMapfile->GetTable());
    while ((rec = (TEnvRec*) next())) {
-      TString cls = rec->GetName();
-      if (!strncmp(cls.Data(), "Library.", 8) && cls.Length() > 8) {
+      // The table holds an entry for every class, namespace, typedef and header of all the rootmap files: avoid
+      // copying the names of the entries that are not in the old format.
+      const char *recName = rec->GetName();
+      if (!strncmp(recName, "Library.", 8) && recName[8]) {
+         // the class to library map is only printed here; the lookup for autoloading is done on fMapfile
+         if (gDebug <= 6)
+            continue;
+         TString cls = recName;
          // get the first lib from the list of lib and dependent libs
          TString libs = rec->GetValue();
          if (libs == "") {
@@ -5867,20 +5874,18 @@ Int_t TCling::LoadLibraryMap(const char* rootmapfile)
          // convert "-" to " ", since class names may have
          // blanks and TEnv considers a blank a terminator
          cls.ReplaceAll("-", " ");
-         if (gDebug > 6) {
-            const char* wlib = gSystem->DynamicPathName(lib, kTRUE);
-            if (wlib) {
-               Info("LoadLibraryMap", "class %s in %s", cls.Data(), wlib);
-            }
-            else {
-               Info("LoadLibraryMap", "class %s in %s (library does not exist)", cls.Data(), lib);
-            }
-            delete[] wlib;
+         const char* wlib = gSystem->DynamicPathName(lib, kTRUE);
+         if (wlib) {
+            Info("LoadLibraryMap", "class %s in %s", cls.Data(), wlib);
+         }
+         else {
+            Info("LoadLibraryMap", "class %s in %s (library does not exist)", cls.Data(), lib);
          }
+         delete[] wlib;
          delete tokens;
       }
-      else if (!strncmp(cls.Data(), "Declare.", 8) && cls.Length() > 8) {
-         cls.Remove(0, 8);
+      else if (!strncmp(recName, "Declare.", 8) && recName[8]) {
+         TString cls = recName + 8;
          // convert "-" to " ", since class names may have
          // blanks and TEnv considers a blank a terminator
          cls.ReplaceAll("-", " ");
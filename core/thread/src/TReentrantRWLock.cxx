@@ -24,7 +24,9 @@ In other word, the lock is re-entrant for both reading and writing.
 
 The implementation tries to make faster the scenario when readers come
 and go but there is no writer. In that case, readers will not pay the
-price of taking the internal spin lock.
+price of taking the internal spin lock. The reader counters are moreover
+split in per-thread stripes on separate cache lines, so that readers on
+different threads do not contend on the same memory location.
 
 Moreover, this RW lock tries to be fair with writers, giving them the
 possibility to claim the lock and wait for only the remaining readers,
@@ -54,6 +56,17 @@ using namespace ROOT;
    }
 #endif
 
+////////////////////////////////////////////////////////////////////////////
+/// Index of the stripe of the reader counters used by the current thread,
+/// assigned round-robin to the threads.
+
+unsigned Internal::StripedReaderCounts::GetLocalStripeIndex()
+{
+   static std::atomic<unsigned> gNextStripe{0};
+   thread_local const unsigned gStripe = gNextStripe++ % kNStripes;
+   return gStripe;
+}
+
 Internal::UniqueLockRecurseCount::UniqueLockRecurseCount()
 {
    static bool singleton = false;
@@ -69,7 +82,8 @@ Internal::UniqueLockRecurseCount::UniqueLockRecurseCount()
 template <typename MutexT, typename RecurseCountsT>
 TVirtualRWMutex::Hint_t *TReentrantRWLock<MutexT, RecurseCountsT>::ReadLock()
 {
-   ++fReaderReservation;
+   auto &counts = fReaderCounts.GetLocal();
+   ++counts.fReaderReservation;
 
    // if (fReaders == std::numeric_limits<decltype(fReaders)>::max()) {
    //    ::Fatal("TRWSpinLock::WriteLock", "Too many recursions in TRWSpinLock!");
@@ -81,25 +95,25 @@ TVirtualRWMutex::Hint_t *TReentrantRWLock<MutexT, RecurseCountsT>::ReadLock()
 
    if (!fWriter) {
       // There is no writer, go freely to the critical section
-      ++fReaders;
-      --fReaderReservation;
+      ++counts.fReaders;
+      --counts.fReaderReservation;
 
       hint = fRecurseCounts.IncrementReadCount(local, fMutex);
 
    } else if (fRecurseCounts.IsCurrentWriter(local)) {
 
-      --fReaderReservation;
+      --counts.fReaderReservation;
       // This can run concurrently with another thread trying to get
       // the read lock and ending up in the next section ("Wait for writers, if any")
       // which need to also get the local readers count and thus can
       // modify the map.
       hint = fRecurseCounts.IncrementReadCount(local, fMutex);
-      ++fReaders;
+      ++counts.fReaders;
 
    } else {
       // A writer claimed the RW lock, we will need to wait on the
       // internal lock
-      --fReaderReservation;
+      --counts.fReaderReservation;
 
       std::unique_lock<MutexT> lock(fMutex);
 
@@ -123,7 +137,7 @@ TVirtualRWMutex::Hint_t *TReentrantRWLock<MutexT, RecurseCountsT>::ReadLock()
       hint = fRecurseCounts.IncrementReadCount(local);
 
       // This RW lock now belongs to the readers
-      ++fReaders;
+      ++counts.fReaders;
 
       lock.unlock();
    }
@@ -146,8 +160,8 @@ void TReentrantRWLock<MutexT, RecurseCountsT>::ReadUnLock(TVirtualRWMutex::Hint_
       localReaderCount = reinterpret_cast<size_t*>(hint);
    }
 
-   --fReaders;
-   if (fWriterReservation && fReaders == 0) {
+   --fReaderCounts.GetLocal().fReaders;
+   if (fWriterReservation && fReaderCounts.GetReaders() == 0) {
       // We still need to lock here to prevent interleaving with a writer
       std::lock_guard<MutexT> lock(fMutex);
 
@@ -178,11 +192,12 @@ TVirtualRWMutex::Hint_t *TReentrantRWLock<MutexT, RecurseCountsT>::WriteLock()
    auto &readerCount = fRecurseCounts.GetLocalReadersCount(local);
    TVirtualRWMutex::Hint_t *hint = reinterpret_cast<TVirtualRWMutex::Hint_t *>(&readerCount);
 
-   fReaders -= readerCount;
+   auto &counts = fReaderCounts.GetLocal();
+   counts.fReaders -= readerCount;
 
    // Wait for other writers, if any
    if (fWriter && fRecurseCounts.IsNotCurrentWriter(local)) {
-      if (readerCount && fReaders == 0) {
+      if (readerCount && fReaderCounts.GetReaders() == 0) {
          // we decrease fReaders to zero, let's wake up the
          // other writer.
          fCond.notify_all();
@@ -195,14 +210,14 @@ TVirtualRWMutex::Hint_t *TReentrantRWLock<MutexT, RecurseCountsT>::WriteLock()
    fRecurseCounts.SetIsWriter(local);
 
    // Wait until all reader reservations finish
-   while (fReaderReservation) {
+   while (fReaderCounts.HasReaderReservation()) {
    };
 
    // Wait for remaining readers
-   fCond.wait(lock, [this] { return fReaders == 0; });
+   fCond.wait(lock, [this] { return fReaderCounts.GetReaders() == 0; });
 
    // Restore this thread's reader lock(s)
-   fReaders += readerCount;
+   counts.fReaders += readerCount;
 
    --fWriterReservation;
 
@@ -342,7 +357,9 @@ TReentrantRWLock<MutexT, RecurseCountsT>::Rewind(const State &earlierState) {
       // the snapshot and the rewind ... humm unless the lock held is a WriteLock
       // (the actual use case) in which case there is no other thread that can update fReaders
       // and we also assume that the "user code" is balanced and release all read locks it takes.
-      fReaders = typedState.fReadersCount + 1;
+      // The write lock being held, the readers of the other threads are all gone and
+      // the stripe of this thread holds the total number of readers.
+      fReaderCounts.GetLocal().fReaders = typedState.fReadersCount + 1;
       // Release this thread's reader lock(s)
       ReadUnLock(hint);
    }
@@ -381,7 +398,7 @@ void TReentrantRWLock<MutexT, RecurseCountsT>::Apply(std::unique_ptr<StateDelta>
    if (typedDelta->fDeltaReadersCount != 0) {
       ReadLock();
       // "- 1" due to ReadLock() above.
-      fReaders += typedDelta->fDeltaReadersCount - 1;
+      fReaderCounts.GetLocal().fReaders += typedDelta->fDeltaReadersCount - 1;
       *typedDelta->fReadersCountLoc += typedDelta->fDeltaReadersCount - 1;
    }
 }
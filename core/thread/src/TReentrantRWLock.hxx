@@ -273,14 +273,54 @@ struct RecurseCountsTBBUnique {
 };
 #endif
 
+/// Reader counters of a TReentrantRWLock, split in stripes on separate cache lines.
+/// A thread always uses the same stripe, so that readers on different threads take
+/// and release the lock without writing to a shared cache line; only writers need
+/// to look at all the stripes.
+class StripedReaderCounts {
+public:
+   struct alignas(64) Stripe {
+      std::atomic<int> fReaders{0};           ///<! Number of readers
+      std::atomic<int> fReaderReservation{0}; ///<! A reader wants access
+   };
+
+private:
+   static constexpr unsigned kNStripes = 32;
+   Stripe fStripes[kNStripes];
+
+   static unsigned GetLocalStripeIndex();
+
+public:
+   /// The stripe of the current thread
+   Stripe &GetLocal() { return fStripes[GetLocalStripeIndex()]; }
+
+   /// Total number of readers
+   int GetReaders() const
+   {
+      int readers = 0;
+      for (const auto &stripe : fStripes)
+         readers += stripe.fReaders;
+      return readers;
+   }
+
+   /// Whether a reader wants access
+   bool HasReaderReservation() const
+   {
+      for (const auto &stripe : fStripes) {
+         if (stripe.fReaderReservation)
+            return true;
+      }
+      return false;
+   }
+};
+
 } // Internal
 
 template <typename MutexT = ROOT::TSpinMutex, typename RecurseCountsT = Internal::RecurseCounts>
 class TReentrantRWLock {
 private:
 
-   std::atomic<int> fReaders;           ///<! Number of readers
-   std::atomic<int> fReaderReservation; ///<! A reader wants access
+   Internal::StripedReaderCounts fReaderCounts; ///<! Number of readers and reader reservations
    std::atomic<int> fWriterReservation; ///<! A writer wants access
    std::atomic<bool> fWriter;           ///<! Is there a writer?
    MutexT fMutex;                       ///<! RWlock internal mutex
@@ -301,7 +341,7 @@ public:
 
    ////////////////////////////////////////////////////////////////////////
    /// Regular constructor.
-   TReentrantRWLock() : fReaders(0), fReaderReservation(0), fWriterReservation(0), fWriter(false) {}
+   TReentrantRWLock() : fWriterReservation(0), fWriter(false) {}
 
    TVirtualRWMutex::Hint_t *ReadLock();
    void ReadUnLock(TVirtualRWMutex::Hint_t *);
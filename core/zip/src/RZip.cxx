@@ -13,6 +13,7 @@
 #include "ZipLZMA.h"
 #include "ZipLZ4.h"
 #include "ZipZSTD.h"
+#include "ROOT/RTraceSpan.hxx"
 
 #include "zlib.h"
 
@@ -325,6 +326,7 @@ int R__unzip_header(int *srcsize, uch *src, int *tgtsize)
 // age of the original code...
 void R__unzip(int *srcsize, uch *src, int *tgtsize, uch *tgt, int *irep)
 {
+   R__TRACE_SPAN("unzip", "R__unzip");
    long isize;
    uch *ibufptr, *obufptr;
    long ibufcnt, obufcnt;
@@ -393,35 +395,67 @@ void R__unzip(int *srcsize, uch *src, int *tgtsize, uch *tgt, int *irep)
    *irep = isize;
 }
 
+namespace {
+
+/// An inflate stream that stays initialized for the lifetime of a thread: inflateInit allocates the decompression
+/// state, which costs about as much as inflating a small basket, while inflateReset only rewinds it.
+struct RThreadLocalInflateStream {
+   z_stream fStream;
+   bool fInitialized = false;
+
+   RThreadLocalInflateStream()
+   {
+      fStream.next_in = Z_NULL;
+      fStream.avail_in = 0;
+      fStream.zalloc = (alloc_func)0;
+      fStream.zfree = (free_func)0;
+      fStream.opaque = (voidpf)0;
+   }
+   ~RThreadLocalInflateStream()
+   {
+      if (fInitialized)
+         inflateEnd(&fStream);
+   }
+
+   z_stream *Get()
+   {
+      int err = fInitialized ? inflateReset(&fStream) : inflateInit(&fStream);
+      if (err != Z_OK) {
+         fprintf(stderr, "R__unzip: error %d in inflateInit (zlib)\n", err);
+         if (fInitialized)
+            inflateEnd(&fStream);
+         fInitialized = false;
+         return nullptr;
+      }
+      fInitialized = true;
+      return &fStream;
+   }
+};
+
+} // anonymous namespace
+
 void R__unzipZLIB(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep)
 {
-     z_stream stream; /* decompression stream */
+     thread_local RThreadLocalInflateStream threadStream;
+     z_stream *stream = threadStream.Get(); /* decompression stream */
      int err = 0;
 
-     stream.next_in = (Bytef *)(&src[HDRSIZE]);
-     stream.avail_in = (uInt)(*srcsize) - HDRSIZE;
-     stream.next_out = (Bytef *)tgt;
-     stream.avail_out = (uInt)(*tgtsize);
-     stream.zalloc = (alloc_func)0;
-     stream.zfree = (free_func)0;
-     stream.opaque = (voidpf)0;
-
-     err = inflateInit(&stream);
-     if (err != Z_OK) {
-        fprintf(stderr, "R__unzip: error %d in inflateInit (zlib)\n", err);
+     if (!stream)
         return;
-     }
 
-     while ((err = inflate(&stream, Z_FINISH)) != Z_STREAM_END) {
+     stream->next_in = (Bytef *)(&src[HDRSIZE]);
+     stream->avail_in = (uInt)(*srcsize) - HDRSIZE;
+     stream->next_out = (Bytef *)tgt;
+     stream->avail_out = (uInt)(*tgtsize);
+
+     // The target size is known from the header, so the whole buffer is inflated in one go.
+     while ((err = inflate(stream, Z_FINISH)) != Z_STREAM_END) {
         if (err != Z_OK) {
-           inflateEnd(&stream);
            fprintf(stderr, "R__unzip: error %d in inflate (zlib)\n", err);
            return;
         }
      }
 
-     inflateEnd(&stream);
-
-     *irep = stream.total_out;
+     *irep = stream->total_out;
      return;
 }
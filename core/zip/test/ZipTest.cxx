@@ -4,6 +4,7 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <vector>
 
 static void testZipBufferSizes(ROOT::RCompressionSetting::EAlgorithm::EValues compressionAlgorithm)
 {
@@ -68,3 +69,53 @@ TEST(RZip, ZipBufferSizesZSTD)
 {
    testZipBufferSizes(ROOT::RCompressionSetting::EAlgorithm::kZSTD);
 }
+
+static void testUnzipRoundTrips(ROOT::RCompressionSetting::EAlgorithm::EValues compressionAlgorithm)
+{
+   static constexpr int BufferSize = 4096;
+   std::vector<char> source(BufferSize);
+   std::vector<char> zipped(BufferSize + 512);
+   std::vector<unsigned char> unzipped(BufferSize);
+
+   // Successive calls reuse the same thread-local (de)compression state, also after a corrupted buffer.
+   for (int iter = 0; iter < 20; iter++) {
+      for (int i = 0; i < BufferSize; i++)
+         source[i] = static_cast<char>((i * (iter + 1)) % 61);
+      int srcsize = BufferSize;
+      int tgtsize = static_cast<int>(zipped.size());
+      int irep = 0;
+      R__zipMultipleAlgorithm(1 + iter % 9, &srcsize, source.data(), &tgtsize, zipped.data(), &irep,
+                              compressionAlgorithm);
+      ASSERT_GT(irep, 0);
+
+      int zippedSize = irep;
+      int unzippedSize = BufferSize;
+      if (iter == 10) {
+         // corrupt the payload, the call must fail without affecting the following ones
+         zipped[zippedSize / 2] = static_cast<char>(~zipped[zippedSize / 2]);
+         zipped[zippedSize / 2 + 1] = static_cast<char>(~zipped[zippedSize / 2 + 1]);
+         R__unzip(&zippedSize, reinterpret_cast<unsigned char *>(zipped.data()), &unzippedSize, unzipped.data(),
+                  &irep);
+         continue;
+      }
+      R__unzip(&zippedSize, reinterpret_cast<unsigned char *>(zipped.data()), &unzippedSize, unzipped.data(), &irep);
+      ASSERT_EQ(irep, BufferSize);
+      for (int i = 0; i < BufferSize; i++)
+         EXPECT_EQ(static_cast<char>(unzipped[i]), source[i]);
+   }
+}
+
+TEST(RZip, UnzipRoundTripsZLIB)
+{
+   testUnzipRoundTrips(ROOT::RCompressionSetting::EAlgorithm::kZLIB);
+}
+
+TEST(RZip, UnzipRoundTripsZSTD)
+{
+   testUnzipRoundTrips(ROOT::RCompressionSetting::EAlgorithm::kZSTD);
+}
+
+TEST(RZip, UnzipRoundTripsLZ4)
+{
+   testUnzipRoundTrips(ROOT::RCompressionSetting::EAlgorithm::kLZ4);
+}
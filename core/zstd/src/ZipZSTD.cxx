@@ -22,14 +22,28 @@ static const int kHeaderSize = 9;
 
 static const size_t errorCodeSmallBuffer = (size_t)-70;
 
-void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
+// Creating a context allocates and initializes several hundred kB of tables, which dominates the cost of
+// (de)compressing small buffers: keep one context per thread and reuse it across calls.
+static ZSTD_CCtx *GetThreadLocalCCtx()
 {
     using Ctx_ptr = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>;
-    Ctx_ptr fCtx{ZSTD_createCCtx(), &ZSTD_freeCCtx};
+    thread_local Ctx_ptr fCtx{ZSTD_createCCtx(), &ZSTD_freeCCtx};
+    return fCtx.get();
+}
 
+static ZSTD_DCtx *GetThreadLocalDCtx()
+{
+    using Ctx_ptr = std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)>;
+    thread_local Ctx_ptr fCtx{ZSTD_createDCtx(), &ZSTD_freeDCtx};
+    return fCtx.get();
+}
+
+void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
+{
     *irep = 0;
 
-    size_t retval = ZSTD_compressCCtx(fCtx.get(),
+    // ZSTD_compressCCtx resets the parameters of the context, so nothing leaks from a previous call
+    size_t retval = ZSTD_compressCCtx(GetThreadLocalCCtx(),
                                         &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
                                         src, static_cast<size_t>(*srcsize),
                                         2*cxlevel);
@@ -60,8 +74,6 @@ void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, i
 
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep)
 {
-    using Ctx_ptr = std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)>;
-    Ctx_ptr fCtx{ZSTD_createDCtx(), &ZSTD_freeDCtx};
     *irep = 0;
 
     if (R__unlikely(src[0] != 'Z' || src[1] != 'S')) {
@@ -77,7 +89,7 @@ void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char
       return;
     }
 
-    size_t retval = ZSTD_decompressDCtx(fCtx.get(),
+    size_t retval = ZSTD_decompressDCtx(GetThreadLocalDCtx(),
                                         (char *)tgt, static_cast<size_t>(*tgtsize),
                                         (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
 
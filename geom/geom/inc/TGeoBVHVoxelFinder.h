@@ -0,0 +1,44 @@
+// @(#)root/geom:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TGeoBVHVoxelFinder
+#define ROOT_TGeoBVHVoxelFinder
+
+#include "TGeoVoxelFinder.h"
+
+class TGeoBVHVoxelFinder : public TGeoVoxelFinder {
+private:
+   void *fBVH = nullptr; //! bounding volume hierarchy of the daughter bounding boxes
+
+   TGeoBVHVoxelFinder(const TGeoBVHVoxelFinder &) = delete;
+   TGeoBVHVoxelFinder &operator=(const TGeoBVHVoxelFinder &) = delete;
+
+   void DeleteBVH();
+   void UpdateBVH();
+
+public:
+   TGeoBVHVoxelFinder() {}
+   TGeoBVHVoxelFinder(TGeoVolume *vol);
+   ~TGeoBVHVoxelFinder() override;
+
+   void BuildBVH();
+   Bool_t IsBVHBuilt() const { return fBVH != nullptr; }
+   Int_t *GetCheckList(const Double_t *point, Int_t &nelem, TGeoStateInfo &td) override;
+   Int_t *GetNextCandidates(const Double_t *point, Int_t &ncheck, TGeoStateInfo &td) override;
+   void FindOverlaps(Int_t inode) const override;
+   void Print(Option_t *option = "") const override;
+   Int_t *GetNextVoxel(const Double_t *point, const Double_t *dir, Int_t &ncheck, TGeoStateInfo &td) override;
+   void SortCrossedVoxels(const Double_t *point, const Double_t *dir, TGeoStateInfo &td) override;
+   void Voxelize(Option_t *option = "") override;
+
+   ClassDefOverride(TGeoBVHVoxelFinder, 1) // voxel finder based on a bounding volume hierarchy
+};
+
+#endif
@@ -144,6 +144,7 @@ private:
    Int_t fMaxThreads;                 //! Max number of threads
    Bool_t fMultiThread;               //! Flag for multi-threading
    Int_t fRaytraceMode;               //! Raytrace mode: 0=normal, 1=pass through, 2=transparent
+   Int_t fBVHVoxelThreshold;          //! Min number of daughters of volumes voxelized with a BVH (0=never)
    Bool_t fUsePWNav;                  // Activate usage of parallel world in navigation
    TGeoParallelWorld *fParallelWorld; // Parallel world
    ConstPropMap_t fProperties;        // Map of user-defined constant properties
@@ -155,6 +156,7 @@ private:
    void SetLoopVolumes(Bool_t flag = kTRUE) { fLoopVolumes = flag; }
    void UpdateElements();
    void Voxelize(Option_t *option = nullptr);
+   TGeoNavigatorArray *FindNavigatorArray() const;
 
 public:
    // constructors
@@ -437,6 +439,8 @@ public:
    static Int_t GetMaxXtruVert();
    Int_t GetMaxThreads() const { return fMaxThreads - 1; }
    void SetMaxThreads(Int_t nthreads);
+   Int_t GetBVHVoxelThreshold() const { return fBVHVoxelThreshold; }
+   void SetBVHVoxelThreshold(Int_t ndaughters);
    Int_t GetRTmode() const { return fRaytraceMode; }
    void SetRTmode(Int_t mode); // *MENU*
    Bool_t IsMultiThread() const { return fMultiThread; }
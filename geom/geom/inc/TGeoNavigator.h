@@ -108,8 +108,11 @@ public:
    TGeoNode *FindNextBoundary(Double_t stepmax = TGeoShape::Big(), const char *path = "", Bool_t frombdr = kFALSE);
    TGeoNode *FindNextDaughterBoundary(Double_t *point, Double_t *dir, Int_t &idaughter, Bool_t compmatrix = kFALSE);
    TGeoNode *FindNextBoundaryAndStep(Double_t stepmax = TGeoShape::Big(), Bool_t compsafe = kFALSE);
+   void FindNextBoundary_v(Int_t ntracks, const Double_t *points, const Double_t *dirs, Double_t *steps,
+                           Int_t *idaughters);
    TGeoNode *FindNode(Bool_t safe_start = kTRUE);
    TGeoNode *FindNode(Double_t x, Double_t y, Double_t z);
+   void FindNode_v(Int_t ntracks, const Double_t *points, TGeoNode **nodes);
    Double_t *FindNormal(Bool_t forward = kTRUE);
    Double_t *FindNormalFast();
    TGeoNode *InitTrack(const Double_t *point, const Double_t *dir);
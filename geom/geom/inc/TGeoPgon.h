@@ -14,28 +14,10 @@
 
 #include "TGeoPcon.h"
 
-#include <mutex>
-#include <vector>
-
 class TGeoPgon : public TGeoPcon {
-public:
-   struct ThreadData_t {
-      Int_t *fIntBuffer;    //![fNedges+4] temporary int buffer array
-      Double_t *fDblBuffer; //![fNedges+4] temporary double buffer array
-
-      ThreadData_t();
-      ~ThreadData_t();
-   };
-   ThreadData_t &GetThreadData() const;
-   void ClearThreadData() const override;
-   void CreateThreadData(Int_t nthreads) override;
-
 protected:
    // data members
-   Int_t fNedges;                                   // number of edges (at least one)
-   mutable std::vector<ThreadData_t *> fThreadData; //! Navigation data per thread
-   mutable Int_t fThreadSize;                       //! Size for the navigation data array
-   mutable std::mutex fMutex;                       //! Mutex for thread data
+   Int_t fNedges; // number of edges (at least one)
 
    // internal utility methods
    Int_t GetPhiCrossList(const Double_t *point, const Double_t *dir, Int_t istart, Double_t *sphi, Int_t *iphi,
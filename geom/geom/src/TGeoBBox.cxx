@@ -1200,8 +1200,20 @@ void TGeoBBox::FillBuffer3D(TBuffer3D &buffer, Int_t reqSections, Bool_t localFr
 
 void TGeoBBox::Contains_v(const Double_t *points, Bool_t *inside, Int_t vecsize) const
 {
-   for (Int_t i = 0; i < vecsize; i++)
-      inside[i] = Contains(&points[3 * i]);
+   // Shapes deriving from TGeoBBox without overriding this method are not boxes
+   if (IsA() != TGeoBBox::Class()) {
+      for (Int_t i = 0; i < vecsize; i++)
+         inside[i] = Contains(&points[3 * i]);
+      return;
+   }
+   // Same as Contains(), without branches so that the loop can be vectorized
+   const Double_t dx = fDX, dy = fDY, dz = fDZ;
+   const Double_t ox = fOrigin[0], oy = fOrigin[1], oz = fOrigin[2];
+   for (Int_t i = 0; i < vecsize; i++) {
+      const Double_t *point = &points[3 * i];
+      inside[i] = !(TMath::Abs(point[0] - ox) > dx) & !(TMath::Abs(point[1] - oy) > dy) &
+                  !(TMath::Abs(point[2] - oz) > dz);
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1221,8 +1233,29 @@ void TGeoBBox::ComputeNormal_v(const Double_t *points, const Double_t *dirs, Dou
 void TGeoBBox::DistFromInside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize,
                                 Double_t *step) const
 {
-   for (Int_t i = 0; i < vecsize; i++)
-      dists[i] = DistFromInside(&points[3 * i], &dirs[3 * i], 3, step[i]);
+   // Shapes deriving from TGeoBBox without overriding this method are not boxes
+   if (IsA() != TGeoBBox::Class()) {
+      for (Int_t i = 0; i < vecsize; i++)
+         dists[i] = DistFromInside(&points[3 * i], &dirs[3 * i], 3, step[i]);
+      return;
+   }
+   // Same as DistFromInside(), without branches so that the loop can be vectorized
+   const Double_t par[3] = {fDX, fDY, fDZ};
+   const Double_t origin[3] = {fOrigin[0], fOrigin[1], fOrigin[2]};
+   for (Int_t i = 0; i < vecsize; i++) {
+      const Double_t *point = &points[3 * i];
+      const Double_t *dir = &dirs[3 * i];
+      Double_t smin = TGeoShape::Big();
+      Bool_t outside = kFALSE;
+      for (Int_t j = 0; j < 3; j++) {
+         const Double_t newpt = point[j] - origin[j];
+         const Double_t s = ((dir[j] > 0) ? (par[j] - newpt) : -(par[j] + newpt)) / dir[j];
+         const Bool_t crossed = dir[j] != 0;
+         outside |= crossed & (s < 0);
+         smin = (crossed & (s < smin)) ? s : smin;
+      }
+      dists[i] = outside ? 0. : smin;
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,359 @@
+// @(#)root/geom:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/** \class TGeoBVHVoxelFinder
+\ingroup Geometry_classes
+
+Voxel finder organizing the bounding boxes of the daughters of a volume in a
+bounding volume hierarchy (BVH) instead of slices along the three axes.
+
+The candidate lists for locating a point (GetCheckList) and for propagating
+along a ray (SortCrossedVoxels, GetNextVoxel) are obtained by traversing the
+hierarchy, which costs O(log n) in the number of daughters, while the slices of
+TGeoVoxelFinder hold O(n) candidates when many daughters are aligned along all
+axes, and need O(n^2) memory to build. It is used instead of TGeoVoxelFinder for
+the volumes having at least TGeoManager::GetBVHVoxelThreshold() daughters.
+
+All the candidates crossed by a ray are returned at once, sorted by the
+distance at which the ray enters their bounding box, so GetNextVoxel() provides a
+single list per step. The hierarchy is built at first use, or in parallel for
+all the volumes by TGeoManager::CloseGeometry(). It is not streamed and is
+rebuilt after reading a geometry.
+*/
+
+#include "TGeoBVHVoxelFinder.h"
+
+#include "TGeoBBox.h"
+#include "TGeoNode.h"
+#include "TGeoVolume.h"
+#include "TGeoStateInfo.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+// this is for the bvh acceleration stuff
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wall"
+#pragma GCC diagnostic ignored "-Wshadow"
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+
+// V2 BVH
+#include <bvh/v2/bvh.h>
+#include <bvh/v2/vec.h>
+#include <bvh/v2/ray.h>
+#include <bvh/v2/node.h>
+#include <bvh/v2/stack.h>
+#include <bvh/v2/default_builder.h>
+
+#pragma GCC diagnostic pop
+
+ClassImp(TGeoBVHVoxelFinder);
+
+namespace {
+
+using Scalar = Double_t;
+using BBox = bvh::v2::BBox<Scalar, 3>;
+using Vec3 = bvh::v2::Vec<Scalar, 3>;
+using Node = bvh::v2::Node<Scalar, 3>;
+using Bvh = bvh::v2::Bvh<Node>;
+using Ray = bvh::v2::Ray<Scalar, 3>;
+
+// Margin added to the bounding boxes of the daughters, so that points on their
+// boundaries remain candidates despite the rounding of the box limits
+constexpr Double_t kBoxMargin = 1E-6;
+
+/// Bounding box of a daughter, enlarged by kBoxMargin.
+BBox GetDaughterBBox(const Double_t *boxes, Int_t id)
+{
+   const Double_t *box = &boxes[6 * id];
+   BBox bbox;
+   for (Int_t i = 0; i < 3; i++) {
+      bbox.min[i] = box[i + 3] - box[i] - kBoxMargin;
+      bbox.max[i] = box[i + 3] + box[i] + kBoxMargin;
+   }
+   return bbox;
+}
+
+Bool_t Contains(const BBox &bbox, const Double_t *point)
+{
+   return (point[0] >= bbox.min[0] && point[0] <= bbox.max[0]) &&
+          (point[1] >= bbox.min[1] && point[1] <= bbox.max[1]) &&
+          (point[2] >= bbox.min[2] && point[2] <= bbox.max[2]);
+}
+
+/// Distance along the ray at which it enters the box, or a negative value if it misses the box.
+Double_t DistToIn(const BBox &bbox, const Double_t *point, const Double_t *dir)
+{
+   Double_t tmin = 0;
+   Double_t tmax = TGeoShape::Big();
+   for (Int_t i = 0; i < 3; i++) {
+      if (TMath::Abs(dir[i]) < 1E-10) {
+         if (point[i] < bbox.min[i] || point[i] > bbox.max[i])
+            return -1.;
+         continue;
+      }
+      const Double_t invdir = 1. / dir[i];
+      Double_t t1 = (bbox.min[i] - point[i]) * invdir;
+      Double_t t2 = (bbox.max[i] - point[i]) * invdir;
+      if (t1 > t2)
+         std::swap(t1, t2);
+      tmin = std::max(tmin, t1);
+      tmax = std::min(tmax, t2);
+      if (tmin > tmax)
+         return -1.;
+   }
+   return tmin;
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Constructor
+
+TGeoBVHVoxelFinder::TGeoBVHVoxelFinder(TGeoVolume *vol) : TGeoVoxelFinder(vol) {}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Destructor
+
+TGeoBVHVoxelFinder::~TGeoBVHVoxelFinder()
+{
+   DeleteBVH();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Delete the bounding volume hierarchy.
+
+void TGeoBVHVoxelFinder::DeleteBVH()
+{
+   delete (Bvh *)fBVH;
+   fBVH = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Rebuild the voxels if they were invalidated, and the bounding volume
+/// hierarchy if it was not built yet.
+
+void TGeoBVHVoxelFinder::UpdateBVH()
+{
+   if (NeedRebuild()) {
+      Voxelize();
+      fVolume->FindOverlaps();
+   }
+   if (!fBVH)
+      BuildBVH();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the bounding volume hierarchy of the bounding boxes of the daughters.
+/// Only accesses the data of this voxel finder, so the hierarchies of different
+/// volumes can be built concurrently.
+
+void TGeoBVHVoxelFinder::BuildBVH()
+{
+   DeleteBVH();
+   Int_t nd = fVolume->GetNdaughters();
+   if (!fBoxes || !nd)
+      return;
+   std::vector<BBox> bboxes(nd);
+   std::vector<Vec3> centers(nd);
+   for (Int_t id = 0; id < nd; id++) {
+      bboxes[id] = GetDaughterBBox(fBoxes, id);
+      centers[id] = bboxes[id].get_center();
+   }
+   typename bvh::v2::DefaultBuilder<Node>::Config config;
+   config.quality = bvh::v2::DefaultBuilder<Node>::Quality::High;
+   fBVH = new Bvh(bvh::v2::DefaultBuilder<Node>::build(bboxes, centers, config));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the bounding boxes of the daughters. The bounding volume hierarchy is
+/// built by BuildBVH(), or at first use.
+
+void TGeoBVHVoxelFinder::Voxelize(Option_t * /*option*/)
+{
+   if (fVolume->IsAssembly())
+      fVolume->GetShape()->ComputeBBox();
+   Int_t nd = fVolume->GetNdaughters();
+   TGeoVolume *vd;
+   for (Int_t i = 0; i < nd; i++) {
+      vd = fVolume->GetNode(i)->GetVolume();
+      if (vd->IsAssembly())
+         vd->GetShape()->ComputeBBox();
+   }
+   BuildVoxelLimits();
+   DeleteBVH();
+   SetNeedRebuild(kFALSE);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get the list of daughters whose bounding box contains the point, in
+/// increasing order of their index.
+
+Int_t *TGeoBVHVoxelFinder::GetCheckList(const Double_t *point, Int_t &nelem, TGeoStateInfo &td)
+{
+   UpdateBVH();
+   nelem = 0;
+   auto mybvh = (Bvh *)fBVH;
+   if (!mybvh)
+      return nullptr;
+   const auto &root = mybvh->get_root();
+   if (!Contains(root.get_bbox(), point))
+      return nullptr;
+
+   auto leaf_fn = [&](size_t begin, size_t end) {
+      for (size_t prim_id = begin; prim_id < end; ++prim_id) {
+         const Int_t id = mybvh->prim_ids[prim_id];
+         if (Contains(GetDaughterBBox(fBoxes, id), point))
+            td.fVoxCheckList[nelem++] = id;
+      }
+      return false; // collect all the candidates
+   };
+   bvh::v2::GrowingStack<Bvh::Index> stack;
+   mybvh->traverse_top_down<false>(root.index, stack, leaf_fn, [&](const Node &left, const Node &right) {
+      return std::make_tuple(Contains(left.get_bbox(), point), Contains(right.get_bbox(), point), false);
+   });
+   if (!nelem)
+      return nullptr;
+   std::sort(td.fVoxCheckList, td.fVoxCheckList + nelem);
+   return td.fVoxCheckList;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// All the candidates are already returned by the first call to GetNextVoxel().
+
+Int_t *TGeoBVHVoxelFinder::GetNextCandidates(const Double_t * /*point*/, Int_t &ncheck, TGeoStateInfo & /*td*/)
+{
+   ncheck = 0;
+   return nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get the list of daughters whose bounding box is crossed by the ray, computed
+/// by SortCrossedVoxels(). The whole list is returned at the first call, and a
+/// null pointer at the next ones.
+
+Int_t *TGeoBVHVoxelFinder::GetNextVoxel(const Double_t * /*point*/, const Double_t * /*dir*/, Int_t &ncheck,
+                                        TGeoStateInfo &td)
+{
+   ncheck = 0;
+   if (td.fVoxCurrent++ > 0 || !td.fVoxNcandidates)
+      return nullptr;
+   ncheck = td.fVoxNcandidates;
+   return td.fVoxCheckList;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Store in the state the daughters whose bounding box is crossed by the ray,
+/// sorted by the distance at which the ray enters their bounding box.
+
+void TGeoBVHVoxelFinder::SortCrossedVoxels(const Double_t *point, const Double_t *dir, TGeoStateInfo &td)
+{
+   UpdateBVH();
+   td.fVoxCurrent = 0;
+   td.fVoxNcandidates = 0;
+   auto mybvh = (Bvh *)fBVH;
+   if (!mybvh)
+      return;
+
+   thread_local std::vector<std::pair<Double_t, Int_t>> crossed;
+   crossed.clear();
+   Ray ray(Vec3(point[0], point[1], point[2]), Vec3(dir[0], dir[1], dir[2]), 0., TGeoShape::Big());
+   bvh::v2::GrowingStack<Bvh::Index> stack;
+   mybvh->intersect<false, true>(ray, mybvh->get_root().index, stack, [&](size_t begin, size_t end) {
+      for (size_t prim_id = begin; prim_id < end; ++prim_id) {
+         const Int_t id = mybvh->prim_ids[prim_id];
+         const Double_t dist = DistToIn(GetDaughterBBox(fBoxes, id), point, dir);
+         if (dist >= 0)
+            crossed.emplace_back(dist, id);
+      }
+      return false; // collect all the candidates
+   });
+   std::sort(crossed.begin(), crossed.end());
+   for (const auto &candidate : crossed)
+      td.fVoxCheckList[td.fVoxNcandidates++] = candidate.second;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create the list of nodes for which the bboxes overlap with inode's bbox.
+/// Same result as TGeoVoxelFinder::FindOverlaps(), using the bounding volume
+/// hierarchy to find the candidates.
+
+void TGeoBVHVoxelFinder::FindOverlaps(Int_t inode) const
+{
+   if (!fBoxes)
+      return;
+   if (!fBVH)
+      const_cast<TGeoBVHVoxelFinder *>(this)->BuildBVH();
+   auto mybvh = (Bvh *)fBVH;
+   const BBox query = GetDaughterBBox(fBoxes, inode);
+   auto overlaps = [&query](const BBox &bbox) {
+      for (Int_t i = 0; i < 3; i++) {
+         if (bbox.max[i] < query.min[i] || bbox.min[i] > query.max[i])
+            return false;
+      }
+      return true;
+   };
+
+   const Double_t *box = &fBoxes[6 * inode];
+   std::vector<Int_t> ovlps;
+   auto leaf_fn = [&](size_t begin, size_t end) {
+      for (size_t prim_id = begin; prim_id < end; ++prim_id) {
+         const Int_t ib = mybvh->prim_ids[prim_id];
+         if (ib == inode)
+            continue; // everyone overlaps with itself
+         // strict overlap of the exact boxes, as in TGeoVoxelFinder
+         const Double_t *box1 = &fBoxes[6 * ib];
+         Bool_t overlap = kTRUE;
+         for (Int_t i = 0; i < 3 && overlap; i++) {
+            const Double_t ddx1 = box[i + 3] + box[i] - (box1[i + 3] - box1[i]);
+            const Double_t ddx2 = box1[i + 3] + box1[i] - (box[i + 3] - box[i]);
+            overlap = ddx1 * ddx2 > 0.;
+         }
+         if (overlap)
+            ovlps.push_back(ib);
+      }
+      return false;
+   };
+   const auto &root = mybvh->get_root();
+   if (overlaps(root.get_bbox())) {
+      bvh::v2::GrowingStack<Bvh::Index> stack;
+      mybvh->traverse_top_down<false>(root.index, stack, leaf_fn, [&](const Node &left, const Node &right) {
+         return std::make_tuple(overlaps(left.get_bbox()), overlaps(right.get_bbox()), false);
+      });
+   }
+
+   TGeoNode *node = fVolume->GetNode(inode);
+   if (ovlps.empty()) {
+      node->SetOverlaps(nullptr, 0);
+      return;
+   }
+   std::sort(ovlps.begin(), ovlps.end());
+   Int_t novlp = ovlps.size();
+   Int_t *list = new Int_t[novlp];
+   std::copy(ovlps.begin(), ovlps.end(), list);
+   node->SetOverlaps(list, novlp);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Print the voxels.
+
+void TGeoBVHVoxelFinder::Print(Option_t *) const
+{
+   const_cast<TGeoBVHVoxelFinder *>(this)->UpdateBVH();
+   auto mybvh = (Bvh *)fBVH;
+   printf("BVH voxels for volume %s (nd=%i)\n", fVolume->GetName(), fVolume->GetNdaughters());
+   if (!mybvh)
+      return;
+   const auto &root = mybvh->get_root().get_bbox();
+   printf("nodes : %zu\n", mybvh->nodes.size());
+   printf("limits : x=[%g, %g] y=[%g, %g] z=[%g, %g]\n", root.min[0], root.max[0], root.min[1], root.max[1],
+          root.min[2], root.max[2]);
+}
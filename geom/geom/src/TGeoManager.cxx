@@ -239,6 +239,9 @@ in order to enhance rays.
 #include <cstdlib>
 #include <iostream>
 #include <fstream>
+#include <algorithm>
+#include <atomic>
+#include <vector>
 
 #include "TROOT.h"
 #include "TGeoManager.h"
@@ -251,8 +254,10 @@ in order to enhance rays.
 #include "TClass.h"
 #include "ThreadLocalStorage.h"
 #include "TBufferText.h"
+#include "TSystem.h"
 
 #include "TGeoVoxelFinder.h"
+#include "TGeoBVHVoxelFinder.h"
 #include "TGeoElement.h"
 #include "TGeoMaterial.h"
 #include "TGeoMedium.h"
@@ -286,6 +291,18 @@ in order to enhance rays.
 #include "TGDMLMatrix.h"
 #include "TGeoOpticalSurface.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
+// this is for the parallel build of the BVH voxel finders
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wall"
+#pragma GCC diagnostic ignored "-Wshadow"
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#include <bvh/v2/thread_pool.h>
+#pragma GCC diagnostic pop
+
 // statics and globals
 
 TGeoManager *gGeoManager = nullptr;
@@ -303,6 +320,13 @@ Int_t TGeoManager::fgNumThreads = 0;
 UInt_t TGeoManager::fgExportPrecision = 17;
 TGeoManager::EDefaultUnits TGeoManager::fgDefaultUnits = TGeoManager::kRootUnits;
 TGeoManager::ThreadsMap_t *TGeoManager::fgThreadId = nullptr;
+
+namespace {
+// Incremented when navigator arrays are deleted or thread ids are reassigned, to invalidate
+// the values cached by each thread
+std::atomic<UInt_t> gNavigatorsGeneration{0};
+std::atomic<UInt_t> gThreadIdGeneration{0};
+} // anonymous namespace
 static Bool_t gGeometryLocked = kFALSE;
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -382,6 +406,7 @@ TGeoManager::TGeoManager()
       fValuePNEId = nullptr;
       fMultiThread = kFALSE;
       fRaytraceMode = 0;
+      fBVHVoxelThreshold = 0;
       fMaxThreads = 0;
       fUsePWNav = kFALSE;
       fParallelWorld = nullptr;
@@ -493,6 +518,7 @@ void TGeoManager::Init()
    fValuePNEId = nullptr;
    fMultiThread = kFALSE;
    fRaytraceMode = 0;
+   fBVHVoxelThreshold = 0;
    fMaxThreads = 0;
    fUsePWNav = kFALSE;
    fParallelWorld = nullptr;
@@ -814,20 +840,41 @@ TGeoNavigator *TGeoManager::AddNavigator()
 
 TGeoNavigator *TGeoManager::GetCurrentNavigator() const
 {
-   TTHREAD_TLS(TGeoNavigator *) tnav = nullptr;
    if (!fMultiThread)
       return fCurrentNavigator;
-   TGeoNavigator *nav = tnav; // TTHREAD_TLS_GET(TGeoNavigator*,tnav);
-   if (nav)
-      return nav;
-   std::thread::id threadId = std::this_thread::get_id();
-   NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
-   if (it == fNavigators.end())
+   TGeoNavigatorArray *array = FindNavigatorArray();
+   if (!array)
       return nullptr;
-   TGeoNavigatorArray *array = it->second;
-   nav = array->GetCurrentNavigator();
-   tnav = nav; // TTHREAD_TLS_SET(TGeoNavigator*,tnav,nav);
-   return nav;
+   return array->GetCurrentNavigator();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Find the navigator array of the calling thread. The array is cached in
+/// thread-local storage, so that the map of navigators is only looked up,
+/// under lock, the first time a thread uses this manager or after navigators
+/// were deleted.
+
+TGeoNavigatorArray *TGeoManager::FindNavigatorArray() const
+{
+   TTHREAD_TLS(const TGeoManager *) tmanager = nullptr;
+   TTHREAD_TLS(TGeoNavigatorArray *) tarray = nullptr;
+   TTHREAD_TLS(UInt_t) tgeneration = 0;
+   UInt_t generation = gNavigatorsGeneration.load(std::memory_order_acquire);
+   if (tmanager == this && tgeneration == generation)
+      return tarray;
+   if (fMultiThread)
+      fgMutex.lock();
+   NavigatorsMap_t::const_iterator it = fNavigators.find(std::this_thread::get_id());
+   TGeoNavigatorArray *array = (it == fNavigators.end()) ? nullptr : it->second;
+   if (fMultiThread)
+      fgMutex.unlock();
+   // do not cache a missing array, which may be added later
+   if (array) {
+      tmanager = this;
+      tarray = array;
+      tgeneration = generation;
+   }
+   return array;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -835,12 +882,7 @@ TGeoNavigator *TGeoManager::GetCurrentNavigator() const
 
 TGeoNavigatorArray *TGeoManager::GetListOfNavigators() const
 {
-   std::thread::id threadId = std::this_thread::get_id();
-   NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
-   if (it == fNavigators.end())
-      return nullptr;
-   TGeoNavigatorArray *array = it->second;
-   return array;
+   return FindNavigatorArray();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -849,13 +891,12 @@ TGeoNavigatorArray *TGeoManager::GetListOfNavigators() const
 Bool_t TGeoManager::SetCurrentNavigator(Int_t index)
 {
    std::thread::id threadId = std::this_thread::get_id();
-   NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
-   if (it == fNavigators.end()) {
+   TGeoNavigatorArray *array = FindNavigatorArray();
+   if (!array) {
       Error("SetCurrentNavigator", "No navigator defined for this thread\n");
       std::cout << "  thread id: " << threadId << std::endl;
       return kFALSE;
    }
-   TGeoNavigatorArray *array = it->second;
    TGeoNavigator *nav = array->SetCurrentNavigator(index);
    if (!nav) {
       Error("SetCurrentNavigator", "Navigator %d not existing for this thread\n", index);
@@ -889,6 +930,7 @@ void TGeoManager::ClearNavigators()
          delete arr;
    }
    fNavigators.clear();
+   gNavigatorsGeneration++;
    if (fMultiThread)
       fgMutex.unlock();
 }
@@ -905,8 +947,10 @@ void TGeoManager::RemoveNavigator(const TGeoNavigator *nav)
       if (arr) {
          if ((TGeoNavigator *)arr->Remove((TObject *)nav)) {
             delete nav;
-            if (!arr->GetEntries())
+            if (!arr->GetEntries()) {
                fNavigators.erase(it);
+               gNavigatorsGeneration++;
+            }
             if (fMultiThread)
                fgMutex.unlock();
             return;
@@ -989,6 +1033,7 @@ void TGeoManager::ClearThreadsMap()
    if (!fgThreadId->empty())
       fgThreadId->clear();
    fgNumThreads = 0;
+   gThreadIdGeneration++;
    fgMutex.unlock();
 }
 
@@ -999,22 +1044,24 @@ void TGeoManager::ClearThreadsMap()
 Int_t TGeoManager::ThreadId()
 {
    TTHREAD_TLS(Int_t) tid = -1;
-   Int_t ttid = tid; // TTHREAD_TLS_GET(Int_t,tid);
-   if (ttid > -1)
-      return ttid;
+   TTHREAD_TLS(UInt_t) tgeneration = 0;
+   UInt_t generation = gThreadIdGeneration.load(std::memory_order_acquire);
+   if (tid > -1 && tgeneration == generation)
+      return tid;
    if (gGeoManager && !gGeoManager->IsMultiThread())
       return 0;
    std::thread::id threadId = std::this_thread::get_id();
+   // The map is only looked up the first time a thread asks for its id, or after the ids were cleared
+   std::lock_guard<std::mutex> guard(fgMutex);
    TGeoManager::ThreadsMapIt_t it = fgThreadId->find(threadId);
-   if (it != fgThreadId->end())
-      return it->second;
-   // Map needs to be updated.
-   fgMutex.lock();
-   (*fgThreadId)[threadId] = fgNumThreads;
-   tid = fgNumThreads; // TTHREAD_TLS_SET(Int_t,tid,fgNumThreads);
-   ttid = fgNumThreads++;
-   fgMutex.unlock();
-   return ttid;
+   if (it != fgThreadId->end()) {
+      tid = it->second;
+   } else {
+      (*fgThreadId)[threadId] = fgNumThreads;
+      tid = fgNumThreads++;
+   }
+   tgeneration = generation;
+   return tid;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3112,6 +3159,22 @@ void TGeoManager::SetRTmode(Int_t mode)
       ModifiedPad();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Voxelize the volumes having at least ndaughters daughters with a
+/// TGeoBVHVoxelFinder, which finds the candidate daughters in logarithmic time,
+/// instead of a TGeoVoxelFinder. The hierarchies of all these volumes are built
+/// in parallel when closing the geometry. A value of 0 (the default) disables
+/// the BVH voxel finders. Must be called before CloseGeometry().
+
+void TGeoManager::SetBVHVoxelThreshold(Int_t ndaughters)
+{
+   if (fClosed) {
+      Error("SetBVHVoxelThreshold", "Cannot change the voxelization after closing the geometry");
+      return;
+   }
+   fBVHVoxelThreshold = TMath::Max(ndaughters, 0);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Restore the master volume of the geometry.
 
@@ -3133,15 +3196,73 @@ void TGeoManager::Voxelize(Option_t *option)
    if (!fStreamVoxels && fgVerboseLevel > 0)
       Info("Voxelize", "Voxelizing...");
    //   Int_t nentries = fVolumes->GetSize();
+   // Sort the nodes and compute the bounding boxes of the assemblies, which depend on their
+   // daughters, first. The volumes can then be voxelized independently of each other.
+   std::vector<TGeoVolume *> volumes;
+   volumes.reserve(fVolumes->GetEntriesFast());
    TIter next(fVolumes);
    while ((vol = (TGeoVolume *)next())) {
       if (!fIsGeomReading)
          vol->SortNodes();
-      if (!fStreamVoxels) {
-         vol->Voxelize(option);
+      if (vol->IsAssembly())
+         vol->GetShape()->ComputeBBox();
+      volumes.push_back(vol);
+   }
+   // BVH voxel finder of the volume if its hierarchy still has to be built
+   auto getPendingBVH = [](const TGeoVolume *v) -> TGeoBVHVoxelFinder * {
+      TGeoVoxelFinder *voxels = v->GetVoxels();
+      if (!voxels || !voxels->InheritsFrom(TGeoBVHVoxelFinder::Class()) || voxels->NeedRebuild())
+         return nullptr;
+      auto bvhvoxels = (TGeoBVHVoxelFinder *)voxels;
+      return bvhvoxels->IsBVHBuilt() ? nullptr : bvhvoxels;
+   };
+
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && volumes.size() > 1) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](TGeoVolume *v) {
+            if (!fStreamVoxels)
+               v->Voxelize(option);
+            if (auto bvhvoxels = getPendingBVH(v))
+               bvhvoxels->BuildBVH();
+            if (!fIsGeomReading)
+               v->FindOverlaps();
+         },
+         volumes);
+      return;
+   }
+#endif
+
+   // The hierarchies of the BVH voxel finders are built in parallel once all volumes are voxelized
+   std::vector<TGeoBVHVoxelFinder *> bvhfinders;
+   std::vector<TGeoVolume *> bvhvolumes;
+   for (auto v : volumes) {
+      if (!fStreamVoxels)
+         v->Voxelize(option);
+      if (auto bvhvoxels = getPendingBVH(v)) {
+         bvhfinders.push_back(bvhvoxels);
+         bvhvolumes.push_back(v);
+         continue;
       }
       if (!fIsGeomReading)
-         vol->FindOverlaps();
+         v->FindOverlaps();
+   }
+   if (bvhfinders.empty())
+      return;
+   if (fgVerboseLevel > 0)
+      Info("Voxelize", "Building the BVH of %zu volumes...", bvhfinders.size());
+   if (bvhfinders.size() == 1) {
+      bvhfinders[0]->BuildBVH();
+   } else {
+      bvh::v2::ThreadPool pool(std::min<size_t>(bvhfinders.size(), std::thread::hardware_concurrency()));
+      for (auto bvhvoxels : bvhfinders)
+         pool.push([bvhvoxels](size_t) { bvhvoxels->BuildBVH(); });
+      pool.wait();
+   }
+   if (!fIsGeomReading) {
+      for (auto v : bvhvolumes)
+         v->FindOverlaps();
    }
 }
 
@@ -4090,10 +4211,15 @@ void TGeoManager::SetVerboseLevel(Int_t vl)
 ///    Import in memory from filename the geometry with key=name.
 ///    if name="" (default), the first TGeoManager object in the file is returned.
 ///
+/// For gdml files, the option "c" keeps a cache of the closed geometry, including
+/// its voxels, in the ROOT file <name>_gdml.root next to <name>.gdml. The cache is
+/// imported instead of parsing and voxelizing the gdml geometry when it is more
+/// recent than the gdml file, and it is (re)created otherwise.
+///
 /// Note that this function deletes the current gGeoManager (if one)
 /// before importing the new object.
 
-TGeoManager *TGeoManager::Import(const char *filename, const char *name, Option_t * /*option*/)
+TGeoManager *TGeoManager::Import(const char *filename, const char *name, Option_t *option)
 {
    if (fgLock) {
       ::Warning("TGeoManager::Import", "TGeoMananager in lock mode. NOT IMPORTING new geometry");
@@ -4108,6 +4234,22 @@ TGeoManager *TGeoManager::Import(const char *filename, const char *name, Option_
       delete gGeoManager;
    gGeoManager = nullptr;
 
+   TString opt(option);
+   opt.ToLower();
+   TString cachefile;
+   if (strstr(filename, ".gdml") && opt.Contains("c")) {
+      cachefile = filename;
+      cachefile.ReplaceAll(".gdml", "_gdml.root");
+      FileStat_t gdmlstat, cachestat;
+      if (!gSystem->GetPathInfo(filename, gdmlstat) && !gSystem->GetPathInfo(cachefile, cachestat) &&
+          cachestat.fMtime >= gdmlstat.fMtime) {
+         if (fgVerboseLevel > 0)
+            ::Info("TGeoManager::Import", "Reading geometry and voxels from cache file: %s", cachefile.Data());
+         filename = cachefile.Data();
+         name = nullptr;
+      }
+   }
+
    if (strstr(filename, ".gdml")) {
       // import from a gdml file
       new TGeoManager("GDMLImport", "Geometry imported from GDML");
@@ -4122,6 +4264,11 @@ TGeoManager *TGeoManager::Import(const char *filename, const char *name, Option_
          gGeoManager->SetTopVolume(world);
          gGeoManager->CloseGeometry();
          gGeoManager->DefaultColors();
+         if (!cachefile.IsNull()) {
+            if (fgVerboseLevel > 0)
+               ::Info("TGeoManager::Import", "Writing geometry and voxels to cache file: %s", cachefile.Data());
+            gGeoManager->Export(cachefile, "", "v");
+         }
       }
    } else {
       // import from a root file
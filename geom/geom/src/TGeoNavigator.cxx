@@ -43,12 +43,38 @@ gGeoManager->SetCurrentNavigator(0);
 #include "TGeoParallelWorld.h"
 #include "TGeoPhysicalNode.h"
 
+#include <memory>
+#include <vector>
+
 static Double_t gTolerance = TGeoShape::Tolerance();
 const char *kGeoOutsidePath = " ";
 const Int_t kN3 = 3 * sizeof(Double_t);
 
 Bool_t TGeoNavigator::fgUsePWSafetyCaching = kFALSE;
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Check if all the daughters of a volume can be checked for a basket of tracks at once,
+/// i.e. if FindNextDaughterBoundary() would check all of them without using the voxels,
+/// the division pattern or the overlap information.
+
+Bool_t CheckAllDaughters(const TGeoManager *geom, const TGeoVolume *vol)
+{
+   Int_t nd = vol->GetNdaughters();
+   if (vol->GetFinder() || geom->IsActivityEnabled())
+      return kFALSE;
+   if (nd >= 5 && vol->GetVoxels())
+      return kFALSE;
+   for (Int_t i = 0; i < nd; i++) {
+      if (vol->GetNode(i)->IsOverlapping())
+         return kFALSE;
+   }
+   return kTRUE;
+}
+
+} // anonymous namespace
+
 ClassImp(TGeoNavigator);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -980,6 +1006,128 @@ TGeoNode *TGeoNavigator::FindNextBoundary(Double_t stepmax, const char *path, Bo
    return fNextNode;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the distances to the next boundary for a basket of tracks located in the
+/// current volume. The points and directions are given in the master frame, as x, y, z
+/// triplets for each track. On input steps[i] is the maximum step proposed for track i,
+/// which must be positive. On output it is the distance to the next boundary if this is
+/// shorter than the proposed step, and idaughters[i] is the index of the daughter of the
+/// current volume which is entered, -1 if the track exits the current volume or -2 if no
+/// boundary is crossed within the proposed step, like GetNextDaughterIndex() after
+/// FindNextBoundary().
+///
+/// The distances to exit the current volume, and in the simple cases where all the daughters
+/// are checked the distances to enter each of them, are computed for all the tracks at once
+/// with TGeoShape::DistFromInside_v() and TGeoShape::DistFromOutside_v(), which are
+/// vectorized for the most common shapes. The daughters of voxelized volumes with many
+/// daughters, of divided volumes or of volumes with overlapping daughters are checked track
+/// by track, as in FindNextBoundary(). If the navigator is outside the geometry, in an
+/// assembly or in an overlapping node, each track is processed by FindNextBoundary(), and
+/// idaughters[i] may also be -3 as GetNextDaughterIndex().
+///
+/// The state of the navigator, including the results of the last FindNextBoundary(), is not
+/// changed, except for the backup state used by Step() in the last case.
+
+void TGeoNavigator::FindNextBoundary_v(Int_t ntracks, const Double_t *points, const Double_t *dirs, Double_t *steps,
+                                       Int_t *idaughters)
+{
+   if (ntracks <= 0)
+      return;
+   // Save what FindNextBoundary() and FindNextDaughterBoundary() change
+   Double_t step = fStep;
+   Double_t safety = fSafety;
+   Double_t lastsafety = fLastSafety;
+   Double_t lastpoint[3];
+   memcpy(lastpoint, fLastPoint, kN3);
+   TGeoNode *nextnode = fNextNode;
+   TGeoNode *forcednode = fForcedNode;
+   Int_t nextindex = fNextDaughterIndex;
+   Bool_t stepentering = fIsStepEntering;
+   Bool_t stepexiting = fIsStepExiting;
+   Bool_t onboundary = fIsOnBoundary;
+
+   TGeoVolume *vol = fCurrentNode->GetVolume();
+   if (fIsOutside || fNmany || vol->IsAssembly()) {
+      Double_t point[3], dir[3];
+      memcpy(point, fPoint, kN3);
+      memcpy(dir, fDirection, kN3);
+      for (Int_t i = 0; i < ntracks; i++) {
+         PushPath();
+         memcpy(fPoint, &points[3 * i], kN3);
+         memcpy(fDirection, &dirs[3 * i], kN3);
+         FindNextBoundary(steps[i]);
+         steps[i] = fStep;
+         idaughters[i] = fNextDaughterIndex;
+         PopPath();
+      }
+      memcpy(fPoint, point, kN3);
+      memcpy(fDirection, dir, kN3);
+   } else {
+      std::vector<Double_t> lpoints(3 * ntracks);
+      std::vector<Double_t> ldirs(3 * ntracks);
+      std::vector<Double_t> dists(ntracks);
+      for (Int_t i = 0; i < ntracks; i++) {
+         fGlobalMatrix->MasterToLocal(&points[3 * i], &lpoints[3 * i]);
+         fGlobalMatrix->MasterToLocalVect(&dirs[3 * i], &ldirs[3 * i]);
+      }
+      // distances to exit the current volume
+      vol->GetShape()->DistFromInside_v(lpoints.data(), ldirs.data(), dists.data(), ntracks, steps);
+      // tracks which are on the boundary of the current volume do not need to check the daughters
+      std::unique_ptr<Bool_t[]> exiting(new Bool_t[ntracks]);
+      for (Int_t i = 0; i < ntracks; i++) {
+         idaughters[i] = -2;
+         if (dists[i] < steps[i] - gTolerance) {
+            steps[i] = dists[i];
+            idaughters[i] = -1;
+         }
+         exiting[i] = idaughters[i] == -1 && steps[i] < 1E-6;
+      }
+      Int_t nd = vol->GetNdaughters();
+      if (CheckAllDaughters(fGeometry, vol)) {
+         std::vector<Double_t> dpoints(3 * ntracks);
+         std::vector<Double_t> ddirs(3 * ntracks);
+         for (Int_t id = 0; id < nd; id++) {
+            TGeoNode *current = vol->GetNode(id);
+            for (Int_t i = 0; i < ntracks; i++) {
+               current->MasterToLocal(&lpoints[3 * i], &dpoints[3 * i]);
+               current->MasterToLocalVect(&ldirs[3 * i], &ddirs[3 * i]);
+            }
+            current->GetVolume()->GetShape()->DistFromOutside_v(dpoints.data(), ddirs.data(), dists.data(), ntracks,
+                                                                steps);
+            for (Int_t i = 0; i < ntracks; i++) {
+               if (!exiting[i] && dists[i] < steps[i] - gTolerance) {
+                  steps[i] = dists[i];
+                  idaughters[i] = id;
+               }
+            }
+         }
+      } else if (nd) {
+         for (Int_t i = 0; i < ntracks; i++) {
+            if (exiting[i])
+               continue;
+            fStep = steps[i];
+            Int_t idaughter = -1;
+            FindNextDaughterBoundary(&lpoints[3 * i], &ldirs[3 * i], idaughter);
+            if (idaughter >= 0) {
+               steps[i] = fStep;
+               idaughters[i] = idaughter;
+            }
+         }
+      }
+   }
+
+   fStep = step;
+   fSafety = safety;
+   fLastSafety = lastsafety;
+   memcpy(fLastPoint, lastpoint, kN3);
+   fNextNode = nextnode;
+   fForcedNode = forcednode;
+   fNextDaughterIndex = nextindex;
+   fIsStepEntering = stepentering;
+   fIsStepExiting = stepexiting;
+   fIsOnBoundary = onboundary;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Computes as fStep the distance to next daughter of the current volume.
 /// The point and direction must be converted in the coordinate system of the current volume.
@@ -1586,6 +1734,70 @@ TGeoNode *TGeoNavigator::FindNode(Double_t x, Double_t y, Double_t z)
    return found;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Locate a basket of points given in the master frame, as x, y, z triplets, and return in
+/// nodes[i] the deepest node containing point i, as FindNode(x, y, z) would. The points
+/// which are still inside the current volume and outside all its daughters, which is the
+/// common case for tracks propagated within the same volume, are classified at once with the
+/// vectorized TGeoShape::Contains_v() of the current volume and of the daughters. The other
+/// points are located one by one with FindNode(), starting from the current state.
+///
+/// The current path and point of the navigator are not changed.
+
+void TGeoNavigator::FindNode_v(Int_t ntracks, const Double_t *points, TGeoNode **nodes)
+{
+   if (ntracks <= 0)
+      return;
+   std::unique_ptr<Bool_t[]> located(new Bool_t[ntracks]);
+   for (Int_t i = 0; i < ntracks; i++)
+      located[i] = kFALSE;
+   TGeoVolume *vol = fCurrentNode->GetVolume();
+   if (!fIsOutside && !fNmany && !vol->IsAssembly() && CheckAllDaughters(fGeometry, vol)) {
+      std::vector<Double_t> lpoints(3 * ntracks);
+      std::vector<Double_t> dpoints(3 * ntracks);
+      std::unique_ptr<Bool_t[]> inside(new Bool_t[ntracks]);
+      for (Int_t i = 0; i < ntracks; i++)
+         fGlobalMatrix->MasterToLocal(&points[3 * i], &lpoints[3 * i]);
+      vol->GetShape()->Contains_v(lpoints.data(), located.get(), ntracks);
+      Int_t nd = vol->GetNdaughters();
+      for (Int_t id = 0; id < nd; id++) {
+         TGeoNode *current = vol->GetNode(id);
+         for (Int_t i = 0; i < ntracks; i++)
+            current->MasterToLocal(&lpoints[3 * i], &dpoints[3 * i]);
+         current->GetVolume()->GetShape()->Contains_v(dpoints.data(), inside.get(), ntracks);
+         for (Int_t i = 0; i < ntracks; i++)
+            located[i] = located[i] && !inside[i];
+      }
+   }
+
+   // Save what FindNode() changes
+   Double_t safety = fSafety;
+   Bool_t searchoverlaps = fSearchOverlaps;
+   Bool_t outside = fIsOutside;
+   Bool_t entering = fIsEntering;
+   Bool_t exiting = fIsExiting;
+   Bool_t onboundary = fIsOnBoundary;
+   Bool_t startsafe = fStartSafe;
+   Bool_t samelocation = fIsSameLocation;
+   for (Int_t i = 0; i < ntracks; i++) {
+      if (located[i]) {
+         nodes[i] = fCurrentNode;
+         continue;
+      }
+      PushPoint();
+      nodes[i] = FindNode(points[3 * i], points[3 * i + 1], points[3 * i + 2]);
+      PopPoint();
+   }
+   fSafety = safety;
+   fSearchOverlaps = searchoverlaps;
+   fIsOutside = outside;
+   fIsEntering = entering;
+   fIsExiting = exiting;
+   fIsOnBoundary = onboundary;
+   fStartSafe = startsafe;
+   fIsSameLocation = samelocation;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Computes fast normal to next crossed boundary, assuming that the current point
 /// is close enough to the boundary. Works only after calling FindNextBoundary.
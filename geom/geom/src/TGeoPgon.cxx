@@ -66,62 +66,35 @@ polygons, between `phi1` and `phi1+dphi.`
 #include "TBuffer3DTypes.h"
 #include "TMath.h"
 
-ClassImp(TGeoPgon);
-
-////////////////////////////////////////////////////////////////////////////////
-/// Constructor.
-
-TGeoPgon::ThreadData_t::ThreadData_t() : fIntBuffer(nullptr), fDblBuffer(nullptr) {}
-
-////////////////////////////////////////////////////////////////////////////////
-/// Destructor.
-
-TGeoPgon::ThreadData_t::~ThreadData_t()
-{
-   delete[] fIntBuffer;
-   delete[] fDblBuffer;
-}
-
-////////////////////////////////////////////////////////////////////////////////
-
-TGeoPgon::ThreadData_t &TGeoPgon::GetThreadData() const
-{
-   Int_t tid = TGeoManager::ThreadId();
-   return *fThreadData[tid];
-}
+#include <vector>
 
-////////////////////////////////////////////////////////////////////////////////
-
-void TGeoPgon::ClearThreadData() const
-{
-   std::lock_guard<std::mutex> guard(fMutex);
-   std::vector<ThreadData_t *>::iterator i = fThreadData.begin();
-   while (i != fThreadData.end()) {
-      delete *i;
-      ++i;
-   }
-   fThreadData.clear();
-   fThreadSize = 0;
-}
-
-////////////////////////////////////////////////////////////////////////////////
-/// Create thread data for n threads max.
+ClassImp(TGeoPgon);
 
-void TGeoPgon::CreateThreadData(Int_t nthreads)
-{
-   if (fThreadSize)
-      ClearThreadData();
-   std::lock_guard<std::mutex> guard(fMutex);
-   fThreadData.resize(nthreads);
-   fThreadSize = nthreads;
-   for (Int_t tid = 0; tid < nthreads; tid++) {
-      if (fThreadData[tid] == nullptr) {
-         fThreadData[tid] = new ThreadData_t;
-         fThreadData[tid]->fIntBuffer = new Int_t[fNedges + 10];
-         fThreadData[tid]->fDblBuffer = new Double_t[fNedges + 10];
+namespace {
+
+/// Scratch array for the phi sectors crossed by a ray, on the stack unless the polygon has many edges
+template <typename T>
+class RPhiCrossBuffer {
+   static constexpr Int_t kStackSize = 64;
+   T fStack[kStackSize];
+   std::vector<T> fHeap;
+   T *fData = fStack;
+
+public:
+   RPhiCrossBuffer(Int_t n)
+   {
+      if (n > kStackSize) {
+         fHeap.resize(n);
+         fData = fHeap.data();
       }
    }
-}
+   RPhiCrossBuffer(const RPhiCrossBuffer &) = delete;
+   RPhiCrossBuffer &operator=(const RPhiCrossBuffer &) = delete;
+
+   T *Get() { return fData; }
+};
+
+} // anonymous namespace
 
 ////////////////////////////////////////////////////////////////////////////////
 /// dummy ctor
@@ -130,7 +103,6 @@ TGeoPgon::TGeoPgon()
 {
    SetShapeBit(TGeoShape::kGeoPgon);
    fNedges = 0;
-   fThreadSize = 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -140,8 +112,6 @@ TGeoPgon::TGeoPgon(Double_t phi, Double_t dphi, Int_t nedges, Int_t nz) : TGeoPc
 {
    SetShapeBit(TGeoShape::kGeoPgon);
    fNedges = nedges;
-   fThreadSize = 0;
-   CreateThreadData(1);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -152,8 +122,6 @@ TGeoPgon::TGeoPgon(const char *name, Double_t phi, Double_t dphi, Int_t nedges,
 {
    SetShapeBit(TGeoShape::kGeoPgon);
    fNedges = nedges;
-   fThreadSize = 0;
-   CreateThreadData(1);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -172,17 +140,12 @@ TGeoPgon::TGeoPgon(Double_t *param) : TGeoPcon("")
    SetShapeBit(TGeoShape::kGeoPgon);
    SetDimensions(param);
    ComputeBBox();
-   fThreadSize = 0;
-   CreateThreadData(1);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// destructor
 
-TGeoPgon::~TGeoPgon()
-{
-   ClearThreadData();
-}
+TGeoPgon::~TGeoPgon() {}
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Computes capacity of the shape in [length^3]
@@ -467,11 +430,10 @@ TGeoPgon::DistFromInside(const Double_t *point, const Double_t *dir, Int_t iact,
       ipl++;
    }
    Double_t stepmax = step;
-   if (!fThreadSize)
-      ((TGeoPgon *)this)->CreateThreadData(1);
-   ThreadData_t &td = GetThreadData();
-   Double_t *sph = td.fDblBuffer;
-   Int_t *iph = td.fIntBuffer;
+   RPhiCrossBuffer<Double_t> sphbuf(fNedges + 10);
+   RPhiCrossBuffer<Int_t> iphbuf(fNedges + 10);
+   Double_t *sph = sphbuf.Get();
+   Int_t *iph = iphbuf.Get();
    // locate current phi sector [0,fNedges-1]; -1 for dead region
    LocatePhi(point, ipsec);
    if (ipsec < 0) {
@@ -1254,11 +1216,10 @@ TGeoPgon::DistFromOutside(const Double_t *point, const Double_t *dir, Int_t iact
          }
       }
    }
-   if (!fThreadSize)
-      ((TGeoPgon *)this)->CreateThreadData(1);
-   ThreadData_t &td = GetThreadData();
-   Double_t *sph = td.fDblBuffer;
-   Int_t *iph = td.fIntBuffer;
+   RPhiCrossBuffer<Double_t> sphbuf(fNedges + 10);
+   RPhiCrossBuffer<Int_t> iphbuf(fNedges + 10);
+   Double_t *sph = sphbuf.Get();
+   Int_t *iph = iphbuf.Get();
    Int_t icrossed;
    // locate current phi sector [0,fNedges-1]; -1 for dead region
    // if ray is perpendicular to Z, solve this particular case
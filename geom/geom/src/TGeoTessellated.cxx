@@ -14,8 +14,10 @@
 \ingroup Geometry_classes
 
 Tessellated solid class. It is composed by a set of planar faces having triangular or
-quadrilateral shape. The class does not provide navigation functionality, it just wraps the data
-for the composing faces.
+quadrilateral shape. Once the shape is closed, the navigation methods use a bounding volume
+hierarchy of the facet triangles, so that only the facets close to the point or to the ray
+are checked. The facets should make a closed body: Contains() checks the orientation of the
+closest facet crossed by a ray, so open or self-intersecting meshes give undefined results.
 */
 
 #include <iostream>
@@ -30,13 +32,199 @@ for the composing faces.
 #include "TBuffer3DTypes.h"
 #include "TMath.h"
 
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <limits>
+#include <tuple>
 #include <vector>
 
+// this is for the bvh acceleration stuff
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wall"
+#pragma GCC diagnostic ignored "-Wshadow"
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+
+// V2 BVH
+#include <bvh/v2/bvh.h>
+#include <bvh/v2/vec.h>
+#include <bvh/v2/ray.h>
+#include <bvh/v2/node.h>
+#include <bvh/v2/stack.h>
+#include <bvh/v2/default_builder.h>
+
+#pragma GCC diagnostic pop
+
 ClassImp(TGeoTessellated);
 
 using Vertex_t = Tessellated::Vertex_t;
 
+namespace {
+
+using BBox = bvh::v2::BBox<double, 3>;
+using Vec3 = bvh::v2::Vec<double, 3>;
+using Node = bvh::v2::Node<double, 3>;
+using Bvh = bvh::v2::Bvh<Node>;
+using Ray = bvh::v2::Ray<double, 3>;
+
+/// Triangle of a facet, with the data needed by the navigation queries
+struct Triangle_t {
+   Vertex_t fV0;     // first vertex
+   Vertex_t fE1;     // edge from the first to the second vertex
+   Vertex_t fE2;     // edge from the first to the third vertex
+   Vertex_t fNormal; // unit normal, pointing outwards
+};
+
+/// Bounding volume hierarchy of the facet triangles. The triangles are stored in the
+/// order of the BVH primitives, so that the ones of a leaf are contiguous in memory.
+struct TessellatedBVH_t {
+   Bvh fBVH;
+   std::vector<Triangle_t> fTriangles;
+};
+
+// Tolerance on the barycentric coordinates in the ray-triangle test, so that rays
+// hitting a common edge of two facets do not pass between them
+constexpr double kEdgeTolerance = 1E-12;
+
+// Direction of the rays cast by Contains(), not aligned with the edges of usual meshes
+constexpr double kContainsDir[3] = {0.3163185054919348, 0.5447246471073056, 0.7766708839123365};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Distance along the ray to the plane of the triangle if the ray crosses the
+/// triangle (Moller-Trumbore algorithm), -Big otherwise.
+
+double IntersectTriangle(const Triangle_t &tri, const Vertex_t &point, const Vertex_t &dir)
+{
+   const double kMiss = -TGeoShape::Big();
+   const Vertex_t pvec = Vertex_t::Cross(dir, tri.fE2);
+   const double det = Vertex_t::Dot(tri.fE1, pvec);
+   if (det == 0.)
+      return kMiss;
+   const double invdet = 1. / det;
+   const Vertex_t tvec = point - tri.fV0;
+   const double u = Vertex_t::Dot(tvec, pvec) * invdet;
+   if (u < -kEdgeTolerance || u > 1. + kEdgeTolerance)
+      return kMiss;
+   const Vertex_t qvec = Vertex_t::Cross(tvec, tri.fE1);
+   const double v = Vertex_t::Dot(dir, qvec) * invdet;
+   if (v < -kEdgeTolerance || u + v > 1. + kEdgeTolerance)
+      return kMiss;
+   return Vertex_t::Dot(tri.fE2, qvec) * invdet;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Squared distance from a point to a triangle, computed from the closest point
+/// of the triangle (C. Ericson, Real-Time Collision Detection, 5.1.5).
+
+double SafetySqToTriangle(const Triangle_t &tri, const Vertex_t &point)
+{
+   const Vertex_t &ab = tri.fE1;
+   const Vertex_t &ac = tri.fE2;
+   const Vertex_t ap = point - tri.fV0;
+   const double d1 = Vertex_t::Dot(ab, ap);
+   const double d2 = Vertex_t::Dot(ac, ap);
+   if (d1 <= 0. && d2 <= 0.)
+      return ap.Mag2();
+   const Vertex_t bp = ap - ab;
+   const double d3 = Vertex_t::Dot(ab, bp);
+   const double d4 = Vertex_t::Dot(ac, bp);
+   if (d3 >= 0. && d4 <= d3)
+      return bp.Mag2();
+   const double vc = d1 * d4 - d3 * d2;
+   if (vc <= 0. && d1 >= 0. && d3 <= 0.)
+      return (ap - (d1 / (d1 - d3)) * ab).Mag2();
+   const Vertex_t cp = ap - ac;
+   const double d5 = Vertex_t::Dot(ab, cp);
+   const double d6 = Vertex_t::Dot(ac, cp);
+   if (d6 >= 0. && d5 <= d6)
+      return cp.Mag2();
+   const double vb = d5 * d2 - d1 * d6;
+   if (vb <= 0. && d2 >= 0. && d6 <= 0.)
+      return (ap - (d2 / (d2 - d6)) * ac).Mag2();
+   const double va = d3 * d6 - d5 * d4;
+   if (va <= 0. && d4 >= d3 && d5 >= d6)
+      return (bp - ((d4 - d3) / ((d4 - d3) + (d5 - d6))) * (ac - ab)).Mag2();
+   const double denom = 1. / (va + vb + vc);
+   return (ap - (vb * denom) * ab - (vc * denom) * ac).Mag2();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Squared distance from a point to a box, zero if the point is inside.
+
+double SafetySqToBox(const BBox &box, const Vertex_t &point)
+{
+   double safe2 = 0.;
+   for (int i = 0; i < 3; ++i) {
+      const double d = std::max(std::max(box.min[i] - point[i], point[i] - box.max[i]), 0.);
+      safe2 += d * d;
+   }
+   return safe2;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Distance to the closest triangle crossed by a ray within stepmax. Only the triangles
+/// exited by the ray (sign > 0), entered by the ray (sign < 0) or all of them (sign = 0)
+/// are considered. The index of the triangle is returned in itri, -1 if there is none.
+
+double DistToTriangles(const TessellatedBVH_t &nav, const double *point, const double *dir, double stepmax, int sign,
+                       int &itri)
+{
+   const Vertex_t p(point[0], point[1], point[2]);
+   const Vertex_t d(dir[0], dir[1], dir[2]);
+   Ray ray(Vec3(point[0], point[1], point[2]), Vec3(dir[0], dir[1], dir[2]), -TGeoShape::Tolerance(), stepmax);
+   bvh::v2::GrowingStack<Bvh::Index> stack;
+   double dist = TGeoShape::Big();
+   itri = -1;
+   // the leaves are visited front to back; shrinking the ray prunes the farther ones
+   nav.fBVH.intersect<false, true>(ray, nav.fBVH.get_root().index, stack, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+         const Triangle_t &tri = nav.fTriangles[i];
+         const double dn = Vertex_t::Dot(d, tri.fNormal);
+         if ((sign > 0 && dn <= 0.) || (sign < 0 && dn >= 0.))
+            continue;
+         const double t = IntersectTriangle(tri, p, d);
+         if (t < ray.tmin || t > ray.tmax)
+            continue;
+         ray.tmax = t;
+         dist = std::max(t, 0.);
+         itri = i;
+      }
+      return false;
+   });
+   return dist;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Distance from a point to the closest triangle, whose index is returned in itri.
+
+double SafetyToTriangles(const TessellatedBVH_t &nav, const double *point, int &itri)
+{
+   const Vertex_t p(point[0], point[1], point[2]);
+   bvh::v2::GrowingStack<Bvh::Index> stack;
+   double safe2 = std::numeric_limits<double>::max();
+   itri = -1;
+   auto leaf_fn = [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+         const double d2 = SafetySqToTriangle(nav.fTriangles[i], p);
+         if (d2 < safe2) {
+            safe2 = d2;
+            itri = i;
+         }
+      }
+      return false;
+   };
+   // visit first the closest child, skipping the boxes farther than the best triangle so far
+   auto inner_fn = [&](const Node &left, const Node &right) {
+      const double dleft = SafetySqToBox(left.get_bbox(), p);
+      const double dright = SafetySqToBox(right.get_bbox(), p);
+      return std::make_tuple(dleft < safe2, dright < safe2, dleft > dright);
+   };
+   nav.fBVH.traverse_top_down<false>(nav.fBVH.get_root().index, stack, leaf_fn, inner_fn);
+   return std::sqrt(safe2);
+}
+
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Compact consecutive equal vertices
 
@@ -110,6 +298,14 @@ TGeoTessellated::TGeoTessellated(const char *name, const std::vector<Vertex_t> &
    fNvert = fVertices.size();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Destructor.
+
+TGeoTessellated::~TGeoTessellated()
+{
+   DeleteBVH();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Add a vertex checking for duplicates, returning the vertex index
 
@@ -328,16 +524,14 @@ void TGeoTessellated::CloseShape(bool check, bool fixFlipped, bool verbose)
    // Cleanup the vertex map
    std::multimap<long, int>().swap(fVerticesMap);
 
-   if (fVertices.size() > 0) {
-      if (!check)
-         return;
-
+   if (fVertices.size() > 0 && check) {
       // Check facets
       for (auto i = 0; i < fNfacets; ++i)
          FacetCheck(i);
 
       fClosedBody = CheckClosure(fixFlipped, verbose);
    }
+   BuildBVH();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -429,6 +623,191 @@ void TGeoTessellated::ComputeBBox()
       fOrigin[i] = 0.5 * (vmax[i] + vmin[i]);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Build the bounding volume hierarchy of the facet triangles, used by the navigation
+/// methods. The quadrilateral facets are split in two triangles. The normals are oriented
+/// outwards from the sign of the enclosed volume, so that the navigation does not depend
+/// on the facets being defined clockwise or anticlockwise.
+
+void TGeoTessellated::BuildBVH()
+{
+   DeleteBVH();
+   std::vector<Triangle_t> triangles;
+   triangles.reserve(2 * fFacets.size());
+   double volume = 0.;
+   for (const auto &facet : fFacets) {
+      for (int i = 1; i < facet.GetNvert() - 1; ++i) {
+         Triangle_t tri;
+         tri.fV0 = fVertices[facet[0]];
+         tri.fE1 = fVertices[facet[i]] - tri.fV0;
+         tri.fE2 = fVertices[facet[i + 1]] - tri.fV0;
+         tri.fNormal = Vertex_t::Cross(tri.fE1, tri.fE2);
+         if (tri.fNormal.Mag2() == 0.)
+            continue; // degenerated triangle
+         volume += Vertex_t::Dot(tri.fV0, tri.fNormal);
+         tri.fNormal.Normalize();
+         triangles.push_back(tri);
+      }
+   }
+   if (triangles.empty())
+      return;
+   if (volume < 0.) {
+      for (auto &tri : triangles)
+         tri.fNormal *= -1.;
+   }
+
+   // the boxes are padded so that the ones of facets parallel to the axes are not flat
+   const double pad = TGeoShape::Tolerance();
+   std::vector<BBox> bboxes;
+   std::vector<Vec3> centers;
+   bboxes.reserve(triangles.size());
+   centers.reserve(triangles.size());
+   for (const auto &tri : triangles) {
+      const Vertex_t v1 = tri.fV0 + tri.fE1;
+      const Vertex_t v2 = tri.fV0 + tri.fE2;
+      BBox box = BBox::make_empty();
+      for (const auto *v : {&tri.fV0, &v1, &v2}) {
+         box.extend(Vec3((*v)[0] - pad, (*v)[1] - pad, (*v)[2] - pad));
+         box.extend(Vec3((*v)[0] + pad, (*v)[1] + pad, (*v)[2] + pad));
+      }
+      bboxes.push_back(box);
+      centers.push_back(box.get_center());
+   }
+
+   typename bvh::v2::DefaultBuilder<Node>::Config config;
+   config.quality = bvh::v2::DefaultBuilder<Node>::Quality::High;
+   auto nav = new TessellatedBVH_t;
+   nav->fBVH = bvh::v2::DefaultBuilder<Node>::build(bboxes, centers, config);
+   nav->fTriangles.reserve(triangles.size());
+   for (auto id : nav->fBVH.prim_ids)
+      nav->fTriangles.push_back(triangles[id]);
+   fBVH = nav;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Delete the bounding volume hierarchy of the facet triangles.
+
+void TGeoTessellated::DeleteBVH()
+{
+   delete static_cast<TessellatedBVH_t *>(fBVH);
+   fBVH = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get the bounding volume hierarchy of the facet triangles, building it if needed.
+/// Returns nullptr if the shape has no facets.
+
+const void *TGeoTessellated::GetBVH() const
+{
+   if (!fBVH && !fFacets.empty())
+      const_cast<TGeoTessellated *>(this)->BuildBVH();
+   return fBVH;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the navigation structures after the shape was read from a file.
+
+void TGeoTessellated::AfterStreamer()
+{
+   BuildBVH();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the normal to the closest facet, oriented along dir.
+
+void TGeoTessellated::ComputeNormal(const Double_t *point, const Double_t *dir, Double_t *norm)
+{
+   auto nav = static_cast<const TessellatedBVH_t *>(GetBVH());
+   if (!nav) {
+      TGeoBBox::ComputeNormal(point, dir, norm);
+      return;
+   }
+   int itri;
+   SafetyToTriangles(*nav, point, itri);
+   const Vertex_t &normal = nav->fTriangles[itri].fNormal;
+   const double sign = (normal[0] * dir[0] + normal[1] * dir[1] + normal[2] * dir[2] < 0.) ? -1. : 1.;
+   for (int i = 0; i < 3; ++i)
+      norm[i] = sign * normal[i];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Test if point is inside the shape, by casting a ray and checking whether
+/// the closest facet crossed is exited. Points on the surface are inside.
+
+Bool_t TGeoTessellated::Contains(const Double_t *point) const
+{
+   if (!TGeoBBox::Contains(point))
+      return kFALSE;
+   auto nav = static_cast<const TessellatedBVH_t *>(GetBVH());
+   if (!nav)
+      return kFALSE;
+   int itri;
+   const double dist = DistToTriangles(*nav, point, kContainsDir, TGeoShape::Big(), 0, itri);
+   if (itri < 0)
+      return kFALSE;
+   if (dist < TGeoShape::Tolerance())
+      return kTRUE;
+   const Vertex_t &normal = nav->fTriangles[itri].fNormal;
+   return (normal[0] * kContainsDir[0] + normal[1] * kContainsDir[1] + normal[2] * kContainsDir[2] > 0.);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute distance from inside point to the closest facet exited along dir.
+
+Double_t TGeoTessellated::DistFromInside(const Double_t *point, const Double_t *dir, Int_t iact, Double_t step,
+                                         Double_t *safe) const
+{
+   if (iact < 3 && safe) {
+      *safe = Safety(point, kTRUE);
+      if (iact == 0)
+         return TGeoShape::Big();
+      if (iact == 1 && step < *safe)
+         return TGeoShape::Big();
+   }
+   auto nav = static_cast<const TessellatedBVH_t *>(GetBVH());
+   if (!nav)
+      return TGeoBBox::DistFromInside(point, dir, fDX, fDY, fDZ, fOrigin, step);
+   int itri;
+   const double dist = DistToTriangles(*nav, point, dir, TGeoShape::Big(), 1, itri);
+   return (itri < 0) ? 0. : dist;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute distance from outside point to the closest facet entered along dir.
+
+Double_t TGeoTessellated::DistFromOutside(const Double_t *point, const Double_t *dir, Int_t iact, Double_t step,
+                                          Double_t *safe) const
+{
+   if (iact < 3 && safe) {
+      *safe = Safety(point, kFALSE);
+      if (iact == 0)
+         return TGeoShape::Big();
+      if (iact == 1 && step < *safe)
+         return TGeoShape::Big();
+   }
+   // check the bounding box first
+   if (TGeoBBox::DistFromOutside(point, dir, fDX, fDY, fDZ, fOrigin, step) >= step)
+      return TGeoShape::Big();
+   auto nav = static_cast<const TessellatedBVH_t *>(GetBVH());
+   if (!nav)
+      return TGeoShape::Big();
+   int itri;
+   const double dist = DistToTriangles(*nav, point, dir, step, -1, itri);
+   return (itri < 0) ? TGeoShape::Big() : dist;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Computes the closest distance from given point to the facets.
+
+Double_t TGeoTessellated::Safety(const Double_t *point, Bool_t in) const
+{
+   auto nav = static_cast<const TessellatedBVH_t *>(GetBVH());
+   if (!nav)
+      return TGeoBBox::Safety(point, in);
+   int itri;
+   return SafetyToTriangles(*nav, point, itri);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns numbers of vertices, segments and polygons composing the shape mesh.
 
@@ -540,6 +919,7 @@ void TGeoTessellated::ResizeCenter(double maxsize)
    fDX *= scale;
    fDY *= scale;
    fDZ *= scale;
+   BuildBVH();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
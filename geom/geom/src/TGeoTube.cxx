@@ -1235,8 +1235,15 @@ const TBuffer3D &TGeoTube::GetBuffer3D(Int_t reqSections, Bool_t localFrame) con
 
 void TGeoTube::Contains_v(const Double_t *points, Bool_t *inside, Int_t vecsize) const
 {
-   for (Int_t i = 0; i < vecsize; i++)
-      inside[i] = Contains(&points[3 * i]);
+   // Same as Contains(), without branches so that the loop can be vectorized
+   const Double_t dz = fDz;
+   const Double_t rmin2 = fRmin * fRmin;
+   const Double_t rmax2 = fRmax * fRmax;
+   for (Int_t i = 0; i < vecsize; i++) {
+      const Double_t *point = &points[3 * i];
+      const Double_t r2 = point[0] * point[0] + point[1] * point[1];
+      inside[i] = !(TMath::Abs(point[2]) > dz) & !(r2 < rmin2) & !(r2 > rmax2);
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1254,10 +1261,45 @@ void TGeoTube::ComputeNormal_v(const Double_t *points, const Double_t *dirs, Dou
 /// Compute distance from array of input points having directions specified by dirs. Store output in dists
 
 void TGeoTube::DistFromInside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize,
-                                Double_t *step) const
-{
-   for (Int_t i = 0; i < vecsize; i++)
-      dists[i] = DistFromInside(&points[3 * i], &dirs[3 * i], 3, step[i]);
+                                Double_t * /*step*/) const
+{
+   // Same as DistFromInsideS(), computing all the candidate distances and selecting the
+   // result without branches so that the loop can be vectorized
+   const Double_t tol = TGeoShape::Tolerance();
+   const Bool_t hasrmin = fRmin > 0;
+   const Double_t rmin2 = fRmin * fRmin;
+   const Double_t rmax2 = fRmax * fRmax;
+   const Double_t dz = fDz;
+   for (Int_t i = 0; i < vecsize; i++) {
+      const Double_t *point = &points[3 * i];
+      const Double_t *dir = &dirs[3 * i];
+      // Z
+      const Bool_t crossz = dir[2] != 0;
+      Double_t sz = (TMath::Sign(dz, dir[2]) - point[2]) / dir[2];
+      sz = crossz ? sz : TGeoShape::Big();
+      // R
+      const Double_t nsq = dir[0] * dir[0] + dir[1] * dir[1];
+      const Double_t rsq = point[0] * point[0] + point[1] * point[1];
+      const Double_t rdotn = point[0] * dir[0] + point[1] * dir[1];
+      const Double_t t1 = 1. / nsq;
+      const Double_t b = t1 * rdotn;
+      // outer cylinder
+      const Double_t deltamax = b * b - t1 * (rsq - rmax2);
+      const Double_t srmax = -b + TMath::Sqrt(TMath::Max(deltamax, 0.));
+      Double_t dist = ((deltamax > 0) & (srmax > 0)) ? TMath::Min(sz, srmax) : 0.;
+      dist = ((rsq >= rmax2 - tol) & (rdotn >= 0)) ? 0. : dist;
+      // inner cylinder
+      if (hasrmin) {
+         const Double_t deltamin = b * b - t1 * (rsq - rmin2);
+         const Double_t srmin = -b - TMath::Sqrt(TMath::Max(deltamin, 0.));
+         const Bool_t onrmin = rsq <= rmin2 + tol;
+         const Bool_t hitrmin = !onrmin & (rdotn < 0) & (deltamin > 0) & (srmin > 0);
+         dist = hitrmin ? TMath::Min(sz, srmin) : dist;
+         dist = (onrmin & (rdotn < 0)) ? 0. : dist;
+      }
+      dist = (TMath::Abs(nsq) < tol) ? sz : dist;
+      dists[i] = (crossz & (sz <= 0)) ? 0. : dist;
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
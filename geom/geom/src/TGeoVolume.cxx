@@ -400,6 +400,7 @@ volumes (or volume assemblies) as content.
 #include "TGeoScaledShape.h"
 #include "TGeoCompositeShape.h"
 #include "TGeoVoxelFinder.h"
+#include "TGeoBVHVoxelFinder.h"
 #include "TGeoExtension.h"
 
 ClassImp(TGeoVolume);
@@ -1860,7 +1861,10 @@ TGeoVolume *TGeoVolume::CloneVolume() const
    // copy voxels
    TGeoVoxelFinder *voxels = nullptr;
    if (fVoxels) {
-      voxels = new TGeoVoxelFinder(vol);
+      if (fVoxels->InheritsFrom(TGeoBVHVoxelFinder::Class()))
+         voxels = new TGeoBVHVoxelFinder(vol);
+      else
+         voxels = new TGeoVoxelFinder(vol);
       vol->SetVoxelFinder(voxels);
    }
    // copy option, uid
@@ -2483,8 +2487,12 @@ void TGeoVolume::Voxelize(Option_t *option)
          delete fVoxels;
       fVoxels = nullptr;
    }
-   // Create the voxels structure
-   fVoxels = new TGeoVoxelFinder(this);
+   // Create the voxels structure, using a BVH for volumes with many daughters
+   Int_t bvhthreshold = fGeoManager ? fGeoManager->GetBVHVoxelThreshold() : 0;
+   if (bvhthreshold > 0 && nd >= bvhthreshold)
+      fVoxels = new TGeoBVHVoxelFinder(this);
+   else
+      fVoxels = new TGeoVoxelFinder(this);
    fVoxels->Voxelize(option);
    if (fVoxels) {
       if (fVoxels->IsInvalid()) {
@@ -3022,7 +3030,10 @@ TGeoVolume *TGeoVolumeAssembly::CloneVolume() const
    // copy voxels
    TGeoVoxelFinder *voxels = nullptr;
    if (fVoxels) {
-      voxels = new TGeoVoxelFinder(vol);
+      if (fVoxels->InheritsFrom(TGeoBVHVoxelFinder::Class()))
+         voxels = new TGeoBVHVoxelFinder(vol);
+      else
+         voxels = new TGeoVoxelFinder(vol);
       vol->SetVoxelFinder(voxels);
    }
    // copy option, uid
@@ -3114,7 +3125,10 @@ TGeoVolumeAssembly *TGeoVolumeAssembly::MakeAssemblyFromVolume(TGeoVolume *volor
    // copy voxels
    TGeoVoxelFinder *voxels = nullptr;
    if (volorig->GetVoxels()) {
-      voxels = new TGeoVoxelFinder(vol);
+      if (volorig->GetVoxels()->InheritsFrom(TGeoBVHVoxelFinder::Class()))
+         voxels = new TGeoBVHVoxelFinder(vol);
+      else
+         voxels = new TGeoVoxelFinder(vol);
       vol->SetVoxelFinder(voxels);
    }
    // copy option, uid
@@ -9,6 +9,7 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <algorithm>
 #include <cstring>
 #include <cstdlib>
 #include <iostream>
@@ -50,6 +51,12 @@
 
 #include "TVirtualMutex.h"
 
+#ifndef R__WIN32
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 class TCanvasInit {
 public:
    TCanvasInit() { TApplication::NeedGraphicsLibs(); }
@@ -2653,6 +2660,11 @@ void TCanvas::DeleteCanvasPainter()
 /// In last case PDF or ROOT file will contain all pads.
 /// Parameter option only used when output into PDF/PS files
 /// If TCanvas::SaveAll() called without arguments - all existing canvases will be stored in allcanvases.pdf file.
+///
+/// When storing separate image files in batch mode, option "jobs=N" distributes the images between N forked
+/// processes, which produce them in parallel - like `TCanvas::SaveAll(pads, "plot%04d.png", "jobs=8")`.
+/// Each process works with its own copy of gPad, gStyle and the graphics engine, so the images are
+/// the same as when produced one by one. Not available on Windows and for web canvases.
 
 Bool_t TCanvas::SaveAll(const std::vector<TPad *> &pads, const char *filename, Option_t *option)
 {
@@ -2758,7 +2770,7 @@ Bool_t TCanvas::SaveAll(const std::vector<TPad *> &pads, const char *filename, O
       return !isError;
    }
 
-   for (unsigned n = 0; n < pads.size(); ++n) {
+   auto saveImage = [&](unsigned n) {
       TString fn = TString::Format(fname.Data(), (int) n);
       gSystem->ExpandPathName(fn);
       if (fn.IsNull()) {
@@ -2767,7 +2779,49 @@ Bool_t TCanvas::SaveAll(const std::vector<TPad *> &pads, const char *filename, O
       }
 
       pads[n]->SaveAs(fn.Data());
+   };
+
+   unsigned njobs = 1;
+   TString opt = option;
+   opt.ToLower();
+   if (auto pos = opt.Index("jobs="); pos != kNPOS)
+      njobs = std::max(1, TString(opt(pos + 5, opt.Length())).Atoi());
+   njobs = std::min<unsigned>(njobs, pads.size());
+
+#ifndef R__WIN32
+   if ((njobs > 1) && gROOT->IsBatch()) {
+      // every process produces each njobs-th image, the processes which cannot be forked are done here
+      std::vector<pid_t> children;
+      for (unsigned job = 0; job < njobs; ++job) {
+         pid_t pid = (job + 1 < njobs) ? fork() : -1;
+         if (pid == 0) {
+            for (unsigned n = job; n < pads.size(); n += njobs)
+               saveImage(n);
+            fflush(nullptr);
+            _exit(0);
+         }
+         if (pid > 0) {
+            children.emplace_back(pid);
+         } else {
+            for (unsigned n = job; n < pads.size(); n += njobs)
+               saveImage(n);
+         }
+      }
+
+      Bool_t isOk = kTRUE;
+      for (auto pid : children) {
+         int status = 0;
+         if ((waitpid(pid, &status, 0) != pid) || !WIFEXITED(status) || WEXITSTATUS(status))
+            isOk = kFALSE;
+      }
+      if (!isOk)
+         ::Error("TCanvas::SaveAll", "Failure of a job producing images %s", fname.Data());
+      return isOk;
    }
+#endif
+
+   for (unsigned n = 0; n < pads.size(); ++n)
+      saveImage(n);
 
    return kTRUE;
 
@@ -94,6 +94,18 @@ const Int_t kObjFirstPage        = 51; // First page object
 // Number of fonts
 const Int_t kNumberOfFonts = 15;
 
+////////////////////////////////////////////////////////////////////////////////
+/// Format a real number as written in the PDF file, return the number of characters
+
+static Int_t FormatReal(char *str, Float_t z, Bool_t space)
+{
+   const Int_t size = 15;
+   Int_t len = snprintf(str, size, space ? " %g" : "%g", z);
+   if (strchr(str, 'e') || strchr(str, 'E'))
+      len = snprintf(str, size, space ? " %10.8f" : "%10.8f", z);
+   return TMath::Min(len, size - 1);
+}
+
 Int_t  TPDF::fgLineJoin = 0;
 Int_t  TPDF::fgLineCap  = 0;
 Bool_t TPDF::fgObjectIsOpen = kFALSE;
@@ -1418,9 +1430,13 @@ void TPDF::FontEncode()
 
 void TPDF::LineTo(Double_t x, Double_t y)
 {
-   WriteReal(x);
-   WriteReal(y);
-   PrintFast(2," l");
+   // formatted in one go, LineTo is called for every point of polylines and markers
+   char str[32];
+   Int_t len = FormatReal(str, x, kTRUE);
+   len += FormatReal(str + len, y, kTRUE);
+   str[len++] = ' ';
+   str[len++] = 'l';
+   PrintFast(len, str);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1428,9 +1444,12 @@ void TPDF::LineTo(Double_t x, Double_t y)
 
 void TPDF::MoveTo(Double_t x, Double_t y)
 {
-   WriteReal(x);
-   WriteReal(y);
-   PrintFast(2," m");
+   char str[32];
+   Int_t len = FormatReal(str, x, kTRUE);
+   len += FormatReal(str + len, y, kTRUE);
+   str[len++] = ' ';
+   str[len++] = 'm';
+   PrintFast(len, str);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2457,15 +2476,9 @@ void TPDF::WriteCompressedBuffer()
 
 void TPDF::WriteReal(Float_t z, Bool_t space)
 {
+   // numbers never contain the '@' line break of PrintStr, so they go directly to PrintFast
    char str[15];
-   if (space) {
-      snprintf(str,15," %g", z);
-      if (strstr(str,"e") || strstr(str,"E")) snprintf(str,15," %10.8f", z);
-   } else {
-      snprintf(str,15,"%g", z);
-      if (strstr(str,"e") || strstr(str,"E")) snprintf(str,15,"%10.8f", z);
-   }
-   PrintStr(str);
+   PrintFast(FormatReal(str, z, space), str);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -50,6 +50,16 @@ private:
    const TPolyMarker3D    *fPolymarker; //Polymarker from TTree.
    std::vector<Double_t>   fPMPoints;   //Cache for polymarker's points.
 
+   struct BinBox_t {
+      Double_t fXMin, fXMax, fYMin, fYMax, fZMin, fZMax;
+      Int_t    fK;        //Z bin index, counted from the first visible bin.
+      Bool_t   fNegative; //Bin content is negative.
+   };
+
+   std::vector<BinBox_t>   fBoxes;      //Cache of boxes of the drawn bins, ordered by x, y, z bin.
+   std::vector<UInt_t>     fBoxColumns; //Index in fBoxes of the first box of every (x, y) column.
+   std::vector<Double_t>   fBoxesKey;   //Histogram content and ranges fBoxes were built for.
+
    TGLBoxPainter(const TGLBoxPainter &);
    TGLBoxPainter &operator = (const TGLBoxPainter &);
 
@@ -86,6 +96,9 @@ private:
 
    Bool_t  HasSections()const;
 
+   std::vector<Double_t> GetBoxesKey()const;
+   void    UpdateBoxes();
+
    ClassDefOverride(TGLBoxPainter, 0)//Box painter
 };
 
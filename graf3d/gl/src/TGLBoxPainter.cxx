@@ -104,16 +104,24 @@ Bool_t TGLBoxPainter::InitGeometry()
    fBackBox.SetPlotBox(fCoord->GetXRangeScaled(), fCoord->GetYRangeScaled(), fCoord->GetZRangeScaled());
    if(fCamera) fCamera->SetViewVolume(fBackBox.Get3DBox());
 
-   fMinMaxVal.second  = fHist->GetBinContent(fCoord->GetFirstXBin(), fCoord->GetFirstYBin(), fCoord->GetFirstZBin());
-   fMinMaxVal.first = fMinMaxVal.second;
-   //Bad. You can up-date some bin value and get wrong picture.
-   for (Int_t ir = fCoord->GetFirstXBin(); ir <= fCoord->GetLastXBin(); ++ir) {
-      for (Int_t jr = fCoord->GetFirstYBin(); jr <= fCoord->GetLastYBin(); ++jr) {
-         for (Int_t kr = fCoord->GetFirstZBin();  kr <= fCoord->GetLastZBin(); ++kr) {
-            fMinMaxVal.second = TMath::Max(fMinMaxVal.second, fHist->GetBinContent(ir, jr, kr));
-            fMinMaxVal.first = TMath::Min(fMinMaxVal.first, fHist->GetBinContent(ir, jr, kr));
+   //InitGeometry is called for every redraw (rotation, zoom), bins are scanned
+   //only if the histogram content or ranges changed.
+   std::vector<Double_t> key = GetBoxesKey();
+   if (key != fBoxesKey) {
+      fMinMaxVal.second  = fHist->GetBinContent(fCoord->GetFirstXBin(), fCoord->GetFirstYBin(), fCoord->GetFirstZBin());
+      fMinMaxVal.first = fMinMaxVal.second;
+      for (Int_t ir = fCoord->GetFirstXBin(); ir <= fCoord->GetLastXBin(); ++ir) {
+         for (Int_t jr = fCoord->GetFirstYBin(); jr <= fCoord->GetLastYBin(); ++jr) {
+            for (Int_t kr = fCoord->GetFirstZBin();  kr <= fCoord->GetLastZBin(); ++kr) {
+               fMinMaxVal.second = TMath::Max(fMinMaxVal.second, fHist->GetBinContent(ir, jr, kr));
+               fMinMaxVal.first = TMath::Min(fMinMaxVal.first, fHist->GetBinContent(ir, jr, kr));
+            }
          }
       }
+
+      if (!fPolymarker)
+         UpdateBoxes();
+      fBoxesKey.swap(key);
    }
 
    fXOYSlice.SetMinMax(fMinMaxVal);
@@ -354,6 +362,76 @@ namespace {
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+///State of the histogram the boxes depend on: bin ranges, scales, minimum and
+///maximum, number of entries and statistics (which change with the bin contents).
+
+std::vector<Double_t> TGLBoxPainter::GetBoxesKey()const
+{
+   Double_t stats[TH1::kNstat] = {};
+   fHist->GetStats(stats);
+
+   std::vector<Double_t> key{Double_t(fCoord->GetFirstXBin()), Double_t(fCoord->GetLastXBin()),
+                             Double_t(fCoord->GetFirstYBin()), Double_t(fCoord->GetLastYBin()),
+                             Double_t(fCoord->GetFirstZBin()), Double_t(fCoord->GetLastZBin()),
+                             fCoord->GetXScale(), fCoord->GetYScale(), fCoord->GetZScale(),
+                             fHist->GetMinimumStored(), fHist->GetMaximumStored(), fHist->GetEntries()};
+   key.insert(key.end(), stats, stats + TH1::kNstat);
+
+   return key;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+///Compute the boxes of the bins, sizes are proportional to the cubic root of the
+///bin content. Done once for every content change instead of every redraw.
+
+void TGLBoxPainter::UpdateBoxes()
+{
+   const Int_t nX = fCoord->GetNXBins();
+   const Int_t nY = fCoord->GetNYBins();
+   const Int_t nZ = fCoord->GetNZBins();
+   const Double_t xScale = fCoord->GetXScale();
+   const Double_t yScale = fCoord->GetYScale();
+   const Double_t zScale = fCoord->GetZScale();
+   const TAxis   *xA = fXAxis;
+   const TAxis   *yA = fYAxis;
+   const TAxis   *zA = fZAxis;
+
+   const Double_t wmin = TMath::Max(fHist->GetMinimum(),0.);
+   const Double_t wmax = TMath::Max(TMath::Abs(fHist->GetMaximum()),
+                                    TMath::Abs(fHist->GetMinimum()));
+
+   fBoxes.clear();
+   fBoxColumns.assign(1, 0);
+   fBoxColumns.reserve(nX * nY + 1);
+
+   for (Int_t i = 0, ir = fCoord->GetFirstXBin(); i < nX; ++i, ++ir) {
+      for (Int_t j = 0, jr = fCoord->GetFirstYBin(); j < nY; ++j, ++jr) {
+         for (Int_t k = 0, kr = fCoord->GetFirstZBin(); k < nZ; ++k, ++kr) {
+            Double_t binContent = fHist->GetBinContent(ir, jr, kr);
+            if (binContent < wmin) continue;
+            if (binContent > wmax) binContent = wmax;
+
+            const Double_t w = TMath::Power(TMath::Abs(binContent-wmin) / (wmax-wmin),1./3.);
+            if (!w)
+               continue;
+
+            BinBox_t box;
+            box.fXMin = xScale * (xA->GetBinLowEdge(ir) / 2 + xA->GetBinUpEdge(ir) / 2 - w * xA->GetBinWidth(ir) / 2);
+            box.fXMax = xScale * (xA->GetBinLowEdge(ir) / 2 + xA->GetBinUpEdge(ir) / 2 + w * xA->GetBinWidth(ir) / 2);
+            box.fYMin = yScale * (yA->GetBinLowEdge(jr) / 2 + yA->GetBinUpEdge(jr) / 2 - w * yA->GetBinWidth(jr) / 2);
+            box.fYMax = yScale * (yA->GetBinLowEdge(jr) / 2 + yA->GetBinUpEdge(jr) / 2 + w * yA->GetBinWidth(jr) / 2);
+            box.fZMin = zScale * (zA->GetBinLowEdge(kr) / 2 + zA->GetBinUpEdge(kr) / 2 - w * zA->GetBinWidth(kr) / 2);
+            box.fZMax = zScale * (zA->GetBinLowEdge(kr) / 2 + zA->GetBinUpEdge(kr) / 2 + w * zA->GetBinWidth(kr) / 2);
+            box.fK = k;
+            box.fNegative = binContent < 0.;
+            fBoxes.push_back(box);
+         }
+         fBoxColumns.push_back(fBoxes.size());
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 void TGLBoxPainter::DrawPlot()const
@@ -385,58 +463,39 @@ void TGLBoxPainter::DrawPlot()const
    //Using front point, find the correct order to draw boxes from
    //back to front/from bottom to top (it's important only for semi-transparent boxes).
    const Int_t frontPoint = fBackBox.GetFrontPoint();
-   Int_t irInit = fCoord->GetFirstXBin(), iInit = 0;
+   Int_t iInit = 0;
    const Int_t nX = fCoord->GetNXBins();
-   Int_t jrInit = fCoord->GetFirstYBin(), jInit = 0;
+   Int_t jInit = 0;
    const Int_t nY = fCoord->GetNYBins();
-   Int_t krInit = fCoord->GetFirstZBin(), kInit = 0;
-   const Int_t nZ = fCoord->GetNZBins();
 
-   const Int_t addI = frontPoint == 2 || frontPoint == 1 ? 1 : (iInit = nX - 1, irInit = fCoord->GetLastXBin(), -1);
-   const Int_t addJ = frontPoint == 2 || frontPoint == 3 ? 1 : (jInit = nY - 1, jrInit = fCoord->GetLastYBin(), -1);
-   const Int_t addK = fBackBox.Get2DBox()[frontPoint + 4].Y() < fBackBox.Get2DBox()[frontPoint].Y() ? 1
-                     : (kInit = nZ - 1, krInit = fCoord->GetLastZBin(),-1);
-   const Double_t xScale = fCoord->GetXScale();
-   const Double_t yScale = fCoord->GetYScale();
-   const Double_t zScale = fCoord->GetZScale();
-   const TAxis   *xA = fXAxis;
-   const TAxis   *yA = fYAxis;
-   const TAxis   *zA = fZAxis;
+   const Int_t addI = frontPoint == 2 || frontPoint == 1 ? 1 : (iInit = nX - 1, -1);
+   const Int_t addJ = frontPoint == 2 || frontPoint == 3 ? 1 : (jInit = nY - 1, -1);
+   const Int_t addK = fBackBox.Get2DBox()[frontPoint + 4].Y() < fBackBox.Get2DBox()[frontPoint].Y() ? 1 : -1;
 
    if (fSelectionPass && fHighColor)
       Rgl::ObjectIDToColor(fSelectionBase, fHighColor);//base + 1 == 7
 
-   Double_t maxContent = TMath::Max(TMath::Abs(fMinMaxVal.first), TMath::Abs(fMinMaxVal.second));
-   if(!maxContent)//bad, find better way to check zero.
-      maxContent = 1.;
-
-   Double_t wmin = TMath::Max(fHist->GetMinimum(),0.);
-   Double_t wmax = TMath::Max(TMath::Abs(fHist->GetMaximum()),
-                              TMath::Abs(fHist->GetMinimum()));
-   Double_t binContent;
-
-   for(Int_t ir = irInit, i = iInit; addI > 0 ? i < nX : i >= 0; ir += addI, i += addI) {
-      for(Int_t jr = jrInit, j = jInit; addJ > 0 ? j < nY : j >= 0; jr += addJ, j += addJ) {
-         for(Int_t kr = krInit, k = kInit; addK > 0 ? k < nZ : k >= 0; kr += addK, k += addK) {
-            binContent = fHist->GetBinContent(ir, jr, kr);
-            if (binContent < wmin) continue;
-            if (binContent > wmax) binContent = wmax;
-
-            const Double_t w = TMath::Power(TMath::Abs(binContent-wmin) / (wmax-wmin),1./3.);
-            if (!w)
-               continue;
-
-            const Double_t xMin = xScale * (xA->GetBinLowEdge(ir) / 2 + xA->GetBinUpEdge(ir) / 2 - w * xA->GetBinWidth(ir) / 2);
-            const Double_t xMax = xScale * (xA->GetBinLowEdge(ir) / 2 + xA->GetBinUpEdge(ir) / 2 + w * xA->GetBinWidth(ir) / 2);
-            const Double_t yMin = yScale * (yA->GetBinLowEdge(jr) / 2 + yA->GetBinUpEdge(jr) / 2 - w * yA->GetBinWidth(jr) / 2);
-            const Double_t yMax = yScale * (yA->GetBinLowEdge(jr) / 2 + yA->GetBinUpEdge(jr) / 2 + w * yA->GetBinWidth(jr) / 2);
-            const Double_t zMin = zScale * (zA->GetBinLowEdge(kr) / 2 + zA->GetBinUpEdge(kr) / 2 - w * zA->GetBinWidth(kr) / 2);
-            const Double_t zMax = zScale * (zA->GetBinLowEdge(kr) / 2 + zA->GetBinUpEdge(kr) / 2 + w * zA->GetBinWidth(kr) / 2);
+   //Boxes of a (x, y) column are ordered by z, they are drawn first to last or last to first.
+   const auto columnBoxes = [this, nY, addK](Int_t i, Int_t j, Int_t &first, Int_t &last) {
+      const Int_t begin = fBoxColumns[i * nY + j], end = fBoxColumns[i * nY + j + 1];
+      first = addK > 0 ? begin : end - 1;
+      last = addK > 0 ? end : begin - 1;
+   };
+
+   for(Int_t i = iInit; addI > 0 ? i < nX : i >= 0; i += addI) {
+      for(Int_t j = jInit; addJ > 0 ? j < nY : j >= 0; j += addJ) {
+         Int_t first, last;
+         columnBoxes(i, j, first, last);
+         for(Int_t b = first; b != last; b += addK) {
+            const BinBox_t *box = &fBoxes[b];
+            const Double_t xMin = box->fXMin, xMax = box->fXMax;
+            const Double_t yMin = box->fYMin, yMax = box->fYMax;
+            const Double_t zMin = box->fZMin, zMax = box->fZMax;
 
             if (fBoxCut.IsActive() && fBoxCut.IsInCut(xMin, xMax, yMin, yMax, zMin, zMax))
                continue;
 
-            const Int_t binID = fSelectionBase + i * fCoord->GetNZBins() * fCoord->GetNYBins() + j * fCoord->GetNZBins() + k;
+            const Int_t binID = fSelectionBase + i * fCoord->GetNZBins() * fCoord->GetNYBins() + j * fCoord->GetNZBins() + box->fK;
 
             if (fSelectionPass && !fHighColor)
                Rgl::ObjectIDToColor(binID, fHighColor);
@@ -449,7 +508,7 @@ void TGLBoxPainter::DrawPlot()const
                Rgl::DrawSphere(&fQuadric, xMin, xMax, yMin, yMax, zMin, zMax);
             }
 
-            if (binContent < 0. && !fSelectionPass)
+            if (box->fNegative && !fSelectionPass)
                DrawMinusSigns(xMin, xMax, yMin, yMax, zMin, zMax, frontPoint, fType != kBox, HasSections());
 
             if (!fSelectionPass && !fHighColor && fSelectedPart == binID)
@@ -472,27 +531,16 @@ void TGLBoxPainter::DrawPlot()const
       const TGLEnableGuard smoothGuard(GL_LINE_SMOOTH);//[5-5]
       glHint(GL_LINE_SMOOTH_HINT, GL_NICEST);
 
-      for(Int_t ir = irInit, i = iInit; addI > 0 ? i < nX : i >= 0; ir += addI, i += addI) {
-         for(Int_t jr = jrInit, j = jInit; addJ > 0 ? j < nY : j >= 0; jr += addJ, j += addJ) {
-            for(Int_t kr = krInit, k = kInit; addK > 0 ? k < nZ : k >= 0; kr += addK, k += addK) {
-               binContent = fHist->GetBinContent(ir, jr, kr);
-               if (binContent < wmin) continue;
-               if (binContent > wmax) binContent = wmax;
-               const Double_t w = TMath::Power(TMath::Abs(binContent-wmin) / (wmax-wmin),1./3.);
-               if (!w)
+      for(Int_t i = iInit; addI > 0 ? i < nX : i >= 0; i += addI) {
+         for(Int_t j = jInit; addJ > 0 ? j < nY : j >= 0; j += addJ) {
+            Int_t first, last;
+            columnBoxes(i, j, first, last);
+            for(Int_t b = first; b != last; b += addK) {
+               const BinBox_t *box = &fBoxes[b];
+               if (fBoxCut.IsActive() && fBoxCut.IsInCut(box->fXMin, box->fXMax, box->fYMin, box->fYMax, box->fZMin, box->fZMax))
                   continue;
 
-               const Double_t xMin = xScale * (xA->GetBinLowEdge(ir) / 2 + xA->GetBinUpEdge(ir) / 2 - w * xA->GetBinWidth(ir) / 2);
-               const Double_t xMax = xScale * (xA->GetBinLowEdge(ir) / 2 + xA->GetBinUpEdge(ir) / 2 + w * xA->GetBinWidth(ir) / 2);
-               const Double_t yMin = yScale * (yA->GetBinLowEdge(jr) / 2 + yA->GetBinUpEdge(jr) / 2 - w * yA->GetBinWidth(jr) / 2);
-               const Double_t yMax = yScale * (yA->GetBinLowEdge(jr) / 2 + yA->GetBinUpEdge(jr) / 2 + w * yA->GetBinWidth(jr) / 2);
-               const Double_t zMin = zScale * (zA->GetBinLowEdge(kr) / 2 + zA->GetBinUpEdge(kr) / 2 - w * zA->GetBinWidth(kr) / 2);
-               const Double_t zMax = zScale * (zA->GetBinLowEdge(kr) / 2 + zA->GetBinUpEdge(kr) / 2 + w * zA->GetBinWidth(kr) / 2);
-
-               if (fBoxCut.IsActive() && fBoxCut.IsInCut(xMin, xMax, yMin, yMax, zMin, zMax))
-                  continue;
-
-               Rgl::DrawBoxFront(xMin, xMax, yMin, yMax, zMin, zMax, frontPoint);
+               Rgl::DrawBoxFront(box->fXMin, box->fXMax, box->fYMin, box->fYMax, box->fZMin, box->fZMax, frontPoint);
             }
          }
       }
@@ -105,6 +105,7 @@ protected:
    Long64_t fColorsVersion{0};     ///<! current colors/palette version, checked every time when new snapshot created
    UInt_t fColorsHash{0};          ///<! last hash of colors/palette
    Int_t fTF1UseSave{1};           ///<! use save buffer for TF1/TF2, 0:off, 1:prefer, 2:force
+   Int_t fGraphMaxPoints{0};       ///<! maximal number of TGraph points send to client, 0 - no reduction
    std::vector<int> fWindowGeometry; ///<! last received window geometry
    Bool_t fFixedSize{kFALSE};      ///<! is canvas size fixed
 
@@ -247,6 +248,9 @@ public:
    void SetPrimitivesMerge(Int_t cnt) { fPrimitivesMerge = cnt; }
    Int_t GetPrimitivesMerge() const { return fPrimitivesMerge; }
 
+   void SetGraphMaxPoints(Int_t cnt) { fGraphMaxPoints = cnt; }
+   Int_t GetGraphMaxPoints() const { return fGraphMaxPoints; }
+
    void SetLongerPolling(Bool_t on) { fLongerPolling = on; }
    Bool_t GetLongerPolling() const { return fLongerPolling; }
 
@@ -55,6 +55,8 @@
 #include "TTimer.h"
 #include "TThread.h"
 
+#include <algorithm>
+#include <cmath>
 #include <cstdio>
 #include <cstring>
 #include <fstream>
@@ -135,6 +137,123 @@ struct WebFont_t {
 
 static std::vector<WebFont_t> gWebFonts;
 
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// Create graph with reduced number of points, which looks the same as original when drawn in pad.
+/// Points are grouped in pixel columns of the pad. When graph drawn as line with increasing x values,
+/// first, minimal, maximal and last point of each column are kept. Otherwise first point in every
+/// pixel of the pad is kept. Points outside visible x range are grouped in one column on each side.
+/// Returns nullptr if graph cannot be reduced
+
+static TGraph *CreateReducedGraph(TPad *pad, TGraph *gr, const TString &opt, Int_t maxpoints)
+{
+   Int_t npoints = gr->GetN();
+   if ((maxpoints <= 0) || (npoints <= maxpoints) || (gr->IsA() != TGraph::Class()))
+      return nullptr;
+
+   TString gropt = opt;
+   gropt.ToUpper();
+   if (gropt.Contains("B") || gropt.Contains("F"))
+      return nullptr; // bar charts and fill areas need all points
+
+   Double_t *x = gr->GetX(), *y = gr->GetY();
+   Bool_t logx = pad->GetLogx(), logy = pad->GetLogy();
+   Bool_t as_line = (gropt.Contains("L") || gropt.Contains("C")) && !gropt.Contains("P") && !gropt.Contains("*");
+   for (Int_t n = 1; as_line && (n < npoints); ++n)
+      if (x[n] < x[n - 1])
+         as_line = kFALSE;
+
+   Double_t xmin, ymin, xmax, ymax;
+   gr->ComputeRange(xmin, ymin, xmax, ymax);
+   if (auto hist = gr->GetHistogram()) {
+      if (hist->GetXaxis()->TestBit(TAxis::kAxisRange)) {
+         xmin = hist->GetXaxis()->GetBinLowEdge(hist->GetXaxis()->GetFirst());
+         xmax = hist->GetXaxis()->GetBinUpEdge(hist->GetXaxis()->GetLast());
+      }
+      if (gr->GetMinimum() != -1111)
+         ymin = gr->GetMinimum();
+      if (gr->GetMaximum() != -1111)
+         ymax = gr->GetMaximum();
+   }
+
+   if ((logx && (xmin <= 0)) || (logy && !as_line && (ymin <= 0)))
+      return nullptr;
+
+   auto scale = [](Double_t v, Bool_t islog) { return !islog ? v : (v > 0 ? std::log10(v) : -1e300); };
+   xmin = scale(xmin, logx);
+   xmax = scale(xmax, logx);
+   ymin = scale(ymin, logy);
+   ymax = scale(ymax, logy);
+   if ((xmax <= xmin) || (!as_line && (ymax <= ymin)))
+      return nullptr;
+
+   Int_t nx = std::max(100, TMath::Nint(pad->GetWw() * pad->GetAbsWNDC())),
+         ny = std::max(100, TMath::Nint(pad->GetWh() * pad->GetAbsHNDC()));
+
+   auto pixel = [](Double_t v, Double_t vmin, Double_t vmax, Int_t npix) -> Int_t {
+      Double_t p = (v - vmin) / (vmax - vmin) * npix;
+      return p < 0 ? -1 : (p >= npix ? npix : (Int_t)p);
+   };
+
+   std::vector<Int_t> indx;
+
+   if (as_line) {
+      indx.reserve(4 * nx + 8);
+      // keep first, min, max and last point of every column, in original order
+      Int_t first = 0;
+      while (first < npoints) {
+         Int_t col = pixel(scale(x[first], logx), xmin, xmax, nx), last = first, imin = first, imax = first;
+         while ((last + 1 < npoints) && (pixel(scale(x[last + 1], logx), xmin, xmax, nx) == col)) {
+            ++last;
+            if (y[last] < y[imin]) imin = last;
+            if (y[last] > y[imax]) imax = last;
+         }
+         indx.push_back(first);
+         indx.push_back(std::min(imin, imax));
+         indx.push_back(std::max(imin, imax));
+         indx.push_back(last);
+         indx.erase(std::unique(indx.end() - 4, indx.end()), indx.end());
+         first = last + 1;
+      }
+   } else {
+      // keep first point in every pixel
+      std::vector<bool> used((nx + 2) * (ny + 2), false);
+      for (Int_t n = 0; n < npoints; ++n) {
+         Int_t ix = pixel(scale(x[n], logx), xmin, xmax, nx) + 1, iy = pixel(scale(y[n], logy), ymin, ymax, ny) + 1;
+         if (!used[iy * (nx + 2) + ix]) {
+            used[iy * (nx + 2) + ix] = true;
+            indx.push_back(n);
+         }
+      }
+   }
+
+   if ((Int_t) indx.size() >= npoints)
+      return nullptr;
+
+   auto res = new TGraph(indx.size());
+   for (Int_t n = 0; n < (Int_t) indx.size(); ++n)
+      res->SetPoint(n, x[indx[n]], y[indx[n]]);
+
+   res->SetName(gr->GetName());
+   res->SetTitle(gr->GetTitle());
+   gr->TAttLine::Copy(*res);
+   gr->TAttFill::Copy(*res);
+   gr->TAttMarker::Copy(*res);
+   res->SetMinimum(gr->GetMinimum());
+   res->SetMaximum(gr->GetMaximum());
+   res->SetBit(TGraph::kNoStats, gr->TestBit(TGraph::kNoStats));
+   if (auto hist = gr->GetHistogram()) {
+      auto hcopy = static_cast<TH1F *>(hist->Clone());
+      hcopy->SetDirectory(nullptr);
+      res->SetHistogram(hcopy);
+   }
+
+   TIter fiter(gr->GetListOfFunctions());
+   while (auto fobj = fiter())
+      res->GetListOfFunctions()->Add(fobj->Clone());
+
+   return res;
+}
+
 std::string TWebCanvas::gCustomScripts = {};
 std::vector<std::string> TWebCanvas::gCustomClasses = {};
 
@@ -195,6 +314,7 @@ TWebCanvas::TWebCanvas(TCanvas *c, const char *name, Int_t x, Int_t y, UInt_t wi
    fPrimitivesMerge = gEnv->GetValue("WebGui.PrimitivesMerge", 100);
    fTF1UseSave = gEnv->GetValue("WebGui.TF1UseSave", (Int_t) 1);
    fJsonComp = gEnv->GetValue("WebGui.JsonComp", TBufferJSON::kSameSuppression + TBufferJSON::kNoSpaces);
+   fGraphMaxPoints = gEnv->GetValue("WebGui.GraphMaxPoints", (Int_t) 0);
 
    fWebConn.emplace_back(0); // add special connection which only used to perform updates
 
@@ -959,7 +1079,10 @@ void TWebCanvas::CreatePadSnapshot(TPadWebSnapshot &paddata, TPad *pad, Long64_t
                (gropt.Index("X+", 0, TString::kIgnoreCase) != kNPOS) || (gropt.Index("X+", 0, TString::kIgnoreCase) != kNPOS)))
             gr->GetHistogram();
 
-         paddata.NewPrimitive(obj, gropt.Data()).SetSnapshot(TWebSnapshot::kObject, obj);
+         if (auto reduced = CreateReducedGraph(pad, gr, gropt, fGraphMaxPoints))
+            paddata.NewPrimitive(obj, gropt.Data()).SetSnapshot(TWebSnapshot::kObject, reduced, kTRUE);
+         else
+            paddata.NewPrimitive(obj, gropt.Data()).SetSnapshot(TWebSnapshot::kObject, obj);
 
          first_obj = false;
       } else if (obj->InheritsFrom(TGraph2D::Class())) {
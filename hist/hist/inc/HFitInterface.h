@@ -28,6 +28,9 @@ class TMultiGraph;
 struct Foption_t;
 
 #include "TFitResultPtr.h"
+#include "Fit/FitResult.h"
+
+#include <vector>
 
 namespace ROOT {
 
@@ -89,6 +92,16 @@ namespace ROOT {
       TFitResultPtr FitObject(THnBase * s1, TF1 *f1, Foption_t & option, const ROOT::Math::MinimizerOptions & moption, const char *goption, ROOT::Fit::DataRange & range);
 
 
+      /**
+         fit each of the histograms in `hists` with the function `f1`, starting every fit from the current parameters
+         of `f1`, and return the results in the same order. The histograms are fitted in parallel when implicit
+         multi-threading is enabled and the default minimizer is not TMinuit or Fumili, each task fitting a range of
+         histograms with its own copy of `f1` and its own fitter. The histograms and `f1` are not modified.
+         The supported options are "L", "WL", "W", "WW", "I", "R", "B", "E", "Q" and "V", as in TH1::Fit; the
+         results of empty histograms are empty.
+       */
+      std::vector<ROOT::Fit::FitResult> FitHistograms(const std::vector<TH1 *> &hists, const TF1 &f1, const char *option = "");
+
       /**
           fit an unbin data set (from tree or from histogram buffer)
           using a TF1 pointer and fit options.
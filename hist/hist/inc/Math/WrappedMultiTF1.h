@@ -20,6 +20,7 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <type_traits>
 
 namespace ROOT {
 
@@ -178,6 +179,20 @@ namespace ROOT {
             return fFunc->EvalPar(x, nullptr);
          }
 
+         /// evaluate the function at a block of points using the cached parameter values,
+         /// with TF1::EvalBatch for double
+         void DoEvalBatch(unsigned int npoints, const T *x, T *result) const override
+         {
+            if constexpr (std::is_same<T, double>::value) {
+               if (fDim == static_cast<unsigned int>(fFunc->GetNdim())) {
+                  fFunc->EvalBatch({x, std::size_t(npoints) * fDim}, {result, npoints});
+                  return;
+               }
+            }
+            for (unsigned int i = 0; i < npoints; ++i)
+               result[i] = fFunc->EvalPar(x + i * fDim, nullptr);
+         }
+
          /// evaluate the partial derivative with respect to the parameter
          T DoParameterDerivative(const T *x, const double *p, unsigned int ipar) const override;
 
@@ -17,6 +17,7 @@
 #include "TInterpreter.h"
 #include "TMath.h"
 #include <Math/Types.h>
+#include <ROOT/RSpan.hxx>
 
 #include <atomic>
 #include <cassert>
@@ -107,6 +108,8 @@ private:
    CallFuncSignature fFuncPtr = nullptr;           ///<! Function pointer, owned by the JIT.
    CallFuncSignature fGradFuncPtr = nullptr;       ///<! Function pointer, owned by the JIT.
    CallFuncSignature fHessFuncPtr = nullptr;       ///<! Function pointer, owned by the JIT.
+   mutable std::atomic<CallFuncSignature> fBatchFuncPtr{nullptr}; ///<! Function pointer of the batch loop, owned by the JIT.
+   mutable TString   fBatchClingName;              ///<! Cling name of the formula the batch loop was compiled for
    void *   fLambdaPtr = nullptr;                  ///<! Pointer to the lambda function
    static bool       fIsCladRuntimeIncluded;
 
@@ -125,6 +128,7 @@ private:
    void FillParametrizedFunctions(std::map<std::pair<TString, Int_t>, std::pair<TString, TString>> &functions);
    void FillVecFunctionsShurtCuts();
    void ReInitializeEvalMethod();
+   bool PrepareBatchFunction() const;
    std::string GetGradientFuncName() const {
       return std::string(GetUniqueFuncName().Data()) + "_grad_1";
    }
@@ -200,6 +204,7 @@ public:
    template <typename... Args>
    Double_t       Eval(Args... args) const;
    Double_t       EvalPar(const Double_t *x, const Double_t *params = nullptr) const;
+   void           EvalBatch(std::span<const Double_t> x, std::span<Double_t> out, const Double_t *params = nullptr) const;
 
    /// Generate gradient computation routine with respect to the parameters.
    /// \returns true if a gradient was generated and GradientPar can be called.
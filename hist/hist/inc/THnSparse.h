@@ -24,6 +24,8 @@
 #include "TExMap.h"
 #include "THnSparse_Internal.h"
 
+#include <vector>
+
 // needed only for template instantiations of THnSparseT:
 #include "TArrayF.h"
 #include "TArrayL.h"
@@ -39,8 +41,7 @@ class THnSparse: public THnBase {
    Int_t      fChunkSize;                   ///<  Number of entries for each chunk
    Long64_t   fFilledBins;                  ///<  Number of filled bins
    TObjArray  fBinContent;                  ///<  Array of THnSparseArrayChunk
-   TExMap     fBins;                        ///<! Filled bins
-   TExMap     fBinsContinued;               ///<! Filled bins for non-unique hashes, containing pairs of (bin index 0, bin index 1)
+   std::vector<Long64_t> fBinTable;         ///<! Open-addressing table of the filled bins, as pairs of (hash, bin index + 1)
    THnSparseCompactBinCoord *fCompactCoord; ///<! Compact coordinate
 
    THnSparse(const THnSparse&) = delete;
@@ -59,6 +60,8 @@ class THnSparse: public THnBase {
    THnSparseArrayChunk* AddChunk();
    void Reserve(Long64_t nbins) override;
    void FillExMap();
+   void ResizeBinTable(Long64_t nslots);
+   void InsertInBinTable(ULong64_t hash, Long64_t idx);
    virtual TArray* GenerateArray() const = 0;
    Long64_t GetBinIndexForCurrentBin(Bool_t allocate);
 
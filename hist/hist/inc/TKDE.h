@@ -123,6 +123,7 @@ public:
    void SetUseBinsNEvents(UInt_t nEvents);
    void SetTuneFactor(Double_t rho);
    void SetRange(Double_t xMin, Double_t xMax); ///< By default computed from the data
+   void SetKernelCutoff(Double_t cutoff);
 
    void Draw(const Option_t* option = "") override;
 
@@ -164,6 +165,11 @@ public:
       TKDE *fKDE;
       UInt_t fNWeights;               ///< Number of kernel weights (bandwidth as vectorized for binning)
       std::vector<Double_t> fWeights; ///< Kernel weights (bandwidth)
+      Double_t fMaxWeight;            ///< Largest kernel weight, defines the window of data points used in the sum
+      Double_t fCutoff;               ///< Kernel support in units of the bandwidth, or 0 to sum over all data points
+      std::vector<Double_t> fSortedData; ///< Sorted data points, used to find the ones within the kernel support
+      std::vector<UInt_t> fSortedIndex;  ///< Index in the original data of the sorted data points
+      Double_t WindowSum(Double_t x) const;
    public:
       TKernel(Double_t weight, TKDE *kde);
       void ComputeAdaptiveWeights();
@@ -221,6 +227,7 @@ private:
    Double_t fAdaptiveBandwidthFactor;  ///< Geometric mean of the kernel density estimation from the data for adaptive iteration
 
    Double_t fWeightSize;               ///< Caches the weight size
+   Double_t fKernelCutoff;             ///<! Truncation of the Gaussian kernel in units of the bandwidth
 
    std::vector<Double_t> fCanonicalBandwidths;
    std::vector<Double_t> fKernelSigmas2;
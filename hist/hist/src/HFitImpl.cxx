@@ -35,6 +35,11 @@
 #include "TFitResultPtr.h"
 #include "TFitResult.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
+#include <algorithm>
 #include <cstdlib>
 #include <cmath>
 #include <memory>
@@ -79,9 +84,29 @@ namespace HFit {
    template <class FitObject>
    double ComputeChi2(const FitObject & h1, TF1 &f1, bool useRange, ROOT::Fit::EChisquareType type );
 
+#ifdef R__HAS_VECCORE
+   std::unique_ptr<TF1> MakeVectorizedFunction(const TF1 &f1);
+#endif
+
+
 
+}
 
+#ifdef R__HAS_VECCORE
+std::unique_ptr<TF1> HFit::MakeVectorizedFunction(const TF1 &f1) {
+   // Return a copy of a formula-based function with its formula compiled for ROOT::Double_v,
+   // or a null pointer if the function has no formula or the vectorized formula cannot be compiled
+   const TFormula *formula = f1.GetFormula();
+   if (!formula || formula->TestBit(TFormula::kLambda) || f1.GetNdim() == 0)
+      return nullptr;
+   std::unique_ptr<TF1> vecFunc{static_cast<TF1 *>(f1.IsA()->New())};
+   f1.Copy(*vecFunc);
+   vecFunc->SetVectorized(true);
+   if (!vecFunc->IsVectorized() || !vecFunc->GetFormula()->IsValid())
+      return nullptr;
+   return vecFunc;
 }
+#endif
 
 int HFit::CheckFitFunction(const TF1 * f1, int dim) {
    // Check validity of fitted function
@@ -235,6 +260,14 @@ TFitResultPtr HFit::Fit(FitObject * h1, TF1 *f1 , Foption_t & fitOption , const
    }
 
 
+#ifdef R__HAS_VECCORE
+   // option VEC: evaluate a vectorized copy of the formula, when the chosen fit method supports it
+   std::unique_ptr<TF1> vecFunc;
+   if (fitOption.Vectorize && !linear && !fitOption.Gradient && !f1->IsVectorized() && !fitOption.Integral &&
+       !fitOption.BinVolume && !fitOption.PChi2 && fitdata->GetErrorType() != ROOT::Fit::BinData::kCoordError)
+      vecFunc = HFit::MakeVectorizedFunction(*f1);
+#endif
+
    // set the fit function
    // if option grad is specified use gradient
    if ( (linear || fitOption.Gradient) )
@@ -242,6 +275,11 @@ TFitResultPtr HFit::Fit(FitObject * h1, TF1 *f1 , Foption_t & fitOption , const
 #ifdef R__HAS_VECCORE
    else if(f1->IsVectorized())
       fitter->SetFunction(static_cast<const ROOT::Math::IParamMultiFunctionTempl<ROOT::Double_v> &>(ROOT::Math::WrappedMultiTF1Templ<ROOT::Double_v>(*f1)));
+   else if (vecFunc) {
+      ROOT::Math::WrappedMultiTF1Templ<ROOT::Double_v> vecWrapper(*vecFunc);
+      vecWrapper.SetAndCopyFunction(); // the fitter must not refer to the temporary copy
+      fitter->SetFunction(static_cast<const ROOT::Math::IParamMultiFunctionTempl<ROOT::Double_v> &>(vecWrapper));
+   }
 #endif
    else
       fitter->SetFunction(static_cast<const ROOT::Math::IParamMultiFunction &>(ROOT::Math::WrappedMultiTF1(*f1) ) );
@@ -695,6 +733,12 @@ void ROOT::Fit::FitOptionsMake(EFitObjectType type, const char *option, Foption_
    TString opt = option;
    opt.ToUpper();
 
+   // parse before the single-letter options, since "VEC" contains V, E and C
+   if (opt.Contains("VEC")) {
+      fitOption.Vectorize = 1;
+      opt.ReplaceAll("VEC","");
+   }
+
    // parse firt the specific options
    if (type == EFitObjectType::kHistogram) {
 
@@ -851,6 +895,14 @@ TFitResultPtr ROOT::Fit::UnBinFit(ROOT::Fit::UnBinData * data, TF1 * fitfunc, Fo
       assert ( (int) dim == fitfunc->GetNdim() );
       fitter->SetFunction(ROOT::Math::WrappedMultiTF1(*fitfunc) );
    }
+#ifdef R__HAS_VECCORE
+   // option VEC: evaluate a vectorized copy of the formula
+   else if (std::unique_ptr<TF1> vecFunc = fitOption.Vectorize ? HFit::MakeVectorizedFunction(*fitfunc) : nullptr) {
+      ROOT::Math::WrappedMultiTF1Templ<ROOT::Double_v> vecWrapper(*vecFunc, dim);
+      vecWrapper.SetAndCopyFunction(); // the fitter must not refer to the temporary copy
+      fitter->SetFunction(static_cast<const ROOT::Math::IParamMultiFunctionTempl<ROOT::Double_v> &>(vecWrapper));
+   }
+#endif
    else
       fitter->SetFunction(static_cast<const ROOT::Math::IParamMultiFunction &>(ROOT::Math::WrappedMultiTF1(*fitfunc, dim) ) );
 
@@ -1061,3 +1113,113 @@ double HFit::ComputeChi2(const FitObject & obj,  TF1  & f1, bool useRange, ROOT:
    return chi2(f1.GetParameters() );
 
 }
+
+// batch fit of many histograms
+
+std::vector<ROOT::Fit::FitResult> ROOT::Fit::FitHistograms(const std::vector<TH1 *> &hists, const TF1 &f1, const char *option)
+{
+   Foption_t fitOption;
+   ROOT::Fit::FitOptionsMake(ROOT::Fit::EFitObjectType::kHistogram, option, fitOption);
+
+   ROOT::Fit::DataOptions opt;
+   opt.fIntegral = fitOption.Integral;
+   opt.fUseRange = fitOption.Range;
+   if (fitOption.Like) opt.fUseEmpty = true;  // use empty bins in log-likelihood fits
+   if (fitOption.W1) opt.fErrors1 = true;
+   if (fitOption.W1 > 1) opt.fUseEmpty = true; // use empty bins with weight=1
+
+   // the default minimizer options are read once, they are global
+   const ROOT::Math::MinimizerOptions minOption;
+   const Int_t special = f1.GetNumber();
+
+   std::vector<ROOT::Fit::FitResult> results(hists.size());
+
+   // fit the histograms [first, last) with the same copy of the function and the same fitter
+   auto fitRange = [&](unsigned int first, unsigned int last) {
+      std::unique_ptr<TF1> func;
+      {
+         R__LOCKGUARD(gROOTMutex);
+         func.reset(static_cast<TF1 *>(f1.Clone()));
+      }
+      ROOT::Fit::Fitter fitter;
+      ROOT::Fit::FitConfig &fitConfig = fitter.Config();
+      for (unsigned int ih = first; ih < last; ++ih) {
+         func->SetParameters(f1.GetParameters());
+         func->SetParErrors(f1.GetParErrors());
+
+         ROOT::Fit::DataRange range;
+         if (opt.fUseRange) HFit::GetFunctionRange(*func, range);
+         auto fitdata = std::make_shared<ROOT::Fit::BinData>(opt, range);
+         ROOT::Fit::FillData(*fitdata, hists[ih], func.get());
+         if (fitdata->Size() == 0) {
+            if (!fitOption.Quiet) Warning("FitHistograms", "Fit data of histogram %s is empty", hists[ih]->GetName());
+            continue;
+         }
+
+         if (special != 0 && !fitOption.Bound) {
+            if (special == 100 || special == 400) ROOT::Fit::InitGaus(*fitdata, func.get()); // gaussian or landau
+            else if (special == 110 || special == 112 || special == 410) ROOT::Fit::Init2DGaus(*fitdata, func.get());
+            else if (special == 200) ROOT::Fit::InitExpo(*fitdata, func.get()); // exponential
+         }
+
+         fitter.SetFunction(static_cast<const ROOT::Math::IParamMultiFunction &>(ROOT::Math::WrappedMultiTF1(*func)));
+         for (int i = 0; i < func->GetNpar(); ++i) {
+            ROOT::Fit::ParameterSettings &parSettings = fitConfig.ParSettings(i);
+            double plow, pup;
+            func->GetParLimits(i, plow, pup);
+            // this is a limitation of TF1 interface - cannot fix a parameter to zero value
+            if (plow * pup != 0 && plow >= pup) {
+               parSettings.Fix();
+            } else if (plow < pup) {
+               if (!TMath::Finite(pup) && TMath::Finite(plow))
+                  parSettings.SetLowerLimit(plow);
+               else if (!TMath::Finite(plow) && TMath::Finite(pup))
+                  parSettings.SetUpperLimit(pup);
+               else
+                  parSettings.SetLimits(plow, pup);
+            }
+            double err = func->GetParError(i);
+            if (err > 0) parSettings.SetStepSize(err);
+         }
+
+         fitConfig.SetNormErrors(fitdata->GetErrorType() == ROOT::Fit::BinData::kNoError || opt.fErrors1);
+         fitConfig.SetMinimizerOptions(minOption);
+         if (fitOption.Verbose) fitConfig.MinimizerOptions().SetPrintLevel(3);
+         if (fitOption.Quiet)   fitConfig.MinimizerOptions().SetPrintLevel(0);
+         fitConfig.SetParabErrors(fitOption.Errors);
+         fitConfig.SetMinosErrors(fitOption.Errors);
+
+         bool fitok;
+         if (fitOption.Like) {
+            fitConfig.SetWeightCorrection((fitOption.Like & 2) == 2);
+            fitok = fitter.LikelihoodFit(fitdata, (fitOption.Like & 4) != 4);
+         } else {
+            fitok = fitter.Fit(fitdata);
+         }
+         if (!fitok && !fitOption.Quiet)
+            Warning("FitHistograms", "Abnormal termination of minimization for histogram %s", hists[ih]->GetName());
+         results[ih] = fitter.Result();
+      }
+   };
+
+#ifdef R__USE_IMT
+   // TMinuit and Fumili keep a global state, the fits can run in parallel only with the other minimizers
+   const std::string minimizer = minOption.MinimizerType();
+   if (ROOT::IsImplicitMTEnabled() && hists.size() > 1 && minimizer != "Minuit" && minimizer != "TMinuit" &&
+       minimizer != "Fumili") {
+      ROOT::TThreadExecutor pool;
+      // one range, thus one function copy and one fitter, per task
+      const unsigned int nRanges = std::min<unsigned int>(hists.size(), 4 * pool.GetPoolSize());
+      pool.Foreach(
+         [&](unsigned int iRange) {
+            fitRange(iRange * hists.size() / nRanges, (iRange + 1) * hists.size() / nRanges);
+         },
+         ROOT::TSeqU(nRanges));
+   } else
+#endif
+   {
+      fitRange(0, hists.size());
+   }
+
+   return results;
+}
@@ -434,6 +434,52 @@ Int_t TAxis::FindFixBin(Double_t x) const
    return bin;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Find the bin numbers of the n values x[0], x[stride], ..., x[(n-1)*stride], as FindFixBin would return them.
+///
+/// The loop over the values of an axis with fixed bin sizes has no branches and can be vectorized by the
+/// compiler. For variable bin sizes the bin edges are found with a branchless binary search.
+
+void TAxis::FindFixBins(Int_t n, const Double_t *x, Int_t *bins, Int_t stride) const
+{
+   const Double_t xmin = fXmin;
+   const Double_t xmax = fXmax;
+   const Int_t nbins = fNbins;
+   if (!fXbins.fN) {
+      const Double_t width = fXmax - fXmin;
+      for (Int_t i = 0; i < n; ++i) {
+         const Double_t xi = x[i * stride];
+         // the values outside the axis are replaced by xmin to keep the conversion to Int_t defined
+         const Bool_t inRange = (xi >= xmin) && (xi < xmax);
+         const Double_t xc = inRange ? xi : xmin;
+         const Int_t bin = 1 + int(nbins * (xc - xmin) / width);
+         bins[i] = inRange ? bin : ((xi < xmin) ? 0 : nbins + 1);
+      }
+      return;
+   }
+   const Double_t *edges = fXbins.fArray;
+   for (Int_t i = 0; i < n; ++i) {
+      const Double_t xi = x[i * stride];
+      if (xi < xmin) {
+         bins[i] = 0;
+         continue;
+      }
+      if (!(xi < xmax)) { // note the way to catch NaN
+         bins[i] = nbins + 1;
+         continue;
+      }
+      // find the last edge not larger than xi
+      const Double_t *base = edges;
+      Int_t len = fXbins.fN;
+      while (len > 1) {
+         const Int_t half = len / 2;
+         base = (base[half] <= xi) ? base + half : base;
+         len -= half;
+      }
+      bins[i] = 1 + Int_t(base - edges);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return label for bin
 
@@ -2474,6 +2474,40 @@ void TF1::GradientPar(const Double_t *x, Double_t *grad, Double_t eps)
       GradientParTempl<Double_t>(x, grad, eps);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the function at out.size() points, writing the results in out.
+///
+/// The coordinates are stored one point after the other in x, which must contain
+/// out.size() * GetNdim() values. If params is a null pointer the current parameter
+/// values of the function are used.
+/// For functions based on a formula the loop over the points is compiled together
+/// with the formula (see TFormula::EvalBatch), which avoids the overhead of calling
+/// EvalPar for each point. Other functions are evaluated with EvalPar.
+
+void TF1::EvalBatch(std::span<const Double_t> x, std::span<Double_t> out, const Double_t *params)
+{
+   if (fType == EFType::kFormula && fFormula && !fFormula->IsVectorized()) {
+      fFormula->EvalBatch(x, out, params);
+      if (fNormalized && fNormIntegral != 0) {
+         for (auto &value : out)
+            value /= fNormIntegral;
+      }
+      return;
+   }
+
+   const std::size_t ndim = fNdim;
+   if (x.size() < out.size() * ndim) {
+      Error("EvalBatch", "%zu coordinates are needed for %zu points of dimension %zu, but only %zu are given",
+            out.size() * ndim, out.size(), ndim, x.size());
+      return;
+   }
+   for (std::size_t i = 0; i < out.size(); ++i) {
+      const Double_t *xi = x.data() + i * ndim;
+      InitArgs(xi, params);
+      out[i] = EvalPar(xi, params);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Initialize parameters addresses.
 
@@ -3046,7 +3080,6 @@ void TF1::Paint(Option_t *option)
 TH1   *TF1::DoCreateHistogram(Double_t xmin, Double_t  xmax, Bool_t recreate)
 {
    Int_t i;
-   Double_t xv[1];
 
    TH1 *histogram = nullptr;
 
@@ -3114,13 +3147,14 @@ TH1   *TF1::DoCreateHistogram(Double_t xmin, Double_t  xmax, Bool_t recreate)
    // Restore axis titles.
    histogram->GetXaxis()->SetTitle(xtitle.Data());
    histogram->GetYaxis()->SetTitle(ytitle.Data());
-   Double_t *parameters = GetParameters();
-
-   InitArgs(xv, parameters);
-   for (i = 1; i <= fNpx; i++) {
-      xv[0] = histogram->GetBinCenter(i);
-      histogram->SetBinContent(i, EvalPar(xv, parameters));
-   }
+   // evaluate the function at all bin centers at once
+   std::vector<Double_t> xvalues(fNpx);
+   std::vector<Double_t> values(fNpx);
+   for (i = 0; i < fNpx; i++)
+      xvalues[i] = histogram->GetBinCenter(i + 1);
+   EvalBatch(xvalues, values, GetParameters());
+   for (i = 1; i <= fNpx; i++)
+      histogram->SetBinContent(i, values[i - 1]);
 
    // Copy Function attributes to histogram attributes.
    histogram->SetBit(TH1::kNoStats);
@@ -3074,6 +3074,87 @@ void TFormula::SetVectorized(Bool_t vectorized)
 #endif
 }
 
+static bool functionExists(const string &Name) {
+   return gInterpreter->GetFunction(/*cl*/nullptr, Name.c_str());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compile in Cling a loop calling the formula function over a set of points, so that EvalBatch
+/// pays the cost of the generic call interface only once per batch.
+/// Returns false if the formula cannot be evaluated in this way (lambda or vectorized formulas).
+
+bool TFormula::PrepareBatchFunction() const
+{
+   if (fBatchFuncPtr.load() && fBatchClingName == fClingName)
+      return true;
+   if (!fReadyToExecute || !fClingInitialized || fVectorized || TestBit(TFormula::kLambda) || fClingName.IsNull())
+      return false;
+
+   R__LOCKGUARD(gROOTMutex);
+   // check again in case another thread has prepared the batch function
+   if (fBatchFuncPtr.load() && fBatchClingName == fClingName)
+      return true;
+
+   // the formula function takes no argument, (x) or (x, p)
+   const Bool_t hasArgs = fNdim > 0 || fNpar > 0;
+   const std::string batchName = std::string(fClingName.Data()) + "_batch";
+   if (!functionExists(batchName)) {
+      TString code = TString::Format("#pragma cling optimize(2)\n"
+                                     "void %s(Double_t *x, Double_t *p, Double_t *out, Long64_t n) {\n"
+                                     "   for (Long64_t i = 0; i < n; ++i)\n"
+                                     "      out[i] = %s(%s%s);\n"
+                                     "}",
+                                     batchName.c_str(), fClingName.Data(),
+                                     hasArgs ? TString::Format("x + i * %d", fNdim).Data() : "",
+                                     fNpar > 0 ? ", p" : "");
+      if (!gInterpreter->Declare(code.Data()))
+         return false;
+   }
+   TMethodCall method;
+   method.InitWithPrototype(batchName.c_str(), "Double_t*,Double_t*,Double_t*,Long64_t");
+   if (!method.IsValid())
+      return false;
+   CallFuncSignature funcPtr = prepareFuncPtr(&method);
+   if (!funcPtr)
+      return false;
+   fBatchClingName = fClingName;
+   fBatchFuncPtr = funcPtr;
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the formula at out.size() points, writing the results in out.
+/// The coordinates are stored one point after the other in x, which must contain
+/// out.size() * GetNdim() values. If params is a null pointer the stored parameter values are used.
+/// For formulas compiled by Cling the loop over the points is itself compiled, and the formula
+/// function is called directly for each point instead of through the generic call interface of EvalPar.
+
+void TFormula::EvalBatch(std::span<const Double_t> x, std::span<Double_t> out, const Double_t *params) const
+{
+   const std::size_t n = out.size();
+   const std::size_t ndim = fNdim;
+   if (x.size() < n * ndim) {
+      Error("EvalBatch", "%zu coordinates are needed for %zu points of dimension %zu, but only %zu are given", n * ndim,
+            n, ndim, x.size());
+      return;
+   }
+   if (n == 0)
+      return;
+
+   if (PrepareBatchFunction()) {
+      double *vars = (ndim > 0) ? const_cast<double *>(x.data()) : const_cast<double *>(fClingVariables.data());
+      double *pars = (params) ? const_cast<double *>(params) : const_cast<double *>(fClingParameters.data());
+      double *result = out.data();
+      Long64_t npoints = n;
+      void *args[4] = {&vars, &pars, &result, &npoints};
+      (*fBatchFuncPtr.load())(nullptr, 4, args, /*ret*/ nullptr);
+      return;
+   }
+
+   for (std::size_t i = 0; i < n; ++i)
+      out[i] = EvalPar(ndim > 0 ? x.data() + i * ndim : nullptr, params);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 Double_t TFormula::EvalPar(const Double_t *x,const Double_t *params) const
 {
@@ -3120,10 +3201,6 @@ Double_t TFormula::EvalPar(const Double_t *x,const Double_t *params) const
 
 bool TFormula::fIsCladRuntimeIncluded = false;
 
-static bool functionExists(const string &Name) {
-   return gInterpreter->GetFunction(/*cl*/nullptr, Name.c_str());
-}
-
 static void IncludeCladRuntime(Bool_t &IsCladRuntimeIncluded) {
    if (!IsCladRuntimeIncluded) {
       IsCladRuntimeIncluded = true;
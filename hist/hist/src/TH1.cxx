@@ -3445,6 +3445,9 @@ Int_t TH1::Fill(const char *namex, Double_t w)
 /// weights is automatically triggered and the sum of the squares of weights is incremented
 /// by \f$ w^2 \f$ in the bin corresponding to x.
 /// if w is NULL each entry is assumed a weight=1
+///
+/// Unless the axis can be extended, the bins of the values are found in chunks with TAxis::FindFixBins and
+/// the statistics are updated once, which is much faster than calling Fill for each value.
 
 void TH1::FillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride)
 {
@@ -3474,28 +3477,80 @@ void TH1::FillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride
 
 void TH1::DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride)
 {
-   Int_t bin,i;
-
    fEntries += ntimes;
-   Double_t ww = 1;
    Int_t nbins   = fXaxis.GetNbins();
-   ntimes *= stride;
-   for (i=0;i<ntimes;i+=stride) {
-      bin =fXaxis.FindBin(x[i]);
-      if (bin <0) continue;
-      if (w) ww = w[i];
-      if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
-      if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
-      AddBinContent(bin, ww);
-      if (bin == 0 || bin > nbins) {
-         if (!GetStatOverflowsBehaviour()) continue;
+
+   // TAxis::FindBin can extend the axis while filling: in this case the values are filled one by one
+   if (fXaxis.CanExtend() && !fXaxis.IsAlphanumeric()) {
+      Double_t ww = 1;
+      ntimes *= stride;
+      for (Int_t i=0;i<ntimes;i+=stride) {
+         Int_t bin =fXaxis.FindBin(x[i]);
+         if (bin <0) continue;
+         if (w) ww = w[i];
+         if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
+         if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
+         AddBinContent(bin, ww);
+         if (bin == 0 || bin > nbins) {
+            if (!GetStatOverflowsBehaviour()) continue;
+         }
+         Double_t z= ww;
+         fTsumw   += z;
+         fTsumw2  += z*z;
+         fTsumwx  += z*x[i];
+         fTsumwx2 += z*x[i]*x[i];
+      }
+      return;
+   }
+
+   if (w && !fSumw2.fN && !TestBit(TH1::kIsNotW)) {
+      for (Int_t i = 0; i < ntimes; ++i) {
+         if (w[i * stride] != 1.0) {
+            Sumw2();
+            break;
+         }
       }
-      Double_t z= ww;
-      fTsumw   += z;
-      fTsumw2  += z*z;
-      fTsumwx  += z*x[i];
-      fTsumwx2 += z*x[i]*x[i];
    }
+
+   // the bins are found for chunks of values at once, then the unit weights are counted in a local array
+   // added once to the histogram, while other weights are added directly to the bins
+   constexpr Int_t kChunkSize = 1024;
+   Int_t bins[kChunkSize];
+   std::vector<Double_t> counts;
+   if (!w && nbins + 2 <= ntimes) counts.assign(nbins + 2, 0.);
+   const Bool_t useStatOverflows = GetStatOverflowsBehaviour();
+   Double_t tsumw = 0, tsumw2 = 0, tsumwx = 0, tsumwx2 = 0;
+   for (Int_t start = 0; start < ntimes; start += kChunkSize) {
+      const Int_t n = std::min(kChunkSize, ntimes - start);
+      const Double_t *xchunk = x + start * stride;
+      const Double_t *wchunk = w ? w + start * stride : nullptr;
+      fXaxis.FindFixBins(n, xchunk, bins, stride);
+      for (Int_t i = 0; i < n; ++i) {
+         const Int_t bin = bins[i];
+         const Double_t xi = xchunk[i * stride];
+         const Double_t ww = wchunk ? wchunk[i * stride] : 1.;
+         if (!counts.empty()) {
+            counts[bin] += 1.;
+         } else {
+            if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
+            AddBinContent(bin, ww);
+         }
+         if (!useStatOverflows && (bin == 0 || bin > nbins)) continue;
+         tsumw   += ww;
+         tsumw2  += ww*ww;
+         tsumwx  += ww*xi;
+         tsumwx2 += ww*xi*xi;
+      }
+   }
+   for (Int_t bin = 0; bin < (Int_t)counts.size(); ++bin) {
+      if (counts[bin] == 0.) continue;
+      if (fSumw2.fN) fSumw2.fArray[bin] += counts[bin];
+      AddBinContent(bin, counts[bin]);
+   }
+   fTsumw   += tsumw;
+   fTsumw2  += tsumw2;
+   fTsumwx  += tsumwx;
+   fTsumwx2 += tsumwx2;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3965,6 +4020,7 @@ TFitResultPtr TH1::Fit(const char *fname ,Option_t *option ,Option_t *goption, D
 ///   "WIDTH" | Scales the histogran bin content by the bin width (useful for variable bins histograms)
 ///   "SERIAL" | Runs in serial mode. By defult if ROOT is built with MT support and MT is enables, the fit is perfomed in multi-thread     - "E"  Perform better Errors estimation using Minos technique
 ///   "MULTITHREAD" | Forces usage of multi-thread execution whenever possible
+///   "VEC" | Evaluates a formula-based function on SIMD vectors, using a vectorized copy of its formula (needs ROOT built with VecCore). It is ignored for linear fits and with the options "G", "I", "P" and "WIDTH".
 ///
 /// The default fitting of an histogram (when no option is given) is perfomed as following:
 ///   - a chi-square fit (see below Chi-square Fits) computed using the bin histogram errors and excluding bins with zero errors (empty bins);
@@ -8,9 +8,15 @@
 #include "TError.h"
 #include "THashList.h"
 #include "TClass.h"
+#include "TROOT.h"
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+#include <algorithm>
 #include <iostream>
 #include <limits>
 #include <utility>
+#include <vector>
 
 #define PRINTRANGE(a, b, bn)                                                                                          \
    Printf(" base: %f %f %d, %s: %f %f %d", a->GetXmin(), a->GetXmax(), a->GetNbins(), bn, b->GetXmin(), b->GetXmax(), \
@@ -762,6 +768,7 @@ Bool_t TH1Merger::SameAxesMerge() {
    fH0->GetStats(totstats);
    Double_t nentries = fH0->GetEntries();
 
+   std::vector<const TH1 *> hists;
    TIter next(&fInputList);
    while (TH1* hist=(TH1*)next()) {
       // process only if the histogram has limits; otherwise it was processed before
@@ -778,12 +785,32 @@ Bool_t TH1Merger::SameAxesMerge() {
       for (Int_t i=0; i<TH1::kNstat; i++)
          totstats[i] += stats[i];
       nentries += hist->GetEntries();
+      hists.push_back(hist);
+   }
 
-         //Int_t nx = hist->GetXaxis()->GetNbins();
-         // loop on bins of the histogram and do the merge
-      for (Int_t ibin = 0; ibin < hist->fNcells; ibin++) {
-         MergeBin(hist, ibin, ibin);
+   // Merge the bins by ranges, adding all the histograms to a range before moving to the next one: the range of the
+   // merged histogram stays in cache, and distinct ranges can be merged concurrently.
+   const Int_t ncells = fH0->fNcells;
+   const Int_t chunkSize = 4096;
+   const Int_t nchunks = (ncells + chunkSize - 1) / chunkSize;
+   auto mergeChunk = [&](Int_t ichunk) {
+      const Int_t firstBin = ichunk * chunkSize;
+      const Int_t lastBin = std::min(firstBin + chunkSize, ncells);
+      for (const TH1 *hist : hists) {
+         for (Int_t ibin = firstBin; ibin < lastBin; ibin++) {
+            MergeBin(hist, ibin, ibin);
+         }
       }
+   };
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && nchunks > 1 && Double_t(ncells) * hists.size() > 1.E6 && !gDebug) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(mergeChunk, ROOT::TSeqI(nchunks));
+   } else
+#endif
+   {
+      for (Int_t ichunk = 0; ichunk < nchunks; ichunk++)
+         mergeChunk(ichunk);
    }
    //copy merged stats
    fH0->PutStats(totstats);
@@ -16,6 +16,9 @@
 #include "TDataMember.h"
 #include "TDataType.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace {
 //______________________________________________________________________________
 //
@@ -329,12 +332,13 @@ ULong64_t THnSparseCoordCompression::GetHashFromBuffer(const Char_t* buf) const
       return hash1;
    }
 
-   // else: doesn't fit into a Long64_t:
+   // else: doesn't fit into a Long64_t: mix it in by words of 8 bytes
    ULong64_t hash = 5381;
-   const Char_t* str = buf;
-   while (str - buf < fCoordBufferSize) {
-      hash *= 5;
-      hash += *(str++);
+   for (Int_t offset = 0; offset < fCoordBufferSize; offset += 8) {
+      ULong64_t word = 0;
+      memcpy(&word, buf + offset, std::min(8, fCoordBufferSize - offset));
+      hash = (hash ^ word) * 0x9E3779B97F4A7C15ULL;
+      hash ^= hash >> 29;
    }
    return hash;
 }
@@ -570,14 +574,15 @@ Translation from an n-dimensional bin coordinate to the linear index within
 the chunks is done by GetBin(). It creates a hash from the compacted bin
 coordinates (the hash of a bin coordinate is the compacted coordinate itself
 if it takes less than 8 bytes, the size of a Long64_t.
-This hash is used to lookup the linear index in the TExMap member fBins;
-the coordinates of the entry fBins points to is compared to the coordinates
-passed to GetBin(). If they do not match, these two coordinates have the same
-hash - which is extremely unlikely but (for the case where the compact bin
-coordinates are larger than 4 bytes) possible. In this case, fBinsContinued
-contains a chain of linear indexes with the same hash. Iterating through this
-chain and comparing each bin coordinates with the one passed to GetBin() will
-retrieve the matching bin.
+This hash is used to lookup the linear index in the open-addressing table
+fBinTable, which stores the hash and the linear index of each filled bin next
+to each other, and is kept at most half full. The table is probed linearly
+from the slot given by the hash; for each slot with the same hash the
+coordinates of the bin it points to are compared to the coordinates passed to
+GetBin(), unless the hash is the compacted coordinate itself. If they do not
+match, the two coordinates have the same hash - which is extremely unlikely
+but (for the case where the compact bin coordinates are larger than 8 bytes)
+possible - and the probing continues.
 */
 
 
@@ -649,8 +654,20 @@ void THnSparse::InitStorage(Int_t* nbins, Int_t chunkSize)
    fCompactCoord = new THnSparseCompactBinCoord(fNdimensions, nbins);
 }
 
+namespace {
+/// Slot of a hash in a bin table with `mask + 1` slots: the hash can be a
+/// compacted coordinate, whose low bits vary little, so mix all its bits in.
+inline Long64_t BinTableSlot(ULong64_t hash, Long64_t mask)
+{
+   hash ^= hash >> 33;
+   hash *= 0xFF51AFD7ED558CCDULL;
+   hash ^= hash >> 33;
+   return (Long64_t)(hash & (ULong64_t)mask);
+}
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
-///We have been streamed; set up fBins
+///We have been streamed; set up fBinTable
 
 void THnSparse::FillExMap()
 {
@@ -658,41 +675,58 @@ void THnSparse::FillExMap()
    THnSparseArrayChunk* chunk = nullptr;
    THnSparseCoordCompression compactCoord(*GetCompactCoord());
    Long64_t idx = 0;
-   if (2 * GetNbins() > fBins.Capacity())
-      fBins.Expand(3 * GetNbins());
+   ResizeBinTable(2 * GetNbins());
    while ((chunk = (THnSparseArrayChunk*) iChunk())) {
       const Int_t chunkSize = chunk->GetEntries();
       Char_t* buf = chunk->fCoordinates;
       const Int_t singleCoordSize = chunk->fSingleCoordinateSize;
       const Char_t* endbuf = buf + singleCoordSize * chunkSize;
-      for (; buf < endbuf; buf += singleCoordSize, ++idx) {
-         Long64_t hash = compactCoord.GetHashFromBuffer(buf);
-         Long64_t linidx = fBins.GetValue(hash);
-         if (linidx) {
-            Long64_t nextidx = linidx;
-            while (nextidx) {
-               // must be a collision, so go to fBinsContinued.
-               linidx = nextidx;
-               nextidx = fBinsContinued.GetValue(linidx);
-            }
-            fBinsContinued.Add(linidx, idx + 1);
-         } else {
-            fBins.Add(hash, idx + 1);
-         }
-      }
+      for (; buf < endbuf; buf += singleCoordSize, ++idx)
+         InsertInBinTable(compactCoord.GetHashFromBuffer(buf), idx);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Resize the table of filled bins to at least nslots slots (a power of 2),
+/// re-inserting the bins it contains.
+
+void THnSparse::ResizeBinTable(Long64_t nslots)
+{
+   Long64_t newSize = 16;
+   while (newSize < nslots)
+      newSize *= 2;
+   if (2 * newSize <= (Long64_t)fBinTable.size())
+      return;
+   std::vector<Long64_t> oldTable(2 * newSize, 0);
+   oldTable.swap(fBinTable);
+   for (size_t i = 0; i < oldTable.size(); i += 2) {
+      if (oldTable[i + 1])
+         InsertInBinTable(oldTable[i], oldTable[i + 1] - 1);
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Insert the bin with linear index idx and coordinate hash "hash" in the
+/// first free slot, which must exist; the bin must not be in the table yet.
+
+void THnSparse::InsertInBinTable(ULong64_t hash, Long64_t idx)
+{
+   const Long64_t mask = fBinTable.size() / 2 - 1;
+   Long64_t slot = BinTableSlot(hash, mask);
+   while (fBinTable[2 * slot + 1])
+      slot = (slot + 1) & mask;
+   fBinTable[2 * slot] = (Long64_t)hash;
+   fBinTable[2 * slot + 1] = idx + 1;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Initialize storage for nbins
 
 void THnSparse::Reserve(Long64_t nbins) {
-   if (!fBins.GetSize() && fBinContent.GetSize()) {
+   if (fBinTable.empty() && fBinContent.GetSize()) {
       FillExMap();
    }
-   if (2 * nbins > fBins.Capacity()) {
-      fBins.Expand(3 * nbins);
-   }
+   ResizeBinTable(2 * nbins);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -790,19 +824,24 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
 {
    THnSparseCompactBinCoord* cc = GetCompactCoord();
    ULong64_t hash = cc->GetHash();
-   if (fBinContent.GetSize() && !fBins.GetSize())
-      FillExMap();
-   Long64_t linidx = (Long64_t) fBins.GetValue(hash);
-   while (linidx) {
-      // fBins stores index + 1!
-      THnSparseArrayChunk* chunk = GetChunk((linidx - 1)/ fChunkSize);
-      if (chunk->Matches((linidx - 1) % fChunkSize, cc->GetBuffer()))
-         return linidx - 1; // we store idx+1, 0 is "TExMap: not found"
-
-      Long64_t nextlinidx = fBinsContinued.GetValue(linidx);
-      if (!nextlinidx) break;
-
-      linidx = nextlinidx;
+   if (fBinTable.empty()) {
+      if (fBinContent.GetSize())
+         FillExMap();
+      else if (!allocate)
+         return -1;
+      else
+         ResizeBinTable(16);
+   }
+   // if the compact coordinates fit into the hash, equal hashes mean equal coordinates
+   const Bool_t hashIsCoord = cc->GetBufferSize() <= 8;
+   const Long64_t mask = fBinTable.size() / 2 - 1;
+   for (Long64_t slot = BinTableSlot(hash, mask); fBinTable[2 * slot + 1]; slot = (slot + 1) & mask) {
+      if ((ULong64_t)fBinTable[2 * slot] != hash)
+         continue;
+      // fBinTable stores index + 1, 0 is "empty slot"
+      const Long64_t linidx = fBinTable[2 * slot + 1] - 1;
+      if (hashIsCoord || GetChunk(linidx / fChunkSize)->Matches(linidx % fChunkSize, cc->GetBuffer()))
+         return linidx;
    }
    if (!allocate) return -1;
 
@@ -817,18 +856,11 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
    }
    chunk->AddBin(newidx, cc->GetBuffer());
 
-   // store translation between hash and bin
+   // store translation between hash and bin, keeping the table at most half full
    newidx += (fBinContent.GetEntriesFast() - 1) * fChunkSize;
-   if (!linidx) {
-      // fBins didn't find it
-      if (2 * GetNbins() > fBins.Capacity())
-         fBins.Expand(3 * GetNbins());
-      fBins.Add(hash, newidx + 1);
-   } else {
-      // fBins contains one, but it's the wrong one;
-      // add entry to fBinsContinued.
-      fBinsContinued.Add(linidx, newidx + 1);
-   }
+   if (2 * GetNbins() > (Long64_t)fBinTable.size() / 2)
+      ResizeBinTable(4 * GetNbins());
+   InsertInBinTable(hash, newidx);
    return newidx;
 }
 
@@ -880,7 +912,7 @@ Double_t THnSparse::GetSparseFractionMem() const {
 
    Double_t size = 0.;
    size += fBinContent.GetEntries() * (GetChunkSize() * sizePerChunkElement + sizeof(THnSparseArrayChunk));
-   size += + 3 * sizeof(Long64_t) * fBins.GetSize() /* TExMap */;
+   size += + sizeof(Long64_t) * fBinTable.size() /* fBinTable */;
 
    Double_t nbinsTotal = 1.;
    for (Int_t d = 0; d < fNdimensions; ++d)
@@ -962,8 +994,7 @@ void THnSparse::Sumw2()
 void THnSparse::Reset(Option_t *option /*= ""*/)
 {
    fFilledBins = 0;
-   fBins.Delete();
-   fBinsContinued.Clear();
+   fBinTable.clear();
    fBinContent.Delete();
    ResetBase(option);
 }
@@ -14,6 +14,7 @@
 #include "TMath.h"
 #include "TF1.h"
 #include "THLimitsFinder.h"
+#include <algorithm>
 #include <iostream>
 #include "TError.h"
 #include "TClass.h"
@@ -772,6 +773,8 @@ Int_t TProfile::Fill(const char *namex, Double_t y, Double_t w)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Fill a Profile histogram with weights.
+/// Unless the axis can be extended, the bins are found for chunks of values
+/// at once and the statistics are added to the profile once at the end.
 
 void TProfile::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *w, Int_t stride)
 {
@@ -793,29 +796,89 @@ void TProfile::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const D
          return;
    }
 
-   for (i=ifirst;i<ntimes;i+=stride) {
-      if (fYmin != fYmax) {
-         if (y[i] <fYmin || y[i]> fYmax || TMath::IsNaN(y[i])) continue;
+   const Bool_t hasYRange = fYmin != fYmax;
+
+   // TAxis::FindBin can extend the axis while filling: in this case the values are filled one by one
+   if (fXaxis.CanExtend() && !fXaxis.IsAlphanumeric()) {
+      for (i=ifirst;i<ntimes;i+=stride) {
+         if (hasYRange) {
+            if (y[i] <fYmin || y[i]> fYmax || TMath::IsNaN(y[i])) continue;
+         }
+
+         Double_t u = (w) ? w[i] : 1; // (w[i] > 0 ? w[i] : -w[i]);
+         fEntries++;
+         bin =fXaxis.FindBin(x[i]);
+         AddBinContent(bin, u*y[i]);
+         fSumw2.fArray[bin] += u*y[i]*y[i];
+         if (!fBinSumw2.fN && u != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();  // must be called before accumulating the entries
+         if (fBinSumw2.fN)  fBinSumw2.fArray[bin] += u*u;
+         fBinEntries.fArray[bin] += u;
+         if (bin == 0 || bin > fXaxis.GetNbins()) {
+            if (!GetStatOverflowsBehaviour()) continue;
+         }
+         fTsumw   += u;
+         fTsumw2  += u*u;
+         fTsumwx  += u*x[i];
+         fTsumwx2 += u*x[i]*x[i];
+         fTsumwy  += u*y[i];
+         fTsumwy2 += u*y[i]*y[i];
+      }
+      return;
+   }
+
+   // Sumw2 must be called before accumulating the entries of the first weight different from 1
+   if (w && !fBinSumw2.fN && !TestBit(TH1::kIsNotW)) {
+      for (i=ifirst;i<ntimes;i+=stride) {
+         if (hasYRange && (y[i] <fYmin || y[i]> fYmax || TMath::IsNaN(y[i]))) continue;
+         if (w[i] != 1.0) {
+            Sumw2();
+            break;
+         }
       }
+   }
 
-      Double_t u = (w) ? w[i] : 1; // (w[i] > 0 ? w[i] : -w[i]);
-      fEntries++;
-      bin =fXaxis.FindBin(x[i]);
-      AddBinContent(bin, u*y[i]);
-      fSumw2.fArray[bin] += u*y[i]*y[i];
-      if (!fBinSumw2.fN && u != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();  // must be called before accumulating the entries
-      if (fBinSumw2.fN)  fBinSumw2.fArray[bin] += u*u;
-      fBinEntries.fArray[bin] += u;
-      if (bin == 0 || bin > fXaxis.GetNbins()) {
-         if (!GetStatOverflowsBehaviour()) continue;
+   // the bins are found for chunks of values at once, and the statistics are accumulated locally
+   constexpr Int_t kChunkSize = 1024;
+   Int_t bins[kChunkSize];
+   const Int_t nbins = fXaxis.GetNbins();
+   const Bool_t useStatOverflows = GetStatOverflowsBehaviour();
+   Double_t *binSumwy = fArray;
+   Double_t *binSumwy2 = fSumw2.fArray;
+   Double_t *binSumw = fBinEntries.fArray;
+   Double_t *binSumw2 = fBinSumw2.fN ? fBinSumw2.fArray : nullptr;
+   Double_t entries = 0, tsumw = 0, tsumw2 = 0, tsumwx = 0, tsumwx2 = 0, tsumwy = 0, tsumwy2 = 0;
+   const Int_t ntotal = (ntimes - ifirst + stride - 1) / stride;
+   for (Int_t start = 0; start < ntotal; start += kChunkSize) {
+      const Int_t n = std::min(kChunkSize, ntotal - start);
+      const Int_t offset = ifirst + start * stride;
+      fXaxis.FindFixBins(n, x + offset, bins, stride);
+      for (Int_t j = 0; j < n; ++j) {
+         const Int_t k = offset + j * stride;
+         const Double_t yk = y[k];
+         if (hasYRange && (yk <fYmin || yk> fYmax || TMath::IsNaN(yk))) continue;
+         const Double_t u = (w) ? w[k] : 1;
+         bin = bins[j];
+         entries++;
+         binSumwy[bin] += u*yk;
+         binSumwy2[bin] += u*yk*yk;
+         if (binSumw2) binSumw2[bin] += u*u;
+         binSumw[bin] += u;
+         if (!useStatOverflows && (bin == 0 || bin > nbins)) continue;
+         tsumw   += u;
+         tsumw2  += u*u;
+         tsumwx  += u*x[k];
+         tsumwx2 += u*x[k]*x[k];
+         tsumwy  += u*yk;
+         tsumwy2 += u*yk*yk;
       }
-      fTsumw   += u;
-      fTsumw2  += u*u;
-      fTsumwx  += u*x[i];
-      fTsumwx2 += u*x[i]*x[i];
-      fTsumwy  += u*y[i];
-      fTsumwy2 += u*y[i]*y[i];
    }
+   fEntries += entries;
+   fTsumw   += tsumw;
+   fTsumw2  += tsumw2;
+   fTsumwx  += tsumwx;
+   fTsumwx2 += tsumwx2;
+   fTsumwy  += tsumwy;
+   fTsumwy2 += tsumwy2;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1,9 +1,14 @@
 #include "gtest/gtest.h"
 
 #include "THn.h"
+#include "THnSparse.h"
 #include "TH1.h"
 #include "TH2.h"
 
+#include <algorithm>
+#include <set>
+#include <vector>
+
 // Filling THn
 TEST(THn, Fill) {
    Int_t bins[2] = {2, 3};
@@ -144,3 +149,37 @@ TEST(THn, GetBinCenter)
    EXPECT_DOUBLE_EQ(centers.at(0), 2.5);
    EXPECT_DOUBLE_EQ(centers.at(1), -1.5);
 }
+
+// Lookup of the filled bins of a THnSparse, with compact coordinates that fit into the hash or not
+TEST(THnSparse, GetBinAfterManyFills)
+{
+   for (Int_t dim : {2, 12}) {
+      std::vector<Int_t> bins(dim, 100);
+      std::vector<Double_t> xmin(dim, 0.);
+      std::vector<Double_t> xmax(dim, 1.);
+      THnSparseD hs("hs", "hs", dim, bins.data(), xmin.data(), xmax.data(), 64);
+      std::vector<std::vector<Int_t>> coords;
+      for (Int_t i = 0; i < 5000; ++i) {
+         std::vector<Int_t> coord(dim);
+         for (Int_t d = 0; d < dim; ++d)
+            coord[d] = 1 + (i * (d + 7) + (i / 100) * (d + 1)) % 100;
+         coords.push_back(coord);
+      }
+      for (Int_t pass = 0; pass < 2; ++pass) {
+         for (const auto &coord : coords)
+            hs.AddBinContent(coord.data(), 1.);
+      }
+      for (const auto &coord : coords) {
+         const Long64_t bin = hs.GetBin(coord.data());
+         ASSERT_GE(bin, 0);
+         std::vector<Int_t> binCoord(dim);
+         const Double_t content = hs.GetBinContent(bin, binCoord.data());
+         EXPECT_EQ(coord, binCoord);
+         EXPECT_EQ(2. * std::count(coords.begin(), coords.end(), coord), content);
+      }
+      EXPECT_EQ((Long64_t)std::set<std::vector<Int_t>>(coords.begin(), coords.end()).size(), hs.GetNbins());
+      std::vector<Int_t> notFilled(dim, 100);
+      notFilled[0] = 0;
+      EXPECT_EQ(-1, hs.GetBin(notFilled.data()));
+   }
+}
@@ -2,8 +2,17 @@
 
 #include "TH1.h"
 #include "TH1F.h"
+#include "TH1D.h"
+#include "TF1.h"
+#include "HFitInterface.h"
+#include "TRandom3.h"
 #include "THLimitsFinder.h"
+#include "TList.h"
+#include "TProfile.h"
 
+#include <cmath>
+#include <limits>
+#include <memory>
 #include <vector>
 
 // StatOverflows TH1
@@ -63,3 +72,130 @@ TEST(TH1, SmoothArrayCrossCheck)
       EXPECT_FLOAT_EQ(arr2[i], 1.0);
    }
 }
+
+// FillN finds the bins in chunks, check that it gives the same result as Fill
+TEST(TH1, FillNLikeFill)
+{
+   TRandom3 r(42);
+   const int n = 5000;
+   std::vector<double> x(2 * n), w(2 * n);
+   for (int i = 0; i < 2 * n; ++i) {
+      x[i] = r.Gaus(0, 2);
+      w[i] = r.Uniform(0.5, 1.5);
+   }
+   // values on the bin edges, on the axis limits and not a number
+   x[0] = -3.;
+   x[2] = 0.;
+   x[4] = 3.;
+   x[6] = std::numeric_limits<double>::quiet_NaN();
+
+   const double edges[] = {-3., -2., -1.5, -0.5, 0., 0.2, 1., 3.};
+   for (bool variableBins : {false, true}) {
+      for (bool weighted : {false, true}) {
+         TH1D h1("h1", "h1", 7, -3., 3.);
+         TH1D h2("h2", "h2", 7, -3., 3.);
+         if (variableBins) {
+            h1.SetBins(7, edges);
+            h2.SetBins(7, edges);
+         }
+         h1.FillN(n, x.data(), weighted ? w.data() : nullptr, 2);
+         for (int i = 0; i < 2 * n; i += 2)
+            h2.Fill(x[i], weighted ? w[i] : 1.);
+         for (int bin = 0; bin <= 8; ++bin) {
+            EXPECT_DOUBLE_EQ(h1.GetBinContent(bin), h2.GetBinContent(bin));
+            EXPECT_DOUBLE_EQ(h1.GetBinError(bin), h2.GetBinError(bin));
+         }
+         EXPECT_EQ(h1.GetEntries(), h2.GetEntries());
+         EXPECT_NEAR(h1.GetMean(), h2.GetMean(), 1.E-10);
+         EXPECT_NEAR(h1.GetStdDev(), h2.GetStdDev(), 1.E-10);
+      }
+   }
+}
+
+// TProfile::FillN finds the bins in chunks, check that it gives the same result as Fill
+TEST(TProfile, FillNLikeFill)
+{
+   TRandom3 rndm(3);
+   const int n = 3000;
+   std::vector<double> x(n), y(n), w(n);
+   for (int i = 0; i < n; ++i) {
+      x[i] = rndm.Uniform(-1.5, 1.5);
+      y[i] = rndm.Gaus(x[i], 1.);
+      w[i] = rndm.Uniform(0.5, 2.);
+   }
+   for (bool weighted : {false, true}) {
+      TProfile p1("p1", "p1", 10, -1., 1., -2., 2.);
+      TProfile p2("p2", "p2", 10, -1., 1., -2., 2.);
+      p1.FillN(n / 2, x.data(), y.data(), weighted ? w.data() : nullptr, 2);
+      for (int i = 0; i < n; i += 2)
+         p2.Fill(x[i], y[i], weighted ? w[i] : 1.);
+      for (int bin = 0; bin <= 11; ++bin) {
+         EXPECT_DOUBLE_EQ(p1.GetBinContent(bin), p2.GetBinContent(bin));
+         EXPECT_DOUBLE_EQ(p1.GetBinError(bin), p2.GetBinError(bin));
+         EXPECT_DOUBLE_EQ(p1.GetBinEntries(bin), p2.GetBinEntries(bin));
+      }
+      EXPECT_EQ(p1.GetEntries(), p2.GetEntries());
+      EXPECT_NEAR(p1.GetMean(2), p2.GetMean(2), 1.E-10);
+      EXPECT_NEAR(p1.GetStdDev(2), p2.GetStdDev(2), 1.E-10);
+   }
+}
+
+// Merge of histograms with same axes, over several ranges of bins
+TEST(TH1, MergeSameAxesLikeAdd)
+{
+   TRandom3 rndm(7);
+   TH1D hmerge("hmerge", "hmerge", 10000, -5., 5.);
+   TH1D hadd("hadd", "hadd", 10000, -5., 5.);
+   hmerge.Sumw2();
+   hadd.Sumw2();
+   TList inputs;
+   inputs.SetOwner();
+   for (int i = 0; i < 3; ++i) {
+      auto h = new TH1D(TString::Format("h%d", i), "h", 10000, -5., 5.);
+      h->SetDirectory(nullptr);
+      for (int j = 0; j < 20000; ++j)
+         h->Fill(rndm.Gaus(), rndm.Uniform());
+      hadd.Add(h);
+      inputs.Add(h);
+   }
+   hmerge.Merge(&inputs);
+   for (int bin = 0; bin <= 10001; ++bin) {
+      EXPECT_DOUBLE_EQ(hmerge.GetBinContent(bin), hadd.GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(hmerge.GetBinError(bin), hadd.GetBinError(bin));
+   }
+   EXPECT_EQ(hmerge.GetEntries(), hadd.GetEntries());
+   EXPECT_NEAR(hmerge.GetMean(), hadd.GetMean(), 1.E-10);
+}
+
+// Batch fit of many histograms gives the same results as fitting them one by one
+TEST(TH1, FitHistogramsLikeFit)
+{
+   TRandom3 rndm(11);
+   std::vector<std::unique_ptr<TH1D>> histos;
+   std::vector<TH1 *> hists;
+   for (int i = 0; i < 6; ++i) {
+      histos.emplace_back(new TH1D(TString::Format("hfit%d", i), "h", 50, -5., 5.));
+      histos.back()->SetDirectory(nullptr);
+      for (int j = 0; j < 2000; ++j)
+         histos.back()->Fill(rndm.Gaus(0.1 * i, 1. + 0.05 * i));
+      hists.push_back(histos.back().get());
+   }
+   histos.emplace_back(new TH1D("hempty", "h", 50, -5., 5.));
+   histos.back()->SetDirectory(nullptr);
+   hists.push_back(histos.back().get());
+
+   TF1 f1("fbatch", "gaus", -5., 5.);
+   f1.SetParameters(100., 0., 1.);
+   const auto results = ROOT::Fit::FitHistograms(hists, f1, "Q");
+   ASSERT_EQ(results.size(), hists.size());
+   EXPECT_DOUBLE_EQ(100., f1.GetParameter(0));
+   for (int i = 0; i < 6; ++i) {
+      TF1 fone("fone", "gaus", -5., 5.);
+      fone.SetParameters(100., 0., 1.);
+      hists[i]->Fit(&fone, "Q N 0");
+      ASSERT_TRUE(results[i].IsValid());
+      for (int ipar = 0; ipar < 3; ++ipar)
+         EXPECT_NEAR(results[i].Parameter(ipar), fone.GetParameter(ipar), 1.E-3 * std::abs(fone.GetParameter(ipar)) + 1.E-4);
+   }
+   EXPECT_TRUE(results.back().IsEmpty());
+}
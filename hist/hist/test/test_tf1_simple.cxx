@@ -46,4 +46,46 @@ TEST(TF1, PersistentNumber)
 
    res = h.Fit(f1_d.get(), "SQN");
    EXPECT_EQ(0, res->Status());
-}
\ No newline at end of file
+}
+// the VEC fit option evaluates a vectorized copy of the formula and gives the same result
+TEST(TF1, VectorizedFitOption)
+{
+   TH1F h("vecHist", "vecHist", 100, -4, 4);
+   h.FillRandom("gaus", 10000);
+   TF1 f1("f1vec", "[0]*exp(-0.5*((x-[1])/[2])^2)", -4, 4);
+   f1.SetParameters(100, 0.1, 1.2);
+   TF1 f2(f1);
+
+   auto res1 = h.Fit(&f1, "SQN SERIAL");
+   auto res2 = h.Fit(&f2, "SQN SERIAL VEC");
+   ASSERT_EQ(0, res1->Status());
+   ASSERT_EQ(0, res2->Status());
+   for (int i = 0; i < 3; ++i)
+      EXPECT_NEAR(f1.GetParameter(i), f2.GetParameter(i), 1e-4 * f1.GetParError(i));
+   EXPECT_FALSE(f2.IsVectorized());
+}
+
+// EvalBatch gives the same values as EvalPar, for formula-based and other functions
+TEST(TF1, EvalBatch)
+{
+   TF1 f1("f1batch", "[0]*exp(-0.5*((x-[1])/[2])^2) + [3]", -4, 4);
+   f1.SetParameters(2, 0.5, 1.5, 0.1);
+   TF1 f2("f2batch", [](double *x, double *p) { return p[0] * x[0] * x[0]; }, -4, 4, 1);
+   f2.SetParameter(0, 3);
+
+   const std::size_t n = 1000;
+   std::vector<double> x(n);
+   for (std::size_t i = 0; i < n; ++i)
+      x[i] = -4. + 8. * i / n;
+   std::vector<double> out(n);
+   const double params[4] = {1, -0.5, 0.7, 0.};
+
+   for (TF1 *f : {&f1, &f2}) {
+      f->EvalBatch(x, out);
+      for (std::size_t i = 0; i < n; ++i)
+         EXPECT_DOUBLE_EQ(out[i], f->EvalPar(&x[i]));
+   }
+   f1.EvalBatch(x, out, params);
+   for (std::size_t i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(out[i], f1.EvalPar(&x[i], params));
+}
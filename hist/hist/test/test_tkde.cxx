@@ -496,4 +496,38 @@ TEST(TKDE, tkde_io_mirror)
    for (size_t i = 0; i < t.xtest.size(); ++i) {
       EXPECT_NEAR(t.values1[i], t.values2[i], delta);
    }
-}
\ No newline at end of file
+}
+/// Evaluation tests
+/// In this test we compare the sum over the data within the kernel support with the sum over all the data
+TEST(TKDE, tkde_kernel_support)
+{
+   TRandom3 r(1111);
+   std::vector<double> data(1000);
+   for (auto &x : data)
+      x = r.Gaus(10, 2);
+   TKDE kde(data.size(), data.data(), 0., 20., "KernelType:Epanechnikov;Iteration:Fixed;Mirror:noMirror;Binning:Unbinned");
+   double h = kde.GetFixedWeight();
+   for (double x = 0.; x <= 20.; x += 0.5) {
+      double sum = 0;
+      for (auto xi : data) {
+         double u = (x - xi) / h;
+         if (std::abs(u) < 1.)
+            sum += 3. / 4. * (1. - u * u) / h;
+      }
+      EXPECT_NEAR(kde(x), sum / data.size(), 1.E-12);
+   }
+}
+
+TEST(TKDE, tkde_kernel_cutoff)
+{
+   TestKDE t;
+   t.n = 2000;
+   t.adaptive = true;
+   t.makePlot = false;
+   std::unique_ptr<TKDE> kde(t.Create());
+   // neglecting the contributions beyond 5 bandwidths changes each of them by less than exp(-12.5)
+   kde->SetKernelCutoff(5.);
+   for (size_t i = 0; i < t.xtest.size(); ++i) {
+      EXPECT_NEAR((*kde)(t.xtest[i]), t.values1[i], 1.E-5 * t.values1[i]);
+   }
+}
@@ -24,6 +24,8 @@
 #include "ROOT/RLogger.hxx"
 #include <initializer_list>
 #include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -139,6 +141,23 @@ public:
    /// Add `weight` to the bin containing coordinate `x`.
    void Fill(const CoordArray_t &x, Weight_t weight = (Weight_t)1) noexcept { (fImpl.get()->*fFillFunc)(x, weight); }
 
+   /// Add 1 to the bin containing the coordinates `x...`, one per dimension, or, if one more argument is passed,
+   /// add the last one as weight. This allows e.g. RDataFrame's `Fill()` action to fill an RHist from its columns.
+   template <class... ARGS, class = typename std::enable_if<(sizeof...(ARGS) == DIMENSIONS ||
+                                                            sizeof...(ARGS) == DIMENSIONS + 1) &&
+                                                           (... && std::is_arithmetic<ARGS>::value)>::type>
+   void Fill(ARGS... args) noexcept
+   {
+      const double values[] = {static_cast<double>(args)...};
+      CoordArray_t x;
+      for (int i = 0; i < DIMENSIONS; ++i)
+         x[i] = values[i];
+      if constexpr (sizeof...(ARGS) == DIMENSIONS)
+         Fill(x);
+      else
+         Fill(x, static_cast<Weight_t>(values[DIMENSIONS]));
+   }
+
    /// For each coordinate in `xN`, add `weightN[i]` to the bin at coordinate
    /// `xN[i]`. The sizes of `xN` and `weightN` must be the same. This is more
    /// efficient than many separate calls to `Fill()`.
@@ -178,6 +197,14 @@ public:
 
    const_iterator end() const { return const_iterator(*fImpl, fImpl->GetNBinsNoOver() + 1); }
 
+   /// Add the content of each of `others` to this histogram, see `Add()`. Needed to merge the partial results of
+   /// RDataFrame's `Fill()` action.
+   void Merge(const std::vector<RHist *> &others)
+   {
+      for (auto *other : others)
+         Add(*this, *other);
+   }
+
    /// Swap *this and other.
    ///
    /// Very efficient; swaps the `fImpl` pointers.
@@ -20,6 +20,8 @@
 #include <cctype>
 #include <functional>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 #include "ROOT/RSpan.hxx"
 
 #include "ROOT/RAxis.hxx"
@@ -736,6 +738,26 @@ public:
 private:
    std::tuple<AXISCONFIG...> fAxes; ///< The histogram's axes
 
+   /// Whether any of the axes can grow, known from the axis types.
+   static constexpr bool fgCanGrow = (... || std::is_base_of<RAxisGrow, AXISCONFIG>::value);
+
+   /// Get the bin index for the coordinates `x`, calling `FindBin()` and `GetNBinsNoOver()` on the concrete axis
+   /// types, which are `final` and thus resolved at compile time. Coordinates in regular bins on all axes (the common
+   /// case) directly get their row-major index; the others go through the general `ComputeGlobalBin()`.
+   template <std::size_t... I>
+   int FindGlobalBin(const CoordArray_t &x, std::index_sequence<I...>) const
+   {
+      BinArray_t localBins{{std::get<I>(fAxes).FindBin(x[I])...}};
+      if ((... && (localBins[I] >= 1))) {
+         int globalBin = 0;
+         int binSize = 1;
+         // the first axis runs fastest, as in ComputeGlobalBinRaw()
+         ((globalBin += (localBins[I] - 1) * binSize, binSize *= std::get<I>(fAxes).GetNBinsNoOver()), ...);
+         return globalBin + 1;
+      }
+      return ComputeGlobalBin<DATA::GetNDim()>(localBins);
+   }
+
 public:
    RHistImpl(TRootIOCtor *);
    RHistImpl(AXISCONFIG... axisArgs);
@@ -977,10 +999,7 @@ public:
    /// `ComputeGlobalBin()`.
    int GetBinIndex(const CoordArray_t &x) const final
    {
-      BinArray_t localBins = {};
-      Internal::RFindLocalBins<DATA::GetNDim() - 1, DATA::GetNDim(), BinArray_t, CoordArray_t, decltype(fAxes)>()(localBins, fAxes, x);
-      int result = ComputeGlobalBin<DATA::GetNDim()>(localBins);
-      return result;
+      return FindGlobalBin(x, std::index_sequence_for<AXISCONFIG...>{});
    }
 
    /// Get the bin index for the given coordinates `x`, growing the axes as needed.
@@ -992,10 +1011,8 @@ public:
    {
       Internal::EFindStatus status = Internal::EFindStatus::kCanGrow;
       int ret = 0;
-      BinArray_t localBins = {};
       while (status == Internal::EFindStatus::kCanGrow) {
-         Internal::RFindLocalBins<DATA::GetNDim() - 1, DATA::GetNDim(), BinArray_t, CoordArray_t, decltype(fAxes)>()(localBins, fAxes, x);
-         ret = ComputeGlobalBin<DATA::GetNDim()>(localBins);
+         ret = FindGlobalBin(x, std::index_sequence_for<AXISCONFIG...>{});
          status = Internal::EFindStatus::kValid;
       }
       return ret;
@@ -1076,7 +1093,7 @@ public:
    /// Add a single weight `w` to the bin at coordinate `x`.
    void Fill(const CoordArray_t &x, Weight_t w = 1.)
    {
-      int bin = GetBinIndexAndGrow(x);
+      int bin = fgCanGrow ? GetBinIndexAndGrow(x) : GetBinIndex(x);
       this->GetStat().Fill(x, bin, w);
    }
 
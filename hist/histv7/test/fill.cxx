@@ -629,3 +629,29 @@ TEST(HistFillTest, FillN3DCoordsWeightsUncertainty)
    EXPECT_FLOAT_EQ(std::sqrt(weight2 * weight2), hist.GetBinUncertainty({0.2222, 4.33, 7.11}));
    EXPECT_FLOAT_EQ(std::sqrt((weight3 * weight3) + (weight2 * weight2)), hist.GetBinUncertainty({0.3333, 4.11, 7.22}));
 }
+
+// Test Fill() with one argument per coordinate, and the bins of regular and under-/overflow coordinates
+TEST(HistFillTest, FillScalarCoords)
+{
+   ROOT::Experimental::RH2F hist({10, 0., 1.}, {{0., 1., 3., 7.}});
+   ROOT::Experimental::RH2F ref({10, 0., 1.}, {{0., 1., 3., 7.}});
+   for (double x : {-0.5, 0.05, 0.55, 0.95, 1.5}) {
+      for (double y : {-1., 0.5, 2., 6.9, 8.}) {
+         hist.Fill(x, y);
+         ref.Fill({x, y});
+         hist.Fill(x, y, .5f);
+         ref.Fill({x, y}, .5f);
+      }
+   }
+   for (double x : {-0.5, 0.05, 0.55, 0.95, 1.5}) {
+      for (double y : {-1., 0.5, 2., 6.9, 8.})
+         EXPECT_FLOAT_EQ(ref.GetBinContent({x, y}), hist.GetBinContent({x, y}));
+   }
+   EXPECT_FLOAT_EQ(1.5f, hist.GetBinContent({0.55, 2.}));
+   EXPECT_EQ(ref.GetEntries(), hist.GetEntries());
+
+   ROOT::Experimental::RH2F other({10, 0., 1.}, {{0., 1., 3., 7.}});
+   other.Fill(0.55, 2.);
+   hist.Merge({&other});
+   EXPECT_FLOAT_EQ(2.5f, hist.GetBinContent({0.55, 2.}));
+}
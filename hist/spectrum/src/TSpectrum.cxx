@@ -9,6 +9,8 @@
 #include "TMath.h"
 #include "snprintf.h"
 
+#include <algorithm>
+
 /** \class TSpectrum
     \ingroup Spectrum
     \brief Advanced Spectra Processing
@@ -508,8 +510,8 @@ const char *TSpectrum::Background(Double_t *spectrum, Int_t ssize,
                                           bool smoothing, Int_t smoothWindow,
                                           bool compton)
 {
-   int i, j, w, bw, b1, b2, priz;
-   Double_t a, b, c, d, e, yb1, yb2, ai, av, men, b4, c4, d4, e4, b6, c6, d6, e6, f6, g6, b8, c8, d8, e8, f8, g8, h8, i8;
+   int i, j, bw, b1, b2, priz;
+   Double_t a, b, c, d, e, yb1, yb2, ai, av, b4, c4, d4, e4, b6, c6, d6, e6, f6, g6, b8, c8, d8, e8, f8, g8, h8, i8;
    if (ssize <= 0)
       return "Wrong Parameters";
    if (numberIterations < 1)
@@ -518,18 +520,33 @@ const char *TSpectrum::Background(Double_t *spectrum, Int_t ssize,
       return "Too Large Clipping Window";
    if (smoothing == kTRUE && smoothWindow != kBackSmoothing3 && smoothWindow != kBackSmoothing5 && smoothWindow != kBackSmoothing7 && smoothWindow != kBackSmoothing9 && smoothWindow != kBackSmoothing11 && smoothWindow != kBackSmoothing13 && smoothWindow != kBackSmoothing15)
       return "Incorrect width of smoothing window";
-   Double_t *working_space = new Double_t[2 * ssize];
+   Double_t *working_space = new Double_t[(smoothing == kTRUE ? 3 : 2) * ssize];
    for (i = 0; i < ssize; i++){
       working_space[i] = spectrum[i];
       working_space[i + ssize] = spectrum[i];
    }
    bw=(smoothWindow-1)/2;
+   // averages of the current background over the smoothing window around each channel,
+   // computed once per iteration for all the clipping filters
+   Double_t *smoothed = working_space + 2 * ssize;
+   auto SmoothBackground = [&]() {
+      for (int k = 0; k < ssize; k++) {
+         Double_t sum = 0, nsum = 0;
+         for (int l = std::max(0, k - bw); l <= std::min(ssize - 1, k + bw); l++) {
+            sum += working_space[ssize + l];
+            nsum += 1;
+         }
+         smoothed[k] = sum / nsum;
+      }
+   };
    if (direction == kBackIncreasingWindow)
       i = 1;
    else if(direction == kBackDecreasingWindow)
       i = numberIterations;
    if (filterOrder == kBackOrder2) {
       do{
+         if (smoothing == kTRUE)
+            SmoothBackground();
          for (j = i; j < ssize - i; j++) {
             if (smoothing == kFALSE){
                a = working_space[ssize + j];
@@ -541,33 +558,9 @@ const char *TSpectrum::Background(Double_t *spectrum, Int_t ssize,
 
             else if (smoothing == kTRUE){
                a = working_space[ssize + j];
-               av = 0;
-               men = 0;
-               for (w = j - bw; w <= j + bw; w++){
-                  if ( w >= 0 && w < ssize){
-                     av += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               av = av / men;
-               b = 0;
-               men = 0;
-               for (w = j - i - bw; w <= j - i + bw; w++){
-                  if ( w >= 0 && w < ssize){
-                     b += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               b = b / men;
-               c = 0;
-               men = 0;
-               for (w = j + i - bw; w <= j + i + bw; w++){
-                  if ( w >= 0 && w < ssize){
-                     c += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               c = c / men;
+               av = smoothed[j];
+               b = smoothed[j - i];
+               c = smoothed[j + i];
                b = (b + c) / 2;
                if (b < a)
                   av = b;
@@ -585,6 +578,8 @@ const char *TSpectrum::Background(Double_t *spectrum, Int_t ssize,
 
    else if (filterOrder == kBackOrder4) {
       do{
+         if (smoothing == kTRUE)
+            SmoothBackground();
          for (j = i; j < ssize - i; j++) {
             if (smoothing == kFALSE){
                a = working_space[ssize + j];
@@ -604,67 +599,15 @@ const char *TSpectrum::Background(Double_t *spectrum, Int_t ssize,
 
             else if (smoothing == kTRUE){
                a = working_space[ssize + j];
-               av = 0;
-               men = 0;
-               for (w = j - bw; w <= j + bw; w++){
-                  if ( w >= 0 && w < ssize){
-                     av += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               av = av / men;
-               b = 0;
-               men = 0;
-               for (w = j - i - bw; w <= j - i + bw; w++){
-                  if ( w >= 0 && w < ssize){
-                     b += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               b = b / men;
-               c = 0;
-               men = 0;
-               for (w = j + i - bw; w <= j + i + bw; w++){
-                  if ( w >= 0 && w < ssize){
-                     c += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               c = c / men;
+               av = smoothed[j];
+               b = smoothed[j - i];
+               c = smoothed[j + i];
                b = (b + c) / 2;
                ai = i / 2;
-               b4 = 0, men = 0;
-               for (w = j - (Int_t)(2 * ai) - bw; w <= j - (Int_t)(2 * ai) + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     b4 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               b4 = b4 / men;
-               c4 = 0, men = 0;
-               for (w = j - (Int_t)ai - bw; w <= j - (Int_t)ai + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     c4 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               c4 = c4 / men;
-               d4 = 0, men = 0;
-               for (w = j + (Int_t)ai - bw; w <= j + (Int_t)ai + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     d4 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               d4 = d4 / men;
-               e4 = 0, men = 0;
-               for (w = j + (Int_t)(2 * ai) - bw; w <= j + (Int_t)(2 * ai) + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     e4 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               e4 = e4 / men;
+               b4 = smoothed[j - (Int_t)(2 * ai)];
+               c4 = smoothed[j - (Int_t)ai];
+               d4 = smoothed[j + (Int_t)ai];
+               e4 = smoothed[j + (Int_t)(2 * ai)];
                b4 = (-b4 + 4 * c4 + 4 * d4 - e4) / 6;
                if (b < b4)
                   b = b4;
@@ -684,6 +627,8 @@ const char *TSpectrum::Background(Double_t *spectrum, Int_t ssize,
 
    else if (filterOrder == kBackOrder6) {
       do{
+         if (smoothing == kTRUE)
+            SmoothBackground();
          for (j = i; j < ssize - i; j++) {
             if (smoothing == kFALSE){
                a = working_space[ssize + j];
@@ -713,117 +658,23 @@ const char *TSpectrum::Background(Double_t *spectrum, Int_t ssize,
 
             else if (smoothing == kTRUE){
                a = working_space[ssize + j];
-               av = 0;
-               men = 0;
-               for (w = j - bw; w <= j + bw; w++){
-                  if ( w >= 0 && w < ssize){
-                     av += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               av = av / men;
-               b = 0;
-               men = 0;
-               for (w = j - i - bw; w <= j - i + bw; w++){
-                  if ( w >= 0 && w < ssize){
-                     b += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               b = b / men;
-               c = 0;
-               men = 0;
-               for (w = j + i - bw; w <= j + i + bw; w++){
-                  if ( w >= 0 && w < ssize){
-                     c += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               c = c / men;
+               av = smoothed[j];
+               b = smoothed[j - i];
+               c = smoothed[j + i];
                b = (b + c) / 2;
                ai = i / 2;
-               b4 = 0, men = 0;
-               for (w = j - (Int_t)(2 * ai) - bw; w <= j - (Int_t)(2 * ai) + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     b4 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               b4 = b4 / men;
-               c4 = 0, men = 0;
-               for (w = j - (Int_t)ai - bw; w <= j - (Int_t)ai + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     c4 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               c4 = c4 / men;
-               d4 = 0, men = 0;
-               for (w = j + (Int_t)ai - bw; w <= j + (Int_t)ai + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     d4 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               d4 = d4 / men;
-               e4 = 0, men = 0;
-               for (w = j + (Int_t)(2 * ai) - bw; w <= j + (Int_t)(2 * ai) + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     e4 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               e4 = e4 / men;
+               b4 = smoothed[j - (Int_t)(2 * ai)];
+               c4 = smoothed[j - (Int_t)ai];
+               d4 = smoothed[j + (Int_t)ai];
+               e4 = smoothed[j + (Int_t)(2 * ai)];
                b4 = (-b4 + 4 * c4 + 4 * d4 - e4) / 6;
                ai = i / 3;
-               b6 = 0, men = 0;
-               for (w = j - (Int_t)(3 * ai) - bw; w <= j - (Int_t)(3 * ai) + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     b6 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               b6 = b6 / men;
-               c6 = 0, men = 0;
-               for (w = j - (Int_t)(2 * ai) - bw; w <= j - (Int_t)(2 * ai) + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     c6 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               c6 = c6 / men;
-               d6 = 0, men = 0;
-               for (w = j - (Int_t)ai - bw; w <= j - (Int_t)ai + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     d6 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               d6 = d6 / men;
-               e6 = 0, men = 0;
-               for (w = j + (Int_t)ai - bw; w <= j + (Int_t)ai + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     e6 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               e6 = e6 / men;
-               f6 = 0, men = 0;
-               for (w = j + (Int_t)(2 * ai) - bw; w <= j + (Int_t)(2 * ai) + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     f6 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               f6 = f6 / men;
-               g6 = 0, men = 0;
-               for (w = j + (Int_t)(3 * ai) - bw; w <= j + (Int_t)(3 * ai) + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     g6 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               g6 = g6 / men;
+               b6 = smoothed[j - (Int_t)(3 * ai)];
+               c6 = smoothed[j - (Int_t)(2 * ai)];
+               d6 = smoothed[j - (Int_t)ai];
+               e6 = smoothed[j + (Int_t)ai];
+               f6 = smoothed[j + (Int_t)(2 * ai)];
+               g6 = smoothed[j + (Int_t)(3 * ai)];
                b6 = (b6 - 6 * c6 + 15 * d6 + 15 * e6 - 6 * f6 + g6) / 20;
                if (b < b6)
                   b = b6;
@@ -845,6 +696,8 @@ const char *TSpectrum::Background(Double_t *spectrum, Int_t ssize,
 
    else if (filterOrder == kBackOrder8) {
       do{
+         if (smoothing == kTRUE)
+            SmoothBackground();
          for (j = i; j < ssize - i; j++) {
             if (smoothing == kFALSE){
                a = working_space[ssize + j];
@@ -886,183 +739,33 @@ const char *TSpectrum::Background(Double_t *spectrum, Int_t ssize,
 
             else if (smoothing == kTRUE){
                a = working_space[ssize + j];
-               av = 0;
-               men = 0;
-               for (w = j - bw; w <= j + bw; w++){
-                  if ( w >= 0 && w < ssize){
-                     av += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               av = av / men;
-               b = 0;
-               men = 0;
-               for (w = j - i - bw; w <= j - i + bw; w++){
-                  if ( w >= 0 && w < ssize){
-                     b += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               b = b / men;
-               c = 0;
-               men = 0;
-               for (w = j + i - bw; w <= j + i + bw; w++){
-                  if ( w >= 0 && w < ssize){
-                     c += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               c = c / men;
+               av = smoothed[j];
+               b = smoothed[j - i];
+               c = smoothed[j + i];
                b = (b + c) / 2;
                ai = i / 2;
-               b4 = 0, men = 0;
-               for (w = j - (Int_t)(2 * ai) - bw; w <= j - (Int_t)(2 * ai) + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     b4 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               b4 = b4 / men;
-               c4 = 0, men = 0;
-               for (w = j - (Int_t)ai - bw; w <= j - (Int_t)ai + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     c4 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               c4 = c4 / men;
-               d4 = 0, men = 0;
-               for (w = j + (Int_t)ai - bw; w <= j + (Int_t)ai + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     d4 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               d4 = d4 / men;
-               e4 = 0, men = 0;
-               for (w = j + (Int_t)(2 * ai) - bw; w <= j + (Int_t)(2 * ai) + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     e4 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               e4 = e4 / men;
+               b4 = smoothed[j - (Int_t)(2 * ai)];
+               c4 = smoothed[j - (Int_t)ai];
+               d4 = smoothed[j + (Int_t)ai];
+               e4 = smoothed[j + (Int_t)(2 * ai)];
                b4 = (-b4 + 4 * c4 + 4 * d4 - e4) / 6;
                ai = i / 3;
-               b6 = 0, men = 0;
-               for (w = j - (Int_t)(3 * ai) - bw; w <= j - (Int_t)(3 * ai) + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     b6 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               b6 = b6 / men;
-               c6 = 0, men = 0;
-               for (w = j - (Int_t)(2 * ai) - bw; w <= j - (Int_t)(2 * ai) + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     c6 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               c6 = c6 / men;
-               d6 = 0, men = 0;
-               for (w = j - (Int_t)ai - bw; w <= j - (Int_t)ai + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     d6 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               d6 = d6 / men;
-               e6 = 0, men = 0;
-               for (w = j + (Int_t)ai - bw; w <= j + (Int_t)ai + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     e6 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               e6 = e6 / men;
-               f6 = 0, men = 0;
-               for (w = j + (Int_t)(2 * ai) - bw; w <= j + (Int_t)(2 * ai) + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     f6 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               f6 = f6 / men;
-               g6 = 0, men = 0;
-               for (w = j + (Int_t)(3 * ai) - bw; w <= j + (Int_t)(3 * ai) + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     g6 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               g6 = g6 / men;
+               b6 = smoothed[j - (Int_t)(3 * ai)];
+               c6 = smoothed[j - (Int_t)(2 * ai)];
+               d6 = smoothed[j - (Int_t)ai];
+               e6 = smoothed[j + (Int_t)ai];
+               f6 = smoothed[j + (Int_t)(2 * ai)];
+               g6 = smoothed[j + (Int_t)(3 * ai)];
                b6 = (b6 - 6 * c6 + 15 * d6 + 15 * e6 - 6 * f6 + g6) / 20;
                ai = i / 4;
-               b8 = 0, men = 0;
-               for (w = j - (Int_t)(4 * ai) - bw; w <= j - (Int_t)(4 * ai) + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     b8 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               b8 = b8 / men;
-               c8 = 0, men = 0;
-               for (w = j - (Int_t)(3 * ai) - bw; w <= j - (Int_t)(3 * ai) + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     c8 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               c8 = c8 / men;
-               d8 = 0, men = 0;
-               for (w = j - (Int_t)(2 * ai) - bw; w <= j - (Int_t)(2 * ai) + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     d8 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               d8 = d8 / men;
-               e8 = 0, men = 0;
-               for (w = j - (Int_t)ai - bw; w <= j - (Int_t)ai + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     e8 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               e8 = e8 / men;
-               f8 = 0, men = 0;
-               for (w = j + (Int_t)ai - bw; w <= j + (Int_t)ai + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     f8 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               f8 = f8 / men;
-               g8 = 0, men = 0;
-               for (w = j + (Int_t)(2 * ai) - bw; w <= j + (Int_t)(2 * ai) + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     g8 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               g8 = g8 / men;
-               h8 = 0, men = 0;
-               for (w = j + (Int_t)(3 * ai) - bw; w <= j + (Int_t)(3 * ai) + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     h8 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               h8 = h8 / men;
-               i8 = 0, men = 0;
-               for (w = j + (Int_t)(4 * ai) - bw; w <= j + (Int_t)(4 * ai) + bw; w++){
-                  if (w >= 0 && w < ssize){
-                     i8 += working_space[ssize + w];
-                     men +=1;
-                  }
-               }
-               i8 = i8 / men;
+               b8 = smoothed[j - (Int_t)(4 * ai)];
+               c8 = smoothed[j - (Int_t)(3 * ai)];
+               d8 = smoothed[j - (Int_t)(2 * ai)];
+               e8 = smoothed[j - (Int_t)ai];
+               f8 = smoothed[j + (Int_t)ai];
+               g8 = smoothed[j + (Int_t)(2 * ai)];
+               h8 = smoothed[j + (Int_t)(3 * ai)];
+               i8 = smoothed[j + (Int_t)(4 * ai)];
                b8 = ( -b8 + 8 * c8 - 28 * d8 + 56 * e8 - 56 * f8 - 28 * g8 + 8 * h8 - i8)/70;
                if (b < b8)
                   b = b8;
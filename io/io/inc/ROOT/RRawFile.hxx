@@ -14,6 +14,7 @@
 
 #include <string_view>
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -52,6 +53,10 @@ public:
       ELineBreaks fLineBreak = ELineBreaks::kAuto;
       /// Read at least fBlockSize bytes at a time. A value of zero turns off I/O buffering.
       size_t fBlockSize = kUseDefaultBlockSize;
+      /// If supported by the implementation and the file, map the whole file into memory on opening. Reads are then
+      /// served from the page cache without system calls and block buffering, and GetMappedRange() gives access to
+      /// the file content without any copy.
+      bool fUseMmap = false;
       // Define an empty constructor to work around a bug in Clang: https://github.com/llvm/llvm-project/issues/36032
       ROptions() {}
    };
@@ -87,6 +92,28 @@ public:
       }
    };
 
+   /// Statistics of the reads issued through ReadAt() and ReadV(), which can be queried through GetIOStats()
+   struct RIOStats {
+      static constexpr unsigned int kNLatencyBins = 24;
+      /// Number of ReadAt() calls, including those from Read() and Readln()
+      std::uint64_t fNReadAt = 0;
+      /// Number of ReadAt() calls that were fully served from the block buffers
+      std::uint64_t fNBufferHits = 0;
+      /// Number of ReadV() calls
+      std::uint64_t fNReadV = 0;
+      /// Sum of the number of requests of all the ReadV() calls
+      std::uint64_t fNReadVRequests = 0;
+      /// Number of bytes returned by ReadAt() and ReadV()
+      std::uint64_t fBytesRead = 0;
+      /// Wall-clock time spent in ReadAt() and ReadV()
+      std::uint64_t fTimeReadNs = 0;
+      /// Latency histogram of ReadAt() and ReadV(): bin i counts the calls of less than 2^i microseconds that are
+      /// not in a lower bin; the last bin also counts all the slower calls
+      std::array<std::uint64_t, kNLatencyBins> fLatencyHisto{};
+
+      void AddRead(std::uint64_t nbytes, std::uint64_t timeNs);
+   };
+
 private:
    /// Don't change without adapting ReadAt()
    static constexpr unsigned int kNumBlockBuffers = 2;
@@ -120,6 +147,11 @@ private:
    bool fIsOpen = false;
    /// Runtime switch to decide if reads are buffered or directly sent to ReadAtImpl()
    bool fIsBuffering = true;
+   /// Set during ReadV() so that the ReadAt() calls of the default ReadVImpl() are not counted twice
+   bool fIsInReadV = false;
+   RIOStats fIOStats;
+
+   size_t ReadAtBuffered(void *buffer, size_t nbytes, std::uint64_t offset);
 
 protected:
    std::string fUrl;
@@ -139,6 +171,9 @@ protected:
 
    /// By default implemented as a loop of ReadAt calls but can be overwritten, e.g. XRootD or DAVIX implementations
    virtual void ReadVImpl(RIOVec *ioVec, unsigned int nReq);
+   /// Derived classes that support memory mapping return a pointer to the mapped file content at offset, provided
+   /// that nbytes bytes are available from there, and nullptr otherwise
+   virtual const unsigned char *GetMappedRangeImpl(std::uint64_t /* offset */, size_t /* nbytes */) { return nullptr; }
 
    /// Open the file if not already open. Otherwise noop.
    void EnsureOpen();
@@ -175,6 +210,11 @@ public:
 
    /// Opens the file if necessary and calls ReadVImpl
    void ReadV(RIOVec *ioVec, unsigned int nReq);
+   /// Returns a pointer to the nbytes bytes of the file starting at offset, valid as long as this object, if the file
+   /// is memory mapped (see ROptions::fUseMmap) and the range is within the file; nullptr otherwise.
+   const unsigned char *GetMappedRange(std::uint64_t offset, size_t nbytes);
+   /// Returns the statistics of the reads so far
+   const RIOStats &GetIOStats() const { return fIOStats; }
    /// Returns the limits regarding the ioVec input to ReadV for this specific file; may open the file as a side-effect.
    virtual RIOVecLimits GetReadVLimits() { return RIOVecLimits(); }
 
@@ -0,0 +1,79 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RRawFileCache
+#define ROOT_RRawFileCache
+
+#include <ROOT/RRawFile.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace ROOT {
+namespace Internal {
+
+/**
+ * \class RRawFileCache RRawFileCache.hxx
+ * \ingroup IO
+ *
+ * The RRawFileCache is a read-through cache on the local file system for another, typically remote, RRawFile.
+ * The file is divided into blocks of fixed size. Every block that is read from the wrapped file is stored as a
+ * file of its own in the cache directory, named after the URL and the size of the wrapped file and the index of the
+ * block, and subsequent reads of the block are served from the cache. Only the blocks that are actually read are
+ * transferred, which suits sparse access patterns.
+ *
+ * The cache directory can be shared by concurrent processes: blocks are written to temporary files that are
+ * atomically renamed into place. Every access to a cached block updates its modification time, and when the total
+ * size of the cached blocks grows beyond the given maximum, the least recently used blocks are removed.
+ *
+ * RRawFile::Create() wraps remote files into an RRawFileCache if the RRawFile.CacheDir rootrc variable is set; the
+ * maximum size of the cache is given in MiB by RRawFile.CacheSize (10 GiB by default).
+ */
+class RRawFileCache : public RRawFile {
+public:
+   static constexpr std::uint64_t kCacheBlockSize = 1024 * 1024;
+
+private:
+   std::unique_ptr<RRawFile> fRemote;
+   std::string fCacheDir;
+   std::uint64_t fMaxCacheSize;
+   /// A hash of the URL and of the size of the remote file, used as prefix of the names of its blocks
+   std::string fKey;
+   std::uint64_t fRemoteSize = 0;
+
+   std::uint64_t GetBlockSize(std::uint64_t blockIdx) const;
+   std::string GetBlockPath(std::uint64_t blockIdx) const;
+   /// Returns true if the block is complete in the cache; marks it as recently used
+   bool IsCached(std::uint64_t blockIdx) const;
+   /// Reads nbytes at offsetInBlock in a cached block, returns false if the block is not available anymore
+   bool ReadFromCache(std::uint64_t blockIdx, void *buffer, size_t nbytes, std::uint64_t offsetInBlock) const;
+   void StoreInCache(std::uint64_t blockIdx, const unsigned char *data) const;
+   /// Removes the least recently used blocks of all the files in the cache directory until the cache does not
+   /// exceed its maximum size anymore
+   void Evict() const;
+
+protected:
+   void OpenImpl() final;
+   size_t ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset) final;
+   void ReadVImpl(RIOVec *ioVec, unsigned int nReq) final;
+   std::uint64_t GetSizeImpl() final;
+
+public:
+   RRawFileCache(std::unique_ptr<RRawFile> remote, const std::string &cacheDir, std::uint64_t maxCacheSize,
+                 ROptions options);
+   std::unique_ptr<RRawFile> Clone() const final;
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
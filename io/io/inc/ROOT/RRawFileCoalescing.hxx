@@ -0,0 +1,61 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RRawFileCoalescing
+#define ROOT_RRawFileCoalescing
+
+#include <ROOT/RRawFile.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace ROOT {
+namespace Internal {
+
+/**
+ * \class RRawFileCoalescing RRawFileCoalescing.hxx
+ * \ingroup IO
+ *
+ * The RRawFileCoalescing wraps another, typically remote, RRawFile and merges the requests of a vector read that are
+ * close to each other into larger ranges before passing them on. Requests are merged if the gap between them is at
+ * most the given maximum gap and if the merged range does not grow beyond the given maximum range size, nor beyond
+ * the limits of the wrapped file. The bytes in the gaps are read into a scratch buffer and discarded. This trades a
+ * little extra transferred data for fewer round trips, which pays off for the many small pages of RNTuple clusters.
+ *
+ * Scalar reads are passed on to the wrapped file, which does the buffering.
+ *
+ * RRawFile::Create() wraps remote files into an RRawFileCoalescing. The thresholds are given by the
+ * RRawFile.ReadV.MaxGap (64 KiB by default) and RRawFile.ReadV.MaxRangeSize (16 MiB by default) rootrc variables;
+ * a maximum range size of zero turns off the coalescing.
+ */
+class RRawFileCoalescing : public RRawFile {
+private:
+   std::unique_ptr<RRawFile> fRemote;
+   std::uint64_t fMaxGap;
+   std::uint64_t fMaxRangeSize;
+
+protected:
+   void OpenImpl() final;
+   size_t ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset) final;
+   void ReadVImpl(RIOVec *ioVec, unsigned int nReq) final;
+   std::uint64_t GetSizeImpl() final;
+
+public:
+   RRawFileCoalescing(std::unique_ptr<RRawFile> remote, std::uint64_t maxGap, std::uint64_t maxRangeSize,
+                      ROptions options);
+   std::unique_ptr<RRawFile> Clone() const final;
+   RIOVecLimits GetReadVLimits() final { return fRemote->GetReadVLimits(); }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
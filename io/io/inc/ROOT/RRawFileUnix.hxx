@@ -26,17 +26,23 @@ namespace Internal {
  * \ingroup IO
  *
  * The RRawFileUnix class uses POSIX calls to read from a mounted file system. Thus the path name can refer,
- * for instance, to a named pipe instead of a regular file.
+ * for instance, to a named pipe instead of a regular file. Regular files can optionally be memory mapped.
  */
 class RRawFileUnix : public RRawFile {
 private:
    int fFileDes = -1;
+   /// The read-only mapping of the whole file if ROptions::fUseMmap is set and the file could be mapped
+   unsigned char *fMapping = nullptr;
+   std::uint64_t fMappingSize = 0;
+
+   void MapFile();
 
 protected:
    void OpenImpl() final;
    size_t ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset) final;
    void ReadVImpl(RIOVec *ioVec, unsigned int nReq) final;
    std::uint64_t GetSizeImpl() final;
+   const unsigned char *GetMappedRangeImpl(std::uint64_t offset, size_t nbytes) final;
 
 public:
    RRawFileUnix(std::string_view url, RRawFile::ROptions options);
@@ -16,10 +16,13 @@
 #include "TMemFile.h"
 #include "ROOT/RConfig.hxx"
 
+#include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <vector>
 
 namespace ROOT {
 
@@ -36,6 +39,12 @@ class TBufferMergerFile;
  * socket, TBufferMerger uses threads that each write to a
  * TBufferMergerFile, which in turn push data into a queue
  * managed by the TBufferMerger.
+ *
+ * The baskets are compressed by the writing threads. Writes that arrive
+ * while a merge is in progress are coalesced: the thread that performs the
+ * next merge takes all files waiting at that moment and merges them in a
+ * single pass, in no particular order. With SetMergeOptions("fast"), the
+ * compressed baskets are copied to the output without being unzipped.
  */
 
 class TBufferMerger {
@@ -77,6 +86,17 @@ public:
    _R__DEPRECATED_LATER("The queuing mechanism in TBufferMerger was removed in ROOT v6.32")
    size_t GetAutoSave() const { return 0; }
 
+   /** Writes an object directly into the output file; can be called concurrently from many threads.
+    *  The object is streamed and compressed by the calling thread, only the copy of the compressed
+    *  record into the output file is serialized with the other writes and merges. Unlike writing the
+    *  object to a TBufferMergerFile, an object with the same name in the output is not merged with
+    *  it: a new cycle is written instead.
+    * @param obj Object to write
+    * @param name Name of the key, the object name if null
+    * @return Number of bytes written by the calling thread, 0 in case of error
+    */
+   Int_t WriteTObject(const TObject *obj, const char *name = nullptr);
+
    /** Returns the current merge options. */
    const char* GetMergeOptions();
 
@@ -128,6 +148,12 @@ private:
 
    TFileMerger fMerger{false, false};                            //< TFileMerger used to merge all buffers
    std::mutex fMergeMutex;                                       //< Mutex used to lock fMerger
+   std::mutex fQueueMutex;                                       //< Mutex protecting the merge queue below
+   std::condition_variable fMergeDone;                           //< Signaled when a batch of files has been merged
+   std::vector<TBufferMergerFile *> fMergeQueue;                 //< Files waiting for the next merge
+   std::uint64_t fNQueued{0};                                    //< Number of files queued so far
+   std::uint64_t fNMerged{0};                                    //< Number of queued files merged so far
+   bool fMerging{false};                                         //< True while a thread merges a batch
    std::vector<std::weak_ptr<TBufferMergerFile>> fAttachedFiles; //< Attached files
 };
 
@@ -86,6 +86,7 @@ protected:
            Int_t       GetNbytes() const   {return fNbytes;}
            Int_t       GetObjlen() const   {return fObjlen;}
            Int_t       GetVersion() const  {return fVersion;}
+           Bool_t      HasSameObjectBytes(TKey &other);
    virtual Long64_t    GetSeekKey() const  {return fSeekKey;}
    virtual Long64_t    GetSeekPdir() const {return fSeekPdir;}
    virtual void        IncrementPidOffset(UShort_t offset);
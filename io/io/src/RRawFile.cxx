@@ -11,18 +11,22 @@
 
 #include <ROOT/RConfig.h>
 #include <ROOT/RRawFile.hxx>
+#include <ROOT/RRawFileCache.hxx>
+#include <ROOT/RRawFileCoalescing.hxx>
 #ifdef _WIN32
 #include <ROOT/RRawFileWin.hxx>
 #else
 #include <ROOT/RRawFileUnix.hxx>
 #endif
 
+#include "TEnv.h"
 #include "TError.h"
 #include "TPluginManager.h"
 #include "TROOT.h"
 
 #include <algorithm>
 #include <cctype> // for towlower
+#include <chrono>
 #include <cerrno>
 #include <cstddef>
 #include <cstdint>
@@ -72,13 +76,27 @@ ROOT::Internal::RRawFile::Create(std::string_view url, ROptions options)
 #endif
    }
    if (transport == "http" || transport == "https" ||
-       transport == "root" || transport == "roots" ) {
-      std::string plgclass = transport.compare( 0, 4, "http" ) == 0 ?
+       transport == "root" || transport == "roots" ||
+       transport == "s3" || transport == "s3s" ) {
+      const bool isS3 = transport.compare( 0, 2, "s3" ) == 0;
+      std::string plgclass = (isS3 || transport.compare( 0, 4, "http" ) == 0) ?
                              "RRawFileDavix" : "RRawFileNetXNG";
+      // Davix handles S3 URLs itself, the plugin is the one for https
+      const std::string plgurl = isS3 ? "https" + std::string(url.substr(transport.length())) : std::string(url);
       if (TPluginHandler *h = gROOT->GetPluginManager()->
-          FindHandler("ROOT::Internal::RRawFile", std::string(url).c_str())) {
+          FindHandler("ROOT::Internal::RRawFile", plgurl.c_str())) {
          if (h->LoadPlugin() == 0) {
-            return std::unique_ptr<RRawFile>(reinterpret_cast<RRawFile *>(h->ExecPlugin(2, &url, &options)));
+            std::unique_ptr<RRawFile> remote(reinterpret_cast<RRawFile *>(h->ExecPlugin(2, &url, &options)));
+            const std::uint64_t maxRangeSize = gEnv->GetValue("RRawFile.ReadV.MaxRangeSize", 16 * 1024 * 1024);
+            if (maxRangeSize > 0) {
+               const std::uint64_t maxGap = gEnv->GetValue("RRawFile.ReadV.MaxGap", 64 * 1024);
+               remote = std::make_unique<RRawFileCoalescing>(std::move(remote), maxGap, maxRangeSize, options);
+            }
+            const std::string cacheDir = gEnv->GetValue("RRawFile.CacheDir", "");
+            if (cacheDir.empty())
+               return remote;
+            const std::uint64_t cacheSizeMiB = gEnv->GetValue("RRawFile.CacheSize", 10240);
+            return std::make_unique<RRawFileCache>(std::move(remote), cacheDir, cacheSizeMiB * 1024 * 1024, options);
          }
          throw std::runtime_error("Cannot load plugin handler for " + plgclass);
       }
@@ -142,6 +160,16 @@ size_t ROOT::Internal::RRawFile::Read(void *buffer, size_t nbytes)
    return res;
 }
 
+void ROOT::Internal::RRawFile::RIOStats::AddRead(std::uint64_t nbytes, std::uint64_t timeNs)
+{
+   fBytesRead += nbytes;
+   fTimeReadNs += timeNs;
+   unsigned int bin = 0;
+   for (auto timeUs = timeNs / 1000; timeUs > 0 && bin < kNLatencyBins - 1; timeUs >>= 1)
+      ++bin;
+   ++fLatencyHisto[bin];
+}
+
 size_t ROOT::Internal::RRawFile::ReadAt(void *buffer, size_t nbytes, std::uint64_t offset)
 {
    EnsureOpen();
@@ -150,6 +178,19 @@ size_t ROOT::Internal::RRawFile::ReadAt(void *buffer, size_t nbytes, std::uint64
    if (nbytes == 0)
       return 0;
 
+   if (fIsInReadV)
+      return ReadAtBuffered(buffer, nbytes, offset);
+
+   const auto start = std::chrono::steady_clock::now();
+   const auto res = ReadAtBuffered(buffer, nbytes, offset);
+   const auto end = std::chrono::steady_clock::now();
+   fIOStats.fNReadAt++;
+   fIOStats.AddRead(res, std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+   return res;
+}
+
+size_t ROOT::Internal::RRawFile::ReadAtBuffered(void *buffer, size_t nbytes, std::uint64_t offset)
+{
    // "Large" reads are served directly, bypassing the cache; since nbytes > 0, fBlockSize == 0 is also handled here
    if (!fIsBuffering || nbytes > static_cast<unsigned int>(fOptions.fBlockSize))
       return ReadAtImpl(buffer, nbytes, offset);
@@ -173,8 +214,11 @@ size_t ROOT::Internal::RRawFile::ReadAt(void *buffer, size_t nbytes, std::uint64
       totalBytes += copiedBytes;
       if (copiedBytes > 0)
          fBlockBufferIdx = idx;
-      if (nbytes == 0)
+      if (nbytes == 0) {
+         if (!fIsInReadV)
+            fIOStats.fNBufferHits++;
          return totalBytes;
+      }
    }
    fBlockBufferIdx++;
 
@@ -194,7 +238,30 @@ size_t ROOT::Internal::RRawFile::ReadAt(void *buffer, size_t nbytes, std::uint64
 void ROOT::Internal::RRawFile::ReadV(RIOVec *ioVec, unsigned int nReq)
 {
    EnsureOpen();
-   ReadVImpl(ioVec, nReq);
+
+   const auto start = std::chrono::steady_clock::now();
+   fIsInReadV = true;
+   try {
+      ReadVImpl(ioVec, nReq);
+   } catch (...) {
+      fIsInReadV = false;
+      throw;
+   }
+   fIsInReadV = false;
+   const auto end = std::chrono::steady_clock::now();
+
+   std::uint64_t nbytes = 0;
+   for (unsigned int i = 0; i < nReq; ++i)
+      nbytes += ioVec[i].fOutBytes;
+   fIOStats.fNReadV++;
+   fIOStats.fNReadVRequests += nReq;
+   fIOStats.AddRead(nbytes, std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+const unsigned char *ROOT::Internal::RRawFile::GetMappedRange(std::uint64_t offset, size_t nbytes)
+{
+   EnsureOpen();
+   return GetMappedRangeImpl(offset, nbytes);
 }
 
 void ROOT::Internal::RRawFile::SetBuffering(bool value)
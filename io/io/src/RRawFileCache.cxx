@@ -0,0 +1,249 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RRawFileCache.hxx>
+
+#include "TSystem.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace {
+constexpr size_t kDefaultBlockSize = 128 * 1024; // Buffer small reads, like the local file implementations
+const char *kBlockFileSuffix = ".blk";
+
+/// FNV-1a, which, unlike std::hash, gives the same value in all the processes sharing the cache directory
+std::uint64_t HashString(const std::string &str)
+{
+   std::uint64_t hash = 14695981039346656037ull;
+   for (unsigned char c : str) {
+      hash ^= c;
+      hash *= 1099511628211ull;
+   }
+   return hash;
+}
+} // anonymous namespace
+
+ROOT::Internal::RRawFileCache::RRawFileCache(std::unique_ptr<RRawFile> remote, const std::string &cacheDir,
+                                             std::uint64_t maxCacheSize, ROptions options)
+   : RRawFile(remote->GetUrl(), options), fRemote(std::move(remote)), fCacheDir(cacheDir), fMaxCacheSize(maxCacheSize)
+{
+}
+
+std::unique_ptr<ROOT::Internal::RRawFile> ROOT::Internal::RRawFileCache::Clone() const
+{
+   return std::make_unique<RRawFileCache>(fRemote->Clone(), fCacheDir, fMaxCacheSize, fOptions);
+}
+
+void ROOT::Internal::RRawFileCache::OpenImpl()
+{
+   fRemoteSize = fRemote->GetSize();
+   char key[17];
+   snprintf(key, sizeof(key), "%016llx",
+            static_cast<unsigned long long>(HashString(fUrl + '\n' + std::to_string(fRemoteSize))));
+   fKey = key;
+   if (gSystem->AccessPathName(fCacheDir.c_str()))
+      gSystem->mkdir(fCacheDir.c_str(), kTRUE);
+   if (fOptions.fBlockSize == ROptions::kUseDefaultBlockSize)
+      fOptions.fBlockSize = kDefaultBlockSize;
+}
+
+std::uint64_t ROOT::Internal::RRawFileCache::GetSizeImpl()
+{
+   return fRemoteSize;
+}
+
+std::uint64_t ROOT::Internal::RRawFileCache::GetBlockSize(std::uint64_t blockIdx) const
+{
+   return std::min(kCacheBlockSize, fRemoteSize - blockIdx * kCacheBlockSize);
+}
+
+std::string ROOT::Internal::RRawFileCache::GetBlockPath(std::uint64_t blockIdx) const
+{
+   return fCacheDir + "/" + fKey + "-" + std::to_string(blockIdx) + kBlockFileSuffix;
+}
+
+bool ROOT::Internal::RRawFileCache::IsCached(std::uint64_t blockIdx) const
+{
+   const auto path = GetBlockPath(blockIdx);
+   FileStat_t stat;
+   if (gSystem->GetPathInfo(path.c_str(), stat) != 0 ||
+       static_cast<std::uint64_t>(stat.fSize) != GetBlockSize(blockIdx))
+      return false;
+   const auto now = static_cast<Long_t>(time(nullptr));
+   gSystem->Utime(path.c_str(), now, now);
+   return true;
+}
+
+bool ROOT::Internal::RRawFileCache::ReadFromCache(std::uint64_t blockIdx, void *buffer, size_t nbytes,
+                                                  std::uint64_t offsetInBlock) const
+{
+   std::ifstream block(GetBlockPath(blockIdx), std::ios::binary);
+   if (!block.seekg(offsetInBlock))
+      return false;
+   block.read(static_cast<char *>(buffer), nbytes);
+   return static_cast<size_t>(block.gcount()) == nbytes;
+}
+
+void ROOT::Internal::RRawFileCache::StoreInCache(std::uint64_t blockIdx, const unsigned char *data) const
+{
+   const auto path = GetBlockPath(blockIdx);
+   const auto tmpPath = path + "." + std::to_string(gSystem->GetPid()) + ".tmp";
+   {
+      std::ofstream block(tmpPath, std::ios::binary | std::ios::trunc);
+      block.write(reinterpret_cast<const char *>(data), GetBlockSize(blockIdx));
+      if (!block) {
+         // E.g. the disk is full: don't cache the block
+         block.close();
+         gSystem->Unlink(tmpPath.c_str());
+         return;
+      }
+   }
+   // Another process may have stored the same block in the meantime, with the same content
+   if (gSystem->Rename(tmpPath.c_str(), path.c_str()) != 0)
+      gSystem->Unlink(tmpPath.c_str());
+}
+
+void ROOT::Internal::RRawFileCache::Evict() const
+{
+   void *dir = gSystem->OpenDirectory(fCacheDir.c_str());
+   if (!dir)
+      return;
+
+   // Modification time, size and path of all the blocks in the cache directory
+   std::vector<std::tuple<Long_t, std::uint64_t, std::string>> blocks;
+   std::uint64_t totalSize = 0;
+   const auto suffixLen = strlen(kBlockFileSuffix);
+   while (const char *entry = gSystem->GetDirEntry(dir)) {
+      const std::string name = entry;
+      if (name.size() <= suffixLen || name.compare(name.size() - suffixLen, suffixLen, kBlockFileSuffix) != 0)
+         continue;
+      const auto path = fCacheDir + "/" + name;
+      FileStat_t stat;
+      if (gSystem->GetPathInfo(path.c_str(), stat) != 0)
+         continue;
+      blocks.emplace_back(stat.fMtime, stat.fSize, path);
+      totalSize += stat.fSize;
+   }
+   gSystem->FreeDirectory(dir);
+
+   if (totalSize <= fMaxCacheSize)
+      return;
+   std::sort(blocks.begin(), blocks.end());
+   for (const auto &[mtime, size, path] : blocks) {
+      if (totalSize <= fMaxCacheSize)
+         break;
+      // Blocks removed while another process reads them stay readable through its open file descriptor
+      if (gSystem->Unlink(path.c_str()) == 0)
+         totalSize -= size;
+   }
+}
+
+size_t ROOT::Internal::RRawFileCache::ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset)
+{
+   RIOVec ioVec;
+   ioVec.fBuffer = buffer;
+   ioVec.fOffset = offset;
+   ioVec.fSize = nbytes;
+   ReadVImpl(&ioVec, 1);
+   return ioVec.fOutBytes;
+}
+
+void ROOT::Internal::RRawFileCache::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   // Find the blocks that are needed and not in the cache
+   std::set<std::uint64_t> cachedBlocks;
+   std::map<std::uint64_t, std::vector<unsigned char>> fetchedBlocks;
+   for (unsigned int i = 0; i < nReq; ++i) {
+      if (ioVec[i].fSize == 0 || ioVec[i].fOffset >= fRemoteSize)
+         continue;
+      const auto end = std::min<std::uint64_t>(ioVec[i].fOffset + ioVec[i].fSize, fRemoteSize);
+      for (auto blockIdx = ioVec[i].fOffset / kCacheBlockSize; blockIdx <= (end - 1) / kCacheBlockSize; ++blockIdx) {
+         if (cachedBlocks.count(blockIdx) || fetchedBlocks.count(blockIdx))
+            continue;
+         if (IsCached(blockIdx))
+            cachedBlocks.insert(blockIdx);
+         else
+            fetchedBlocks[blockIdx].resize(GetBlockSize(blockIdx));
+      }
+   }
+
+   // Read the missing blocks from the remote file with as few vector reads as the remote file allows
+   if (!fetchedBlocks.empty()) {
+      std::vector<RIOVec> remoteReqs;
+      remoteReqs.reserve(fetchedBlocks.size());
+      for (auto &[blockIdx, data] : fetchedBlocks) {
+         RIOVec req;
+         req.fBuffer = data.data();
+         req.fOffset = blockIdx * kCacheBlockSize;
+         req.fSize = data.size();
+         remoteReqs.emplace_back(req);
+      }
+      const auto limits = fRemote->GetReadVLimits();
+      std::size_t iReq = 0;
+      while (iReq < remoteReqs.size()) {
+         auto nBatch = std::min(remoteReqs.size() - iReq, limits.fMaxReqs);
+         if (limits.fMaxTotalSize != static_cast<std::uint64_t>(-1))
+            nBatch = std::min<std::size_t>(nBatch, std::max<std::uint64_t>(1, limits.fMaxTotalSize / kCacheBlockSize));
+         if (nBatch == 1 || kCacheBlockSize > limits.fMaxSingleSize) {
+            remoteReqs[iReq].fOutBytes = fRemote->ReadAt(remoteReqs[iReq].fBuffer, remoteReqs[iReq].fSize,
+                                                         remoteReqs[iReq].fOffset);
+            ++iReq;
+            continue;
+         }
+         fRemote->ReadV(&remoteReqs[iReq], nBatch);
+         iReq += nBatch;
+      }
+      for (const auto &req : remoteReqs) {
+         if (req.fOutBytes != req.fSize)
+            throw std::runtime_error("short read from '" + fUrl + "' while filling the cache in " + fCacheDir);
+      }
+      for (const auto &[blockIdx, data] : fetchedBlocks)
+         StoreInCache(blockIdx, data.data());
+   }
+
+   // Serve the requests from the fetched blocks and from the cache
+   for (unsigned int i = 0; i < nReq; ++i) {
+      ioVec[i].fOutBytes = 0;
+      if (ioVec[i].fSize == 0 || ioVec[i].fOffset >= fRemoteSize)
+         continue;
+      const auto end = std::min<std::uint64_t>(ioVec[i].fOffset + ioVec[i].fSize, fRemoteSize);
+      auto offset = ioVec[i].fOffset;
+      auto dest = static_cast<unsigned char *>(ioVec[i].fBuffer);
+      while (offset < end) {
+         const auto blockIdx = offset / kCacheBlockSize;
+         const auto offsetInBlock = offset - blockIdx * kCacheBlockSize;
+         const auto nbytes = std::min(end, (blockIdx + 1) * kCacheBlockSize) - offset;
+         auto itFetched = fetchedBlocks.find(blockIdx);
+         if (itFetched != fetchedBlocks.end()) {
+            memcpy(dest, itFetched->second.data() + offsetInBlock, nbytes);
+         } else if (!ReadFromCache(blockIdx, dest, nbytes, offsetInBlock)) {
+            // Evicted by another process since we looked for it
+            if (fRemote->ReadAt(dest, nbytes, offset) != nbytes)
+               throw std::runtime_error("short read from '" + fUrl + "'");
+         }
+         dest += nbytes;
+         offset += nbytes;
+      }
+      ioVec[i].fOutBytes = end - ioVec[i].fOffset;
+   }
+
+   if (!fetchedBlocks.empty())
+      Evict();
+}
@@ -0,0 +1,136 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RRawFileCoalescing.hxx>
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+ROOT::Internal::RRawFileCoalescing::RRawFileCoalescing(std::unique_ptr<RRawFile> remote, std::uint64_t maxGap,
+                                                       std::uint64_t maxRangeSize, ROptions options)
+   : RRawFile(remote->GetUrl(), options), fRemote(std::move(remote)), fMaxGap(maxGap), fMaxRangeSize(maxRangeSize)
+{
+}
+
+std::unique_ptr<ROOT::Internal::RRawFile> ROOT::Internal::RRawFileCoalescing::Clone() const
+{
+   return std::make_unique<RRawFileCoalescing>(fRemote->Clone(), fMaxGap, fMaxRangeSize, fOptions);
+}
+
+void ROOT::Internal::RRawFileCoalescing::OpenImpl()
+{
+   // The wrapped file does the buffering of the scalar reads
+   fOptions.fBlockSize = 0;
+}
+
+std::uint64_t ROOT::Internal::RRawFileCoalescing::GetSizeImpl()
+{
+   return fRemote->GetSize();
+}
+
+size_t ROOT::Internal::RRawFileCoalescing::ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset)
+{
+   return fRemote->ReadAt(buffer, nbytes, offset);
+}
+
+void ROOT::Internal::RRawFileCoalescing::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   const auto limits = fRemote->GetReadVLimits();
+   const auto maxRangeSize = std::min<std::uint64_t>(fMaxRangeSize, limits.fMaxSingleSize);
+   if (nReq < 2 || maxRangeSize == 0) {
+      fRemote->ReadV(ioVec, nReq);
+      return;
+   }
+
+   std::vector<unsigned int> order(nReq);
+   std::iota(order.begin(), order.end(), 0);
+   std::sort(order.begin(), order.end(),
+             [ioVec](unsigned int a, unsigned int b) { return ioVec[a].fOffset < ioVec[b].fOffset; });
+
+   // A merged range spans the requests order[fFirst] to order[fLast - 1]
+   struct RRange {
+      std::uint64_t fOffset;
+      std::uint64_t fEnd;
+      unsigned int fFirst;
+      unsigned int fLast;
+   };
+   std::vector<RRange> ranges;
+   std::uint64_t scratchSize = 0;
+   for (unsigned int i = 0; i < nReq; ++i) {
+      const auto &req = ioVec[order[i]];
+      const auto end = req.fOffset + req.fSize;
+      if (!ranges.empty()) {
+         auto &last = ranges.back();
+         if (req.fOffset <= last.fEnd + fMaxGap && std::max(end, last.fEnd) - last.fOffset <= maxRangeSize) {
+            last.fEnd = std::max(end, last.fEnd);
+            last.fLast = i + 1;
+            continue;
+         }
+      }
+      ranges.push_back({req.fOffset, end, i, i + 1});
+   }
+   if (ranges.size() == nReq) {
+      fRemote->ReadV(ioVec, nReq);
+      return;
+   }
+
+   // Single requests are read in place, merged ranges into the scratch buffer
+   for (const auto &range : ranges) {
+      if (range.fLast - range.fFirst > 1)
+         scratchSize += range.fEnd - range.fOffset;
+   }
+   std::vector<unsigned char> scratch(scratchSize);
+   std::vector<RIOVec> remoteReqs(ranges.size());
+   unsigned char *scratchPos = scratch.data();
+   for (std::size_t i = 0; i < ranges.size(); ++i) {
+      const auto &range = ranges[i];
+      if (range.fLast - range.fFirst == 1) {
+         remoteReqs[i] = ioVec[order[range.fFirst]];
+         continue;
+      }
+      remoteReqs[i].fBuffer = scratchPos;
+      remoteReqs[i].fOffset = range.fOffset;
+      remoteReqs[i].fSize = range.fEnd - range.fOffset;
+      scratchPos += remoteReqs[i].fSize;
+   }
+
+   // Respect the limits on the number of requests and on the total size of a single vector read
+   std::size_t iReq = 0;
+   while (iReq < remoteReqs.size()) {
+      std::size_t nBatch = 0;
+      std::uint64_t batchSize = 0;
+      while (iReq + nBatch < remoteReqs.size() && nBatch < limits.fMaxReqs &&
+             (nBatch == 0 || batchSize + remoteReqs[iReq + nBatch].fSize <= limits.fMaxTotalSize)) {
+         batchSize += remoteReqs[iReq + nBatch].fSize;
+         ++nBatch;
+      }
+      fRemote->ReadV(&remoteReqs[iReq], nBatch);
+      iReq += nBatch;
+   }
+
+   for (std::size_t i = 0; i < ranges.size(); ++i) {
+      const auto &range = ranges[i];
+      if (range.fLast - range.fFirst == 1) {
+         ioVec[order[range.fFirst]].fOutBytes = remoteReqs[i].fOutBytes;
+         continue;
+      }
+      // Short reads at the end of the file leave the requests beyond the end (partially) unfilled
+      const auto outEnd = range.fOffset + remoteReqs[i].fOutBytes;
+      const auto src = static_cast<const unsigned char *>(remoteReqs[i].fBuffer);
+      for (auto j = range.fFirst; j < range.fLast; ++j) {
+         auto &req = ioVec[order[j]];
+         req.fOutBytes = (req.fOffset < outEnd) ? std::min<std::uint64_t>(req.fSize, outEnd - req.fOffset) : 0;
+         if (req.fOutBytes > 0)
+            memcpy(req.fBuffer, src + (req.fOffset - range.fOffset), req.fOutBytes);
+      }
+   }
+}
@@ -18,6 +18,7 @@
 
 #include "TError.h"
 
+#include <algorithm>
 #include <cerrno>
 #include <cstring>
 #include <memory>
@@ -27,17 +28,59 @@
 #include <vector>
 
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
 namespace {
 constexpr int kDefaultBlockSize = 4096; // If fstat() does not provide a block size hint, use this value instead
+
+#ifdef R__HAS_URING
+struct RThreadRing {
+   std::unique_ptr<ROOT::Internal::RIoUring> fRing;
+   /// Set if the ring setup or a previous vector read failed; prevents retrying on every ReadV call
+   bool fFailed = false;
+};
+
+RThreadRing &GetThreadRingState()
+{
+   thread_local RThreadRing state;
+   return state;
+}
+
+/// Setting up an io_uring instance is expensive compared to the submission of a batch of reads. Therefore, every
+/// thread lazily creates a single ring that is shared by the vector reads of all the RRawFileUnix objects used by
+/// the thread. Returns nullptr if io_uring is not available.
+ROOT::Internal::RIoUring *GetThreadRing()
+{
+   auto &state = GetThreadRingState();
+   if (!state.fRing && !state.fFailed) {
+      try {
+         state.fRing = std::make_unique<ROOT::Internal::RIoUring>(); // throws std::runtime_error
+      } catch (const std::runtime_error &e) {
+         Warning("RIoUring", "io_uring is unexpectedly not available because:\n%s", e.what());
+         Warning("RRawFileUnix", "io_uring setup failed, falling back to blocking I/O in ReadV");
+         state.fFailed = true;
+      }
+   }
+   return state.fRing.get();
+}
+
+void DisableThreadRing()
+{
+   auto &state = GetThreadRingState();
+   state.fRing.reset();
+   state.fFailed = true;
+}
+#endif
 } // anonymous namespace
 
 ROOT::Internal::RRawFileUnix::RRawFileUnix(std::string_view url, ROptions options) : RRawFile(url, options) {}
 
 ROOT::Internal::RRawFileUnix::~RRawFileUnix()
 {
+   if (fMapping)
+      munmap(fMapping, fMappingSize);
    if (fFileDes >= 0)
       close(fFileDes);
 }
@@ -72,6 +115,15 @@ void ROOT::Internal::RRawFileUnix::OpenImpl()
       throw std::runtime_error("Cannot open '" + fUrl + "', error: " + std::string(strerror(errno)));
    }
 
+   if (fOptions.fUseMmap) {
+      MapFile();
+      // Reads from the mapping are as cheap as reads from the block buffers
+      if (fMapping) {
+         fOptions.fBlockSize = 0;
+         return;
+      }
+   }
+
    if (fOptions.fBlockSize != ROptions::kUseDefaultBlockSize)
       return;
 
@@ -92,34 +144,76 @@ void ROOT::Internal::RRawFileUnix::OpenImpl()
    }
 }
 
+void ROOT::Internal::RRawFileUnix::MapFile()
+{
+#ifdef R__SEEK64
+   struct stat64 info;
+   int res = fstat64(fFileDes, &info);
+#else
+   struct stat info;
+   int res = fstat(fFileDes, &info);
+#endif
+   // Pipes and other special files cannot be mapped; empty files need not be
+   if (res != 0 || !S_ISREG(info.st_mode) || info.st_size <= 0)
+      return;
+
+   void *mapping = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fFileDes, 0);
+   if (mapping == MAP_FAILED) {
+      Warning("RRawFileUnix", "cannot map '%s' into memory, falling back to reads: %s", fUrl.c_str(), strerror(errno));
+      return;
+   }
+   fMapping = static_cast<unsigned char *>(mapping);
+   fMappingSize = info.st_size;
+}
+
+const unsigned char *ROOT::Internal::RRawFileUnix::GetMappedRangeImpl(std::uint64_t offset, size_t nbytes)
+{
+   if (!fMapping || offset > fMappingSize || nbytes > fMappingSize - offset)
+      return nullptr;
+   return fMapping + offset;
+}
+
 void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
 {
+   if (fMapping) {
+      // Let the kernel read ahead all the requested ranges before copying them out one by one
+      const std::uint64_t pageSize = sysconf(_SC_PAGESIZE);
+      for (unsigned int i = 0; i < nReq; ++i) {
+         if (ioVec[i].fOffset >= fMappingSize || ioVec[i].fSize == 0)
+            continue;
+         const std::uint64_t begin = ioVec[i].fOffset / pageSize * pageSize;
+         const std::uint64_t end = std::min<std::uint64_t>(ioVec[i].fOffset + ioVec[i].fSize, fMappingSize);
+         madvise(fMapping + begin, end - begin, MADV_WILLNEED);
+      }
+      for (unsigned int i = 0; i < nReq; ++i)
+         ioVec[i].fOutBytes = ReadAtImpl(ioVec[i].fBuffer, ioVec[i].fSize, ioVec[i].fOffset);
+      return;
+   }
+
 #ifdef R__HAS_URING
-   thread_local bool uring_failed = false;
-   if (!uring_failed) {
+   auto ring = GetThreadRing();
+   if (ring) {
+      std::vector<RIoUring::RReadEvent> reads;
+      reads.reserve(nReq);
+      for (std::size_t i = 0; i < nReq; ++i) {
+         RIoUring::RReadEvent ev;
+         ev.fBuffer = ioVec[i].fBuffer;
+         ev.fOffset = ioVec[i].fOffset;
+         ev.fSize = ioVec[i].fSize;
+         ev.fFileDes = fFileDes;
+         reads.push_back(ev);
+      }
       try {
-         RIoUring ring; // throws std::runtime_error
-         std::vector<RIoUring::RReadEvent> reads;
-         reads.reserve(nReq);
-         for (std::size_t i = 0; i < nReq; ++i) {
-            RIoUring::RReadEvent ev;
-            ev.fBuffer = ioVec[i].fBuffer;
-            ev.fOffset = ioVec[i].fOffset;
-            ev.fSize = ioVec[i].fSize;
-            ev.fFileDes = fFileDes;
-            reads.push_back(ev);
-         }
-         ring.SubmitReadsAndWait(reads.data(), nReq);
+         ring->SubmitReadsAndWait(reads.data(), nReq);
          for (std::size_t i = 0; i < nReq; ++i) {
             ioVec[i].fOutBytes = reads.at(i).fOutBytes;
          }
          return;
-      }
-      catch(const std::runtime_error &e) {
-         Warning("RIoUring", "io_uring is unexpectedly not available because:\n%s", e.what());
-         Warning("RRawFileUnix",
-              "io_uring setup failed, falling back to blocking I/O in ReadV");
-         uring_failed = true;
+      } catch (const std::runtime_error &e) {
+         // The ring may be left with unreaped completions; do not reuse it
+         Warning("RIoUring", "io_uring read failed because:\n%s", e.what());
+         Warning("RRawFileUnix", "io_uring vector read failed, falling back to blocking I/O in ReadV");
+         DisableThreadRing();
       }
    }
 #endif
@@ -128,6 +222,12 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
 
 size_t ROOT::Internal::RRawFileUnix::ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset)
 {
+   // The file may have grown since it was mapped, the bytes beyond the mapping are read with pread
+   if (fMapping && offset <= fMappingSize && nbytes <= fMappingSize - offset) {
+      memcpy(buffer, fMapping + offset, nbytes);
+      return nbytes;
+   }
+
    size_t total_bytes = 0;
    while (nbytes) {
 #ifdef R__SEEK64
@@ -773,8 +773,8 @@ Int_t TBufferFile::ReadArray(Short_t *&h)
    bswapcpy16(h, fBufCur, n);
    fBufCur += l;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
+   frombufarray16(h, fBufCur, n);
+   fBufCur += l;
 # endif
 #else
    memcpy(h, fBufCur, l);
@@ -806,8 +806,8 @@ Int_t TBufferFile::ReadArray(Int_t *&ii)
    bswapcpy32(ii, fBufCur, n);
    fBufCur += l;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
+   frombufarray32(ii, fBufCur, n);
+   fBufCur += l;
 # endif
 #else
    memcpy(ii, fBufCur, l);
@@ -861,8 +861,8 @@ Int_t TBufferFile::ReadArray(Long64_t *&ll)
    if (!ll) ll = new Long64_t[n];
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
+   frombufarray64(ll, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -893,8 +893,8 @@ Int_t TBufferFile::ReadArray(Float_t *&f)
    bswapcpy32(f, fBufCur, n);
    fBufCur += l;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
+   frombufarray32(f, fBufCur, n);
+   fBufCur += l;
 # endif
 #else
    memcpy(f, fBufCur, l);
@@ -922,8 +922,8 @@ Int_t TBufferFile::ReadArray(Double_t *&d)
    if (!d) d = new Double_t[n];
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
+   frombufarray64(d, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -1046,8 +1046,8 @@ Int_t TBufferFile::ReadStaticArray(Short_t *h)
    bswapcpy16(h, fBufCur, n);
    fBufCur += l;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
+   frombufarray16(h, fBufCur, n);
+   fBufCur += l;
 # endif
 #else
    memcpy(h, fBufCur, l);
@@ -1078,8 +1078,8 @@ Int_t TBufferFile::ReadStaticArray(Int_t *ii)
    bswapcpy32(ii, fBufCur, n);
    fBufCur += sizeof(Int_t)*n;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
+   frombufarray32(ii, fBufCur, n);
+   fBufCur += l;
 # endif
 #else
    memcpy(ii, fBufCur, l);
@@ -1131,8 +1131,8 @@ Int_t TBufferFile::ReadStaticArray(Long64_t *ll)
    if (!ll) return 0;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
+   frombufarray64(ll, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -1162,8 +1162,8 @@ Int_t TBufferFile::ReadStaticArray(Float_t *f)
    bswapcpy32(f, fBufCur, n);
    fBufCur += sizeof(Float_t)*n;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
+   frombufarray32(f, fBufCur, n);
+   fBufCur += l;
 # endif
 #else
    memcpy(f, fBufCur, l);
@@ -1190,8 +1190,8 @@ Int_t TBufferFile::ReadStaticArray(Double_t *d)
    if (!d) return 0;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
+   frombufarray64(d, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -1312,8 +1312,8 @@ void TBufferFile::ReadFastArray(Short_t *h, Int_t n)
    bswapcpy16(h, fBufCur, n);
    fBufCur += sizeof(Short_t)*n;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
+   frombufarray16(h, fBufCur, n);
+   fBufCur += l;
 # endif
 #else
    memcpy(h, fBufCur, l);
@@ -1334,8 +1334,8 @@ void TBufferFile::ReadFastArray(Int_t *ii, Int_t n)
    bswapcpy32(ii, fBufCur, n);
    fBufCur += sizeof(Int_t)*n;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
+   frombufarray32(ii, fBufCur, n);
+   fBufCur += l;
 # endif
 #else
    memcpy(ii, fBufCur, l);
@@ -1368,8 +1368,8 @@ void TBufferFile::ReadFastArray(Long64_t *ll, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
+   frombufarray64(ll, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -1389,8 +1389,8 @@ void TBufferFile::ReadFastArray(Float_t *f, Int_t n)
    bswapcpy32(f, fBufCur, n);
    fBufCur += sizeof(Float_t)*n;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
+   frombufarray32(f, fBufCur, n);
+   fBufCur += l;
 # endif
 #else
    memcpy(f, fBufCur, l);
@@ -1407,8 +1407,8 @@ void TBufferFile::ReadFastArray(Double_t *d, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
+   frombufarray64(d, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -98,6 +98,7 @@ class Container {
 #include <locale.h>
 #include <cmath>
 #include <memory>
+#include <charconv>
 #include <cstdlib>
 #include <fstream>
 
@@ -133,6 +134,33 @@ ClassImp(TBufferJSON);
 
 enum { json_TArray = 100, json_TCollection = -130, json_TString = 110, json_stdstring = 120 };
 
+namespace {
+
+/// Append the decimal representation of an integer, as printf("%d") would but without parsing a format
+template <typename T>
+void AppendInteger(TString &str, T value)
+{
+   char buf[30];
+   auto res = std::to_chars(buf, buf + sizeof(buf), value);
+   str.Append(buf, res.ptr - buf);
+}
+
+/// Integral floating point values, e.g. most histogram bin contents, are written as "%1.0f" by
+/// TBufferText::ConvertDouble; produce the same output for the ones fitting into a Long64_t without snprintf
+template <typename T>
+bool AppendIntegralFloat(TString &str, T value)
+{
+   if ((value != std::nearbyint(value)) || (std::abs(value) >= T(1e15)))
+      return false;
+   if (value == 0)
+      str.Append(std::signbit(value) ? "-0" : "0");
+   else
+      AppendInteger(str, static_cast<Long64_t>(value));
+   return true;
+}
+
+} // anonymous namespace
+
 ///////////////////////////////////////////////////////////////
 // TArrayIndexProducer is used to correctly create
 /// JSON array separators for multi-dimensional JSON arrays
@@ -3888,9 +3916,7 @@ void TBufferJSON::WriteCharStar(char *s)
 
 void TBufferJSON::JsonWriteBasic(Char_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%d", value);
-   fValue.Append(buf);
+   AppendInteger(fValue, static_cast<Int_t>(value));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3898,9 +3924,7 @@ void TBufferJSON::JsonWriteBasic(Char_t value)
 
 void TBufferJSON::JsonWriteBasic(Short_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%hd", value);
-   fValue.Append(buf);
+   AppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3908,9 +3932,7 @@ void TBufferJSON::JsonWriteBasic(Short_t value)
 
 void TBufferJSON::JsonWriteBasic(Int_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%d", value);
-   fValue.Append(buf);
+   AppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3918,9 +3940,7 @@ void TBufferJSON::JsonWriteBasic(Int_t value)
 
 void TBufferJSON::JsonWriteBasic(Long_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%ld", value);
-   fValue.Append(buf);
+   AppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3928,7 +3948,7 @@ void TBufferJSON::JsonWriteBasic(Long_t value)
 
 void TBufferJSON::JsonWriteBasic(Long64_t value)
 {
-   fValue.Append(std::to_string(value).c_str());
+   AppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3936,7 +3956,9 @@ void TBufferJSON::JsonWriteBasic(Long64_t value)
 
 void TBufferJSON::JsonWriteBasic(Float_t value)
 {
-   if (std::isinf(value)) {
+   if (AppendIntegralFloat(fValue, value)) {
+      return;
+   } else if (std::isinf(value)) {
       fValue.Append((value < 0.) ? "-2e308" : "2e308"); // Number.MAX_VALUE is approx 1.79e308
    } else if (std::isnan(value)) {
       fValue.Append("null");
@@ -3952,7 +3974,9 @@ void TBufferJSON::JsonWriteBasic(Float_t value)
 
 void TBufferJSON::JsonWriteBasic(Double_t value)
 {
-   if (std::isinf(value)) {
+   if (AppendIntegralFloat(fValue, value)) {
+      return;
+   } else if (std::isinf(value)) {
       fValue.Append((value < 0.) ? "-2e308" : "2e308"); // Number.MAX_VALUE is approx 1.79e308
    } else if (std::isnan(value)) {
       fValue.Append("null");
@@ -3976,9 +4000,7 @@ void TBufferJSON::JsonWriteBasic(Bool_t value)
 
 void TBufferJSON::JsonWriteBasic(UChar_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%u", value);
-   fValue.Append(buf);
+   AppendInteger(fValue, static_cast<UInt_t>(value));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3986,9 +4008,7 @@ void TBufferJSON::JsonWriteBasic(UChar_t value)
 
 void TBufferJSON::JsonWriteBasic(UShort_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%hu", value);
-   fValue.Append(buf);
+   AppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3996,9 +4016,7 @@ void TBufferJSON::JsonWriteBasic(UShort_t value)
 
 void TBufferJSON::JsonWriteBasic(UInt_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%u", value);
-   fValue.Append(buf);
+   AppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -4006,9 +4024,7 @@ void TBufferJSON::JsonWriteBasic(UInt_t value)
 
 void TBufferJSON::JsonWriteBasic(ULong_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%lu", value);
-   fValue.Append(buf);
+   AppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -4016,7 +4032,7 @@ void TBufferJSON::JsonWriteBasic(ULong_t value)
 
 void TBufferJSON::JsonWriteBasic(ULong64_t value)
 {
-   fValue.Append(std::to_string(value).c_str());
+   AppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -11,8 +11,11 @@
 
 #include "ROOT/TBufferMerger.hxx"
 
+#include "TArrayC.h"
 #include "TBufferFile.h"
 #include "TError.h"
+#include "TKey.h"
+#include "TMemFile.h"
 #include "TROOT.h"
 #include "TVirtualMutex.h"
 
@@ -73,14 +76,79 @@ void TBufferMerger::SetMergeOptions(const TString& options)
    fMerger.SetMergeOptions(options);
 }
 
-void TBufferMerger::Merge(ROOT::TBufferMergerFile *memfile)
+Int_t TBufferMerger::WriteTObject(const TObject *obj, const char *name)
 {
+   TFile *output = fMerger.GetOutputFile();
+   if (!obj || !output || !output->IsWritable())
+      return 0;
+
+   // Stream and compress the object into a private in-memory file
+   std::unique_ptr<TMemFile> memfile;
+   {
+      R__LOCKGUARD(gROOTMutex);
+      TDirectory::TContext ctxt;
+      memfile = std::make_unique<TMemFile>("TBufferMergerObject", "RECREATE", "", output->GetCompressionSettings());
+      gROOT->GetListOfFiles()->Remove(memfile.get());
+   }
+   const Int_t nbytes = memfile->WriteTObject(obj, name);
+   if (nbytes <= 0)
+      return 0;
+
    std::lock_guard q(fMergeMutex);
-   memfile->WriteStreamerInfo();
-   fMerger.AddFile(memfile);
-   fMerger.PartialMerge(TFileMerger::kAll | TFileMerger::kIncremental | TFileMerger::kDelayWrite |
-                        TFileMerger::kKeepCompression);
-   fMerger.Reset();
+   // Copy the compressed records as they are, like TFileMerger does in "fast" mode
+   TIter next(memfile->GetListOfKeys());
+   while (auto key = static_cast<TKey *>(next())) {
+      auto newkey = new TKey(output, *key, 0 /* pidoffset */); // appended to the keys of output
+      output->SumBuffer(newkey->GetObjlen());
+      newkey->WriteFile(0);
+   }
+   // The StreamerInfos used by the object are written with the ones of the output file
+   TArrayC *used = memfile->GetClassIndex();
+   TArrayC *outputUsed = output->GetClassIndex();
+   if (outputUsed->GetSize() < used->GetSize())
+      outputUsed->Set(used->GetSize());
+   for (Int_t i = 0; i < used->GetSize(); ++i) {
+      if (used->fArray[i])
+         outputUsed->fArray[i] = 1;
+   }
+   return nbytes;
+}
+
+void TBufferMerger::Merge(ROOT::TBufferMergerFile *memfile)
+{
+   std::unique_lock lock(fQueueMutex);
+   fMergeQueue.push_back(memfile);
+   const auto ticket = fNQueued++;
+
+   // The first thread to find the merger idle merges every file queued so far,
+   // including the ones of the threads that arrived meanwhile and are waiting below.
+   while (ticket >= fNMerged) {
+      if (fMerging) {
+         fMergeDone.wait(lock);
+         continue;
+      }
+      fMerging = true;
+      std::vector<TBufferMergerFile *> batch;
+      batch.swap(fMergeQueue);
+      const auto nqueued = fNQueued;
+      lock.unlock();
+
+      {
+         std::lock_guard q(fMergeMutex);
+         for (auto file : batch) {
+            file->WriteStreamerInfo();
+            fMerger.AddFile(file);
+         }
+         fMerger.PartialMerge(TFileMerger::kAll | TFileMerger::kIncremental | TFileMerger::kDelayWrite |
+                              TFileMerger::kKeepCompression);
+         fMerger.Reset();
+      }
+
+      lock.lock();
+      fNMerged = nqueued;
+      fMerging = false;
+      fMergeDone.notify_all();
+   }
 }
 
 } // namespace ROOT
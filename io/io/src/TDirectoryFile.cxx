@@ -23,7 +23,9 @@ End_Macro
  The structure of a file is shown in TFile::TFile
 */
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
 #include "Strlen.h"
 #include "strlcpy.h"
 #include "TDirectoryFile.h"
@@ -570,17 +572,35 @@ void TDirectoryFile::Close(Option_t *option)
    Bool_t nodelete = option ? (!strcmp(option, "nodelete") ? kTRUE : kFALSE) : kFALSE;
 
    if (!nodelete) {
+      // Delete the sub-directories (that were allocated on the heap) first, one
+      // at a time while this list is still reachable from the list of cleanups,
+      // as they recursively close and may modify this list. The scan restarts after
+      // each of them because the list might have changed.
+      auto nextSubdir = [this]() -> TObjLink * {
+         for (TObjLink *lnk = fList->FirstLink(); lnk; lnk = lnk->Next()) {
+            TObject *obj = lnk->GetObject();
+            if (obj && obj->IsA() == TDirectoryFile::Class() && obj->IsOnHeap())
+               return lnk;
+         }
+         return nullptr;
+      };
+      while (TObjLink *lnk = nextSubdir()) {
+         TObject *subdir = lnk->GetObject();
+         fList->Remove(lnk);
+         TCollection::GarbageCollect(subdir);
+      }
+
       Bool_t fast = kTRUE;
       TObjLink *lnk = fList->FirstLink();
       while (lnk) {
          if (lnk->GetObject()->IsA() == TDirectoryFile::Class()) {fast = kFALSE;break;}
          lnk = lnk->Next();
       }
-      // Delete objects from directory list, this in turn, recursively closes all
-      // sub-directories (that were allocated on the heap)
-      // if this dir contains subdirs, we must use the slow option for Delete!
+      // Delete the remaining objects from directory list.
+      // if this dir still contains subdirs, we must use the slow option for Delete!
       // we must avoid "slow" as much as possible, in particular Delete("slow")
-      // with a large number of objects (eg >10^5) would take for ever.
+      // with a large number of objects (eg >10^5) would take for ever, as the
+      // deletion of each object scans the rest of the list in RecursiveRemove.
       {
          if (fast) fList->Delete();
          else      fList->Delete("slow");
@@ -1323,6 +1343,9 @@ void TDirectoryFile::Purge(Short_t)
 /// and the object is again read from the file.
 /// If opt=="dirs", only subdirectories will be read
 /// If opt=="dirs*" complete directory tree will be read
+///
+/// The compressed records of the keys are fetched with vectored reads
+/// (TFile::ReadBuffers) of up to 64 MB each instead of one read per key.
 
 void TDirectoryFile::ReadAll(Option_t* opt)
 {
@@ -1343,12 +1366,59 @@ void TDirectoryFile::ReadAll(Option_t* opt)
 
          if ((dir!=0) && (strcmp(opt,"dirs*")==0)) dir->ReadAll("dirs*");
       }
-   else
-      while ((key = (TKey *) next())) {
-         TObject *thing = GetList()->FindObject(key->GetName());
-         if (thing) { delete thing; }
-         key->ReadObj();
+   else {
+      // The records of the compressed objects are fetched with one vectored read per batch of keys instead of one
+      // read per key, which matters for directories with many small objects and for remote files.
+      static constexpr Long64_t kMaxBatchBytes = 64 * 1024 * 1024;
+      TFile *f = GetFile();
+      std::vector<TKey *> keys;
+      while ((key = (TKey *) next()))
+         keys.push_back(key);
+      auto isCompressed = [](TKey *k) { return k->GetObjlen() > k->GetNbytes() - k->GetKeylen(); };
+
+      std::vector<char> buffer;
+      std::vector<Long64_t> pos;
+      std::vector<Int_t> len;
+      std::vector<std::size_t> order;
+      std::vector<Long64_t> offsets(keys.size(), -1);
+      std::size_t first = 0;
+      while (first < keys.size()) {
+         std::size_t last = first;
+         Long64_t nbytes = 0;
+         order.clear();
+         while (last < keys.size() && (order.empty() || nbytes + keys[last]->GetNbytes() <= kMaxBatchBytes)) {
+            if (f && isCompressed(keys[last]) && keys[last]->GetNbytes() > 0) {
+               order.push_back(last);
+               nbytes += keys[last]->GetNbytes();
+            }
+            ++last;
+         }
+         // TFile::ReadBuffers groups nearby records, which requires increasing offsets
+         std::sort(order.begin(), order.end(),
+                   [&](std::size_t a, std::size_t b) { return keys[a]->GetSeekKey() < keys[b]->GetSeekKey(); });
+         pos.resize(order.size());
+         len.resize(order.size());
+         Long64_t offset = 0;
+         for (std::size_t i = 0; i < order.size(); ++i) {
+            pos[i] = keys[order[i]]->GetSeekKey();
+            len[i] = keys[order[i]]->GetNbytes();
+            offsets[order[i]] = offset;
+            offset += len[i];
+         }
+         buffer.resize(offset);
+         const Bool_t bulkRead = !order.empty() && !f->ReadBuffers(buffer.data(), pos.data(), len.data(), order.size());
+
+         for (std::size_t i = first; i < last; ++i) {
+            TObject *thing = GetList()->FindObject(keys[i]->GetName());
+            if (thing) { delete thing; }
+            if (bulkRead && offsets[i] >= 0)
+               keys[i]->ReadObjWithBuffer(buffer.data() + offsets[i]);
+            else
+               keys[i]->ReadObj();
+         }
+         first = last;
       }
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1430,6 +1500,13 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 
       TKey *key;
       frombuf(buffer, &nkeys);
+      // Size the hash table for all the keys at once: otherwise it only grows when
+      // its buckets hold 50 keys on average (see Init), which all have to be
+      // compared by name on each lookup.
+      const Int_t nTotalKeys = fKeys->GetSize() + nkeys;
+      auto listOfKeys = dynamic_cast<THashList *>(fKeys);
+      if (listOfKeys && nTotalKeys > 100)
+         listOfKeys->Rehash(nTotalKeys);
       for (Int_t i = 0; i < nkeys; i++) {
          key = new TKey(this);
          key->ReadKeyBuffer(buffer);
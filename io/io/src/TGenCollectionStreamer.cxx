@@ -722,6 +722,54 @@ To readOneValue(TBuffer &b, int readtype) {
 }
 
 
+// Functions reading one key or one value of a map of fundamental types, selected once per map instead of switching
+// on the type of the key and of the value for each element.
+typedef void (*ReadMapPrimitive_t)(TBuffer &b, TGenCollectionProxy::StreamHelper *i);
+
+template <typename T>
+static void ReadMapPrimitive(TBuffer &b, TGenCollectionProxy::StreamHelper *i)
+{
+   b >> *getaddress<T>(*i);
+}
+
+static void ReadMapPrimitiveFloat16(TBuffer &b, TGenCollectionProxy::StreamHelper *i)
+{
+   float f;
+   b >> f;
+   i->flt = float(f);
+}
+
+static void ReadMapPrimitiveDouble32(TBuffer &b, TGenCollectionProxy::StreamHelper *i)
+{
+   float f;
+   b >> f;
+   i->dbl = double(f);
+}
+
+static ReadMapPrimitive_t GetReadMapPrimitive(const TGenCollectionProxy::Value &v)
+{
+   if (v.fCase != kIsFundamental && v.fCase != kIsEnum)
+      return nullptr;
+   switch (int(v.fKind)) {
+      case kBool_t: return ReadMapPrimitive<bool>;
+      case kChar_t: return ReadMapPrimitive<Char_t>;
+      case kShort_t: return ReadMapPrimitive<Short_t>;
+      case kInt_t: return ReadMapPrimitive<Int_t>;
+      case kLong_t: return ReadMapPrimitive<Long_t>;
+      case kLong64_t: return ReadMapPrimitive<Long64_t>;
+      case kFloat_t: return ReadMapPrimitive<Float_t>;
+      case kFloat16_t: return ReadMapPrimitiveFloat16;
+      case kDouble_t: return ReadMapPrimitive<Double_t>;
+      case kUChar_t: return ReadMapPrimitive<UChar_t>;
+      case kUShort_t: return ReadMapPrimitive<UShort_t>;
+      case kUInt_t: return ReadMapPrimitive<UInt_t>;
+      case kULong_t: return ReadMapPrimitive<ULong_t>;
+      case kULong64_t: return ReadMapPrimitive<ULong64_t>;
+      case kDouble32_t: return ReadMapPrimitiveDouble32;
+      default: return nullptr;
+   }
+}
+
 void TGenCollectionStreamer::ReadMap(int nElements, TBuffer &b, const TClass *onFileClass)
 {
    // Map input streamer.
@@ -737,6 +785,18 @@ void TGenCollectionStreamer::ReadMap(int nElements, TBuffer &b, const TClass *on
    addr = temp = (char*)fEnv->fStart;
    fConstruct(addr,nElements);
 
+   // Fast path for maps of fundamental types read without conversion
+   ReadMapPrimitive_t readKey = onFileClass ? nullptr : GetReadMapPrimitive(*fKey);
+   ReadMapPrimitive_t readVal = onFileClass ? nullptr : GetReadMapPrimitive(*fVal);
+   const bool isPrimitiveMap = readKey && readVal;
+   if (isPrimitiveMap) {
+      for (int idx = 0; idx < nElements; ++idx) {
+         addr = temp + fValDiff * idx;
+         readKey(b, (StreamHelper *)addr);
+         readVal(b, (StreamHelper *)(addr + fValOffset));
+      }
+   }
+
    int onFileValueKind[2];
    if (onFileClass) {
       TClass *onFileValueClass = onFileClass->GetCollectionProxy()->GetValueClass();
@@ -744,7 +804,7 @@ void TGenCollectionStreamer::ReadMap(int nElements, TBuffer &b, const TClass *on
       onFileValueKind[0] = ((TStreamerElement*)sourceInfo->GetElements()->At(0))->GetType();
       onFileValueKind[1] = ((TStreamerElement*)sourceInfo->GetElements()->At(1))->GetType();
    }
-   for (int loop, idx = 0; idx < nElements; ++idx)  {
+   for (int loop, idx = 0; !isPrimitiveMap && idx < nElements; ++idx)  {
       addr = temp + fValDiff * idx;
       v = fKey;
       for (loop = 0; loop < 2; loop++)  {
@@ -48,7 +48,11 @@
 */
 
 #include <atomic>
+#include <cstring>
 #include <iostream>
+#include <memory>
+#include <new>
+#include <optional>
 
 #include "TROOT.h"
 #include "TClass.h"
@@ -79,6 +83,70 @@ const UChar_t kPidOffsetShift = 48;
 const static TString gTDirectoryString("TDirectory");
 std::atomic<UInt_t> keyAbsNumber{0};
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Buffer used to read and decompress the record of a key, taken from a
+/// thread-local pool.
+///
+/// The pool keeps at most one free buffer per power-of-two size class, from
+/// 4 KiB to 64 MiB, so that reading many keys does not allocate and page-fault
+/// new memory for every record. The buffers are aligned to a page, which
+/// suits direct I/O and vectorized decompression. Larger buffers are not
+/// pooled.
+
+class RKeyBuffer {
+   static constexpr std::size_t kAlignment = 4096;
+   static constexpr unsigned int kMinSizeClassLog2 = 12;
+   static constexpr unsigned int kNSizeClasses = 15;
+
+   struct RDeleter {
+      void operator()(char *buffer) const { ::operator delete[](buffer, std::align_val_t(kAlignment)); }
+   };
+   using Buffer_t = std::unique_ptr<char[], RDeleter>;
+
+   static Buffer_t *GetPoolSlots()
+   {
+      thread_local Buffer_t slots[kNSizeClasses];
+      return slots;
+   }
+
+   /// Returns the size class of buffers of `size` bytes, kNSizeClasses if too large to be pooled
+   static unsigned int GetSizeClass(std::size_t size)
+   {
+      unsigned int sizeClass = 0;
+      while (sizeClass < kNSizeClasses && (std::size_t(1) << (kMinSizeClassLog2 + sizeClass)) < size)
+         ++sizeClass;
+      return sizeClass;
+   }
+
+   Buffer_t fBuffer;
+   unsigned int fSizeClass;
+
+public:
+   explicit RKeyBuffer(Int_t nbytes) : fSizeClass(GetSizeClass(nbytes > 0 ? nbytes : 0))
+   {
+      std::size_t size = nbytes > 0 ? nbytes : 0;
+      if (fSizeClass < kNSizeClasses) {
+         fBuffer = std::move(GetPoolSlots()[fSizeClass]);
+         size = std::size_t(1) << (kMinSizeClassLog2 + fSizeClass);
+      }
+      if (!fBuffer)
+         fBuffer.reset(new (std::align_val_t(kAlignment)) char[size]);
+   }
+   ~RKeyBuffer()
+   {
+      if (fSizeClass < kNSizeClasses)
+         GetPoolSlots()[fSizeClass] = std::move(fBuffer);
+   }
+   RKeyBuffer(const RKeyBuffer &) = delete;
+   RKeyBuffer &operator=(const RKeyBuffer &) = delete;
+
+   char *Get() const { return fBuffer.get(); }
+};
+
+} // anonymous namespace
+
 ClassImp(TKey);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -768,7 +836,8 @@ TObject *TKey::ReadObj()
       return (TObject*)ReadObjectAny(0);
    }
 
-   TBufferFile bufferRef(TBuffer::kRead, fObjlen+fKeylen);
+   RKeyBuffer recordBuffer(fObjlen+fKeylen);
+   TBufferFile bufferRef(TBuffer::kRead, fObjlen+fKeylen, recordBuffer.Get(), kFALSE);
    if (!bufferRef.Buffer()) {
       Error("ReadObj", "Cannot allocate buffer: fObjlen = %d", fObjlen);
       return 0;
@@ -777,11 +846,11 @@ TObject *TKey::ReadObj()
    bufferRef.SetParent(GetFile());
    bufferRef.SetPidOffset(fPidOffset);
 
-   std::unique_ptr<char []> compressedBuffer;
+   std::optional<RKeyBuffer> compressedBuffer;
    auto storeBuffer = fBuffer;
    if (fObjlen > fNbytes-fKeylen) {
-      compressedBuffer.reset(new char[fNbytes]);
-      fBuffer = compressedBuffer.get();
+      compressedBuffer.emplace(fNbytes);
+      fBuffer = compressedBuffer->Get();
       if( !ReadFile() )                    //Read object structure from file
       {
         fBuffer = 0;
@@ -825,7 +894,7 @@ TObject *TKey::ReadObj()
 
    if (fObjlen > fNbytes-fKeylen) {
       char *objbuf = bufferRef.Buffer() + fKeylen;
-      UChar_t *bufcur = (UChar_t *)&compressedBuffer[fKeylen];
+      UChar_t *bufcur = (UChar_t *)compressedBuffer->Get() + fKeylen;
       Int_t nin, nout = 0, nbuf;
       Int_t noutot = 0;
       while (1) {
@@ -838,7 +907,7 @@ TObject *TKey::ReadObj()
          bufcur += nin;
          objbuf += nout;
       }
-      compressedBuffer.reset(nullptr);
+      compressedBuffer.reset();
       if (nout) {
          tobj->Streamer(bufferRef); //does not work with example 2 above
       } else {
@@ -903,7 +972,8 @@ TObject *TKey::ReadObjWithBuffer(char *bufferRead)
       return (TObject*)ReadObjectAny(0);
    }
 
-   TBufferFile bufferRef(TBuffer::kRead, fObjlen+fKeylen);
+   RKeyBuffer recordBuffer(fObjlen+fKeylen);
+   TBufferFile bufferRef(TBuffer::kRead, fObjlen+fKeylen, recordBuffer.Get(), kFALSE);
    if (!bufferRef.Buffer()) {
       Error("ReadObjWithBuffer", "Cannot allocate buffer: fObjlen = %d", fObjlen);
       return 0;
@@ -1023,7 +1093,8 @@ TObject *TKey::ReadObjWithBuffer(char *bufferRead)
 
 void *TKey::ReadObjectAny(const TClass* expectedClass)
 {
-   TBufferFile bufferRef(TBuffer::kRead, fObjlen+fKeylen);
+   RKeyBuffer recordBuffer(fObjlen+fKeylen);
+   TBufferFile bufferRef(TBuffer::kRead, fObjlen+fKeylen, recordBuffer.Get(), kFALSE);
    if (!bufferRef.Buffer()) {
       Error("ReadObj", "Cannot allocate buffer: fObjlen = %d", fObjlen);
       return 0;
@@ -1032,11 +1103,11 @@ void *TKey::ReadObjectAny(const TClass* expectedClass)
    bufferRef.SetParent(GetFile());
    bufferRef.SetPidOffset(fPidOffset);
 
-   std::unique_ptr<char []> compressedBuffer;
+   std::optional<RKeyBuffer> compressedBuffer;
    auto storeBuffer = fBuffer;
    if (fObjlen > fNbytes-fKeylen) {
-      compressedBuffer.reset(new char[fNbytes]);
-      fBuffer = compressedBuffer.get();
+      compressedBuffer.emplace(fNbytes);
+      fBuffer = compressedBuffer->Get();
       ReadFile();                    //Read object structure from file
       memcpy(bufferRef.Buffer(),fBuffer,fKeylen);
    } else {
@@ -1094,7 +1165,7 @@ void *TKey::ReadObjectAny(const TClass* expectedClass)
 
    if (fObjlen > fNbytes-fKeylen) {
       char *objbuf = bufferRef.Buffer() + fKeylen;
-      UChar_t *bufcur = (UChar_t *)&compressedBuffer[fKeylen];
+      UChar_t *bufcur = (UChar_t *)compressedBuffer->Get() + fKeylen;
       Int_t nin, nout = 0, nbuf;
       Int_t noutot = 0;
       while (1) {
@@ -1159,18 +1230,19 @@ Int_t TKey::Read(TObject *obj)
 {
    if (!obj || (GetFile()==0)) return 0;
 
-   TBufferFile bufferRef(TBuffer::kRead, fObjlen+fKeylen);
+   RKeyBuffer recordBuffer(fObjlen+fKeylen);
+   TBufferFile bufferRef(TBuffer::kRead, fObjlen+fKeylen, recordBuffer.Get(), kFALSE);
    bufferRef.SetParent(GetFile());
    bufferRef.SetPidOffset(fPidOffset);
 
    if (fVersion > 1)
       bufferRef.MapObject(obj);  //register obj in map to handle self reference
 
-   std::unique_ptr<char []> compressedBuffer;
+   std::optional<RKeyBuffer> compressedBuffer;
    auto storeBuffer = fBuffer;
    if (fObjlen > fNbytes-fKeylen) {
-      compressedBuffer.reset(new char[fNbytes]);
-      fBuffer = compressedBuffer.get();
+      compressedBuffer.emplace(fNbytes);
+      fBuffer = compressedBuffer->Get();
       ReadFile();                    //Read object structure from file
       memcpy(bufferRef.Buffer(),fBuffer,fKeylen);
    } else {
@@ -1182,7 +1254,7 @@ Int_t TKey::Read(TObject *obj)
    bufferRef.SetBufferOffset(fKeylen);
    if (fObjlen > fNbytes-fKeylen) {
       char *objbuf = bufferRef.Buffer() + fKeylen;
-      UChar_t *bufcur = (UChar_t *)&compressedBuffer[fKeylen];
+      UChar_t *bufcur = (UChar_t *)compressedBuffer->Get() + fKeylen;
       Int_t nin, nout = 0, nbuf;
       Int_t noutot = 0;
       while (1) {
@@ -1289,6 +1361,39 @@ Bool_t TKey::ReadFile()
    return kTRUE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if the objects of this key and of `other` are stored with the
+/// same bytes, compressed or not, which implies that they are the same.
+///
+/// Only the raw records are read and compared, without decompressing or
+/// streaming them: e.g. tools comparing many histograms of two files can read
+/// only the objects that differ. Objects which are equal may still be stored
+/// with different bytes, e.g. when written with different compression
+/// settings, in which case this returns false.
+
+Bool_t TKey::HasSameObjectBytes(TKey &other)
+{
+   if (fClassName != other.fClassName || fObjlen != other.fObjlen || fPidOffset != other.fPidOffset ||
+       fNbytes - fKeylen != other.fNbytes - other.fKeylen)
+      return kFALSE;
+
+   auto readRecord = [](TKey &key) {
+      std::unique_ptr<char[]> record(new char[key.fNbytes]);
+      auto storeBuffer = key.fBuffer;
+      key.fBuffer = record.get();
+      const Bool_t ok = key.ReadFile();
+      key.fBuffer = storeBuffer;
+      if (!ok)
+         record.reset();
+      return record;
+   };
+   const auto record = readRecord(*this);
+   const auto otherRecord = record ? readRecord(other) : nullptr;
+   if (!otherRecord)
+      return kFALSE;
+   return memcmp(record.get() + fKeylen, otherRecord.get() + other.fKeylen, fNbytes - fKeylen) == 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set parent in key buffer.
 
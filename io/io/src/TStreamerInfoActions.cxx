@@ -211,6 +211,16 @@ namespace TStreamerInfoActions
       return 0;
    }
 
+   /// Read a fixed size array, or a group of consecutive data members of the same basic type merged by
+   /// TStreamerInfo::Compile, in a single call instead of going through the generic ReadBuffer switch.
+   template <typename T>
+   INLINE_TEMPLATE_ARGS Int_t ReadBasicArray(TBuffer &buf, void *addr, const TConfiguration *config)
+   {
+      T *x = (T*)( ((char*)addr) + config->fOffset );
+      buf.ReadFastArray(x, config->fLength);
+      return 0;
+   }
+
    void HandleReferencedTObject(TBuffer &buf, void *addr, const TConfiguration *config) {
       TBitsConfiguration *conf = (TBitsConfiguration*)config;
       UShort_t pidf;
@@ -256,6 +266,14 @@ namespace TStreamerInfoActions
       return 0;
    }
 
+   template <typename T>
+   INLINE_TEMPLATE_ARGS Int_t WriteBasicArray(TBuffer &buf, void *addr, const TConfiguration *config)
+   {
+      T *x = (T *)(((char *)addr) + config->fOffset);
+      buf.WriteFastArray(x, config->fLength);
+      return 0;
+   }
+
    INLINE_TEMPLATE_ARGS Int_t WriteTextTNamed(TBuffer &buf, void *addr, const TConfiguration *config)
    {
       void *x = (void *)(((char *)addr) + config->fOffset);
@@ -3291,6 +3309,20 @@ void TStreamerInfo::AddReadAction(TStreamerInfoActions::TActionSequence *readSeq
       case TStreamerInfo::kULong:   readSequence->AddAction( ReadBasicType<ULong_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) );   break;
       case TStreamerInfo::kULong64: readSequence->AddAction( ReadBasicType<ULong64_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
       case TStreamerInfo::kBits:    readSequence->AddAction( ReadBasicType<BitsMarker>, new TBitsConfiguration(this,i,compinfo,compinfo->fOffset) );     break;
+      // read arrays of basic types like array[8]
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kBool:     readSequence->AddAction( ReadBasicArray<Bool_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kChar:     readSequence->AddAction( ReadBasicArray<Char_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kShort:    readSequence->AddAction( ReadBasicArray<Short_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kInt:      readSequence->AddAction( ReadBasicArray<Int_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kLong:     readSequence->AddAction( ReadBasicArray<Long_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kLong64:   readSequence->AddAction( ReadBasicArray<Long64_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kFloat:    readSequence->AddAction( ReadBasicArray<Float_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kDouble:   readSequence->AddAction( ReadBasicArray<Double_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUChar:    readSequence->AddAction( ReadBasicArray<UChar_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUShort:   readSequence->AddAction( ReadBasicArray<UShort_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUInt:     readSequence->AddAction( ReadBasicArray<UInt_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kULong:    readSequence->AddAction( ReadBasicArray<ULong_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kULong64:  readSequence->AddAction( ReadBasicArray<ULong64_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
       case TStreamerInfo::kFloat16: {
          if (element->GetFactor() != 0) {
             readSequence->AddAction( ReadBasicType_WithFactor<float>, new TConfWithFactor(this,i,compinfo,compinfo->fOffset,element->GetFactor(),element->GetXmin()) );
@@ -3610,6 +3642,20 @@ void TStreamerInfo::AddWriteAction(TStreamerInfoActions::TActionSequence *writeS
       case TStreamerInfo::kUInt:    writeSequence->AddAction( WriteBasicType<UInt_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) );    break;
       case TStreamerInfo::kULong:   writeSequence->AddAction( WriteBasicType<ULong_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) );   break;
       case TStreamerInfo::kULong64: writeSequence->AddAction( WriteBasicType<ULong64_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      // write arrays of basic types like array[8]
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kBool:     writeSequence->AddAction( WriteBasicArray<Bool_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kChar:     writeSequence->AddAction( WriteBasicArray<Char_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kShort:    writeSequence->AddAction( WriteBasicArray<Short_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kInt:      writeSequence->AddAction( WriteBasicArray<Int_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kLong:     writeSequence->AddAction( WriteBasicArray<Long_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kLong64:   writeSequence->AddAction( WriteBasicArray<Long64_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kFloat:    writeSequence->AddAction( WriteBasicArray<Float_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kDouble:   writeSequence->AddAction( WriteBasicArray<Double_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUChar:    writeSequence->AddAction( WriteBasicArray<UChar_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUShort:   writeSequence->AddAction( WriteBasicArray<UShort_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUInt:     writeSequence->AddAction( WriteBasicArray<UInt_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kULong:    writeSequence->AddAction( WriteBasicArray<ULong_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kULong64:  writeSequence->AddAction( WriteBasicArray<ULong64_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
        // case TStreamerInfo::kBits:    writeSequence->AddAction( WriteBasicType<BitsMarker>, new TConfiguration(this,i,compinfo,compinfo->fOffset) );    break;
      /*case TStreamerInfo::kFloat16: {
          if (element->GetFactor() != 0) {
@@ -3,6 +3,8 @@
 #include "ROOT/RIoUring.hxx"
 #include "ROOT/RRawFileUnix.hxx"
 
+#include <algorithm>
+
 using RIoUring = ROOT::Internal::RIoUring;
 using RIOVec = RRawFile::RIOVec;
 using RRawFileUnix = ROOT::Internal::RRawFileUnix;
@@ -43,6 +45,36 @@ TEST(RRawFileUnix, ReadV)
    }
 }
 
+TEST(RRawFileUnix, ReadVRepeated)
+{
+   // Subsequent vector reads, also across files, share the same thread-local ring
+   FileRaii fileGuardA("test_uring_readv_a", std::string(2 << 20, 'a'));
+   FileRaii fileGuardB("test_uring_readv_b", std::string(2 << 20, 'b'));
+   auto fa = RRawFileUnix::Create("test_uring_readv_a");
+   auto fb = RRawFileUnix::Create("test_uring_readv_b");
+
+   for (int round = 0; round < 10; ++round) {
+      auto ioA = make_iovecs(100, 2 << 20);
+      auto ioB = make_iovecs(100, 2 << 20);
+      fa->ReadV(ioA.data(), ioA.size());
+      fb->ReadV(ioB.data(), ioB.size());
+      for (auto iovec : ioA) {
+         EXPECT_EQ(std::min<std::size_t>(iovec.fSize, (2 << 20) - iovec.fOffset), iovec.fOutBytes);
+         for (std::size_t i = 0; i < iovec.fOutBytes; ++i) {
+            EXPECT_EQ('a', ((unsigned char *)iovec.fBuffer)[i]);
+         }
+         free(iovec.fBuffer);
+      }
+      for (auto iovec : ioB) {
+         EXPECT_EQ(std::min<std::size_t>(iovec.fSize, (2 << 20) - iovec.fOffset), iovec.fOutBytes);
+         for (std::size_t i = 0; i < iovec.fOutBytes; ++i) {
+            EXPECT_EQ('b', ((unsigned char *)iovec.fBuffer)[i]);
+         }
+         free(iovec.fBuffer);
+      }
+   }
+}
+
 TEST(RawUring, NopRoundTrip)
 {
    struct io_uring ring;
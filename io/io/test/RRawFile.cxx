@@ -2,7 +2,13 @@
 
 #include "TFile.h"
 
+#include "TSystem.h"
+
+#include "ROOT/RRawFileCache.hxx"
+#include "ROOT/RRawFileCoalescing.hxx"
 #include "ROOT/RRawFileTFile.hxx"
+using ROOT::Internal::RRawFileCache;
+using ROOT::Internal::RRawFileCoalescing;
 using ROOT::Internal::RRawFileTFile;
 
 namespace {
@@ -148,6 +154,195 @@ TEST(RRawFile, ReadV)
 }
 
 
+TEST(RRawFile, Cache)
+{
+   const std::string cacheDir = "test_rrawfile_cache";
+   const auto blockSize = RRawFileCache::kCacheBlockSize;
+   std::string content(2 * blockSize + 100, 0);
+   for (std::size_t i = 0; i < content.size(); ++i)
+      content[i] = static_cast<char>(i % 251);
+
+   RRawFile::ROptions mockOptions;
+   mockOptions.fBlockSize = 0;
+   auto readThroughCache = [&](std::uint64_t maxCacheSize, unsigned &nRemoteReads) {
+      auto mock = std::make_unique<RRawFileMock>(content, mockOptions);
+      auto mockPtr = mock.get();
+      RRawFileCache f(std::move(mock), cacheDir, maxCacheSize, RRawFile::ROptions());
+      EXPECT_EQ(content.size(), f.GetSize());
+
+      std::string buffer(300, 0);
+      RRawFile::RIOVec iovec[2];
+      iovec[0].fBuffer = &buffer[0];
+      iovec[0].fOffset = blockSize - 100;
+      iovec[0].fSize = 200;
+      iovec[1].fBuffer = &buffer[200];
+      iovec[1].fOffset = 2 * blockSize;
+      iovec[1].fSize = 200;
+      f.ReadV(iovec, 2);
+      EXPECT_EQ(200u, iovec[0].fOutBytes);
+      EXPECT_EQ(100u, iovec[1].fOutBytes);
+      EXPECT_EQ(content.substr(blockSize - 100, 200), buffer.substr(0, 200));
+      EXPECT_EQ(content.substr(2 * blockSize, 100), buffer.substr(200, 100));
+      nRemoteReads = mockPtr->fNumReadAt;
+   };
+
+   // Size of the blocks in the cache directory, which is removed if requested
+   auto scanCacheDir = [&](bool remove) {
+      std::uint64_t size = 0;
+      void *dir = gSystem->OpenDirectory(cacheDir.c_str());
+      while (const char *entry = dir ? gSystem->GetDirEntry(dir) : nullptr) {
+         const auto path = cacheDir + "/" + entry;
+         FileStat_t stat;
+         if (std::string(entry) == "." || std::string(entry) == ".." || gSystem->GetPathInfo(path.c_str(), stat))
+            continue;
+         size += stat.fSize;
+         if (remove)
+            gSystem->Unlink(path.c_str());
+      }
+      if (dir)
+         gSystem->FreeDirectory(dir);
+      if (remove)
+         gSystem->Unlink(cacheDir.c_str());
+      return size;
+   };
+   scanCacheDir(true);
+
+   unsigned nRemoteReads = 0;
+   readThroughCache(10 * blockSize, nRemoteReads);
+   EXPECT_EQ(3u, nRemoteReads);
+   EXPECT_EQ(content.size(), scanCacheDir(false));
+   // All the blocks are served by the cache the second time
+   readThroughCache(10 * blockSize, nRemoteReads);
+   EXPECT_EQ(0u, nRemoteReads);
+   scanCacheDir(true);
+
+   // A cache that is too small is reduced after the missing blocks are fetched
+   readThroughCache(blockSize, nRemoteReads);
+   EXPECT_EQ(3u, nRemoteReads);
+   EXPECT_LE(scanCacheDir(false), blockSize);
+   readThroughCache(blockSize, nRemoteReads);
+   EXPECT_GT(nRemoteReads, 0u);
+   scanCacheDir(true);
+}
+
+TEST(RRawFile, Coalescing)
+{
+   RRawFile::ROptions mockOptions;
+   mockOptions.fBlockSize = 0;
+   auto mock = std::make_unique<RRawFileMock>("abcdefghijklmnopqrstuvwxyz", mockOptions);
+   auto mockPtr = mock.get();
+   RRawFileCoalescing f(std::move(mock), 2 /* maxGap */, 10 /* maxRangeSize */, RRawFile::ROptions());
+
+   char buffer[12] = {0};
+   RRawFile::RIOVec iovec[5];
+   // merged into "cdefg", given in reverse order
+   iovec[0].fBuffer = &buffer[0];
+   iovec[0].fOffset = 5;
+   iovec[0].fSize = 2;
+   iovec[1].fBuffer = &buffer[2];
+   iovec[1].fOffset = 2;
+   iovec[1].fSize = 2;
+   // gap too large: read on its own
+   iovec[2].fBuffer = &buffer[4];
+   iovec[2].fOffset = 12;
+   iovec[2].fSize = 2;
+   // merged into "wxyz", the second request is short at the end of the file
+   iovec[3].fBuffer = &buffer[6];
+   iovec[3].fOffset = 22;
+   iovec[3].fSize = 2;
+   iovec[4].fBuffer = &buffer[8];
+   iovec[4].fOffset = 25;
+   iovec[4].fSize = 3;
+   f.ReadV(iovec, 5);
+   EXPECT_EQ(3u, mockPtr->fNumReadAt);
+   EXPECT_EQ(2u, iovec[0].fOutBytes);
+   EXPECT_EQ(2u, iovec[1].fOutBytes);
+   EXPECT_EQ(2u, iovec[2].fOutBytes);
+   EXPECT_EQ(2u, iovec[3].fOutBytes);
+   EXPECT_EQ(1u, iovec[4].fOutBytes);
+   EXPECT_EQ(std::string("fgcdmnwxz"), std::string(buffer, 9));
+
+   // the maximum range size prevents merging
+   mockPtr->fNumReadAt = 0;
+   iovec[0].fOffset = 0;
+   iovec[0].fSize = 6;
+   iovec[1].fBuffer = &buffer[6];
+   iovec[1].fOffset = 6;
+   iovec[1].fSize = 6;
+   f.ReadV(iovec, 2);
+   EXPECT_EQ(2u, mockPtr->fNumReadAt);
+   EXPECT_EQ(std::string("abcdefghijkl"), std::string(buffer, 12));
+}
+
+TEST(RRawFile, IOStats)
+{
+   RRawFile::ROptions options;
+   options.fBlockSize = 4;
+   RRawFileMock f("abcdefghij", options);
+
+   char buffer[4];
+   EXPECT_EQ(2u, f.ReadAt(buffer, 2, 0));
+   EXPECT_EQ(2u, f.ReadAt(buffer, 2, 2));
+   EXPECT_EQ(1u, f.ReadAt(buffer, 2, 9));
+   RRawFile::RIOVec iovec[2];
+   iovec[0].fBuffer = &buffer[0];
+   iovec[0].fOffset = 0;
+   iovec[0].fSize = 1;
+   iovec[1].fBuffer = &buffer[1];
+   iovec[1].fOffset = 1;
+   iovec[1].fSize = 1;
+   f.ReadV(iovec, 2);
+
+   const auto &stats = f.GetIOStats();
+   EXPECT_EQ(3u, stats.fNReadAt);
+   EXPECT_EQ(1u, stats.fNBufferHits);
+   EXPECT_EQ(1u, stats.fNReadV);
+   EXPECT_EQ(2u, stats.fNReadVRequests);
+   EXPECT_EQ(7u, stats.fBytesRead);
+   std::uint64_t nCalls = 0;
+   for (auto n : stats.fLatencyHisto)
+      nCalls += n;
+   EXPECT_EQ(4u, nCalls);
+}
+
+TEST(RRawFile, Mmap)
+{
+   FileRaii mmapGuard("test_rawfile_mmap", "Hello, World");
+   RRawFile::ROptions options;
+   options.fUseMmap = true;
+   auto f = RRawFile::Create(mmapGuard.GetPath(), options);
+
+   char buffer[6] = {0};
+   EXPECT_EQ(5u, f->ReadAt(buffer, 5, 7));
+   EXPECT_STREQ("World", buffer);
+   // short read at the end of the file
+   EXPECT_EQ(2u, f->ReadAt(buffer, 5, 10));
+
+   RRawFile::RIOVec iovec[2];
+   iovec[0].fBuffer = &buffer[0];
+   iovec[0].fOffset = 0;
+   iovec[0].fSize = 1;
+   iovec[1].fBuffer = &buffer[1];
+   iovec[1].fOffset = 11;
+   iovec[1].fSize = 2;
+   f->ReadV(iovec, 2);
+   EXPECT_EQ(1U, iovec[0].fOutBytes);
+   EXPECT_EQ(1U, iovec[1].fOutBytes);
+   EXPECT_EQ('H', buffer[0]);
+   EXPECT_EQ('d', buffer[1]);
+
+#ifndef _WIN32
+   auto range = f->GetMappedRange(7, 5);
+   ASSERT_NE(nullptr, range);
+   EXPECT_EQ(0, memcmp(range, "World", 5));
+   EXPECT_EQ(nullptr, f->GetMappedRange(7, 6));
+#endif
+
+   // without the option, nothing is mapped
+   EXPECT_EQ(nullptr, RRawFile::Create(mmapGuard.GetPath())->GetMappedRange(0, 1));
+}
+
+
 TEST(RRawFile, SplitUrl)
 {
    EXPECT_STREQ("C:\\Data\\events.root", RRawFile::GetLocation("C:\\Data\\events.root").c_str());
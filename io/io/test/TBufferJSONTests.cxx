@@ -1,6 +1,8 @@
 #include "TBufferJSON.h"
 #include "TNamed.h"
+#include <cmath>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -47,3 +49,19 @@ TEST(TBufferJSON, utf8_3)
    EXPECT_EQ(str0, named1->GetTitle());
 }
 
+
+// check that numbers are written with the same representation as by printf
+TEST(TBufferJSON, IntegralNumbers)
+{
+   std::vector<double> vd{1., -3., 0., -0., 123456789012., 2.5, 1e20};
+   auto json = TBufferJSON::ToJSON(&vd, TBufferJSON::kNoSpaces);
+   EXPECT_EQ(std::string(json.Data()), "[1,-3,0,-0,123456789012,2.5,100000000000000000000]");
+   auto vd1 = TBufferJSON::FromJSON<std::vector<double>>(json.Data());
+   ASSERT_TRUE(vd1);
+   EXPECT_EQ(vd, *vd1);
+   EXPECT_TRUE(std::signbit((*vd1)[3]));
+
+   std::vector<int> vi{-2147483647 - 1, -5, 0, 7, 2147483647};
+   json = TBufferJSON::ToJSON(&vi, TBufferJSON::kNoSpaces);
+   EXPECT_EQ(std::string(json.Data()), "[-2147483648,-5,0,7,2147483647]");
+}
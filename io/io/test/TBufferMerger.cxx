@@ -4,6 +4,7 @@
 #include "ROOT/TTaskGroup.hxx"
 
 #include "TFile.h"
+#include "TNamed.h"
 #include "TROOT.h"
 #include "TTree.h"
 
@@ -11,7 +12,9 @@
 #include <cstdio>
 #include <future>
 #include <memory>
+#include <string>
 #include <thread>
+#include <vector>
 #include <sys/stat.h>
 
 #include "gtest/gtest.h"
@@ -170,6 +173,63 @@ TEST(TBufferMerger, CheckTreeFillResults)
    RemoveFile("tbuffermerger_parallel.root");
 }
 
+TEST(TBufferMerger, ParallelTreeFillCoalescedFastMerge)
+{
+   constexpr int nthreads = 8;
+   constexpr int nwrites = 4;
+   constexpr int nevents = 1000;
+
+   ROOT::EnableThreadSafety();
+
+   {
+      TBufferMerger merger("tbuffermerger_coalesced.root");
+      merger.SetMergeOptions("fast");
+      std::vector<std::thread> threads;
+      for (int i = 0; i < nthreads; ++i) {
+         threads.emplace_back([=, &merger]() {
+            auto myfile = merger.GetFile();
+            auto mytree = new TTree("mytree", "mytree");
+            mytree->ResetBit(kMustCleanup);
+
+            int n = 0;
+            mytree->Branch("n", &n, "n/I");
+            for (int w = 0; w < nwrites; ++w) {
+               for (int j = 0; j < nevents; ++j) {
+                  n = (i * nwrites + w) * nevents + j;
+                  mytree->Fill();
+               }
+               myfile->Write();
+            }
+            mytree->ResetBranchAddresses();
+         });
+      }
+
+      for (auto &&t : threads)
+         t.join();
+   }
+
+   ASSERT_TRUE(FileExists("tbuffermerger_coalesced.root"));
+
+   {
+      TFile f("tbuffermerger_coalesced.root");
+      std::unique_ptr<TTree> t{f.Get<TTree>("mytree")};
+      ASSERT_TRUE(t != nullptr);
+      constexpr Long64_t ntotal = nthreads * nwrites * nevents;
+      EXPECT_EQ(ntotal, t->GetEntries());
+
+      int n = 0;
+      Long64_t sum = 0;
+      t->SetBranchAddress("n", &n);
+      for (Long64_t i = 0; i < t->GetEntries(); ++i) {
+         t->GetEntry(i);
+         sum += n;
+      }
+      EXPECT_EQ(ntotal * (ntotal - 1) / 2, sum);
+   }
+
+   RemoveFile("tbuffermerger_coalesced.root");
+}
+
 /**
  * \test TBufferMerger, SetMaxTreeSize
  * \brief Test to avoid issue #6523.
@@ -224,3 +284,46 @@ TEST(TBufferMerger, SetMaxTreeSize)
 
    RemoveFile("tbuffermerger_setmaxtreesize.root");
 }
+
+TEST(TBufferMerger, ParallelWriteTObject)
+{
+   ROOT::EnableThreadSafety();
+
+   const int nthreads = 4;
+   const int nobjects = 25;
+
+   {
+      TBufferMerger merger("tbuffermerger_writetobject.root");
+
+      std::vector<std::thread> threads;
+      for (int t = 0; t < nthreads; ++t) {
+         threads.emplace_back([&merger, t]() {
+            for (int i = 0; i < nobjects; ++i) {
+               const std::string name = "obj_" + std::to_string(t) + "_" + std::to_string(i);
+               TNamed obj(name.c_str(), std::to_string(t * nobjects + i).c_str());
+               EXPECT_GT(merger.WriteTObject(&obj), 0);
+            }
+         });
+      }
+
+      for (auto &&thread : threads)
+         thread.join();
+   }
+
+   EXPECT_TRUE(FileExists("tbuffermerger_writetobject.root"));
+
+   {
+      TFile f{"tbuffermerger_writetobject.root"};
+      EXPECT_EQ(f.GetListOfKeys()->GetSize(), nthreads * nobjects);
+      for (int t = 0; t < nthreads; ++t) {
+         for (int i = 0; i < nobjects; ++i) {
+            const std::string name = "obj_" + std::to_string(t) + "_" + std::to_string(i);
+            std::unique_ptr<TNamed> obj{f.Get<TNamed>(name.c_str())};
+            ASSERT_NE(obj, nullptr);
+            EXPECT_EQ(std::string(obj->GetTitle()), std::to_string(t * nobjects + i));
+         }
+      }
+   }
+
+   RemoveFile("tbuffermerger_writetobject.root");
+}
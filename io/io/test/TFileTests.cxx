@@ -1,9 +1,12 @@
+#include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "gtest/gtest.h"
 
 #include "TFile.h"
+#include "TH1D.h"
 #include "TKey.h"
 #include "TNamed.h"
 #include "TPluginManager.h"
@@ -135,3 +138,181 @@ TEST(TFile, ReadWithoutGlobalRegistrationNet)
    const auto netFile = "root://eospublic.cern.ch//eos/root-eos/h1/dstarmb.root";
    TestReadWithoutGlobalRegistrationIfPossible(netFile);
 }
+
+TEST(TFile, KeyHasSameObjectBytes)
+{
+   auto filename{"tfile_key_same_object_bytes.root"};
+   {
+      TFile f{filename, "recreate"};
+      TNamed a{"a", "some title"};
+      TNamed c{"c", "another title"};
+      f.WriteObject(&a, "a");
+      f.WriteObject(&a, "a2");
+      f.WriteObject(&c, "c");
+      f.Close();
+   }
+
+   TFile input{filename};
+   auto keyA = input.GetKey("a");
+   auto keyA2 = input.GetKey("a2");
+   auto keyC = input.GetKey("c");
+   ASSERT_TRUE(keyA && keyA2 && keyC);
+   EXPECT_TRUE(keyA->HasSameObjectBytes(*keyA2));
+   EXPECT_FALSE(keyA->HasSameObjectBytes(*keyC));
+
+   input.Close();
+   gSystem->Unlink(filename);
+}
+
+TEST(TFile, ReadAllCompressedAndUncompressed)
+{
+   auto filename{"tfile_readall.root"};
+   constexpr int nHistos = 50;
+   {
+      TFile f{filename, "recreate"};
+      for (int i = 0; i < nHistos; ++i) {
+         // mix compressed and uncompressed records
+         f.SetCompressionSettings(i % 5 == 0 ? 0 : 101);
+         TH1D h{("h" + std::to_string(i)).c_str(), "", 500, 0, 1};
+         h.SetDirectory(nullptr);
+         h.Fill(0.5, i + 1);
+         f.WriteObject(&h, h.GetName());
+      }
+      f.Close();
+   }
+
+   TFile input{filename};
+   input.ReadAll();
+   ASSERT_EQ(input.GetList()->GetEntries(), nHistos);
+   for (int i = 0; i < nHistos; ++i) {
+      auto h = dynamic_cast<TH1D *>(input.GetList()->FindObject(("h" + std::to_string(i)).c_str()));
+      ASSERT_NE(h, nullptr);
+      EXPECT_EQ(h->GetNbinsX(), 500);
+      EXPECT_EQ(h->GetBinContent(h->FindBin(0.5)), i + 1);
+   }
+   // reading again replaces the objects in memory
+   input.ReadAll();
+   EXPECT_EQ(input.GetList()->GetEntries(), nHistos);
+
+   input.Close();
+   gSystem->Unlink(filename);
+}
+
+TEST(TFile, OpenReadsKeysAndStreamerInfo)
+{
+   auto filename{"tfile_open_keys_streamerinfo.root"};
+   {
+      TFile f{filename, "recreate"};
+      TH1D h{"h", "", 10, 0, 1};
+      h.SetDirectory(nullptr);
+      TNamed n{"n", "title"};
+      f.WriteObject(&h, "h");
+      f.WriteObject(&n, "n");
+      f.Close();
+   }
+
+   TFile input{filename};
+   ASSERT_FALSE(input.IsZombie());
+   // the read cache used while opening the file is released
+   EXPECT_EQ(input.GetCacheRead(), nullptr);
+   EXPECT_EQ(input.GetNkeys(), 2);
+   std::unique_ptr<TList> infos{input.GetStreamerInfoList()};
+   ASSERT_NE(infos, nullptr);
+   EXPECT_NE(infos->FindObject("TH1D"), nullptr);
+   auto h = input.Get<TH1D>("h");
+   ASSERT_NE(h, nullptr);
+   EXPECT_EQ(h->GetNbinsX(), 10);
+
+   input.Close();
+   gSystem->Unlink(filename);
+}
+
+TEST(TFile, ReadKeysOfDifferentSizes)
+{
+   auto filename{"tfile_read_keys_sizes.root"};
+   const std::vector<int> nBins{10, 100000, 1000, 10, 50000, 1000};
+   {
+      TFile f{filename, "recreate"};
+      for (std::size_t i = 0; i < nBins.size(); ++i) {
+         f.SetCompressionSettings(i % 2 == 0 ? 101 : 0);
+         TH1D h{("h" + std::to_string(i)).c_str(), "", nBins[i], 0, 1};
+         h.SetDirectory(nullptr);
+         h.SetBinContent(nBins[i], i + 1);
+         f.WriteObject(&h, h.GetName());
+      }
+      f.Close();
+   }
+
+   TFile input{filename};
+   // buffers of the same size are reused across reads, check that no stale content leaks between the objects
+   for (int pass = 0; pass < 2; ++pass) {
+      for (std::size_t i = 0; i < nBins.size(); ++i) {
+         auto key = input.GetKey(("h" + std::to_string(i)).c_str());
+         ASSERT_NE(key, nullptr);
+         std::unique_ptr<TH1D> h{pass == 0 ? dynamic_cast<TH1D *>(key->ReadObj()) : key->ReadObject<TH1D>()};
+         ASSERT_NE(h, nullptr);
+         h->SetDirectory(nullptr);
+         EXPECT_EQ(h->GetNbinsX(), nBins[i]);
+         EXPECT_EQ(h->GetBinContent(nBins[i]), static_cast<double>(i + 1));
+         EXPECT_EQ(h->GetBinContent(1), 0);
+      }
+   }
+
+   input.Close();
+   gSystem->Unlink(filename);
+}
+
+TEST(TFile, ReadMapsOfFundamentalTypes)
+{
+   auto filename{"tfile_read_maps.root"};
+   std::map<int, double> intToDouble;
+   std::map<Long64_t, float> longToFloat;
+   for (int i = 0; i < 1000; ++i) {
+      intToDouble[i * 7 - 300] = 0.5 * i;
+      longToFloat[(Long64_t(1) << 40) + i] = -1.f * i;
+   }
+   {
+      TFile f{filename, "recreate"};
+      f.WriteObject(&intToDouble, "intToDouble");
+      f.WriteObject(&longToFloat, "longToFloat");
+      f.Close();
+   }
+
+   TFile input{filename};
+   std::unique_ptr<std::map<int, double>> readIntToDouble{input.Get<std::map<int, double>>("intToDouble")};
+   ASSERT_NE(readIntToDouble, nullptr);
+   EXPECT_EQ(*readIntToDouble, intToDouble);
+   std::unique_ptr<std::map<Long64_t, float>> readLongToFloat{input.Get<std::map<Long64_t, float>>("longToFloat")};
+   ASSERT_NE(readLongToFloat, nullptr);
+   EXPECT_EQ(*readLongToFloat, longToFloat);
+
+   input.Close();
+   gSystem->Unlink(filename);
+}
+
+TEST(TFile, CloseDeletesObjectsAndSubdirectories)
+{
+   auto filename{"tfile_close_subdirectories.root"};
+   {
+      TFile f{filename, "recreate"};
+      auto sub = f.mkdir("sub");
+      sub->cd();
+      for (int i = 0; i < 10; ++i)
+         new TH1D(("hsub" + std::to_string(i)).c_str(), "", 10, 0, 1);
+      f.cd();
+      for (int i = 0; i < 1000; ++i)
+         new TH1D(("h" + std::to_string(i)).c_str(), "", 10, 0, 1);
+      f.Write();
+      f.Close();
+      EXPECT_EQ(f.GetList()->GetSize(), 0);
+   }
+
+   TFile input{filename};
+   EXPECT_EQ(input.GetListOfKeys()->GetSize(), 1001);
+   auto sub = input.Get<TDirectory>("sub");
+   ASSERT_NE(sub, nullptr);
+   EXPECT_EQ(sub->GetListOfKeys()->GetSize(), 10);
+
+   input.Close();
+   gSystem->Unlink(filename);
+}
@@ -20,7 +20,11 @@ int main(int argc, char **argv)
    if (!args.fShouldRun)
       return 1; // ParseArgs has printed the --help, has run the --test or has encountered an issue and logged about it
 
-   PrintThroughput(EvalThroughput(args.fData, args.fNThreads));
+   const auto result = EvalThroughput(args.fData, args.fNThreads);
+   if (args.fJSONOutput)
+      PrintThroughputJSON(result, args.fData);
+   else
+      PrintThroughput(result);
 
    return 0;
 }
@@ -0,0 +1,100 @@
+// @(#)root/fft:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "FFTWPlanCache.h"
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+
+namespace {
+
+/// Allocates the arrays a plan is created on, and frees them once the plan exists
+class RScratchArrays {
+   void *fIn = nullptr;
+   void *fOut = nullptr;
+
+public:
+   RScratchArrays(std::size_t inBytes, std::size_t outBytes, bool inPlace)
+   {
+      fIn = fftw_malloc(inBytes);
+      fOut = inPlace ? fIn : fftw_malloc(outBytes);
+   }
+   RScratchArrays(const RScratchArrays &) = delete;
+   RScratchArrays &operator=(const RScratchArrays &) = delete;
+   ~RScratchArrays()
+   {
+      if (fOut != fIn)
+         fftw_free(fOut);
+      fftw_free(fIn);
+   }
+
+   void *GetIn() const { return fIn; }
+   void *GetOut() const { return fOut; }
+};
+
+fftw_plan CreatePlan(const ROOT::Internal::FFTW::RPlanKey &key)
+{
+   using ROOT::Internal::FFTW::RPlanKey;
+
+   const int ndim = key.fN.size();
+   const int *n = key.fN.data();
+   std::size_t totalSize = 1;
+   for (int ni : key.fN)
+      totalSize *= ni;
+   // Number of complex values of the Hermitian half of real to complex transforms
+   const std::size_t halfSize = totalSize / n[ndim - 1] * (n[ndim - 1] / 2 + 1);
+
+   switch (key.fType) {
+   case RPlanKey::kC2C: {
+      RScratchArrays arrays(sizeof(fftw_complex) * totalSize, sizeof(fftw_complex) * totalSize, key.fInPlace);
+      return fftw_plan_dft(ndim, n, static_cast<fftw_complex *>(arrays.GetIn()),
+                           static_cast<fftw_complex *>(arrays.GetOut()), key.fSign, key.fFlags);
+   }
+   case RPlanKey::kR2C: {
+      const auto inBytes = key.fInPlace ? sizeof(fftw_complex) * halfSize : sizeof(double) * totalSize;
+      RScratchArrays arrays(inBytes, sizeof(fftw_complex) * halfSize, key.fInPlace);
+      return fftw_plan_dft_r2c(ndim, n, static_cast<double *>(arrays.GetIn()),
+                               static_cast<fftw_complex *>(arrays.GetOut()), key.fFlags);
+   }
+   case RPlanKey::kC2R: {
+      RScratchArrays arrays(sizeof(fftw_complex) * halfSize, sizeof(double) * totalSize, key.fInPlace);
+      return fftw_plan_dft_c2r(ndim, n, static_cast<fftw_complex *>(arrays.GetIn()),
+                               static_cast<double *>(arrays.GetOut()), key.fFlags);
+   }
+   case RPlanKey::kR2R: {
+      std::vector<fftw_r2r_kind> kinds(key.fKinds.size());
+      for (std::size_t i = 0; i < key.fKinds.size(); ++i)
+         kinds[i] = static_cast<fftw_r2r_kind>(key.fKinds[i]);
+      RScratchArrays arrays(sizeof(double) * totalSize, sizeof(double) * totalSize, key.fInPlace);
+      return fftw_plan_r2r(ndim, n, static_cast<double *>(arrays.GetIn()), static_cast<double *>(arrays.GetOut()),
+                           kinds.data(), key.fFlags);
+   }
+   }
+   return nullptr;
+}
+
+} // anonymous namespace
+
+fftw_plan ROOT::Internal::FFTW::GetPlan(const RPlanKey &key)
+{
+   // The FFTW planner is not thread-safe, so the plans are also created under the lock
+   static std::mutex gMutex;
+   static std::map<RPlanKey, fftw_plan> gPlans;
+
+   std::lock_guard<std::mutex> lock(gMutex);
+   auto itr = gPlans.find(key);
+   if (itr != gPlans.end())
+      return itr->second;
+   auto plan = CreatePlan(key);
+   if (plan)
+      gPlans.emplace(key, plan);
+   return plan;
+}
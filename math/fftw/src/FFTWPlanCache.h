@@ -0,0 +1,52 @@
+// @(#)root/fft:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_FFTWPlanCache
+#define ROOT_FFTWPlanCache
+
+#include "fftw3.h"
+
+#include <tuple>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace FFTW {
+
+/// Identifies an FFTW plan independently of the arrays it is executed on
+struct RPlanKey {
+   enum EType { kC2C, kR2C, kC2R, kR2R };
+
+   EType fType;
+   int fSign;               ///< Direction of complex to complex transforms, 0 otherwise
+   unsigned fFlags;         ///< Planner flags
+   bool fInPlace;
+   std::vector<int> fN;     ///< Transform sizes in each dimension
+   std::vector<int> fKinds; ///< fftw_r2r_kind in each dimension for real to real transforms, empty otherwise
+
+   bool operator<(const RPlanKey &other) const
+   {
+      return std::tie(fType, fSign, fFlags, fInPlace, fN, fKinds) <
+             std::tie(other.fType, other.fSign, other.fFlags, other.fInPlace, other.fN, other.fKinds);
+   }
+};
+
+/// Returns the plan for the given key, creating it on first use. The plans are created on scratch arrays, so
+/// planning does not overwrite the data of the caller, and they are shared by all the transform objects of the same
+/// size and type. They must be run with the new-array execute functions (fftw_execute_dft() etc.) on arrays
+/// allocated by fftw_malloc(), which all have the same alignment. The plans live until the end of the process.
+/// Thread-safe.
+fftw_plan GetPlan(const RPlanKey &key);
+
+} // namespace FFTW
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -32,14 +32,15 @@
 /// function and continue with steps 3)-5)
 ///
 /// NOTE:
-///       1. running Init() function will overwrite the input array! Don't set any data
-///          before running the Init() function
+///       1. the plans are created on separate arrays and cached for each size, type and
+///          flags, so running the Init() function does not modify the data
 ///       2. FFTW computes unnormalized transform, so doing a transform followed by
 ///          its inverse will lead to the original array scaled by the transform size
 ///
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "TFFTComplex.h"
+#include "FFTWPlanCache.h"
 #include "fftw3.h"
 #include "TComplex.h"
 
@@ -102,13 +103,12 @@ TFFTComplex::TFFTComplex(Int_t ndim, Int_t *n, Bool_t inPlace)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-///Destroys the data arrays and the plan. However, some plan information stays around
-///until the root session is over, and is reused if other plans of the same size are
-///created
+///Destroys the data arrays. The plan stays around until the root session is over,
+///and is reused if other transforms of the same size and type are created
 
 TFFTComplex::~TFFTComplex()
 {
-   fftw_destroy_plan((fftw_plan)fPlan);
+   // the plan is owned by the plan cache
    fPlan = nullptr;
    fftw_free((fftw_complex*)fIn);
    if (fOut)
@@ -120,8 +120,8 @@ TFFTComplex::~TFFTComplex()
 ////////////////////////////////////////////////////////////////////////////////
 ///Creates the fftw-plan
 ///
-///NOTE:  input and output arrays are overwritten during initialisation,
-///       so don't set any points, before running this function!!!!!
+///NOTE:  the plan is created on separate arrays, so the input and output arrays are
+///       not modified; it is shared with all the transforms of the same size, type and flags
 ///
 ///2nd parameter: +1
 ///
@@ -142,14 +142,9 @@ void TFFTComplex::Init( Option_t *flags, Int_t sign,const Int_t* /*kind*/)
    fSign = sign;
    fFlags = flags;
 
-   if (fPlan)
-      fftw_destroy_plan((fftw_plan)fPlan);
-   fPlan = nullptr;
-
-   if (fOut)
-      fPlan = (void*)fftw_plan_dft(fNdim, fN, (fftw_complex*)fIn, (fftw_complex*)fOut, sign,MapFlag(flags));
-   else
-      fPlan = (void*)fftw_plan_dft(fNdim, fN, (fftw_complex*)fIn, (fftw_complex*)fIn, sign, MapFlag(flags));
+   using ROOT::Internal::FFTW::RPlanKey;
+   fPlan = (void*)ROOT::Internal::FFTW::GetPlan(
+      RPlanKey{RPlanKey::kC2C, sign, MapFlag(flags), !fOut, std::vector<int>(fN, fN + fNdim), {}});
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -158,7 +153,7 @@ void TFFTComplex::Init( Option_t *flags, Int_t sign,const Int_t* /*kind*/)
 void TFFTComplex::Transform()
 {
    if (fPlan)
-      fftw_execute((fftw_plan)fPlan);
+      fftw_execute_dft((fftw_plan)fPlan, (fftw_complex*)fIn, fOut ? (fftw_complex*)fOut : (fftw_complex*)fIn);
    else {
       Error("Transform", "transform not initialised");
       return;
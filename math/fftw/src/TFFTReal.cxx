@@ -37,8 +37,8 @@
 /// rerun the Init() function and continue with steps 3)-5)
 ///
 /// NOTE:
-///       1. running Init() function will overwrite the input array! Don't set any data
-///          before running the Init() function!
+///       1. the plans are created on separate arrays and cached for each size, type and
+///          flags, so running the Init() function does not modify the data
 ///       2. FFTW computes unnormalized transform, so doing a transform followed by
 ///          its inverse will lead to the original array scaled BY:
 ///          - transform size (N) for R2HC, HC2R, DHT transforms
@@ -59,6 +59,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "TFFTReal.h"
+#include "FFTWPlanCache.h"
 #include "fftw3.h"
 
 ClassImp(TFFTReal);
@@ -123,7 +124,7 @@ TFFTReal::TFFTReal(Int_t ndim, Int_t *n, Bool_t inPlace)
 
 TFFTReal::~TFFTReal()
 {
-   fftw_destroy_plan((fftw_plan)fPlan);
+   // the plan is owned by the plan cache
    fPlan = nullptr;
    fftw_free(fIn);
    fIn = nullptr;
@@ -142,8 +143,8 @@ TFFTReal::~TFFTReal()
 ////////////////////////////////////////////////////////////////////////////////
 ///Creates the fftw-plan
 ///
-///NOTE:  input and output arrays are overwritten during initialisation,
-///       so don't set any points, before running this function!!!!!
+///NOTE:  the plan is created on separate arrays, so the input and output arrays are
+///       not modified; it is shared with all the transforms of the same size, type and flags
 ///
 /// #### 1st parameter:
 ///    Possible flag_options:
@@ -175,18 +176,17 @@ TFFTReal::~TFFTReal()
 
 void TFFTReal::Init( Option_t* flags,Int_t /*sign*/, const Int_t *kind)
 {
-   if (fPlan)
-      fftw_destroy_plan((fftw_plan)fPlan);
    fPlan = nullptr;
 
    if (!fKind)
       fKind = (fftw_r2r_kind*)fftw_malloc(sizeof(fftw_r2r_kind)*fNdim);
 
    if (MapOptions(kind)){
-      if (fOut)
-         fPlan = (void*)fftw_plan_r2r(fNdim, fN, (Double_t*)fIn, (Double_t*)fOut, (fftw_r2r_kind*)fKind, MapFlag(flags));
-      else
-         fPlan = (void*)fftw_plan_r2r(fNdim, fN, (Double_t*)fIn, (Double_t*)fIn, (fftw_r2r_kind*)fKind, MapFlag(flags));
+      using ROOT::Internal::FFTW::RPlanKey;
+      const fftw_r2r_kind *kinds = (fftw_r2r_kind*)fKind;
+      fPlan = (void*)ROOT::Internal::FFTW::GetPlan(RPlanKey{RPlanKey::kR2R, 0, MapFlag(flags), !fOut,
+                                                             std::vector<int>(fN, fN + fNdim),
+                                                             std::vector<int>(kinds, kinds + fNdim)});
       fFlags = flags;
    }
 }
@@ -197,7 +197,7 @@ void TFFTReal::Init( Option_t* flags,Int_t /*sign*/, const Int_t *kind)
 void TFFTReal::Transform()
 {
    if (fPlan)
-      fftw_execute((fftw_plan)fPlan);
+      fftw_execute_r2r((fftw_plan)fPlan, (Double_t*)fIn, fOut ? (Double_t*)fOut : (Double_t*)fIn);
    else {
       Error("Transform", "transform hasn't been initialised");
       return;
@@ -34,8 +34,8 @@
 /// rerun the Init() function and continue with steps 3)-5)
 ///
 /// NOTE:
-///       1. running Init() function will overwrite the input array! Don't set any data
-///          before running the Init() function
+///       1. the plans are created on separate arrays and cached for each size, type and
+///          flags, so running the Init() function does not modify the data
 ///       2. FFTW computes unnormalized transform, so doing a transform followed by
 ///          its inverse will lead to the original array scaled by the transform size
 ///
@@ -43,6 +43,7 @@
 /////////////////////////////////////////////////////////////////////////////////
 
 #include "TFFTRealComplex.h"
+#include "FFTWPlanCache.h"
 #include "fftw3.h"
 #include "TComplex.h"
 
@@ -112,13 +113,12 @@ TFFTRealComplex::TFFTRealComplex(Int_t ndim, Int_t *n, Bool_t inPlace)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-///Destroys the data arrays and the plan. However, some plan information stays around
-///until the root session is over, and is reused if other plans of the same size are
-///created
+///Destroys the data arrays. The plan stays around until the root session is over,
+///and is reused if other transforms of the same size and type are created
 
 TFFTRealComplex::~TFFTRealComplex()
 {
-   fftw_destroy_plan((fftw_plan)fPlan);
+   // the plan is owned by the plan cache
    fPlan = nullptr;
    fftw_free(fIn);
    fIn = nullptr;
@@ -133,8 +133,8 @@ TFFTRealComplex::~TFFTRealComplex()
 ////////////////////////////////////////////////////////////////////////////////
 ///Creates the fftw-plan
 ///
-///NOTE:  input and output arrays are overwritten during initialisation,
-///       so don't set any points, before running this function!!!!!
+///NOTE:  the plan is created on separate arrays, so the input and output arrays are
+///       not modified; it is shared with all the transforms of the same size, type and flags
 ///
 ///Arguments sign and kind are dummy and not need to be specified
 ///Possible flag_options:
@@ -153,14 +153,9 @@ void TFFTRealComplex::Init(Option_t *flags,Int_t /*sign*/, const Int_t* /*kind*/
 {
    fFlags = flags;
 
-   if (fPlan)
-      fftw_destroy_plan((fftw_plan)fPlan);
-   fPlan = nullptr;
-
-   if (fOut)
-      fPlan = (void*)fftw_plan_dft_r2c(fNdim, fN, (Double_t*)fIn, (fftw_complex*)fOut,MapFlag(flags));
-   else
-      fPlan = (void*)fftw_plan_dft_r2c(fNdim, fN, (Double_t*)fIn, (fftw_complex*)fIn, MapFlag(flags));
+   using ROOT::Internal::FFTW::RPlanKey;
+   fPlan = (void*)ROOT::Internal::FFTW::GetPlan(
+      RPlanKey{RPlanKey::kR2C, 0, MapFlag(flags), !fOut, std::vector<int>(fN, fN + fNdim), {}});
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -170,7 +165,7 @@ void TFFTRealComplex::Transform()
 {
 
    if (fPlan){
-      fftw_execute((fftw_plan)fPlan);
+      fftw_execute_dft_r2c((fftw_plan)fPlan, (Double_t*)fIn, fOut ? (fftw_complex*)fOut : (fftw_complex*)fIn);
    }
    else {
       Error("Transform", "transform hasn't been initialised");
@@ -18,6 +18,8 @@
 
 #include "Math/VirtualIntegrator.h"
 
+#include "ROOT/EExecutionPolicy.hxx"
+
 namespace ROOT {
 namespace Math {
 
@@ -67,6 +69,11 @@ For a more detailed description of the method see References.
      subregion, the routine requires function evaluations.
      Careful programming of the integrand might result in substantial saving
      of time.
+     The function values at the nodes of a subregion, and of both halves when a subregion is divided, are
+     computed with one call to IBaseFunctionMultiDim::EvalBatch(), so integrands that re-implement it can
+     evaluate the block of points efficiently. With the ROOT::EExecutionPolicy::kMultiThread execution policy
+     (see SetExecutionPolicy()) the blocks are split among the threads of the ROOT thread pool; the integrand
+     must then be thread-safe. The result does not depend on the execution policy.
   2..Numerical integration usually works best for smooth functions.
      Some analysis or suitable transformations of the integral prior to
      numerical work may contribute to numerical efficiency.
@@ -166,6 +173,13 @@ public:
    ///set max points
    void SetMaxPts(unsigned int n) { fMaxPts = n; }
 
+   /// set the execution policy used for evaluating the integrand: ROOT::EExecutionPolicy::kSequential (default)
+   /// or ROOT::EExecutionPolicy::kMultiThread, which requires IMT and a thread-safe integrand
+   void SetExecutionPolicy(ROOT::EExecutionPolicy policy) { fExecutionPolicy = policy; }
+
+   /// return the execution policy used for evaluating the integrand
+   ROOT::EExecutionPolicy ExecutionPolicy() const { return fExecutionPolicy; }
+
    /// set the options
    void SetOptions(const ROOT::Math::IntegratorMultiDimOptions & opt) override;
 
@@ -194,6 +208,8 @@ protected:
 
    const IMultiGenFunction* fFun;   // pointer to integrand function
 
+   ROOT::EExecutionPolicy fExecutionPolicy = ROOT::EExecutionPolicy::kSequential; ///< policy for evaluating the integrand
+
 };
 
 }//namespace Math
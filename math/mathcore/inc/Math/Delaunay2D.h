@@ -140,6 +140,9 @@ public:
    /// See the class documentation for  how the interpolation is computed.
    double  Interpolate(double x, double y);
 
+   /// Interpolate the z values of the n points (x[i], y[i]) into z[i], see Interpolate(double, double).
+   void    Interpolate(int n, const double *x, const double *y, double *z);
+
    /// Find all triangles
    void      FindAllTriangles();
 
@@ -223,10 +226,11 @@ protected:
    std::vector<double> fXN; ///<! normalized X
    std::vector<double> fYN; ///<! normalized Y
 
-   static const int fNCells = 25; ///<! number of cells to divide the normalized space
+   int fNCells = 25; ///<! number of cells dividing each axis of the normalized space, grows with the triangles
    double fXCellStep; ///<! inverse denominator to calculate X cell = fNCells / (fXNmax - fXNmin)
    double fYCellStep; ///<! inverse denominator to calculate X cell = fNCells / (fYNmax - fYNmin)
-   std::set<unsigned int> fCells[(fNCells+1)*(fNCells+1)]; ///<! grid cells with containing triangles
+   std::vector<unsigned int> fCellStart; ///<! start of the triangles of each grid cell in fCellTriangles
+   std::vector<unsigned int> fCellTriangles; ///<! triangles overlapping each grid cell, stored cell after cell
 
    inline unsigned int Cell(unsigned int x, unsigned int y) const {
       return x*(fNCells+1) + y;
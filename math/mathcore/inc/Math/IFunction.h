@@ -78,6 +78,12 @@ namespace ROOT {
          /// Use the pure virtual private method DoEval which must be implemented by the sub-classes.
          T operator()(const T *x) const { return DoEval(x); }
 
+         /// Evaluate the function at npoints points, whose coordinates are stored one point after the other in x
+         /// (npoints * NDim() values), and write the values in result[].
+         /// Use the virtual private method DoEvalBatch, which by default calls DoEval for each point. Derived classes
+         /// can re-implement it when a block of points can be evaluated more efficiently than point by point.
+         void EvalBatch(unsigned int npoints, const T *x, T *result) const { DoEvalBatch(npoints, x, result); }
+
 #ifdef LATER
          /// Template method to evaluate the function using the begin of an iterator.
          /// User is responsible to provide correct size for the iterator.
@@ -93,6 +99,14 @@ namespace ROOT {
 
          /// Implementation of the evaluation function. Must be implemented by derived classes.
          virtual T DoEval(const T *x) const = 0;
+
+         /// Implementation of the evaluation at a block of points
+         virtual void DoEvalBatch(unsigned int npoints, const T *x, T *result) const
+         {
+            const unsigned int ndim = NDim();
+            for (unsigned int i = 0; i < npoints; ++i)
+               result[i] = DoEval(x + i * ndim);
+         }
       };
 
 
@@ -23,6 +23,11 @@
 // ROOT include(s)
 #include "RtypesCore.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
 namespace ROOT
 {
   namespace Math
@@ -271,7 +276,10 @@ namespace ROOT
            BinNode*                                ConvertToBinNode();
            virtual const BinNode*                  FindNode(const point_type&) const {return this;}
            virtual Bool_t                          Insert(const point_type& rPoint);
-           void                                    Split();
+           void                                    AddPoint(const point_type& rPoint);
+           Bool_t                                  IsFull() const;
+           TerminalNode*                           Split();
+           void                                    SplitUntilNotFull();
            void                                    SetOwner(Bool_t bIsOwner = true) {fOwnData = bIsOwner;}
            void                                    SetSplitOption(eSplitOption opt) {fSplitOption = opt;}
            data_it                                 SplitEffectiveEntries();
@@ -341,14 +349,19 @@ namespace ROOT
         void            Freeze();
         Double_t        GetBucketSize() const {return fBucketSize;}
         void            GetClosestPoints(const point_type& rRef,UInt_t nPoints,std::vector<std::pair<const _DataPoint*,Double_t> >& vFoundPoints) const;
+        void            GetClosestPoints(const std::vector<const point_type*>& vRefs,UInt_t nPoints,
+                                         std::vector<std::vector<std::pair<const _DataPoint*,Double_t> > >& vFoundPoints) const;
         Double_t         GetEffectiveEntries() const;
         KDTree<_DataPoint>* GetFrozenCopy();
         UInt_t          GetNBins() const;
         UInt_t          GetEntries() const;
         void            GetPointsWithinDist(const point_type& rRef,value_type fDist,std::vector<const point_type*>& vFoundPoints) const;
+        void            GetPointsWithinDist(const std::vector<const point_type*>& vRefs,value_type fDist,
+                                            std::vector<std::vector<const point_type*> >& vFoundPoints) const;
         Double_t        GetTotalSumw() const;
         Double_t        GetTotalSumw2() const;
         Bool_t          Insert(const point_type& rData) {return fHead->Parent()->Insert(rData);}
+        void            Insert(const std::vector<const point_type*>& vData);
         Bool_t          IsFrozen() const {return fIsFrozen;}
         iterator        Last();
         const iterator  Last() const;
@@ -359,6 +372,9 @@ namespace ROOT
 
      private:
         KDTree();
+
+        template <class F>
+        static void     ForEachIndex(UInt_t n,F&& func);
         KDTree(const KDTree<point_type>& ) {}
         KDTree<point_type>& operator=(const KDTree<point_type>& ) {return *this;}
 
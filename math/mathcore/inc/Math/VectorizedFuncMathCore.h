@@ -0,0 +1,124 @@
+// @(#)root/mathcore:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// Header file for the vectorized special functions, probability density and
+// cumulative distribution functions of MathCore
+
+#ifndef ROOT_Math_VectorizedFuncMathCore
+#define ROOT_Math_VectorizedFuncMathCore
+
+#include "Math/Types.h"
+
+#include <span>
+
+namespace ROOT {
+namespace Math {
+
+/** @defgroup VectorizedFunc Vectorized Mathematical Functions
+    @ingroup MathCore
+
+    Vectorized versions of some of the special functions, probability density functions and cumulative distribution
+    functions of MathCore, for evaluating them on many values at once.
+
+    The functions taking a ROOT::Double_v are available when ROOT is built with VecCore and Vc. They evaluate
+    the same rational approximations of the Cephes library as the scalar functions, with masks instead of
+    branches, so that they differ from the scalar functions only by the rounding errors of the vectorized exp()
+    and log(). In double precision the relative error of erf(), erfc() and normal_quantile() is below about
+    1e-15. The absolute error of lgamma() is about 1e-14 for arguments between 0 and 13, where its value can be
+    close to zero, and below 1e-13 for negative arguments down to -50. As in Cephes, erfc() returns zero where
+    exp(-x^2) underflows.
+
+    The functions taking spans write in out[] the function values for all the values in x[], which must have
+    the same size as out[]. They use the ROOT::Double_v versions when these are available, and the scalar ones
+    otherwise; x[] and out[] do not need to be aligned.
+
+    Functions like chisquared_quantile(), which are computed with an iterative algorithm, have no vectorized
+    version.
+*/
+
+#if defined(R__HAS_VECCORE) && defined(R__HAS_VC)
+
+/// Error function, see ROOT::Math::erf(double) @ingroup VectorizedFunc
+::ROOT::Double_v erf(::ROOT::Double_v x);
+
+/// Complementary error function, see ROOT::Math::erfc(double) @ingroup VectorizedFunc
+::ROOT::Double_v erfc(::ROOT::Double_v x);
+
+/// Natural logarithm of the absolute value of the gamma function, see ROOT::Math::lgamma(double)
+/// @ingroup VectorizedFunc
+::ROOT::Double_v lgamma(::ROOT::Double_v x);
+
+/// Normal (Gaussian) probability density function, see ROOT::Math::normal_pdf(double, double, double)
+/// @ingroup VectorizedFunc
+::ROOT::Double_v normal_pdf(::ROOT::Double_v x, double sigma = 1, double x0 = 0);
+
+/// Log-normal probability density function, see ROOT::Math::lognormal_pdf(double, double, double, double)
+/// @ingroup VectorizedFunc
+::ROOT::Double_v lognormal_pdf(::ROOT::Double_v x, double m, double s, double x0 = 0);
+
+/// Exponential probability density function, see ROOT::Math::exponential_pdf(double, double, double)
+/// @ingroup VectorizedFunc
+::ROOT::Double_v exponential_pdf(::ROOT::Double_v x, double lambda, double x0 = 0);
+
+/// Probability density function of the \f$\chi^2\f$ distribution, see
+/// ROOT::Math::chisquared_pdf(double, double, double) @ingroup VectorizedFunc
+::ROOT::Double_v chisquared_pdf(::ROOT::Double_v x, double r, double x0 = 0);
+
+/// Poisson probability density function, see ROOT::Math::poisson_pdf(unsigned int, double).
+/// The values of n must be non-negative integers. @ingroup VectorizedFunc
+::ROOT::Double_v poisson_pdf(::ROOT::Double_v n, double mu);
+
+/// Normal (Gaussian) cumulative distribution function, see ROOT::Math::normal_cdf(double, double, double)
+/// @ingroup VectorizedFunc
+::ROOT::Double_v normal_cdf(::ROOT::Double_v x, double sigma = 1, double x0 = 0);
+
+/// Complement of the normal (Gaussian) cumulative distribution function, see
+/// ROOT::Math::normal_cdf_c(double, double, double) @ingroup VectorizedFunc
+::ROOT::Double_v normal_cdf_c(::ROOT::Double_v x, double sigma = 1, double x0 = 0);
+
+/// Inverse of the normal cumulative distribution function, see ROOT::Math::normal_quantile(double, double)
+/// @ingroup VectorizedFunc
+::ROOT::Double_v normal_quantile(::ROOT::Double_v z, double sigma);
+
+/// Inverse of the complement of the normal cumulative distribution function, see
+/// ROOT::Math::normal_quantile_c(double, double) @ingroup VectorizedFunc
+::ROOT::Double_v normal_quantile_c(::ROOT::Double_v z, double sigma);
+
+#endif // VECCORE and VC exist check
+
+/// @ingroup VectorizedFunc
+void erf(std::span<const double> x, std::span<double> out);
+/// @ingroup VectorizedFunc
+void erfc(std::span<const double> x, std::span<double> out);
+/// @ingroup VectorizedFunc
+void lgamma(std::span<const double> x, std::span<double> out);
+/// @ingroup VectorizedFunc
+void normal_pdf(std::span<const double> x, std::span<double> out, double sigma = 1, double x0 = 0);
+/// @ingroup VectorizedFunc
+void lognormal_pdf(std::span<const double> x, std::span<double> out, double m, double s, double x0 = 0);
+/// @ingroup VectorizedFunc
+void exponential_pdf(std::span<const double> x, std::span<double> out, double lambda, double x0 = 0);
+/// @ingroup VectorizedFunc
+void chisquared_pdf(std::span<const double> x, std::span<double> out, double r, double x0 = 0);
+/// The values of n must be non-negative integers. @ingroup VectorizedFunc
+void poisson_pdf(std::span<const double> n, std::span<double> out, double mu);
+/// @ingroup VectorizedFunc
+void normal_cdf(std::span<const double> x, std::span<double> out, double sigma = 1, double x0 = 0);
+/// @ingroup VectorizedFunc
+void normal_cdf_c(std::span<const double> x, std::span<double> out, double sigma = 1, double x0 = 0);
+/// @ingroup VectorizedFunc
+void normal_quantile(std::span<const double> z, std::span<double> out, double sigma);
+/// @ingroup VectorizedFunc
+void normal_quantile_c(std::span<const double> z, std::span<double> out, double sigma);
+
+} // namespace Math
+} // namespace ROOT
+
+#endif // ROOT_Math_VectorizedFuncMathCore
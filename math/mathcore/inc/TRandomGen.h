@@ -42,8 +42,29 @@
 
 #include "TRandom.h"
 
+#include <algorithm>
 #include <string>
 
+namespace ROOT {
+namespace Internal {
+
+/// Fill the array with the bulk generation method of the engine, if it has one
+template <class Engine>
+auto RndmArrayFromEngine(Engine &engine, int n, double *array, int) -> decltype(engine.RndmArray(n, array))
+{
+   engine.RndmArray(n, array);
+}
+
+template <class Engine>
+void RndmArrayFromEngine(Engine &engine, int n, double *array, long)
+{
+   for (int i = 0; i < n; ++i)
+      array[i] = engine();
+}
+
+} // namespace Internal
+} // namespace ROOT
+
 template<class Engine>
 class TRandomGen : public TRandom {
 
@@ -61,10 +82,16 @@ public:
    using TRandom::Rndm;
     Double_t Rndm( ) override { return fEngine(); }
     void     RndmArray(Int_t n, Float_t *array) override {
-      for (int i = 0; i < n; ++i) array[i] = fEngine();
+      constexpr Int_t kBufferSize = 256;
+      Double_t buffer[kBufferSize];
+      for (Int_t i = 0; i < n; i += kBufferSize) {
+         const Int_t m = std::min(kBufferSize, n - i);
+         ROOT::Internal::RndmArrayFromEngine(fEngine, m, buffer, 0);
+         std::copy(buffer, buffer + m, array + i);
+      }
    }
     void     RndmArray(Int_t n, Double_t *array) override {
-            for (int i = 0; i < n; ++i) array[i] = fEngine();
+      ROOT::Internal::RndmArrayFromEngine(fEngine, n, array, 0);
    }
     void     SetSeed(ULong_t seed=0) override {
       fEngine.SetSeed(seed);
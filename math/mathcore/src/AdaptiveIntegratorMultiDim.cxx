@@ -8,10 +8,46 @@
 
 #include <cmath>
 #include <algorithm>
+#include <vector>
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
 
 namespace ROOT {
 namespace Math {
 
+namespace {
+
+/// Evaluate the function at npoints points stored one after the other in x. With the multi-thread policy
+/// the points are split in blocks evaluated by the threads of the pool.
+void EvalPoints(const IMultiGenFunction &f, ROOT::EExecutionPolicy policy, unsigned int npoints, const double *x,
+                double *result)
+{
+#ifdef R__USE_IMT
+   // don't split the points in blocks too small to pay off the scheduling
+   constexpr unsigned int kMinPointsPerTask = 16;
+   if (policy == ROOT::EExecutionPolicy::kMultiThread && npoints >= 2 * kMinPointsPerTask) {
+      ROOT::TThreadExecutor pool;
+      const unsigned int ndim = f.NDim();
+      const unsigned int ntasks = std::min<unsigned int>(pool.GetPoolSize(), npoints / kMinPointsPerTask);
+      const unsigned int step = (npoints + ntasks - 1) / ntasks;
+      auto evalBlock = [&](unsigned int itask) {
+         const unsigned int first = itask * step;
+         if (first < npoints)
+            f.EvalBatch(std::min(step, npoints - first), x + first * ndim, result + first);
+      };
+      pool.Foreach(evalBlock, ROOT::TSeqU(ntasks));
+      return;
+   }
+#else
+   (void)policy;
+#endif
+   f.EvalBatch(npoints, x, result);
+}
+
+} // anonymous namespace
+
 
 
 AdaptiveIntegratorMultiDim::AdaptiveIntegratorMultiDim(double absTol, double relTol, unsigned int maxpts, unsigned int size):
@@ -180,17 +216,109 @@ double AdaptiveIntegratorMultiDim::DoIntegral(const double* xmin, const double *
    double rgnvol, sum1, sum2, sum3, sum4, sum5, difmax, f2, f3, dif, aresult;
    double rgncmp=0, rgnval, rgnerr;
 
-   unsigned int j1, k, l, m, idvaxn=0, idvax0=0, isbtmp, isbtpp;
-
-   //InitArgs(z,fParams);
+   unsigned int k, l, idvaxn=0, idvax0=0, isbtmp, isbtpp;
+
+   // Fill the nodes of the rule for the region of center c (and half widths width) in the order
+   // in which their function values are summed below, and return the number of nodes
+   auto fillNodes = [&](const double *c, double *nodes) {
+      double *node = nodes;
+      auto addNode = [&]() {
+         std::copy(z, z + n, node);
+         node += n;
+      };
+      for (unsigned int i = 0; i < n; i++)
+         z[i] = c[i];
+      addNode();
+      for (unsigned int i = 0; i < n; i++) {
+         z[i] = c[i] - xl2*width[i];
+         addNode();
+         z[i] = c[i] + xl2*width[i];
+         addNode();
+         widthl[i] = xl4*width[i];
+         z[i] = c[i] - widthl[i];
+         addNode();
+         z[i] = c[i] + widthl[i];
+         addNode();
+         z[i] = c[i];
+      }
+      for (unsigned int i = 1; i < n; i++) {
+         unsigned int i1 = i-1;
+         for (unsigned int ik = i; ik < n; ik++) {
+            for (unsigned int il = 0; il < 2; il++) {
+               widthl[i1] = -widthl[i1];
+               z[i1] = c[i1] + widthl[i1];
+               for (unsigned int im = 0; im < 2; im++) {
+                  widthl[ik] = -widthl[ik];
+                  z[ik] = c[ik] + widthl[ik];
+                  addNode();
+               }
+            }
+            z[ik] = c[ik];
+         }
+         z[i1] = c[i1];
+      }
+      for (unsigned int i = 0; i < n; i++) {
+         widthl[i] = -xl5*width[i];
+         z[i] = c[i] + widthl[i];
+      }
+      // end nodes ~gray codes
+      unsigned int i = 0;
+      do {
+         addNode();
+         for (i = 0; i < n; i++) {
+            widthl[i] = -widthl[i];
+            z[i] = c[i] + widthl[i];
+            if (widthl[i] > 0) break;
+         }
+      } while (i < n);
+      return static_cast<unsigned int>((node - nodes) / n);
+   };
+
+   // Nodes and function values of a region and, when a region is divided, of its second half, which is
+   // evaluated in the same batch as the first one
+   std::vector<double> nodes(2 * irlcls * n);
+   std::vector<double> fvalues(2 * irlcls);
+   unsigned int nnodes = 0, nnodesNext = 0;
+   bool nextEvaluated = false;
+
+   ROOT::EExecutionPolicy policy = fExecutionPolicy;
+#ifndef R__USE_IMT
+   if (policy == ROOT::EExecutionPolicy::kMultiThread) {
+      MATH_WARN_MSG("AdaptiveIntegratorMultiDim::Integral",
+                    "Multithread execution policy requires IMT, which is disabled. Changing to sequential.");
+      policy = ROOT::EExecutionPolicy::kSequential;
+   }
+#endif
 
 L20:
    rgnvol = twondm;//=2^n
    for (j=0; j<n; j++) {
       rgnvol *= width[j]; //region volume
-      z[j]    = ctr[j]; //temporary node
    }
-   sum1 = (*fFun)((const double*)z);//EvalPar(z,fParams); //evaluate function
+
+   const double *fval = fvalues.data();
+   if (nextEvaluated) {
+      fval += nnodes;
+      nnodes = nnodesNext;
+      nextEvaluated = false;
+   } else {
+      nnodes = fillNodes(ctr, nodes.data());
+      unsigned int npoints = nnodes;
+      if (ldv) {
+         double ctrNext[15];
+         std::copy(ctr, ctr + n, ctrNext);
+         ctrNext[idvax0-1] += 2*width[idvax0-1];
+         nnodesNext = fillNodes(ctrNext, nodes.data() + nnodes * n);
+         npoints += nnodesNext;
+         nextEvaluated = true;
+      }
+      EvalPoints(*fFun, policy, npoints, nodes.data(), fvalues.data());
+   }
+
+   auto fv = [&](unsigned int i) { return absValue ? std::abs(fval[i]) : fval[i]; };
+   unsigned int inode = 0;
+
+   sum1 = fval[inode++]; //function value at the center
 
    difmax = 0;
    sum2   = 0;
@@ -198,19 +326,10 @@ L20:
 
    //loop over coordinates
    for (j=0; j<n; j++) {
-      z[j]    = ctr[j] - xl2*width[j];
-      if (absValue) f2 = std::abs((*fFun)(z));
-      else          f2 = (*fFun)(z);
-      z[j]    = ctr[j] + xl2*width[j];
-      if (absValue) f2 += std::abs((*fFun)(z));
-      else          f2 += (*fFun)(z);
-      widthl[j] = xl4*width[j];
-      z[j]    = ctr[j] - widthl[j];
-      if (absValue) f3 = std::abs((*fFun)(z));
-      else          f3 = (*fFun)(z);
-      z[j]    = ctr[j] + widthl[j];
-      if (absValue) f3 += std::abs((*fFun)(z));
-      else          f3 += (*fFun)(z);
+      f2  = fv(inode++);
+      f2 += fv(inode++);
+      f3  = fv(inode++);
+      f3 += fv(inode++);
       sum2   += f2;//sum func eval with different weights separately
       sum3   += f3;//for a given region
       dif     = std::abs(7*f2-f3-12*sum1);
@@ -219,42 +338,20 @@ L20:
          difmax=dif;
          idvaxn=j+1;
       }
-      z[j]    = ctr[j];
    }
 
    sum4 = 0;
    for (j=1;j<n;j++) {
-      j1 = j-1;
       for (k=j;k<n;k++) {
-         for (l=0;l<2;l++) {
-            widthl[j1] = -widthl[j1];
-            z[j1]    = ctr[j1] + widthl[j1];
-            for (m=0;m<2;m++) {
-               widthl[k] = -widthl[k];
-               z[k]    = ctr[k] + widthl[k];
-               if (absValue) sum4 += std::abs((*fFun)(z));
-               else            sum4 += (*fFun)(z);
-            }
-         }
-         z[k] = ctr[k];
+         for (l=0;l<4;l++)
+            sum4 += fv(inode++);
       }
-      z[j1] = ctr[j1];
    }
 
+   //sum over end nodes
    sum5 = 0;
-
-   for (j=0;j<n;j++) {
-      widthl[j] = -xl5*width[j];
-      z[j] = ctr[j] + widthl[j];
-   }
-L90: //sum over end nodes ~gray codes
-   if (absValue) sum5 += std::abs((*fFun)(z));
-   else          sum5 += (*fFun)(z);
-   for (j=0;j<n;j++) {
-      widthl[j] = -widthl[j];
-      z[j] = ctr[j] + widthl[j];
-      if (widthl[j] > 0) goto L90;
-   }
+   while (inode < nnodes)
+      sum5 += fv(inode++);
 
    rgncmp  = rgnvol*(wpn1[n-2]*sum1+wp2*sum2+wpn3[n-2]*sum3+wp4*sum4);
    rgnval  = wn1[n-2]*sum1+w2*sum2+wn3[n-2]*sum3+w4*sum4+wn5[n-2]*sum5;
@@ -22,6 +22,7 @@
 #endif
 
 #include <algorithm>
+#include <cmath>
 #include <cstdlib>
 
 #include <iostream>
@@ -131,6 +132,24 @@ double Delaunay2D::Interpolate(double x, double y)
    return zz;
 }
 
+//______________________________________________________________________________
+void Delaunay2D::Interpolate(int n, const double *x, const double *y, double *z)
+{
+   // Interpolate the z values of n points, finding the triangles only once
+
+   FindAllTriangles();
+
+   for (int i = 0; i < n; ++i) {
+      if (fNdt == 0) {
+         z[i] = fZout;
+         continue;
+      }
+      const double xx = Linear_transform(x[i], fOffsetX, fScaleFactorX);
+      const double yy = Linear_transform(y[i], fOffsetY, fScaleFactorY);
+      z[i] = DoInterpolateNormalized(xx, yy);
+   }
+}
+
 //______________________________________________________________________________
 void Delaunay2D::FindAllTriangles()
 {
@@ -167,9 +186,6 @@ void Delaunay2D::DoNormalizePoints() {
       fYN.push_back(Linear_transform(fY[n], fOffsetY, fScaleFactorY));
    }
 
-   //also initialize fXCellStep and FYCellStep
-   fXCellStep = fNCells / (fXNmax - fXNmin);
-   fYCellStep = fNCells / (fYNmax - fYNmin);
 }
 
 /// Triangle implementation for finding all the triangles
@@ -190,6 +206,13 @@ void Delaunay2D::DoFindTriangles() {
 
    fTriangles.resize(NumberOfTriangles);
 
+   // the grid has about two triangles per cell, so that a point is located by testing a few triangles
+   fNCells = std::max(25, std::min(4096, int(std::sqrt(0.5 * NumberOfTriangles))));
+   fXCellStep = fNCells / (fXNmax - fXNmin);
+   fYCellStep = fNCells / (fYNmax - fYNmin);
+   const unsigned int nCells = (fNCells + 1) * (fNCells + 1);
+   std::vector<unsigned int> cellCounts(nCells, 0);
+
    for(i = 0; i < NumberOfTriangles; i++){
       Triangle tri;
       const auto& t = AllTriangles[i];
@@ -225,7 +248,24 @@ void Delaunay2D::DoFindTriangles() {
 
       for(unsigned int j = cellXmin; j <= cellXmax; j++) {
          for(unsigned int k = cellYmin; k <= cellYmax; k++) {
-            fCells[Cell(j,k)].insert(i);
+            cellCounts[Cell(j,k)]++;
+         }
+      }
+   }
+
+   // store the triangles of all cells in a single array, each cell keeping the triangles in increasing order
+   fCellStart.assign(nCells + 1, 0);
+   for (unsigned int c = 0; c < nCells; c++)
+      fCellStart[c + 1] = fCellStart[c] + cellCounts[c];
+   fCellTriangles.resize(fCellStart[nCells]);
+   std::copy(fCellStart.begin(), fCellStart.end() - 1, cellCounts.begin());
+   for (i = 0; i < NumberOfTriangles; i++) {
+      const Triangle &tri = fTriangles[i];
+      auto bx = std::minmax({tri.x[0], tri.x[1], tri.x[2]});
+      auto by = std::minmax({tri.y[0], tri.y[1], tri.y[2]});
+      for (unsigned int j = CellX(bx.first); j <= (unsigned int)CellX(bx.second); j++) {
+         for (unsigned int k = CellY(by.first); k <= (unsigned int)CellY(by.second); k++) {
+            fCellTriangles[cellCounts[Cell(j, k)]++] = i;
          }
       }
    }
@@ -269,7 +309,9 @@ double Delaunay2D::DoInterpolateNormalized(double xx, double yy)
    if (cX < 0 || cX > fNCells || cY < 0 || cY > fNCells)
       return fZout; // TODO some more fancy interpolation here
 
-   for (unsigned int t : fCells[Cell(cX, cY)]) {
+   const unsigned int cell = Cell(cX, cY);
+   for (unsigned int it = fCellStart[cell]; it < fCellStart[cell + 1]; ++it) {
+      const unsigned int t = fCellTriangles[it];
 
       auto coords = bayCoords(t);
 
@@ -63,6 +63,7 @@ namespace ROOT {
       int Counter() { return -1; }
       void SetCounter(int) {}
       void Iterate() {} 
+      void RndmArray(int, double *) {}
    };
 
 
@@ -118,9 +119,18 @@ public:
       return rng_get_N(); 
    }
 
-   // to silent some warning
+   // fill the array with the same sequence as n calls to Rndm(), whole iterations are written directly
    void RndmArray(int n, double * array) {
-      fill_array(fRngState, n, array); 
+      const int m = ROOT_MM_N - 1;
+      int i = 0;
+      for (; i < n && fRngState->counter < m + 1; ++i)
+         array[i] = get_next_float(fRngState);
+      for (; i + m <= n; i += m) {
+         iterate_and_fill_array(fRngState, array + i);
+         fRngState->counter = m + 1;
+      }
+      for (; i < n; ++i)
+         array[i] = get_next_float(fRngState);
    }
    void ReadState(const char filename[] ) {
       read_state(fRngState, filename);
@@ -425,6 +425,13 @@ uint64_t RanluxppEngine<p>::IntRndm()
    return fImpl->NextRandomBits();
 }
 
+template <int p>
+void RanluxppEngine<p>::RndmArray(int n, double *array)
+{
+   for (int i = 0; i < n; i++)
+      array[i] = fImpl->NextRandomFloat();
+}
+
 template <int p>
 void RanluxppEngine<p>::SetSeed(uint64_t seed)
 {
@@ -0,0 +1,446 @@
+// @(#)root/mathcore:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// Implementation of the vectorized functions of MathCore.
+// The special functions are vectorized versions of the Cephes implementations in SpecFuncCephes.cxx
+// and SpecFuncCephesInv.cxx (Cephes Math Library Release 2.8: June, 2000,
+// Copyright 1984, 1987, 1989, 2000 by Stephen L. Moshier)
+
+#include "Math/VectorizedFuncMathCore.h"
+#include "Math/Error.h"
+#include "Math/PdfFuncMathCore.h"
+#include "Math/ProbFuncMathCore.h"
+#include "Math/QuantFuncMathCore.h"
+#include "Math/SpecFuncMathCore.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace ROOT {
+namespace Math {
+
+#if defined(R__HAS_VECCORE) && defined(R__HAS_VC)
+
+namespace {
+
+using ::ROOT::Double_v;
+using Mask_v = vecCore::Mask<Double_v>;
+
+constexpr double kMaxLog = 709.782712893383973096206318587;
+constexpr double kMaxLgm = 2.556348e305;
+constexpr double kLogSqrt2Pi = 0.91893853320467274178;
+constexpr double kLogPi = 1.14472988584940017414;
+constexpr double kSqrt2 = 1.41421356237309504880;
+constexpr double kSqrt2Pi = 2.50662827463100050242;
+constexpr double kExpMinus2 = 0.13533528323661269189;
+
+// coefficients of erf and erfc
+constexpr double kErfP[] = {2.46196981473530512524E-10, 5.64189564831068821977E-1, 7.46321056442269912687E0,
+                            4.86371970985681366614E1,   1.96520832956077098242E2,  5.26445194995477358631E2,
+                            9.34528527171957607540E2,   1.02755188689515710272E3,  5.57535335369399327526E2};
+constexpr double kErfQ[] = {1.32281951154744992508E1, 8.67072140885989742329E1, 3.54937778887819891062E2,
+                            9.75708501743205489753E2, 1.82390916687909736289E3, 2.24633760818710981792E3,
+                            1.65666309194161350182E3, 5.57535340817727675546E2};
+constexpr double kErfR[] = {5.64189583547755073984E-1, 1.27536670759978104416E0, 5.01905042251180477414E0,
+                            6.16021097993053585195E0,  7.40974269950448939160E0, 2.97886665372100240670E0};
+constexpr double kErfS[] = {2.26052863220117276590E0, 9.39603524938001434673E0, 1.20489539808096656605E1,
+                            1.70814450747565897222E1, 9.60896809063285878198E0, 3.36907645100081516050E0};
+constexpr double kErfT[] = {9.60497373987051638749E0, 9.00260197203842689217E1, 2.23200534594684319226E3,
+                            7.00332514112805075473E3, 5.55923013010394962768E4};
+constexpr double kErfU[] = {3.35617141647503099647E1, 5.21357949780152679795E2, 4.59432382970980127987E3,
+                            2.26290000613890934246E4, 4.92673942608635921086E4};
+
+// coefficients of lgamma: Stirling's formula expansion, and between 2 and 3
+constexpr double kLgamA[] = {8.11614167470508450300E-4, -5.95061904284301438324E-4, 7.93650340457716943945E-4,
+                             -2.77777777730099687205E-3, 8.33333333333331927722E-2};
+constexpr double kLgamB[] = {-1.37825152569120859100E3, -3.88016315134637840924E4, -3.31612992738871184744E5,
+                             -1.16237097492762307383E6, -1.72173700820839662146E6, -8.53555664245765465627E5};
+constexpr double kLgamC[] = {-3.51815701436523470549E2, -1.70642106651881159223E4, -2.20528590553854454839E5,
+                             -1.13933444367982507207E6, -2.53252307177582951285E6, -2.01889141433532773231E6};
+
+// coefficients of the inverse of the normal cumulative distribution
+constexpr double kNdtriP0[] = {-5.99633501014107895267E1, 9.80010754185999661536E1, -5.66762857469070293439E1,
+                               1.39312609387279679503E1, -1.23916583867381258016E0};
+constexpr double kNdtriQ0[] = {1.95448858338141759834E0,  4.67627912898881538453E0,  8.63602421390890590575E1,
+                               -2.25462687854119370527E2, 2.00260212380060660359E2,  -8.20372256168333339912E1,
+                               1.59056225126211695515E1,  -1.18331621121330003142E0};
+constexpr double kNdtriP1[] = {4.05544892305962419923E0,   3.15251094599893866154E1,  5.71628192246421288162E1,
+                               4.40805073893200834700E1,   1.46849561928858024014E1,  2.18663306850790267539E0,
+                               -1.40256079171354495875E-1, -3.50424626827848203418E-2, -8.57456785154685413611E-4};
+constexpr double kNdtriQ1[] = {1.57799883256466749731E1,   4.53907635128879210584E1,  4.13172038254672030440E1,
+                               1.50425385692907503408E1,   2.50464946208309415979E0,  -1.42182922854787788574E-1,
+                               -3.80806407691578277194E-2, -9.33259480895457427372E-4};
+constexpr double kNdtriP2[] = {3.23774891776946035970E0, 6.91522889068984211695E0, 3.93881025292474443415E0,
+                               1.33303460815807542389E0, 2.01485389549179081538E-1, 1.23716634817820021358E-2,
+                               3.01581553508235416007E-4, 2.65806974686737550832E-6, 6.23974539184983293730E-9};
+constexpr double kNdtriQ2[] = {6.02427039364742014255E0,  3.67983563856160859403E0,  1.37702099489081330271E0,
+                               2.16236993594496635890E-1, 1.34204006088543189037E-2, 3.28014464682127739104E-4,
+                               2.89247864745380683936E-6, 6.79019408009981274425E-9};
+
+/// Polynomial a[0] x^(N-1) + a[1] x^(N-2) + ... + a[N-1]
+template <std::size_t N>
+Double_v Polynomial(Double_v x, const double (&a)[N])
+{
+   Double_v result(a[0]);
+   for (std::size_t i = 1; i < N; ++i)
+      result = result * x + a[i];
+   return result;
+}
+
+/// Polynomial x^N + a[0] x^(N-1) + ... + a[N-1]
+template <std::size_t N>
+Double_v Polynomial1(Double_v x, const double (&a)[N])
+{
+   Double_v result = x + a[0];
+   for (std::size_t i = 1; i < N; ++i)
+      result = result * x + a[i];
+   return result;
+}
+
+/// erf(x) for |x| <= 1
+Double_v ErfSmall(Double_v x)
+{
+   Double_v z = x * x;
+   return x * Polynomial(z, kErfT) / Polynomial1(z, kErfU);
+}
+
+/// erfc(x) for x >= 1
+Double_v ErfcLarge(Double_v x)
+{
+   Double_v z = -x * x;
+   Double_v p = vecCore::Blend<Double_v>(x < Double_v(8.0), Polynomial(x, kErfP), Polynomial(x, kErfR));
+   Double_v q = vecCore::Blend<Double_v>(x < Double_v(8.0), Polynomial1(x, kErfQ), Polynomial1(x, kErfS));
+   Double_v y = vecCore::math::Exp(z) * p / q;
+   // the Cephes implementation returns zero where exp(-x^2) underflows
+   return vecCore::Blend<Double_v>(z < Double_v(-kMaxLog), Double_v(0.0), y);
+}
+
+/// lgamma(x) for x >= 13, with Stirling's formula
+Double_v LgammaStirling(Double_v x)
+{
+   Double_v q = (x - 0.5) * vecCore::math::Log(x) - x + kLogSqrt2Pi;
+   Double_v p = 1.0 / (x * x);
+   Double_v largeCorr = ((7.9365079365079365079365e-4 * p - 2.7777777777777777777778e-3) * p +
+                         0.0833333333333333333333) / x;
+   Double_v corr = vecCore::Blend<Double_v>(x >= Double_v(1000.0), largeCorr, Polynomial(p, kLgamA) / x);
+   q = vecCore::Blend<Double_v>(x > Double_v(1.0e8), q, q + corr);
+   return vecCore::Blend<Double_v>(x > Double_v(kMaxLgm), Double_v(std::numeric_limits<double>::infinity()), q);
+}
+
+/// lgamma(x) for -34 <= x < 13: the argument is shifted to [2,3) with the recurrence of the gamma function
+Double_v LgammaSmall(Double_v x)
+{
+   Double_v z(1.0);
+   Double_v p(0.0);
+   Double_v u = x;
+   Mask_v m = u >= Double_v(3.0);
+   while (!vecCore::MaskEmpty(m)) {
+      vecCore::MaskedAssign<Double_v>(p, m, p - 1.0);
+      u = x + p;
+      vecCore::MaskedAssign<Double_v>(z, m, z * u);
+      m = m && (u >= Double_v(3.0));
+   }
+   Mask_v pole = u == Double_v(0.0);
+   m = u < Double_v(2.0);
+   while (!vecCore::MaskEmpty(m)) {
+      vecCore::MaskedAssign<Double_v>(z, m, z / u);
+      vecCore::MaskedAssign<Double_v>(p, m, p + 1.0);
+      u = x + p;
+      m = m && (u < Double_v(2.0));
+      pole = pole || (m && u == Double_v(0.0));
+   }
+   Double_v xr = x + (p - 2.0);
+   Double_v result = vecCore::math::Log(vecCore::math::Abs(z)) + xr * Polynomial(xr, kLgamB) / Polynomial1(xr, kLgamC);
+   return vecCore::Blend<Double_v>(pole, Double_v(std::numeric_limits<double>::infinity()), result);
+}
+
+/// Inverse of the normal cumulative distribution function (Cephes ndtri)
+Double_v Ndtri(Double_v y0)
+{
+   Mask_v upper = y0 > Double_v(1.0 - kExpMinus2);
+   Double_v y = vecCore::Blend<Double_v>(upper, 1.0 - y0, y0);
+   Mask_v central = y > Double_v(kExpMinus2);
+
+   Double_v yc = y - 0.5;
+   Double_v y2 = yc * yc;
+   Double_v xc = (yc + yc * (y2 * Polynomial(y2, kNdtriP0) / Polynomial1(y2, kNdtriQ0))) * kSqrt2Pi;
+
+   Double_v x = vecCore::math::Sqrt(-2.0 * vecCore::math::Log(vecCore::Blend<Double_v>(central, Double_v(0.1), y)));
+   Double_v x0 = x - vecCore::math::Log(x) / x;
+   Double_v z = 1.0 / x;
+   Double_v x1 = vecCore::Blend<Double_v>(x < Double_v(8.0), z * Polynomial(z, kNdtriP1) / Polynomial1(z, kNdtriQ1),
+                                z * Polynomial(z, kNdtriP2) / Polynomial1(z, kNdtriQ2));
+   Double_v xt = vecCore::Blend<Double_v>(upper, x0 - x1, x1 - x0);
+
+   Double_v result = vecCore::Blend<Double_v>(central, xc, xt);
+   vecCore::MaskedAssign<Double_v>(result, y0 <= Double_v(0.0), Double_v(-std::numeric_limits<double>::infinity()));
+   vecCore::MaskedAssign<Double_v>(result, y0 >= Double_v(1.0), Double_v(std::numeric_limits<double>::infinity()));
+   return result;
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+Double_v erf(Double_v x)
+{
+   Double_v ax = vecCore::math::Abs(x);
+   Mask_v large = ax > Double_v(1.0);
+   Double_v small = ErfSmall(vecCore::Blend<Double_v>(large, Double_v(0.0), x));
+   Double_v erfcLarge = ErfcLarge(vecCore::Blend<Double_v>(large, ax, Double_v(1.0)));
+   Double_v erfLarge = 1.0 - vecCore::Blend<Double_v>(x < Double_v(0.0), 2.0 - erfcLarge, erfcLarge);
+   return vecCore::Blend<Double_v>(large, erfLarge, small);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+Double_v erfc(Double_v x)
+{
+   Double_v ax = vecCore::math::Abs(x);
+   Mask_v small = ax < Double_v(1.0);
+   Double_v erfSmall = ErfSmall(vecCore::Blend<Double_v>(small, x, Double_v(0.0)));
+   Double_v large = ErfcLarge(vecCore::Blend<Double_v>(small, Double_v(1.0), ax));
+   large = vecCore::Blend<Double_v>(x < Double_v(0.0), 2.0 - large, large);
+   return vecCore::Blend<Double_v>(small, 1.0 - erfSmall, large);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// For x < -34 the reflection formula of the gamma function is used, as in the
+/// Cephes implementation.
+Double_v lgamma(Double_v x)
+{
+   Mask_v reflect = x < Double_v(-34.0);
+   Double_v q = vecCore::Blend<Double_v>(reflect, -x, x);
+   Mask_v large = q >= Double_v(13.0);
+   Double_v result = vecCore::Blend<Double_v>(large, LgammaStirling(vecCore::Blend<Double_v>(large, q, Double_v(13.0))),
+                                    LgammaSmall(vecCore::Blend<Double_v>(large, Double_v(2.5), x)));
+   if (vecCore::MaskEmpty(reflect))
+      return result;
+
+   // lgamma(x) = log(pi / |x sin(pi x)|) - lgamma(-x)
+   Double_v p = vecCore::math::Floor(q);
+   Double_v z = q - p;
+   z = vecCore::Blend<Double_v>(z > Double_v(0.5), (p + 1.0) - q, z);
+   z = q * vecCore::math::Sin(M_PI * z);
+   Double_v reflected = kLogPi - vecCore::math::Log(z) - result;
+   vecCore::MaskedAssign<Double_v>(reflected, p == q || z == Double_v(0.0),
+                         Double_v(std::numeric_limits<double>::infinity()));
+   return vecCore::Blend<Double_v>(reflect, reflected, result);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+Double_v normal_pdf(Double_v x, double sigma, double x0)
+{
+   Double_v tmp = (x - x0) / sigma;
+   return (1.0 / (kSqrt2Pi * std::fabs(sigma))) * vecCore::math::Exp(-tmp * tmp / 2.0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+Double_v lognormal_pdf(Double_v x, double m, double s, double x0)
+{
+   Double_v dx = x - x0;
+   Mask_v outside = dx <= Double_v(0.0);
+   dx = vecCore::Blend<Double_v>(outside, Double_v(1.0), dx);
+   Double_v tmp = (vecCore::math::Log(dx) - m) / s;
+   Double_v result = 1.0 / (dx * std::fabs(s) * kSqrt2Pi) * vecCore::math::Exp(-(tmp * tmp) / 2.0);
+   return vecCore::Blend<Double_v>(outside, Double_v(0.0), result);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+Double_v exponential_pdf(Double_v x, double lambda, double x0)
+{
+   Double_v dx = x - x0;
+   return vecCore::Blend<Double_v>(dx < Double_v(0.0), Double_v(0.0), lambda * vecCore::math::Exp(-lambda * dx));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+Double_v chisquared_pdf(Double_v x, double r, double x0)
+{
+   double a = r / 2 - 1.;
+   double lgammaHalfR = ROOT::Math::lgamma(r / 2);
+   Double_v dx = x - x0;
+   Mask_v outside = dx < Double_v(0.0);
+   Double_v logHalfDx = vecCore::math::Log(vecCore::Blend<Double_v>(outside, Double_v(1.0), dx) / 2.0);
+   Double_v result = vecCore::math::Exp(a * logHalfDx - dx / 2.0 - lgammaHalfR) / 2.0;
+   // treat the special case of r = 2 at x = x0, which would return nan otherwise
+   if (a == 0)
+      vecCore::MaskedAssign<Double_v>(result, dx == Double_v(0.0), Double_v(0.5));
+   return vecCore::Blend<Double_v>(outside, Double_v(0.0), result);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+Double_v poisson_pdf(Double_v n, double mu)
+{
+   // return a nan for mu < 0 since it does not make sense
+   if (mu < 0)
+      return Double_v(std::numeric_limits<double>::quiet_NaN());
+   Mask_v positive = n > Double_v(0.0);
+   // when n = 0 and mu = 0, 1 is returned
+   Double_v arg = vecCore::Blend<Double_v>(positive, n * std::log(mu) - lgamma(n + 1.0) - mu, Double_v(-mu));
+   return vecCore::math::Exp(arg);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+Double_v normal_cdf(Double_v x, double sigma, double x0)
+{
+   Double_v z = (x - x0) / (sigma * kSqrt2);
+   Double_v az = vecCore::math::Abs(z);
+   Double_v erfSmall = ErfSmall(vecCore::Blend<Double_v>(az > Double_v(1.0), Double_v(0.0), z));
+   Double_v erfcLarge = ErfcLarge(vecCore::Blend<Double_v>(az >= Double_v(1.0), az, Double_v(1.0)));
+   Double_v result =
+      vecCore::Blend<Double_v>(az > Double_v(1.0), 0.5 * (1.0 + (1.0 - erfcLarge)), 0.5 * (1.0 + erfSmall));
+   return vecCore::Blend<Double_v>(z < Double_v(-1.0), 0.5 * erfcLarge, result);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+Double_v normal_cdf_c(Double_v x, double sigma, double x0)
+{
+   Double_v z = (x - x0) / (sigma * kSqrt2);
+   Double_v az = vecCore::math::Abs(z);
+   Double_v erfSmall = ErfSmall(vecCore::Blend<Double_v>(az > Double_v(1.0), Double_v(0.0), z));
+   Double_v erfcLarge = ErfcLarge(vecCore::Blend<Double_v>(az >= Double_v(1.0), az, Double_v(1.0)));
+   // for z < -1, erf(z) = 1 - erfc(z) = 1 - (2 - erfc(-z))
+   Double_v result =
+      vecCore::Blend<Double_v>(az > Double_v(1.0), 0.5 * (1. - (1.0 - (2.0 - erfcLarge))), 0.5 * (1. - erfSmall));
+   return vecCore::Blend<Double_v>(z > Double_v(1.0), 0.5 * erfcLarge, result);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+Double_v normal_quantile(Double_v z, double sigma)
+{
+   return sigma * Ndtri(z);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+Double_v normal_quantile_c(Double_v z, double sigma)
+{
+   // use the fact that ndtri(1.-x) = - ndtri(x)
+   return -sigma * Ndtri(z);
+}
+
+#endif // VECCORE and VC exist check
+
+namespace {
+
+/// Evaluate func, which is called with a ROOT::Double_v if vectorization is available and with a double otherwise,
+/// for all the values in x
+template <class Func>
+void EvalBatch(const char *where, std::span<const double> x, std::span<double> out, Func func)
+{
+   if (x.size() != out.size()) {
+      MATH_ERROR_MSG(where, "The input and output spans must have the same size");
+      return;
+   }
+   std::size_t i = 0;
+#if defined(R__HAS_VECCORE) && defined(R__HAS_VC)
+   constexpr std::size_t kVS = vecCore::VectorSize<::ROOT::Double_v>();
+   for (; i + kVS <= x.size(); i += kVS) {
+      ::ROOT::Double_v xv(&x[i], Vc::Unaligned);
+      func(xv).store(&out[i], Vc::Unaligned);
+   }
+   if (i < x.size()) {
+      // pad the last vector with the last value
+      double in[kVS];
+      double res[kVS];
+      std::fill(std::copy(x.begin() + i, x.end(), in), in + kVS, x.back());
+      ::ROOT::Double_v xv(in, Vc::Unaligned);
+      func(xv).store(res, Vc::Unaligned);
+      std::copy(res, res + (x.size() - i), out.begin() + i);
+   }
+#else
+   for (; i < x.size(); ++i)
+      out[i] = func(x[i]);
+#endif
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+void erf(std::span<const double> x, std::span<double> out)
+{
+   EvalBatch("erf", x, out, [](auto xi) { return ROOT::Math::erf(xi); });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void erfc(std::span<const double> x, std::span<double> out)
+{
+   EvalBatch("erfc", x, out, [](auto xi) { return ROOT::Math::erfc(xi); });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void lgamma(std::span<const double> x, std::span<double> out)
+{
+   EvalBatch("lgamma", x, out, [](auto xi) { return ROOT::Math::lgamma(xi); });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void normal_pdf(std::span<const double> x, std::span<double> out, double sigma, double x0)
+{
+   EvalBatch("normal_pdf", x, out, [=](auto xi) { return ROOT::Math::normal_pdf(xi, sigma, x0); });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void lognormal_pdf(std::span<const double> x, std::span<double> out, double m, double s, double x0)
+{
+   EvalBatch("lognormal_pdf", x, out, [=](auto xi) { return ROOT::Math::lognormal_pdf(xi, m, s, x0); });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void exponential_pdf(std::span<const double> x, std::span<double> out, double lambda, double x0)
+{
+   EvalBatch("exponential_pdf", x, out,
+             [=](auto xi) { return ROOT::Math::exponential_pdf(xi, lambda, x0); });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void chisquared_pdf(std::span<const double> x, std::span<double> out, double r, double x0)
+{
+   EvalBatch("chisquared_pdf", x, out, [=](auto xi) { return ROOT::Math::chisquared_pdf(xi, r, x0); });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void poisson_pdf(std::span<const double> n, std::span<double> out, double mu)
+{
+   EvalBatch("poisson_pdf", n, out, [=](auto ni) {
+      if constexpr (std::is_same<decltype(ni), double>::value)
+         return ROOT::Math::poisson_pdf(static_cast<unsigned int>(ni), mu);
+      else
+         return ROOT::Math::poisson_pdf(ni, mu);
+   });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void normal_cdf(std::span<const double> x, std::span<double> out, double sigma, double x0)
+{
+   EvalBatch("normal_cdf", x, out, [=](auto xi) { return ROOT::Math::normal_cdf(xi, sigma, x0); });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void normal_cdf_c(std::span<const double> x, std::span<double> out, double sigma, double x0)
+{
+   EvalBatch("normal_cdf_c", x, out, [=](auto xi) { return ROOT::Math::normal_cdf_c(xi, sigma, x0); });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void normal_quantile(std::span<const double> z, std::span<double> out, double sigma)
+{
+   EvalBatch("normal_quantile", z, out, [=](auto zi) { return ROOT::Math::normal_quantile(zi, sigma); });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void normal_quantile_c(std::span<const double> z, std::span<double> out, double sigma)
+{
+   EvalBatch("normal_quantile_c", z, out,
+             [=](auto zi) { return ROOT::Math::normal_quantile_c(zi, sigma); });
+}
+
+} // namespace Math
+} // namespace ROOT
@@ -47,6 +47,21 @@ TEST(RanluxppEngine, random2048)
    EXPECT_EQ(rng.Rndm(), 0.74670661284082484599);
 }
 
+TEST(RanluxppEngine, RndmArray)
+{
+   RanluxppEngine2048 rng(314159265);
+   RanluxppEngine2048 ref(314159265);
+
+   // Start in the middle of a block and fill across several blocks.
+   rng.Skip(5);
+   ref.Skip(5);
+   double array[50];
+   rng.RndmArray(50, array);
+   for (double r : array)
+      EXPECT_EQ(r, ref.Rndm());
+   EXPECT_EQ(rng.IntRndm(), ref.IntRndm());
+}
+
 TEST(RanluxppCompatEngineJames, P3)
 {
    RanluxppCompatEngineJamesP3 rng(314159265);
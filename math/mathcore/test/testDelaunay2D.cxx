@@ -7,6 +7,9 @@
 
 #include "gtest/gtest.h"
 
+#include <random>
+#include <vector>
+
 // test Delauney interpolation on edges of a triangle
 // some of these tests failed when using the older version
 // see issue #
@@ -62,3 +65,31 @@ TEST(Delaunay2D,interpolation_at_edges)
 }
 
 
+
+// interpolation of a plane from many points, which uses a finer grid of cells to locate the triangles
+TEST(Delaunay2D, interpolation_many_points)
+{
+   const int n = 20000;
+   std::mt19937 gen(5);
+   std::uniform_real_distribution<double> uniform(-1., 1.);
+   std::vector<double> x(n), y(n), z(n);
+   for (int i = 0; i < n; ++i) {
+      x[i] = uniform(gen);
+      y[i] = 10. * uniform(gen);
+      z[i] = 2. * x[i] + 0.3 * y[i] + 1.;
+   }
+   ROOT::Math::Delaunay2D d(n, x.data(), y.data(), z.data());
+
+   const int m = 1000;
+   std::vector<double> xi(m), yi(m), zi(m);
+   for (int i = 0; i < m; ++i) {
+      xi[i] = 0.9 * uniform(gen);
+      yi[i] = 9. * uniform(gen);
+   }
+   d.Interpolate(m, xi.data(), yi.data(), zi.data());
+   for (int i = 0; i < m; ++i) {
+      EXPECT_NEAR(zi[i], 2. * xi[i] + 0.3 * yi[i] + 1., 1.E-9);
+      EXPECT_EQ(zi[i], d.Interpolate(xi[i], yi[i]));
+   }
+   EXPECT_DOUBLE_EQ(d.Interpolate(2., 0.), 0.);
+}
@@ -0,0 +1,116 @@
+#include "Math/VectorizedFuncMathCore.h"
+#include "Math/PdfFuncMathCore.h"
+#include "Math/ProbFuncMathCore.h"
+#include "Math/QuantFuncMathCore.h"
+#include "Math/SpecFuncMathCore.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Size which is not a multiple of the vector size, to test the last partial vector
+constexpr std::size_t kN = 10007;
+
+std::vector<double> UniformValues(double a, double b)
+{
+   std::mt19937_64 gen(4357);
+   std::uniform_real_distribution<double> dist(a, b);
+   std::vector<double> x(kN);
+   for (auto &xi : x)
+      xi = dist(gen);
+   return x;
+}
+
+// The vectorized functions evaluate the same approximations as the scalar ones,
+// they only differ by the rounding of the vectorized exp and log
+template <class Scalar>
+void ExpectNearScalar(const std::vector<double> &x, const std::vector<double> &out, Scalar scalar, double absTol = 0)
+{
+   for (std::size_t i = 0; i < x.size(); ++i) {
+      const double expected = scalar(x[i]);
+      EXPECT_NEAR(out[i], expected, std::max(absTol, 1e-13 * std::abs(expected))) << "at x = " << x[i];
+   }
+}
+
+TEST(VectorizedFuncMathCore, Erf)
+{
+   const auto x = UniformValues(-6, 6);
+   std::vector<double> out(x.size());
+   ROOT::Math::erf(x, out);
+   ExpectNearScalar(x, out, [](double xi) { return ROOT::Math::erf(xi); });
+   ROOT::Math::erfc(x, out);
+   ExpectNearScalar(x, out, [](double xi) { return ROOT::Math::erfc(xi); });
+}
+
+TEST(VectorizedFuncMathCore, Lgamma)
+{
+   for (auto range : {std::make_pair(-50., 0.), std::make_pair(0., 13.), std::make_pair(13., 1.e4)}) {
+      const auto x = UniformValues(range.first, range.second);
+      std::vector<double> out(x.size());
+      ROOT::Math::lgamma(x, out);
+      ExpectNearScalar(x, out, [](double xi) { return ROOT::Math::lgamma(xi); }, 1e-13);
+   }
+
+   // poles at the non-positive integers
+   const std::vector<double> poles{0., -1., -2., -40.};
+   std::vector<double> out(poles.size());
+   ROOT::Math::lgamma(poles, out);
+   for (auto value : out)
+      EXPECT_TRUE(std::isinf(value));
+}
+
+TEST(VectorizedFuncMathCore, Pdf)
+{
+   const auto x = UniformValues(-5, 40);
+   std::vector<double> out(x.size());
+   ROOT::Math::normal_pdf(x, out, 3.5, 2.);
+   ExpectNearScalar(x, out, [](double xi) { return ROOT::Math::normal_pdf(xi, 3.5, 2.); });
+   ROOT::Math::lognormal_pdf(x, out, 0.5, 1.5, -1.);
+   ExpectNearScalar(x, out, [](double xi) { return ROOT::Math::lognormal_pdf(xi, 0.5, 1.5, -1.); });
+   ROOT::Math::exponential_pdf(x, out, 0.7, 1.);
+   ExpectNearScalar(x, out, [](double xi) { return ROOT::Math::exponential_pdf(xi, 0.7, 1.); });
+   ROOT::Math::chisquared_pdf(x, out, 7.);
+   ExpectNearScalar(x, out, [](double xi) { return ROOT::Math::chisquared_pdf(xi, 7.); });
+
+   std::vector<double> n(200);
+   for (std::size_t i = 0; i < n.size(); ++i)
+      n[i] = i;
+   out.resize(n.size());
+   for (double mu : {0., 0.3, 12., 150.}) {
+      ROOT::Math::poisson_pdf(n, out, mu);
+      ExpectNearScalar(n, out,
+                       [mu](double ni) { return ROOT::Math::poisson_pdf(static_cast<unsigned int>(ni), mu); });
+   }
+}
+
+TEST(VectorizedFuncMathCore, Cdf)
+{
+   const auto x = UniformValues(-30, 30);
+   std::vector<double> out(x.size());
+   ROOT::Math::normal_cdf(x, out, 2., 1.);
+   ExpectNearScalar(x, out, [](double xi) { return ROOT::Math::normal_cdf(xi, 2., 1.); });
+   ROOT::Math::normal_cdf_c(x, out, 2., 1.);
+   ExpectNearScalar(x, out, [](double xi) { return ROOT::Math::normal_cdf_c(xi, 2., 1.); });
+
+   const auto z = UniformValues(0, 1);
+   ROOT::Math::normal_quantile(z, out, 2.);
+   ExpectNearScalar(z, out, [](double zi) { return ROOT::Math::normal_quantile(zi, 2.); });
+   ROOT::Math::normal_quantile_c(z, out, 2.);
+   ExpectNearScalar(z, out, [](double zi) { return ROOT::Math::normal_quantile_c(zi, 2.); });
+}
+
+#if defined(R__HAS_VECCORE) && defined(R__HAS_VC)
+TEST(VectorizedFuncMathCore, DoubleV)
+{
+   constexpr std::size_t kVS = vecCore::VectorSize<ROOT::Double_v>();
+   double in[kVS];
+   double out[kVS];
+   for (std::size_t i = 0; i < kVS; ++i)
+      in[i] = -2. + 0.7 * i;
+   ROOT::Math::normal_cdf(ROOT::Double_v(in, Vc::Unaligned), 1.5).store(out, Vc::Unaligned);
+   for (std::size_t i = 0; i < kVS; ++i)
+      EXPECT_NEAR(out[i], ROOT::Math::normal_cdf(in[i], 1.5), 1e-15);
+}
+#endif
@@ -20,6 +20,7 @@ See the \ref Matrix page for the documentation of the linear algebra package
 
 */
 
+#include <algorithm>
 #include <typeinfo>
 
 #include "TMatrixT.h"
@@ -30,9 +31,80 @@ See the \ref Matrix page for the documentation of the linear algebra package
 #include "TDecompLU.h"
 #include "TMatrixDEigen.h"
 #include "TMath.h"
+#include "TROOT.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
 
 templateClassImp(TMatrixT);
 
+namespace {
+
+/// Products with at least this many multiply-adds are split over the threads of the implicit MT pool
+constexpr Long64_t kMinMultOpsForImt = 1 << 22;
+/// Tile sizes (rows of the inner dimension and columns) such that a tile of the right-hand operand stays in cache
+/// while it is applied to all the rows of the result
+constexpr Int_t kMultInnerTile = 64;
+constexpr Int_t kMultColTile = 256;
+/// Below this number of columns of the result, the elements are computed one by one as dot products
+constexpr Int_t kMinColsForRowUpdate = 8;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Calls work(firstRow, endRow) on consecutive chunks of the nrows rows of a matrix product with nops
+/// multiply-adds. The chunks are processed in parallel if implicit multi-threading is enabled and the product is
+/// large enough. Since every row of the result is computed by one thread with the same sequence of operations,
+/// the result does not depend on the number of threads.
+
+template <class F>
+void ForEachRowChunk(Int_t nrows, Long64_t nops, F &&work)
+{
+#ifdef R__USE_IMT
+   if (nrows > 1 && nops >= kMinMultOpsForImt && ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor pool;
+      const Int_t nChunks = std::min<Int_t>(nrows, 4 * pool.GetPoolSize());
+      const Int_t chunkSize = (nrows + nChunks - 1) / nChunks;
+      pool.Foreach([&](Int_t iChunk) { work(iChunk * chunkSize, std::min(nrows, (iChunk + 1) * chunkSize)); },
+                   ROOT::TSeqI(nChunks));
+      return;
+   }
+#else
+   (void)nops;
+#endif
+   work(0, nrows);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Computes the rows [firstRow, endRow) of C = op(A) * B, where B has ninner rows and ncols columns and
+/// op(A)[i,k] = ap[i * arowStride + k * ainnerStride]. The rows of C are updated with multiples of the rows of B,
+/// in tiles of B that fit in the cache. Every element of C accumulates its terms in the same order as the
+/// naive dot product.
+
+template <class Element>
+void RowUpdateMult(const Element *ap, Int_t arowStride, Int_t ainnerStride, const Element *bp, Int_t ninner,
+                   Int_t ncols, Element *cp, Int_t firstRow, Int_t endRow)
+{
+   std::fill(cp + firstRow * ncols, cp + endRow * ncols, Element(0));
+   for (Int_t j0 = 0; j0 < ncols; j0 += kMultColTile) {
+      const Int_t j1 = std::min(ncols, j0 + kMultColTile);
+      for (Int_t k0 = 0; k0 < ninner; k0 += kMultInnerTile) {
+         const Int_t k1 = std::min(ninner, k0 + kMultInnerTile);
+         for (Int_t i = firstRow; i < endRow; ++i) {
+            const Element *arp = ap + i * arowStride;
+            Element *crp = cp + i * ncols;
+            for (Int_t k = k0; k < k1; ++k) {
+               const Element aik = arp[k * ainnerStride];
+               const Element *brp = bp + k * ncols;
+               for (Int_t j = j0; j < j1; ++j)
+                  crp[j] += aik * brp[j];
+            }
+         }
+      }
+   }
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Constructor for (nrows x ncols) matrix
 
@@ -3081,20 +3153,28 @@ template <class Element>
 void TMatrixTAutoloadOps::AMultB(const Element *const ap, Int_t na, Int_t ncolsa, const Element *const bp, Int_t nb,
                                  Int_t ncolsb, Element *cp)
 {
-   const Element *arp0 = ap; // Pointer to  A[i,0];
-   while (arp0 < ap + na) {
-      for (const Element *bcp = bp; bcp < bp + ncolsb;) { // Pointer to the j-th column of B, Start bcp = B[0,0]
-         const Element *arp = arp0;                       // Pointer to the i-th row of A, reset to A[i,0]
-         Element cij = 0;
-         while (bcp < bp + nb) {  // Scan the i-th row of A and
-            cij += *arp++ * *bcp; // the j-th col of B
-            bcp += ncolsb;
+   if (ncolsa == 0 || ncolsb == 0)
+      return;
+   const Int_t nrowsa = na / ncolsa;
+   ForEachRowChunk(nrowsa, Long64_t(na) * ncolsb, [&](Int_t firstRow, Int_t endRow) {
+      if (ncolsb >= kMinColsForRowUpdate) {
+         RowUpdateMult(ap, ncolsa, 1, bp, ncolsa, ncolsb, cp, firstRow, endRow);
+         return;
+      }
+      Element *crp = cp + firstRow * ncolsb;
+      for (const Element *arp0 = ap + firstRow * ncolsa; arp0 < ap + endRow * ncolsa; arp0 += ncolsa) {
+         for (const Element *bcp = bp; bcp < bp + ncolsb;) { // Pointer to the j-th column of B, Start bcp = B[0,0]
+            const Element *arp = arp0;                       // Pointer to the i-th row of A, reset to A[i,0]
+            Element cij = 0;
+            while (bcp < bp + nb) {  // Scan the i-th row of A and
+               cij += *arp++ * *bcp; // the j-th col of B
+               bcp += ncolsb;
+            }
+            *crp++ = cij;
+            bcp -= nb - 1; // Set bcp to the (j+1)-th col
          }
-         *cp++ = cij;
-         bcp -= nb - 1; // Set bcp to the (j+1)-th col
       }
-      arp0 += ncolsa; // Set ap to the (i+1)-th row
-   }
+   });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3104,21 +3184,29 @@ template <class Element>
 void TMatrixTAutoloadOps::AtMultB(const Element *const ap, Int_t ncolsa, const Element *const bp, Int_t nb,
                                   Int_t ncolsb, Element *cp)
 {
-   const Element *acp0 = ap; // Pointer to  A[i,0];
-   while (acp0 < ap + ncolsa) {
-      for (const Element *bcp = bp; bcp < bp + ncolsb;) { // Pointer to the j-th column of B, Start bcp = B[0,0]
-         const Element *acp = acp0;                       // Pointer to the i-th column of A, reset to A[0,i]
-         Element cij = 0;
-         while (bcp < bp + nb) { // Scan the i-th column of A and
-            cij += *acp * *bcp;  // the j-th col of B
-            acp += ncolsa;
-            bcp += ncolsb;
+   if (ncolsa == 0 || ncolsb == 0)
+      return;
+   const Int_t nrowsb = nb / ncolsb;
+   ForEachRowChunk(ncolsa, Long64_t(nb) * ncolsa, [&](Int_t firstRow, Int_t endRow) {
+      if (ncolsb >= kMinColsForRowUpdate) {
+         RowUpdateMult(ap, 1, ncolsa, bp, nrowsb, ncolsb, cp, firstRow, endRow);
+         return;
+      }
+      Element *crp = cp + firstRow * ncolsb;
+      for (const Element *acp0 = ap + firstRow; acp0 < ap + endRow; acp0++) {
+         for (const Element *bcp = bp; bcp < bp + ncolsb;) { // Pointer to the j-th column of B, Start bcp = B[0,0]
+            const Element *acp = acp0;                       // Pointer to the i-th column of A, reset to A[0,i]
+            Element cij = 0;
+            while (bcp < bp + nb) { // Scan the i-th column of A and
+               cij += *acp * *bcp;  // the j-th col of B
+               acp += ncolsa;
+               bcp += ncolsb;
+            }
+            *crp++ = cij;
+            bcp -= nb - 1; // Set bcp to the (j+1)-th col
          }
-         *cp++ = cij;
-         bcp -= nb - 1; // Set bcp to the (j+1)-th col
       }
-      acp0++; // Set acp0 to the (i+1)-th col
-   }
+   });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3128,20 +3216,31 @@ template <class Element>
 void TMatrixTAutoloadOps::AMultBt(const Element *const ap, Int_t na, Int_t ncolsa, const Element *const bp, Int_t nb,
                                   Int_t ncolsb, Element *cp)
 {
-   const Element *arp0 = ap; // Pointer to  A[i,0];
-   while (arp0 < ap + na) {
-      const Element *brp0 = bp; // Pointer to  B[j,0];
-      while (brp0 < bp + nb) {
-         const Element *arp = arp0; // Pointer to the i-th row of A, reset to A[i,0]
-         const Element *brp = brp0; // Pointer to the j-th row of B, reset to B[j,0]
-         Element cij = 0;
-         while (brp < brp0 + ncolsb) // Scan the i-th row of A and
-            cij += *arp++ * *brp++;  // the j-th row of B
-         *cp++ = cij;
-         brp0 += ncolsb; // Set brp0 to the (j+1)-th row
+   if (ncolsa == 0 || ncolsb == 0)
+      return;
+   const Int_t nrowsa = na / ncolsa;
+   const Int_t nrowsb = nb / ncolsb;
+   ForEachRowChunk(nrowsa, Long64_t(na) * nrowsb, [&](Int_t firstRow, Int_t endRow) {
+      // The rows of A and B are scanned together; tiles of B are reused for all the rows of the chunk
+      std::fill(cp + firstRow * nrowsb, cp + endRow * nrowsb, Element(0));
+      for (Int_t j0 = 0; j0 < nrowsb; j0 += kMultInnerTile) {
+         const Int_t j1 = std::min(nrowsb, j0 + kMultInnerTile);
+         for (Int_t k0 = 0; k0 < ncolsb; k0 += kMultColTile) {
+            const Int_t k1 = std::min(ncolsb, k0 + kMultColTile);
+            for (Int_t i = firstRow; i < endRow; ++i) {
+               const Element *arp = ap + i * ncolsa;
+               Element *crp = cp + i * nrowsb;
+               for (Int_t j = j0; j < j1; ++j) {
+                  const Element *brp = bp + j * ncolsb;
+                  Element cij = crp[j];
+                  for (Int_t k = k0; k < k1; ++k)
+                     cij += arp[k] * brp[k];
+                  crp[j] = cij;
+               }
+            }
+         }
       }
-      arp0 += ncolsa; // Set arp0 to the (i+1)-th row
-   }
+   });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -217,3 +217,32 @@ TEST_F(testMatrixD, Eigen)
 
    CompareTMatrix(B, C);
 }
+
+// Products large enough to go through the tiled kernels, compared with the naive sums
+TEST(testMatrixT, LargeMult)
+{
+   const Int_t m = 150, k = 130, l = 300;
+   TMatrixD a(m, k), b(k, l);
+   for (Int_t i = 0; i < m; i++)
+      for (Int_t j = 0; j < k; j++)
+         a(i, j) = std::sin(i + 0.5 * j);
+   for (Int_t i = 0; i < k; i++)
+      for (Int_t j = 0; j < l; j++)
+         b(i, j) = std::cos(0.3 * i - j);
+
+   TMatrixD expected(m, l);
+   for (Int_t i = 0; i < m; i++) {
+      for (Int_t j = 0; j < l; j++) {
+         double sum = 0;
+         for (Int_t p = 0; p < k; p++)
+            sum += a(i, p) * b(p, j);
+         expected(i, j) = sum;
+      }
+   }
+
+   const TMatrixD at(TMatrixD::kTransposed, a);
+   const TMatrixD bt(TMatrixD::kTransposed, b);
+   CompareTMatrix(a * b, expected);
+   CompareTMatrix(TMatrixD(at, TMatrixD::kTransposeMult, b), expected);
+   CompareTMatrix(TMatrixD(a, TMatrixD::kMultTranspose, bt), expected);
+}
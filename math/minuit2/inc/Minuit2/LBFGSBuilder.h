@@ -0,0 +1,55 @@
+// @(#)root/minuit2:$Id$
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2026 LCG ROOT Math team,  CERN/EP-SFT                *
+ *                                                                    *
+ **********************************************************************/
+
+#ifndef ROOT_Minuit2_LBFGSBuilder
+#define ROOT_Minuit2_LBFGSBuilder
+
+#include "Minuit2/MnConfig.h"
+#include "Minuit2/MinimumBuilder.h"
+
+#include <vector>
+
+namespace ROOT {
+
+namespace Minuit2 {
+
+class MinimumState;
+
+/**
+   Build the minimum with the limited-memory BFGS method.
+   The inverse Hessian is never stored: the search direction is computed from the last steps and gradient changes
+   with the two-loop recursion, so every iteration costs O(m n) in time and memory for m stored corrections and
+   n parameters. The returned states keep the error matrix of the seed, so the covariance is only an estimate,
+   unless strategy 2 is used, in which case MnHesse is run at the minimum. Otherwise MnHesse can be run on request.
+ */
+
+class LBFGSBuilder : public MinimumBuilder {
+
+public:
+   LBFGSBuilder(unsigned int nCorrections = 10) : fNCorrections(nCorrections > 0 ? nCorrections : 1) {}
+
+   ~LBFGSBuilder() override {}
+
+   FunctionMinimum Minimum(const MnFcn &, const GradientCalculator &, const MinimumSeed &, const MnStrategy &,
+                           unsigned int, double) const override;
+
+   /// number of (step, gradient change) pairs used to approximate the inverse Hessian
+   unsigned int NCorrections() const { return fNCorrections; }
+   void SetNCorrections(unsigned int n) { fNCorrections = n > 0 ? n : 1; }
+
+private:
+   void AddResult(std::vector<MinimumState> &result, const MinimumState &state) const;
+
+   unsigned int fNCorrections;
+};
+
+} // namespace Minuit2
+
+} // namespace ROOT
+
+#endif // ROOT_Minuit2_LBFGSBuilder
@@ -33,7 +33,7 @@ class FunctionMinimum;
 class MnTraceObject;
 
 // enumeration specifying the type of Minuit2 minimizers
-enum EMinimizerType { kMigrad, kSimplex, kCombined, kScan, kFumili, kMigradBFGS };
+enum EMinimizerType { kMigrad, kSimplex, kCombined, kScan, kFumili, kMigradBFGS, kLBFGS };
 
 } // namespace Minuit2
 
@@ -45,6 +45,9 @@ namespace Minuit2 {
    In ROOT it can be instantiated using the plug-in manager (plug-in "Minuit2")
    Using a string  (used by the plugin manager) or via an enumeration
    an one can set all the possible minimization algorithms (Migrad, Simplex, Combined, Scan and Fumili).
+   The "LBFGS" algorithm is a limited-memory quasi-Newton method for fits with many parameters: it does not
+   update a full error matrix, so the errors are only estimated unless strategy 2 is used or Hesse() is called.
+   The number of stored corrections (default 10) is set with the "LBFGSCorrections" extra option.
 
    Refer to the [guide](https://root.cern/root/htmldoc/guides/minuit2/Minuit2.html) for an introduction how Minuit
    works.
@@ -40,6 +40,7 @@ public:
    unsigned int GradientNCycles() const { return fGradNCyc; }
    double GradientStepTolerance() const { return fGradTlrStp; }
    double GradientTolerance() const { return fGradTlr; }
+   unsigned int GradientParallel() const { return fGradParallel; }
 
    unsigned int HessianNCycles() const { return fHessNCyc; }
    double HessianStepTolerance() const { return fHessTlrStp; }
@@ -47,6 +48,8 @@ public:
    unsigned int HessianGradientNCycles() const { return fHessGradNCyc; }
    unsigned int HessianCentralFDMixedDerivatives() const { return fHessCFDG2; }
    unsigned int HessianForcePosDef() const { return fHessForcePosDef; }
+   unsigned int HessianParallel() const { return fHessParallel; }
+   unsigned int HessianFromGradient() const { return fHessFromGrad; }
 
    int StorageLevel() const { return fStoreLevel; }
 
@@ -64,6 +67,11 @@ public:
    void SetGradientStepTolerance(double stp) { fGradTlrStp = stp; }
    void SetGradientTolerance(double toler) { fGradTlr = toler; }
 
+   // 1 = evaluate the numerical derivatives of the parameters in parallel, using the
+   //     ROOT implicit multi-threading pool if enabled. The FCN must be thread-safe.
+   // 0 = evaluate them one after the other (default)
+   void SetGradientParallel(unsigned int flag) { fGradParallel = flag; }
+
    void SetHessianNCycles(unsigned int n) { fHessNCyc = n; }
    void SetHessianStepTolerance(double stp) { fHessTlrStp = stp; }
    void SetHessianG2Tolerance(double toler) { fHessTlrG2 = toler; }
@@ -77,6 +85,16 @@ public:
    // 0 = do not force matrix positive definite
    void SetHessianForcePosDef(unsigned int flag) { fHessForcePosDef = flag; }
 
+   // 1 = evaluate the mixed second derivatives in parallel, using the ROOT implicit
+   //     multi-threading pool if enabled. The FCN must be thread-safe.
+   // 0 = evaluate them one after the other (default)
+   void SetHessianParallel(unsigned int flag) { fHessParallel = flag; }
+
+   // 1 = when the FCN provides the gradient but not the Hessian, compute the Hessian from
+   //     central differences of the gradient (2n gradient calls instead of O(n^2) FCN calls)
+   // 0 = compute it from finite differences of the FCN values (default)
+   void SetHessianFromGradient(unsigned int flag) { fHessFromGrad = flag; }
+
    // set storage level of iteration quantities
    // 0 = store only last iterations 1 = full storage (default)
    void SetStorageLevel(unsigned int level) { fStoreLevel = level; }
@@ -87,12 +105,15 @@ private:
    unsigned int fGradNCyc;
    double fGradTlrStp;
    double fGradTlr;
+   int fGradParallel;
    unsigned int fHessNCyc;
    double fHessTlrStp;
    double fHessTlrG2;
    unsigned int fHessGradNCyc;
    int fHessCFDG2;
    int fHessForcePosDef;
+   int fHessParallel;
+   int fHessFromGrad;
    int fStoreLevel;
 };
 
@@ -0,0 +1,237 @@
+// @(#)root/minuit2:$Id$
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2026 LCG ROOT Math team,  CERN/EP-SFT                *
+ *                                                                    *
+ **********************************************************************/
+
+#include "Minuit2/LBFGSBuilder.h"
+#include "Minuit2/GradientCalculator.h"
+#include "Minuit2/MinimumState.h"
+#include "Minuit2/MinimumError.h"
+#include "Minuit2/FunctionGradient.h"
+#include "Minuit2/FunctionMinimum.h"
+#include "Minuit2/MnLineSearch.h"
+#include "Minuit2/MinimumSeed.h"
+#include "Minuit2/MnFcn.h"
+#include "Minuit2/MnMachinePrecision.h"
+#include "Minuit2/MnParabolaPoint.h"
+#include "Minuit2/LaSum.h"
+#include "Minuit2/LaProd.h"
+#include "Minuit2/MnStrategy.h"
+#include "Minuit2/MnHesse.h"
+#include "Minuit2/MnPrint.h"
+
+#include <cmath>
+#include <deque>
+
+namespace ROOT {
+
+namespace Minuit2 {
+
+double inner_product(const LAVector &, const LAVector &);
+
+namespace {
+
+/// one correction pair of the L-BFGS approximation: step s, gradient change y and 1 / (y^T s)
+struct LBFGSCorrection {
+   MnAlgebraicVector s;
+   MnAlgebraicVector y;
+   double rho;
+};
+
+/// Compute the descent direction -H g with the two-loop recursion. The initial inverse Hessian is the diagonal
+/// of the seed error matrix as long as no correction is available, and gamma * I with gamma = s^T y / y^T y of the
+/// latest correction afterwards.
+MnAlgebraicVector LBFGSDirection(const std::deque<LBFGSCorrection> &corrections, const MnAlgebraicVector &grad,
+                                 const MnAlgebraicSymMatrix &seedInvHessian)
+{
+   const unsigned int n = grad.size();
+   MnAlgebraicVector q(grad);
+   std::vector<double> alpha(corrections.size());
+   for (unsigned int k = corrections.size(); k-- > 0;) {
+      const LBFGSCorrection &c = corrections[k];
+      alpha[k] = c.rho * inner_product(c.s, q);
+      for (unsigned int i = 0; i < n; ++i)
+         q(i) -= alpha[k] * c.y(i);
+   }
+   if (corrections.empty()) {
+      for (unsigned int i = 0; i < n; ++i)
+         q(i) *= seedInvHessian(i, i);
+   } else {
+      const LBFGSCorrection &c = corrections.back();
+      const double gamma = 1. / (c.rho * inner_product(c.y, c.y));
+      for (unsigned int i = 0; i < n; ++i)
+         q(i) *= gamma;
+   }
+   for (unsigned int k = 0; k < corrections.size(); ++k) {
+      const LBFGSCorrection &c = corrections[k];
+      const double beta = c.rho * inner_product(c.y, q);
+      for (unsigned int i = 0; i < n; ++i)
+         q(i) += (alpha[k] - beta) * c.s(i);
+   }
+   for (unsigned int i = 0; i < n; ++i)
+      q(i) = -q(i);
+   return q;
+}
+
+} // namespace
+
+void LBFGSBuilder::AddResult(std::vector<MinimumState> &result, const MinimumState &state) const
+{
+   result.push_back(state);
+   if (TraceIter())
+      TraceIteration(result.size() - 1, result.back());
+   else {
+      MnPrint print("LBFGSBuilder", PrintLevel());
+      print.Info(MnPrint::Oneline(result.back(), result.size() - 1));
+   }
+}
+
+FunctionMinimum LBFGSBuilder::Minimum(const MnFcn &fcn, const GradientCalculator &gc, const MinimumSeed &seed,
+                                      const MnStrategy &strategy, unsigned int maxfcn, double edmval) const
+{
+   // minimization with the limited-memory BFGS method: the search direction is obtained from the last
+   // fNCorrections steps and gradient changes, and the error matrix of the seed is never updated.
+   // Stop when the edm estimated from the L-BFGS direction is less than required (edmval)
+
+   MnPrint print("LBFGSBuilder", PrintLevel());
+
+   // same convention as in VariableMetricBuilder, to be consistent with F77 Minuit
+   edmval *= 0.002;
+
+   FunctionMinimum min(seed, fcn.Up());
+
+   if (seed.Parameters().Vec().size() == 0) {
+      print.Warn("No free parameters.");
+      return min;
+   }
+
+   if (!seed.IsValid()) {
+      print.Error("Minimum seed invalid.");
+      return min;
+   }
+
+   const MnMachinePrecision &prec = seed.Precision();
+   // the (approximate) error matrix of the seed is shared by all states, no n x n matrix is created
+   const MinimumError &error = seed.Error();
+
+   std::vector<MinimumState> result;
+   result.reserve(StorageLevel() > 0 ? 10 : 2);
+
+   print.Info("Start iterating until Edm is <", edmval, "with call limit =", maxfcn, "and", fNCorrections,
+              "corrections");
+
+   AddResult(result, seed.State());
+
+   std::deque<LBFGSCorrection> corrections;
+   MnLineSearch lsearch;
+   MinimumState s0 = seed.State();
+
+   MnAlgebraicVector step = LBFGSDirection(corrections, s0.Gradient().Vec(), error.InvHessian());
+   double gdel = inner_product(step, s0.Gradient().Grad());
+   double edm = -0.5 * gdel;
+
+   while (edm > edmval && fcn.NumOfCalls() < maxfcn) {
+
+      print.Debug("Iteration", result.size(), "Fval", s0.Fval(), "numOfCall", fcn.NumOfCalls(),
+                  "\n  Internal parameters", s0.Vec(), "\n  L-BFGS step", step);
+
+      if (inner_product(s0.Gradient().Vec(), s0.Gradient().Vec()) <= 0) {
+         print.Debug("all derivatives are zero - return current status");
+         break;
+      }
+
+      MnParabolaPoint pp = lsearch(fcn, s0.Parameters(), step, gdel, prec);
+
+      // <= needed for case 0 <= 0
+      if (std::fabs(pp.Y() - s0.Fval()) <= std::fabs(s0.Fval()) * prec.Eps()) {
+         print.Warn("No improvement in line search");
+         if (corrections.empty())
+            break;
+         // restart from the diagonal of the seed error matrix
+         corrections.clear();
+         step = LBFGSDirection(corrections, s0.Gradient().Vec(), error.InvHessian());
+         gdel = inner_product(step, s0.Gradient().Grad());
+         edm = -0.5 * gdel;
+         continue;
+      }
+
+      MinimumParameters p(s0.Vec() + pp.X() * step, pp.Y());
+      FunctionGradient g = gc(p, s0.Gradient());
+
+      MnAlgebraicVector dx = p.Vec() - s0.Vec();
+      MnAlgebraicVector dg = g.Vec() - s0.Gradient().Vec();
+      const double sy = inner_product(dx, dg);
+      // keep only corrections satisfying the curvature condition, so the approximation stays positive-definite
+      if (sy > prec.Eps() * std::sqrt(inner_product(dx, dx) * inner_product(dg, dg))) {
+         if (corrections.size() == fNCorrections)
+            corrections.pop_front();
+         corrections.push_back({dx, dg, 1. / sy});
+      }
+
+      step = LBFGSDirection(corrections, g.Vec(), error.InvHessian());
+      gdel = inner_product(step, g.Grad());
+      if (!(gdel < 0.)) {
+         print.Warn("L-BFGS direction is not a descent direction, gdel =", gdel, "; reset the corrections");
+         corrections.clear();
+         step = LBFGSDirection(corrections, g.Vec(), error.InvHessian());
+         gdel = inner_product(step, g.Grad());
+      }
+      edm = -0.5 * gdel;
+
+      if (std::isnan(edm)) {
+         print.Warn("Edm is NaN; stop iterations");
+         break;
+      }
+
+      s0 = MinimumState(p, error, g, edm, fcn.NumOfCalls());
+      if (StorageLevel() || result.size() <= 1)
+         AddResult(result, s0);
+      else
+         // use a reduced state for not-final iterations
+         AddResult(result, MinimumState(p.Fval(), edm, fcn.NumOfCalls()));
+   }
+
+   // the last state must be a complete one
+   if (!result.back().IsValid())
+      result.back() = s0;
+
+   if (fcn.NumOfCalls() >= maxfcn) {
+      print.Warn("Call limit exceeded");
+      return FunctionMinimum(seed, result, fcn.Up(), FunctionMinimum::MnReachedCallLimit);
+   }
+
+   // the error matrix is only estimated by the L-BFGS iterations: compute the Hessian only when requested
+   // by the strategy, otherwise users can run MnHesse on the result
+   if (strategy.Strategy() >= 2) {
+      MnStrategy strat(strategy);
+      strat.SetHessianForcePosDef(1);
+      MinimumState st = MnHesse(strat)(fcn, s0, seed.Trafo(), maxfcn);
+      print.Info("After Hessian");
+      if (st.IsValid()) {
+         edm = st.Edm();
+         AddResult(result, st);
+      } else {
+         print.Warn("Invalid Hessian");
+      }
+   }
+
+   FunctionMinimum::Status status = FunctionMinimum::MnValid;
+   if (result.back().Error().HasReachedCallLimit()) {
+      status = FunctionMinimum::MnReachedCallLimit;
+   } else if (edm > 10 * edmval && edm >= std::fabs(prec.Eps2() * result.back().Fval())) {
+      print.Warn("No convergence; Edm", edm, "is above tolerance", 10 * edmval);
+      status = FunctionMinimum::MnAboveMaxEdm;
+   }
+   min = FunctionMinimum(seed, result, fcn.Up(), status);
+
+   print.Debug("Minimum found", min);
+
+   return min;
+}
+
+} // namespace Minuit2
+
+} // namespace ROOT
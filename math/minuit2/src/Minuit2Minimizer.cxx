@@ -29,6 +29,7 @@
 #include "Minuit2/MnUserFcn.h"
 #include "Minuit2/MnPrint.h"
 #include "Minuit2/VariableMetricMinimizer.h"
+#include "Minuit2/LBFGSMinimizer.h"
 #include "Minuit2/SimplexMinimizer.h"
 #include "Minuit2/CombinedMinimizer.h"
 #include "Minuit2/ScanMinimizer.h"
@@ -109,6 +110,8 @@ Minuit2Minimizer::Minuit2Minimizer(const char *type) : fDim(0), fMinimizer(nullp
       algoType = kFumili;
    if (algoname == "bfgs")
       algoType = kMigradBFGS;
+   if (algoname == "lbfgs")
+      algoType = kLBFGS;
 
    SetMinimizerType(algoType);
 }
@@ -126,6 +129,9 @@ void Minuit2Minimizer::SetMinimizerType(ROOT::Minuit2::EMinimizerType type)
       // std::cout << "Minuit2Minimizer: minimize using MIGRAD " << std::endl;
       SetMinimizer(new ROOT::Minuit2::VariableMetricMinimizer(VariableMetricMinimizer::BFGSType()));
       return;
+   case ROOT::Minuit2::kLBFGS:
+      SetMinimizer(new ROOT::Minuit2::LBFGSMinimizer());
+      return;
    case ROOT::Minuit2::kSimplex:
       // std::cout << "Minuit2Minimizer: minimize using SIMPLEX " << std::endl;
       SetMinimizer(new ROOT::Minuit2::SimplexMinimizer());
@@ -426,6 +432,9 @@ ROOT::Minuit2::MnStrategy customizedStrategy(unsigned int strategyLevel, ROOT::M
    st.SetGradientNCycles(customize("GradientNCycles", int(st.GradientNCycles())));
    st.SetHessianNCycles(customize("HessianNCycles", int(st.HessianNCycles())));
    st.SetHessianGradientNCycles(customize("HessianGradientNCycles", int(st.HessianGradientNCycles())));
+   st.SetGradientParallel(customize("GradientParallel", int(st.GradientParallel())));
+   st.SetHessianParallel(customize("HessianParallel", int(st.HessianParallel())));
+   st.SetHessianFromGradient(customize("HessianFromGradient", int(st.HessianFromGradient())));
 
    st.SetGradientTolerance(customize("GradientTolerance", st.GradientTolerance()));
    st.SetGradientStepTolerance(customize("GradientStepTolerance", st.GradientStepTolerance()));
@@ -496,6 +505,12 @@ bool Minuit2Minimizer::Minimize()
       if (ret)
          SetStorageLevel(storageLevel);
 
+      // number of corrections kept by the limited-memory BFGS method
+      int nCorrections = 0;
+      auto *lbfgsBuilder = dynamic_cast<ROOT::Minuit2::LBFGSBuilder *>(&fMinimizer->Builder());
+      if (lbfgsBuilder && minuit2Opt->GetValue("LBFGSCorrections", nCorrections) && nCorrections > 0)
+         lbfgsBuilder->SetNCorrections(nCorrections);
+
       if (printLevel > 0) {
          std::cout << "Minuit2Minimizer::Minuit  - Changing default options" << std::endl;
          minuit2Opt->Print();
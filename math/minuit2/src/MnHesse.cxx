@@ -23,10 +23,78 @@
 #include "Minuit2/MnPrint.h"
 #include "Minuit2/MPIProcess.h"
 
+#ifdef USE_ROOT_ERROR
+#include "RConfigure.h" // R__USE_IMT
+#endif
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h" // IsImplicitMTEnabled
+#endif
+
+#include <cmath>
+#include <vector>
+
 namespace ROOT {
 
 namespace Minuit2 {
 
+namespace {
+
+/// Compute the Hessian from central finite differences of the analytical gradient, one column per parameter.
+/// The step of each parameter is scaled by its current error estimate (or value), and the matrix is symmetrized.
+bool HessianFromGradient(const AnalyticalGradientCalculator &hc, const MinimumState &st,
+                         const MnMachinePrecision &prec, bool parallel, MnAlgebraicSymMatrix &hmat)
+{
+   const MnAlgebraicVector &x0 = st.Vec();
+   const unsigned int n = x0.size();
+   std::vector<std::vector<double>> columns(n, std::vector<double>(n));
+   std::vector<char> valid(n, 0);
+
+   auto computeColumn = [&](unsigned int i) {
+      double scale = std::fabs(x0(i));
+      if (st.Error().IsAvailable())
+         scale = std::max(scale, std::sqrt(std::fabs(st.Error().InvHessian()(i, i))));
+      if (scale == 0.)
+         scale = 1.;
+      const double dmin = 8. * prec.Eps2() * (std::fabs(x0(i)) + prec.Eps2());
+      const double d = std::max(std::cbrt(prec.Eps()) * scale, dmin);
+      MnAlgebraicVector x(x0);
+      x(i) = x0(i) + d;
+      const FunctionGradient gp = hc(MinimumParameters(x, 0.));
+      x(i) = x0(i) - d;
+      const FunctionGradient gm = hc(MinimumParameters(x, 0.));
+      bool ok = gp.IsValid() && gm.IsValid();
+      for (unsigned int j = 0; j < n && ok; j++) {
+         columns[i][j] = (gp.Vec()(j) - gm.Vec()(j)) / (2. * d);
+         ok = std::isfinite(columns[i][j]);
+      }
+      valid[i] = ok;
+   };
+
+#ifdef R__USE_IMT
+   if (parallel && ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(computeColumn, ROOT::TSeqU(n));
+   } else
+#else
+   (void)parallel;
+#endif
+   {
+      for (unsigned int i = 0; i < n; i++)
+         computeColumn(i);
+   }
+
+   for (unsigned int i = 0; i < n; i++) {
+      if (!valid[i])
+         return false;
+      for (unsigned int j = 0; j <= i; j++)
+         hmat(i, j) = 0.5 * (columns[i][j] + columns[j][i]);
+   }
+   return true;
+}
+
+} // namespace
+
 MnUserParameterState
 MnHesse::operator()(const FCNBase &fcn, const MnUserParameterState &state, unsigned int maxcalls) const
 {
@@ -40,7 +108,7 @@ MnHesse::operator()(const FCNBase &fcn, const MnUserParameterState &state, unsig
    double amin = mfcn(x);
    MinimumParameters par(x, amin);
    // check if we can use analytical gradient
-   if (fcn.HasGradient()) {
+   if (fcn.HasGradient() && (fcn.HasHessian() || fStrategy.HessianFromGradient())) {
       // no need to compute gradient here
       MinimumState tmp = ComputeAnalytical(fcn, MinimumState(par, MinimumError(MnAlgebraicSymMatrix(n), 1.), FunctionGradient(n),
         state.Edm(), state.NFcn()), state.Trafo());
@@ -70,7 +138,8 @@ MinimumState MnHesse::operator()(const MnFcn &mfcn, const MinimumState &st, cons
    // check first if we have an analytical gradient
    if (st.Gradient().IsAnalytical()) {
       // check if we can compute analytical Hessian
-      if (mfcn.Fcn().HasGradient() && mfcn.Fcn().HasHessian()) {
+      // or compute it from the analytical gradient if requested
+      if (mfcn.Fcn().HasGradient() && (mfcn.Fcn().HasHessian() || fStrategy.HessianFromGradient())) {
          return ComputeAnalytical(mfcn.Fcn(), st, trafo);
       }
    }
@@ -93,7 +162,8 @@ MinimumState MnHesse::ComputeAnalytical(const FCNBase & fcn, const MinimumState
       hc = std::make_unique<AnalyticalGradientCalculator>(fcn,trafo);
    }
 
-   bool ret = hc->Hessian(st.Parameters(), vhmat);
+   bool ret = fcn.HasHessian() ? hc->Hessian(st.Parameters(), vhmat)
+                               : HessianFromGradient(*hc, st, prec, fStrategy.HessianParallel(), vhmat);
    if (!ret) {
       print.Error("Error computing analytical Hessian. MnHesse fails and will return a null matrix");
       return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnHesseFailed), st.Gradient(), st.Edm(),
@@ -298,6 +368,35 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
    // off-diagonal Elements
    // initial starting values
    bool doCentralFD = fStrategy.HessianCentralFDMixedDerivatives();
+#ifdef R__USE_IMT
+   if (n > 1 && fStrategy.HessianParallel() && ROOT::IsImplicitMTEnabled()) {
+      // each row of mixed derivatives is computed in its own copy of the point
+      // and writes only its own elements of the matrix
+      auto computeRow = [&](unsigned int i) {
+         MnAlgebraicVector xr = x;
+         for (unsigned int j = i + 1; j < n; j++) {
+            xr(i) = x(i) + dirin(i);
+            xr(j) = x(j) + dirin(j);
+            double fs1 = mfcn(xr);
+            if (!doCentralFD) {
+               vhmat(i, j) = (fs1 + amin - yy(i) - yy(j)) / (dirin(i) * dirin(j));
+            } else {
+               xr(i) = x(i) - dirin(i);
+               double fs3 = mfcn(xr);
+               xr(j) = x(j) - dirin(j);
+               double fs4 = mfcn(xr);
+               xr(i) = x(i) + dirin(i);
+               double fs2 = mfcn(xr);
+               vhmat(i, j) = (fs1 - fs2 - fs3 + fs4) / (4. * dirin(i) * dirin(j));
+            }
+            xr(i) = x(i);
+            xr(j) = x(j);
+         }
+      };
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(computeRow, ROOT::TSeqU(n - 1));
+   } else
+#endif
    if (n > 0) {
       MPIProcess mpiprocOffDiagonal(n * (n - 1) / 2, 0);
       unsigned int startParIndexOffDiagonal = mpiprocOffDiagonal.StartElementIndex();
@@ -13,13 +13,15 @@ namespace ROOT {
 
 namespace Minuit2 {
 
-MnStrategy::MnStrategy() : fHessCFDG2(0), fHessForcePosDef(1), fStoreLevel(1)
+MnStrategy::MnStrategy()
+   : fGradParallel(0), fHessCFDG2(0), fHessForcePosDef(1), fHessParallel(0), fHessFromGrad(0), fStoreLevel(1)
 {
    // default strategy
    SetMediumStrategy();
 }
 
-MnStrategy::MnStrategy(unsigned int stra) : fHessCFDG2(0), fHessForcePosDef(1), fStoreLevel(1)
+MnStrategy::MnStrategy(unsigned int stra)
+   : fGradParallel(0), fHessCFDG2(0), fHessForcePosDef(1), fHessParallel(0), fHessFromGrad(0), fStoreLevel(1)
 {
    // user defined strategy (0, 1, 2, >=3)
    if (stra == 0)
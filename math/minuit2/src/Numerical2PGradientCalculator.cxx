@@ -21,6 +21,14 @@
 #include <omp.h>
 #endif
 
+#ifdef USE_ROOT_ERROR
+#include "RConfigure.h" // R__USE_IMT
+#endif
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h" // IsImplicitMTEnabled
+#endif
+
 #include <cmath>
 #include <cassert>
 #include <iomanip>
@@ -97,35 +105,8 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
 
    print.Debug("Calculating gradient around function value", fcnmin, "\n\t at point", par.Vec());
 
-#ifndef _OPENMP
-
-   MPIProcess mpiproc(n, 0);
-
-   // for serial execution this can be outside the loop
-   MnAlgebraicVector x = par.Vec();
-
-   unsigned int startElementIndex = mpiproc.StartElementIndex();
-   unsigned int endElementIndex = mpiproc.EndElementIndex();
-
-   for (unsigned int i = startElementIndex; i < endElementIndex; i++) {
-
-#else
-
-   // parallelize this loop using OpenMP
-//#define N_PARALLEL_PAR 5
-#pragma omp parallel
-#pragma omp for
-   //#pragma omp for schedule (static, N_PARALLEL_PAR)
-
-   for (int i = 0; i < int(n); i++) {
-
-#endif
-
-#ifdef _OPENMP
-      // create in loop since each thread will use its own copy
-      MnAlgebraicVector x = par.Vec();
-#endif
-
+   // calculate the derivative in the internal parameter i, varying it in x
+   auto computeDerivative = [&](unsigned int i, MnAlgebraicVector &x, bool trace) {
       double xtf = x(i);
       double epspri = eps2 + std::fabs(grd(i) * eps2);
       double stepb4 = 0.;
@@ -169,36 +150,32 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
          grd(i) = 0.5 * (fs1 - fs2) / step;
          g2(i) = (fs1 + fs2 - 2. * fcnmin) / step / step;
 
+         if (trace) {
 #ifdef _OPENMP
 #pragma omp critical
 #endif
-         {
-#ifdef _OPENMP
-            // must create thread-local MnPrint instances when printing inside threads
-            MnPrint printtl("Numerical2PGradientCalculator[OpenMP]");
-#endif
-            if (i == 0 && j == 0) {
+            {
 #ifdef _OPENMP
-               printtl.Trace([&](std::ostream &os) {
+               // must create thread-local MnPrint instances when printing inside threads
+               MnPrint printtl("Numerical2PGradientCalculator[OpenMP]");
 #else
-               print.Trace([&](std::ostream &os) {
+               MnPrint &printtl = print;
 #endif
-                  os << std::setw(10) << "parameter" << std::setw(6) << "cycle" << std::setw(15) << "x" << std::setw(15)
-                     << "step" << std::setw(15) << "f1" << std::setw(15) << "f2" << std::setw(15) << "grd"
-                     << std::setw(15) << "g2" << std::endl;
+               if (i == 0 && j == 0) {
+                  printtl.Trace([&](std::ostream &os) {
+                     os << std::setw(10) << "parameter" << std::setw(6) << "cycle" << std::setw(15) << "x"
+                        << std::setw(15) << "step" << std::setw(15) << "f1" << std::setw(15) << "f2" << std::setw(15)
+                        << "grd" << std::setw(15) << "g2" << std::endl;
+                  });
+               }
+               printtl.Trace([&](std::ostream &os) {
+                  const int pr = os.precision(13);
+                  const int iext = Trafo().ExtOfInt(i);
+                  os << std::setw(10) << Trafo().Name(iext) << std::setw(5) << j << "  " << x(i) << " " << step << " "
+                     << fs1 << " " << fs2 << " " << grd(i) << " " << g2(i) << std::endl;
+                  os.precision(pr);
                });
             }
-#ifdef _OPENMP
-            printtl.Trace([&](std::ostream &os) {
-#else
-            print.Trace([&](std::ostream &os) {
-#endif
-               const int pr = os.precision(13);
-               const int iext = Trafo().ExtOfInt(i);
-               os << std::setw(10) << Trafo().Name(iext) << std::setw(5) << j << "  " << x(i) << " " << step << " "
-                  << fs1 << " " << fs2 << " " << grd(i) << " " << g2(i) << std::endl;
-               os.precision(pr);
-            });
          }
 
          if (std::fabs(grdb4 - grd(i)) / (std::fabs(grd(i)) + dfmin / step) < GradTolerance()) {
@@ -209,16 +186,54 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
             break;
          }
       }
+   };
+
+#ifndef _OPENMP
 
-      //     vgrd(i) = grd;
-      //     vgrd2(i) = g2;
-      //     vgstp(i) = gstep;
+   MPIProcess mpiproc(n, 0);
+
+   unsigned int startElementIndex = mpiproc.StartElementIndex();
+   unsigned int endElementIndex = mpiproc.EndElementIndex();
+
+#ifdef R__USE_IMT
+   if (Strategy().GradientParallel() && ROOT::IsImplicitMTEnabled()) {
+      // each parameter is varied in its own copy of the point, and writes
+      // only its own elements of the gradient vectors
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](unsigned int i) {
+            MnAlgebraicVector x = par.Vec();
+            computeDerivative(i, x, false);
+         },
+         ROOT::TSeqU(startElementIndex, endElementIndex));
+   } else
+#endif
+   {
+      // for serial execution this can be outside the loop
+      MnAlgebraicVector x = par.Vec();
+      for (unsigned int i = startElementIndex; i < endElementIndex; i++) {
+         computeDerivative(i, x, true);
+      }
    }
 
-#ifndef _OPENMP
    mpiproc.SyncVector(grd);
    mpiproc.SyncVector(g2);
    mpiproc.SyncVector(gstep);
+
+#else
+
+   // parallelize this loop using OpenMP
+//#define N_PARALLEL_PAR 5
+#pragma omp parallel
+#pragma omp for
+   //#pragma omp for schedule (static, N_PARALLEL_PAR)
+
+   for (int i = 0; i < int(n); i++) {
+      // create in loop since each thread will use its own copy
+      MnAlgebraicVector x = par.Vec();
+      computeDerivative(i, x, true);
+   }
+
 #endif
 
    // print after parallel processing to avoid synchronization issues
@@ -1621,6 +1621,16 @@ RVec<T> operator OP(const RVec<T> &v)                                          \
    for (auto &x : ret)                                                         \
       x = OP x;                                                                \
 return ret;                                                                    \
+}                                                                              \
+                                                                               \
+template <typename T>                                                          \
+RVec<T> operator OP(RVec<T> &&v)                                               \
+{                                                                              \
+   if (ROOT::Detail::VecOps::IsAdopting(v))                                    \
+      return OP static_cast<const RVec<T> &>(v);                               \
+   for (auto &x : v)                                                           \
+      x = OP x;                                                                \
+   return std::move(v);                                                        \
 }                                                                              \
 
 RVEC_UNARY_OPERATOR(+)
@@ -1636,6 +1646,10 @@ RVEC_UNARY_OPERATOR(!)
 #define ERROR_MESSAGE(OP) \
  "Cannot call operator " #OP " on vectors of different sizes."
 
+// The overloads taking temporary RVecs compute the result in place when it has the element type of the temporary,
+// so that chained expressions like `a * b + c * d` allocate one RVec per independent sub-expression rather than one
+// per operator. Temporaries that adopt the memory of someone else are never modified.
+
 #define RVEC_BINARY_OPERATOR(OP)                                               \
 template <typename T0, typename T1>                                            \
 auto operator OP(const RVec<T0> &v, const T1 &y)                               \
@@ -1669,6 +1683,73 @@ auto operator OP(const RVec<T0> &v0, const RVec<T1> &v1)                       \
    std::transform(v0.begin(), v0.end(), v1.begin(), ret.begin(), op);          \
    return ret;                                                                 \
 }                                                                              \
+                                                                               \
+template <typename T0, typename T1,                                             \
+          typename = std::enable_if_t<!ROOT::Internal::VecOps::IsRVec<T1>::value>, \
+          typename R = decltype(std::declval<T0>() OP std::declval<T1>()),     \
+          typename = std::enable_if_t<std::is_same<R, T0>::value>>             \
+RVec<T0> operator OP(RVec<T0> &&v, const T1 &y)                                \
+{                                                                              \
+   if (ROOT::Detail::VecOps::IsAdopting(v))                                    \
+      return static_cast<const RVec<T0> &>(v) OP y;                            \
+   for (auto &x : v)                                                           \
+      x = x OP y;                                                              \
+   return std::move(v);                                                        \
+}                                                                              \
+                                                                               \
+template <typename T0, typename T1,                                             \
+          typename = std::enable_if_t<!ROOT::Internal::VecOps::IsRVec<T0>::value>, \
+          typename R = decltype(std::declval<T0>() OP std::declval<T1>()),     \
+          typename = std::enable_if_t<std::is_same<R, T1>::value>>             \
+RVec<T1> operator OP(const T0 &x, RVec<T1> &&v)                                \
+{                                                                              \
+   if (ROOT::Detail::VecOps::IsAdopting(v))                                    \
+      return x OP static_cast<const RVec<T1> &>(v);                            \
+   for (auto &y : v)                                                           \
+      y = x OP y;                                                              \
+   return std::move(v);                                                        \
+}                                                                              \
+                                                                               \
+template <typename T0, typename T1,                                             \
+          typename R = decltype(std::declval<T0>() OP std::declval<T1>()),     \
+          typename = std::enable_if_t<std::is_same<R, T0>::value>>             \
+RVec<T0> operator OP(RVec<T0> &&v0, const RVec<T1> &v1)                        \
+{                                                                              \
+   if (ROOT::Detail::VecOps::IsAdopting(v0))                                   \
+      return static_cast<const RVec<T0> &>(v0) OP v1;                          \
+   if (v0.size() != v1.size())                                                 \
+      throw std::runtime_error(ERROR_MESSAGE(OP));                             \
+                                                                               \
+   auto op = [](const T0 &x, const T1 &y) { return x OP y; };                  \
+   std::transform(v0.begin(), v0.end(), v1.begin(), v0.begin(), op);           \
+   return std::move(v0);                                                       \
+}                                                                              \
+                                                                               \
+template <typename T0, typename T1,                                             \
+          typename R = decltype(std::declval<T0>() OP std::declval<T1>()),     \
+          typename = std::enable_if_t<std::is_same<R, T1>::value>>             \
+RVec<T1> operator OP(const RVec<T0> &v0, RVec<T1> &&v1)                        \
+{                                                                              \
+   if (ROOT::Detail::VecOps::IsAdopting(v1))                                   \
+      return v0 OP static_cast<const RVec<T1> &>(v1);                          \
+   if (v0.size() != v1.size())                                                 \
+      throw std::runtime_error(ERROR_MESSAGE(OP));                             \
+                                                                               \
+   auto op = [](const T0 &x, const T1 &y) { return x OP y; };                  \
+   std::transform(v0.begin(), v0.end(), v1.begin(), v1.begin(), op);           \
+   return std::move(v1);                                                       \
+}                                                                              \
+                                                                               \
+template <typename T0, typename T1,                                             \
+          typename R = decltype(std::declval<T0>() OP std::declval<T1>()),     \
+          typename = std::enable_if_t<std::is_same<R, T0>::value || std::is_same<R, T1>::value>> \
+RVec<R> operator OP(RVec<T0> &&v0, RVec<T1> &&v1)                              \
+{                                                                              \
+   if constexpr (std::is_same<R, T0>::value)                                   \
+      return std::move(v0) OP static_cast<const RVec<T1> &>(v1);               \
+   else                                                                        \
+      return static_cast<const RVec<T0> &>(v0) OP std::move(v1);               \
+}                                                                              \
 
 RVEC_BINARY_OPERATOR(+)
 RVEC_BINARY_OPERATOR(-)
@@ -1793,6 +1874,16 @@ using PromoteTypes = decltype(PromoteType<U>() + PromoteType<V>());
       auto f = [](const T &x) { return FUNC(x); };                             \
       std::transform(v.begin(), v.end(), ret.begin(), f);                      \
       return ret;                                                              \
+   }                                                                           \
+                                                                               \
+   template <typename T, typename = std::enable_if_t<std::is_same<PromoteType<T>, T>::value>> \
+   RVec<T> NAME(RVec<T> &&v)                                                   \
+   {                                                                           \
+      if (ROOT::Detail::VecOps::IsAdopting(v))                                 \
+         return NAME(static_cast<const RVec<T> &>(v));                         \
+      for (auto &x : v)                                                        \
+         x = FUNC(x);                                                          \
+      return std::move(v);                                                     \
    }
 
 #define RVEC_BINARY_FUNCTION(NAME, FUNC)                                       \
@@ -2988,8 +3079,17 @@ RVec<Common_t> DeltaPhi(T0 v1, const RVec<T1>& v2, const Common_t c = M_PI)
 template <typename T0, typename T1 = T0, typename T2 = T0, typename T3 = T0, typename Common_t = std::common_type_t<T0, T1, T2, T3>>
 RVec<Common_t> DeltaR2(const RVec<T0>& eta1, const RVec<T1>& eta2, const RVec<T2>& phi1, const RVec<T3>& phi2, const Common_t c = M_PI)
 {
-   const auto dphi = DeltaPhi(phi1, phi2, c);
-   return (eta1 - eta2) * (eta1 - eta2) + dphi * dphi;
+   using size_type = typename RVec<T0>::size_type;
+   const size_type size = eta1.size();
+   if (eta2.size() != size || phi1.size() != size || phi2.size() != size)
+      throw std::runtime_error("Cannot call DeltaR2 on vectors of different sizes.");
+   RVec<Common_t> r(size);
+   for (size_type i = 0; i < size; i++) {
+      const Common_t deta = eta1[i] - eta2[i];
+      const Common_t dphi = DeltaPhi(phi1[i], phi2[i], c);
+      r[i] = deta * deta + dphi * dphi;
+   }
+   return r;
 }
 
 /// Return the distance on the \f$\eta\f$-\f$\phi\f$ plane (\f$\Delta R\f$) from
@@ -3082,16 +3182,23 @@ Common_t InvariantMasses_PxPyPzM(
       const auto r1 = m1_sq / p1_sq;
       const auto r2 = m2_sq / p2_sq;
       const auto x = r1 + r2 + r1 * r2;
-      const auto a = Angle(x1, y1, z1, x2, y2, z2);
-      const auto cos_a = std::cos(a);
+
+      // Cosine and sine of the angle between the momenta from their dot and cross products,
+      // which avoids computing the angle itself with atan2 and then its cosine and sine
+      const auto p1p2 = std::sqrt(p1_sq * p2_sq);
+      const auto cx = y1 * z2 - y2 * z1;
+      const auto cy = x1 * z2 - x2 * z1;
+      const auto cz = x1 * y2 - x2 * y1;
+      const auto cos_a = (x1 * x2 + y1 * y2 + z1 * z2) / p1p2;
+      const auto sin_a_sq = (cx * cx + cy * cy + cz * cz) / (p1_sq * p2_sq);
       auto y = x;
       if ( cos_a >= 0){
-         y = (x + std::sin(a) * std::sin(a)) / (std::sqrt(x + 1) + cos_a);
+         y = (x + sin_a_sq) / (std::sqrt(x + 1) + cos_a);
       } else {
          y = std::sqrt(x + 1) - cos_a;
       }
 
-      const auto z = 2 * std::sqrt(p1_sq * p2_sq);
+      const auto z = 2 * p1p2;
 
    // Return invariant mass with (+, -, -, -) metric
    return std::sqrt(m1_sq + m2_sq + y * z);
@@ -239,6 +239,32 @@ TEST(VecOps, MathScalarInPlace)
    CheckEqual(div, ref / scalar);
 }
 
+TEST(VecOps, MathTemporaries)
+{
+   // Large enough not to be stored in the small buffer, whose content is copied by a move
+   RVec<double> v(100, 2.);
+   RVec<double> w(100, 3.);
+
+   auto tmp = v + 1.;
+   const auto *buffer = tmp.data();
+   auto chained = 2. * (std::move(tmp) * w - 1.) + w;
+   EXPECT_EQ(chained.data(), buffer);
+   CheckEqual(chained, RVec<double>(100, 19.));
+
+   auto both = (v + w) * (v - w);
+   CheckEqual(both, RVec<double>(100, -5.));
+   auto mixed = (RVec<int>(100, 1) + 1) * (w + 1.);
+   CheckEqual(mixed, RVec<double>(100, 8.));
+   auto func = 1. - sqrt(v * v);
+   CheckEqual(func, RVec<double>(100, -1.));
+
+   // Views on memory owned by someone else are not modified
+   double data[]{1., 2., 3.};
+   auto fromView = RVec<double>(data, 3) * 2.;
+   CheckEqual(fromView, RVec<double>{2., 4., 6.});
+   EXPECT_EQ(data[0], 1.);
+}
+
 TEST(VecOps, MathVector)
 {
    RVec<double> ref{1, 2, 3};
@@ -28,7 +28,9 @@ struct RDavixFileDes;
 
 The RRawFileDavix class provides read-only access to remote non-ROOT files.  It uses the Davix library for
 the transport layer.  It instructs the RRawFile base class to buffer in larger chunks than the default for
-local files, assuming that remote file access has high(er) latency.
+local files, assuming that remote file access has high(er) latency.  S3 buckets (s3:// and s3s:// URLs or https://
+URLs of an S3 endpoint) are accessed with the credentials given by the same Davix.S3.* rootrc variables and S3_*
+environment variables as for TDavixFile.
 
 */
 
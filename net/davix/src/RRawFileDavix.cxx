@@ -11,8 +11,11 @@
 
 #include "ROOT/RRawFileDavix.hxx"
 
+#include <TEnv.h>
 #include <TError.h>
 
+#include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <stdexcept>
 #include <vector>
@@ -22,13 +25,30 @@
 
 namespace {
 constexpr int kDefaultBlockSize = 128 * 1024; // Read in relatively large 128k blocks for better network utilization
+
+/// Use the same S3 credentials as TDavixFile, so that RNTuple and TFile can read from the same buckets
+void ConfigureS3(Davix::RequestParams &params)
+{
+   const char *secretKey = gEnv->GetValue("Davix.S3.SecretKey", getenv("S3_SECRET_KEY"));
+   const char *accessKey = gEnv->GetValue("Davix.S3.AccessKey", getenv("S3_ACCESS_KEY"));
+   if (!secretKey || !accessKey)
+      return;
+   params.setAwsAuthorizationKeys(secretKey, accessKey);
+   if (const char *region = gEnv->GetValue("Davix.S3.Region", getenv("S3_REGION")))
+      params.setAwsRegion(region);
+   if (const char *token = gEnv->GetValue("Davix.S3.Token", getenv("S3_TOKEN")))
+      params.setAwsToken(token);
+   if (const char *alternate = gEnv->GetValue("Davix.S3.Alternate", getenv("S3_ALTERNATE")))
+      params.setAwsAlternate(strcmp(alternate, "y") == 0 || strcmp(alternate, "yes") == 0 ||
+                             strcmp(alternate, "1") == 0 || strcmp(alternate, "true") == 0);
+}
 } // anonymous namespace
 
 namespace ROOT {
 namespace Internal {
 
 struct RDavixFileDes {
-   RDavixFileDes() : fd(nullptr), pos(&ctx) {}
+   RDavixFileDes() : fd(nullptr), pos(&ctx) { ConfigureS3(params); }
    RDavixFileDes(const RDavixFileDes &) = delete;
    RDavixFileDes &operator=(const RDavixFileDes &) = delete;
    ~RDavixFileDes() = default;
@@ -36,6 +56,7 @@ struct RDavixFileDes {
    DAVIX_FD *fd;
    Davix::Context ctx;
    Davix::DavPosix pos;
+   Davix::RequestParams params;
 };
 
 } // namespace Internal
@@ -62,7 +83,7 @@ std::uint64_t ROOT::Internal::RRawFileDavix::GetSizeImpl()
 {
    struct stat buf;
    Davix::DavixError *err = nullptr;
-   if (fFileDes->pos.stat(nullptr, fUrl, &buf, &err) == -1) {
+   if (fFileDes->pos.stat(&fFileDes->params, fUrl, &buf, &err) == -1) {
       throw std::runtime_error("Cannot determine size of '" + fUrl + "', error: " + err->getErrMsg());
    }
    return buf.st_size;
@@ -71,7 +92,7 @@ std::uint64_t ROOT::Internal::RRawFileDavix::GetSizeImpl()
 void ROOT::Internal::RRawFileDavix::OpenImpl()
 {
    Davix::DavixError *err = nullptr;
-   fFileDes->fd = fFileDes->pos.open(nullptr, fUrl, O_RDONLY, &err);
+   fFileDes->fd = fFileDes->pos.open(&fFileDes->params, fUrl, O_RDONLY, &err);
    if (fFileDes->fd == nullptr) {
       throw std::runtime_error("Cannot open '" + fUrl + "', error: " + err->getErrMsg());
    }
@@ -50,6 +50,7 @@
 #include <sstream>
 #include <string>
 #include <cstring>
+#include <vector>
 
 
 static const std::string VERSION = "0.2.0";
@@ -967,28 +968,77 @@ Long64_t TDavixFile::DavixPReadBuffer(Davix_fd *fd, char *buf, Long64_t pos, Int
 }
 
 ////////////////////////////////////////////////////////////////////////////////
+/// Read nbuf buffers of the given positions and lengths into buf, one after the other.
+/// Consecutive buffers that are at most Davix.ReadBuffers.MaxGap bytes apart in the file (64 KiB by default) are
+/// read with a single range, up to Davix.ReadBuffers.MaxRangeSize bytes (16 MiB by default). Many HTTP servers and
+/// object stores reject requests with many ranges, in which case davix falls back to one GET per range: fewer,
+/// larger ranges make this fallback much cheaper. The bytes of the gaps are read into a scratch buffer.
 
 Long64_t TDavixFile::DavixReadBuffers(Davix_fd *fd, char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
 {
    DavixError *davixErr = NULL;
    Double_t start_time = eventStart();
-   DavIOVecInput in[nbuf];
-   DavIOVecOuput out[nbuf];
 
-   int lastPos = 0;
+   static const Long64_t maxGap = gEnv ? gEnv->GetValue("Davix.ReadBuffers.MaxGap", 64 * 1024) : 64 * 1024;
+   static const Long64_t maxRangeSize =
+      gEnv ? gEnv->GetValue("Davix.ReadBuffers.MaxRangeSize", 16 * 1024 * 1024) : 16 * 1024 * 1024;
+
+   // A range covering the buffers [fFirst, fLast], read into the caller's buffer if the buffers are
+   // contiguous in the file or into the scratch buffer at fScratchOffset otherwise
+   struct RRange {
+      Int_t fFirst;
+      Int_t fLast;
+      Long64_t fScratchOffset;
+   };
+   std::vector<RRange> ranges;
+   std::vector<Long64_t> bufOffsets(nbuf);
+
+   Long64_t scratchSize = 0;
+   Long64_t lastPos = 0;
    for (Int_t i = 0; i < nbuf; ++i) {
-      in[i].diov_buffer = &buf[lastPos];
-      in[i].diov_offset = pos[i];
-      in[i].diov_size = len[i];
+      bufOffsets[i] = lastPos;
       lastPos += len[i];
+      if (!ranges.empty()) {
+         auto &range = ranges.back();
+         const Long64_t rangeEnd = pos[range.fLast] + len[range.fLast];
+         const Long64_t gap = pos[i] - rangeEnd;
+         if (gap >= 0 && gap <= maxGap && pos[i] + len[i] - pos[range.fFirst] <= maxRangeSize) {
+            if (gap > 0 && range.fScratchOffset < 0) {
+               range.fScratchOffset = scratchSize;
+               scratchSize += rangeEnd - pos[range.fFirst];
+            }
+            if (range.fScratchOffset >= 0)
+               scratchSize += pos[i] + len[i] - rangeEnd;
+            range.fLast = i;
+            continue;
+         }
+      }
+      ranges.push_back({i, i, -1});
+   }
+
+   std::vector<char> scratch(scratchSize);
+   std::vector<DavIOVecInput> in(ranges.size());
+   std::vector<DavIOVecOuput> out(ranges.size());
+   for (std::size_t r = 0; r < ranges.size(); ++r) {
+      const auto &range = ranges[r];
+      in[r].diov_offset = pos[range.fFirst];
+      in[r].diov_size = pos[range.fLast] + len[range.fLast] - pos[range.fFirst];
+      in[r].diov_buffer =
+         (range.fScratchOffset >= 0) ? &scratch[range.fScratchOffset] : &buf[bufOffsets[range.fFirst]];
    }
 
-   Long64_t ret = d_ptr->davixPosix->preadVec(fd, in, out, nbuf, &davixErr);
+   Long64_t ret = d_ptr->davixPosix->preadVec(fd, in.data(), out.data(), in.size(), &davixErr);
    if (ret < 0) {
       Error("DavixReadBuffers", "can not read data with davix: %s (%d)",
             davixErr->getErrMsg().c_str(), davixErr->getStatus());
       DavixError::clearError(&davixErr);
    } else {
+      for (const auto &range : ranges) {
+         if (range.fScratchOffset < 0)
+            continue;
+         for (Int_t i = range.fFirst; i <= range.fLast; ++i)
+            memcpy(&buf[bufOffsets[i]], &scratch[range.fScratchOffset + pos[i] - pos[range.fFirst]], len[i]);
+      }
       eventStop(start_time, ret);
    }
 
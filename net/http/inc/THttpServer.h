@@ -20,7 +20,7 @@
 #include <map>
 #include <string>
 #include <memory>
-#include <queue>
+#include <deque>
 #include <thread>
 #include <vector>
 
@@ -55,7 +55,7 @@ protected:
    std::string fCorsCredentials; ///<! CORS: add Access-Control-Allow-Credentials: true response header
 
    std::mutex fMutex;                                        ///<! mutex to protect list with arguments
-   std::queue<std::shared_ptr<THttpCallArg>> fArgs;          ///<! submitted arguments
+   std::deque<std::shared_ptr<THttpCallArg>> fArgs;          ///<! submitted arguments
 
    std::mutex fWSMutex;                                      ///<! mutex to protect WS handler lists
    std::vector<std::shared_ptr<THttpWSHandler>> fWSHandlers; ///<! list of WS handlers
@@ -74,6 +74,14 @@ protected:
 
    static Bool_t VerifyFilePath(const char *fname);
 
+   static Bool_t IsSharedReplyRequest(const THttpCallArg &arg);
+
+   static Bool_t IsSameRequest(const THttpCallArg &arg1, const THttpCallArg &arg2);
+
+   static void CopyReply(const THttpCallArg &src, THttpCallArg &dest);
+
+   static void CheckNotModified(THttpCallArg &arg);
+
    THttpServer(const THttpServer &) = delete;
    THttpServer &operator=(const THttpServer &) = delete;
 
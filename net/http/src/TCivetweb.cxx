@@ -405,7 +405,7 @@ static int begin_request_handler(struct mg_connection *conn, void *)
       }
    }
 
-   if (!execres || arg->Is404()) {
+   if (!execres || arg->Is404() || arg->Is304()) {
       std::string hdr = arg->FillHttpHeader("HTTP/1.1");
       mg_printf(conn, "%s", hdr.c_str());
    } else if (arg->IsFile()) {
@@ -153,7 +153,7 @@ void process_request(TFastCgi *engine, FCGX_Request *request, bool can_postpone)
       return;
    }
 
-   if (!engine->GetServer()->ExecuteHttp(arg) || arg->Is404()) {
+   if (!engine->GetServer()->ExecuteHttp(arg) || arg->Is404() || arg->Is304()) {
       std::string hdr = arg->FillHttpHeader("Status:");
       FCGX_FPrintF(request->out, hdr.c_str());
    } else if (arg->IsFile()) {
@@ -31,6 +31,7 @@
 #include "TCivetweb.h"
 #include "TFastCgi.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
 #include <cstring>
@@ -38,6 +39,7 @@
 #include <memory>
 #include <string>
 #include <thread>
+#include <vector>
 
 class THttpTimer : public TTimer {
    Long_t fNormalTmout{0};
@@ -646,6 +648,7 @@ Bool_t THttpServer::ExecuteHttp(std::shared_ptr<THttpCallArg> arg)
       // should not happen, but one could process requests directly without any signaling
 
       ProcessRequest(arg);
+      CheckNotModified(*arg);
 
       return kTRUE;
    }
@@ -655,7 +658,7 @@ Bool_t THttpServer::ExecuteHttp(std::shared_ptr<THttpCallArg> arg)
 
    // add call arg to the list
    std::unique_lock<std::mutex> lk(fMutex);
-   fArgs.push(arg);
+   fArgs.push_back(arg);
    // and now wait until request is processed
    arg->fCond.wait(lk);
 
@@ -683,13 +686,14 @@ Bool_t THttpServer::SubmitHttp(std::shared_ptr<THttpCallArg> arg, Bool_t can_run
 
    if (can_run_immediately && (fMainThrdId != 0) && (fMainThrdId == TThread::SelfId())) {
       ProcessRequest(arg);
+      CheckNotModified(*arg);
       arg->NotifyCondition();
       return kTRUE;
    }
 
    // add call arg to the list
    std::unique_lock<std::mutex> lk(fMutex);
-   fArgs.push(arg);
+   fArgs.push_back(arg);
    return kFALSE;
 }
 
@@ -734,11 +738,24 @@ Int_t THttpServer::ProcessRequests()
    // first process requests in the queue
    while (true) {
       std::shared_ptr<THttpCallArg> arg;
+      std::vector<std::shared_ptr<THttpCallArg>> sameArgs;
 
       lk.lock();
       if (!fArgs.empty()) {
          arg = fArgs.front();
-         fArgs.pop();
+         fArgs.pop_front();
+         // identical read-only requests of many clients, e.g. monitoring pages polling the same objects,
+         // are processed once and all get the same reply
+         if (IsSharedReplyRequest(*arg)) {
+            for (auto iter = fArgs.begin(); iter != fArgs.end();) {
+               if (IsSameRequest(*arg, **iter)) {
+                  sameArgs.emplace_back(*iter);
+                  iter = fArgs.erase(iter);
+               } else {
+                  ++iter;
+               }
+            }
+         }
       }
       lk.unlock();
 
@@ -760,7 +777,17 @@ Int_t THttpServer::ProcessRequests()
          fSniffer->SetCurrentCallArg(prev);
       }
 
+      // the reply is copied before being replaced by 304, which depends on the header of each request
+      for (auto &sameArg : sameArgs)
+         CopyReply(*arg, *sameArg);
+
+      CheckNotModified(*arg);
       arg->NotifyCondition();
+
+      for (auto &sameArg : sameArgs) {
+         CheckNotModified(*sameArg);
+         sameArg->NotifyCondition();
+      }
    }
 
    // regularly call Process() method of engine to let perform actions in ROOT context
@@ -777,6 +804,65 @@ Int_t THttpServer::ProcessRequests()
    return cnt;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Returns true for the GET requests that only read the objects of the sniffer, and whose reply does not depend
+/// on the client, so that one reply can be shared by all the clients issuing the same request
+
+Bool_t THttpServer::IsSharedReplyRequest(const THttpCallArg &arg)
+{
+   static const std::vector<std::string> readOnlyFiles = {"h.json",    "h.xml",     "get.xml",   "root.json",
+                                                          "root.bin",  "root.xml",  "root.png",  "root.gif",
+                                                          "root.jpeg", "item.json", "item.xml"};
+
+   if ((arg.fWSId != 0) || !arg.fPostData.empty() || (!arg.fMethod.IsNull() && (arg.fMethod != "GET")))
+      return kFALSE;
+
+   return std::find(readOnlyFiles.begin(), readOnlyFiles.end(), arg.fFileName.Data()) != readOnlyFiles.end();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns true if both requests are the same and come from the same kind of engine
+
+Bool_t THttpServer::IsSameRequest(const THttpCallArg &arg1, const THttpCallArg &arg2)
+{
+   return (arg1.IsA() == arg2.IsA()) && (arg1.fWSId == arg2.fWSId) && arg2.fPostData.empty() &&
+          (arg1.fMethod == arg2.fMethod) && (arg1.fTopName == arg2.fTopName) && (arg1.fPathName == arg2.fPathName) &&
+          (arg1.fFileName == arg2.fFileName) && (arg1.fQuery == arg2.fQuery) && (arg1.fUserName == arg2.fUserName);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Replace the reply by 304 if the client already has the content, which it signals with the ETag of the
+/// reply in the "If-None-Match" request header. Unchanged objects are then not transferred again when monitored.
+
+void THttpServer::CheckNotModified(THttpCallArg &arg)
+{
+   if (arg.Is404() || arg.IsPostponed() || !IsSharedReplyRequest(arg))
+      return;
+
+   TString etag = arg.AccessHeader(arg.fHeader, "ETag");
+   if (etag.IsNull())
+      return;
+
+   TString match = arg.GetRequestHeader("If-None-Match");
+   if (match.IsNull())
+      match = arg.GetRequestHeader("HTTP_IF_NONE_MATCH"); // FastCGI provides headers as environment variables
+
+   if ((match == "*") || (!match.IsNull() && (match.Index(etag) != kNPOS)))
+      arg.Set304();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy the reply of a processed request into another one, which is the same request.
+/// Compression is applied afterwards by the engines, according to the header of each request.
+
+void THttpServer::CopyReply(const THttpCallArg &src, THttpCallArg &dest)
+{
+   dest.fContentType = src.fContentType;
+   dest.fHeader = src.fHeader;
+   dest.fZipping = src.fZipping;
+   dest.fContent = src.fContent;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Method called when THttpServer cannot process request
 ///
@@ -1220,8 +1306,15 @@ void THttpServer::ProcessRequest(std::shared_ptr<THttpCallArg> arg)
       arg->AddHeader(parname, TString::Format("%u", (unsigned)fSniffer->GetStreamerInfoHash()).Data());
    }
 
-   // try to avoid caching on the browser
-   arg->AddNoCacheHeader();
+   if (IsSharedReplyRequest(*arg)) {
+      // identify the content, so that the browser revalidates it instead of downloading it again when unchanged
+      UInt_t hash = TString::Hash(arg->GetContent(), arg->GetContentLength());
+      arg->AddHeader("ETag", TString::Format("\"%08x%08x\"", hash, arg->fHeader.Hash()).Data());
+      arg->AddHeader("Cache-Control", "private, no-cache");
+   } else {
+      // try to avoid caching on the browser
+      arg->AddNoCacheHeader();
+   }
 
    // potentially add cors headers
    if (IsCors())
@@ -1311,7 +1404,7 @@ Bool_t THttpServer::ExecuteWS(std::shared_ptr<THttpCallArg> &arg, Bool_t externa
          fTimer->SetSlow(kFALSE);
 
       std::unique_lock<std::mutex> lk(fMutex);
-      fArgs.push(arg);
+      fArgs.push_back(arg);
       // and now wait until request is processed
       if (wait_process)
          arg->fCond.wait(lk);
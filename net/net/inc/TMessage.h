@@ -47,6 +47,9 @@ private:
    char    *fBufComp{nullptr};    // Compressed buffer
    char    *fBufCompCur{nullptr}; // Current position in compressed buffer
    char    *fCompPos{nullptr};    // Position of fBufCur when message was compressed
+   Int_t    fBufCompSize{0};      // Allocated size of fBufComp
+   char    *fBufCompSpare{nullptr}; // Released compressed buffer, reused by the next compression
+   Int_t    fBufCompSpareSize{0}; // Allocated size of fBufCompSpare
    Bool_t   fEvolution{kFALSE};   // True if support for schema evolution required
 
    static Bool_t fgEvolution;  //True if global support for schema evolution required
@@ -61,6 +64,7 @@ private:
 protected:
    TMessage(void *buf, Int_t bufsize);   // only called by T(P)Socket::Recv()
    void SetLength() const;               // only called by T(P)Socket::Send()
+   void ReleaseCompBuffer();
 
 public:
    TMessage(UInt_t what = kMESS_ANY, Int_t bufsiz = TBuffer::kInitialSize);
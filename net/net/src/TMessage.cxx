@@ -84,8 +84,9 @@ TMessage::TMessage(void *buf, Int_t bufsize) : TBufferFile(TBuffer::kRead, bufsi
 
    if (fWhat & kMESS_ZIP) {
       // if buffer has kMESS_ZIP set, move it to fBufComp and uncompress
-      fBufComp    = fBuffer;
-      fBufCompCur = fBuffer + bufsize;
+      fBufComp     = fBuffer;
+      fBufCompCur  = fBuffer + bufsize;
+      fBufCompSize = bufsize;
       fBuffer     = nullptr;
       Uncompress();
    }
@@ -106,6 +107,7 @@ TMessage::TMessage(void *buf, Int_t bufsize) : TBufferFile(TBuffer::kRead, bufsi
 TMessage::~TMessage()
 {
    delete [] fBufComp;
+   delete [] fBufCompSpare;
    delete fInfos;
 }
 
@@ -181,12 +183,7 @@ void TMessage::Reset()
    SetBufferOffset(sizeof(UInt_t) + sizeof(fWhat));
    ResetMap();
 
-   if (fBufComp) {
-      delete [] fBufComp;
-      fBufComp    = nullptr;
-      fBufCompCur = nullptr;
-      fCompPos    = nullptr;
-   }
+   ReleaseCompBuffer();
 
    if (fgEvolution || fEvolution) {
       if (fInfos)
@@ -195,6 +192,29 @@ void TMessage::Reset()
    fBitsPIDs.ResetAllBits();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Mark the message as not compressed. The largest compressed buffer is kept,
+/// so that a message which is filled and sent repeatedly does not allocate a
+/// new compressed buffer for every Send().
+
+void TMessage::ReleaseCompBuffer()
+{
+   if (!fBufComp)
+      return;
+
+   if (fBufCompSize > fBufCompSpareSize) {
+      delete [] fBufCompSpare;
+      fBufCompSpare     = fBufComp;
+      fBufCompSpareSize = fBufCompSize;
+   } else {
+      delete [] fBufComp;
+   }
+   fBufComp     = nullptr;
+   fBufCompCur  = nullptr;
+   fCompPos     = nullptr;
+   fBufCompSize = 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the message length at the beginning of the message buffer.
 /// This method is only called by TSocket::Send().
@@ -249,12 +269,8 @@ void TMessage::SetCompressionAlgorithm(Int_t algorithm)
       int level = fCompress % 100;
       newCompress = 100 * algorithm + level;
    }
-   if (newCompress != fCompress && fBufComp) {
-      delete [] fBufComp;
-      fBufComp    = nullptr;
-      fBufCompCur = nullptr;
-      fCompPos    = nullptr;
-   }
+   if (newCompress != fCompress)
+      ReleaseCompBuffer();
    fCompress = newCompress;
 }
 
@@ -273,12 +289,8 @@ void TMessage::SetCompressionLevel(Int_t level)
       if (algorithm >= ROOT::RCompressionSetting::EAlgorithm::kUndefined) algorithm = 0;
       newCompress = 100 * algorithm + level;
    }
-   if (newCompress != fCompress && fBufComp) {
-      delete [] fBufComp;
-      fBufComp    = nullptr;
-      fBufCompCur = nullptr;
-      fCompPos    = nullptr;
-   }
+   if (newCompress != fCompress)
+      ReleaseCompBuffer();
    fCompress = newCompress;
 }
 
@@ -287,12 +299,8 @@ void TMessage::SetCompressionLevel(Int_t level)
 
 void TMessage::SetCompressionSettings(Int_t settings)
 {
-   if (settings != fCompress && fBufComp) {
-      delete [] fBufComp;
-      fBufComp    = nullptr;
-      fBufCompCur = nullptr;
-      fCompPos    = nullptr;
-   }
+   if (settings != fCompress)
+      ReleaseCompBuffer();
    fCompress = settings;
 }
 
@@ -309,12 +317,7 @@ Int_t TMessage::Compress()
    Int_t compressionAlgorithm = GetCompressionAlgorithm();
    if (compressionLevel <= 0) {
       // no compression specified
-      if (fBufComp) {
-         delete [] fBufComp;
-         fBufComp    = nullptr;
-         fBufCompCur = nullptr;
-         fCompPos    = nullptr;
-      }
+      ReleaseCompBuffer();
       return 0;
    }
 
@@ -323,13 +326,8 @@ Int_t TMessage::Compress()
       return 0;
    }
 
-   // remove any existing compressed buffer before compressing modified message
-   if (fBufComp) {
-      delete [] fBufComp;
-      fBufComp    = nullptr;
-      fBufCompCur = nullptr;
-      fCompPos    = nullptr;
-   }
+   // release any existing compressed buffer before compressing modified message
+   ReleaseCompBuffer();
 
    if (Length() <= (Int_t)(256 + 2*sizeof(UInt_t))) {
       // this message is too small to be compressed
@@ -346,7 +344,16 @@ Int_t TMessage::Compress()
    Int_t nbuffers = 1 + (messlen - 1) / kMAXZIPBUF;
    Int_t chdrlen  = 3*sizeof(UInt_t);   // compressed buffer header length
    Int_t buflen   = std::max(512, chdrlen + messlen + 9*nbuffers);
-   fBufComp       = new char[buflen];
+   if (fBufCompSpare && fBufCompSpareSize >= buflen) {
+      // reuse the buffer of a previous compression, e.g. when the message is reset and filled again
+      fBufComp          = fBufCompSpare;
+      fBufCompSize      = fBufCompSpareSize;
+      fBufCompSpare     = nullptr;
+      fBufCompSpareSize = 0;
+   } else {
+      fBufComp     = new char[buflen];
+      fBufCompSize = buflen;
+   }
    char *messbuf  = Buffer() + hdrlen;
    char *bufcur   = fBufComp + chdrlen;
    Int_t nzip     = 0;
@@ -360,10 +367,7 @@ Int_t TMessage::Compress()
                               static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(compressionAlgorithm));
       if (nout == 0 || nout >= messlen) {
          //this happens when the buffer cannot be compressed
-         delete [] fBufComp;
-         fBufComp    = nullptr;
-         fBufCompCur = nullptr;
-         fCompPos    = nullptr;
+         ReleaseCompBuffer();
          return -1;
       }
       bufcur  += nout;
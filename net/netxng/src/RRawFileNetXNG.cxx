@@ -13,8 +13,12 @@
 
 #include <TError.h>
 
+#include <algorithm>
 #include <cctype>
+#include <condition_variable>
+#include <cstddef>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -26,6 +30,52 @@
 
 namespace {
 constexpr int kDefaultBlockSize = 128 * 1024; // Read in relatively large 128k blocks for better network utilization
+
+/// Keeps track of the asynchronous vector reads issued by a single ReadVImpl call
+struct RVectorReadState {
+   std::mutex fMutex;
+   std::condition_variable fCvDone;
+   std::size_t fNPending = 0;
+   std::string fError; ///< Message of the first failed vector read, if any
+};
+
+/// Stores the number of bytes read by one vector read of a batch of requests into the request vector
+class RVectorReadHandler : public XrdCl::ResponseHandler {
+   RVectorReadState &fState;
+   ROOT::Internal::RRawFile::RIOVec *fIOVec;
+   std::size_t fNReq;
+
+public:
+   RVectorReadHandler(RVectorReadState &state, ROOT::Internal::RRawFile::RIOVec *ioVec, std::size_t nReq)
+      : fState(state), fIOVec(ioVec), fNReq(nReq)
+   {
+   }
+
+   void HandleResponse(XrdCl::XRootDStatus *status, XrdCl::AnyObject *response) final
+   {
+      XrdCl::VectorReadInfo *info = nullptr;
+      if (status->IsOK() && response)
+         response->Get(info);
+      {
+         std::lock_guard<std::mutex> lock(fState.fMutex);
+         if (!status->IsOK()) {
+            if (fState.fError.empty())
+               fState.fError = status->ToString() + "; " + status->GetErrorMessage();
+         } else if (info) {
+            const XrdCl::ChunkList &rsp = info->GetChunks();
+            for (std::size_t i = 0; i < std::min(fNReq, rsp.size()); ++i)
+               fIOVec[i].fOutBytes = rsp[i].length;
+         }
+         // Notify with the lock held: the state lives on the stack of the waiting thread
+         if (--fState.fNPending == 0)
+            fState.fCvDone.notify_one();
+      }
+      delete status;
+      delete response;
+      delete this;
+   }
+};
+
 } // anonymous namespace
 
 namespace ROOT {
@@ -91,23 +141,54 @@ size_t ROOT::Internal::RRawFileNetXNG::ReadAtImpl(void *buffer, size_t nbytes, s
    return btsread;
 }
 
+/// The requests are split into batches that respect the server's readv limits. All the batches are sent at once
+/// as asynchronous vector reads and are in flight concurrently, so that a long request vector costs about one round
+/// trip instead of one per batch.
 void ROOT::Internal::RRawFileNetXNG::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
 {
-   XrdCl::ChunkList chunks;
-   chunks.reserve( nReq );
-   for( std::size_t i = 0; i < nReq; ++i )
-     chunks.emplace_back( ioVec[i].fOffset, ioVec[i].fSize, ioVec[i].fBuffer );
+   const auto limits = GetReadVLimits();
 
-   XrdCl::VectorReadInfo *info = nullptr;
-   auto st = pImpl->file.VectorRead( chunks, nullptr, info );
-   if( !st.IsOK() )
-     throw std::runtime_error( "Cannot do vector read from '" + fUrl + "', " +
-                               st.ToString() + "; " + st.GetErrorMessage() );
+   RVectorReadState state;
+   std::string submitError;
+   std::size_t iReq = 0;
+   while (iReq < nReq) {
+      XrdCl::ChunkList chunks;
+      std::uint64_t totalSize = 0;
+      std::size_t nBatch = 0;
+      while ((iReq + nBatch < nReq) && (nBatch < limits.fMaxReqs)) {
+         const auto &req = ioVec[iReq + nBatch];
+         if (nBatch > 0 && totalSize + req.fSize > limits.fMaxTotalSize)
+            break;
+         chunks.emplace_back(req.fOffset, req.fSize, req.fBuffer);
+         totalSize += req.fSize;
+         ++nBatch;
+      }
+
+      {
+         std::lock_guard<std::mutex> lock(state.fMutex);
+         ++state.fNPending;
+      }
+      auto handler = new RVectorReadHandler(state, ioVec + iReq, nBatch);
+      auto st = pImpl->file.VectorRead(chunks, nullptr, handler);
+      if (!st.IsOK()) {
+         // The handler is only called for vector reads that could be sent
+         delete handler;
+         std::lock_guard<std::mutex> lock(state.fMutex);
+         --state.fNPending;
+         submitError = st.ToString() + "; " + st.GetErrorMessage();
+         break;
+      }
+      iReq += nBatch;
+   }
+
+   // Wait for the vector reads already in flight even on error, as they write into the request vector
+   std::unique_lock<std::mutex> lock(state.fMutex);
+   state.fCvDone.wait(lock, [&state] { return state.fNPending == 0; });
 
-   XrdCl::ChunkList &rsp = info->GetChunks();
-   for( std::size_t i = 0; i < nReq; ++i )
-     ioVec[i].fOutBytes = rsp[i].length;
-   delete info;
+   if (submitError.empty())
+      submitError = state.fError;
+   if (!submitError.empty())
+      throw std::runtime_error("Cannot do vector read from '" + fUrl + "', " + submitError);
 }
 
 ROOT::Internal::RRawFile::RIOVecLimits ROOT::Internal::RRawFileNetXNG::GetReadVLimits()
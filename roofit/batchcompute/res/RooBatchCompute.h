@@ -70,6 +70,7 @@ enum Computer {
    BMixDecay,
    Bernstein,
    BifurGauss,
+   BinnedPoissonNLL,
    BreitWigner,
    Bukin,
    CBShape,
@@ -180,6 +181,7 @@ public:
    virtual void cudaEventRecord(CudaInterface::CudaEvent *, CudaInterface::CudaStream *) const = 0;
    virtual void cudaStreamWaitForEvent(CudaInterface::CudaStream *, CudaInterface::CudaEvent *) const = 0;
    virtual bool cudaStreamIsActive(CudaInterface::CudaStream *) const = 0;
+   virtual void cudaStreamSynchronize(CudaInterface::CudaStream *) const = 0;
 };
 
 /**
@@ -186,6 +186,38 @@ __rooglobal__ void computeBifurGauss(Batches &batches)
    }
 }
 
+/// Computes the negative logarithm of the Poisson probability of the observed
+/// weight in each bin of a binned likelihood fit, where the expected yield is
+/// the predicted density times the bin volume. The logarithm of the factorial
+/// of the observed weights is passed precomputed, because it doesn't change
+/// from one evaluation to the next. With bin offsetting, the terms are computed
+/// relative to the saturated model, where the expected yields are equal to the
+/// observed weights. Bins without observed weight contribute their expected yield.
+__rooglobal__ void computeBinnedPoissonNLL(Batches &batches)
+{
+   Batch pred = batches.args[0];
+   Batch binVolume = batches.args[1];
+   Batch weight = batches.args[2];
+   Batch lnGammaWeight = batches.args[3];
+   const bool doBinOffset = batches.extra[0];
+
+   if (doBinOffset) {
+      for (size_t i = BEGIN; i < batches.nEvents; i += STEP) {
+         const double mu = pred[i] * binVolume[i];
+         const double n = weight[i];
+         const double term = mu - n - n * fast_log(mu / n);
+         batches.output[i] = n == 0. ? mu : term;
+      }
+   } else {
+      for (size_t i = BEGIN; i < batches.nEvents; i += STEP) {
+         const double mu = pred[i] * binVolume[i];
+         const double n = weight[i];
+         const double term = mu - n * fast_log(mu) + lnGammaWeight[i];
+         batches.output[i] = n == 0. ? mu : term;
+      }
+   }
+}
+
 __rooglobal__ void computeBreitWigner(Batches &batches)
 {
    Batch X = batches.args[0];
@@ -925,6 +957,7 @@ std::vector<void (*)(Batches &)> getFunctions()
            computeBMixDecay,
            computeBernstein,
            computeBifurGauss,
+           computeBinnedPoissonNLL,
            computeBreitWigner,
            computeBukin,
            computeCBShape,
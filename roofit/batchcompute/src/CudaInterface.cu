@@ -136,6 +136,14 @@ void CudaStream::waitForEvent(CudaEvent &event)
    ERRCHECK(::cudaStreamWaitEvent(*this, event, 0));
 }
 
+/**
+ * Blocks the calling host thread until all the work queued in a CUDA stream is done.
+ */
+void CudaStream::synchronize()
+{
+   ERRCHECK(cudaStreamSynchronize(*this));
+}
+
 /**
  * Calculates the elapsed time between two CUDA events.
  *
@@ -61,6 +61,7 @@ public:
 
    bool isActive();
    void waitForEvent(CudaEvent &);
+   void synchronize();
 
 // When compiling with NVCC, we allow setting and getting the actual CUDA objects from the wrapper.
 #ifdef __CUDACC__
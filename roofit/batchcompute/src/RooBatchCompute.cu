@@ -171,6 +171,7 @@ public:
       stream->waitForEvent(*event);
    }
    bool cudaStreamIsActive(CudaInterface::CudaStream *stream) const override { return stream->isActive(); }
+   void cudaStreamSynchronize(CudaInterface::CudaStream *stream) const override { stream->synchronize(); }
 
 private:
    const std::vector<void (*)(Batches &)> _computeFunctions;
@@ -26,7 +26,9 @@ This file contains the code for cpu computations using the RooBatchCompute libra
 #include <ROOT/RConfig.hxx>
 
 #ifdef ROOBATCHCOMPUTE_USE_IMT
-#include <ROOT/TExecutor.hxx>
+#include <ROOT/TSeq.hxx>
+#include <ROOT/TThreadExecutor.hxx>
+#include <TROOT.h>
 #endif
 
 #include <Math/Util.h>
@@ -75,6 +77,67 @@ inline void advance(Batches &batches, std::size_t nEvents)
    batches.output += nEvents;
 }
 
+/// Compute the results for the events in the range [begin, end) of the output.
+void computeRange(void (*computeFunction)(Batches &), std::span<double> output, VarSpan vars, ArgSpan extraArgs,
+                  std::size_t begin, std::size_t end)
+{
+   Batches batches;
+   std::vector<Batch> arrays(vars.size());
+   fillBatches(batches, output.data(), output.size(), vars.size(), extraArgs);
+   fillArrays(arrays, vars, output.size());
+   batches.args = arrays.data();
+   advance(batches, begin);
+
+   std::size_t events = end - begin;
+   batches.nEvents = bufferSize;
+   while (events > bufferSize) {
+      computeFunction(batches);
+      advance(batches, bufferSize);
+      events -= bufferSize;
+   }
+   batches.nEvents = events;
+   computeFunction(batches);
+}
+
+#ifdef ROOBATCHCOMPUTE_USE_IMT
+/// Minimal number of events that a task of the multi-threaded evaluation
+/// processes, such that the overhead of scheduling it stays negligible.
+constexpr std::size_t minEventsPerTask = 256 * bufferSize;
+
+/// Split a range of events into contiguous chunks, one per thread of the
+/// implicit multi-threading pool. The chunk size is a multiple of the buffer
+/// size, so every chunk starts at the same offset relative to the cache
+/// lines as for the sequential evaluation.
+/// \return The number of events per chunk, or zero if the range is too small
+///         to be split or implicit multi-threading is disabled.
+std::size_t getEventsPerTask(std::size_t nEvents)
+{
+   if (nEvents < 2 * minEventsPerTask || !ROOT::IsImplicitMTEnabled())
+      return 0;
+   const std::size_t nThreads = ROOT::GetThreadPoolSize();
+   const std::size_t nTasks = std::min(nThreads, nEvents / minEventsPerTask);
+   if (nTasks < 2)
+      return 0;
+   const std::size_t nBuffers = (nEvents + bufferSize - 1) / bufferSize;
+   return (nBuffers + nTasks - 1) / nTasks * bufferSize;
+}
+
+/// Call `func(begin, end)` concurrently for contiguous chunks of the
+/// events in the range [0, nEvents), indexing the chunks from zero.
+template <class Func>
+void forEachTask(std::size_t nEvents, std::size_t nEventsPerTask, Func &&func)
+{
+   const unsigned int nTasks = (nEvents + nEventsPerTask - 1) / nEventsPerTask;
+   ROOT::TThreadExecutor ex;
+   ex.Foreach(
+      [&](unsigned int iTask) {
+         const std::size_t begin = iTask * nEventsPerTask;
+         func(iTask, begin, std::min(begin + nEventsPerTask, nEvents));
+      },
+      ROOT::TSeq<unsigned int>(nTasks));
+}
+#endif
+
 } // namespace
 
 std::vector<void (*)(Batches &)> getFunctions();
@@ -123,69 +186,16 @@ public:
       throw std::bad_function_call();
    }
    bool cudaStreamIsActive(CudaInterface::CudaStream *) const override { throw std::bad_function_call(); }
+   void cudaStreamSynchronize(CudaInterface::CudaStream *) const override { throw std::bad_function_call(); }
 
 private:
-#ifdef ROOBATCHCOMPUTE_USE_IMT
-   void computeIMT(Computer computer, std::span<double> output, VarSpan vars, ArgSpan extraArgs);
-#endif
-
    const std::vector<void (*)(Batches &)> _computeFunctions;
 };
 
-#ifdef ROOBATCHCOMPUTE_USE_IMT
-void RooBatchComputeClass::computeIMT(Computer computer, std::span<double> output, VarSpan vars, ArgSpan extraArgs)
-{
-   std::size_t nEvents = output.size();
-
-   if (nEvents == 0)
-      return;
-   ROOT::Internal::TExecutor ex;
-   std::size_t nThreads = ex.GetPoolSize();
-
-   std::size_t nEventsPerThread = nEvents / nThreads + (nEvents % nThreads > 0);
-
-   // Reset the number of threads to the number we actually need given nEventsPerThread
-   nThreads = nEvents / nEventsPerThread + (nEvents % nEventsPerThread > 0);
-
-   auto task = [&](std::size_t idx) -> int {
-      // Fill a std::vector<Batches> with the same object and with ~nEvents/nThreads
-      // Then advance every object but the first to split the work between threads
-      Batches batches;
-      std::vector<Batch> arrays(vars.size());
-      fillBatches(batches, output.data(), nEventsPerThread, vars.size(), extraArgs);
-      fillArrays(arrays, vars, nEvents);
-      batches.args = arrays.data();
-      advance(batches, batches.nEvents * idx);
-
-      // Set the number of events of the last Batches object as the remaining events
-      if (idx == nThreads - 1) {
-         batches.nEvents = nEvents - idx * batches.nEvents;
-      }
-
-      std::size_t events = batches.nEvents;
-      batches.nEvents = bufferSize;
-      while (events > bufferSize) {
-         _computeFunctions[computer](batches);
-         advance(batches, bufferSize);
-         events -= bufferSize;
-      }
-      batches.nEvents = events;
-      _computeFunctions[computer](batches);
-      return 0;
-   };
-
-   std::vector<std::size_t> indices(nThreads);
-   for (unsigned int i = 1; i < nThreads; i++) {
-      indices[i] = i;
-   }
-   ex.Map(task, indices);
-}
-#endif
-
 /** Compute multiple values using optimized functions.
 This method creates a Batches object and passes it to the correct compute function.
-In case Implicit Multithreading is enabled, the events to be processed are equally
-divided among the tasks to be generated and computed in parallel.
+In case Implicit Multithreading is enabled and there are enough events, the events
+to be processed are divided in contiguous chunks, which are computed in parallel.
 \param computer An enum specifying the compute function to be used.
 \param output The array where the computation results are stored.
 \param vars A std::span containing pointers to the variables involved in the computation.
@@ -193,49 +203,22 @@ divided among the tasks to be generated and computed in parallel.
 void RooBatchComputeClass::compute(Config const &, Computer computer, std::span<double> output, VarSpan vars,
                                    ArgSpan extraArgs)
 {
-   // In the original implementation of this library, the evaluation was done
-   // multi-threaded in implicit multi-threading was enabled in ROOT with
-   // ROOT::EnableImplicitMT().
-   //
-   // However, this multithreaded mode was not carefully validated and is
-   // therefore not production ready. One would first have to study the
-   // overhead for different numbers of cores, number of events, and model
-   // complexity. The, we should only consider implicit multithreading here if
-   // there is no performance penalty for any scenario, to not surprise the
-   // users with unexpected slowdows!
-   //
-   // Note that the priority of investigating this is not high, because RooFit
-   // R & D efforts currently go in the direction of parallelization at the
-   // level of the gradient components, or achieving single-threaded speedup
-   // with automatic differentiation. Furthermore, the single-threaded
-   // performance of the new CPU evaluation backend with the RooBatchCompute
-   // library, is generally much faster than the legacy evaluation backend
-   // already, even if the latter uses multi-threading.
+   const std::size_t nEvents = output.size();
+   if (nEvents == 0)
+      return;
+
 #ifdef ROOBATCHCOMPUTE_USE_IMT
-   if (ROOT::IsImplicitMTEnabled()) {
-      computeIMT(computer, output, vars, extraArgs);
+   // Only large batches are split between threads, as for small ones the
+   // overhead of scheduling the tasks dominates.
+   if (const std::size_t nEventsPerTask = getEventsPerTask(nEvents)) {
+      forEachTask(nEvents, nEventsPerTask, [&](unsigned int, std::size_t begin, std::size_t end) {
+         computeRange(_computeFunctions[computer], output, vars, extraArgs, begin, end);
+      });
+      return;
    }
 #endif
 
-   std::size_t nEvents = output.size();
-
-   // Fill a std::vector<Batches> with the same object and with ~nEvents/nThreads
-   // Then advance every object but the first to split the work between threads
-   Batches batches;
-   std::vector<Batch> arrays(vars.size());
-   fillBatches(batches, output.data(), nEvents, vars.size(), extraArgs);
-   fillArrays(arrays, vars, nEvents);
-   batches.args = arrays.data();
-
-   std::size_t events = batches.nEvents;
-   batches.nEvents = bufferSize;
-   while (events > bufferSize) {
-      _computeFunctions[computer](batches);
-      advance(batches, bufferSize);
-      events -= bufferSize;
-   }
-   batches.nEvents = events;
-   _computeFunctions[computer](batches);
+   computeRange(_computeFunctions[computer], output, vars, extraArgs, 0, nEvents);
 }
 
 namespace {
@@ -259,23 +242,21 @@ inline std::pair<double, double> getLog(double prob, ReduceNLLOutput &out)
    return {std::log(prob), 0.0};
 }
 
-} // namespace
-
-double RooBatchComputeClass::reduceSum(Config const &, InputArr input, size_t n)
-{
-   return ROOT::Math::KahanSum<double, 4u>::Accumulate(input, input + n).Sum();
-}
-
-ReduceNLLOutput RooBatchComputeClass::reduceNLL(Config const &, std::span<const double> probas,
-                                                std::span<const double> weights, std::span<const double> offsetProbas)
-{
+/// Partial result of the NLL reduction for a range of events.
+struct NLLPartialSum {
    ReduceNLLOutput out;
-
+   ROOT::Math::KahanSum<double> nllSum;
    double badness = 0.0;
+};
 
-   ROOT::Math::KahanSum<double> nllSum;
+void reduceNLLRange(NLLPartialSum &partial, std::span<const double> probas, std::span<const double> weights,
+                    std::span<const double> offsetProbas, std::size_t begin, std::size_t end)
+{
+   ReduceNLLOutput &out = partial.out;
+   double &badness = partial.badness;
+   ROOT::Math::KahanSum<double> &nllSum = partial.nllSum;
 
-   for (std::size_t i = 0; i < probas.size(); ++i) {
+   for (std::size_t i = begin; i < end; ++i) {
 
       const double eventWeight = weights.size() > 1 ? weights[i] : weights[0];
 
@@ -294,9 +275,58 @@ ReduceNLLOutput RooBatchComputeClass::reduceNLL(Config const &, std::span<const
 
       nllSum.Add(term);
    }
+}
+
+} // namespace
+
+double RooBatchComputeClass::reduceSum(Config const &, InputArr input, size_t n)
+{
+#ifdef ROOBATCHCOMPUTE_USE_IMT
+   if (const std::size_t nEventsPerTask = getEventsPerTask(n)) {
+      std::vector<ROOT::Math::KahanSum<double, 4u>> partialSums((n + nEventsPerTask - 1) / nEventsPerTask);
+      forEachTask(n, nEventsPerTask, [&](unsigned int iTask, std::size_t begin, std::size_t end) {
+         partialSums[iTask] = ROOT::Math::KahanSum<double, 4u>::Accumulate(input + begin, input + end);
+      });
+      // the partial sums are merged in a fixed order to get reproducible results
+      ROOT::Math::KahanSum<double> sum;
+      for (auto const &partialSum : partialSums)
+         sum += partialSum;
+      return sum.Sum();
+   }
+#endif
+   return ROOT::Math::KahanSum<double, 4u>::Accumulate(input, input + n).Sum();
+}
+
+ReduceNLLOutput RooBatchComputeClass::reduceNLL(Config const &, std::span<const double> probas,
+                                                std::span<const double> weights, std::span<const double> offsetProbas)
+{
+   NLLPartialSum total;
+
+#ifdef ROOBATCHCOMPUTE_USE_IMT
+   const std::size_t nEvents = probas.size();
+   if (const std::size_t nEventsPerTask = getEventsPerTask(nEvents)) {
+      std::vector<NLLPartialSum> partials((nEvents + nEventsPerTask - 1) / nEventsPerTask);
+      forEachTask(nEvents, nEventsPerTask, [&](unsigned int iTask, std::size_t begin, std::size_t end) {
+         reduceNLLRange(partials[iTask], probas, weights, offsetProbas, begin, end);
+      });
+      // the partial sums are merged in a fixed order to get reproducible results
+      for (auto const &partial : partials) {
+         total.nllSum += partial.nllSum;
+         total.badness += partial.badness;
+         total.out.nLargeValues += partial.out.nLargeValues;
+         total.out.nNonPositiveValues += partial.out.nNonPositiveValues;
+         total.out.nNaNValues += partial.out.nNaNValues;
+      }
+   } else
+#endif
+   {
+      reduceNLLRange(total, probas, weights, offsetProbas, 0, probas.size());
+   }
 
-   out.nllSum = nllSum.Sum();
-   out.nllSumCarry = nllSum.Carry();
+   ReduceNLLOutput &out = total.out;
+   const double badness = total.badness;
+   out.nllSum = total.nllSum.Sum();
+   out.nllSumCarry = total.nllSum.Carry();
 
    if (badness != 0.) {
       // Some events with evaluation errors. Return "badness" of errors.
@@ -34,6 +34,8 @@ namespace HistFactory{
 
     TObject* clone(const char* newname) const override { return new LinInterpVar(*this, newname); }
 
+    void translate(RooFit::Detail::CodeSquashContext &ctx) const override;
+
 
   protected:
 
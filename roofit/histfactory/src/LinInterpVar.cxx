@@ -101,5 +101,12 @@ double LinInterpVar::evaluate() const
   return sum;
 }
 
-
-
+void LinInterpVar::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+  // Piecewise linear interpolation is the interpolation code 0 of the flexible interpolation
+  std::string const &interp = ctx.buildCall("RooFit::Detail::MathFuncs::flexibleInterp", 0, _paramList,
+                                            _paramList.size(), _low, _high, 1.0, _nominal, 0);
+  std::string resName = ctx.getTmpVarName();
+  ctx.addToCodeBody(this, "double " + resName + " = " + interp + ";\n");
+  ctx.addResult(this, "(" + resName + " <= 0 ? 1E-9 : " + resName + ")");
+}
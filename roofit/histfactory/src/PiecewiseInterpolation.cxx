@@ -194,13 +194,20 @@ void PiecewiseInterpolation::translate(RooFit::Detail::CodeSquashContext &ctx) c
          coutE(InputArguments) << "PiecewiseInterpolation::evaluate ERROR:  " << _paramSet[i].GetName()
                                << " with unknown interpolation code" << _interpCode[i] << endl;
       }
-      if (_interpCode[i] != _interpCode[0]) {
-         coutE(InputArguments) << "FlexibleInterpVar::evaluate ERROR:  Code Squashing AD does not yet support having "
-                                  "different interpolation codes for the same class object "
-                               << endl;
-      }
    }
 
+   // The same interpolation code for all parameters is the common case, and gives simpler code
+   const bool sameCodes =
+      std::all_of(_interpCode.begin(), _interpCode.end(), [&](int code) { return code == _interpCode.front(); });
+   auto buildInterpCall = [&](auto const &low, auto const &high, auto const &nominal) {
+      if (sameCodes) {
+         return ctx.buildCall("RooFit::Detail::MathFuncs::flexibleInterp", n > 0 ? _interpCode.front() : 0, _paramSet,
+                              n, low, high, 1.0, nominal, 0.0);
+      }
+      return ctx.buildCall("RooFit::Detail::MathFuncs::flexibleInterpMixedCodes", _interpCode, _paramSet, n, low,
+                           high, 1.0, nominal, 0.0);
+   };
+
    // The PiecewiseInterpolation class is used in the context of HistFactory
    // models, where is is always used the same way: all RooAbsReals in _lowSet,
    // _histSet, and also nominal are 1D RooHistFuncs with with same structure.
@@ -210,38 +217,53 @@ void PiecewiseInterpolation::translate(RooFit::Detail::CodeSquashContext &ctx) c
    // rearrange the histogram data in such a way that we can always pass the
    // same arrays to the free function that implements the interpolation, just
    // with a dynamic offset calculated from the bin index.
-   RooDataHist const &nomHist = dynamic_cast<RooHistFunc const &>(*_nominal).dataHist();
-   int nBins = nomHist.numEntries();
-   std::vector<double> valsNominal;
-   std::vector<double> valsLow;
-   std::vector<double> valsHigh;
-   for (int i = 0; i < nBins; ++i) {
-      valsNominal.push_back(nomHist.weight(i));
+   //
+   // Otherwise, the values of the low and high variations are passed as they
+   // are.
+   auto nominalHistFunc = dynamic_cast<RooHistFunc const *>(_nominal.absArg());
+   bool hasHistFuncs = nominalHistFunc != nullptr;
+   for (std::size_t iParam = 0; hasHistFuncs && iParam < n; ++iParam) {
+      auto low = dynamic_cast<RooHistFunc const *>(&_lowSet[iParam]);
+      auto high = dynamic_cast<RooHistFunc const *>(&_highSet[iParam]);
+      hasHistFuncs = low && high && low->dataHist().numEntries() == nominalHistFunc->dataHist().numEntries() &&
+                     high->dataHist().numEntries() == nominalHistFunc->dataHist().numEntries();
    }
-   for (int i = 0; i < nBins; ++i) {
-      for (std::size_t iParam = 0; iParam < n; ++iParam) {
-         valsLow.push_back(dynamic_cast<RooHistFunc const &>(_lowSet[iParam]).dataHist().weight(i));
-         valsHigh.push_back(dynamic_cast<RooHistFunc const &>(_highSet[iParam]).dataHist().weight(i));
+
+   std::string code;
+   if (!hasHistFuncs) {
+      code += "double " + resName + " = " + buildInterpCall(_lowSet, _highSet, _nominal) + ";\n";
+   } else {
+      RooDataHist const &nomHist = nominalHistFunc->dataHist();
+      int nBins = nomHist.numEntries();
+      std::vector<double> valsNominal;
+      std::vector<double> valsLow;
+      std::vector<double> valsHigh;
+      for (int i = 0; i < nBins; ++i) {
+         valsNominal.push_back(nomHist.weight(i));
+      }
+      for (int i = 0; i < nBins; ++i) {
+         for (std::size_t iParam = 0; iParam < n; ++iParam) {
+            valsLow.push_back(static_cast<RooHistFunc const &>(_lowSet[iParam]).dataHist().weight(i));
+            valsHigh.push_back(static_cast<RooHistFunc const &>(_highSet[iParam]).dataHist().weight(i));
+         }
       }
+      std::string idxName = ctx.getTmpVarName();
+      std::string valsNominalStr = ctx.buildArg(valsNominal);
+      std::string valsLowStr = ctx.buildArg(valsLow);
+      std::string valsHighStr = ctx.buildArg(valsHigh);
+      std::string nStr = std::to_string(n);
+
+      std::string lowName = ctx.getTmpVarName();
+      std::string highName = ctx.getTmpVarName();
+      std::string nominalName = ctx.getTmpVarName();
+      code += "unsigned int " + idxName + " = " +
+              nomHist.calculateTreeIndexForCodeSquash(this, ctx, nominalHistFunc->variables()) + ";\n";
+      code += "double const* " + lowName + " = " + valsLowStr + " + " + nStr + " * " + idxName + ";\n";
+      code += "double const* " + highName + " = " + valsHighStr + " + " + nStr + " * " + idxName + ";\n";
+      code += "double " + nominalName + " = *(" + valsNominalStr + " + " + idxName + ");\n";
+
+      code += "double " + resName + " = " + buildInterpCall(lowName, highName, nominalName) + ";\n";
    }
-   std::string idxName = ctx.getTmpVarName();
-   std::string valsNominalStr = ctx.buildArg(valsNominal);
-   std::string valsLowStr = ctx.buildArg(valsLow);
-   std::string valsHighStr = ctx.buildArg(valsHigh);
-   std::string nStr = std::to_string(n);
-   std::string code;
-
-   std::string lowName = ctx.getTmpVarName();
-   std::string highName = ctx.getTmpVarName();
-   std::string nominalName = ctx.getTmpVarName();
-   code += "unsigned int " + idxName + " = " + nomHist.calculateTreeIndexForCodeSquash(this, ctx, dynamic_cast<RooHistFunc const &>(*_nominal).variables()) + ";\n";
-   code += "double const* " + lowName + " = " + valsLowStr + " + " + nStr + " * " + idxName + ";\n";
-   code += "double const* " + highName + " = " + valsHighStr + " + " + nStr + " * " + idxName + ";\n";
-   code += "double " + nominalName + " = *(" + valsNominalStr + " + " + idxName + ");\n";
-
-   std::string funcCall = ctx.buildCall("RooFit::Detail::MathFuncs::flexibleInterp", _interpCode[0], _paramSet, n,
-                                        lowName, highName, 1.0, nominalName, 0.0);
-   code += "double " + resName + " = " + funcCall + ";\n";
 
    if (_positiveDefinite)
       code += resName + " = " + resName + " < 0 ? 0 : " + resName + ";\n";
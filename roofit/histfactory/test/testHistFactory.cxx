@@ -10,8 +10,14 @@
 #include <RooFitHS3/JSONIO.h>
 #include <RooFitHS3/RooJSONFactoryWSTool.h>
 
+#include <RooStats/HistFactory/FlexibleInterpVar.h>
+#include <RooStats/HistFactory/LinInterpVar.h>
+#include <RooStats/HistFactory/PiecewiseInterpolation.h>
+
 #include <RooFit/Detail/NormalizationHelpers.h>
 #include <RooDataHist.h>
+#include <RooFuncWrapper.h>
+#include <RooProduct.h>
 #include <RooWorkspace.h>
 #include <RooArgSet.h>
 #include <RooSimultaneous.h>
@@ -779,8 +785,58 @@ INSTANTIATE_TEST_SUITE_P(HistFactory, HFFixtureFit,
 INSTANTIATE_TEST_SUITE_P(HistFactoryCodeGen, HFFixtureFit,
                          testing::Combine(testing::Values(MakeModelMode::OverallSyst, MakeModelMode::HistoSyst,
                                                           MakeModelMode::StatSyst, MakeModelMode::ShapeSyst),
-                                          testing::Values(false), // no non-uniform bins
+                                          testing::Values(false, true), // non-uniform bins or not
                                           testing::Values(RooFit::EvalBackend::Codegen())),
                          getNameFromInfo);
+
+/// Check the generated code and its gradient for the interpolation classes, including the cases that HistFactory
+/// models built with the default options do not contain: different interpolation codes for the parameters of one
+/// object, and variations that are not RooHistFuncs.
+TEST(HistFactoryCodeGen, Interpolations)
+{
+   using namespace RooStats::HistFactory;
+
+   RooRealVar alpha1{"alpha1", "alpha1", 0.3, -5, 5};
+   RooRealVar alpha2{"alpha2", "alpha2", -0.7, -5, 5};
+   RooRealVar alpha3{"alpha3", "alpha3", 1.4, -5, 5};
+   RooArgList alphas{alpha1, alpha2, alpha3};
+
+   FlexibleInterpVar flexible{"flexible", "flexible", alphas, 1., {0.9, 0.8, 0.95}, {1.1, 1.3, 1.02}, {0, 1, 4}};
+   LinInterpVar linear{"linear", "linear", alphas, 2., {1.9, 1.8, 1.95}, {2.1, 2.3, 2.02}};
+
+   RooRealVar nominal{"nominal", "nominal", 10., 0., 100.};
+   RooRealVar low1{"low1", "low1", 9., 0., 100.};
+   RooRealVar low2{"low2", "low2", 8., 0., 100.};
+   RooRealVar high1{"high1", "high1", 11., 0., 100.};
+   RooRealVar high2{"high2", "high2", 13., 0., 100.};
+   PiecewiseInterpolation piecewise{"piecewise", "piecewise", nominal, {low1, low2}, {high1, high2}, {alpha1, alpha2}};
+   piecewise.setInterpCode(alpha1, 4, true);
+   piecewise.setInterpCode(alpha2, 1, true);
+
+   RooProduct product{"product", "product", {flexible, linear, piecewise}};
+
+   RooArgSet normSet;
+   std::unique_ptr<RooAbsReal> compiled = RooFit::Detail::compileForNormSet(product, normSet);
+   RooFit::Experimental::RooFuncWrapper wrapper{"wrapper", "wrapper", *compiled, nullptr, nullptr, false};
+   wrapper.createGradient();
+
+   EXPECT_NEAR(wrapper.getVal(), product.getVal(), 1e-10 * product.getVal());
+
+   RooArgSet params;
+   product.getParameters(nullptr, params);
+   std::vector<double> gradient(wrapper.getNumParams(), 0);
+   wrapper.gradient(gradient.data());
+   for (std::size_t i = 0; i < params.size(); ++i) {
+      auto &param = static_cast<RooRealVar &>(*params[i]);
+      const double orig = param.getVal();
+      const double eps = 1e-6;
+      param.setVal(orig + eps);
+      const double plus = product.getVal();
+      param.setVal(orig - eps);
+      const double minus = product.getVal();
+      param.setVal(orig);
+      EXPECT_NEAR(gradient[i], (plus - minus) / (2 * eps), 1e-5) << param.GetName();
+   }
+}
 #endif // TEST_CODEGEN_AD
 #endif // R__WIN32
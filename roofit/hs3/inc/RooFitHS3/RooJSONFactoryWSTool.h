@@ -23,6 +23,8 @@
 #include <map>
 #include <stdexcept>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace RooFit {
 namespace JSONIO {
@@ -235,6 +237,12 @@ private:
    RooFit::Detail::JSONNode *_varsNode = nullptr;
    RooWorkspace &_workspace;
 
+   // name lookup tables for the input functions and distributions, to not scan the whole list on each request
+   std::unordered_map<std::string, const RooFit::Detail::JSONNode *> _functionsByName;
+   std::unordered_map<std::string, const RooFit::Detail::JSONNode *> _distributionsByName;
+   // names of the variables already written to the _varsNode
+   std::unordered_set<std::string> _exportedVarNames;
+
    // objects to represent intermediate information
    std::unique_ptr<RooFit::JSONIO::Detail::Domains> _domains;
    std::vector<RooAbsArg const *> _serversToExport;
@@ -903,12 +903,11 @@ RooAbsPdf *RooJSONFactoryWSTool::requestImpl<RooAbsPdf>(const std::string &objna
 {
    if (RooAbsPdf *retval = _workspace.pdf(objname))
       return retval;
-   if (auto distributionsNode = _rootnodeInput->find("distributions")) {
-      if (auto child = findNamedChild(*distributionsNode, objname)) {
-         this->importFunction(*child, true);
-         if (RooAbsPdf *retval = _workspace.pdf(objname))
-            return retval;
-      }
+   auto found = _distributionsByName.find(objname);
+   if (found != _distributionsByName.end()) {
+      this->importFunction(*found->second, true);
+      if (RooAbsPdf *retval = _workspace.pdf(objname))
+         return retval;
    }
    return nullptr;
 }
@@ -924,12 +923,11 @@ RooAbsReal *RooJSONFactoryWSTool::requestImpl<RooAbsReal>(const std::string &obj
       return pdf;
    if (RooRealVar *var = requestImpl<RooRealVar>(objname))
       return var;
-   if (auto functionNode = _rootnodeInput->find("functions")) {
-      if (auto child = findNamedChild(*functionNode, objname)) {
-         this->importFunction(*child, true);
-         if (RooAbsReal *retval = _workspace.function(objname))
-            return retval;
-      }
+   auto found = _functionsByName.find(objname);
+   if (found != _functionsByName.end()) {
+      this->importFunction(*found->second, true);
+      if (RooAbsReal *retval = _workspace.function(objname))
+         return retval;
    }
    return nullptr;
 }
@@ -957,7 +955,9 @@ void RooJSONFactoryWSTool::exportVariable(const RooAbsArg *v, JSONNode &node)
    }
 
    // this variable was already exported
-   if (findNamedChild(node, v->GetName())) {
+   const bool exported = &node == _varsNode ? !_exportedVarNames.insert(v->GetName()).second
+                                            : findNamedChild(node, v->GetName()) != nullptr;
+   if (exported) {
       return;
    }
 
@@ -1831,6 +1831,12 @@ void RooJSONFactoryWSTool::exportAllObjects(JSONNode &n)
    std::set<std::string> exportedObjectNames;
    exportObjects(allpdfs, exportedObjectNames);
 
+   // all nodes the toplevel pdfs depend on, to filter the snapshots below
+   RooArgSet allPdfNodes;
+   for (RooAbsPdf *pdf : allpdfs) {
+      pdf->treeNodeServerList(&allPdfNodes);
+   }
+
    // export attributes of all objects
    for (RooAbsArg *arg : _workspace.components()) {
       exportAttributes(arg, n);
@@ -1868,12 +1874,7 @@ void RooJSONFactoryWSTool::exportAllObjects(JSONNode &n)
       // HistFactory).
       for (RooAbsArg *arg : *snsh) {
          if (exportedObjectNames.find(arg->GetName()) != exportedObjectNames.end()) {
-            bool do_export = false;
-            for (const auto &pdf : allpdfs) {
-               if (pdf->dependsOn(*arg)) {
-                  do_export = true;
-               }
-            }
+            const bool do_export = allPdfNodes.find(*arg) != nullptr;
             if (do_export && !::isValidName(arg->GetName())) {
                std::stringstream ss;
                ss << "RooJSONFactoryWSTool() variable '" << arg->GetName() << "' has an invalid name!" << std::endl;
@@ -1890,6 +1891,7 @@ void RooJSONFactoryWSTool::exportAllObjects(JSONNode &n)
       }
    }
    _varsNode = nullptr;
+   _exportedVarNames.clear();
    _domains->writeJSON(n["domains"]);
    _domains.reset();
    _rootnodeOutput = nullptr;
@@ -2112,6 +2114,17 @@ void RooJSONFactoryWSTool::importAllNodes(const JSONNode &n)
 
    _rootnodeInput = &n;
 
+   // index the functions and distributions by name, as they request each other while being imported
+   for (auto const &[key, index] : {std::make_pair("functions", &_functionsByName),
+                                    std::make_pair("distributions", &_distributionsByName)}) {
+      index->clear();
+      if (auto seq = n.find(key)) {
+         for (const auto &p : seq->children()) {
+            index->emplace(RooJSONFactoryWSTool::name(p), &p);
+         }
+      }
+   }
+
    _attributesNode = findRooFitInternal(*_rootnodeInput, "attributes");
 
    this->importDependants(n);
@@ -2175,6 +2188,8 @@ void RooJSONFactoryWSTool::importAllNodes(const JSONNode &n)
    }
 
    _rootnodeInput = nullptr;
+   _functionsByName.clear();
+   _distributionsByName.clear();
    _domains.reset();
 }
 
@@ -0,0 +1,74 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2026, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#ifndef ROOT_ROOFIT_MultiProcess_SharedState
+#define ROOT_ROOFIT_MultiProcess_SharedState
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace RooFit {
+namespace MultiProcess {
+
+class SharedState {
+public:
+   explicit SharedState(std::size_t size);
+   ~SharedState();
+   SharedState(const SharedState &) = delete;
+   SharedState &operator=(const SharedState &) = delete;
+
+   std::size_t size() const { return size_; }
+
+   /// Call `writer(void *data)` to modify the contents of the segment. Only one
+   /// process, typically the master, may write.
+   template <class Writer>
+   void write(Writer &&writer)
+   {
+      const auto sequence = header_->sequence.load(std::memory_order_relaxed);
+      // an odd sequence number tells the readers that a write is in progress
+      header_->sequence.store(sequence + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      writer(data_);
+      header_->sequence.store(sequence + 2, std::memory_order_release);
+   }
+
+   /// Call `reader(const void *data)` to copy out the contents of the segment.
+   /// The reader is called again if the segment was modified in the meantime,
+   /// so it must not have side effects other than the copy.
+   template <class Reader>
+   void read(Reader &&reader) const
+   {
+      while (true) {
+         const auto before = header_->sequence.load(std::memory_order_acquire);
+         if (before % 2 != 0)
+            continue;
+         reader(static_cast<const void *>(data_));
+         std::atomic_thread_fence(std::memory_order_acquire);
+         if (header_->sequence.load(std::memory_order_relaxed) == before)
+            return;
+      }
+   }
+
+private:
+   struct Header {
+      std::atomic<std::uint64_t> sequence{0};
+   };
+
+   std::size_t size_ = 0;
+   void *mapping_ = nullptr;
+   Header *header_ = nullptr;
+   void *data_ = nullptr;
+};
+
+} // namespace MultiProcess
+} // namespace RooFit
+
+#endif // ROOT_ROOFIT_MultiProcess_SharedState
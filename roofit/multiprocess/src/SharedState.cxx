@@ -0,0 +1,56 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2026, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#include "RooFit/MultiProcess/SharedState.h"
+
+#include <sys/mman.h>
+
+#include <cerrno>
+#include <cstring> // strerror
+#include <new>
+#include <stdexcept>
+#include <string>
+
+namespace RooFit {
+namespace MultiProcess {
+
+/** @class SharedState
+ * @brief Memory segment for Job state that the master shares with the forked workers
+ *
+ * The segment is an anonymous shared memory mapping, so it must be created
+ * before the JobManager forks the worker processes, i.e. when constructing a
+ * Job. Large state updates, like the parameter values of a gradient
+ * calculation, can then be written into the segment by the master, while only
+ * a small notification is published to the workers over ZeroMQ. This saves
+ * the serialization and copying of the state for every worker.
+ *
+ * Concurrent access is coordinated without locks using a sequence counter:
+ * the writer makes it odd while writing, and readers retry until they copied
+ * the data while the counter was even and unchanged.
+ */
+
+SharedState::SharedState(std::size_t size) : size_(size)
+{
+   mapping_ = mmap(nullptr, sizeof(Header) + size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+   if (mapping_ == MAP_FAILED) {
+      throw std::runtime_error("SharedState: could not create a shared memory mapping of " +
+                               std::to_string(sizeof(Header) + size_) + " bytes: " + std::strerror(errno));
+   }
+   header_ = new (mapping_) Header;
+   data_ = static_cast<char *>(mapping_) + sizeof(Header);
+}
+
+SharedState::~SharedState()
+{
+   munmap(mapping_, sizeof(Header) + size_);
+}
+
+} // namespace MultiProcess
+} // namespace RooFit
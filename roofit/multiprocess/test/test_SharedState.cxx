@@ -0,0 +1,44 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2026, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#include "RooFit/MultiProcess/SharedState.h"
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstring> // memcpy
+#include <vector>
+
+#include "gtest/gtest.h"
+
+TEST(TestMPSharedState, writeInParentReadInChild)
+{
+   const std::vector<double> values{1.5, -2., 3.25, 1e10};
+   RooFit::MultiProcess::SharedState state(values.size() * sizeof(double));
+   ASSERT_EQ(state.size(), values.size() * sizeof(double));
+
+   pid_t child = fork();
+   ASSERT_NE(child, -1);
+   if (child == 0) {
+      // the child waits for the parent to write all values, then checks them
+      std::vector<double> read(values.size());
+      do {
+         state.read([&](const void *data) { std::memcpy(read.data(), data, read.size() * sizeof(double)); });
+      } while (read.back() != values.back());
+      _exit(read == values ? 0 : 1);
+   }
+
+   state.write([&](void *data) { std::memcpy(data, values.data(), values.size() * sizeof(double)); });
+
+   int status = 0;
+   waitpid(child, &status, 0);
+   ASSERT_TRUE(WIFEXITED(status));
+   EXPECT_EQ(WEXITSTATUS(status), 0);
+}
@@ -712,7 +712,7 @@ private:
   friend class RooFitResult;
 
  public:
-  static std::map<RooAbsArg*,std::unique_ptr<TRefArray>> _ioEvoList; // temporary holding list for proxies needed in schema evolution
+  static std::unordered_map<RooAbsArg*,std::unique_ptr<TRefArray>> _ioEvoList; // temporary holding list for proxies needed in schema evolution
  protected:
   static std::stack<RooAbsArg*> _ioReadStack ; // reading stack
   /// \endcond
@@ -19,6 +19,9 @@
 #include "RooHistPdf.h"
 #include "TVirtualFFT.h"
 
+#include <complex>
+#include <vector>
+
 class RooRealVar;
 
 ///PDF for the numerical (FFT) convolution of two PDFs.
@@ -89,6 +92,14 @@ protected:
 
     std::unique_ptr<RooAbsBinning> histBinning;
     std::unique_ptr<RooAbsBinning> scanBinning;
+
+    /// Sampling of the second input p.d.f. in a cache slice, and its Fourier transform
+    struct Pdf2Slice {
+      std::vector<double> sampling;
+      std::vector<std::complex<double>> transform;
+    };
+    std::vector<Pdf2Slice> pdf2Slices;
+    std::unique_ptr<RooChangeTracker> pdf2ParamTracker; ///< Tracks the parameters of the second input p.d.f.
   };
 
   friend class FFTCacheElem ;
@@ -99,7 +110,7 @@ protected:
   RooFit::OwningPtr<RooArgSet> actualParameters(const RooArgSet& nset) const override ;
   RooAbsArg& pdfObservable(RooAbsArg& histObservable) const override ;
   void fillCacheObject(PdfCacheElem& cache) const override ;
-  void fillCacheSlice(FFTCacheElem& cache, const RooArgSet& slicePosition) const ;
+  void fillCacheSlice(FFTCacheElem& cache, const RooArgSet& slicePosition, std::size_t sliceIdx=0) const ;
 
   PdfCacheElem* createCache(const RooArgSet* nset) const override ;
   TString histNameSuffix() const override ;
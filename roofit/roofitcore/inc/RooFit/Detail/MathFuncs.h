@@ -175,6 +175,23 @@ inline unsigned int getUniformBinning(double low, double high, double val, unsig
    return val >= high ? numBins - 1 : std::abs((val - low) / binWidth);
 }
 
+/// Returns the index of the bin containing `val`, given the `numBins + 1` ascending bin boundaries. Values outside of
+/// the boundaries are assigned to the first or last bin.
+inline unsigned int getBinning(double const *boundaries, unsigned int numBins, double val)
+{
+   unsigned int lo = 0;
+   unsigned int hi = numBins;
+   while (hi - lo > 1) {
+      unsigned int mid = (lo + hi) / 2;
+      if (val < boundaries[mid]) {
+         hi = mid;
+      } else {
+         lo = mid;
+      }
+   }
+   return lo;
+}
+
 inline double interpolate1d(double low, double high, double val, unsigned int numBins, double const* vals)
 {
    double binWidth = (high - low) / numBins;
@@ -328,6 +345,18 @@ inline double flexibleInterp(unsigned int code, double const *params, unsigned i
    return doCutoff && total <= 0 ? TMath::Limits<double>::Min() : total;
 }
 
+/// Same as flexibleInterp(), but with one interpolation code per parameter.
+inline double flexibleInterpMixedCodes(int const *codes, double const *params, unsigned int n, double const *low,
+                                       double const *high, double boundary, double nominal, int doCutoff)
+{
+   double total = nominal;
+   for (std::size_t i = 0; i < n; ++i) {
+      total += flexibleInterpSingle(codes[i], low[i], high[i], boundary, nominal, params[i], total);
+   }
+
+   return doCutoff && total <= 0 ? TMath::Limits<double>::Min() : total;
+}
+
 inline double landau(double x, double mu, double sigma)
 {
    if (sigma <= 0.)
@@ -52,6 +52,8 @@ private:
    void markGPUNodes();
    void assignToGPU(NodeInfo &info);
    void computeCPUNode(const RooAbsArg *node, NodeInfo &info);
+   void computeCachedCPUNode(NodeInfo &info);
+   void findCacheableNodes();
    void setOperMode(RooAbsArg *arg, RooAbsArg::OperMode opMode);
    void syncDataTokens();
    void updateOutputSizes();
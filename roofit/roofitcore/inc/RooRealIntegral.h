@@ -23,6 +23,8 @@
 #include <RooRealProxy.h>
 #include <RooSetProxy.h>
 
+#include <vector>
+
 class RooAbsIntegrator;
 class RooNumIntConfig;
 
@@ -66,6 +68,10 @@ public:
 
   static Int_t getCacheAllNumeric() ;
 
+  static void setNumIntCacheSize(std::size_t size) ;
+
+  static std::size_t getNumIntCacheSize() ;
+
   std::list<double>* plotSamplingHint(RooAbsRealLValue& obs, double xlo, double xhi) const override {
     // Forward plot sampling hint of integrand
     return _function->plotSamplingHint(obs,xlo,xhi) ;
@@ -144,8 +150,21 @@ protected:
   bool _cacheNum = false;           ///< Cache integral if numeric
   static Int_t _cacheAllNDim ; ///<! Cache all integrals with given numeric dimension
 
+  /// Result of a numeric integration, with the parameter values and integration ranges it was computed for.
+  struct NumIntCacheEntry {
+    std::vector<double> key;
+    double value = 0.0;
+  };
+  mutable std::vector<NumIntCacheEntry> _numIntCache; ///<! Results of the most recent numeric integrations
+  mutable std::size_t _numIntCacheNext = 0;           ///<! Index of the next cache entry to overwrite
+  mutable std::vector<double> _numIntCacheKey;        ///<! Key of the current parameter point
+  static std::size_t _numIntCacheSize;                ///<! Number of numeric integration results cached per integral
+
 private:
   void addNumIntDep(RooAbsArg const &arg);
+  void fillNumIntCacheKey() const;
+  double const *findNumIntCacheEntry() const;
+  void addNumIntCacheEntry(double value) const;
 
   ClassDefOverride(RooRealIntegral,5) // Real-valued function representing an integral over a RooAbsReal object
 };
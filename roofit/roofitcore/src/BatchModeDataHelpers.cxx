@@ -36,7 +36,7 @@ void assignSpan(std::span<T> &to, std::span<T> const &from)
 
 std::map<RooFit::Detail::DataKey, std::span<const double>>
 getSingleDataSpans(RooAbsData const &data, std::string_view rangeName, std::string const &prefix,
-                   std::stack<std::vector<double>> &buffers, bool skipZeroWeights)
+                   std::stack<std::vector<double>> &buffers, bool skipZeroWeights, bool referenceData)
 {
    std::map<RooFit::Detail::DataKey, std::span<const double>> dataSpans; // output variable
 
@@ -65,44 +65,56 @@ getSingleDataSpans(RooAbsData const &data, std::string_view rangeName, std::stri
    // RooNLLVarNew. We also add the sumW2 weights here under a different name,
    // so we can apply the sumW2 correction by easily swapping the spans.
    {
-      buffers.emplace();
-      auto &buffer = buffers.top();
-      buffers.emplace();
-      auto &bufferSumW2 = buffers.top();
       if (weight.empty()) {
          // If the dataset has no weight, we fill the data spans with a scalar
          // unity weight so we don't need to check for the existence of weights
          // later in the likelihood.
-         buffer.push_back(1.0);
-         bufferSumW2.push_back(1.0);
-         assignSpan(weight, {buffer.data(), 1});
-         assignSpan(weightSumW2, {bufferSumW2.data(), 1});
+         buffers.emplace(1, 1.0);
+         assignSpan(weight, {buffers.top().data(), 1});
+         buffers.emplace(1, 1.0);
+         assignSpan(weightSumW2, {buffers.top().data(), 1});
          nNonZeroWeight = nEvents;
       } else {
-         buffer.reserve(nEvents);
-         bufferSumW2.reserve(nEvents);
          for (std::size_t i = 0; i < nEvents; ++i) {
-            if (!skipZeroWeights || weight[i] != 0) {
-               buffer.push_back(weight[i]);
-               bufferSumW2.push_back(weightSumW2[i]);
-               ++nNonZeroWeight;
-            } else {
-               hasZeroWeight[i] = true;
+            hasZeroWeight[i] = skipZeroWeights && weight[i] == 0;
+            nNonZeroWeight += !hasZeroWeight[i];
+         }
+         if (!referenceData || nNonZeroWeight != nEvents) {
+            buffers.emplace();
+            auto &buffer = buffers.top();
+            buffers.emplace();
+            auto &bufferSumW2 = buffers.top();
+            buffer.reserve(nNonZeroWeight);
+            bufferSumW2.reserve(nNonZeroWeight);
+            for (std::size_t i = 0; i < nEvents; ++i) {
+               if (!hasZeroWeight[i]) {
+                  buffer.push_back(weight[i]);
+                  bufferSumW2.push_back(weightSumW2[i]);
+               }
             }
+            assignSpan(weight, {buffer.data(), nNonZeroWeight});
+            assignSpan(weightSumW2, {bufferSumW2.data(), nNonZeroWeight});
          }
-         assignSpan(weight, {buffer.data(), nNonZeroWeight});
-         assignSpan(weightSumW2, {bufferSumW2.data(), nNonZeroWeight});
       }
       insert(RooNLLVarNew::weightVarName, weight);
       insert(RooNLLVarNew::weightVarNameSumW2, weightSumW2);
    }
 
+   // If no entries are skipped, the spans can point directly to the memory of
+   // the dataset, which avoids a copy of the full dataset for each likelihood.
+   const bool copyValues = !referenceData || nNonZeroWeight != nEvents;
+
    // Get the real-valued batches and cast the also to double branches to put in
    // the data map
    for (auto const &item : data.getBatches(0, nEvents)) {
 
       std::span<const double> span{item.second};
 
+      if (!copyValues) {
+         insert(item.first->GetName(), span);
+         continue;
+      }
+
       buffers.emplace();
       auto &buffer = buffers.top();
       buffer.reserve(nNonZeroWeight);
@@ -202,7 +214,9 @@ getSingleDataSpans(RooAbsData const &data, std::string_view rangeName, std::stri
 /// \param[in] buffers Pass here an empty stack of `double` vectors, which will
 ///            be used as memory for the data if the memory in the dataset
 ///            object can't be used directly (e.g. because you used the range
-///            selection or the splitting by categories).
+///            selection or the splitting by categories). Otherwise, the
+///            returned spans point to the memory of the dataset, which then
+///            has to outlive them.
 std::map<RooFit::Detail::DataKey, std::span<const double>>
 RooFit::Detail::BatchModeDataHelpers::getDataSpans(RooAbsData const &data, std::string const &rangeName,
                                                    RooSimultaneous const *simPdf, bool skipZeroWeights,
@@ -239,7 +253,7 @@ RooFit::Detail::BatchModeDataHelpers::getDataSpans(RooAbsData const &data, std::
       auto const &toAdd = datasets[iData];
       auto spans = getSingleDataSpans(
          *toAdd.second, RooHelpers::getRangeNameForSimComponent(rangeName, splitRange, toAdd.second->GetName()),
-         toAdd.first, buffers, skipZeroWeights && !isBinnedL[iData]);
+         toAdd.first, buffers, skipZeroWeights && !isBinnedL[iData], /*referenceData=*/!simPdf);
       for (auto const &item : spans) {
          dataSpans.insert(item);
       }
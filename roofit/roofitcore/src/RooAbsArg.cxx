@@ -104,7 +104,7 @@ bool RooAbsArg::_verboseDirty(false) ;
 bool RooAbsArg::_inhibitDirty(false) ;
 bool RooAbsArg::inhibitDirty() const { return _inhibitDirty && !_localNoInhibitDirty; }
 
-std::map<RooAbsArg*,std::unique_ptr<TRefArray>> RooAbsArg::_ioEvoList;
+std::unordered_map<RooAbsArg*,std::unique_ptr<TRefArray>> RooAbsArg::_ioEvoList;
 std::stack<RooAbsArg*> RooAbsArg::_ioReadStack ;
 
 
@@ -2417,6 +2417,10 @@ void RooAbsArg::Streamer(TBuffer &R__b)
 
 void RooAbsArg::ioStreamerPass2()
 {
+  // Nothing is pending for the nodes that were read without proxies
+  if (_ioEvoList.empty())
+    return;
+
   // Handling of v5-v6 migration (TRefArray _proxyList --> RooRefArray _proxyList)
   auto iter = _ioEvoList.find(this);
   if (iter != _ioEvoList.end()) {
@@ -2483,8 +2487,11 @@ void RooRefArray::Streamer(TBuffer &R__b)
       refArray->Streamer(R__b);
       R__b.CheckByteCount(R__s, R__c, refArray->IsA());
 
-      // Schedule deferred processing of TRefArray into proxy list
-      RooAbsArg::_ioEvoList[RooAbsArg::_ioReadStack.top()] = std::move(refArray);
+      // Schedule deferred processing of TRefArray into proxy list. Leaf nodes
+      // like RooRealVar have no proxies, so there is nothing to schedule.
+      if (refArray->GetEntriesFast() > 0) {
+         RooAbsArg::_ioEvoList[RooAbsArg::_ioReadStack.top()] = std::move(refArray);
+      }
 
    } else {
 
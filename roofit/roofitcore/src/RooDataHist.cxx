@@ -1027,15 +1027,17 @@ std::string RooDataHist::calculateTreeIndexForCodeSquash(RooAbsArg const * /*kla
          coutE(InputArguments) << "RooHistPdf::weight(" << GetName()
                                << ") ERROR: Code Squashing currently does not support category values." << std::endl;
          return "";
-      } else if (!dynamic_cast<RooUniformBinning const *>(binning)) {
-         coutE(InputArguments) << "RooHistPdf::weight(" << GetName()
-                               << ") ERROR: Code Squashing currently only supports uniformly binned cases."
-                               << std::endl;
-         return "";
       }
 
-      std::string const &bin = ctx.buildCall("RooFit::Detail::MathFuncs::getUniformBinning", binning->lowBound(),
-                                             binning->highBound(), *theVar, binning->numBins());
+      std::string bin;
+      if (dynamic_cast<RooUniformBinning const *>(binning)) {
+         bin = ctx.buildCall("RooFit::Detail::MathFuncs::getUniformBinning", binning->lowBound(),
+                             binning->highBound(), *theVar, binning->numBins());
+      } else {
+         // The bin boundaries are looked up in the generated code
+         std::span<const double> boundaries{binning->array(), static_cast<std::size_t>(binning->numBoundaries())};
+         bin = ctx.buildCall("RooFit::Detail::MathFuncs::getBinning", boundaries, binning->numBins(), *theVar);
+      }
       code += " + " + std::to_string(idxMult) + " * " + bin;
 
       // Use RooAbsLValue here because it also generalized to categories, which
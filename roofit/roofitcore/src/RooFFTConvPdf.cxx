@@ -60,6 +60,8 @@
 /// which are also stored in the cache. Subsequent evaluations for different values of the convolution observable and
 /// identical parameters will be retrieved from the cache. If one or more
 /// of the parameters change, the cache will be updated, *i.e.*, a new FFT runs.
+/// If only parameters of the first p.d.f. change, the sampling and the Fourier
+/// transform of the second p.d.f. (typically the resolution model) are reused.
 ///
 /// The sampling density of the FFT is controlled by the binning of the
 /// the convolution observable, which can be changed using RooRealVar::setBins(N).
@@ -419,6 +421,14 @@ RooFFTConvPdf::FFTCacheElem::FFTCacheElem(const RooFFTConvPdf& self, const RooAr
   pdf1Clone->fixAddCoefNormalization(convSet, true);
   pdf2Clone->fixAddCoefNormalization(convSet, true);
 
+  // Track the parameters of the second pdf separately, such that its sampling
+  // and Fourier transform can be reused when only the parameters of the first
+  // pdf change (e.g. a resolution model with fixed parameters)
+  std::unique_ptr<RooArgSet> pdf2Params{pdf2Clone->getParameters(*hist()->get())};
+  string trackerName = string(self.GetName()) + "_pdf2_CACHEPARAMS";
+  pdf2ParamTracker = std::make_unique<RooChangeTracker>(trackerName.c_str(), trackerName.c_str(), *pdf2Params, true);
+  pdf2ParamTracker->hasChanged(true);
+
   // Save copy of original histX binning and make alternate binning
   // for extended range scanning
 
@@ -461,6 +471,7 @@ RooArgList RooFFTConvPdf::FFTCacheElem::containedArgs(Action a)
 
   ret.add(*pdf1Clone) ;
   ret.add(*pdf2Clone) ;
+  ret.add(*pdf2ParamTracker) ;
   if (pdf1Clone->ownedComponents()) {
     ret.add(*pdf1Clone->ownedComponents()) ;
   }
@@ -479,9 +490,15 @@ RooArgList RooFFTConvPdf::FFTCacheElem::containedArgs(Action a)
 void RooFFTConvPdf::fillCacheObject(RooAbsCachedPdf::PdfCacheElem& cache) const
 {
   RooDataHist& cacheHist = *cache.hist() ;
+  auto& aux = static_cast<FFTCacheElem&>(cache) ;
+
+  aux.pdf1Clone->setOperMode(ADirty,true) ;
+  aux.pdf2Clone->setOperMode(ADirty,true) ;
 
-  (static_cast<FFTCacheElem&>(cache)).pdf1Clone->setOperMode(ADirty,true) ;
-  (static_cast<FFTCacheElem&>(cache)).pdf2Clone->setOperMode(ADirty,true) ;
+  // Sample the second pdf again only if its parameters have changed
+  if (aux.pdf2ParamTracker->hasChanged(true)) {
+    aux.pdf2Slices.clear() ;
+  }
 
   // Determine if there other observables than the convolution observable in the cache
   RooArgSet otherObs ;
@@ -496,7 +513,7 @@ void RooFFTConvPdf::fillCacheObject(RooAbsCachedPdf::PdfCacheElem& cache) const
 
   // Handle trivial scenario -- no other observables
   if (otherObs.empty()) {
-    fillCacheSlice(static_cast<FFTCacheElem&>(cache),RooArgSet()) ;
+    fillCacheSlice(aux,RooArgSet()) ;
     return ;
   }
 
@@ -521,6 +538,7 @@ void RooFFTConvPdf::fillCacheObject(RooAbsCachedPdf::PdfCacheElem& cache) const
   }
 
   bool loop(true) ;
+  std::size_t sliceIdx(0) ;
   while(loop) {
     // Set current slice position
     for (Int_t j=0 ; j<n ; j++) { obsLV[j]->setBin(binCur[j],binningName()) ; }
@@ -528,7 +546,7 @@ void RooFFTConvPdf::fillCacheObject(RooAbsCachedPdf::PdfCacheElem& cache) const
 //     cout << "filling slice: bin of obsLV[0] = " << obsLV[0]->getBin() << endl ;
 
     // Fill current slice
-    fillCacheSlice(static_cast<FFTCacheElem&>(cache),otherObs) ;
+    fillCacheSlice(aux,otherObs,sliceIdx++) ;
 
     // Determine which iterator to increment
     while(binCur[curObs]==binMax[curObs]) {
@@ -556,7 +574,7 @@ void RooFFTConvPdf::fillCacheObject(RooAbsCachedPdf::PdfCacheElem& cache) const
 ////////////////////////////////////////////////////////////////////////////////
 /// Fill a slice of cachePdf with the output of the FFT convolution calculation
 
-void RooFFTConvPdf::fillCacheSlice(FFTCacheElem& aux, const RooArgSet& slicePos) const
+void RooFFTConvPdf::fillCacheSlice(FFTCacheElem& aux, const RooArgSet& slicePos, std::size_t sliceIdx) const
 {
   // Extract histogram that is the basis of the RooHistPdf
   RooDataHist& cacheHist = *aux.hist() ;
@@ -577,11 +595,21 @@ void RooFFTConvPdf::fillCacheSlice(FFTCacheElem& aux, const RooArgSet& slicePos)
   Int_t binShift1;
   Int_t binShift2;
 
+  // The sampling of the second pdf is kept from the previous fill if its
+  // parameters did not change
+  if (aux.pdf2Slices.size() <= sliceIdx) aux.pdf2Slices.resize(sliceIdx+1) ;
+  FFTCacheElem::Pdf2Slice& pdf2Slice = aux.pdf2Slices[sliceIdx] ;
+  const bool scanPdf2 = pdf2Slice.sampling.empty() ;
+
   RooRealVar* histX = static_cast<RooRealVar*>(cacheHist.get()->find(_x.arg().GetName())) ;
   if (_bufStrat==Extend) histX->setBinning(*aux.scanBinning) ;
   std::vector<double> input1 = scanPdf(const_cast<RooRealVar &>(static_cast<RooRealVar const&>(_x.arg())),*aux.pdf1Clone,cacheHist,slicePos,N,N2,binShift1,_shift1) ;
-  std::vector<double> input2 = scanPdf(const_cast<RooRealVar &>(static_cast<RooRealVar const&>(_x.arg())),*aux.pdf2Clone,cacheHist,slicePos,N,N2,binShift2,_shift2) ;
+  if (scanPdf2) {
+    pdf2Slice.sampling = scanPdf(const_cast<RooRealVar &>(static_cast<RooRealVar const&>(_x.arg())),*aux.pdf2Clone,cacheHist,slicePos,N,N2,binShift2,_shift2) ;
+    pdf2Slice.transform.clear() ;
+  }
   if (_bufStrat==Extend) histX->setBinning(*aux.histBinning) ;
+  std::vector<double>& input2 = pdf2Slice.sampling ;
 
 #ifndef ROOFIT_MATH_FFTW3
   // If ROOT was NOT built with the fftw3 interface, we try to include fftw3.h
@@ -611,19 +639,28 @@ void RooFFTConvPdf::fillCacheSlice(FFTCacheElem& aux, const RooArgSet& slicePos)
   aux.fftr2c1->SetPoints(input1.data());
   aux.fftr2c1->Transform();
 
-  // Real->Complex FFT Transform on p.d.f 2 sampling
-  aux.fftr2c2->SetPoints(input2.data());
-  aux.fftr2c2->Transform();
+  // Real->Complex FFT Transform on p.d.f 2 sampling, unless it is kept from
+  // the previous fill
+  if (pdf2Slice.transform.empty()) {
+    aux.fftr2c2->SetPoints(input2.data());
+    aux.fftr2c2->Transform();
+    pdf2Slice.transform.resize(N2/2+1);
+    for (Int_t i=0 ; i<N2/2+1 ; i++) {
+      double re2;
+      double im2;
+      aux.fftr2c2->GetPointComplex(i,re2,im2) ;
+      pdf2Slice.transform[i] = {re2, im2};
+    }
+  }
 
   // Loop over first half +1 of complex output results, multiply
   // and set as input of reverse transform
   for (Int_t i=0 ; i<N2/2+1 ; i++) {
     double re1;
-    double re2;
     double im1;
-    double im2;
     aux.fftr2c1->GetPointComplex(i,re1,im1) ;
-    aux.fftr2c2->GetPointComplex(i,re2,im2) ;
+    const double re2 = pdf2Slice.transform[i].real() ;
+    const double im2 = pdf2Slice.transform[i].imag() ;
     double re = re1*re2 - im1*im2 ;
     double im = re1*im2 + re2*im1 ;
     TComplex t(re,im) ;
@@ -42,10 +42,10 @@ RooAbsPdf::fitTo() is called and gets destroyed when the fitting ends.
 #include "RooFit/Detail/BatchModeDataHelpers.h"
 #include "RooFitImplHelpers.h"
 
-#include <chrono>
+#include <algorithm>
 #include <iomanip>
+#include <iterator>
 #include <numeric>
-#include <thread>
 
 namespace RooFit {
 
@@ -119,6 +119,16 @@ struct NodeInfo {
    std::vector<NodeInfo *> serverInfos;
    std::vector<NodeInfo *> clientInfos;
 
+   // Members for caching the result of a previous evaluation, which is
+   // restored when the parameters the node depends on get their old values
+   // back (see Evaluator::computeCachedCPUNode()).
+   bool isCacheable = false;
+   int lastComputed = 0;
+   std::vector<NodeInfo *> variableInfos; // the variables this node depends on, sorted by iNode
+   std::vector<double> paramValues;       // values of the variables the current result was computed with
+   std::shared_ptr<RooBatchCompute::AbsBuffer> cachedBuffer;
+   std::vector<double> cachedParamValues;
+
    RooBatchCompute::CudaInterface::CudaEvent *event = nullptr;
    RooBatchCompute::CudaInterface::CudaStream *stream = nullptr;
 
@@ -299,6 +309,7 @@ void Evaluator::updateOutputSizes()
          // any buffer for temporary results is invalidated by resetting the output sizes
          info.buffer.reset();
       }
+      info.cachedBuffer.reset();
    }
 
    auto outputSizeMap =
@@ -324,11 +335,56 @@ void Evaluator::updateOutputSizes()
 
    if (_useGPU) {
       markGPUNodes();
+   } else {
+      findCacheableNodes();
    }
 
    _needToUpdateOutputSizes = false;
 }
 
+/// Find the variables every node depends on, and decide which nodes cache the
+/// results of previous evaluations. Only non-scalar nodes are cached, because
+/// for scalar nodes looking up the cache is about as expensive as computing
+/// them. Nodes that depend on all the variables are not cached either, as
+/// they change at every step of a numerical derivative.
+void Evaluator::findCacheableNodes()
+{
+   auto byIndex = [](NodeInfo const *a, NodeInfo const *b) { return a->iNode < b->iNode; };
+
+   std::size_t nVariables = 0;
+   std::vector<NodeInfo *> merged;
+   for (auto &info : _nodes) {
+      info.variableInfos.clear();
+      if (info.fromArrayInput)
+         continue;
+      if (info.isVariable) {
+         ++nVariables;
+         continue;
+      }
+      for (NodeInfo *serverInfo : info.serverInfos) {
+         if (serverInfo->fromArrayInput)
+            continue;
+         NodeInfo *const *first = &serverInfo;
+         NodeInfo *const *last = first + 1;
+         if (!serverInfo->isVariable) {
+            first = serverInfo->variableInfos.data();
+            last = first + serverInfo->variableInfos.size();
+         }
+         merged.clear();
+         std::set_union(info.variableInfos.begin(), info.variableInfos.end(), first, last, std::back_inserter(merged),
+                        byIndex);
+         std::swap(info.variableInfos, merged);
+      }
+   }
+
+   for (auto &info : _nodes) {
+      info.isCacheable = !info.isVariable && !info.fromArrayInput && !info.isScalar() &&
+                         info.variableInfos.size() < nVariables;
+      info.paramValues.clear();
+      info.cachedParamValues.clear();
+   }
+}
+
 Evaluator::~Evaluator()
 {
    for (auto &info : _nodes) {
@@ -408,6 +464,45 @@ void Evaluator::setClientsDirty(NodeInfo &nodeInfo)
    }
 }
 
+/// Evaluate a dirty non-scalar node on the CPU, unless its result for the
+/// current values of the parameters it depends on is still in the cache.
+///
+/// Every cacheable node keeps the results of its two last distinct parameter
+/// points. This avoids recomputing the nodes that depend on a parameter when
+/// the parameter is set back to its original value, which happens for every
+/// parameter in numerical derivatives: if a node was not computed in the
+/// previous evaluation, its current result is likely the one for the point
+/// around which the parameters are varied, and it is kept in the cache.
+/// Otherwise, the current result is a transient one and gets overwritten.
+void Evaluator::computeCachedCPUNode(NodeInfo &info)
+{
+   auto matchesCurrentParams = [&](std::vector<double> const &values) {
+      for (std::size_t iVar = 0; iVar < info.variableInfos.size(); ++iVar) {
+         if (values[iVar] != info.variableInfos[iVar]->scalarBuffer)
+            return false;
+      }
+      return true;
+   };
+
+   if (info.cachedBuffer && matchesCurrentParams(info.cachedParamValues)) {
+      std::swap(info.buffer, info.cachedBuffer);
+      std::swap(info.paramValues, info.cachedParamValues);
+      _evalContextCPU.set(info.absArg, {info.buffer->hostReadPtr(), info.outputSize});
+      return;
+   }
+
+   if (info.buffer && info.lastComputed + 1 != _nEvaluations) {
+      std::swap(info.buffer, info.cachedBuffer);
+      std::swap(info.paramValues, info.cachedParamValues);
+   }
+   computeCPUNode(info.absArg, info);
+   info.lastComputed = _nEvaluations;
+   info.paramValues.clear();
+   for (NodeInfo const *varInfo : info.variableInfos) {
+      info.paramValues.push_back(varInfo->scalarBuffer);
+   }
+}
+
 /// Returns the value of the top node in the computation graph
 std::span<const double> Evaluator::run()
 {
@@ -427,7 +522,11 @@ std::span<const double> Evaluator::run()
          } else {
             if (nodeInfo.isDirty) {
                setClientsDirty(nodeInfo);
-               computeCPUNode(nodeInfo.absArg, nodeInfo);
+               if (nodeInfo.isCacheable) {
+                  computeCachedCPUNode(nodeInfo);
+               } else {
+                  computeCPUNode(nodeInfo.absArg, nodeInfo);
+               }
                nodeInfo.isDirty = false;
             }
          }
@@ -477,14 +576,20 @@ std::span<const double> Evaluator::getValHeterogeneous()
 
       // find next CPU node
       auto it = _nodes.begin();
+      NodeInfo *activeGPUNode = nullptr;
       for (; it != _nodes.end(); it++) {
          if (it->remServers == 0 && !it->computeInGPU())
             break;
+         if (it->remServers == -1 && !activeGPUNode)
+            activeGPUNode = &*it;
       }
 
-      // if no CPU node available sleep for a while to save CPU usage
+      // If no CPU node is available, block until a running GPU node is
+      // done. Waiting on the stream instead of sleeping for a fixed time
+      // avoids adding up to a millisecond of latency per evaluation.
       if (it == _nodes.end()) {
-         std::this_thread::sleep_for(std::chrono::milliseconds(1));
+         if (activeGPUNode)
+            RooBatchCompute::dispatchCUDA->cudaStreamSynchronize(activeGPUNode->stream);
          continue;
       }
 
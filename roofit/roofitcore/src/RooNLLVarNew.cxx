@@ -32,7 +32,6 @@ computation times.
 #include <RooConstVar.h>
 #include <RooRealVar.h>
 #include <RooSetProxy.h>
-#include <RooFit/Detail/MathFuncs.h>
 
 #include "RooFitImplHelpers.h"
 
@@ -42,6 +41,8 @@ computation times.
 #include <TMath.h>
 #include <Math/Util.h>
 
+#include <algorithm>
+#include <array>
 #include <numeric>
 #include <stdexcept>
 #include <vector>
@@ -210,30 +211,42 @@ void RooNLLVarNew::fillBinWidthsFromPdfBoundaries(RooAbsReal const &pdf, RooArgS
 void RooNLLVarNew::doEvalBinnedL(RooFit::EvalContext &ctx, std::span<const double> preds,
                                  std::span<const double> weights) const
 {
-   ROOT::Math::KahanSum<double> result{0.0};
-   ROOT::Math::KahanSum<double> sumWeightKahanSum{0.0};
-
    const bool predsAreYields = _binw.empty();
-
-   for (std::size_t i = 0; i < preds.size(); ++i) {
-
-      // Calculate log(Poisson(N|mu) for this bin
-      double N = weights[i];
-      double mu = preds[i];
-      if (!predsAreYields) {
-         mu *= _binw[i];
+   const std::size_t nBins = preds.size();
+
+   // The log-factorials of the observed weights only need to be computed again
+   // if the data changed
+   if (!std::equal(weights.begin(), weights.end(), _binnedLWeights.begin(), _binnedLWeights.end())) {
+      _binnedLWeights.assign(weights.begin(), weights.end());
+      _binnedLLnGammaWeights.resize(weights.size());
+      for (std::size_t i = 0; i < weights.size(); ++i) {
+         _binnedLLnGammaWeights[i] = TMath::LnGamma(weights[i] + 1);
       }
+      _binnedLSumWeight = ROOT::Math::KahanSum<double>::Accumulate(weights.begin(), weights.end()).Sum();
+   }
 
-      if (mu <= 0 && N > 0) {
+   // Calculate log(Poisson(N|mu)) for all bins in one vectorized pass
+   const double unitBinVolume = 1.0;
+   std::span<const double> binVolumes{predsAreYields ? &unitBinVolume : _binw.data(), predsAreYields ? 1 : nBins};
+   std::array<double, 1> extraArgs{static_cast<double>(_doBinOffset)};
+   _binnedLTerms.resize(nBins);
+   RooBatchCompute::compute(ctx.config(this), RooBatchCompute::BinnedPoissonNLL, _binnedLTerms,
+                            {preds, binVolumes, weights, _binnedLLnGammaWeights}, extraArgs);
+
+   double sumWeight = _binnedLSumWeight;
+   for (std::size_t i = 0; i < nBins; ++i) {
+      const double mu = predsAreYields ? preds[i] : preds[i] * _binw[i];
+      if (mu <= 0 && weights[i] > 0) {
          // Catch error condition: data present where zero events are predicted
-         logEvalError(Form("Observed %f events in bin %lu with zero event yield", N, (unsigned long)i));
-      } else {
-         result += RooFit::Detail::MathFuncs::nll(mu, N, true, _doBinOffset);
-         sumWeightKahanSum += N;
+         logEvalError(Form("Observed %f events in bin %lu with zero event yield", weights[i], (unsigned long)i));
+         _binnedLTerms[i] = 0.0;
+         sumWeight -= weights[i];
       }
    }
 
-   finalizeResult(ctx, result, sumWeightKahanSum.Sum());
+   const double result = RooBatchCompute::reduceSum(ctx.config(this), _binnedLTerms.data(), nBins);
+
+   finalizeResult(ctx, ROOT::Math::KahanSum<double>{result}, sumWeight);
 }
 
 void RooNLLVarNew::doEval(RooFit::EvalContext &ctx) const
@@ -76,6 +76,10 @@ private:
    std::string _prefix;
    std::vector<double> _binw;
    mutable ROOT::Math::KahanSum<double> _offset{0.}; ///<! Offset as KahanSum to avoid loss of precision
+   mutable std::vector<double> _binnedLWeights;        ///<! Observed weights of the binned likelihood
+   mutable std::vector<double> _binnedLLnGammaWeights; ///<! Log-factorials of the observed weights
+   mutable double _binnedLSumWeight = 0.0;             ///<! Sum of the observed weights
+   mutable std::vector<double> _binnedLTerms;          ///<! Likelihood terms of each bin
 
 }; // end class RooNLLVar
 
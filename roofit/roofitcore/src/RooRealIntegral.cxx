@@ -276,6 +276,7 @@ void fillAnIntOKDepList(RooAbsReal const &function, RooArgSet const &intDeps, Ro
 } // namespace
 
 Int_t RooRealIntegral::_cacheAllNDim(2) ;
+std::size_t RooRealIntegral::_numIntCacheSize(16) ;
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -787,6 +788,7 @@ double RooRealIntegral::getValV(const RooArgSet* nset) const
   if (nset && nset->uniqueId().value() != _lastNormSetId) {
     const_cast<RooRealIntegral*>(this)->setProxyNormSet(nset);
     _lastNormSetId = nset->uniqueId().value();
+    _numIntCache.clear();
   }
 
   if (isValueOrShapeDirtyAndClear()) {
@@ -814,9 +816,20 @@ double RooRealIntegral::evaluate() const
         cacheVal = static_cast<RooDouble const*>(expensiveObjectCache().retrieveObject(GetName(),RooDouble::Class(),parameters()))  ;
       }
 
+      // Look up the results of the most recent numeric integrations, which
+      // are often repeated when the minimizer moves parameters back and forth
+      const bool useNumIntCache = _numIntCacheSize > 0 && !_intList.empty();
+      double const* recentVal(nullptr) ;
+      if (!cacheVal && useNumIntCache) {
+        fillNumIntCacheKey() ;
+        recentVal = findNumIntCacheEntry() ;
+      }
+
       if (cacheVal) {
         retVal = *cacheVal ;
    // cout << "using cached value of integral" << GetName() << std::endl ;
+      } else if (recentVal) {
+        retVal = *recentVal ;
       } else {
 
 
@@ -847,6 +860,10 @@ double RooRealIntegral::evaluate() const
         _intList.assign(_saveInt) ;
         _sumList.assign(_saveSum) ;
 
+        if (useNumIntCache) {
+          addNumIntCacheEntry(retVal) ;
+        }
+
         // Cache numeric integrals in >1d expensive object cache
         if ((_cacheNum && !_intList.empty()) || int(_intList.size())>=_cacheAllNDim) {
           RooDouble* val = new RooDouble(retVal) ;
@@ -990,6 +1007,7 @@ bool RooRealIntegral::redirectServersHook(const RooAbsCollection& newServerList,
 
   // Delete parameters cache if we have one
   _params.reset();
+  _numIntCache.clear();
 
   return RooAbsReal::redirectServersHook(newServerList, mustReplaceAll, nameChange, isRecursive);
 }
@@ -1175,6 +1193,78 @@ Int_t RooRealIntegral::getCacheAllNumeric()
    return _cacheAllNDim;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Global switch to set how many results of numeric integrations are cached
+/// by each integral, together with the values of the parameters and the
+/// integration ranges they were computed for. An integral is not integrated
+/// again at a point of this cache, e.g. when the minimizer goes back to a
+/// previous parameter point after computing numerical derivatives. Use zero to
+/// disable this cache.
+
+void RooRealIntegral::setNumIntCacheSize(std::size_t size)
+{
+   _numIntCacheSize = size;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return how many results of numeric integrations are cached by each integral.
+
+std::size_t RooRealIntegral::getNumIntCacheSize()
+{
+   return _numIntCacheSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the key of the numeric integration cache for the current parameter
+/// values and integration ranges.
+
+void RooRealIntegral::fillNumIntCacheKey() const
+{
+   _numIntCacheKey.clear();
+   for (RooAbsArg *param : parameters()) {
+      if (auto real = dynamic_cast<RooAbsReal const *>(param)) {
+         _numIntCacheKey.push_back(real->getVal());
+      } else if (auto cat = dynamic_cast<RooAbsCategory const *>(param)) {
+         _numIntCacheKey.push_back(cat->getCurrentIndex());
+      }
+   }
+   for (RooAbsArg *arg : _intList) {
+      auto var = static_cast<RooAbsRealLValue const *>(arg);
+      _numIntCacheKey.push_back(var->getMin(intRange()));
+      _numIntCacheKey.push_back(var->getMax(intRange()));
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the cached result of the numeric integration for the current key,
+/// or a nullptr if this point is not in the cache.
+
+double const *RooRealIntegral::findNumIntCacheEntry() const
+{
+   for (NumIntCacheEntry const &entry : _numIntCache) {
+      if (entry.key == _numIntCacheKey)
+         return &entry.value;
+   }
+   return nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Store the result of a numeric integration for the current key, replacing
+/// the oldest entry if the cache is full.
+
+void RooRealIntegral::addNumIntCacheEntry(double value) const
+{
+   if (_numIntCache.size() < _numIntCacheSize) {
+      _numIntCache.push_back({_numIntCacheKey, value});
+      return;
+   }
+   if (_numIntCacheNext >= _numIntCache.size())
+      _numIntCacheNext = 0;
+   NumIntCacheEntry &entry = _numIntCache[_numIntCacheNext++];
+   entry.key = _numIntCacheKey;
+   entry.value = value;
+}
+
 std::unique_ptr<RooAbsArg>
 RooRealIntegral::compileForNormSet(RooArgSet const &normSet, RooFit::Detail::CompileContext &ctx) const
 {
@@ -2683,6 +2683,11 @@ UInt_t crc32(const char* data)
 
 bool RooWorkspace::CodeRepo::compileClasses()
 {
+  // Most workspaces embed no class code, so don't even format the export directory name
+  if (_c2fmap.empty()) {
+    return true ;
+  }
+
   bool haveDir=false ;
 
   // Retrieve name of directory in which to export code files
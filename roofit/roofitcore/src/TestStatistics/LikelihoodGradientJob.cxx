@@ -22,6 +22,9 @@
 
 #include "Minuit2/MnStrategy.h"
 
+#include <algorithm>
+#include <cstring> // memcpy
+
 namespace RooFit {
 namespace TestStatistics {
 
@@ -35,6 +38,9 @@ LikelihoodGradientJob::LikelihoodGradientJob(std::shared_ptr<RooAbsL> likelihood
 {
    minuit_internal_x_.reserve(N_dim);
    offsets_previous_ = shared_offset_.offsets();
+   // Jobs are created before the worker processes are forked, so the workers inherit this mapping
+   shared_state_ = std::make_unique<MultiProcess::SharedState>(
+      sizeof(std::size_t) + N_dim * (sizeof(ROOT::Minuit2::DerivatorElement) + sizeof(double)));
 }
 
 void LikelihoodGradientJob::synchronizeParameterSettings(
@@ -118,23 +124,32 @@ bool LikelihoodGradientJob::receive_task_result_on_master(const zmq::message_t &
 
 void LikelihoodGradientJob::update_workers_state()
 {
-   // TODO optimization: only send changed parameters (now sending all)
-   zmq::message_t gradient_message(grad_.begin(), grad_.end());
-   zmq::message_t minuit_internal_x_message(minuit_internal_x_.begin(), minuit_internal_x_.end());
+   // The gradient and parameter values, which scale with the number of
+   // parameters, go through shared memory. Only the notification of the new
+   // state and the scalar settings are published over ZeroMQ. The master
+   // writes the next state only after all tasks of the current one are done,
+   // so workers always find the state of the tasks they receive.
+   assert(minuit_internal_x_.size() <= N_tasks_);
+   shared_state_->write([&](void *data) {
+      const std::size_t N_x = minuit_internal_x_.size();
+      auto out = static_cast<char *>(data);
+      std::memcpy(out, &N_x, sizeof(std::size_t));
+      out += sizeof(std::size_t);
+      std::memcpy(out, grad_.data(), grad_.size() * sizeof(ROOT::Minuit2::DerivatorElement));
+      out += grad_.size() * sizeof(ROOT::Minuit2::DerivatorElement);
+      std::memcpy(out, minuit_internal_x_.data(), N_x * sizeof(double));
+   });
    double maxFCN = minimizer_->maxFCN();
    double fcnOffset = minimizer_->fcnOffset();
    ++state_id_;
 
    if (shared_offset_.offsets() != offsets_previous_) {
       zmq::message_t offsets_message(shared_offset_.offsets().begin(), shared_offset_.offsets().end());
-      get_manager()->messenger().publish_from_master_to_workers(
-         id_, state_id_, isCalculating_, maxFCN, fcnOffset, std::move(gradient_message),
-         std::move(minuit_internal_x_message), std::move(offsets_message));
+      get_manager()->messenger().publish_from_master_to_workers(id_, state_id_, isCalculating_, maxFCN, fcnOffset,
+                                                                std::move(offsets_message));
       offsets_previous_ = shared_offset_.offsets();
    } else {
-      get_manager()->messenger().publish_from_master_to_workers(id_, state_id_, isCalculating_, maxFCN, fcnOffset,
-                                                                std::move(gradient_message),
-                                                                std::move(minuit_internal_x_message));
+      get_manager()->messenger().publish_from_master_to_workers(id_, state_id_, isCalculating_, maxFCN, fcnOffset);
    }
 }
 
@@ -159,20 +174,19 @@ void LikelihoodGradientJob::update_state()
 
       auto fcnOffset = get_manager()->messenger().receive_from_master_on_worker<double>(&more);
       minimizer_->fcnOffset() = fcnOffset;
-      assert(more);
 
-      auto gradient_message = get_manager()->messenger().receive_from_master_on_worker<zmq::message_t>(&more);
-      assert(more);
-      auto gradient_message_begin = gradient_message.data<ROOT::Minuit2::DerivatorElement>();
-      auto gradient_message_end =
-         gradient_message_begin + gradient_message.size() / sizeof(ROOT::Minuit2::DerivatorElement);
-      std::copy(gradient_message_begin, gradient_message_end, grad_.begin());
-
-      auto minuit_internal_x_message = get_manager()->messenger().receive_from_master_on_worker<zmq::message_t>(&more);
-      auto minuit_internal_x_message_begin = minuit_internal_x_message.data<double>();
-      auto minuit_internal_x_message_end =
-         minuit_internal_x_message_begin + minuit_internal_x_message.size() / sizeof(double);
-      std::copy(minuit_internal_x_message_begin, minuit_internal_x_message_end, minuit_internal_x_.begin());
+      minuit_internal_x_.resize(N_tasks_);
+      std::size_t N_x = 0;
+      shared_state_->read([&](const void *data) {
+         auto in = static_cast<const char *>(data);
+         std::memcpy(&N_x, in, sizeof(std::size_t));
+         in += sizeof(std::size_t);
+         std::memcpy(grad_.data(), in, grad_.size() * sizeof(ROOT::Minuit2::DerivatorElement));
+         in += grad_.size() * sizeof(ROOT::Minuit2::DerivatorElement);
+         // the size is checked because it may be torn, in which case the read is repeated
+         std::memcpy(minuit_internal_x_.data(), in, std::min(N_x, N_tasks_) * sizeof(double));
+      });
+      minuit_internal_x_.resize(N_x);
 
       if (more) {
          // offsets also incoming
@@ -14,12 +14,14 @@
 #define ROOT_ROOFIT_TESTSTATISTICS_LikelihoodGradientJob
 
 #include "RooFit/MultiProcess/Job.h"
+#include "RooFit/MultiProcess/SharedState.h"
 #include "RooFit/TestStatistics/LikelihoodGradientWrapper.h"
 
 #include "Math/MinimizerOptions.h"
 #include "Minuit2/NumericalDerivator.h"
 #include "Minuit2/MnMatrix.h"
 
+#include <memory>
 #include <vector>
 
 namespace RooFit {
@@ -87,6 +89,9 @@ private:
    mutable bool isCalculating_ = false;
 
    SharedOffset::OffsetVec offsets_previous_;
+
+   // gradient and parameter values, written by the master for the workers
+   std::unique_ptr<MultiProcess::SharedState> shared_state_;
 };
 
 } // namespace TestStatistics
@@ -0,0 +1,63 @@
+// Tests for the RooFit::Evaluator
+
+#include <RooAddition.h>
+#include <RooFit/Detail/NormalizationHelpers.h>
+#include <RooFit/Evaluator.h>
+#include <RooFormulaVar.h>
+#include <RooRealVar.h>
+
+#include "gtest_wrapper.h"
+
+#include <memory>
+#include <vector>
+
+/// Check that the results of nodes that are restored from the cache of the
+/// Evaluator are correct, when the parameters are varied like in a numerical
+/// derivative computation.
+TEST(Evaluator, RestoreCachedResults)
+{
+   RooRealVar x{"x", "x", 0.0, -10, 10};
+   RooRealVar a{"a", "a", 2.0, -10, 10};
+   RooRealVar b{"b", "b", 3.0, -10, 10};
+   RooRealVar c{"c", "c", 4.0, -10, 10};
+
+   RooFormulaVar fa{"fa", "x * a", {x, a}};
+   RooFormulaVar fb{"fb", "x * x * b", {x, b}};
+   RooFormulaVar fc{"fc", "x * x * x * c", {x, c}};
+   RooAddition sum{"sum", "sum", {fa, fb, fc}};
+
+   std::vector<double> xVals{-2.0, -1.0, 0.5, 1.5, 3.0};
+
+   std::unique_ptr<RooAbsReal> compiled = RooFit::Detail::compileForNormSet<RooAbsReal>(sum, {x});
+   RooFit::Evaluator evaluator{*compiled};
+   evaluator.setInput(x.GetName(), xVals, false);
+
+   auto checkValues = [&](std::span<const double> results) {
+      ASSERT_EQ(results.size(), xVals.size());
+      for (std::size_t i = 0; i < xVals.size(); ++i) {
+         x.setVal(xVals[i]);
+         EXPECT_DOUBLE_EQ(results[i], sum.getVal()) << "a = " << a.getVal() << ", b = " << b.getVal()
+                                                    << ", c = " << c.getVal() << ", x = " << xVals[i];
+      }
+   };
+
+   checkValues(evaluator.run());
+
+   // Vary the parameters up and down around their central values, one after the other.
+   for (int iStep = 0; iStep < 2; ++iStep) {
+      for (RooRealVar *param : {&a, &b, &c}) {
+         const double central = param->getVal();
+         param->setVal(central + 0.1);
+         checkValues(evaluator.run());
+         param->setVal(central - 0.1);
+         checkValues(evaluator.run());
+         param->setVal(central);
+      }
+      checkValues(evaluator.run());
+
+      // move to a new point, like the minimizer would do after computing the gradient
+      a.setVal(a.getVal() + 0.5);
+      b.setVal(b.getVal() - 0.5);
+      checkValues(evaluator.run());
+   }
+}
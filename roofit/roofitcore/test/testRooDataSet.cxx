@@ -6,12 +6,16 @@
 #include <RooCategory.h>
 #include <RooDataHist.h>
 #include <RooDataSet.h>
+#include <RooFit/Detail/BatchModeDataHelpers.h>
 #include <RooHelpers.h>
+#include <RooNameReg.h>
 #include <RooRealVar.h>
 #include <RooStringVar.h>
 #include <RooVectorDataStore.h>
 #include <RooWorkspace.h>
 
+#include "../src/RooNLLVarNew.h"
+
 #include <TChain.h>
 #include <TCut.h>
 #include <TFile.h>
@@ -22,6 +26,8 @@
 
 #include <fstream>
 #include <memory>
+#include <stack>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -484,3 +490,35 @@ TEST(RooDataSet,RooStringVarStorage) {
    ASSERT_STREQ(dataClone.get(1)->getStringValue("str"),"str2");
 
 }
+
+// The data spans for the likelihood evaluation should not copy the dataset
+// unless entries are skipped.
+TEST(RooDataSet, DataSpansWithoutCopy)
+{
+   RooRealVar x("x", "x", 0, 10);
+   RooRealVar w("w", "w", 0, 10);
+   RooDataSet data("data", "data", {x, w}, RooFit::WeightVar(w));
+   for (int i = 0; i < 10; ++i) {
+      x.setVal(i);
+      data.add(x, i % 2 == 0 ? 0.0 : 1.0);
+   }
+
+   const double *xMemory = data.getBatches(0, data.numEntries()).at(&x).data();
+   const double *weightMemory = data.getWeightBatch(0, data.numEntries(), /*sumW2=*/false).data();
+
+   std::stack<std::vector<double>> buffers;
+   auto spans = RooFit::Detail::BatchModeDataHelpers::getDataSpans(data, "", nullptr, /*skipZeroWeights=*/false,
+                                                                   /*takeGlobalObservablesFromData=*/false, buffers);
+   EXPECT_EQ(spans.at(&x).data(), xMemory);
+   EXPECT_EQ(spans.at(RooNameReg::ptr(RooNLLVarNew::weightVarName)).data(), weightMemory);
+
+   // skipping the entries with zero weight requires a copy
+   std::stack<std::vector<double>> buffersSkipped;
+   auto spansSkipped = RooFit::Detail::BatchModeDataHelpers::getDataSpans(
+      data, "", nullptr, /*skipZeroWeights=*/true, /*takeGlobalObservablesFromData=*/false, buffersSkipped);
+   ASSERT_EQ(spansSkipped.at(&x).size(), 5u);
+   EXPECT_NE(spansSkipped.at(&x).data(), xMemory);
+   for (std::size_t i = 0; i < 5; ++i) {
+      EXPECT_DOUBLE_EQ(spansSkipped.at(&x)[i], 2.0 * i + 1);
+   }
+}
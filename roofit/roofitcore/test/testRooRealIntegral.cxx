@@ -21,6 +21,7 @@
 
 #include "gtest_wrapper.h"
 
+#include <cmath>
 #include <memory>
 
 namespace {
@@ -32,6 +33,33 @@ RooArgList getSortedServers(RooAbsArg const &arg)
    servers.sort();
    return servers;
 }
+
+// A function without analytical integral that counts how often it is evaluated.
+class CountingFunction : public RooAbsReal {
+public:
+   CountingFunction(const char *name, RooAbsReal &x, RooAbsReal &a)
+      : RooAbsReal(name, name), _x("x", "x", this, x), _a("a", "a", this, a)
+   {
+   }
+   CountingFunction(const CountingFunction &other, const char *name = nullptr)
+      : RooAbsReal(other, name), _x("x", this, other._x), _a("a", this, other._a), _nEval(other._nEval)
+   {
+   }
+   TObject *clone(const char *newname) const override { return new CountingFunction(*this, newname); }
+   int nEval() const { return *_nEval; }
+
+protected:
+   double evaluate() const override
+   {
+      ++*_nEval;
+      return std::exp(-_a * _x * _x);
+   }
+
+private:
+   RooRealProxy _x;
+   RooRealProxy _a;
+   std::shared_ptr<int> _nEval = std::make_shared<int>(0);
+};
 } // namespace
 
 // Verify that the value servers of a RooRealIntegral are the direct
@@ -410,3 +438,33 @@ TEST(RooRealIntegral, GaussianWithSigmaDependingOnX)
 
    EXPECT_EQ(val1, val2);
 }
+
+// Make sure that the results of recent numeric integrations are reused when
+// going back to a previous parameter point, but not after changing the
+// integration range.
+TEST(RooRealIntegral, NumIntCache)
+{
+   RooRealVar x("x", "x", 0., 1.);
+   RooRealVar a("a", "a", 1., 0., 10.);
+   CountingFunction func("func", x, a);
+
+   std::unique_ptr<RooAbsReal> integral{func.createIntegral(x)};
+   ASSERT_FALSE(static_cast<RooRealIntegral &>(*integral).numIntRealVars().empty());
+
+   const double val1 = integral->getVal();
+   const int nEval1 = func.nEval();
+   EXPECT_GT(nEval1, 0);
+
+   a.setVal(2.);
+   EXPECT_NE(integral->getVal(), val1);
+   const int nEval2 = func.nEval();
+   EXPECT_GT(nEval2, nEval1);
+
+   a.setVal(1.);
+   EXPECT_EQ(integral->getVal(), val1);
+   EXPECT_EQ(func.nEval(), nEval2);
+
+   x.setMax(0.5);
+   EXPECT_LT(integral->getVal(), val1);
+   EXPECT_GT(func.nEval(), nEval2);
+}
@@ -25,6 +25,7 @@
 #include <RooWorkspace.h>
 
 #include <TMath.h>
+#include <TROOT.h>
 
 #include "gtest_wrapper.h"
 
@@ -793,3 +794,71 @@ TEST(CreateNLL, CombineStyleConstraints)
    const double refNllVal = -nChannels * (std::log(proba / nChannels) + std::log(proba));
    EXPECT_FLOAT_EQ(nll->getVal(), refNllVal);
 }
+
+// Verify the binned likelihood code path against the sum of the Poisson terms
+// of all bins, with and without bin offsetting. The empty data bin only
+// contributes its expected yield.
+TEST(NLL, BinnedLikelihoodPoissonTerms)
+{
+   using namespace RooFit;
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   const std::vector<double> expected{5., 10., 3., 8.};
+   const std::vector<double> observed{4., 12., 0., 8.};
+
+   RooRealVar x("x", "x", 0, expected.size());
+   x.setBins(expected.size());
+
+   RooDataHist templateHist("template_hist", "template_hist", x);
+   RooDataHist data("data", "data", x);
+   for (std::size_t i = 0; i < expected.size(); ++i) {
+      templateHist.set(i, expected[i], -1);
+      data.set(i, observed[i], -1);
+   }
+
+   RooHistFunc histFunc{"hist_func", "hist_func", x, templateHist};
+   RooRealSumPdf pdf{"pdf", "pdf", histFunc, RooArgList{1.0}};
+   pdf.setAttribute("BinnedLikelihood");
+
+   std::unique_ptr<RooAbsReal> nll{pdf.createNLL(data, EvalBackend::Cpu())};
+   std::unique_ptr<RooAbsReal> nllBinOffset{pdf.createNLL(data, Offset("bin"), EvalBackend::Cpu())};
+
+   double refVal = 0.0;
+   double refValBinOffset = 0.0;
+   for (std::size_t i = 0; i < expected.size(); ++i) {
+      const double mu = expected[i];
+      const double n = observed[i];
+      refVal += mu - n * std::log(mu) + std::lgamma(n + 1);
+      refValBinOffset += n > 0 ? mu - n - n * std::log(mu / n) : mu;
+   }
+
+   EXPECT_NEAR(nll->getVal(), refVal, 1e-10 * std::abs(refVal));
+   EXPECT_NEAR(nllBinOffset->getVal(), refValBinOffset, 1e-10 * std::abs(refValBinOffset));
+}
+
+#ifdef R__USE_IMT
+// With implicit multi-threading enabled, the CPU backend evaluates large
+// batches and the NLL reduction in parallel. The result has to be the same as
+// for the sequential evaluation, up to the different order of summation.
+TEST(NLL, ImplicitMT)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooWorkspace workspace;
+   workspace.factory("Gaussian::pdf(x[-10, 10], mu[0.5, -10, 10], sigma[2.0, 0.1, 10])");
+   RooAbsPdf &pdf = *workspace.pdf("pdf");
+   RooRealVar &x = *workspace.var("x");
+
+   std::unique_ptr<RooDataSet> data{pdf.generate(x, 200000)};
+
+   std::unique_ptr<RooAbsReal> nllSequential{pdf.createNLL(*data, RooFit::EvalBackend::Cpu())};
+   const double refVal = nllSequential->getVal();
+
+   ROOT::EnableImplicitMT(4);
+   std::unique_ptr<RooAbsReal> nllParallel{pdf.createNLL(*data, RooFit::EvalBackend::Cpu())};
+   const double val = nllParallel->getVal();
+   ROOT::DisableImplicitMT();
+
+   EXPECT_NEAR(val, refVal, 1e-10 * std::abs(refVal));
+}
+#endif
@@ -146,6 +146,10 @@ public:
    /// set numerical error in test statistic evaluation (default is zero)
    void SetNumErr(double err) { fNumErr = err; }
 
+   /// Run the points of a fixed scan in this number of forked processes
+   /// (0 or 1 for a serial scan). Not available on Windows.
+   void SetNWorkers(unsigned int nWorkers) { fNWorkers = nWorkers; }
+
    /// set flag to close proof for every new run
    static void SetCloseProof(bool flag);
 
@@ -167,6 +171,8 @@ protected:
    static RooRealVar * GetVariableToScan(const HypoTestCalculatorGeneric &hc);
    static void CheckInputModels(const HypoTestCalculatorGeneric &hc, const RooRealVar & scanVar);
 
+   bool RunFixedScanMultiProcess(std::vector<double> const &xValues) const;
+
 private:
 
 
@@ -199,6 +205,7 @@ private:
    double fXmin;
    double fXmax;
    double fNumErr;
+   unsigned int fNWorkers = 1; ///<! number of forked processes for the fixed scan
 
 protected:
 
@@ -97,6 +97,12 @@ namespace RooStats {
       virtual void SetNumBurnInSteps(Int_t numBurnInSteps)
       { fNumBurnInSteps = numBurnInSteps; }
 
+      /// set the number of independent Markov chains, run in parallel
+      /// processes. The iterations are shared between the chains, and
+      /// the burn-in steps are discarded from each of them.
+      virtual void SetNumChains(UInt_t numChains)
+      { fNumChains = numChains; }
+
       /// set the number of bins to create for each axis when constructing the interval
       virtual void SetNumBins(Int_t numBins) { fNumBins = numBins; }
       /// set which variables to put on each axis
@@ -175,6 +181,7 @@ namespace RooStats {
       RooAbsData * fData;    ///< pointer to the data (owned by the workspace)
       Int_t fNumIters = 0;   ///< number of iterations to run metropolis algorithm
       Int_t fNumBurnInSteps = 0; ///< number of iterations to discard as burn-in, starting from the first
+      UInt_t fNumChains = 1;     ///<! number of Markov chains run in parallel processes
       Int_t fNumBins = 0;        ///< set the number of bins to create for each
                                  ///< axis when constructing the interval
       RooArgList * fAxes;    ///< which variables to put on each axis
@@ -56,6 +56,10 @@ namespace RooStats {
       /// starting from the first
       virtual void SetNumBurnInSteps(Int_t numBurnInSteps)
       { fNumBurnInSteps = numBurnInSteps; }
+      /// set the number of independent chains, each run in its own forked
+      /// process and sharing the total number of iterations
+      virtual void SetNumChains(UInt_t numChains)
+      { fNumChains = numChains; }
       /// set the (likelihood) function
       virtual void SetFunction(RooAbsReal& function) { fFunction = &function; }
       /// set the sign of the function
@@ -73,11 +77,14 @@ namespace RooStats {
       Int_t fNumBurnInSteps = 0;             ///< number of iterations to discard as burn-in, starting from the first
       enum FunctionSign fSign = kSignUnset;  ///< whether the likelihood is negative (like NLL) or positive
       enum FunctionType fType = kTypeUnset;  ///< whether the likelihood is on a regular, log, (or other) scale
+      UInt_t fNumChains = 1;                 ///<! number of chains run in parallel processes
 
       // whether we should take the step, based on the value of d, fSign, fType
       virtual bool ShouldTakeStep(double d);
       virtual double CalcNLL(double xL);
 
+      MarkovChain *ConstructChainsMultiProcess();
+
       ClassDefOverride(MetropolisHastings,2) // Markov Chain Monte Carlo calculator for Bayesian credible intervals
    };
 }
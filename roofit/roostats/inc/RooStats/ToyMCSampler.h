@@ -229,6 +229,11 @@ class ToyMCSampler: public TestStatSampler {
       /// calling with argument or nullptr deactivates proof
       void SetProofConfig(ProofConfig *pc = nullptr) { fProofConfig = pc; }
 
+      /// Run the toys in this number of forked processes when no ProofConfig is set
+      /// (0 or 1 for a serial run). Not available on Windows.
+      void SetNWorkers(unsigned int nWorkers) { fNWorkers = nWorkers; }
+      unsigned int GetNWorkers() const { return fNWorkers; }
+
       void SetProtoData(const RooDataSet* d) { fProtoData = d; }
 
    protected:
@@ -241,6 +246,8 @@ class ToyMCSampler: public TestStatSampler {
       /// helper method for clearing  the cache
       virtual void ClearCache();
 
+      RooDataSet *GetSamplingDistributionsMultiProcess(RooArgSet &paramPoint);
+
 
       /// densities, snapshots, and test statistics to reweight to
       RooAbsPdf *fPdf = nullptr; ///< model (can be alt or null)
@@ -275,6 +282,7 @@ class ToyMCSampler: public TestStatSampler {
       const RooDataSet *fProtoData = nullptr; ///< in dev
 
       ProofConfig *fProofConfig = nullptr; ///<!
+      unsigned int fNWorkers = 1;          ///<! number of forked processes for local parallel runs
 
       mutable NuisanceParametersSampler *fNuisanceParametersSampler = nullptr; ///<!
 
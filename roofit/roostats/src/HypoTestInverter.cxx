@@ -55,6 +55,7 @@ call HypoTestInverter::UseCLs().
 #include "RooMsgService.h"
 
 #include "TMath.h"
+#include "TROOT.h"
 #include "TF1.h"
 #include "TFile.h"
 #include "TH1.h"
@@ -64,9 +65,16 @@ call HypoTestInverter::UseCLs().
 
 #include "RooStats/ProofConfig.h"
 
+#ifndef R__WIN32
+#include "ROOT/TProcessExecutor.hxx"
+#endif
+
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <limits>
 #include <memory>
+#include <vector>
 
 ClassImp(RooStats::HypoTestInverter);
 
@@ -408,6 +416,7 @@ HypoTestInverter & HypoTestInverter::operator= (const HypoTestInverter & rhs) {
    fXmin = rhs.fXmin;
    fXmax = rhs.fXmax;
    fNumErr = rhs.fNumErr;
+   fNWorkers = rhs.fNWorkers;
 
    return *this;
 }
@@ -648,6 +657,7 @@ bool HypoTestInverter::RunFixedScan( int nBins, double xMin, double xMax, bool s
      return false;
    }
 
+   std::vector<double> xValues(nBins);
    double thisX = xMin;
    for (int i=0; i<nBins; i++) {
 
@@ -658,16 +668,106 @@ bool HypoTestInverter::RunFixedScan( int nBins, double xMin, double xMax, bool s
             thisX = xMin + i * (xMax - xMin) / (nBins - 1); // linear scan in x
       }
       }
+      xValues[i] = thisX;
+   }
+
+   if (fNWorkers > 1 && nBins > 1)
+      return RunFixedScanMultiProcess(xValues);
 
-      const bool status = RunOnePoint(thisX);
+   for (double x : xValues) {
+
+      const bool status = RunOnePoint(x);
 
       // check if failed status
       if ( status==false ) {
-        oocoutW(nullptr,Eval) << "HypoTestInverter::RunFixedScan - The hypo test for point " << thisX << " failed. Skipping." << std::endl;
+        oocoutW(nullptr,Eval) << "HypoTestInverter::RunFixedScan - The hypo test for point " << x << " failed. Skipping." << std::endl;
+      }
+   }
+
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Run the points of a fixed scan in fNWorkers forked processes.
+/// Each worker runs a contiguous block of neighbouring points in the same
+/// order as the serial scan, so the fits of a point start from the parameter
+/// values left by its neighbour. The workers are seeded with
+/// distinct seeds drawn from RooRandom in the parent process, and their
+/// results are merged in the order of the scanned values.
+
+bool HypoTestInverter::RunFixedScanMultiProcess(std::vector<double> const &xValues) const
+{
+   auto runSerial = [&]() {
+      for (double thisX : xValues) {
+         if (!RunOnePoint(thisX)) {
+            oocoutW(nullptr,Eval) << "HypoTestInverter::RunFixedScan - The hypo test for point " << thisX << " failed. Skipping." << std::endl;
+         }
+      }
+      return true;
+   };
+
+#ifdef R__WIN32
+   oocoutW(nullptr,Eval) << "HypoTestInverter::RunFixedScan - running the scan in several processes is not "
+                         << "supported on Windows, falling back to a serial scan." << std::endl;
+   return runSerial();
+#else
+   if (ROOT::IsImplicitMTEnabled()) {
+      oocoutW(nullptr,Eval) << "HypoTestInverter::RunFixedScan - implicit multi-threading must be disabled to run "
+                            << "the scan in several processes, falling back to a serial scan." << std::endl;
+      return runSerial();
+   }
+
+   const unsigned int nWorkers = std::min<std::size_t>(fNWorkers, xValues.size());
+   std::vector<UInt_t> seeds(nWorkers);
+   for (auto &seed : seeds)
+      seed = RooRandom::randomGenerator()->Integer(TMath::Limits<unsigned int>::Max());
+
+   // the workers are forked: changing the state of the inverter and of
+   // RooRandom there has no effect on the parent process
+   auto runWorker = [&](unsigned int iWorker) {
+      RooRandom::randomGenerator()->SetSeed(seeds[iWorker]);
+      // start from an empty result, which is merged into the result of the parent
+      delete fResults;
+      fResults = nullptr;
+      CreateResults();
+      const std::size_t begin = iWorker * xValues.size() / nWorkers;
+      const std::size_t end = (iWorker + 1) * xValues.size() / nWorkers;
+      for (std::size_t i = begin; i < end; ++i) {
+         if (!RunOnePoint(xValues[i])) {
+            oocoutW(nullptr,Eval) << "HypoTestInverter::RunFixedScan - The hypo test for point " << xValues[i] << " failed. Skipping." << std::endl;
+         }
+      }
+      return fResults;
+   };
+
+   ROOT::TProcessExecutor pool(nWorkers);
+   std::vector<HypoTestInverterResult *> outputs = pool.Map(runWorker, ROOT::TSeqU(nWorkers));
+   std::vector<std::unique_ptr<HypoTestInverterResult>> workerResults;
+   for (HypoTestInverterResult *output : outputs) {
+      if (output)
+         workerResults.emplace_back(output);
+   }
+   if (workerResults.size() != nWorkers) {
+      oocoutW(nullptr,Eval) << "HypoTestInverter::RunFixedScan - only " << workerResults.size() << " of " << nWorkers
+                            << " workers returned a result." << std::endl;
+   }
+
+   // the workers return in the order in which they complete
+   auto firstX = [](std::unique_ptr<HypoTestInverterResult> const &r) {
+      return r->ArraySize() > 0 ? r->GetXValue(0) : std::numeric_limits<double>::infinity();
+   };
+   std::sort(workerResults.begin(), workerResults.end(),
+             [&](auto const &a, auto const &b) { return firstX(a) < firstX(b); });
+
+   for (auto const &workerResult : workerResults) {
+      if (!fResults->Add(*workerResult)) {
+         oocoutE(nullptr,Eval) << "HypoTestInverter::RunFixedScan - could not merge the results of a worker" << std::endl;
+         return false;
       }
    }
 
    return true;
+#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -183,6 +183,8 @@ MCMCInterval* MCMCCalculator::GetInterval() const
    if (!fChainParams.empty()) mh.SetChainParameters(fChainParams);
    mh.SetProposalFunction(*fPropFunc);
    mh.SetNumIters(fNumIters);
+   mh.SetNumBurnInSteps(fNumBurnInSteps);
+   mh.SetNumChains(fNumChains);
 
    MarkovChain* chain = mh.ConstructChain();
 
@@ -38,6 +38,13 @@ a MarkovChain.
 Also note that in ConstructChain(), the values of the variables are randomized
 uniformly over their intervals before construction of the MarkovChain begins.
 
+With SetNumChains(), several independent chains are constructed in parallel,
+each in a forked process with its own random seed and its share of the
+iterations. They are concatenated into the returned MarkovChain. The first
+burn-in steps of all but the first chain are discarded when merging, so that
+the burn-in of the MCMCInterval, which is applied to the start of the
+merged chain, takes care of the first one.
+
 */
 
 #include "RooStats/MetropolisHastings.h"
@@ -56,6 +63,15 @@ uniformly over their intervals before construction of the MarkovChain begins.
 #include "RooMsgService.h"
 #include "RooRandom.h"
 #include "TMath.h"
+#include "TROOT.h"
+
+#ifndef R__WIN32
+#include "ROOT/TProcessExecutor.hxx"
+#endif
+
+#include <algorithm>
+#include <memory>
+#include <vector>
 
 ClassImp(RooStats::MetropolisHastings);
 
@@ -91,6 +107,9 @@ MarkovChain* MetropolisHastings::ConstructChain()
 
    if (fChainParams.empty()) fChainParams.add(fParameters);
 
+   if (fNumChains > 1)
+      return ConstructChainsMultiProcess();
+
    RooArgSet x;
    RooArgSet xPrime;
    x.addClone(fParameters);
@@ -170,7 +189,7 @@ MarkovChain* MetropolisHastings::ConstructChain()
       hadEvalError = false;
 
       // print a dot every 1% of the chain construction
-      if (i % (fNumIters / 100) == 0) ooccoutP((TObject*)nullptr, Generation) << ".";
+      if (fNumIters >= 100 && i % (fNumIters / 100) == 0) ooccoutP((TObject*)nullptr, Generation) << ".";
 
       fPropFunc->Propose(xPrime, x);
 
@@ -246,6 +265,83 @@ MarkovChain* MetropolisHastings::ConstructChain()
    return chain;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Construct fNumChains chains in forked processes and concatenate them.
+/// The random seeds of the workers are drawn from RooRandom in the parent
+/// process, so the result is reproducible for a given seed and number of
+/// chains.
+
+MarkovChain *MetropolisHastings::ConstructChainsMultiProcess()
+{
+   const UInt_t numChains = fNumChains;
+   const auto constructSingleChain = [&]() {
+      fNumChains = 1;
+      MarkovChain *chain = ConstructChain();
+      fNumChains = numChains;
+      return chain;
+   };
+
+#ifdef R__WIN32
+   coutW(Eval) << "MetropolisHastings: running chains in several processes is not supported on Windows, "
+               << "constructing a single chain." << endl;
+   return constructSingleChain();
+#else
+   if (ROOT::IsImplicitMTEnabled()) {
+      coutW(Eval) << "MetropolisHastings: implicit multi-threading must be disabled to run chains in "
+                  << "several processes, constructing a single chain." << endl;
+      return constructSingleChain();
+   }
+
+   // split the iterations between the chains, keeping the total constant
+   const Int_t totIters = fNumIters;
+   const unsigned int nChains = std::max(1, std::min(static_cast<Int_t>(numChains), totIters));
+   std::vector<Int_t> nIters(nChains);
+   std::vector<UInt_t> seeds(nChains);
+   for (unsigned int i = 0; i < nChains; ++i) {
+      nIters[i] = totIters / nChains + (static_cast<Int_t>(i) < totIters % static_cast<Int_t>(nChains) ? 1 : 0);
+      seeds[i] = RooRandom::randomGenerator()->Integer(TMath::Limits<unsigned int>::Max());
+   }
+
+   // the workers are forked: changing the state of this object and of
+   // RooRandom there has no effect on the parent process
+   auto runWorker = [&](unsigned int iChain) {
+      RooRandom::randomGenerator()->SetSeed(seeds[iChain]);
+      fNumIters = nIters[iChain];
+      return constructSingleChain();
+   };
+
+   ROOT::TProcessExecutor pool(nChains);
+   const std::vector<MarkovChain *> chains = pool.Map(runWorker, ROOT::TSeqU(nChains));
+   if (chains.size() != nChains) {
+      coutW(Eval) << "MetropolisHastings: only " << chains.size() << " of " << nChains
+                  << " workers returned a Markov chain." << endl;
+   }
+
+   // the workers return in the order in which they complete, so sort the
+   // chains by their starting point to merge them reproducibly
+   std::vector<std::unique_ptr<MarkovChain>> ownedChains;
+   for (MarkovChain *workerChain : chains) {
+      if (workerChain && workerChain->Size() > 0)
+         ownedChains.emplace_back(workerChain);
+      else
+         delete workerChain;
+   }
+   std::sort(ownedChains.begin(), ownedChains.end(),
+             [](auto const &l, auto const &r) { return l->NLL(0) < r->NLL(0); });
+
+   std::unique_ptr<MarkovChain> chain;
+   for (auto &ownedChain : ownedChains) {
+      if (!chain) {
+         chain = std::move(ownedChain);
+      } else {
+         chain->AddWithBurnIn(*ownedChain, fNumBurnInSteps);
+      }
+   }
+
+   return chain.release();
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 bool MetropolisHastings::ShouldTakeStep(double a)
@@ -49,6 +49,11 @@ ToyMCStudy with the RooStudyManager.
 #include "RooCategory.h"
 
 #include "TMath.h"
+#include "TROOT.h"
+
+#ifndef R__WIN32
+#include "ROOT/TProcessExecutor.hxx"
+#endif
 
 
 using namespace RooFit;
@@ -267,8 +272,11 @@ RooDataSet* ToyMCSampler::GetSamplingDistributions(RooArgSet& paramPointIn)
 {
 
    // ======= S I N G L E   R U N ? =======
-   if(!fProofConfig)
+   if(!fProofConfig) {
+      if (fNWorkers > 1)
+         return GetSamplingDistributionsMultiProcess(paramPointIn);
       return GetSamplingDistributionsSingleWorker(paramPointIn);
+   }
 
    // ======= P A R A L L E L   R U N =======
    if (!CheckConfig()){
@@ -309,6 +317,80 @@ RooDataSet* ToyMCSampler::GetSamplingDistributions(RooArgSet& paramPointIn)
    return output;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Run the toys in fNWorkers forked processes, each running
+/// GetSamplingDistributionsSingleWorker on its share of the toys.
+/// The random seeds of the workers are drawn from RooRandom in the parent
+/// process, so the result is reproducible for a given seed and number of
+/// workers. The datasets of the workers are streamed back to the parent and
+/// merged in the order in which they are received.
+
+RooDataSet *ToyMCSampler::GetSamplingDistributionsMultiProcess(RooArgSet &paramPointIn)
+{
+#ifdef R__WIN32
+   oocoutW(nullptr, InputArguments) << "ToyMCSampler: running toys in several processes is not supported on Windows, "
+                                    << "falling back to a serial run." << endl;
+   return GetSamplingDistributionsSingleWorker(paramPointIn);
+#else
+   if (ROOT::IsImplicitMTEnabled()) {
+      oocoutW(nullptr, InputArguments) << "ToyMCSampler: implicit multi-threading must be disabled to run toys in "
+                                       << "several processes, falling back to a serial run." << endl;
+      return GetSamplingDistributionsSingleWorker(paramPointIn);
+   }
+
+   if (!CheckConfig()) {
+      oocoutE(nullptr, InputArguments) << "Bad COnfiguration in ToyMCSampler " << endl;
+      return nullptr;
+   }
+
+   // turn adaptive sampling off if given
+   if (fToysInTails) {
+      fToysInTails = 0;
+      oocoutW(nullptr, InputArguments) << "Adaptive sampling in ToyMCSampler is not supported for parallel runs."
+                                       << endl;
+   }
+
+   // split the toys between the workers, keeping the total number of toys constant
+   const Int_t totToys = fNToys;
+   const unsigned int nWorkers = std::max(1, std::min(static_cast<Int_t>(fNWorkers), totToys));
+   std::vector<Int_t> nToys(nWorkers);
+   std::vector<UInt_t> seeds(nWorkers);
+   for (unsigned int i = 0; i < nWorkers; ++i) {
+      nToys[i] = totToys / nWorkers + (static_cast<Int_t>(i) < totToys % static_cast<Int_t>(nWorkers) ? 1 : 0);
+      seeds[i] = RooRandom::randomGenerator()->Integer(TMath::Limits<unsigned int>::Max());
+   }
+
+   // the workers are forked: changing the state of the sampler and of
+   // RooRandom there has no effect on the parent process
+   auto runWorker = [&](unsigned int iWorker) {
+      RooRandom::randomGenerator()->SetSeed(seeds[iWorker]);
+      fNToys = nToys[iWorker];
+      return GetSamplingDistributionsSingleWorker(paramPointIn);
+   };
+
+   ROOT::TProcessExecutor pool(nWorkers);
+   const std::vector<RooDataSet *> outputs = pool.Map(runWorker, ROOT::TSeqU(nWorkers));
+   if (outputs.size() != nWorkers) {
+      oocoutW(nullptr, Generation) << "ToyMCSampler: only " << outputs.size() << " of " << nWorkers
+                                   << " workers returned a sampling distribution." << endl;
+   }
+
+   std::unique_ptr<RooDataSet> output;
+   for (RooDataSet *workerOutput : outputs) {
+      std::unique_ptr<RooDataSet> ownedOutput{workerOutput};
+      if (!ownedOutput)
+         continue;
+      if (!output) {
+         output = std::move(ownedOutput);
+      } else {
+         output->append(*ownedOutput);
+      }
+   }
+
+   return output.release();
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// This is the main function for serial runs. It is called automatically
 /// from inside GetSamplingDistribution when no ProofConfig is given.
@@ -1,10 +1,19 @@
 // Author: Stephan Hageboeck, CERN  04/2020
 #include "RooStats/HypoTestInverterResult.h"
+#include "RooStats/AsymptoticCalculator.h"
+#include "RooStats/HypoTestInverter.h"
+#include "RooStats/ModelConfig.h"
 
+#include "RooDataSet.h"
+#include "RooHelpers.h"
+#include "RooRealVar.h"
+#include "RooWorkspace.h"
 #include "TFile.h"
 
 #include "gtest/gtest.h"
 
+#include <memory>
+
 using namespace RooStats;
 
 /// Test that we can correctly read a HypoTestInverterResult
@@ -36,3 +45,52 @@ TEST(HypoTestInvResult, ReadFromFile)
   EXPECT_NEAR(htr->CLs(), 0.819079, 1.E-6);
   EXPECT_NEAR(htr->CLsError(), 0.0188863, 1.E-6);
 }
+
+#ifndef _MSC_VER
+/// Test that a fixed scan run in several processes gives the same result as the serial scan
+TEST(HypoTestInvResult, MultiProcessFixedScan)
+{
+  RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+  RooWorkspace ws("ws");
+  ws.factory("Poisson::pois(n[0, 100], sum::nexp(s[5, 0, 50], b[10]))");
+  RooRealVar &n = *ws.var("n");
+  RooRealVar &sig = *ws.var("s");
+
+  RooDataSet data("data", "data", n);
+  n.setVal(12);
+  data.add(n);
+
+  ModelConfig sbModel("sbModel", &ws);
+  sbModel.SetPdf("pois");
+  sbModel.SetObservables("n");
+  sbModel.SetParametersOfInterest("s");
+  sbModel.SetSnapshot(sig);
+
+  ModelConfig bModel(sbModel);
+  bModel.SetName("bModel");
+  sig.setVal(0.);
+  bModel.SetSnapshot(sig);
+
+  AsymptoticCalculator calc(data, bModel, sbModel);
+  calc.SetOneSided(true);
+
+  HypoTestInverter serialInverter(calc);
+  serialInverter.SetFixedScan(6, 0., 25.);
+  serialInverter.UseCLs(true);
+  std::unique_ptr<HypoTestInverterResult> serial{serialInverter.GetInterval()};
+
+  HypoTestInverter parallelInverter(calc);
+  parallelInverter.SetFixedScan(6, 0., 25.);
+  parallelInverter.UseCLs(true);
+  parallelInverter.SetNWorkers(3);
+  std::unique_ptr<HypoTestInverterResult> parallel{parallelInverter.GetInterval()};
+
+  ASSERT_EQ(serial->ArraySize(), 6);
+  ASSERT_EQ(parallel->ArraySize(), serial->ArraySize());
+  for (int i = 0; i < serial->ArraySize(); ++i) {
+    EXPECT_DOUBLE_EQ(parallel->GetXValue(i), serial->GetXValue(i));
+    EXPECT_NEAR(parallel->CLs(i), serial->CLs(i), 1.E-4);
+  }
+}
+#endif
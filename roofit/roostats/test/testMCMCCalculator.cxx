@@ -0,0 +1,53 @@
+#include "RooStats/MCMCCalculator.h"
+#include "RooStats/MCMCInterval.h"
+#include "RooStats/ModelConfig.h"
+#include "RooDataSet.h"
+#include "RooRandom.h"
+#include "RooRealVar.h"
+#include "RooWorkspace.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+TEST(MCMCCalculator, MultipleChains)
+{
+   RooWorkspace ws("ws");
+   ws.factory("Gaussian::gauss(x[0, -10, 10], mu[0, -5, 5], 1.)");
+   ws.factory("Uniform::prior(mu)");
+
+   RooRealVar &x = *ws.var("x");
+   RooRealVar &mu = *ws.var("mu");
+   RooDataSet data("data", "data", x);
+   x.setVal(0.);
+   data.add(x);
+
+   RooStats::ModelConfig mc("mc", &ws);
+   mc.SetPdf("gauss");
+   mc.SetPriorPdf("prior");
+   mc.SetObservables("x");
+   mc.SetParametersOfInterest("mu");
+
+   RooStats::MCMCCalculator mcmc(data, mc);
+   mcmc.SetNumIters(20000);
+   mcmc.SetNumBurnInSteps(50);
+   mcmc.SetLeftSideTailFraction(0.5);
+   mcmc.SetNumChains(4);
+
+   RooRandom::randomGenerator()->SetSeed(1234);
+   std::unique_ptr<RooStats::MCMCInterval> interval1{mcmc.GetInterval()};
+   RooRandom::randomGenerator()->SetSeed(1234);
+   std::unique_ptr<RooStats::MCMCInterval> interval2{mcmc.GetInterval()};
+
+   ASSERT_NE(interval1, nullptr);
+   ASSERT_NE(interval2, nullptr);
+
+   // the posterior of mu is a unit Gaussian centered at the observed value
+   EXPECT_NEAR(interval1->LowerLimit(mu), -1.96, 0.3);
+   EXPECT_NEAR(interval1->UpperLimit(mu), 1.96, 0.3);
+
+   // the chains are seeded from RooRandom in the parent process and merged
+   // in a fixed order, so the result is reproducible
+   EXPECT_DOUBLE_EQ(interval1->LowerLimit(mu), interval2->LowerLimit(mu));
+   EXPECT_DOUBLE_EQ(interval1->UpperLimit(mu), interval2->UpperLimit(mu));
+}
@@ -0,0 +1,54 @@
+#include "RooStats/ToyMCSampler.h"
+#include "RooStats/ModelConfig.h"
+#include "RooStats/ProfileLikelihoodTestStat.h"
+#include "RooStats/SamplingDistribution.h"
+#include "RooRandom.h"
+#include "RooWorkspace.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+TEST(ToyMCSampler, MultiProcess)
+{
+   RooWorkspace ws("ws");
+   ws.factory("Poisson::pois(n[0, 100], sum::nexp(s[5, 0, 50], b[10]))");
+
+   RooStats::ModelConfig mc("mc", &ws);
+   mc.SetPdf("pois");
+   mc.SetObservables("n");
+   mc.SetParametersOfInterest("s");
+   mc.SetSnapshot(*ws.var("s"));
+
+   RooStats::ProfileLikelihoodTestStat ts(*mc.GetPdf());
+   RooStats::ToyMCSampler sampler(ts, 50);
+   sampler.SetPdf(*mc.GetPdf());
+   sampler.SetObservables(*mc.GetObservables());
+   sampler.SetParametersForTestStat(*mc.GetParametersOfInterest());
+
+   RooArgSet poi{*ws.var("s")};
+
+   RooRandom::randomGenerator()->SetSeed(1234);
+   std::unique_ptr<RooDataSet> serial{sampler.GetSamplingDistributions(poi)};
+
+   sampler.SetNWorkers(4);
+   RooRandom::randomGenerator()->SetSeed(1234);
+   std::unique_ptr<RooDataSet> parallel1{sampler.GetSamplingDistributions(poi)};
+   RooRandom::randomGenerator()->SetSeed(1234);
+   std::unique_ptr<RooDataSet> parallel2{sampler.GetSamplingDistributions(poi)};
+
+   ASSERT_NE(serial, nullptr);
+   ASSERT_NE(parallel1, nullptr);
+   ASSERT_NE(parallel2, nullptr);
+
+   // the total number of toys is kept constant
+   EXPECT_EQ(serial->numEntries(), 50);
+   EXPECT_EQ(parallel1->numEntries(), 50);
+
+   // the workers are seeded from RooRandom in the parent process, so the toys
+   // are reproducible up to the order in which the workers return
+   RooStats::SamplingDistribution dist1("dist1", "dist1", *parallel1);
+   RooStats::SamplingDistribution dist2("dist2", "dist2", *parallel2);
+   EXPECT_DOUBLE_EQ(dist1.InverseCDF(0.5), dist2.InverseCDF(0.5));
+   EXPECT_DOUBLE_EQ(dist1.InverseCDF(0.9), dist2.InverseCDF(0.9));
+}
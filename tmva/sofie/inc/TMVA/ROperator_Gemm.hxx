@@ -40,6 +40,48 @@ namespace SOFIE{
       std::vector<Dim> fShapeB;
       std::vector<size_t> fShapeC;
       std::vector<Dim> fShapeY;
+      EActivationType fActivation = EActivationType::UNDEFINED; // activation applied to the output
+
+      /// maximum m*n*k of the static Gemm for which explicit loops are generated instead of a BLAS call:
+      /// for small matrices the call overhead dominates and the compiler can unroll and vectorize the
+      /// loops, since their sizes are known
+      static constexpr size_t kMaxInlineSize = 65536;
+
+      /// generate the loops computing Y = alpha * op(A) * op(B) + beta * Y for the static shapes
+      std::string GenerateInlineGemm(size_t m, size_t n, size_t k) const
+      {
+         std::stringstream out;
+         out << std::setprecision(std::numeric_limits<float>::max_digits10);
+         auto elemA = [&](const std::string &i, const std::string &p) {
+            return "tensor_" + fNA + "[" + (fAttrTransA ? p + " * " + std::to_string(m) + " + " + i
+                                                          : i + " * " + std::to_string(k) + " + " + p) + "]";
+         };
+         out << SP << "for (int i = 0; i < " << m << "; i++) {\n";
+         out << SP << SP << "float * y = tensor_" << fNY << " + i * " << n << ";\n";
+         if (fNC.empty()) {
+            out << SP << SP << "for (int j = 0; j < " << n << "; j++) y[j] = 0;\n";
+         } else if (fAttrBeta != 1) {
+            out << SP << SP << "for (int j = 0; j < " << n << "; j++) y[j] *= " << fAttrBeta << ";\n";
+         }
+         if (fAttrTransB) {
+            // B is n x k: dot products of contiguous rows
+            out << SP << SP << "for (int j = 0; j < " << n << "; j++) {\n";
+            out << SP << SP << SP << "float sum = 0;\n";
+            out << SP << SP << SP << "for (int p = 0; p < " << k << "; p++) sum += " << elemA("i", "p")
+                << " * tensor_" << fNB << "[j * " << k << " + p];\n";
+            out << SP << SP << SP << "y[j] += " << fAttrAlpha << " * sum;\n";
+            out << SP << SP << "}\n";
+         } else {
+            // B is k x n: accumulate scaled contiguous rows of B
+            out << SP << SP << "for (int p = 0; p < " << k << "; p++) {\n";
+            out << SP << SP << SP << "const float a = " << fAttrAlpha << " * " << elemA("i", "p") << ";\n";
+            out << SP << SP << SP << "const float * b = tensor_" << fNB << " + p * " << n << ";\n";
+            out << SP << SP << SP << "for (int j = 0; j < " << n << "; j++) y[j] += a * b[j];\n";
+            out << SP << SP << "}\n";
+         }
+         out << SP << "}\n";
+         return out.str();
+      }
 
    public:
 
@@ -62,6 +104,9 @@ namespace SOFIE{
                   "TMVA::SOFIE - Unsupported type parsing a Gemm operator");
       }
 
+      /// apply the activation function directly on the output, instead of in a following operator
+      void SetActivation(EActivationType activation) { fActivation = activation; }
+
       std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
          ETensorType out = input[0];
          return {out};
@@ -238,21 +283,28 @@ namespace SOFIE{
          }
          std::stringstream out;
          out << "\n//--------- Gemm\n";
-         out << SP << "char " << OpName << "_transA = " << (fAttrTransA ? "\'t\'" : "\'n\'") << ";\n";
-         out << SP << "char " << OpName << "_transB = " << (fAttrTransB ? "\'t\'" : "\'n\'") << ";\n";
 
          auto m = (fAttrTransA ? fShapeA[1].GetVal() : fShapeA[0].GetVal());
          auto n = (fAttrTransB ? fShapeB[0].GetVal() : fShapeB[1].GetVal());
          auto k = (fAttrTransA ? fShapeA[0].GetVal() : fShapeA[1].GetVal());
          auto length = ConvertDynamicShapeToLength(fShapeY);
 
-         out << SP << "int " << OpName << "_m = " << m << ";\n";
-         out << SP << "int " << OpName << "_n = " << n << ";\n";
-         out << SP << "int " << OpName << "_k = " << k << ";\n";
-         out << SP << "float " << OpName << "_alpha = " << std::setprecision(std::numeric_limits<float>::max_digits10) << fAttrAlpha << ";\n";
-         out << SP << "float " << OpName << "_beta = " << std::setprecision(std::numeric_limits<float>::max_digits10) << fAttrBeta << ";\n";
-         out << SP << "int " << OpName << "_lda = " << (fAttrTransA ? m : k) << ";\n";
-         out << SP << "int " << OpName << "_ldb = " << (fAttrTransB ? k : n) << ";\n";
+         auto shapeA = ConvertShapeToInt(fShapeA);
+         auto shapeB = ConvertShapeToInt(fShapeB);
+         const bool inlineGemm = fType == "float" && !shapeA.empty() && !shapeB.empty() &&
+                                 ConvertShapeToLength(shapeA) * shapeB[fAttrTransB ? 0 : 1] <= kMaxInlineSize;
+
+         if (!inlineGemm) {
+            out << SP << "char " << OpName << "_transA = " << (fAttrTransA ? "\'t\'" : "\'n\'") << ";\n";
+            out << SP << "char " << OpName << "_transB = " << (fAttrTransB ? "\'t\'" : "\'n\'") << ";\n";
+            out << SP << "int " << OpName << "_m = " << m << ";\n";
+            out << SP << "int " << OpName << "_n = " << n << ";\n";
+            out << SP << "int " << OpName << "_k = " << k << ";\n";
+            out << SP << "float " << OpName << "_alpha = " << std::setprecision(std::numeric_limits<float>::max_digits10) << fAttrAlpha << ";\n";
+            out << SP << "float " << OpName << "_beta = " << std::setprecision(std::numeric_limits<float>::max_digits10) << fAttrBeta << ";\n";
+            out << SP << "int " << OpName << "_lda = " << (fAttrTransA ? m : k) << ";\n";
+            out << SP << "int " << OpName << "_ldb = " << (fAttrTransB ? k : n) << ";\n";
+         }
          // case bias is present
          if (!fNC.empty()){
             if (fNC2 == fNC) {
@@ -274,13 +326,21 @@ namespace SOFIE{
                throw std::runtime_error("TMVA SOFIE Gemm Op " + OpName + " Bias tensor is not present but beta value in Gemm is not zero");
             }
          }
-         if (fType == "float"){
+         if (inlineGemm) {
+            out << GenerateInlineGemm(std::stoul(m), std::stoul(n), std::stoul(k));
+         } else if (fType == "float"){
             out << SP << "BLAS::sgemm_(&" << OpName << "_transB, &" << OpName << "_transA, &" << OpName
              << "_n, &" << OpName << "_m, &" << OpName << "_k, &" << OpName << "_alpha, " << "tensor_" << fNB
              << ", &" << OpName << "_ldb, " << "tensor_" << fNA << ", &" << OpName << "_lda, &" << OpName << "_beta, " << "tensor_" << fNY << ", &"
              << OpName << "_n);\n";
           }
 
+          if (fActivation == EActivationType::RELU) {
+             out << SP << "for (int id = 0; id < " << length << " ; id++){\n";
+             out << SP << SP << "tensor_" << fNY << "[id] = ((tensor_" << fNY << "[id] > 0 )? tensor_" << fNY << "[id] : 0);\n";
+             out << SP << "}\n";
+          }
+
           return out.str();
 
          }
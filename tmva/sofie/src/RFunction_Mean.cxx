@@ -8,11 +8,13 @@ namespace SOFIE {
 std::string RFunction_Mean::GenerateModel() {
     std::string modelGenerationString;
     modelGenerationString = "\n//--------- GNN_Aggregate_Function---"+fFuncName+"\n";
-    modelGenerationString += "std::vector<float> "+fFuncName+"(const int& num_features, const std::vector<std::vector<float>::iterator>& inputs){\n";
+    modelGenerationString += "std::vector<float> "+fFuncName+"(const int& num_features, const std::vector<float*>& inputs){\n";
     modelGenerationString += "\tstd::vector<float> result(num_features,0);\n";
     modelGenerationString += "\tfor(auto &it:inputs){\n";
     modelGenerationString += "\t\tstd::transform(result.begin(), result.end(), it, result.begin(), std::plus<float>());\n\t}\n";
-    modelGenerationString += "\tfor_each(result.begin(), result.end(), [&result](float &x){ x /= result.size();\n";
+    modelGenerationString += "\tif (!inputs.empty()) {\n";
+    modelGenerationString += "\t\tconst float n = inputs.size();\n";
+    modelGenerationString += "\t\tfor(auto &x:result) x /= n;\n\t}\n";
     modelGenerationString += "\treturn result;\n}";
     return modelGenerationString;
 }
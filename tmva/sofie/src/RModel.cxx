@@ -516,6 +516,29 @@ void RModel::GenerateOutput() {
    if (fInputTensorNames.size() > 0) fGC.pop_back();// remove last ","
    fGC += "){\n";
 
+   // the dynamic tensors are allocated in the Session constructor for the shape parameters given there;
+   // grow them if infer is called with larger parameters (e.g. a larger batch), instead of overrunning them
+   if (fUseSession) {
+      std::stringstream out;
+      for (auto &i : fDynamicTensorInfos) {
+         if (i.second.type == ETensorType::BOOL)
+            continue;
+         bool knownShape = true;
+         for (auto &d : i.second.shape) {
+            if (d.isParam && inputParams.count(d.param) == 0)
+               knownShape = false;
+         }
+         if (!knownShape)
+            continue;
+         auto length = ConvertDynamicShapeToLength(i.second.shape);
+         out << SP << "if (" << length << " > fTensor_" << i.first << ".size()) {\n";
+         out << SP << SP << "fTensor_" << i.first << ".resize(" << length << ");\n";
+         out << SP << SP << "tensor_" << i.first << " = fTensor_" << i.first << ".data();\n";
+         out << SP << "}\n";
+      }
+      fGC += out.str();
+   }
+
    for (size_t id = 0; id < fOperators.size(); id++) {
       fGC += (fOperators[id]->Generate(std::to_string(id)));
    }
@@ -178,6 +178,10 @@ void RModel_GNN::Generate() {
     fGC += "std::vector<float> fNodeInputs = std::vector<float>(" + n_num + "*" + n_size_input + ");\n";
     fGC += "std::vector<float> fNodeEdgeAggregate = std::vector<float>(" + n_num + "*" + n_size_input + ", 0);\n";
     fGC += "std::vector<float> fNodeAggregateTemp;\n";
+    fGC += "// edges indexed by receiver node (CSR): the edges of node j are fReceiverEdges[fReceiverOffsets[j]] to fReceiverEdges[fReceiverOffsets[j+1]-1]\n";
+    fGC += "std::vector<size_t> fReceiverOffsets = std::vector<size_t>(" + n_num + " + 1);\n";
+    fGC += "std::vector<size_t> fReceiverEdges = std::vector<size_t>(" + e_num + ");\n";
+    fGC += "std::vector<float *> fEdgesData = std::vector<float *>(" + e_num + ");\n";
 
     fGC += "\nvoid infer(TMVA::Experimental::SOFIE::GNN_Data& input_graph){\n";
 
@@ -238,17 +242,29 @@ void RModel_GNN::Generate() {
                    " , fGlobInputs.begin() + k * " + g_size_input + ");\n";
     fGC += "}\n";
 
+    // index the edges by receiver once, instead of looping on all edges for each node
+    fGC += "\n// index the edges by receiver node\n";
+    fGC += "fReceiverOffsets.assign(n_nodes + 1, 0);\n";
+    fGC += "for (size_t k = 0; k < n_edges; k++) {\n";
+    fGC += "   if (static_cast<size_t>(receivers[k]) < n_nodes) fReceiverOffsets[receivers[k] + 1]++;\n";
+    fGC += "}\n";
+    fGC += "for (size_t j = 0; j < n_nodes; j++) fReceiverOffsets[j + 1] += fReceiverOffsets[j];\n";
+    fGC += "fReceiverEdges.resize(n_edges);\n";
+    fGC += "{\n";
+    fGC += "   std::vector<size_t> fill(fReceiverOffsets.begin(), fReceiverOffsets.end() - 1);\n";
+    fGC += "   for (size_t k = 0; k < n_edges; k++) {\n";
+    fGC += "      if (static_cast<size_t>(receivers[k]) < n_nodes) fReceiverEdges[fill[receivers[k]]++] = k;\n";
+    fGC += "   }\n";
+    fGC += "}\n";
+    fGC += "fEdgesData.reserve(n_edges);\n";
+
     // loop on nodes and aggregate incoming edges
     fGC += "\n// aggregate edges going to a node\n";
     fGC += "for (size_t j = 0; j < n_nodes; j++) {\n";
-    // approximate number of receivers/node to allocate vector
-    fGC += "   std::vector<float *> edgesData; edgesData.reserve( int(n_edges/n_nodes) +1);\n";
-    // loop on edges
-    fGC += "   for (size_t k = 0; k < n_edges; k++) {\n";
-    fGC += "      if (receivers[k] == j) \n";
-    fGC += "         edgesData.emplace_back(input_graph.edge_data.GetData() + k * " + e_size + ");\n";
-    fGC += "   }\n";
-    fGC += "   fNodeAggregateTemp = " + edge_node_agg_block->Generate(num_edge_features, "edgesData") + ";\n";
+    fGC += "   fEdgesData.clear();\n";
+    fGC += "   for (size_t e = fReceiverOffsets[j]; e < fReceiverOffsets[j + 1]; e++)\n";
+    fGC += "      fEdgesData.emplace_back(input_graph.edge_data.GetData() + fReceiverEdges[e] * " + e_size + ");\n";
+    fGC += "   fNodeAggregateTemp = " + edge_node_agg_block->Generate(num_edge_features, "fEdgesData") + ";\n";
     fGC += "   std::copy(fNodeAggregateTemp.begin(), fNodeAggregateTemp.end(), fNodeEdgeAggregate.begin() + " +
                    e_size + " * j);\n";
     fGC += "}\n";   // end node loop
@@ -0,0 +1,28 @@
+#include "TMVA/RModelParser_ONNX.hxx"
+#include "TMVA/ROperator_Gemm.hxx"
+#include "onnx_proto3.pb.h"
+
+namespace TMVA {
+namespace Experimental {
+namespace SOFIE {
+
+extern ParserFuncSignature ParseGemm;
+
+ParserFuseFuncSignature ParseFuseGemmRelu = [](RModelParser_ONNX &parser, const onnx::NodeProto &gemmnode,
+                                               const onnx::NodeProto &relunode) {
+   // the fused Gemm writes directly the output of Relu, the Gemm output tensor is not created
+   onnx::NodeProto fusednode(gemmnode);
+   fusednode.set_output(0, relunode.output(0));
+
+   std::unique_ptr<ROperator> op = ParseGemm(parser, fusednode);
+   auto gemm = dynamic_cast<ROperator_Gemm<float> *>(op.get());
+   if (!gemm)
+      throw std::runtime_error("TMVA::SOFIE - Unsupported - Operator for fusing Gemm and Relu supports only float");
+   gemm->SetActivation(EActivationType::RELU);
+
+   return op;
+};
+
+} // namespace SOFIE
+} // namespace Experimental
+} // namespace TMVA
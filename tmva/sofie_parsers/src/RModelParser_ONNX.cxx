@@ -79,6 +79,7 @@ extern ParserFuncSignature ParseRange;
 extern ParserFuseFuncSignature ParseFuseConvAdd;
 extern ParserFuseFuncSignature ParseFuseConvTransposeAdd;
 extern ParserFuseFuncSignature ParseFuseMatMulAdd;
+extern ParserFuseFuncSignature ParseFuseGemmRelu;
 
 // Definition of  RModelParser_ONNX::OperatorsMap
 struct RModelParser_ONNX::OperatorsMapImpl {
@@ -196,6 +197,28 @@ ETensorType RModelParser_ONNX::GetTensorType(const std::string &name)
    return fTensorTypeMap[UTILITY::Clean_name(name)];
 }
 
+// Relu can be fused with the preceding Gemm if it is the only user of the Gemm output
+static bool CanFuseGemmRelu(const onnx::GraphProto &graphproto, const onnx::NodeProto &gemmnode,
+                            const onnx::NodeProto &relunode)
+{
+   if (gemmnode.op_type() != "Gemm" || relunode.op_type() != "Relu" || relunode.input_size() != 1 ||
+       relunode.input(0) != gemmnode.output(0))
+      return false;
+   const auto &name = gemmnode.output(0);
+   for (int i = 0; i < graphproto.output_size(); i++) {
+      if (graphproto.output(i).name() == name)
+         return false;
+   }
+   int nusers = 0;
+   for (int i = 0; i < graphproto.node_size(); i++) {
+      for (int j = 0; j < graphproto.node(i).input_size(); j++) {
+         if (graphproto.node(i).input(j) == name)
+            nusers++;
+      }
+   }
+   return nusers == 1;
+}
+
 // Parse an operator
 std::unique_ptr<ROperator>
 RModelParser_ONNX::ParseOperator(const size_t i, const onnx::GraphProto &graphproto, const std::vector<size_t> &nodes)
@@ -228,6 +251,11 @@ RModelParser_ONNX::ParseOperator(const size_t i, const onnx::GraphProto &graphpr
                return ParseFuseConvTransposeAdd(*this, graphproto.node(idx), graphproto.node(idx2));
             }
          }
+      } else if (op_type == "Gemm") {
+         // Fuse Gemm and Relu
+         if (idx2 < graphproto.node_size() && CanFuseGemmRelu(graphproto, nodeproto, graphproto.node(idx2))) {
+            return ParseFuseGemmRelu(*this, graphproto.node(idx), graphproto.node(idx2));
+         }
       }
    }
 
@@ -239,6 +267,9 @@ RModelParser_ONNX::ParseOperator(const size_t i, const onnx::GraphProto &graphpr
       else if (graphproto.node(idx0).op_type() == "ConvTranspose")
          return nullptr;
    }
+   // and the following Relu
+   if (i > 0 && op_type == "Relu" && CanFuseGemmRelu(graphproto, graphproto.node(nodes[i - 1]), nodeproto))
+      return nullptr;
 
    auto it = fOperatorsMapImpl->fOperatorsMap.find(op_type);
    if (it == fOperatorsMapImpl->fOperatorsMap.end()) {
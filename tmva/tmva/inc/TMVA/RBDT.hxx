@@ -71,6 +71,7 @@ private:
 
    void Softmax(const Value_t *array, Value_t *out) const;
    void ComputeImpl(const Value_t *array, Value_t *out) const;
+   void ComputeBatchImpl(const Value_t *data, std::size_t nRows, std::size_t nCols, Value_t *out) const;
    Value_t EvaluateBinary(const Value_t *array) const;
    static void correctIndices(std::span<int> indices, IndexMap const &nodeIndices, IndexMap const &leafIndices);
    static void terminateTree(TMVA::Experimental::RBDT &ff, int &nPreviousNodes, int &nPreviousLeaves,
@@ -33,6 +33,8 @@ private:
    std::queue<std::unique_ptr<TMVA::Experimental::RTensor<float>>> fTrainingBatchQueue;
    std::vector<std::unique_ptr<TMVA::Experimental::RTensor<float>>> fValidationBatches;
    std::unique_ptr<TMVA::Experimental::RTensor<float>> fCurrentBatch;
+   /// Training batches that were handed out and can be refilled, to avoid allocating a new tensor for every batch
+   std::vector<std::unique_ptr<TMVA::Experimental::RTensor<float>>> fFreeBatches;
 
    std::size_t fValidationIdx = 0;
 
@@ -55,6 +57,10 @@ public:
       std::unique_lock<std::mutex> lock(fBatchLock);
       fBatchCondition.wait(lock, [this]() { return !fTrainingBatchQueue.empty() || !fIsActive; });
 
+      // The previous batch is not used anymore by the caller
+      if (fCurrentBatch && fCurrentBatch->GetSize() == fBatchSize * fNumColumns)
+         fFreeBatches.emplace_back(std::move(fCurrentBatch));
+
       if (fTrainingBatchQueue.empty()) {
          fCurrentBatch = std::make_unique<TMVA::Experimental::RTensor<float>>(std::vector<std::size_t>({0}));
          return *fCurrentBatch;
@@ -123,19 +129,31 @@ public:
       fBatchCondition.notify_all();
    }
 
-   /// \brief Create a batch filled with the events on the given idx
+   /// \brief Create a batch filled with the fBatchSize events starting at idx
+   /// Recycles the tensor of a batch that was already consumed if there is one
    /// \param chunkTensor
    /// \param idx
    /// \return
    std::unique_ptr<TMVA::Experimental::RTensor<float>>
-   CreateBatch(const TMVA::Experimental::RTensor<float> &chunkTensor, const std::vector<std::size_t> idx)
+   CreateBatch(const TMVA::Experimental::RTensor<float> &chunkTensor, const std::size_t *idx)
    {
-      auto batch =
-         std::make_unique<TMVA::Experimental::RTensor<float>>(std::vector<std::size_t>({fBatchSize, fNumColumns}));
+      std::unique_ptr<TMVA::Experimental::RTensor<float>> batch;
+      {
+         std::lock_guard<std::mutex> lock(fBatchLock);
+         if (!fFreeBatches.empty()) {
+            batch = std::move(fFreeBatches.back());
+            fFreeBatches.pop_back();
+         }
+      }
+      if (!batch)
+         batch =
+            std::make_unique<TMVA::Experimental::RTensor<float>>(std::vector<std::size_t>({fBatchSize, fNumColumns}));
 
+      const float *chunkData = chunkTensor.GetData();
+      float *batchData = batch->GetData();
       for (std::size_t i = 0; i < fBatchSize; i++) {
-         std::copy(chunkTensor.GetData() + (idx[i] * fNumColumns), chunkTensor.GetData() + ((idx[i] + 1) * fNumColumns),
-                   batch->GetData() + i * fNumColumns);
+         std::copy(chunkData + (idx[i] * fNumColumns), chunkData + ((idx[i] + 1) * fNumColumns),
+                   batchData + i * fNumColumns);
       }
 
       return batch;
@@ -165,16 +183,10 @@ public:
       std::vector<std::unique_ptr<TMVA::Experimental::RTensor<float>>> batches;
 
       // Create tasks of fBatchSize untill all idx are used
+      batches.reserve(eventIndices.size() / fBatchSize);
       for (std::size_t start = 0; (start + fBatchSize) <= eventIndices.size(); start += fBatchSize) {
-
-         // Grab the first fBatchSize indices from the
-         std::vector<std::size_t> idx;
-         for (std::size_t i = start; i < (start + fBatchSize); i++) {
-            idx.push_back(eventIndices[i]);
-         }
-
-         // Fill a batch
-         batches.emplace_back(CreateBatch(chunkTensor, idx));
+         // Fill a batch with the next fBatchSize events
+         batches.emplace_back(CreateBatch(chunkTensor, eventIndices.data() + start));
       }
 
       {
@@ -192,20 +204,14 @@ public:
    /// \param chunkTensor
    /// \param eventIndices
    void CreateValidationBatches(const TMVA::Experimental::RTensor<float> &chunkTensor,
-                                const std::vector<std::size_t> eventIndices)
+                                const std::vector<std::size_t> &eventIndices)
    {
       // Create tasks of fBatchSize untill all idx are used
       for (std::size_t start = 0; (start + fBatchSize) <= eventIndices.size(); start += fBatchSize) {
-
-         std::vector<std::size_t> idx;
-
-         for (std::size_t i = start; i < (start + fBatchSize); i++) {
-            idx.push_back(eventIndices[i]);
-         }
-
+         auto batch = CreateBatch(chunkTensor, eventIndices.data() + start);
          {
             std::unique_lock<std::mutex> lock(fBatchLock);
-            fValidationBatches.emplace_back(CreateBatch(chunkTensor, idx));
+            fValidationBatches.emplace_back(std::move(batch));
          }
       }
    }
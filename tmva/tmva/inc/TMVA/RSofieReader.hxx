@@ -17,6 +17,7 @@
 #define TMVA_RSOFIEREADER
 
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <memory> // std::unique_ptr
@@ -159,6 +160,7 @@ public:
          if (batchSize < 1) batchSize = 1;
       }
       if (verbose) std::cout << "generating the code with batch size = " << batchSize << " ...\n";
+      fBatchSize = batchSize;
 
       parserCode += "model.Generate(TMVA::Experimental::SOFIE::Options::kDefault,"
                    + ROOT::Math::Util::ToString(batchSize) + "); \n";
@@ -325,23 +327,40 @@ public:
    /// The shape of the input tensor should be {nevents, nfeatures}
    /// and the return shape will be {nevents, noutputs}
    /// support for now only a single input
+   /// The events are evaluated in batches of the size given by the first input shape when loading the model,
+   /// the last incomplete batch is padded with zeros
    RTensor<float> Compute(RTensor<float> &x)
    {
-      if(!fInitialized) {
+      if(!fInitialized || x.GetShape()[0] == 0) {
          return RTensor<float>({0});
       }
-      const auto nrows = x.GetShape()[0];
-      const auto rowsize = x.GetStrides()[0];
+      const size_t nrows = x.GetShape()[0];
+      const size_t rowsize = x.GetStrides()[0];
+      const size_t batchSize = fBatchSize;
       auto fptr = reinterpret_cast<std::vector<float> (*)(void *, const float *)>(fFuncPtr);
-      auto result = fptr(fSessionPtr, x.GetData());
 
-      RTensor<float> y({nrows, result.size()}, MemoryLayout::ColumnMajor);
-      std::copy(result.begin(),result.end(), y.GetData());
+      // Take lock to protect model evaluation
+      R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
+
       //const bool layout = x.GetMemoryLayout() == MemoryLayout::ColumnMajor ? false : true;
       // assume column major layout
-      for (size_t i = 1; i < nrows; i++) {
-         result = fptr(fSessionPtr, x.GetData() + i*rowsize);
-         std::copy(result.begin(),result.end(), y.GetData() + i*result.size());
+      RTensor<float> y({0});
+      size_t noutputs = 0;
+      std::vector<float> padded;
+      for (size_t i = 0; i < nrows; i += batchSize) {
+         const size_t n = std::min(batchSize, nrows - i);
+         const float *input = x.GetData() + i*rowsize;
+         if (n < batchSize) {
+            padded.assign(batchSize*rowsize, 0);
+            std::copy(input, input + n*rowsize, padded.begin());
+            input = padded.data();
+         }
+         auto result = fptr(fSessionPtr, input);
+         if (i == 0) {
+            noutputs = result.size() / batchSize;
+            y = RTensor<float>({nrows, noutputs}, MemoryLayout::ColumnMajor);
+         }
+         std::copy(result.begin(), result.begin() + n*noutputs, y.GetData() + i*noutputs);
       }
       return y;
    }
@@ -350,6 +369,7 @@ private:
 
    bool fInitialized = false;
    int fNInputs = 0;
+   int fBatchSize = 1; // number of events evaluated by each call of the generated infer function
    void * fSessionPtr = nullptr;
    void * fFuncPtr = nullptr;
 
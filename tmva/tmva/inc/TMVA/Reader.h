@@ -49,6 +49,8 @@
 #include "TMVA/DataInputHandler.h"
 #include "TMVA/DataSetManager.h"
 
+#include <ROOT/RSpan.hxx>
+
 #include <vector>
 #include <map>
 #include <stdexcept>
@@ -89,6 +91,10 @@ namespace TMVA {
       Double_t EvaluateMVA( MethodBase* method,           Double_t aux = 0 );
       Double_t EvaluateMVA( const TString& methodTag,     Double_t aux = 0 );
 
+      // returns the MVA responses for nEvents events stored one after the other in inputs
+      void EvaluateMVA( std::span<const Float_t> inputs, std::size_t nEvents, std::span<Float_t> out,
+                        const TString& methodTag, Double_t aux = 0 );
+
       // returns error on MVA response for given event
       // NOTE: must be called AFTER "EvaluateMVA(...)" call !
       Double_t GetMVAError() const { return fMvaEventError; }
@@ -1324,36 +1324,43 @@ struct TrainNodeInfo{
    std::vector< std::vector<Double_t> > target;
    std::vector< std::vector<Double_t> > target2;
 
-   // Define the addition operator for TrainNodeInfo
+   // Define the in-place addition operator for TrainNodeInfo, used to merge the results of the threads
+   // without allocating new histograms for every addition.
    // Make sure both TrainNodeInfos have the same nvars if we add them
-   TrainNodeInfo operator+(const TrainNodeInfo& other)
-   {           
-       TrainNodeInfo ret(cNvars, nBins);
-        
+   TrainNodeInfo& operator+=(const TrainNodeInfo& other)
+   {
        // check that the two are compatible to add
-       if(cNvars != other.cNvars) 
+       if(cNvars != other.cNvars)
        {
           std::cout << "!!! ERROR TrainNodeInfo1+TrainNodeInfo2 failure. cNvars1 != cNvars2." << std::endl;
-          return ret;
+          return *this;
        }
 
        // add the signal, background, and target sums
        for (Int_t ivar=0; ivar<cNvars; ivar++) {
           for (UInt_t ibin=0; ibin<nBins[ivar]; ibin++) {
-             ret.nSelS[ivar][ibin] = nSelS[ivar][ibin] + other.nSelS[ivar][ibin];
-             ret.nSelB[ivar][ibin] = nSelB[ivar][ibin] + other.nSelB[ivar][ibin];
-             ret.nSelS_unWeighted[ivar][ibin] = nSelS_unWeighted[ivar][ibin] + other.nSelS_unWeighted[ivar][ibin];
-             ret.nSelB_unWeighted[ivar][ibin] = nSelB_unWeighted[ivar][ibin] + other.nSelB_unWeighted[ivar][ibin];
-             ret.target[ivar][ibin] = target[ivar][ibin] + other.target[ivar][ibin];
-             ret.target2[ivar][ibin] = target2[ivar][ibin] + other.target2[ivar][ibin];
+             nSelS[ivar][ibin] += other.nSelS[ivar][ibin];
+             nSelB[ivar][ibin] += other.nSelB[ivar][ibin];
+             nSelS_unWeighted[ivar][ibin] += other.nSelS_unWeighted[ivar][ibin];
+             nSelB_unWeighted[ivar][ibin] += other.nSelB_unWeighted[ivar][ibin];
+             target[ivar][ibin] += other.target[ivar][ibin];
+             target2[ivar][ibin] += other.target2[ivar][ibin];
           }
        }
 
-       ret.nTotS = nTotS + other.nTotS;
-       ret.nTotS_unWeighted = nTotS_unWeighted + other.nTotS_unWeighted;
-       ret.nTotB = nTotB + other.nTotB;
-       ret.nTotB_unWeighted = nTotB_unWeighted + other.nTotB_unWeighted;
+       nTotS += other.nTotS;
+       nTotS_unWeighted += other.nTotS_unWeighted;
+       nTotB += other.nTotB;
+       nTotB_unWeighted += other.nTotB_unWeighted;
+
+       return *this;
+   };
 
+   // Define the addition operator for TrainNodeInfo
+   TrainNodeInfo operator+(const TrainNodeInfo& other)
+   {
+       TrainNodeInfo ret(*this);
+       ret += other;
        return ret;
    };
  
@@ -1597,10 +1604,15 @@ Double_t TMVA::DecisionTree::TrainNodeFast( const EventConstList & eventSample,
 
          TrainNodeInfo nodeInfof(cNvars, nBins);
 
+         const Bool_t doRegression = DoRegression();
          for(UInt_t iev=start; iev<end; iev++) {
 
-            Double_t eventWeight =  eventSample[iev]->GetWeight();
-            if (eventSample[iev]->GetClass() == fSigClass) {
+            // #### Look up the event properties once, not for every variable
+            const TMVA::Event *ev = eventSample[iev];
+            const Double_t eventWeight = ev->GetWeight();
+            const Bool_t isSignal = (ev->GetClass() == fSigClass);
+            const Double_t eventTarget = doRegression ? ev->GetTarget(0) : 0.;
+            if (isSignal) {
                nodeInfof.nTotS+=eventWeight;
                nodeInfof.nTotS_unWeighted++;    }
             else {
@@ -1615,17 +1627,17 @@ Double_t TMVA::DecisionTree::TrainNodeFast( const EventConstList & eventSample,
                // the best separationGain at the current stage.
                if ( useVariable[ivar] ) {
                   Double_t eventData;
-                  if (ivar < fNvars) eventData = eventSample[iev]->GetValueFast(ivar);
+                  if (ivar < fNvars) eventData = ev->GetValueFast(ivar);
                   else { // the fisher variable
                      eventData = fisherCoeff[fNvars];
                      for (UInt_t jvar=0; jvar<fNvars; jvar++)
-                        eventData += fisherCoeff[jvar]*(eventSample[iev])->GetValueFast(jvar);
+                        eventData += fisherCoeff[jvar]*ev->GetValueFast(jvar);
 
                   }
                   // #### figure out which bin it belongs in ...
                   // "maximum" is nbins-1 (the "-1" because we start counting from 0 !!
                   iBin = TMath::Min(Int_t(nBins[ivar]-1),TMath::Max(0,int (invBinWidth[ivar]*(eventData-xmin[ivar]) ) ));
-                  if (eventSample[iev]->GetClass() == fSigClass) {
+                  if (isSignal) {
                      nodeInfof.nSelS[ivar][iBin]+=eventWeight;
                      nodeInfof.nSelS_unWeighted[ivar][iBin]++;
                   }
@@ -1633,9 +1645,9 @@ Double_t TMVA::DecisionTree::TrainNodeFast( const EventConstList & eventSample,
                      nodeInfof.nSelB[ivar][iBin]+=eventWeight;
                      nodeInfof.nSelB_unWeighted[ivar][iBin]++;
                   }
-                  if (DoRegression()) {
-                     nodeInfof.target[ivar][iBin] +=eventWeight*eventSample[iev]->GetTarget(0);
-                     nodeInfof.target2[ivar][iBin]+=eventWeight*eventSample[iev]->GetTarget(0)*eventSample[iev]->GetTarget(0);
+                  if (doRegression) {
+                     nodeInfof.target[ivar][iBin] +=eventWeight*eventTarget;
+                     nodeInfof.target2[ivar][iBin]+=eventWeight*eventTarget*eventTarget;
                   }
                }
             }
@@ -1643,11 +1655,16 @@ Double_t TMVA::DecisionTree::TrainNodeFast( const EventConstList & eventSample,
          return nodeInfof;
       };
 
-      // #### Need an intial struct to pass to std::accumulate
+      // #### Need an initial struct to start the sum of the partial results
       TrainNodeInfo nodeInfoInit(cNvars, nBins);
 
       // #### Run the threads in parallel then merge the results
-      auto redfunc = [nodeInfoInit](std::vector<TrainNodeInfo> v) -> TrainNodeInfo { return std::accumulate(v.begin(), v.end(), nodeInfoInit); };
+      auto redfunc = [&nodeInfoInit](const std::vector<TrainNodeInfo> &v) -> TrainNodeInfo {
+         TrainNodeInfo sum(nodeInfoInit);
+         for (const auto &partial : v)
+            sum += partial;
+         return sum;
+      };
       nodeInfo = TMVA::Config::Instance().GetThreadExecutor().MapReduce(f, seeds, redfunc);
    }
  
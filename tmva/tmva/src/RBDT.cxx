@@ -23,6 +23,7 @@
 #include <TFile.h>
 #include <TSystem.h>
 
+#include <algorithm>
 #include <cmath>
 #include <fstream>
 #include <iostream>
@@ -111,21 +112,75 @@ RTensor<TMVA::Experimental::RBDT::Value_t> TMVA::Experimental::RBDT::Compute(RTe
    std::size_t nOut = fBaseResponses.size() > 2 ? fBaseResponses.size() : 1;
    const std::size_t rows = x.GetShape()[0];
    const std::size_t cols = x.GetShape()[1];
+
+   // The batch evaluation needs the events as contiguous rows
+   const Value_t *xData = x.GetData();
+   std::vector<Value_t> xRowMajor;
+   if (x.GetMemoryLayout() == MemoryLayout::ColumnMajor) {
+      xRowMajor.resize(rows * cols);
+      for (std::size_t iRow = 0; iRow < rows; ++iRow) {
+         for (std::size_t iCol = 0; iCol < cols; ++iCol) {
+            xRowMajor[iRow * cols + iCol] = xData[iCol * rows + iRow];
+         }
+      }
+      xData = xRowMajor.data();
+   }
+
+   std::vector<Value_t> yRowMajor(rows * nOut);
+   ComputeBatchImpl(xData, rows, cols, yRowMajor.data());
+
    RTensor<Value_t> y({rows, nOut}, MemoryLayout::ColumnMajor);
-   std::vector<Value_t> xRow(cols);
-   std::vector<Value_t> yRow(nOut);
+   Value_t *yData = y.GetData();
    for (std::size_t iRow = 0; iRow < rows; ++iRow) {
-      for (std::size_t iCol = 0; iCol < cols; ++iCol) {
-         xRow[iCol] = x({iRow, iCol});
-      }
-      ComputeImpl(xRow.data(), yRow.data());
       for (std::size_t iOut = 0; iOut < nOut; ++iOut) {
-         y({iRow, iOut}) = yRow[iOut];
+         yData[iOut * rows + iRow] = yRowMajor[iRow * nOut + iOut];
       }
    }
    return y;
 }
 
+/// Compute the model prediction on nRows events stored as contiguous rows of nCols values.
+/// The trees are traversed for a block of events at a time, so that the nodes of a tree stay in the cache while
+/// they are used for all the events of the block. The responses of the trees are summed in the same order as
+/// in ComputeImpl(), which gives identical results.
+void TMVA::Experimental::RBDT::ComputeBatchImpl(const Value_t *data, std::size_t nRows, std::size_t nCols,
+                                                Value_t *out) const
+{
+   constexpr std::size_t kBlockSize = 64;
+   const std::size_t nOut = fBaseResponses.size() > 2 ? fBaseResponses.size() : 1;
+
+   for (std::size_t iRow = 0; iRow < nRows; ++iRow) {
+      for (std::size_t iOut = 0; iOut < nOut; ++iOut) {
+         out[iRow * nOut + iOut] = fBaseScore + fBaseResponses[iOut];
+      }
+   }
+
+   for (std::size_t blockBegin = 0; blockBegin < nRows; blockBegin += kBlockSize) {
+      const std::size_t blockEnd = std::min(nRows, blockBegin + kBlockSize);
+      for (std::size_t iTree = 0; iTree < fRootIndices.size(); ++iTree) {
+         const std::size_t iOut = nOut > 1 ? fTreeNumbers[iTree] % nOut : 0;
+         for (std::size_t iRow = blockBegin; iRow < blockEnd; ++iRow) {
+            const Value_t *array = data + iRow * nCols;
+            int index = fRootIndices[iTree];
+            do {
+               int r = fRightIndices[index];
+               int l = fLeftIndices[index];
+               index = array[fCutIndices[index]] < fCutValues[index] ? l : r;
+            } while (index > 0);
+            out[iRow * nOut + iOut] += fResponses[-index];
+         }
+      }
+   }
+
+   for (std::size_t iRow = 0; iRow < nRows; ++iRow) {
+      if (nOut > 1) {
+         softmaxTransformInplace(out + iRow * nOut, nOut);
+      } else if (fLogistic) {
+         out[iRow] = 1.0 / (1.0 + std::exp(-out[iRow]));
+      }
+   }
+}
+
 void TMVA::Experimental::RBDT::Softmax(const Value_t *array, Value_t *out) const
 {
    std::size_t nOut = fBaseResponses.size() > 2 ? fBaseResponses.size() : 1;
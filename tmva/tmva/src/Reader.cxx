@@ -96,6 +96,7 @@
 #include "TMVA/DataInputHandler.h"
 #include "TMVA/DataSetInfo.h"
 #include "TMVA/DataSetManager.h"
+#include "TMVA/Event.h"
 #include "TMVA/IMethod.h"
 #include "TMVA/MethodBase.h"
 #include "TMVA/MethodCuts.h"
@@ -111,6 +112,7 @@
 #include "TXMLEngine.h"
 #include "TMath.h"
 
+#include <algorithm>
 #include <cstdlib>
 
 #include <string>
@@ -492,6 +494,62 @@ Double_t TMVA::Reader::EvaluateMVA( const std::vector<Float_t>& inputVec, const
    return val;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate a batch of nEvents events for a given method. The inputs hold the
+/// values of the variables of the events one event after the other, and the
+/// MVA value of each event is written into out. The same temporary event is
+/// reused for all the events, which avoids the allocations of the
+/// per-event EvaluateMVA(const std::vector<Float_t>&, ...). Events with a NaN
+/// variable get the MVA value -999.
+/// The parameter aux is obligatory for the cuts method where it represents the efficiency cutoff
+///
+/// Like the other EvaluateMVA functions, this modifies the state of the method:
+/// concurrent evaluations, e.g. from different RDataFrame slots, need a Reader each.
+
+void TMVA::Reader::EvaluateMVA( std::span<const Float_t> inputs, std::size_t nEvents, std::span<Float_t> out,
+                                const TString& methodTag, Double_t aux )
+{
+   IMethod* imeth = FindMVA( methodTag );
+   MethodBase* meth = dynamic_cast<TMVA::MethodBase*>(imeth);
+   if(meth==0) {
+      std::fill(out.begin(), out.begin() + std::min(nEvents, out.size()), 0);
+      return;
+   }
+
+   const UInt_t nVars = DataInfo().GetNVariables();
+   if (inputs.size() < nEvents * nVars || out.size() < nEvents) {
+      Log() << kFATAL << "<EvaluateMVA> the batch of " << nEvents << " events needs " << nEvents * nVars
+            << " input values and " << nEvents << " output values, got " << inputs.size() << " and " << out.size()
+            << Endl;
+      return;
+   }
+
+   if (meth->GetMethodType() == TMVA::Types::kCuts) {
+      TMVA::MethodCuts* mc = dynamic_cast<TMVA::MethodCuts*>(meth);
+      if(mc)
+         mc->SetTestSignalEfficiency( aux );
+   }
+
+   Event tmpEvent(std::vector<Float_t>(nVars), nVars);
+   for (std::size_t iev=0; iev<nEvents; iev++) {
+      const Float_t* values = inputs.data() + iev * nVars;
+      Bool_t hasNaN = kFALSE;
+      for (UInt_t i=0; i<nVars; i++) {
+         if (TMath::IsNaN(values[i])) {
+            hasNaN = kTRUE;
+            break;
+         }
+         tmpEvent.SetVal(i, values[i]);
+      }
+      if (hasNaN) {
+         Log() << kERROR << "event " << iev << " of the batch has a NaN variable --> return MVA value -999" << Endl;
+         out[iev] = -999;
+         continue;
+      }
+      out[iev] = meth->GetMvaValue( &tmpEvent, (fCalculateError?&fMvaEventError:0));
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Evaluate a std::vector<double> of input data for a given method
 /// The parameter aux is obligatory for the cuts method where it represents the efficiency cutoff
@@ -15,6 +15,8 @@
 #include <memory>
 
 namespace arrow {
+class RecordBatchReader;
+class Schema;
 class Table;
 }
 
@@ -30,16 +32,22 @@ namespace RDF {
 class RArrowDS final : public RDataSource {
 private:
    std::shared_ptr<arrow::Table> fTable;
+   std::shared_ptr<arrow::RecordBatchReader> fBatchReader; ///< Source of the record batches, if not reading a table
+   std::shared_ptr<arrow::Schema> fSchema;
    std::vector<std::pair<ULong64_t, ULong64_t>> fEntryRanges;
    std::vector<std::string> fColumnNames;
    size_t fNSlots = 0U;
+   ULong64_t fNextEntry = 0U; ///< Entry number of the first row of the next record batch
+   bool fStreamStarted = false;
 
    std::vector<std::pair<size_t, size_t>> fGetterIndex; // (columnId, visitorId)
    std::vector<std::unique_ptr<ROOT::Internal::RDF::TValueGetter>> fValueGetters; // Visitors to be used to track and get entries. One per column.
    std::vector<void *> GetColumnReadersImpl(std::string_view name, const std::type_info &type) final;
+   std::vector<std::pair<ULong64_t, ULong64_t>> ReadNextBatches();
 
 public:
    RArrowDS(std::shared_ptr<arrow::Table> table, std::vector<std::string> const &columns);
+   RArrowDS(std::shared_ptr<arrow::RecordBatchReader> reader, std::vector<std::string> const &columns);
    ~RArrowDS();
    const std::vector<std::string> &GetColumnNames() const final;
    std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final;
@@ -53,6 +61,7 @@ public:
 };
 
 RDataFrame FromArrow(std::shared_ptr<arrow::Table> table, std::vector<std::string> const &columnNames);
+RDataFrame FromArrow(std::shared_ptr<arrow::RecordBatchReader> reader, std::vector<std::string> const &columnNames);
 
 } // namespace RDF
 
@@ -0,0 +1,30 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RCACHEOPTIONS
+#define ROOT_RCACHEOPTIONS
+
+#include <RtypesCore.h> // ULong64_t
+
+#include <string>
+
+namespace ROOT {
+
+namespace RDF {
+/// A collection of options to steer the caching of a dataset with RInterface::Cache
+struct RCacheOptions {
+   /// Maximum number of bytes of cached values kept in memory. If the cached dataset turns out to be larger, it is
+   /// written to temporary files instead. 0 (the default) means no limit: everything is cached in memory.
+   ULong64_t fMemoryBudget = 0;
+   /// Directory in which the temporary files are created, the system's temporary directory if empty
+   std::string fSpillDirectory;
+};
+} // namespace RDF
+} // namespace ROOT
+
+#endif
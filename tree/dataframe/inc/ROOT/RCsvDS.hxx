@@ -48,14 +48,15 @@ private:
    std::unique_ptr<ROOT::Internal::RRawFile> fCsvFile;
    const char fDelimiter;
    const Long64_t fLinesChunkSize;
-   ULong64_t fEntryRangesRequested = 0ULL;
    ULong64_t fProcessedLines = 0ULL; // marks the progress of the consumption of the csv lines
+   ULong64_t fFirstEntryInChunk = 0ULL; // entry number of the first line in fLines
    std::vector<std::string> fHeaders; // the column names
    std::unordered_map<std::string, ColType_t> fColTypes;
-   std::set<std::string> fColContainingEmpty; // store columns which had empty entry
+   std::vector<std::set<std::string>> fColContainingEmpty; // columns which had an empty entry, per slot
    std::list<ColType_t> fColTypesList; // column types, order is the same as fHeaders, values the same as fColTypes
    std::vector<std::vector<void *>> fColAddresses;         // fColAddresses[column][slot] (same ordering as fHeaders)
-   std::vector<Record_t> fRecords;                         // fRecords[entry][column] (same ordering as fHeaders)
+   std::vector<std::string> fLines; // the lines of the current chunk, parsed by the processing slots in SetEntry
+   std::vector<std::vector<std::string>> fSlotColumns;     // one per slot, the cells of the current line
    std::vector<std::vector<double>> fDoubleEvtValues;      // one per column per slot
    std::vector<std::vector<Long64_t>> fLong64EvtValues;    // one per column per slot
    std::vector<std::vector<std::string>> fStringEvtValues; // one per column per slot
@@ -64,16 +65,15 @@ private:
    std::vector<std::deque<bool>> fBoolEvtValues; // one per column per slot
 
    void FillHeaders(const std::string &);
-   void FillRecord(const std::string &, Record_t &);
    void GenerateHeaders(size_t);
    std::vector<void *> GetColumnReadersImpl(std::string_view, const std::type_info &) final;
    void ValidateColTypes(std::vector<std::string> &) const;
    void InferColTypes(std::vector<std::string> &);
    void InferType(const std::string &, unsigned int);
    std::vector<std::string> ParseColumns(const std::string &);
+   void ParseColumns(const std::string &, std::vector<std::string> &);
    size_t ParseValue(const std::string &, std::vector<std::string> &, size_t);
    ColType_t GetType(std::string_view colName) const;
-   void FreeRecords();
 
 protected:
    std::string AsString() final;
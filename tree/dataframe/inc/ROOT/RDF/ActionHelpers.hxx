@@ -37,6 +37,8 @@
 #include "TError.h" // for R__ASSERT, Warning
 #include "TFile.h" // for SnapshotHelper
 #include "TH1.h"
+#include "TH2.h"
+#include "TH3.h"
 #include "TGraph.h"
 #include "TGraphAsymmErrors.h"
 #include "TLeaf.h"
@@ -48,11 +50,14 @@
 #include "ROOT/RDF/RMergeableValue.hxx"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <functional>
 #include <limits>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <utility> // std::index_sequence
 #include <vector>
@@ -557,6 +562,289 @@ public:
    }
 };
 
+/// Fill a bank of TH1Ds in one action: the i-th element of the values (and weights) column fills the i-th histogram.
+///
+/// Booking one Histo1D per histogram costs one action node per histogram, each with its own column readers and
+/// per-slot histogram copies. This helper instead keeps the bin contents of all histograms of a slot in one contiguous
+/// buffer and fills all of them in a single Exec call, merging the buffers into the result histograms at the end of
+/// the event loop. All histograms must have fixed axis limits.
+class R__CLING_PTRCHECK(off) FillHistoBankHelper : public RActionImpl<FillHistoBankHelper> {
+   /// What is needed to find the bin of a value without touching the result histogram, for fixed-width axes
+   struct RAxisInfo {
+      int fNBins;
+      double fXMin;
+      double fXMax;
+      const TAxis *fVarAxis; ///< The axis of the result histogram if it has variable bin widths, nullptr otherwise
+      std::size_t fOffset;   ///< Offset of the bins of this histogram in the per-slot bin buffers
+      bool fStatOverflows;   ///< Whether under/overflows contribute to the statistics, see TH1::StatOverflows
+   };
+   static constexpr std::size_t fgNStats = 5; ///< Entries, sum of w, sum of w^2, sum of w*x, sum of w*x^2
+
+   std::shared_ptr<std::vector<Hist_t>> fResultHists;
+   std::vector<RAxisInfo> fAxes;
+   bool fHasSumw2;
+   /// Per slot, sum of weights of all bins (including under/overflow) of all histograms, in histogram order
+   std::vector<std::vector<double>> fSumw;
+   /// Per slot, sum of squared weights of all bins of all histograms, empty if the histograms do not store it
+   std::vector<std::vector<double>> fSumw2;
+   /// Per slot, fgNStats statistics per histogram
+   std::vector<std::vector<double>> fStats;
+
+   void CheckSize(std::size_t size) const
+   {
+      if (size != fAxes.size())
+         throw std::runtime_error("Histo1DBank: the values column has " + std::to_string(size) +
+                                  " elements, but the bank contains " + std::to_string(fAxes.size()) + " histograms.");
+   }
+
+   /// Same as TAxis::FindFixBin
+   static int FindBin(const RAxisInfo &axis, double x)
+   {
+      if (axis.fVarAxis)
+         return axis.fVarAxis->FindFixBin(x);
+      if (x < axis.fXMin)
+         return 0;
+      if (!(x < axis.fXMax)) // also catches NaNs
+         return axis.fNBins + 1;
+      return 1 + int(axis.fNBins * (x - axis.fXMin) / (axis.fXMax - axis.fXMin));
+   }
+
+   /// Same as TH1::Fill(x, w) on the i-th histogram of the bank
+   void Fill(unsigned int slot, std::size_t i, double x, double w)
+   {
+      const auto &axis = fAxes[i];
+      const auto bin = FindBin(axis, x);
+      fSumw[slot][axis.fOffset + bin] += w;
+      if (fHasSumw2)
+         fSumw2[slot][axis.fOffset + bin] += w * w;
+      double *stats = &fStats[slot][i * fgNStats];
+      stats[0] += 1.;
+      if ((bin == 0 || bin > axis.fNBins) && !axis.fStatOverflows)
+         return;
+      stats[1] += w;
+      stats[2] += w * w;
+      stats[3] += w * x;
+      stats[4] += w * x * x;
+   }
+
+public:
+   FillHistoBankHelper(const std::shared_ptr<std::vector<Hist_t>> &hists, const unsigned int nSlots);
+   FillHistoBankHelper(FillHistoBankHelper &&) = default;
+   FillHistoBankHelper(const FillHistoBankHelper &) = delete;
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   template <typename T, std::enable_if_t<IsDataContainer<T>::value, int> = 0>
+   void Exec(unsigned int slot, const T &xs)
+   {
+      CheckSize(xs.size());
+      std::size_t i = 0;
+      for (auto x = xs.begin(); x != xs.end(); ++x, ++i)
+         Fill(slot, i, *x, 1.);
+   }
+
+   template <typename T, typename W, std::enable_if_t<IsDataContainer<T>::value && IsDataContainer<W>::value, int> = 0>
+   void Exec(unsigned int slot, const T &xs, const W &ws)
+   {
+      CheckSize(xs.size());
+      CheckSize(ws.size());
+      std::size_t i = 0;
+      auto w = ws.begin();
+      for (auto x = xs.begin(); x != xs.end(); ++x, ++w, ++i)
+         Fill(slot, i, *x, *w);
+   }
+
+   template <typename T, typename W, std::enable_if_t<IsDataContainer<T>::value && !IsDataContainer<W>::value, int> = 0>
+   void Exec(unsigned int slot, const T &xs, const W w)
+   {
+      CheckSize(xs.size());
+      std::size_t i = 0;
+      for (auto x = xs.begin(); x != xs.end(); ++x, ++i)
+         Fill(slot, i, *x, w);
+   }
+
+   void Initialize() { /* noop */}
+
+   void Finalize();
+
+   std::string GetActionName() { return "Histo1DBank\\n" + std::to_string(fAxes.size()) + " histograms"; }
+
+   FillHistoBankHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<std::vector<Hist_t>> *>(newResult);
+      for (auto &h : *result) {
+         h.Reset();
+         h.SetDirectory(nullptr);
+      }
+      return FillHistoBankHelper(result, fSumw.size());
+   }
+};
+
+/// Whether under/overflows contribute to the statistics of h, see TH1::StatOverflows
+bool GetStatOverflowsBehaviour(const ::TH1 &h);
+
+/// Whether Histo2D and Histo3D should fill one histogram shared by all slots with ConcurrentFillHelper instead of
+/// one copy of the histogram per slot with FillHelper
+bool UseConcurrentFill(const ::TH1 &h, unsigned int nSlots);
+
+/// Fill one histogram from all slots, adding to its bins with atomic operations.
+///
+/// FillHelper fills one copy of the histogram per slot and merges them at the end of the event loop, which for large
+/// two- or three-dimensional histograms and many slots takes more memory than the data being processed. This helper
+/// instead keeps a single array of atomic bin contents, plus the per-slot statistics, and copies them into the
+/// result histogram at the end of the event loop. The values are expected to spread over many bins, so that
+/// concurrent additions to the same bin are rare. The axes of the histogram must not be extendable.
+template <typename HIST>
+class R__CLING_PTRCHECK(off) ConcurrentFillHelper : public RActionImpl<ConcurrentFillHelper<HIST>> {
+   static constexpr unsigned int fgDim = std::is_base_of<::TH3, HIST>::value   ? 3
+                                         : std::is_base_of<::TH2, HIST>::value ? 2
+                                                                               : 1;
+   /// Statistics as in TH1::GetStats: sum of w, of w^2, then for each axis of w*x, w*x^2 and w*x times the
+   /// coordinates of the previous axes
+   static constexpr std::size_t fgNStats = 2 + 2 * fgDim + fgDim * (fgDim - 1) / 2;
+
+   std::shared_ptr<HIST> fResultHist;
+   std::array<const TAxis *, fgDim> fAxes;
+   std::array<int, fgDim> fNBins;
+   bool fStatOverflows;
+   bool fIsWeighted; ///< Whether the histogram is filled with a weights column
+   std::unique_ptr<std::atomic<double>[]> fSumw;
+   /// Sum of squared weights of the bins, only allocated when filling with weights
+   std::unique_ptr<std::atomic<double>[]> fSumw2;
+   /// Per slot, number of entries, fgNStats statistics and whether a weight different from 1 was filled
+   std::vector<std::vector<double>> fStats;
+   /// Per slot, a snapshot of the shared bins for the partial result callbacks, created on demand
+   std::vector<std::unique_ptr<HIST>> fPartialResults;
+
+   static void AtomicAdd(std::atomic<double> &a, double x)
+   {
+      double old = a.load(std::memory_order_relaxed);
+      while (!a.compare_exchange_weak(old, old + x, std::memory_order_relaxed))
+         ;
+   }
+
+   /// Same as HIST::Fill(x..., w), except for the buffer and the extension of the axes which are not supported
+   void Fill(unsigned int slot, const double *x, double w)
+   {
+      double *stats = fStats[slot].data();
+      stats[0] += 1.;
+      std::size_t bin = 0;
+      std::size_t stride = 1;
+      bool inRange = true;
+      for (unsigned int d = 0; d < fgDim; ++d) {
+         const int b = fAxes[d]->FindFixBin(x[d]);
+         inRange &= (b > 0 && b <= fNBins[d]);
+         bin += stride * b;
+         stride *= fNBins[d] + 2;
+      }
+      AtomicAdd(fSumw[bin], w);
+      if (fIsWeighted) {
+         AtomicAdd(fSumw2[bin], w * w);
+         if (w != 1.)
+            stats[1 + fgNStats] = 1.;
+      }
+      if (!inRange && !fStatOverflows)
+         return;
+      stats[1] += w;
+      stats[2] += w * w;
+      std::size_t i = 3;
+      for (unsigned int d = 0; d < fgDim; ++d) {
+         stats[i++] += w * x[d];
+         stats[i++] += w * x[d] * x[d];
+         for (unsigned int e = 0; e < d; ++e)
+            stats[i++] += w * x[e] * x[d];
+      }
+   }
+
+public:
+   ConcurrentFillHelper(const std::shared_ptr<HIST> &h, const unsigned int nSlots, bool isWeighted)
+      : fResultHist(h),
+        fStatOverflows(GetStatOverflowsBehaviour(*h)),
+        fIsWeighted(isWeighted),
+        fStats(nSlots, std::vector<double>(fgNStats + 2, 0.)),
+        fPartialResults(nSlots)
+   {
+      const TAxis *axes[3] = {h->GetXaxis(), h->GetYaxis(), h->GetZaxis()};
+      for (unsigned int d = 0; d < fgDim; ++d) {
+         fAxes[d] = axes[d];
+         fNBins[d] = axes[d]->GetNbins();
+      }
+      fSumw = std::make_unique<std::atomic<double>[]>(h->GetNcells());
+      if (fIsWeighted)
+         fSumw2 = std::make_unique<std::atomic<double>[]>(h->GetNcells());
+   }
+   ConcurrentFillHelper(ConcurrentFillHelper &&) = default;
+   ConcurrentFillHelper(const ConcurrentFillHelper &) = delete;
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   template <typename... Ts>
+   void Exec(unsigned int slot, const Ts &...values)
+   {
+      static_assert(sizeof...(Ts) == fgDim || sizeof...(Ts) == fgDim + 1,
+                    "ConcurrentFillHelper: the number of columns does not match the histogram dimension.");
+      const std::array<double, sizeof...(Ts)> x{{static_cast<double>(values)...}};
+      Fill(slot, x.data(), sizeof...(Ts) > fgDim ? x[sizeof...(Ts) - 1] : 1.);
+   }
+
+   void Initialize() { /* noop */}
+
+   void Finalize()
+   {
+      auto &h = *fResultHist;
+      double entries = 0.;
+      std::array<double, fgNStats> stats{};
+      bool hasWeights = false;
+      for (const auto &slotStats : fStats) {
+         entries += slotStats[0];
+         for (std::size_t i = 0; i < fgNStats; ++i)
+            stats[i] += slotStats[1 + i];
+         hasWeights |= slotStats[1 + fgNStats] != 0.;
+      }
+      if (hasWeights && h.GetSumw2N() == 0 && !h.TestBit(TH1::kIsNotW))
+         h.Sumw2();
+      // the result histogram is empty, TH2D and TH3D store their bin contents in their TArrayD base
+      const auto nCells = h.GetNcells();
+      double *sumw2 = h.GetSumw2N() > 0 ? h.GetSumw2()->GetArray() : nullptr;
+      for (Int_t bin = 0; bin < nCells; ++bin) {
+         const double sumw = fSumw[bin].load(std::memory_order_relaxed);
+         h.GetArray()[bin] = sumw;
+         if (sumw2)
+            sumw2[bin] = fIsWeighted ? fSumw2[bin].load(std::memory_order_relaxed) : sumw;
+      }
+      h.PutStats(stats.data());
+      h.SetEntries(entries);
+   }
+
+   HIST &PartialUpdate(unsigned int slot)
+   {
+      auto &partial = fPartialResults[slot];
+      if (!partial) {
+         partial = std::make_unique<HIST>(*fResultHist);
+         partial->SetDirectory(nullptr);
+      }
+      for (Int_t bin = 0; bin < partial->GetNcells(); ++bin)
+         partial->GetArray()[bin] = fSumw[bin].load(std::memory_order_relaxed);
+      partial->ResetStats();
+      return *partial;
+   }
+
+   std::unique_ptr<RMergeableValueBase> GetMergeableValue() const final
+   {
+      return std::make_unique<RMergeableFill<HIST>>(*fResultHist);
+   }
+
+   std::string GetActionName() { return std::string(fResultHist->IsA()->GetName()) + "\\n" + fResultHist->GetName(); }
+
+   ConcurrentFillHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<HIST> *>(newResult);
+      result->Reset();
+      result->SetDirectory(nullptr);
+      return ConcurrentFillHelper(result, fStats.size(), fIsWeighted);
+   }
+};
+
 class R__CLING_PTRCHECK(off) FillTGraphHelper : public ROOT::Detail::RDF::RActionImpl<FillTGraphHelper> {
 public:
    using Result_t = ::TGraph;
@@ -991,6 +1279,180 @@ extern template class TakeHelper<float, float, std::vector<float>>;
 extern template class TakeHelper<double, double, std::vector<double>>;
 #endif
 
+/// Return the name of a new temporary file for a Cache that spills to disk, in the given directory (the system's
+/// temporary directory if empty).
+std::string MakeCacheSpillFileName(const std::string &directory);
+
+/// Approximate number of bytes taken in memory by a cached value, used to enforce the memory budget of a Cache
+template <typename T, std::enable_if_t<!IsDataContainer<T>::value, int> = 0>
+std::size_t CachedValueSize(const T &)
+{
+   return sizeof(T);
+}
+
+template <typename T, std::enable_if_t<IsDataContainer<T>::value, int> = 0>
+std::size_t CachedValueSize(const T &coll)
+{
+   return sizeof(T) + coll.size() * sizeof(typename T::value_type);
+}
+
+inline std::size_t CachedValueSize(const std::string &s)
+{
+   return sizeof(std::string) + s.capacity();
+}
+
+/// The helper of a Cache with a memory budget: cache the values of the selected columns in memory, until the cached
+/// values of all slots exceed the budget. From then on, each slot writes the values it cached so far, and all the
+/// following ones, to a TTree in a temporary file of its own.
+template <typename... ColTypes>
+class R__CLING_PTRCHECK(off) SpillableCacheHelper : public RActionImpl<SpillableCacheHelper<ColTypes...>> {
+public:
+   struct Result_t {
+      std::tuple<std::vector<ColTypes>...> fColumns; ///< The cached values, if none were spilled to disk
+      std::vector<std::string> fSpillFiles;          ///< The files the values were spilled to, if any
+   };
+
+private:
+   struct RSlotCache {
+      std::tuple<std::vector<ColTypes>...> fColumns;
+      ULong64_t fBytes = 0;
+      std::tuple<ColTypes...> fRow; ///< The values written by TTree::Fill once the slot spilled to disk
+      std::string fFileName;
+      std::unique_ptr<TFile> fFile;
+      TTree *fTree = nullptr; ///< Owned by fFile
+   };
+   /// The state shared by all slots. Atomics are not movable, and helpers must be.
+   struct RSharedState {
+      std::atomic<ULong64_t> fBytesInMemory{0};
+      std::atomic<bool> fMustSpill{false};
+   };
+
+   std::shared_ptr<Result_t> fResult;
+   ColumnNames_t fColumnNames;
+   ULong64_t fMemoryBudget;
+   std::string fSpillDirectory;
+   std::vector<RSlotCache> fSlots;
+   std::unique_ptr<RSharedState> fState;
+
+   template <std::size_t... S>
+   void PushBack(RSlotCache &cache, std::index_sequence<S...>, const ColTypes &...values)
+   {
+      std::initializer_list<int> expander{(std::get<S>(cache.fColumns).push_back(values), 0)...};
+      (void)expander;
+   }
+
+   template <std::size_t... S>
+   void Spill(RSlotCache &cache, std::index_sequence<S...>)
+   {
+      cache.fFileName = MakeCacheSpillFileName(fSpillDirectory);
+      // the spill files are only read back once, by the cached dataframe: favour writing speed over size
+      cache.fFile.reset(TFile::Open(cache.fFileName.c_str(), "RECREATE", "", /*compress=*/0));
+      if (!cache.fFile || cache.fFile->IsZombie())
+         throw std::runtime_error("Cache: could not create the temporary file \"" + cache.fFileName +
+                                  "\" to spill the cached values to.");
+      TDirectory::TContext ctxt(cache.fFile.get());
+      cache.fTree = new TTree("rdfcache", "RDataFrame cache");
+      const std::array<TBranch *, sizeof...(S)> branches{
+         {cache.fTree->Branch(fColumnNames[S].c_str(), &std::get<S>(cache.fRow))...}};
+      for (std::size_t i = 0u; i < branches.size(); ++i) {
+         if (branches[i] == nullptr)
+            throw std::runtime_error("Cache: the column \"" + fColumnNames[i] +
+                                     "\" cannot be written to a TTree, so the cache cannot be spilled to disk. "
+                                     "Increase the memory budget or cache a different set of columns.");
+      }
+
+      const auto nEntries = std::get<0>(cache.fColumns).size();
+      for (std::size_t entry = 0u; entry < nEntries; ++entry) {
+         std::initializer_list<int> expander{(std::get<S>(cache.fRow) = std::get<S>(cache.fColumns)[entry], 0)...};
+         (void)expander;
+         cache.fTree->Fill();
+      }
+      // release the memory of the values we just wrote
+      cache.fColumns = std::tuple<std::vector<ColTypes>...>();
+      fState->fBytesInMemory -= cache.fBytes;
+      cache.fBytes = 0;
+   }
+
+   template <std::size_t... S>
+   void MergeInMemory(std::index_sequence<S...>)
+   {
+      for (auto &cache : fSlots) {
+         std::initializer_list<int> expander{
+            (std::get<S>(fResult->fColumns)
+                .insert(std::get<S>(fResult->fColumns).end(), std::make_move_iterator(std::get<S>(cache.fColumns).begin()),
+                        std::make_move_iterator(std::get<S>(cache.fColumns).end())),
+             std::get<S>(cache.fColumns) = std::vector<ColTypes>(), 0)...};
+         (void)expander;
+      }
+   }
+
+public:
+   SpillableCacheHelper(const ColumnNames_t &columnNames, ULong64_t memoryBudget, const std::string &spillDirectory,
+                        unsigned int nSlots)
+      : fResult(std::make_shared<Result_t>()),
+        fColumnNames(columnNames),
+        fMemoryBudget(memoryBudget),
+        fSpillDirectory(spillDirectory),
+        fSlots(nSlots),
+        fState(std::make_unique<RSharedState>())
+   {
+   }
+   SpillableCacheHelper(SpillableCacheHelper &&) = default;
+   SpillableCacheHelper(const SpillableCacheHelper &) = delete;
+
+   std::shared_ptr<Result_t> GetResultPtr() const { return fResult; }
+
+   void Initialize() {}
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   void Exec(unsigned int slot, const ColTypes &...values)
+   {
+      auto &cache = fSlots[slot];
+      if (cache.fTree == nullptr && fState->fMustSpill)
+         Spill(cache, std::index_sequence_for<ColTypes...>());
+
+      if (cache.fTree != nullptr) {
+         cache.fRow = std::tie(values...);
+         cache.fTree->Fill();
+         return;
+      }
+
+      PushBack(cache, std::index_sequence_for<ColTypes...>(), values...);
+      ULong64_t bytes = 0;
+      std::initializer_list<int> expander{(bytes += CachedValueSize(values), 0)...};
+      (void)expander;
+      cache.fBytes += bytes;
+      if ((fState->fBytesInMemory += bytes) > fMemoryBudget)
+         fState->fMustSpill = true;
+   }
+
+   void Finalize()
+   {
+      if (!fState->fMustSpill) {
+         MergeInMemory(std::index_sequence_for<ColTypes...>());
+         return;
+      }
+
+      for (auto &cache : fSlots) {
+         if (cache.fTree == nullptr && !std::get<0>(cache.fColumns).empty())
+            Spill(cache, std::index_sequence_for<ColTypes...>());
+         if (cache.fTree == nullptr)
+            continue;
+         {
+            TDirectory::TContext ctxt(cache.fFile.get());
+            cache.fTree->Write();
+         }
+         cache.fFile->Close();
+         cache.fFile.reset(); // also deletes fTree
+         cache.fTree = nullptr;
+         fResult->fSpillFiles.emplace_back(cache.fFileName);
+      }
+   }
+
+   std::string GetActionName() { return "Cache"; }
+};
+
 template <typename ResultType>
 class R__CLING_PTRCHECK(off) MinHelper : public RActionImpl<MinHelper<ResultType>> {
    std::shared_ptr<ResultType> fResultMin;
@@ -1320,10 +1782,12 @@ void *GetData(ROOT::VecOps::RVec<T> &v)
    return v.data();
 }
 
+/// The address of a value can change from entry to entry too, e.g. when a data source hands out values that live in
+/// its own buffers: it is only compared against the output branches that are registered for address updates.
 template <typename T>
-void *GetData(T & /*v*/)
+void *GetData(T &v)
 {
-   return nullptr;
+   return &v;
 }
 
 template <typename T>
@@ -1350,6 +1814,7 @@ void SetBranchesHelper(TTree *inputTree, TTree &outputTree, const std::string &i
          outputBranch->SetAddress(&branchAddress);
       } else {
          outputBranch->SetAddress(address);
+         branch = outputBranch;
          branchAddress = address;
       }
       return;
@@ -1374,9 +1839,14 @@ void SetBranchesHelper(TTree *inputTree, TTree &outputTree, const std::string &i
       outputBranch = outputTree.Branch(name.c_str(), address);
    }
    outputBranches.Insert(name, outputBranch);
-   // This is not an array branch, so we don't register the address of the output branch here
-   branch = nullptr;
-   branchAddress = nullptr;
+   if (outputBranch->IsA() == TBranch::Class()) {
+      // Register fundamental-type branches, the input value might not live at the same address at every entry
+      branch = outputBranch;
+      branchAddress = address;
+   } else {
+      branch = nullptr;
+      branchAddress = nullptr;
+   }
 }
 
 /// Helper function for SnapshotHelper and SnapshotHelperMT. It creates new branches for the output TTree of a Snapshot.
@@ -1483,6 +1953,8 @@ void SetBranchesHelper(TTree *inputTree, TTree &outputTree, const std::string &i
 
 void ValidateSnapshotOutput(const RSnapshotOptions &opts, const std::string &treeName, const std::string &fileName);
 
+std::string GetPerSlotSnapshotFileName(const std::string &fileName, unsigned int slot);
+
 /// Helper object for a single-thread Snapshot action
 template <typename... ColTypes>
 class R__CLING_PTRCHECK(off) SnapshotHelper : public RActionImpl<SnapshotHelper<ColTypes...>> {
@@ -1546,7 +2018,8 @@ public:
    {
       // This code deals with branches which hold C arrays of variable size. It can happen that the buffers
       // associated to those is re-allocated. As a result the value of the pointer can change therewith
-      // leaving associated to the branch of the output tree an invalid pointer.
+      // leaving associated to the branch of the output tree an invalid pointer. The same holds for fundamental
+      // types read from data sources that expose their own buffers (e.g. the pages of an RNTuple).
       // With this code, we set the value of the pointer in the output branch anew when needed.
       // Nota bene: the extra ",0" after the invocation of SetAddress, is because that method returns void and
       // we need an int for the expander list.
@@ -1638,6 +2111,7 @@ class R__CLING_PTRCHECK(off) SnapshotHelperMT : public RActionImpl<SnapshotHelpe
    unsigned int fNSlots;
    std::unique_ptr<ROOT::TBufferMerger> fMerger; // must use a ptr because TBufferMerger is not movable
    std::vector<std::shared_ptr<ROOT::TBufferMergerFile>> fOutputFiles;
+   std::vector<std::unique_ptr<TFile>> fSlotFiles; // output files of each slot if fOptions.fOutputPerSlot is set
    std::vector<std::unique_ptr<TTree>> fOutputTrees;
    std::vector<int> fBranchAddressesNeedReset; // vector<bool> does not allow concurrent writing of different elements
    std::string fFileName;           // name of the output file name
@@ -1666,19 +2140,33 @@ public:
         fBranchAddresses(fNSlots, std::vector<void *>(vbnames.size(), nullptr)), fOutputBranches(fNSlots),
         fIsDefine(std::move(isDefine))
    {
-      ValidateSnapshotOutput(fOptions, fTreeName, fFileName);
+      if (fOptions.fOutputPerSlot) {
+         for (auto slot = 0u; slot < fNSlots; ++slot)
+            ValidateSnapshotOutput(fOptions, fTreeName, GetPerSlotSnapshotFileName(fFileName, slot));
+      } else {
+         ValidateSnapshotOutput(fOptions, fTreeName, fFileName);
+      }
    }
    SnapshotHelperMT(const SnapshotHelperMT &) = delete;
    SnapshotHelperMT(SnapshotHelperMT &&) = default;
    ~SnapshotHelperMT()
    {
       if (!fTreeName.empty() /*not moved from*/ && fOptions.fLazy &&
-          std::all_of(fOutputFiles.begin(), fOutputFiles.end(), [](const auto &f) { return !f; }) /* never run */)
+          std::all_of(fOutputFiles.begin(), fOutputFiles.end(), [](const auto &f) { return !f; }) &&
+          fSlotFiles.empty() /* never run */)
          Warning("Snapshot", "A lazy Snapshot action was booked but never triggered.");
    }
 
    void InitTask(TTreeReader *r, unsigned int slot)
    {
+      if (fOptions.fOutputPerSlot) {
+         // the output tree of this slot lives for the whole event loop, only its branch addresses need updating
+         if (r)
+            fInputTrees[slot] = r->GetTree();
+         fBranchAddressesNeedReset[slot] = 1;
+         return;
+      }
+
       ::TDirectory::TContext c; // do not let tasks change the thread-local gDirectory
       if (!fOutputFiles[slot]) {
          // first time this thread executes something, let's create a TBufferMerger output directory
@@ -1707,6 +2195,8 @@ public:
 
    void FinalizeTask(unsigned int slot)
    {
+      if (fOptions.fOutputPerSlot)
+         return;
       if (fOutputTrees[slot]->GetEntries() > 0)
          fOutputFiles[slot]->Write();
       // clear now to avoid concurrent destruction of output trees and input tree (which has them listed as fClones)
@@ -1724,6 +2214,8 @@ public:
          fBranchAddressesNeedReset[slot] = 0;
       }
       fOutputTrees[slot]->Fill();
+      if (fOptions.fOutputPerSlot)
+         return; // the output tree flushes its baskets to its own file
       auto entries = fOutputTrees[slot]->GetEntries();
       auto autoFlush = fOutputTrees[slot]->GetAutoFlush();
       if ((autoFlush > 0) && (entries % autoFlush == 0))
@@ -1735,7 +2227,8 @@ public:
    {
       // This code deals with branches which hold C arrays of variable size. It can happen that the buffers
       // associated to those is re-allocated. As a result the value of the pointer can change therewith
-      // leaving associated to the branch of the output tree an invalid pointer.
+      // leaving associated to the branch of the output tree an invalid pointer. The same holds for fundamental
+      // types read from data sources that expose their own buffers (e.g. the pages of an RNTuple).
       // With this code, we set the value of the pointer in the output branch anew when needed.
       // Nota bene: the extra ",0" after the invocation of SetAddress, is because that method returns void and
       // we need an int for the expander list.
@@ -1763,14 +2256,59 @@ public:
    void Initialize()
    {
       const auto cs = ROOT::CompressionSettings(fOptions.fCompressionAlgorithm, fOptions.fCompressionLevel);
+      if (fOptions.fOutputPerSlot) {
+         InitializePerSlotOutput(cs);
+         return;
+      }
       auto out_file = TFile::Open(fFileName.c_str(), fOptions.fMode.c_str(), /*ftitle=*/fFileName.c_str(), cs);
       if(!out_file)
          throw std::runtime_error("Snapshot: could not create output file " + fFileName);
       fMerger = std::make_unique<ROOT::TBufferMerger>(std::unique_ptr<TFile>(out_file));
    }
 
+   /// Create one output file and tree per slot. All files are created, also the ones of slots that will not process
+   /// any entry, so that the dataset returned by Snapshot always consists of the same list of files.
+   void InitializePerSlotOutput(int compressionSettings)
+   {
+      ::TDirectory::TContext c;
+      TString checkupdate = fOptions.fMode;
+      checkupdate.ToLower();
+      fSlotFiles.resize(fNSlots);
+      for (auto slot = 0u; slot < fNSlots; ++slot) {
+         const auto fileName = GetPerSlotSnapshotFileName(fFileName, slot);
+         fSlotFiles[slot].reset(
+            TFile::Open(fileName.c_str(), fOptions.fMode.c_str(), /*ftitle=*/fileName.c_str(), compressionSettings));
+         if (!fSlotFiles[slot])
+            throw std::runtime_error("Snapshot: could not create output file " + fileName);
+
+         TDirectory *outputDir = fSlotFiles[slot].get();
+         if (!fDirName.empty())
+            outputDir = fSlotFiles[slot]->mkdir(fDirName.c_str(), "", /*returnExistingDirectory=*/checkupdate == "update");
+
+         fOutputTrees[slot] =
+            std::make_unique<TTree>(fTreeName.c_str(), fTreeName.c_str(), fOptions.fSplitLevel, /*dir=*/outputDir);
+         fOutputTrees[slot]->SetBit(TTree::kEntriesReshuffled);
+         // TODO can be removed when RDF supports interleaved TBB task execution properly, see ROOT-10269
+         fOutputTrees[slot]->SetImplicitMT(false);
+         if (fOptions.fAutoFlush)
+            fOutputTrees[slot]->SetAutoFlush(fOptions.fAutoFlush);
+      }
+   }
+
    void Finalize()
    {
+      if (fOptions.fOutputPerSlot) {
+         for (auto slot = 0u; slot < fNSlots; ++slot) {
+            // use AutoSave to flush TTree contents because TTree::Write writes in gDirectory, not in fDirectory
+            fOutputTrees[slot]->AutoSave("flushbaskets");
+            // must destroy the TTree first, otherwise TFile will delete it too leading to a double delete
+            fOutputTrees[slot].reset();
+            fOutputBranches[slot].Clear();
+            fSlotFiles[slot]->Close();
+         }
+         return;
+      }
+
       assert(std::any_of(fOutputFiles.begin(), fOutputFiles.end(), [](const auto &ptr) { return ptr != nullptr; }));
 
       auto fileWritten = false;
@@ -14,6 +14,7 @@
 #include "RColumnRegister.hxx"
 #include <ROOT/RDF/RAction.hxx>
 #include <ROOT/RDF/ActionHelpers.hxx> // for BuildAction
+#include <ROOT/RDF/HistoModels.hxx>
 #include <ROOT/RDF/RColumnRegister.hxx>
 #include <ROOT/RDF/RDefine.hxx>
 #include <ROOT/RDF/RDefinePerSample.hxx>
@@ -90,6 +91,7 @@ public:
 /// This namespace defines types to be used for tag dispatching in RInterface.
 namespace ActionTags {
 struct Histo1D{};
+struct Histo1DBank{};
 struct Histo2D{};
 struct Histo3D{};
 struct HistoND{};
@@ -155,6 +157,53 @@ BuildAction(const ColumnNames_t &bl, const std::shared_ptr<::TH1D> &h, const uns
    }
 }
 
+// Histo2D and Histo3D filling (large histograms are filled concurrently by all slots instead of one copy per slot)
+template <typename HIST, typename... ColTypes, typename PrevNodeType>
+std::unique_ptr<RActionBase>
+BuildConcurrentOrPerSlotFillAction(const ColumnNames_t &bl, const std::shared_ptr<HIST> &h, const unsigned int nSlots,
+                                   std::shared_ptr<PrevNodeType> prevNode, const RColumnRegister &colRegister)
+{
+   constexpr bool hasContainers = Disjunction<IsDataContainer<ColTypes>...>::value;
+   if constexpr (!hasContainers) {
+      if (IsImplicitMTEnabled() && UseConcurrentFill(*h, nSlots)) {
+         constexpr bool isWeighted = sizeof...(ColTypes) > (std::is_base_of<::TH3, HIST>::value ? 3u : 2u);
+         using Helper_t = ConcurrentFillHelper<HIST>;
+         using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
+         return std::make_unique<Action_t>(Helper_t(h, nSlots, isWeighted), bl, std::move(prevNode), colRegister);
+      }
+   }
+   using Helper_t = FillHelper<HIST>;
+   using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
+   return std::make_unique<Action_t>(Helper_t(h, nSlots), bl, std::move(prevNode), colRegister);
+}
+
+template <typename... ColTypes, typename PrevNodeType>
+std::unique_ptr<RActionBase>
+BuildAction(const ColumnNames_t &bl, const std::shared_ptr<::TH2D> &h, const unsigned int nSlots,
+            std::shared_ptr<PrevNodeType> prevNode, ActionTags::Histo2D, const RColumnRegister &colRegister)
+{
+   return BuildConcurrentOrPerSlotFillAction<::TH2D, ColTypes...>(bl, h, nSlots, std::move(prevNode), colRegister);
+}
+
+template <typename... ColTypes, typename PrevNodeType>
+std::unique_ptr<RActionBase>
+BuildAction(const ColumnNames_t &bl, const std::shared_ptr<::TH3D> &h, const unsigned int nSlots,
+            std::shared_ptr<PrevNodeType> prevNode, ActionTags::Histo3D, const RColumnRegister &colRegister)
+{
+   return BuildConcurrentOrPerSlotFillAction<::TH3D, ColTypes...>(bl, h, nSlots, std::move(prevNode), colRegister);
+}
+
+// Histo1DBank filling
+template <typename... ColTypes, typename PrevNodeType>
+std::unique_ptr<RActionBase>
+BuildAction(const ColumnNames_t &bl, const std::shared_ptr<std::vector<::TH1D>> &hists, const unsigned int nSlots,
+            std::shared_ptr<PrevNodeType> prevNode, ActionTags::Histo1DBank, const RColumnRegister &colRegister)
+{
+   using Helper_t = FillHistoBankHelper;
+   using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
+   return std::make_unique<Action_t>(Helper_t(hists, nSlots), bl, std::move(prevNode), colRegister);
+}
+
 template <typename... ColTypes, typename PrevNodeType>
 std::unique_ptr<RActionBase>
 BuildAction(const ColumnNames_t &bl, const std::shared_ptr<TGraph> &g, const unsigned int nSlots,
@@ -368,6 +417,10 @@ std::shared_ptr<T> *MakeSharedOnHeap(const std::shared_ptr<T> &shPtr)
 
 bool AtLeastOneEmptyString(const std::vector<std::string_view> strings);
 
+std::shared_ptr<std::vector<::TH1D>> MakeHistoBank(const std::vector<ROOT::RDF::TH1DModel> &models);
+
+std::unique_ptr<TTree> MakeSpilledCacheChain(const std::vector<std::string> &fileNames);
+
 /// Take a shared_ptr<AnyNodeType> and return a shared_ptr<RNodeBase>.
 /// This works for RLoopManager nodes as well as filters and ranges.
 std::shared_ptr<RNodeBase> UpcastNode(std::shared_ptr<RNodeBase> ptr);
@@ -101,6 +101,7 @@ public:
    template <typename... ColTypes, std::size_t... S>
    void CallExec(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>)
    {
+      RScopedNodeTimer timer(fProfile, slot);
       ROOT::Internal::RDF::CallGuaranteedOrder{[&](auto &&...args) { return fHelper.Exec(slot, args...); },
                                                fValues[slot][S]->template Get<ColTypes>(entry)...};
       (void)entry; // avoid unused parameter warning (gcc 12.1)
@@ -113,8 +114,20 @@ public:
          CallExec(slot, entry, ColumnTypes_t{}, TypeInd_t{});
    }
 
+   void RunBulk(unsigned int slot, RMaskedEntryRange &mask) final
+   {
+      fPrevNode.CheckFiltersBulk(slot, mask);
+      const auto firstEntry = mask.FirstEntry();
+      for (std::size_t i = 0u; i < mask.Size(); ++i) {
+         if (mask[i])
+            CallExec(slot, firstEntry + i, ColumnTypes_t{}, TypeInd_t{});
+      }
+   }
+
    void TriggerChildrenCount() final { fPrevNode.IncrChildrenCount(); }
 
+   std::string GetActionName() final { return fHelper.GetActionName(); }
+
    /// Clean-up operations to be performed at the end of a task.
    void FinalizeSlot(unsigned int slot) final
    {
@@ -138,8 +151,8 @@ public:
 
       // Action nodes do not need to go through CreateFilterNode: they are never common nodes between multiple branches
       const auto nodeType = HasRun() ? RDFGraphDrawing::ENodeType::kUsedAction : RDFGraphDrawing::ENodeType::kAction;
-      auto thisNode =
-         std::make_shared<RDFGraphDrawing::GraphNode>(fHelper.GetActionName(), visitedMap.size(), nodeType);
+      auto thisNode = std::make_shared<RDFGraphDrawing::GraphNode>(
+         fHelper.GetActionName() + GetProfileLabel(fProfile), visitedMap.size(), nodeType);
       visitedMap[(void *)this] = thisNode;
 
       auto upmostNode = AddDefinesToGraph(thisNode, GetColRegister(), prevColumns, visitedMap);
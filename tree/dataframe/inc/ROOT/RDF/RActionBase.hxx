@@ -12,6 +12,8 @@
 #define ROOT_RACTIONBASE
 
 #include "ROOT/RDF/RColumnRegister.hxx"
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
+#include "ROOT/RDF/RProfiler.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 #include "RtypesCore.h"
@@ -42,6 +44,8 @@ protected:
    /// A raw pointer to the RLoopManager at the root of this functional graph.
    /// Never null: children nodes have shared ownership of parent nodes in the graph.
    RLoopManager *fLoopManager;
+   /// Time spent in this action, filled when profiling is enabled.
+   RNodeProfile fProfile;
 
 private:
    const unsigned int fNSlots; ///< Number of thread slots used by this node.
@@ -64,6 +68,16 @@ public:
    RLoopManager *GetLoopManager() { return fLoopManager; }
    unsigned int GetNSlots() const { return fNSlots; }
    virtual void Run(unsigned int slot, Long64_t entry) = 0;
+   /// Run the action on the entries of `mask` that are flagged and pass all upstream filters.
+   /// Used by the bulk event loop: the default implementation calls Run for each flagged entry.
+   virtual void RunBulk(unsigned int slot, RMaskedEntryRange &mask)
+   {
+      const auto firstEntry = mask.FirstEntry();
+      for (std::size_t i = 0u; i < mask.Size(); ++i) {
+         if (mask[i])
+            Run(slot, firstEntry + i);
+      }
+   }
    virtual void Initialize() = 0;
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    virtual void TriggerChildrenCount() = 0;
@@ -76,6 +90,9 @@ public:
    // overridden by RJittedAction
    virtual bool HasRun() const { return fHasRun; }
    virtual void SetHasRun() { fHasRun = true; }
+   virtual RNodeProfile &GetProfile() { return fProfile; }
+   /// Return the name of the action, e.g. "Histo1D".
+   virtual std::string GetActionName() { return "Action"; }
 
    virtual std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode>
    GetGraph(std::unordered_map<void *, std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode>> &visitedMap) = 0;
@@ -103,6 +103,8 @@ public:
 
    RDFDetail::RDefineBase *GetDefine(std::string_view colName) const;
 
+   std::string GetColumnIdentity(const std::string &colName) const;
+
    bool IsDefineOrAlias(std::string_view name) const;
 
    void AddDefine(std::shared_ptr<RDFDetail::RDefineBase> column);
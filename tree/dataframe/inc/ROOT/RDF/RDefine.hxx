@@ -70,28 +70,28 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
    /// The map key is the full variation name, e.g. "pt:up".
    std::unordered_map<std::string, std::unique_ptr<RDefineBase>> fVariedDefines;
 
+   /// Per-slot values for the entries of the current bulk, used instead of fLastResults in bulk mode.
+   std::vector<ValuesPerSlot_t> fBulkResults;
+
    template <typename... ColTypes, std::size_t... S>
-   void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, NoneTag)
+   ret_type EvalHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, NoneTag)
    {
-      fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
-         fExpression(fValues[slot][S]->template Get<ColTypes>(entry)...);
+      return fExpression(fValues[slot][S]->template Get<ColTypes>(entry)...);
       (void)entry; // avoid unused parameter warning (gcc 12.1)
    }
 
    template <typename... ColTypes, std::size_t... S>
-   void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, SlotTag)
+   ret_type EvalHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, SlotTag)
    {
-      fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
-         fExpression(slot, fValues[slot][S]->template Get<ColTypes>(entry)...);
+      return fExpression(slot, fValues[slot][S]->template Get<ColTypes>(entry)...);
       (void)entry; // avoid unused parameter warning (gcc 12.1)
    }
 
    template <typename... ColTypes, std::size_t... S>
-   void
-   UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, SlotAndEntryTag)
+   ret_type
+   EvalHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, SlotAndEntryTag)
    {
-      fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
-         fExpression(slot, entry, fValues[slot][S]->template Get<ColTypes>(entry)...);
+      return fExpression(slot, entry, fValues[slot][S]->template Get<ColTypes>(entry)...);
    }
 
 public:
@@ -99,7 +99,8 @@ public:
            const RDFInternal::RColumnRegister &colRegister, RLoopManager &lm,
            const std::string &variationName = "nominal")
       : RDefineBase(name, type, colRegister, lm, columns, variationName), fExpression(std::move(expression)),
-        fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<ret_type>()), fValues(lm.GetNSlots())
+        fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<ret_type>()), fValues(lm.GetNSlots()),
+        fBulkResults(lm.GetNSlots())
    {
       fLoopManager->Register(this);
    }
@@ -113,6 +114,7 @@ public:
       RDFInternal::RColumnReadersInfo info{fColumnNames, fColRegister, fIsDefine.data(), *fLoopManager};
       fValues[slot] = RDFInternal::GetColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
       fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+      fBulkEvaluated[slot].Clear();
    }
 
    /// Return the (type-erased) address of the Define'd value for the given processing slot.
@@ -126,11 +128,34 @@ public:
    {
       if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
          // evaluate this define expression, cache the result
-         UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
+         RDFInternal::RScopedNodeTimer timer(fProfile, slot);
+         fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
+            EvalHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
          fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = entry;
       }
    }
 
+   void *UpdateAndGetValuePtr(unsigned int slot, Long64_t entry) final
+   {
+      auto &evaluated = fBulkEvaluated[slot];
+      if (!evaluated.Contains(entry)) {
+         Update(slot, entry);
+         return GetValuePtr(slot);
+      }
+      // in bulk mode each entry of the bulk has its own value, so that actions running one after the other on the
+      // same bulk of entries see the same values without evaluating the expression more than once per entry
+      auto &values = fBulkResults[slot];
+      if (values.size() < evaluated.Size())
+         values.resize(evaluated.Size());
+      const auto i = entry - evaluated.FirstEntry();
+      if (!evaluated[i]) {
+         RDFInternal::RScopedNodeTimer timer(fProfile, slot);
+         values[i] = EvalHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
+         evaluated[i] = 1;
+      }
+      return static_cast<void *>(&values[i]);
+   }
+
    void Update(unsigned int /*slot*/, const ROOT::RDF::RSampleInfo &/*id*/) final {}
 
    const std::type_info &GetTypeId() const final { return typeid(ret_type); }
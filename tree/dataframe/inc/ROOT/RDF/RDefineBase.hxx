@@ -13,6 +13,8 @@
 
 #include "ROOT/RDF/GraphNode.hxx"
 #include "ROOT/RDF/RColumnRegister.hxx"
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
+#include "ROOT/RDF/RProfiler.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RVec.hxx"
@@ -48,6 +50,11 @@ protected:
    ROOT::RVecB fIsDefine;
    std::vector<std::string> fVariationDeps; ///< List of systematic variations that affect the value of this define.
    std::string fVariation;                  ///< This indicates for what variation this define evaluates values.
+   /// Per slot, whether the value of each entry of the current bulk has been evaluated already.
+   /// Empty unless the event loop runs in bulk mode.
+   std::vector<RDFInternal::RMaskedEntryRange> fBulkEvaluated;
+   /// Time spent evaluating this define, filled when profiling is enabled.
+   RDFInternal::RNodeProfile fProfile;
 
 public:
    RDefineBase(std::string_view name, std::string_view type, const RDFInternal::RColumnRegister &colRegister,
@@ -61,9 +68,25 @@ public:
    virtual void *GetValuePtr(unsigned int slot) = 0;
    virtual const std::type_info &GetTypeId() const = 0;
    std::string GetName() const;
+   const ColumnNames_t &GetColumnNames() const { return fColumnNames; }
+   const RDFInternal::RColumnRegister &GetColRegister() const { return fColRegister; }
+   RDFInternal::RNodeProfile &GetProfile() { return fProfile; }
+   const RDFInternal::RNodeProfile &GetProfile() const { return fProfile; }
    std::string GetTypeName() const;
    /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
    virtual void Update(unsigned int slot, Long64_t entry) = 0;
+   /// Return the (type-erased) address of the Define'd value for the given processing slot and entry, evaluating it if
+   /// needed. In bulk mode every entry of the current bulk has its own address.
+   virtual void *UpdateAndGetValuePtr(unsigned int slot, Long64_t entry)
+   {
+      Update(slot, entry);
+      return GetValuePtr(slot);
+   }
+   /// Start a new bulk of entries for the given slot, invalidating the values cached for the previous one.
+   void SetBulkRange(unsigned int slot, Long64_t firstEntry, std::size_t nEntries)
+   {
+      fBulkEvaluated[slot].Reset(firstEntry, nEntries, 0);
+   }
    /// Update function to be called once per sample, used if the derived type is a RDefinePerSample
    virtual void Update(unsigned int /*slot*/, const ROOT::RDF::RSampleInfo &/*id*/) {}
    /// Clean-up operations to be performed at the end of a task.
@@ -64,6 +64,8 @@ public:
       // no-op
    }
 
+   void *UpdateAndGetValuePtr(unsigned int slot, Long64_t) final { return GetValuePtr(slot); }
+
    /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
    void Update(unsigned int slot, const ROOT::RDF::RSampleInfo &id) final
    {
@@ -91,21 +91,45 @@ public:
    bool CheckFilters(unsigned int slot, Long64_t entry) final
    {
       if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
-         if (!fPrevNode.CheckFilters(slot, entry)) {
-            // a filter upstream returned false, cache the result
-            fLastResult[slot * RDFInternal::CacheLineStep<int>()] = false;
-         } else {
-            // evaluate this filter, cache the result
-            auto passed = CheckFilterHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
-            passed ? ++fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()]
-                   : ++fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()];
-            fLastResult[slot * RDFInternal::CacheLineStep<int>()] = passed;
+         auto &bulkResults = fBulkResults[slot];
+         if (bulkResults.Contains(entry)) {
+            // in bulk mode results are cached for all the entries of the current bulk
+            auto &result = bulkResults[entry - bulkResults.FirstEntry()];
+            if (result < 0)
+               result = EvalFilter(slot, entry);
+            return result;
          }
+         fLastResult[slot * RDFInternal::CacheLineStep<int>()] = EvalFilter(slot, entry);
          fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = entry;
       }
       return fLastResult[slot * RDFInternal::CacheLineStep<int>()];
    }
 
+   void CheckFiltersBulk(unsigned int slot, RDFInternal::RMaskedEntryRange &mask) final
+   {
+      const auto firstEntry = mask.FirstEntry();
+      for (std::size_t i = 0u; i < mask.Size(); ++i) {
+         if (mask[i])
+            mask[i] = CheckFilters(slot, firstEntry + i);
+      }
+   }
+
+   /// Check the upstream filters and then this one for the given entry, updating the cut-flow counters.
+   bool EvalFilter(unsigned int slot, Long64_t entry)
+   {
+      // a filter upstream returned false
+      if (!fPrevNode.CheckFilters(slot, entry))
+         return false;
+      bool passed;
+      {
+         RDFInternal::RScopedNodeTimer timer(fProfile, slot);
+         passed = CheckFilterHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+      }
+      passed ? ++fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()]
+             : ++fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()];
+      return passed;
+   }
+
    template <typename... ColTypes, std::size_t... S>
    bool CheckFilterHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>)
    {
@@ -120,6 +144,7 @@ public:
       RDFInternal::RColumnReadersInfo info{fColumnNames, fColRegister, fIsDefine.data(), *fLoopManager};
       fValues[slot] = RDFInternal::GetColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
       fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+      fBulkResults[slot].Clear();
    }
 
    // recursive chain of `Report`s
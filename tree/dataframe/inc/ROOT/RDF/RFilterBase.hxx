@@ -13,6 +13,7 @@
 
 #include "ROOT/RDF/RColumnRegister.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
+#include "ROOT/RDF/RProfiler.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 #include "ROOT/RVec.hxx"
 #include "RtypesCore.h"
@@ -48,6 +49,11 @@ protected:
    ROOT::RVecB fIsDefine;
    std::string fVariation; ///< This indicates for what variation this filter evaluates values.
    std::unordered_map<std::string, std::shared_ptr<RFilterBase>> fVariedFilters;
+   /// Results per slot for the current bulk of entries: -1 if not evaluated yet, otherwise whether the entry passed.
+   /// Empty unless the event loop runs in bulk mode.
+   std::vector<RDFInternal::RMaskedEntryRange> fBulkResults;
+   /// Time spent evaluating this filter, filled when profiling is enabled.
+   RDFInternal::RNodeProfile fProfile;
 
 public:
    RFilterBase(RLoopManager *df, std::string_view name, const unsigned int nSlots,
@@ -60,6 +66,10 @@ public:
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    bool HasName() const;
    std::string GetName() const;
+   const ColumnNames_t &GetColumnNames() const { return fColumnNames; }
+   const RDFInternal::RColumnRegister &GetColRegister() const { return fColRegister; }
+   RDFInternal::RNodeProfile &GetProfile() { return fProfile; }
+   const RDFInternal::RNodeProfile &GetProfile() const { return fProfile; }
    virtual void FillReport(ROOT::RDF::RCutFlowReport &) const;
    virtual void TriggerChildrenCount() = 0;
    virtual void ResetReportCount()
@@ -72,6 +82,11 @@ public:
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinalizeSlot(unsigned int slot) = 0;
    virtual void InitNode();
+   /// Start a new bulk of entries for the given slot, invalidating the results cached for the previous one.
+   void SetBulkRange(unsigned int slot, Long64_t firstEntry, std::size_t nEntries)
+   {
+      fBulkResults[slot].Reset(firstEntry, nEntries, -1);
+   }
 };
 
 } // ns RDF
@@ -15,6 +15,7 @@
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/RDatasetSpec.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
+#include "ROOT/RDF/RProfiler.hxx"
 #include "ROOT/RDF/RNewSampleNotifier.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 #include "ROOT/RDF/Utils.hxx"
@@ -36,6 +37,8 @@ class TTreeReader;
 class TDirectory;
 
 namespace ROOT {
+class TTreeProcessorMT;
+
 namespace RDF {
 class RCutFlowReport;
 class RDataSource;
@@ -107,6 +110,8 @@ namespace RDFInternal = ROOT::Internal::RDF;
 class RFilterBase;
 class RRangeBase;
 class RDefineBase;
+class RJittedDefine;
+class RJittedFilter;
 using ROOT::RDF::RDataSource;
 
 /// The head node of a RDF computation graph.
@@ -157,6 +162,10 @@ class RLoopManager : public RNodeBase {
    RDFInternal::RNewSampleNotifier fNewSampleNotifier;
    std::vector<ROOT::RDF::RSampleInfo> fSampleInfos;
    unsigned int fNRuns{0}; ///< Number of event loops run
+   /// Number of entries processed at a time by each node in the bulk event loop. 1 means entry-by-entry processing.
+   std::size_t fBulkSize{1};
+   /// Scratch masks (one per slot) passed to the actions by the bulk event loop.
+   std::vector<RDFInternal::RMaskedEntryRange> fBulkMasks;
 
    /// Readers for TTree/RDataSource columns (one per slot), shared by all nodes in the computation graph.
    std::vector<std::unordered_map<std::string, std::unique_ptr<RColumnReaderBase>>> fDatasetColumnReaders;
@@ -164,21 +173,40 @@ class RLoopManager : public RNodeBase {
    /// Cache of the tree/chain branch names. Never access directy, always use GetBranchNames().
    ColumnNames_t fValidBranchNames;
 
+   /// Dataset columns read by the computation graph in the current event loop, with the number of nodes reading them.
+   /// Filled right before the event loop starts, see GetDatasetColumnReadCounts().
+   std::map<std::string, unsigned int> fColumnReadCounts;
+
+   /// Profiling information of the event loops, null unless EnableProfiling was called.
+   std::unique_ptr<ROOT::Internal::RDF::RProfiler> fProfiler;
+
    ROOT::Internal::TreeUtils::RNoCleanupNotifier fNoCleanupNotifier;
 
+   struct RPreparedRun;
+   /// Inputs of the next multi-thread event loop over TTrees, being prepared in the background. See PrepareRun().
+   std::unique_ptr<RPreparedRun> fPreparedRun;
+
+   /// Sequence number of the last code snippet that this RLoopManager scheduled for jitting, see ToJitExec().
+   mutable ULong64_t fLastSnippetToJit = 0;
+
    void RunEmptySourceMT();
    void RunEmptySource();
-   void RunTreeProcessorMT();
+   std::unique_ptr<ROOT::TTreeProcessorMT> MakeTreeProcessorMT();
+   void RunTreeProcessorMT(ROOT::TTreeProcessorMT &tp);
    void RunTreeReader();
    void RunDataSourceMT();
    void RunDataSource();
    void RunAndCheckFilters(unsigned int slot, Long64_t entry);
+   void RunAndCheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t nEntries);
+   bool CanRunBulk() const;
    void InitNodeSlots(TTreeReader *r, unsigned int slot);
    void InitNodes();
    void CleanUpNodes();
    void CleanUpTask(TTreeReader *r, unsigned int slot);
    void EvalChildrenCounts();
    void SetupSampleCallbacks(TTreeReader *r, unsigned int slot);
+   void SetupTreeCache(TTreeReader &r);
+   void StartProfiling();
    void UpdateSampleInfo(unsigned int slot, const std::pair<ULong64_t, ULong64_t> &range);
    void UpdateSampleInfo(unsigned int slot, TTreeReader &r);
 
@@ -188,6 +216,11 @@ class RLoopManager : public RNodeBase {
    std::set<std::pair<std::string_view, std::unique_ptr<ROOT::Internal::RDF::RVariationsWithReaders>>>
       fUniqueVariationsWithReaders;
 
+   /// Jitted Define and unnamed Filter nodes, by a key that identifies their expression and inputs (see BookDefineJit
+   /// and BookFilterJit). Identical nodes booked in different places of the computation graph are shared.
+   std::unordered_map<std::string, std::weak_ptr<RJittedDefine>> fSharedJittedDefines;
+   std::unordered_map<std::string, std::weak_ptr<RJittedFilter>> fSharedJittedFilters;
+
 public:
    RLoopManager(TTree *tree, const ColumnNames_t &defaultBranches);
    RLoopManager(std::unique_ptr<TTree> tree, const ColumnNames_t &defaultBranches);
@@ -201,11 +234,12 @@ public:
    RLoopManager &operator=(const RLoopManager &) = delete;
    RLoopManager(RLoopManager &&) = delete;
    RLoopManager &operator=(RLoopManager &&) = delete;
-   ~RLoopManager() = default;
+   ~RLoopManager();
 
    void JitDeclarations();
    void Jit();
    RLoopManager *GetLoopManagerUnchecked() final { return this; }
+   void PrepareRun();
    void Run(bool jit = true);
    const ColumnNames_t &GetDefaultColumnNames() const;
    TTree *GetTree() const;
@@ -223,6 +257,8 @@ public:
    void Register(RDFInternal::RVariationBase *varPtr);
    void Deregister(RDFInternal::RVariationBase *varPtr);
    bool CheckFilters(unsigned int, Long64_t) final;
+   /// End of recursive chain of calls: all entries pass, the mask is left untouched
+   void CheckFiltersBulk(unsigned int, RDFInternal::RMaskedEntryRange &) final {}
    unsigned int GetNSlots() const { return fNSlots; }
    void Report(ROOT::RDF::RCutFlowReport &rep) const final;
    /// End of recursive chain of calls, does nothing
@@ -233,6 +269,8 @@ public:
    void ToJitExec(const std::string &) const;
    void RegisterCallback(ULong64_t everyNEvents, std::function<void(unsigned int)> &&f);
    unsigned int GetNRuns() const { return fNRuns; }
+   void SetBulkSize(std::size_t bulkSize);
+   std::size_t GetBulkSize() const { return fBulkSize; }
    bool HasDataSourceColumnReaders(const std::string &col, const std::type_info &ti) const;
    void AddDataSourceColumnReaders(const std::string &col, std::vector<std::unique_ptr<RColumnReaderBase>> &&readers,
                                    const std::type_info &ti);
@@ -256,6 +294,10 @@ public:
    GetGraph(std::unordered_map<void *, std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode>> &visitedMap) final;
 
    const ColumnNames_t &GetBranchNames();
+   std::map<std::string, unsigned int> GetDatasetColumnReadCounts();
+
+   void EnableProfiling();
+   std::string GetProfileReport() const;
 
    void AddSampleCallback(void *nodePtr, ROOT::RDF::SampleCallback_t &&callback);
 
@@ -273,6 +315,14 @@ public:
    {
       return fUniqueVariationsWithReaders;
    }
+   std::unordered_map<std::string, std::weak_ptr<RJittedDefine>> &GetSharedJittedDefines()
+   {
+      return fSharedJittedDefines;
+   }
+   std::unordered_map<std::string, std::weak_ptr<RJittedFilter>> &GetSharedJittedFilters()
+   {
+      return fSharedJittedFilters;
+   }
 };
 
 /// \brief Create an RLoopManager that reads a TChain.
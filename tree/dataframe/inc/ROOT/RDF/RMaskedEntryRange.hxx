@@ -0,0 +1,59 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RMASKEDENTRYRANGE
+#define ROOT_RDF_RMASKEDENTRYRANGE
+
+#include <RtypesCore.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/**
+\class ROOT::Internal::RDF::RMaskedEntryRange
+\ingroup dataframe
+\brief A contiguous range of entries with one flag per entry.
+
+Used by the bulk event loop: actions and filters receive a range in which the flag of each entry tells whether it is
+still selected, filters and defines use it to cache per-entry results for the current bulk of entries.
+**/
+class RMaskedEntryRange {
+   std::vector<char> fMask; ///< One flag per entry in the range (a std::vector<bool> cannot be written to by reference)
+   Long64_t fBegin = -1;    ///< Entry number of the first entry in the range, -1 if the range is empty
+
+public:
+   /// Make this range start at `begin` and contain `size` entries, all flagged with `value`.
+   void Reset(Long64_t begin, std::size_t size, char value = 1)
+   {
+      fBegin = begin;
+      fMask.assign(size, value);
+   }
+   void Clear()
+   {
+      fBegin = -1;
+      fMask.clear();
+   }
+   Long64_t FirstEntry() const { return fBegin; }
+   std::size_t Size() const { return fMask.size(); }
+   bool Contains(Long64_t entry) const
+   {
+      return entry >= fBegin && entry < fBegin + static_cast<Long64_t>(fMask.size());
+   }
+   char &operator[](std::size_t i) { return fMask[i]; }
+   char operator[](std::size_t i) const { return fMask[i]; }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -17,8 +17,10 @@
 #ifndef ROOT_RDF_RMERGEABLEVALUE
 #define ROOT_RDF_RMERGEABLEVALUE
 
-#include <algorithm> // std::find, std::min, std::max
-#include <iterator>  // std::distance
+#include <algorithm>  // std::find, std::min, std::max
+#include <cstddef>
+#include <functional> // ROOT::Internal::RDF::TreeReduce
+#include <iterator>   // std::distance
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -29,6 +31,14 @@
 #include "TList.h"  // RMergeableFill::Merge
 
 namespace ROOT {
+namespace Internal {
+namespace RDF {
+/// Call `mergeInto(to, from)` on the pairs of `nValues` elements like in a binary tree, so that all elements are
+/// merged into the first one. The merges of each level of the tree run in parallel if implicit MT is enabled.
+void TreeReduce(std::size_t nValues, const std::function<void(std::size_t, std::size_t)> &mergeInto);
+} // namespace RDF
+} // namespace Internal
+
 namespace Detail {
 namespace RDF {
 
@@ -769,6 +779,42 @@ void MergeValues(RMergeableValue<T> &OutputMergeable, const RMergeableValue<Ts>
    (void)expander{0, (OutputMergeable.Merge(InputMergeables), 0)...};
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Merge a collection of RMergeableValue objects into one.
+/// \param[in] InputMergeables The mergeables containing the partial results.
+/// \returns An RMergeableValue holding the aggregated value wrapped in an
+///          `std::unique_ptr`.
+/// \throws std::invalid_argument If the collection is empty.
+///
+/// The mergeables are merged in pairs, then the results of those merges in
+/// pairs, and so on, following a binary tree. The merges of each level of the
+/// tree are independent and run in parallel if implicit multi-threading is
+/// enabled. Each mergeable is destroyed as soon as it has been merged into
+/// another one, so memory usage decreases while the merge progresses. This is
+/// meant for merging many partial results at once, e.g. those of distributed
+/// tasks.
+///
+/// Example usage:
+/// ~~~{.cpp}
+/// using namespace ROOT::Detail::RDF;
+/// // partialResults is a std::vector<std::unique_ptr<RMergeableValue<TH1D>>>
+/// auto mergedptr = MergeValues(std::move(partialResults));
+/// const auto &mergedhisto = mergedptr->GetValue(); // Final merged histogram
+/// ~~~
+template <typename T>
+std::unique_ptr<RMergeableValue<T>> MergeValues(std::vector<std::unique_ptr<RMergeableValue<T>>> InputMergeables)
+{
+   if (InputMergeables.empty())
+      throw std::invalid_argument("At least one mergeable is needed.");
+
+   ROOT::Internal::RDF::TreeReduce(InputMergeables.size(), [&InputMergeables](std::size_t to, std::size_t from) {
+      MergeValues(*InputMergeables[to], *InputMergeables[from]);
+      InputMergeables[from].reset();
+   });
+
+   return std::move(InputMergeables.front());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief Merge multiple RMergeableVariations objects into one.
 /// \param[in,out] OutputMergeable The mergeable object where all the
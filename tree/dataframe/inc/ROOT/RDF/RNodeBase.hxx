@@ -11,6 +11,7 @@
 #ifndef ROOT_RDFNODEBASE
 #define ROOT_RDFNODEBASE
 
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "RtypesCore.h"
 #include "TError.h" // R__ASSERT
 
@@ -54,6 +55,16 @@ public:
    }
    virtual ~RNodeBase() {}
    virtual bool CheckFilters(unsigned int, Long64_t) = 0;
+   /// Clear the flag of the entries of `mask` that do not pass the filters of this node and of its parents.
+   /// On input, only flagged entries are checked: the default implementation calls CheckFilters for each of them.
+   virtual void CheckFiltersBulk(unsigned int slot, ROOT::Internal::RDF::RMaskedEntryRange &mask)
+   {
+      const auto firstEntry = mask.FirstEntry();
+      for (std::size_t i = 0u; i < mask.Size(); ++i) {
+         if (mask[i])
+            mask[i] = CheckFilters(slot, firstEntry + i);
+      }
+   }
    virtual void Report(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void PartialReport(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void IncrChildrenCount() = 0;
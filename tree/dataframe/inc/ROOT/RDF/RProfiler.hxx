@@ -0,0 +1,199 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RPROFILER
+#define ROOT_RDF_RPROFILER
+
+#include "ROOT/RDF/RColumnReaderBase.hxx"
+#include "ROOT/RDF/Utils.hxx" // CacheLineStep
+#include <RtypesCore.h>
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+class RProfiler;
+
+/**
+\class ROOT::Internal::RDF::RNodeProfile
+\ingroup dataframe
+\brief Time spent in one node of the computation graph (or in reading one dataset column), per processing slot.
+
+Only filled when profiling is enabled, see RScopedNodeTimer. Times are exclusive: the time spent evaluating other
+profiled elements while this one runs (e.g. a Define or a column read triggered by a Filter) is only attributed to those.
+**/
+class RNodeProfile {
+   friend class RScopedNodeTimer;
+
+   std::vector<Long64_t> fNs;       ///< Exclusive time in ns, per slot (padded to avoid false sharing)
+   std::vector<ULong64_t> fNCalls;  ///< Number of timed calls, per slot (padded to avoid false sharing)
+   std::vector<Long64_t> *fNestedNs = nullptr; ///< Owned by the RProfiler, null if profiling is disabled
+
+public:
+   void Enable(RProfiler &profiler);
+   void Disable()
+   {
+      fNs.clear();
+      fNCalls.clear();
+      fNestedNs = nullptr;
+   }
+   bool IsEnabled() const { return fNestedNs != nullptr; }
+   double GetSeconds() const;
+   ULong64_t GetNCalls() const;
+};
+
+/**
+\class ROOT::Internal::RDF::RScopedNodeTimer
+\ingroup dataframe
+\brief Add the time elapsed during its lifetime to an RNodeProfile, excluding the time of nested timers.
+
+A no-op if profiling is disabled for that node.
+**/
+class RScopedNodeTimer {
+   using Clock_t = std::chrono::steady_clock;
+
+   RNodeProfile &fProfile;
+   unsigned int fSlot;
+   Long64_t fOuterNestedNs = 0;
+   Clock_t::time_point fStart;
+
+public:
+   RScopedNodeTimer(RNodeProfile &profile, unsigned int slot) : fProfile(profile), fSlot(slot)
+   {
+      if (!fProfile.IsEnabled())
+         return;
+      auto &nestedNs = (*fProfile.fNestedNs)[fSlot * CacheLineStep<Long64_t>()];
+      fOuterNestedNs = nestedNs;
+      nestedNs = 0;
+      fStart = Clock_t::now();
+   }
+
+   RScopedNodeTimer(const RScopedNodeTimer &) = delete;
+   RScopedNodeTimer &operator=(const RScopedNodeTimer &) = delete;
+
+   ~RScopedNodeTimer()
+   {
+      if (!fProfile.IsEnabled())
+         return;
+      const Long64_t elapsedNs =
+         std::chrono::duration_cast<std::chrono::nanoseconds>(Clock_t::now() - fStart).count();
+      auto &nestedNs = (*fProfile.fNestedNs)[fSlot * CacheLineStep<Long64_t>()];
+      fProfile.fNs[fSlot * CacheLineStep<Long64_t>()] += elapsedNs - nestedNs;
+      ++fProfile.fNCalls[fSlot * CacheLineStep<ULong64_t>()];
+      // the enclosing timer, if any, must not count this time as its own
+      nestedNs = fOuterNestedNs + elapsedNs;
+   }
+};
+
+/**
+\class ROOT::Internal::RDF::RProfiledColumnReader
+\ingroup dataframe
+\brief A column reader that times the reads of the column reader it wraps.
+**/
+class R__CLING_PTRCHECK(off) RProfiledColumnReader final : public ROOT::Detail::RDF::RColumnReaderBase {
+   std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> fReader;
+   RNodeProfile &fProfile;
+   unsigned int fSlot;
+
+   void *GetImpl(Long64_t entry) final
+   {
+      RScopedNodeTimer timer(fProfile, fSlot);
+      // Get<char> just casts the type-erased address returned by the wrapped reader, we take it back
+      return &fReader->Get<char>(entry);
+   }
+
+public:
+   RProfiledColumnReader(std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> reader, RNodeProfile &profile,
+                         unsigned int slot)
+      : fReader(std::move(reader)), fProfile(profile), fSlot(slot)
+   {
+   }
+};
+
+/**
+\class ROOT::Internal::RDF::RProfiler
+\ingroup dataframe
+\brief Collect the profiling information of the event loops of an RLoopManager.
+
+Holds the per-slot state that RScopedNodeTimers need to compute exclusive times, the time spent in reading each dataset
+column, and the time each slot spent processing tasks. The profiles of filters, defines and actions are stored in the
+nodes themselves.
+**/
+class RProfiler {
+   friend class RNodeProfile;
+
+   unsigned int fNSlots;
+   std::vector<Long64_t> fNestedNs; ///< Current nested time, per slot (padded), see RScopedNodeTimer
+   std::vector<Long64_t> fBusyNs;   ///< Time spent processing tasks, per slot (padded)
+   std::map<std::string, RNodeProfile> fColumnProfiles; ///< Time spent reading each dataset column
+   double fLoopSeconds = 0.;
+   Long64_t fBytesRead = 0;
+
+public:
+   explicit RProfiler(unsigned int nSlots);
+
+   void Reset(const std::vector<std::string> &columns);
+   unsigned int GetNSlots() const { return fNSlots; }
+   /// Return the profile of the given dataset column, nullptr if the column is not profiled.
+   /// Thread-safe during the event loop, as the set of profiled columns does not change.
+   RNodeProfile *GetColumnProfile(const std::string &column);
+   const std::map<std::string, RNodeProfile> &GetColumnProfiles() const { return fColumnProfiles; }
+   void AddBusyTime(unsigned int slot, std::chrono::steady_clock::duration time)
+   {
+      fBusyNs[slot * CacheLineStep<Long64_t>()] += std::chrono::duration_cast<std::chrono::nanoseconds>(time).count();
+   }
+   double GetBusySeconds(unsigned int slot) const { return fBusyNs[slot * CacheLineStep<Long64_t>()] * 1e-9; }
+   void SetLoopStats(double loopSeconds, Long64_t bytesRead)
+   {
+      fLoopSeconds = loopSeconds;
+      fBytesRead = bytesRead;
+   }
+   double GetLoopSeconds() const { return fLoopSeconds; }
+   Long64_t GetBytesRead() const { return fBytesRead; }
+};
+
+/**
+\class ROOT::Internal::RDF::RScopedSlotTimer
+\ingroup dataframe
+\brief Add the time elapsed during its lifetime to the busy time of a slot. A no-op if the profiler is null.
+**/
+class RScopedSlotTimer {
+   RProfiler *fProfiler;
+   unsigned int fSlot;
+   std::chrono::steady_clock::time_point fStart;
+
+public:
+   RScopedSlotTimer(RProfiler *profiler, unsigned int slot) : fProfiler(profiler), fSlot(slot)
+   {
+      if (fProfiler)
+         fStart = std::chrono::steady_clock::now();
+   }
+   RScopedSlotTimer(const RScopedSlotTimer &) = delete;
+   RScopedSlotTimer &operator=(const RScopedSlotTimer &) = delete;
+   ~RScopedSlotTimer()
+   {
+      if (fProfiler)
+         fProfiler->AddBusyTime(fSlot, std::chrono::steady_clock::now() - fStart);
+   }
+};
+
+/// Return a label with the time spent in a node, to be appended to its name in the graph representation.
+/// Empty if the node was not profiled.
+std::string GetProfileLabel(const RNodeProfile &profile);
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RPROFILER
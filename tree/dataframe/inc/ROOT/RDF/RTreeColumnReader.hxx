@@ -109,13 +109,13 @@ class R__CLING_PTRCHECK(off) RTreeColumnReader<RVec<T>> final : public ROOT::Det
 #else
          (void)fCopyWarningPrinted;
 #endif
-         if (readerArraySize > 0) {
-            RVec<T> rvec(readerArray.begin(), readerArray.end());
-            swap(fRVec, rvec);
-         } else {
+         // Copy into the buffer of the previous entry rather than allocating a new one for every entry, unless
+         // fRVec is still a view on the memory of the TTreeReaderArray
+         if (ROOT::Detail::VecOps::IsAdopting(fRVec)) {
             RVec<T> emptyVec{};
             swap(fRVec, emptyVec);
          }
+         fRVec.assign(readerArray.begin(), readerArray.end());
       }
       fLastEntry = entry;
       return &fRVec;
@@ -147,15 +147,8 @@ class R__CLING_PTRCHECK(off) RTreeColumnReader<RVec<bool>> final : public ROOT::
    void *GetImpl(Long64_t) final
    {
       auto &readerArray = *fTreeArray;
-      const auto readerArraySize = readerArray.GetSize();
-      if (readerArraySize > 0) {
-         // always perform a copy
-         RVec<bool> rvec(readerArray.begin(), readerArray.end());
-         swap(fRVec, rvec);
-      } else {
-         RVec<bool> emptyVec{};
-         swap(fRVec, emptyVec);
-      }
+      // always perform a copy, reusing the buffer of the previous entry
+      fRVec.assign(readerArray.begin(), readerArray.end());
       return &fRVec;
    }
 
@@ -46,6 +46,12 @@ class R__CLING_PTRCHECK(off) RVariedAction final : public RActionBase {
    std::vector<Helper> fHelpers; ///< Action helpers per variation.
    /// Owning pointers to upstream nodes for each systematic variation.
    std::vector<std::shared_ptr<PrevNodeType>> fPrevNodes;
+   /// The distinct upstream nodes: typically most variations do not affect the filters and share the nominal one.
+   std::vector<PrevNodeType *> fUniquePrevNodes;
+   /// The index in fUniquePrevNodes of the upstream node of each variation.
+   std::vector<std::size_t> fUniquePrevNodeIdx;
+   /// Per slot, whether the current entry passes the filters of each of fUniquePrevNodes.
+   std::vector<std::vector<char>> fPassesFilters;
 
    /// Column readers per slot (outer dimension), per variation and per input column (inner dimension, std::array).
    std::vector<std::vector<std::array<RColumnReaderBase *, ColumnTypes_t::list_size>>> fInputValues;
@@ -89,6 +95,16 @@ class R__CLING_PTRCHECK(off) RVariedAction final : public RActionBase {
 
       fLoopManager->Register(this);
 
+      // evaluate upstream filters once per entry, not once per variation
+      fUniquePrevNodeIdx.reserve(fPrevNodes.size());
+      for (const auto &prevNode : fPrevNodes) {
+         const auto it = std::find(fUniquePrevNodes.begin(), fUniquePrevNodes.end(), prevNode.get());
+         fUniquePrevNodeIdx.push_back(std::distance(fUniquePrevNodes.begin(), it));
+         if (it == fUniquePrevNodes.end())
+            fUniquePrevNodes.push_back(prevNode.get());
+      }
+      fPassesFilters.resize(GetNSlots(), std::vector<char>(fUniquePrevNodes.size()));
+
       for (auto i = 0u; i < columnNames.size(); ++i) {
          auto *define = colRegister.GetDefine(columnNames[i]);
          fIsDefine[i] = define != nullptr;
@@ -148,10 +164,23 @@ public:
       (void)entry;
    }
 
+   std::string GetActionName() final { return "Varied " + fHelpers[0].GetActionName(); }
+
    void Run(unsigned int slot, Long64_t entry) final
    {
-      for (auto varIdx = 0u; varIdx < GetVariations().size(); ++varIdx) {
-         if (fPrevNodes[varIdx]->CheckFilters(slot, entry))
+      RScopedNodeTimer timer(fProfile, slot);
+      auto &passesFilters = fPassesFilters[slot];
+      bool anyPasses = false;
+      for (auto i = 0u; i < fUniquePrevNodes.size(); ++i) {
+         passesFilters[i] = fUniquePrevNodes[i]->CheckFilters(slot, entry);
+         anyPasses = anyPasses || passesFilters[i];
+      }
+      if (!anyPasses)
+         return;
+
+      const auto nVariations = fHelpers.size();
+      for (auto varIdx = 0u; varIdx < nVariations; ++varIdx) {
+         if (passesFilters[fUniquePrevNodeIdx[varIdx]])
             CallExec(slot, varIdx, entry, ColumnTypes_t{}, TypeInd_t{});
       }
    }
@@ -206,8 +235,8 @@ public:
 
       // Action nodes do not need to go through CreateFilterNode: they are never common nodes between multiple branches
       const auto nodeType = HasRun() ? RDFGraphDrawing::ENodeType::kUsedAction : RDFGraphDrawing::ENodeType::kAction;
-      auto thisNode = std::make_shared<RDFGraphDrawing::GraphNode>("Varied " + fHelpers[0].GetActionName(),
-                                                                   visitedMap.size(), nodeType);
+      auto thisNode = std::make_shared<RDFGraphDrawing::GraphNode>(
+         "Varied " + fHelpers[0].GetActionName() + GetProfileLabel(fProfile), visitedMap.size(), nodeType);
       visitedMap[(void *)this] = thisNode;
 
       auto upmostNode = AddDefinesToGraph(thisNode, GetColRegister(), prevColumns, visitedMap);
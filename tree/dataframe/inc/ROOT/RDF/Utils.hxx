@@ -199,6 +199,10 @@ void InterpreterDeclare(const std::string &code);
 /// The pointer returned by the call to TInterpreter::Calc is returned in case of success.
 Long64_t InterpreterCalc(const std::string &code, const std::string &context = "");
 
+/// Like InterpreterCalc, but go through the on-disk cache of compiled jitted code if it is enabled.
+/// See the definition in RDFInterfaceUtils.cxx for more details.
+void InterpreterCalcCached(const std::string &code, const std::string &context = "");
+
 /// Whether custom column with name colName is an "internal" column such as rdfentry_ or rdfslot_
 bool IsInternalColumn(std::string_view colName);
 
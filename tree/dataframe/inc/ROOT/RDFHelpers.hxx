@@ -15,6 +15,7 @@
 
 #include <ROOT/RDF/GraphUtils.hxx>
 #include <ROOT/RDF/RActionBase.hxx>
+#include <ROOT/RDF/RDatasetSpec.hxx>
 #include <ROOT/RDF/RResultMap.hxx>
 #include <ROOT/RResultHandle.hxx> // users of RunGraphs might rely on this transitive include
 #include <ROOT/TypeTraits.hxx>
@@ -269,6 +270,50 @@ RResultMap<T> VariationsFor(RResultPtr<T> resPtr)
 using SnapshotPtr_t = ROOT::RDF::RResultPtr<ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager, void>>;
 SnapshotPtr_t VariationsFor(SnapshotPtr_t resPtr);
 
+/// \brief Make the computation graph of a node read a new dataset in its next event loop.
+/// \param[in] node Any node of the computation graph.
+/// \param[in] spec The specification of the new dataset.
+///
+/// The nodes of the computation graph, including the code jitted for them, are reused as they are: the new dataset
+/// must therefore have the same schema as the original one, i.e. provide all the columns read by the graph, with the
+/// same types. Results that were already produced are not affected; to produce them again on the new dataset, book
+/// a copy of their action with CloneResult(). This avoids building and jitting the same computation graph once per
+/// dataset, which dominates the run time of analyses of many small samples:
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df(std::move(specs[0]));
+/// auto h = df.Filter("pt > 20").Histo1D({"h", "h", 100, 0, 100}, "pt");
+/// Save(*h);
+/// for (std::size_t i = 1; i < specs.size(); ++i) {
+///    ROOT::RDF::Experimental::ChangeDataset(df, std::move(specs[i]));
+///    Save(*ROOT::RDF::Experimental::CloneResult(h));
+/// }
+/// ~~~
+/// Only computation graphs that read TTrees, i.e. that were constructed from a tree, a list of files or an
+/// RDatasetSpec, can change their dataset. A std::logic_error is thrown otherwise.
+void ChangeDataset(ROOT::RDF::RNode node, RDatasetSpec &&spec);
+
+/// \brief Book a copy of the action that produces a result, with a new result object.
+/// \param[in] resPtr The result whose action should be copied.
+/// \return A result that is produced by the next event loop of the computation graph.
+///
+/// The new action is attached to the same node of the computation graph as the original one, without jitting.
+/// Its result starts out empty, e.g. histograms keep their binning but are reset. See ChangeDataset().
+template <typename T>
+RResultPtr<T> CloneResult(const RResultPtr<T> &resPtr)
+{
+   return RDFInternal::CloneResultAndAction(resPtr);
+}
+
+/// \brief Book a copy of the action that produces the varied results of a RResultMap, with new result objects.
+template <typename T>
+RResultMap<T> CloneResult(const RResultMap<T> &resMap)
+{
+   return RDFInternal::CloneResultAndAction(resMap);
+}
+
+/// \brief Book a copy of a Snapshot action, writing to a different output file.
+SnapshotPtr_t CloneResult(const SnapshotPtr_t &resPtr, const std::string &outputFileName);
+
 /// \brief Add ProgressBar to a ROOT::RDF::RNode
 /// \param[in] df RDataFrame node at which ProgressBar is called.
 ///
@@ -0,0 +1,141 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_MULTIPROCESS
+#define ROOT_RDF_MULTIPROCESS
+
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDFHelpers.hxx" // AsRNode
+#include "ROOT/TProcessExecutor.hxx"
+#include <RtypesCore.h>
+
+#include <cstddef>
+#include <cstring> // std::memcpy
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/**
+\class ROOT::Internal::RDF::RSharedMemory
+\ingroup dataframe
+\brief An anonymous memory mapping that is shared with the processes forked after its creation.
+**/
+class RSharedMemory {
+   void *fAddress = nullptr;
+   std::size_t fSize = 0;
+
+public:
+   explicit RSharedMemory(std::size_t size);
+   ~RSharedMemory();
+   RSharedMemory(const RSharedMemory &) = delete;
+   RSharedMemory &operator=(const RSharedMemory &) = delete;
+   void *GetAddress() const { return fAddress; }
+};
+
+std::vector<std::pair<Long64_t, Long64_t>> GetMultiProcessRanges(const std::string &treeName,
+                                                                 const std::vector<std::string> &fileNameGlobs,
+                                                                 unsigned int nRanges);
+
+void CheckMultiProcessPreconditions();
+
+} // namespace RDF
+} // namespace Internal
+
+namespace RDF {
+namespace Experimental {
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Process a dataset in several forked processes, each running its own RDataFrame on a part of the entries.
+/// \param[in] treeName Name of the input tree.
+/// \param[in] fileNameGlobs Paths of the input files, possibly globs.
+/// \param[in] makeResult A callable that books an action on the RNode it receives and returns its RResultPtr.
+/// \param[in] nProcesses Number of worker processes, 0 to use as many as the available cores.
+/// \return The partial results of each range of entries.
+///
+/// This is the multi-core alternative to implicit multi-threading for analyses that call code that is not
+/// thread-safe: every worker runs the event loop sequentially, in its own address space. The entries of the dataset
+/// are split into contiguous ranges aligned to the cluster boundaries of the input files, one per worker, and the
+/// workers are forked by a ROOT::TProcessExecutor.
+///
+/// Results of trivially copyable type (e.g. the values returned by Count, Sum, Min, Max, Mean) are written by the
+/// workers into a memory mapping shared with the parent process, so no serialization is involved, and are returned
+/// in the order of the entry ranges they were computed on. Other results, e.g. histograms, are streamed back to the
+/// parent by the TProcessExecutor, so their type needs a dictionary, and are returned in the order in which the
+/// workers complete.
+/// The partial results are not merged: e.g. the Sum of all entries is the sum of the returned values, and histograms
+/// can be merged with TH1::Add or ROOT::RDF::Experimental::MergeValues.
+///
+/// Implicit multi-threading must be disabled when calling this function, as the thread pool does not survive a fork.
+///
+/// ~~~{.cpp}
+/// auto sums = ROOT::RDF::Experimental::RunMultiProcess("events", {"data.root"}, [](ROOT::RDF::RNode df) {
+///    return df.Define("e", CalibratedEnergy, {"raw_e"}).Sum<double>("e");
+/// });
+/// const auto sum = std::accumulate(sums.begin(), sums.end(), 0.);
+/// ~~~
+template <typename F>
+auto RunMultiProcess(const std::string &treeName, const std::vector<std::string> &fileNameGlobs, F &&makeResult,
+                     unsigned int nProcesses = 0)
+   -> std::vector<std::decay_t<decltype(*makeResult(std::declval<ROOT::RDF::RNode>()))>>
+{
+   using Result_t = std::decay_t<decltype(*makeResult(std::declval<ROOT::RDF::RNode>()))>;
+
+   ROOT::Internal::RDF::CheckMultiProcessPreconditions();
+   ROOT::TProcessExecutor pool(nProcesses);
+   const auto ranges = ROOT::Internal::RDF::GetMultiProcessRanges(treeName, fileNameGlobs, pool.GetPoolSize());
+   if (ranges.empty())
+      return {};
+
+   auto computeResult = [&](unsigned int rangeIdx) {
+      ROOT::RDF::Experimental::RDatasetSpec spec;
+      spec.AddSample({"", treeName, fileNameGlobs});
+      spec.WithGlobalRange({ranges[rangeIdx].first, ranges[rangeIdx].second});
+      ROOT::RDataFrame df(std::move(spec));
+      return *makeResult(ROOT::RDF::AsRNode(df));
+   };
+
+   std::vector<unsigned int> rangeIndices(ranges.size());
+   for (unsigned int i = 0u; i < rangeIndices.size(); ++i)
+      rangeIndices[i] = i;
+
+   std::vector<Result_t> results;
+   if constexpr (std::is_trivially_copyable_v<Result_t> && std::is_default_constructible_v<Result_t>) {
+      ROOT::Internal::RDF::RSharedMemory memory(ranges.size() * sizeof(Result_t));
+      auto *buffer = static_cast<char *>(memory.GetAddress());
+      // the workers only send back a flag, the results are read from the shared memory
+      const auto done = pool.Map(
+         [&](unsigned int rangeIdx) {
+            const Result_t result = computeResult(rangeIdx);
+            std::memcpy(buffer + rangeIdx * sizeof(Result_t), &result, sizeof(Result_t));
+            return 1;
+         },
+         rangeIndices);
+      if (done.size() != ranges.size())
+         throw std::runtime_error("RunMultiProcess: some of the worker processes did not complete their task.");
+      results.resize(ranges.size());
+      for (std::size_t i = 0u; i < ranges.size(); ++i)
+         std::memcpy(&results[i], buffer + i * sizeof(Result_t), sizeof(Result_t));
+   } else {
+      results = pool.Map(computeResult, rangeIndices);
+      if (results.size() != ranges.size())
+         throw std::runtime_error("RunMultiProcess: some of the worker processes did not complete their task.");
+   }
+   return results;
+}
+
+} // namespace Experimental
+} // namespace RDF
+} // namespace ROOT
+
+#endif // ROOT_RDF_MULTIPROCESS
@@ -17,6 +17,7 @@
 #include "TString.h"
 
 #include <algorithm> // std::transform
+#include <map>
 #include <string>
 #include <typeinfo>
 #include <vector>
@@ -127,6 +128,15 @@ public:
    /// \brief Returns the number of files from which the dataset is constructed
    virtual std::size_t GetNFiles() const { return 0; }
 
+   // clang-format off
+   /// \brief Inform RDataSource of the columns that the next event loop will read.
+   /// \param[in] readCounts The names of the columns read by the computation graph, each with the number of nodes that read it
+   /// Called by RDataFrame once per event loop, before Initialize(). It lets data sources that can prefetch or cache
+   /// data (e.g. from remote storage) do so for all the columns needed up front, prioritizing the most used ones,
+   /// rather than learning which columns are needed as GetColumnReaders() is called. Implementing it is optional.
+   // clang-format on
+   virtual void SetColumnReadHints(const std::map<std::string, unsigned int> & /*readCounts*/) {}
+
    // clang-format off
    /// \brief Returns a reference to the collection of the dataset's column names
    // clang-format on
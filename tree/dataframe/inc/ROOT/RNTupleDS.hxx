@@ -54,8 +54,19 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
       ULong64_t fFirstEntry = 0; ///< First entry index in fSource
       /// End entry index in fSource, e.g. the number of entries in the range is fLastEntry - fFirstEntry
       ULong64_t fLastEntry = 0;
+      /// The number of entries in the file of fSource. Only set for the first range of every file, which is how
+      /// GetEntryRanges() detects that a new file starts. Zero for the other ranges of the same file.
+      ULong64_t fNEntriesInFile = 0;
    };
 
+   /// A cut on the values of a field, see SkipClustersOutsideRange()
+   struct RClusterCut {
+      std::string fFieldName;
+      double fMin;
+      double fMax;
+   };
+   std::vector<RClusterCut> fClusterCuts;
+
    /// A clone of the first pages source's descriptor.
    std::unique_ptr<RNTupleDescriptor> fPrincipalDescriptor;
 
@@ -65,8 +76,8 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
    /// The staging area is relevant for chains of files, i.e. when fFileNames is not empty. In this case,
    /// files are opened in the background in batches of size `fNSlots` and kept in the staging area.
    /// The first file (chains or no chains) is always opened on construction in order to process the schema.
-   /// For all subsequent files, the corresponding page sources in the staging area only executed `LoadStructure()`,
-   /// i.e. they should have a compressed buffer of the meta-data available.
+   /// For all subsequent files, the corresponding page sources in the staging area are already attached, i.e. their
+   /// meta-data is read and deserialized. With IMT, the files of a batch are opened concurrently.
    /// Concretely:
    ///   1. We open the first file on construction to read the schema and then move the corresponding page source
    ///      in the staging area.
@@ -74,8 +85,8 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
    ///   3. At the beginning of `GetEntryRanges()`, we
    ///      a) wait for the I/O thread to finish,
    ///      b) call `PrepareNextRanges()` in the main thread to move the page sources from the staging area
-   ///         into `fNextRanges`; this will also call `Attach()` on the page sources (i.e., deserialize the meta-data),
-   ///         and
+   ///         into `fNextRanges`; this only attaches the page sources that failed to be staged, so that their
+   ///         errors are reported from the main thread, and
    ///      c) trigger staging of the next batch of files in the I/O background thread.
    ///   4. On `Finalize()`, the I/O background thread is stopped.
    std::vector<std::unique_ptr<ROOT::Experimental::Internal::RPageSource>> fStagingArea;
@@ -140,7 +151,7 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
 
    /// The main function of the fThreadStaging background thread
    void ExecStaging();
-   /// Starting from `fNextFileIndex`, opens the next `fNSlots` files. Calls `LoadStructure()` on the opened files.
+   /// Starting from `fNextFileIndex`, opens the next `fNSlots` files. Calls `Attach()` on the opened files.
    /// The very first file is already available from the constructor.
    void StageNextSources();
    /// Populates fNextRanges with the next set of entry ranges. Moves files from the staging area as necessary
@@ -148,6 +159,10 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
    /// Upon return, the fNextRanges list is ordered.  It has usually fNSlots elements; fewer if there
    /// is not enough work to give at least one cluster to every slot.
    void PrepareNextRanges();
+   /// Replaces the ranges in fNextRanges by the runs of their clusters that can pass the cluster cuts.
+   /// In multi-threaded mode, every run gets its own page source. In single-threaded mode, all the runs of a file
+   /// share the page source of the first one, which is the only one readers connect to.
+   void ApplyClusterCuts();
 
    explicit RNTupleDS(std::unique_ptr<ROOT::Experimental::Internal::RPageSource> pageSource);
 
@@ -157,6 +172,13 @@ public:
    RNTupleDS(std::string_view ntupleName, const std::vector<std::string> &fileNames);
    ~RNTupleDS();
 
+   /// \brief Do not process the clusters in which all the values of a field are outside of [min, max].
+   /// This is only pruning: entries of the processed clusters that are outside of the range still need to be filtered
+   /// out, e.g. with a Filter on the same column. Only clusters written with value ranges (see
+   /// RNTupleWriteOptions::SetEnableValueRanges()) can be skipped. The field must have one value per entry, i.e. it
+   /// must not be part of a collection. Must be called before the event loop.
+   void SkipClustersOutsideRange(std::string_view fieldName, double min, double max);
+
    void SetNSlots(unsigned int nSlots) final;
    std::size_t GetNFiles() const final { return fFileNames.empty() ? 1 : fFileNames.size(); }
    const std::vector<std::string> &GetColumnNames() const final { return fColumnNames; }
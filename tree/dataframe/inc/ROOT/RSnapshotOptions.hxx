@@ -43,6 +43,9 @@ struct RSnapshotOptions {
    int fSplitLevel = 99;                            ///< Split level of output tree
    bool fLazy = false;                              ///< Do not start the event loop when Snapshot is called
    bool fOverwriteIfExists = false; ///< If fMode is "UPDATE", overwrite object in output file if it already exists
+   /// In multi-thread runs, write the entries processed by each slot to a file of its own instead of merging them into
+   /// a single file: `<name>_<slot>.root` for an output file name `<name>.root`
+   bool fOutputPerSlot = false;
 };
 } // namespace RDF
 } // namespace ROOT
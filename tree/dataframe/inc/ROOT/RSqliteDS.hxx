@@ -47,6 +47,10 @@ is used:
   - For expressions ("SELECT 1+1 FROM table"), the type of the first row of the result set determines the column type.
     That can result in a column to be of thought of type NULL where subsequent rows actually have meaningful values.
     The provided SELECT query can be used to avoid such ambiguities.
+
+The rows of the result set are fetched by a single thread, in batches of up to 1024 rows (see SetNRowsPerBatch()).
+Each batch is split in one entry range per slot, so that with implicit multi-threading the rows of a batch are
+processed in parallel.
 */
 class RSqliteDS final : public ROOT::RDF::RDataSource {
 private:
@@ -61,28 +65,35 @@ private:
    };
    // clang-format on
 
-   /// Used to hold a single "cell" of the SELECT query's result table. Can be changed to std::variant once available.
+   /// Used to hold one column of the rows of the SELECT query's result table that are fetched by one call of
+   /// GetEntryRanges. Only the vector corresponding to the column type is filled.
    struct Value_t {
       explicit Value_t(ETypes type);
 
       ETypes fType;
       bool fIsActive; ///< Not all columns of the query are necessarily used by the RDF. Allows for skipping them.
-      Long64_t fInteger;
-      double fReal;
-      std::string fText;
-      std::vector<unsigned char> fBlob;
+      std::vector<Long64_t> fIntegers;
+      std::vector<double> fReals;
+      std::vector<std::string> fTexts;
+      std::vector<std::vector<unsigned char>> fBlobs;
       void *fNull;
-      void *fPtr; ///< Points to one of the values; an address to this pointer is returned by GetColumnReadersImpl.
+      /// Per slot, points to the value of the current entry; addresses to these pointers are returned by
+      /// GetColumnReadersImpl.
+      std::vector<void *> fPtrs;
    };
 
    void SqliteError(int errcode);
+   void FetchRow(ULong64_t row);
 
    std::unique_ptr<Internal::RSqliteDSDataSet> fDataSet;
    unsigned int fNSlots;
    ULong64_t fNRow;
+   ULong64_t fNRowsPerBatch;  ///< Maximum number of rows fetched by one call of GetEntryRanges
+   ULong64_t fFirstBatchRow;  ///< Entry number of the first row held in fValues
    std::vector<std::string> fColumnNames;
    std::vector<ETypes> fColumnTypes;
-   /// The data source is inherently single-threaded and returns only one row at a time. This vector holds the results.
+   /// The rows are fetched from the query by a single thread, in batches which are then shared among the slots.
+   /// This vector holds the active columns of the current batch.
    std::vector<Value_t> fValues;
 
    // clang-format off
@@ -99,6 +110,8 @@ private:
 public:
    RSqliteDS(const std::string &fileName, const std::string &query);
    ~RSqliteDS();
+   /// Set the maximum number of rows fetched by each call of GetEntryRanges; they are split among the slots.
+   void SetNRowsPerBatch(ULong64_t nRows) { fNRowsPerBatch = (nRows > 0) ? nRows : 1; }
    void SetNSlots(unsigned int nSlots) final;
    const std::vector<std::string> &GetColumnNames() const final;
    bool HasColumn(std::string_view colName) const final;
@@ -20,6 +20,10 @@ A RDataFrame that adapts an arrow::Table class can be constructed using the fact
 ROOT::RDF::FromArrow, which accepts one parameter:
 1. An arrow::Table smart pointer.
 
+To avoid materializing the whole dataset in memory, FromArrow also accepts an arrow::RecordBatchReader
+(e.g. an Arrow IPC stream or a Parquet file reader): the record batches are then read incrementally during
+the event loop, and each one is processed as a separate entry range.
+
 The types of the columns are derived from the types in the associated
 arrow::Schema.
 
@@ -41,6 +45,7 @@ arrow::Schema.
 #pragma GCC diagnostic ignored "-Wshadow"
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 #endif
+#include <arrow/record_batch.h>
 #include <arrow/table.h>
 #include <arrow/stl.h>
 #if defined(__GNUC__)
@@ -216,18 +221,33 @@ private:
 
 public:
    TValueGetter(size_t slots, arrow::ArrayVector chunks)
-      : fValuesPtrPerSlot(slots, nullptr), fLastEntryPerSlot(slots, 0), fLastChunkPerSlot(slots, 0), fChunks{chunks}
+      : fValuesPtrPerSlot(slots, nullptr), fLastEntryPerSlot(slots, 0), fLastChunkPerSlot(slots, 0)
+   {
+      SetChunks(std::move(chunks), 0);
+      for (size_t si = 0, se = fValuesPtrPerSlot.size(); si != se; ++si) {
+         fArrayVisitorPerSlot.push_back(ArrayPtrVisitor{fValuesPtrPerSlot.data() + si});
+      }
+   }
+
+   /// Replace the arrays the values are read from, e.g. with the next record batches of a stream.
+   /// \param[in] chunks the new arrays
+   /// \param[in] firstEntry the entry number of the first element of the first array
+   void SetChunks(arrow::ArrayVector chunks, ULong64_t firstEntry)
    {
+      fChunks = std::move(chunks);
+      fChunkIndex.clear();
+      fFirstEntryPerChunk.clear();
       fChunkIndex.reserve(fChunks.size());
-      size_t next = 0;
-      for (auto &chunk : chunks) {
+      fFirstEntryPerChunk.reserve(fChunks.size());
+      auto next = firstEntry;
+      for (auto &chunk : fChunks) {
          fFirstEntryPerChunk.push_back(next);
          next += chunk->length();
          fChunkIndex.push_back(next);
       }
-      for (size_t si = 0, se = fValuesPtrPerSlot.size(); si != se; ++si) {
-         fArrayVisitorPerSlot.push_back(ArrayPtrVisitor{fValuesPtrPerSlot.data() + si});
-      }
+      // all lookups must start from the new chunks
+      std::fill(fLastChunkPerSlot.begin(), fLastChunkPerSlot.end(), 0);
+      std::fill(fLastEntryPerSlot.begin(), fLastEntryPerSlot.end(), 0);
    }
 
    /// This returns the ptr to the ptr to actual data.
@@ -386,7 +406,7 @@ public:
 /// \param[in] inColumns the name of the columns to use
 /// In case columns is empty, we use all the columns found in the table
 RArrowDS::RArrowDS(std::shared_ptr<arrow::Table> inTable, std::vector<std::string> const &inColumns)
-   : fTable{inTable}, fColumnNames{inColumns}
+   : fTable{inTable}, fSchema{inTable->schema()}, fColumnNames{inColumns}
 {
    auto &columnNames = fColumnNames;
    auto &table = fTable;
@@ -455,6 +475,42 @@ RArrowDS::RArrowDS(std::shared_ptr<arrow::Table> inTable, std::vector<std::strin
    }
 }
 
+////////////////////////////////////////////////////////////////////////
+/// Constructor to create an Arrow RDataSource that streams record batches.
+/// \param[in] reader the source of the record batches, e.g. an arrow::ipc::RecordBatchStreamReader or the reader
+///            returned by parquet::arrow::FileReader::GetRecordBatchReader.
+/// \param[in] inColumns the name of the columns to use
+/// In case columns is empty, we use all the columns found in the schema of the reader.
+///
+/// Record batches are read on demand: each call to GetEntryRanges() reads at most one batch per processing slot and
+/// releases the previous ones, so that memory usage does not scale with the size of the dataset. As the reader can not
+/// be rewound, the data source can only be used for one event loop.
+RArrowDS::RArrowDS(std::shared_ptr<arrow::RecordBatchReader> reader, std::vector<std::string> const &inColumns)
+   : fBatchReader{reader}, fSchema{reader->schema()}, fColumnNames{inColumns}
+{
+   if (fColumnNames.empty()) {
+      for (auto &field : fSchema->fields()) {
+         fColumnNames.push_back(field->name());
+      }
+   }
+   if (fColumnNames.empty()) {
+      throw std::runtime_error("At least one column required");
+   }
+
+   for (auto &columnName : fColumnNames) {
+      const auto columnIdx = fSchema->GetFieldIndex(columnName);
+      if (columnIdx < 0) {
+         throw std::runtime_error("The dataset does not have column " + columnName);
+      }
+      fGetterIndex.push_back(std::make_pair(columnIdx, fGetterIndex.size()));
+
+      VerifyValidColumnType verifyType;
+      if (!fSchema->field(columnIdx)->type()->Accept(&verifyType).ok()) {
+         throw std::runtime_error("Column " + columnName + " contains an unsupported type.");
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////
 /// Destructor.
 RArrowDS::~RArrowDS()
@@ -468,13 +524,47 @@ const std::vector<std::string> &RArrowDS::GetColumnNames() const
 
 std::vector<std::pair<ULong64_t, ULong64_t>> RArrowDS::GetEntryRanges()
 {
+   if (fBatchReader)
+      return ReadNextBatches();
    auto entryRanges(std::move(fEntryRanges)); // empty fEntryRanges
    return entryRanges;
 }
 
+////////////////////////////////////////////////////////////////////////
+/// Read up to one record batch per slot from the stream and point the value getters to them.
+/// Returns one entry range per batch, empty at the end of the stream.
+std::vector<std::pair<ULong64_t, ULong64_t>> RArrowDS::ReadNextBatches()
+{
+   std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
+   std::vector<arrow::ArrayVector> chunksPerGetter(fGetterIndex.size());
+   const auto firstEntry = fNextEntry;
+   while (entryRanges.size() < fNSlots) {
+      std::shared_ptr<arrow::RecordBatch> batch;
+      auto status = fBatchReader->ReadNext(&batch);
+      if (!status.ok()) {
+         throw std::runtime_error("RArrowDS: could not read the next record batch: " + status.ToString());
+      }
+      if (!batch) // end of the stream
+         break;
+      if (batch->num_rows() == 0)
+         continue;
+      for (auto link : fGetterIndex) {
+         chunksPerGetter[link.second].push_back(batch->column(link.first));
+      }
+      entryRanges.emplace_back(fNextEntry, fNextEntry + batch->num_rows());
+      fNextEntry += batch->num_rows();
+   }
+
+   // the batches of the previous call, if any, are released here
+   for (auto link : fGetterIndex) {
+      fValueGetters[link.second]->SetChunks(std::move(chunksPerGetter[link.second]), firstEntry);
+   }
+   return entryRanges;
+}
+
 std::string RArrowDS::GetTypeName(std::string_view colName) const
 {
-   auto field = fTable->schema()->GetFieldByName(std::string(colName));
+   auto field = fSchema->GetFieldByName(std::string(colName));
    if (!field) {
       std::string msg = "The dataset does not have column ";
       msg += colName;
@@ -492,7 +582,7 @@ std::string RArrowDS::GetTypeName(std::string_view colName) const
 
 bool RArrowDS::HasColumn(std::string_view colName) const
 {
-   auto field = fTable->schema()->GetFieldByName(std::string(colName));
+   auto field = fSchema->GetFieldByName(std::string(colName));
    if (!field) {
       return false;
    }
@@ -560,6 +650,11 @@ void RArrowDS::SetNSlots(unsigned int nSlots)
 
    fValueGetters.clear();
    for (size_t ci = 0; ci != nColumns; ++ci) {
+      if (fBatchReader) {
+         // the arrays are set batch by batch, see ReadNextBatches
+         fValueGetters.emplace_back(std::make_unique<ROOT::Internal::RDF::TValueGetter>(nSlots, arrow::ArrayVector{}));
+         continue;
+      }
       auto chunkedArray = getData(fTable->column(fGetterIndex[ci].first));
       fValueGetters.emplace_back(std::make_unique<ROOT::Internal::RDF::TValueGetter>(nSlots, chunkedArray->chunks()));
    }
@@ -579,7 +674,7 @@ std::vector<void *> RArrowDS::GetColumnReadersImpl(std::string_view colName, con
       throw std::runtime_error("No column found at index " + std::to_string(column));
    };
 
-   const int columnIdx = fTable->schema()->GetFieldIndex(std::string(colName));
+   const int columnIdx = fSchema->GetFieldIndex(std::string(colName));
    const int getterIdx = findGetterIndex(columnIdx);
    assert(getterIdx != -1);
    assert((unsigned int)getterIdx < fValueGetters.size());
@@ -588,6 +683,15 @@ std::vector<void *> RArrowDS::GetColumnReadersImpl(std::string_view colName, con
 
 void RArrowDS::Initialize()
 {
+   if (fBatchReader) {
+      if (fStreamStarted) {
+         throw std::runtime_error(
+            "RArrowDS: the record batches of the stream have already been read, the data source can only be used "
+            "for one event loop.");
+      }
+      fStreamStarted = true;
+      return;
+   }
    auto nRecords = getNRecords(fTable, fColumnNames);
    splitInEqualRanges(fEntryRanges, nRecords, fNSlots);
 }
@@ -609,6 +713,19 @@ RDataFrame FromArrow(std::shared_ptr<arrow::Table> table, std::vector<std::strin
    return tdf;
 }
 
+/// \brief Factory method to create a Apache Arrow RDataFrame that streams record batches.
+///
+/// Creates a RDataFrame using an arrow::RecordBatchReader as input, e.g. an Arrow IPC stream or a Parquet file read
+/// through parquet::arrow::FileReader::GetRecordBatchReader. Batches are read incrementally during the event loop.
+/// \param[in] reader the source of the record batches
+/// \param[in] columnNames the name of the columns to use
+/// In case columnNames is empty, we use all the columns found in the schema of the reader
+RDataFrame FromArrow(std::shared_ptr<arrow::RecordBatchReader> reader, std::vector<std::string> const &columnNames)
+{
+   ROOT::RDataFrame tdf(std::make_unique<RArrowDS>(reader, columnNames));
+   return tdf;
+}
+
 } // namespace RDF
 
 } // namespace ROOT
@@ -69,8 +69,9 @@ double-quote characters must be represented by a pair of double-quote characters
 ~~~
 
 The current implementation of RCsvDS reads the entire CSV file content into memory before
-RDataFrame starts processing it. Therefore, before creating a CSV RDataFrame, it is
-important to check both how much memory is available and the size of the CSV file.
+RDataFrame starts processing it (unless a chunk size is given). Therefore, before creating a CSV RDataFrame, it is
+important to check both how much memory is available and the size of the CSV file. The lines are kept as read
+and converted to column values during the event loop, in parallel if implicit multi-threading is enabled.
 
 RCsvDS can handle empty cells and also allows the usage of the special keywords "NaN" and "nan" to
 indicate `nan` values. If the column is of type double, these cells are stored internally as `nan`.
@@ -84,10 +85,41 @@ Empty cells and explicit `nan`-s inside columns of type Long64_t/bool are stored
 #include <TError.h>
 
 #include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstdlib>
+#include <limits>
 #include <memory>
-#include <sstream>
 #include <string>
 
+namespace {
+
+double ParseDouble(const std::string &cell, const std::string &colName)
+{
+   char *end = nullptr;
+   const auto value = std::strtod(cell.c_str(), &end);
+   if (end == cell.c_str())
+      throw std::runtime_error("RCsvDS: cannot convert \"" + cell + "\" in column \"" + colName + "\" to double.");
+   return value;
+}
+
+Long64_t ParseLong64(const std::string &cell, const std::string &colName)
+{
+   const char *begin = cell.data();
+   const char *end = begin + cell.size();
+   // leading whitespace and '+' are accepted by the type inference (and by std::stoll), not by std::from_chars
+   while (begin != end && std::isspace(static_cast<unsigned char>(*begin)))
+      ++begin;
+   if (begin != end && *begin == '+')
+      ++begin;
+   Long64_t value = 0;
+   if (std::from_chars(begin, end, value).ec != std::errc())
+      throw std::runtime_error("RCsvDS: cannot convert \"" + cell + "\" in column \"" + colName + "\" to Long64_t.");
+   return value;
+}
+
+} // anonymous namespace
+
 namespace ROOT {
 
 namespace RDF {
@@ -117,49 +149,6 @@ void RCsvDS::FillHeaders(const std::string &line)
    }
 }
 
-void RCsvDS::FillRecord(const std::string &line, Record_t &record)
-{
-   auto i = 0U;
-
-   auto columns = ParseColumns(line);
-
-   for (auto &col : columns) {
-      auto colType = fColTypes[fHeaders[i]];
-
-      switch (colType) {
-      case 'D': {
-         record.emplace_back(new double((col != "nan") ? std::stod(col) : std::numeric_limits<double>::quiet_NaN()));
-         break;
-      }
-      case 'L': {
-         if (col != "nan") {
-            record.emplace_back(new Long64_t(std::stoll(col)));
-         } else {
-            fColContainingEmpty.insert(fHeaders[i]);
-            record.emplace_back(new Long64_t(0));
-         }
-         break;
-      }
-      case 'O': {
-         auto b = new bool();
-         record.emplace_back(b);
-         if (col != "nan") {
-            std::istringstream(col) >> std::boolalpha >> *b;
-         } else {
-            fColContainingEmpty.insert(fHeaders[i]);
-            *b = false;
-         }
-         break;
-      }
-      case 'T': {
-         record.emplace_back(new std::string(col));
-         break;
-      }
-      }
-      ++i;
-   }
-}
-
 void RCsvDS::GenerateHeaders(size_t size)
 {
    fHeaders.reserve(size);
@@ -276,12 +265,17 @@ void RCsvDS::InferType(const std::string &col, unsigned int idxCol)
 std::vector<std::string> RCsvDS::ParseColumns(const std::string &line)
 {
    std::vector<std::string> columns;
+   ParseColumns(line, columns);
+   return columns;
+}
 
+/// Split a line into its cells, reusing the memory of `columns`.
+void RCsvDS::ParseColumns(const std::string &line, std::vector<std::string> &columns)
+{
+   columns.clear();
    for (size_t i = 0; i < line.size(); ++i) {
       i = ParseValue(line, columns, i);
    }
-
-   return columns;
 }
 
 size_t RCsvDS::ParseValue(const std::string &line, std::vector<std::string> &columns, size_t i)
@@ -374,48 +368,33 @@ RCsvDS::RCsvDS(std::string_view fileName, bool readHeaders, char delimiter, Long
    }
 }
 
-void RCsvDS::FreeRecords()
-{
-   for (auto &record : fRecords) {
-      for (size_t i = 0; i < record.size(); ++i) {
-         void *p = record[i];
-         const auto colType = fColTypes[fHeaders[i]];
-         switch (colType) {
-         case 'D': {
-            delete static_cast<double *>(p);
-            break;
-         }
-         case 'L': {
-            delete static_cast<Long64_t *>(p);
-            break;
-         }
-         case 'O': {
-            delete static_cast<bool *>(p);
-            break;
-         }
-         case 'T': {
-            delete static_cast<std::string *>(p);
-            break;
-         }
-         }
-      }
-   }
-   fRecords.clear();
-}
-
 ////////////////////////////////////////////////////////////////////////
 /// Destructor.
-RCsvDS::~RCsvDS()
-{
-   FreeRecords();
-}
+RCsvDS::~RCsvDS() {}
 
 void RCsvDS::Finalize()
 {
    fCsvFile->Seek(fDataPos);
    fProcessedLines = 0ULL;
-   fEntryRangesRequested = 0ULL;
-   FreeRecords();
+   fFirstEntryInChunk = 0ULL;
+   fLines.clear();
+
+   std::set<std::string> colContainingEmpty;
+   for (auto &slotCols : fColContainingEmpty) {
+      colContainingEmpty.insert(slotCols.begin(), slotCols.end());
+      slotCols.clear();
+   }
+   if (!colContainingEmpty.empty()) {
+      std::string msg = "";
+      for (const auto &col : colContainingEmpty) {
+         const auto colT = GetTypeName(col);
+         msg += "Column \"" + col + "\" of type " + colT + " contains empty cell(s) or NaN(s).\n";
+         msg += "There is no `nan` equivalent for type " + colT + ", hence ";
+         msg += std::string(colT == "Long64_t" ? "`0`" : "`false`") + " is stored.\n";
+      }
+      msg += "Please manually set the column type to `double` (with `D`) in `FromCSV` to read NaNs instead.\n";
+      Warning("RCsvDS", "%s", msg.c_str());
+   }
 }
 
 const std::vector<std::string> &RCsvDS::GetColumnNames() const
@@ -425,40 +404,27 @@ const std::vector<std::string> &RCsvDS::GetColumnNames() const
 
 std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
 {
-   // Read records and store them in memory
+   // Read the lines and store them in memory, they are parsed in SetEntry
    auto linesToRead = fLinesChunkSize;
-   FreeRecords();
+   fLines.clear();
 
    std::string line;
    while ((-1LL == fLinesChunkSize || 0 != linesToRead) && fCsvFile->Readln(line)) {
       if (line.empty()) continue; // skip empty lines
-      fRecords.emplace_back();
-      FillRecord(line, fRecords.back());
+      fLines.emplace_back(std::move(line));
       --linesToRead;
    }
 
-   if (!fColContainingEmpty.empty()) {
-      std::string msg = "";
-      for (const auto &col : fColContainingEmpty) {
-         const auto colT = GetTypeName(col);
-         msg += "Column \"" + col + "\" of type " + colT + " contains empty cell(s) or NaN(s).\n";
-         msg += "There is no `nan` equivalent for type " + colT + ", hence ";
-         msg += std::string(colT == "Long64_t" ? "`0`" : "`false`") + " is stored.\n";
-      }
-      msg += "Please manually set the column type to `double` (with `D`) in `FromCSV` to read NaNs instead.\n";
-      Warning("RCsvDS", "%s", msg.c_str());
-   }
-
    if (gDebug > 0) {
       if (fLinesChunkSize == -1LL) {
-         Info("GetEntryRanges", "Attempted to read entire CSV file into memory, %zu lines read", fRecords.size());
+         Info("GetEntryRanges", "Attempted to read entire CSV file into memory, %zu lines read", fLines.size());
       } else {
-         Info("GetEntryRanges", "Attempted to read chunk of %lld lines of CSV file into memory, %zu lines read", fLinesChunkSize, fRecords.size());
+         Info("GetEntryRanges", "Attempted to read chunk of %lld lines of CSV file into memory, %zu lines read", fLinesChunkSize, fLines.size());
       }
    }
 
    std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
-   const auto nRecords = fRecords.size();
+   const auto nRecords = fLines.size();
    if (0 == nRecords)
       return entryRanges;
 
@@ -475,8 +441,8 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
    }
    entryRanges.back().second += remainder;
 
+   fFirstEntryInChunk = fProcessedLines;
    fProcessedLines += nRecords;
-   fEntryRangesRequested++;
 
    return entryRanges;
 }
@@ -502,31 +468,46 @@ bool RCsvDS::HasColumn(std::string_view colName) const
    return fHeaders.end() != std::find(fHeaders.begin(), fHeaders.end(), colName);
 }
 
+////////////////////////////////////////////////////////////////////////
+/// Parse the line corresponding to the entry and convert the values of the columns read by the event loop.
+/// Lines are parsed here rather than when the chunk is read, so that the processing slots parse them in parallel.
 bool RCsvDS::SetEntry(unsigned int slot, ULong64_t entry)
 {
-   // Here we need to normalise the entry to the number of lines we already processed.
-   const auto offset = (fEntryRangesRequested - 1) * fLinesChunkSize;
-   const auto recordPos = entry - offset;
+   auto &columns = fSlotColumns[slot];
+   ParseColumns(fLines[entry - fFirstEntryInChunk], columns);
+   if (columns.size() < fHeaders.size()) {
+      throw std::runtime_error("RCsvDS: entry " + std::to_string(entry) + " has " + std::to_string(columns.size()) +
+                               " fields, expected " + std::to_string(fHeaders.size()) + ".");
+   }
+
    int colIndex = 0;
    for (auto &colType : fColTypesList) {
-      auto dataPtr = fRecords[recordPos][colIndex];
-      switch (colType) {
-      case 'D': {
-         fDoubleEvtValues[colIndex][slot] = *static_cast<double *>(dataPtr);
-         break;
-      }
-      case 'L': {
-         fLong64EvtValues[colIndex][slot] = *static_cast<Long64_t *>(dataPtr);
-         break;
-      }
-      case 'O': {
-         fBoolEvtValues[colIndex][slot] = *static_cast<bool *>(dataPtr);
-         break;
-      }
-      case 'T': {
-         fStringEvtValues[colIndex][slot] = *static_cast<std::string *>(dataPtr);
-         break;
-      }
+      const auto &col = columns[colIndex];
+      const bool isNaN = col == "nan";
+      if (isNaN && (colType == 'L' || colType == 'O'))
+         fColContainingEmpty[slot].insert(fHeaders[colIndex]);
+
+      // the values of columns that no reader asked for are not needed
+      if (fColAddresses[colIndex][slot]) {
+         switch (colType) {
+         case 'D': {
+            fDoubleEvtValues[colIndex][slot] =
+               isNaN ? std::numeric_limits<double>::quiet_NaN() : ParseDouble(col, fHeaders[colIndex]);
+            break;
+         }
+         case 'L': {
+            fLong64EvtValues[colIndex][slot] = isNaN ? 0 : ParseLong64(col, fHeaders[colIndex]);
+            break;
+         }
+         case 'O': {
+            fBoolEvtValues[colIndex][slot] = col == "true";
+            break;
+         }
+         case 'T': {
+            fStringEvtValues[colIndex][slot] = col;
+            break;
+         }
+         }
       }
       colIndex++;
    }
@@ -548,6 +529,9 @@ void RCsvDS::SetNSlots(unsigned int nSlots)
    fLong64EvtValues.resize(nColumns, std::vector<Long64_t>(fNSlots));
    fStringEvtValues.resize(nColumns, std::vector<std::string>(fNSlots));
    fBoolEvtValues.resize(nColumns, std::deque<bool>(fNSlots));
+
+   fSlotColumns.resize(fNSlots);
+   fColContainingEmpty.resize(fNSlots);
 }
 
 std::string RCsvDS::GetLabel()
@@ -10,6 +10,9 @@
 
 #include "ROOT/RDF/ActionHelpers.hxx"
 #include "ROOT/RDF/Utils.hxx" // CacheLineStep
+#include "TSystem.h"
+
+#include <atomic>
 
 namespace ROOT {
 namespace Internal {
@@ -107,6 +110,86 @@ void BufferedFillHelper::Finalize()
    }
 }
 
+std::string MakeCacheSpillFileName(const std::string &directory)
+{
+   static std::atomic<unsigned int> counter{0};
+   const std::string dir = directory.empty() ? gSystem->TempDirectory() : directory;
+   return dir + "/rdfcache_" + std::to_string(gSystem->GetPid()) + "_" + std::to_string(counter++) + ".root";
+}
+
+namespace {
+/// Give access to TH1::GetStatOverflowsBehaviour, which also takes into account the global TH1::StatOverflows setting
+struct RStatOverflowsAccess : public ::TH1D {
+   static bool Get(const ::TH1 &h) { return (h.*&RStatOverflowsAccess::GetStatOverflowsBehaviour)(); }
+};
+} // anonymous namespace
+
+bool GetStatOverflowsBehaviour(const ::TH1 &h)
+{
+   return RStatOverflowsAccess::Get(h);
+}
+
+bool UseConcurrentFill(const ::TH1 &h, unsigned int nSlots)
+{
+   // per-slot copies are faster to fill, so they are only avoided when they would take more than this
+   constexpr std::size_t kMaxCopiesSize = 256 * 1024 * 1024;
+   if (nSlots < 2 || h.GetBufferSize() > 0)
+      return false;
+   for (const auto *axis : {h.GetXaxis(), h.GetYaxis(), h.GetZaxis()}) {
+      if (axis->CanExtend() || axis->IsAlphanumeric())
+         return false;
+   }
+   const std::size_t arraysPerCopy = h.GetSumw2N() > 0 ? 2 : 1;
+   return (nSlots - 1) * arraysPerCopy * h.GetNcells() * sizeof(double) > kMaxCopiesSize;
+}
+
+FillHistoBankHelper::FillHistoBankHelper(const std::shared_ptr<std::vector<Hist_t>> &hists, const unsigned int nSlots)
+   : fResultHists(hists), fHasSumw2(false)
+{
+   std::size_t nBins = 0;
+   fAxes.reserve(fResultHists->size());
+   for (const auto &h : *fResultHists) {
+      const auto *axis = h.GetXaxis();
+      const bool isVariable = axis->GetXbins()->GetSize() > 0;
+      fAxes.push_back({axis->GetNbins(), axis->GetXmin(), axis->GetXmax(), isVariable ? axis : nullptr, nBins,
+                       RStatOverflowsAccess::Get(h)});
+      nBins += h.GetNcells();
+      fHasSumw2 |= h.GetSumw2N() > 0;
+   }
+
+   fSumw.assign(nSlots, std::vector<double>(nBins, 0.));
+   if (fHasSumw2)
+      fSumw2.assign(nSlots, std::vector<double>(nBins, 0.));
+   fStats.assign(nSlots, std::vector<double>(fgNStats * fAxes.size(), 0.));
+}
+
+void FillHistoBankHelper::Finalize()
+{
+   const auto nSlots = fSumw.size();
+   for (std::size_t slot = 1; slot < nSlots; ++slot) {
+      std::transform(fSumw[0].begin(), fSumw[0].end(), fSumw[slot].begin(), fSumw[0].begin(), std::plus<double>());
+      if (fHasSumw2)
+         std::transform(fSumw2[0].begin(), fSumw2[0].end(), fSumw2[slot].begin(), fSumw2[0].begin(),
+                        std::plus<double>());
+      std::transform(fStats[0].begin(), fStats[0].end(), fStats[slot].begin(), fStats[0].begin(),
+                     std::plus<double>());
+   }
+
+   for (std::size_t i = 0; i < fAxes.size(); ++i) {
+      auto &h = (*fResultHists)[i];
+      const auto offset = fAxes[i].fOffset;
+      const auto nCells = h.GetNcells();
+      // the result histograms are empty, TH1D stores its bin contents in its TArrayD base
+      std::copy(fSumw[0].begin() + offset, fSumw[0].begin() + offset + nCells, h.GetArray());
+      if (h.GetSumw2N() > 0)
+         std::copy(fSumw2[0].begin() + offset, fSumw2[0].begin() + offset + nCells, h.GetSumw2()->GetArray());
+      double stats[4] = {fStats[0][i * fgNStats + 1], fStats[0][i * fgNStats + 2], fStats[0][i * fgNStats + 3],
+                         fStats[0][i * fgNStats + 4]};
+      h.PutStats(stats);
+      h.SetEntries(fStats[0][i * fgNStats]);
+   }
+}
+
 MeanHelper::MeanHelper(const std::shared_ptr<double> &meanVPtr, const unsigned int nSlots)
    : fResultMean(meanVPtr), fCounts(nSlots, 0), fSums(nSlots, 0), fPartialMeans(nSlots), fCompensations(nSlots)
 {
@@ -242,6 +325,18 @@ void ValidateSnapshotOutput(const RSnapshotOptions &opts, const std::string &tre
    }
 }
 
+/// Return the name of the output file of slot `slot` of a Snapshot that writes one file per slot:
+/// "out.root" becomes "out_<slot>.root", a file name without extension is suffixed with "_<slot>".
+std::string GetPerSlotSnapshotFileName(const std::string &fileName, unsigned int slot)
+{
+   const auto slotSuffix = "_" + std::to_string(slot);
+   const auto extPos = fileName.rfind('.');
+   const auto dirPos = fileName.find_last_of("/\\");
+   if (extPos == std::string::npos || (dirPos != std::string::npos && extPos < dirPos))
+      return fileName + slotSuffix;
+   return fileName.substr(0, extPos) + slotSuffix + fileName.substr(extPos);
+}
+
 } // end NS RDF
 } // end NS Internal
 } // end NS ROOT
@@ -15,8 +15,10 @@
 #include "ROOT/RDF/RVariationReader.hxx"
 #include "ROOT/RDF/Utils.hxx" // IsStrInVec
 
+#include <algorithm>
 #include <cassert>
 #include <set>
+#include <sstream>
 
 namespace ROOT {
 namespace Internal {
@@ -55,6 +57,30 @@ RDFDetail::RDefineBase *RColumnRegister::GetDefine(std::string_view colName) con
    return it == fDefines->end() ? nullptr : &it->second->GetDefine();
 }
 
+////////////////////////////////////////////////////////////////////////////
+/// \brief Return a string that identifies what provides the values of a column at this point of the computation graph.
+/// The identity is made of the Define node or dataset column that produces the nominal values, and of the variations
+/// registered for the column. Two registers that return the same identity for a column read the same values for it,
+/// nominal and varied. The column name must not be an alias.
+std::string RColumnRegister::GetColumnIdentity(const std::string &colName) const
+{
+   std::stringstream identity;
+   if (const auto *define = GetDefine(colName))
+      identity << "define@" << define;
+   else
+      identity << "column:" << colName;
+
+   std::vector<const RVariationBase *> variations;
+   auto range = fVariations->equal_range(colName);
+   for (auto it = range.first; it != range.second; ++it)
+      variations.emplace_back(&it->second->GetVariation());
+   std::sort(variations.begin(), variations.end());
+   for (const auto *variation : variations)
+      identity << ",vary@" << variation;
+
+   return identity.str();
+}
+
 ////////////////////////////////////////////////////////////////////////////
 /// \brief Check if the provided name is tracked in the names list
 bool RColumnRegister::IsDefineOrAlias(std::string_view name) const
@@ -27,7 +27,8 @@ GraphDrawing::CreateDefineNode(const std::string &columnName, const ROOT::Detail
    if (duplicateDefineIt != visitedMap.end())
       return duplicateDefineIt->second;
 
-   auto node = std::make_shared<GraphNode>("Define\\n" + columnName, visitedMap.size(), ENodeType::kDefine);
+   auto node = std::make_shared<GraphNode>("Define\\n" + columnName + GetProfileLabel(columnPtr->GetProfile()),
+                                           visitedMap.size(), ENodeType::kDefine);
    visitedMap[(void *)columnPtr] = node;
    return node;
 }
@@ -43,8 +44,9 @@ GraphDrawing::CreateFilterNode(const ROOT::Detail::RDF::RFilterBase *filterPtr,
       return duplicateFilterIt->second;
    }
 
-   auto node = std::make_shared<GraphNode>((filterPtr->HasName() ? filterPtr->GetName() : "Filter"), visitedMap.size(),
-                                           ENodeType::kFilter);
+   auto node = std::make_shared<GraphNode>((filterPtr->HasName() ? filterPtr->GetName() : "Filter") +
+                                              GetProfileLabel(filterPtr->GetProfile()),
+                                           visitedMap.size(), ENodeType::kFilter);
    visitedMap[(void *)filterPtr] = node;
    return node;
 }
@@ -85,6 +85,13 @@ unsigned int ROOT::RDF::RunGraphs(std::vector<RResultHandle> handles)
    std::set<RResultHandle, decltype(sameGraph)> s(handles.begin(), handles.end(), sameGraph);
    std::vector<RResultHandle> uniqueLoops(s.begin(), s.end());
 
+   // Open the input files and compute the cluster boundaries of all multi-thread event loops in background tasks,
+   // while the interpreter compiles the code of all graphs.
+   for (auto &h : uniqueLoops) {
+      if (h.fLoopManager)
+         h.fLoopManager->PrepareRun();
+   }
+
    // Trigger jitting. One call is enough to jit the code required by all computation graphs.
    TStopwatch sw;
    sw.Start();
@@ -137,6 +144,18 @@ ROOT::RDF::Experimental::SnapshotPtr_t ROOT::RDF::Experimental::VariationsFor(RO
    throw std::logic_error("Varying a Snapshot result is not implemented yet.");
 }
 
+void ROOT::RDF::Experimental::ChangeDataset(ROOT::RDF::RNode node, ROOT::RDF::Experimental::RDatasetSpec &&spec)
+{
+   ROOT::Internal::RDF::ChangeSpec(node, std::move(spec));
+}
+
+ROOT::RDF::Experimental::SnapshotPtr_t
+ROOT::RDF::Experimental::CloneResult(const ROOT::RDF::Experimental::SnapshotPtr_t &resPtr,
+                                     const std::string &outputFileName)
+{
+   return ROOT::Internal::RDF::CloneResultAndAction(resPtr, outputFileName);
+}
+
 namespace ROOT {
 namespace RDF {
 
@@ -19,17 +19,21 @@
 #include <ROOT/RDF/RLoopManager.hxx>
 #include <ROOT/RDF/RNodeBase.hxx>
 #include <ROOT/RDF/Utils.hxx>
+#include <ROOT/RLogger.hxx>
 #include <string_view>
 #include <TBranch.h>
+#include <TChain.h>
 #include <TClass.h>
 #include <TClassEdit.h>
 #include <TDataType.h>
 #include <TError.h>
 #include <TLeaf.h>
+#include <TMD5.h>
 #include <TObjArray.h>
 #include <TPRegexp.h>
 #include <TROOT.h>
 #include <TString.h>
+#include <TSystem.h>
 #include <TTree.h>
 #include <TVirtualMutex.h>
 
@@ -48,9 +52,11 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdlib>  // for size_t
+#include <fstream>
 #include <iterator> // for back_insert_iterator
 #include <map>
 #include <memory>
+#include <regex>
 #include <set>
 #include <sstream>
 #include <stdexcept>
@@ -361,6 +367,146 @@ ThrowJitBuildActionHelperTypeError(const std::string &actionTypeNameBase, const
    throw std::runtime_error(exceptionText);
 }
 
+/// Return the part of the key used to share identical jitted nodes that describes their input columns.
+std::string JitSharingKeyForColumns(const ColumnNames_t &columns, const ROOT::Internal::RDF::RColumnRegister &colRegister)
+{
+   std::string key;
+   for (const auto &col : columns)
+      key += '\n' + colRegister.GetColumnIdentity(col);
+   return key;
+}
+
+/// The code that wires the jitted nodes to the computation graph, made independent of the running process.
+struct JitCacheEntry {
+   /// Content hash of the compiled code, also used to name the cached library and its entry point
+   std::string fHash;
+   /// Full source of the library to compile
+   std::string fSource;
+   /// Name of the `extern "C"` function that runs the code
+   std::string fEntryPoint;
+   /// Runtime addresses that the code received as literals, in the order in which it expects them
+   std::vector<void *> fArgs;
+};
+
+using JitCacheEntryPoint_t = void (*)(void **);
+
+/// Return the directory of the on-disk cache of compiled jitted code, or an empty string if the cache is disabled.
+std::string GetJitCacheDir()
+{
+   const char *dir = gSystem->Getenv("ROOT_RDF_JIT_CACHE_DIR");
+   return dir ? dir : "";
+}
+
+/// Produce the cacheable version of the code generated by the Book*Jit functions.
+/// Addresses of runtime objects, which the code receives as `reinterpret_cast<T*>(0x1234)` literals, are replaced by
+/// the elements of an argument array so that the compiled code only depends on the structure of the computation
+/// graph, the expressions and the column types. The definitions of the R_rdf functions it uses are included as well.
+JitCacheEntry MakeJitCacheEntry(const std::string &code)
+{
+   JitCacheEntry entry;
+
+   static const std::regex addrRegex(">\\((0x[0-9a-fA-F]+|0)\\)");
+   std::string body;
+   std::size_t last = 0;
+   for (auto it = std::sregex_iterator(code.begin(), code.end(), addrRegex); it != std::sregex_iterator(); ++it) {
+      body.append(code, last, it->position() - last);
+      body += ">(rdf_args[" + std::to_string(entry.fArgs.size()) + "])";
+      entry.fArgs.emplace_back(reinterpret_cast<void *>(std::stoull((*it)[1].str(), nullptr, 16)));
+      last = it->position() + it->length();
+   }
+   body.append(code, last, std::string::npos);
+
+   static const std::regex funcRegex("R_rdf::(func[0-9]+)\\b");
+   std::set<std::string> usedFuncs;
+   for (auto it = std::sregex_iterator(body.begin(), body.end(), funcRegex); it != std::sregex_iterator(); ++it)
+      usedFuncs.insert((*it)[1].str());
+
+   std::string funcDecls;
+   {
+      R__LOCKGUARD(gROOTMutex);
+      for (const auto &codeAndName : GetJittedExprs()) {
+         const auto baseName = codeAndName.second.substr(codeAndName.second.rfind(':') + 1);
+         if (usedFuncs.count(baseName) > 0)
+            funcDecls += "auto " + baseName + codeAndName.first + "\n";
+      }
+   }
+
+   TMD5 md5;
+   const std::string key = std::string(gROOT->GetVersion()) + gROOT->GetGitCommit() + funcDecls + body;
+   md5.Update(reinterpret_cast<const UChar_t *>(key.data()), key.size());
+   md5.Final();
+   entry.fHash = md5.AsString();
+   entry.fEntryPoint = "R__rdf_jitted_" + entry.fHash;
+
+   // the R_rdf functions are also declared to the interpreter: give them a namespace of their own in the library
+   const auto ns = "R_rdf_" + entry.fHash;
+   body = std::regex_replace(body, std::regex("R_rdf::"), ns + "::");
+
+   std::stringstream source;
+   source << "// Computation graph code jitted by RDataFrame, ROOT " << gROOT->GetVersion() << "\n"
+          << "#include \"ROOT/RDataFrame.hxx\"\n"
+          << "#include \"ROOT/RDF/ActionHelpers.hxx\"\n"
+          << "#include \"ROOT/RDF/InterfaceUtils.hxx\"\n"
+          << "#include \"ROOT/RVec.hxx\"\n"
+          << "#include \"TMath.h\"\n"
+          << "using namespace std;\n"
+          << "namespace " << ns << " {\n"
+          << funcDecls << "}\n"
+          << "extern \"C\" void " << entry.fEntryPoint << "(void **rdf_args)\n{\n"
+          << body << "\n}\n";
+   entry.fSource = source.str();
+
+   return entry;
+}
+
+/// Load the entry point of a cached library, return nullptr if the library is not available.
+JitCacheEntryPoint_t LoadJitCacheEntry(const std::string &libPath, const std::string &entryPoint)
+{
+   if (gSystem->AccessPathName(libPath.c_str()) || gSystem->Load(libPath.c_str()) < 0)
+      return nullptr;
+   return reinterpret_cast<JitCacheEntryPoint_t>(gSystem->DynFindSymbol(libPath.c_str(), entryPoint.c_str()));
+}
+
+/// Compile the code of a cache entry into a library in the cache directory.
+/// Code that cannot be compiled outside of the interpreter (e.g. because it uses types or functions that were only
+/// declared to it) is marked as such, so that later processes do not try again.
+void StoreJitCacheEntry(const std::string &cacheDir, const JitCacheEntry &entry)
+{
+   const auto base = cacheDir + "/rdfjit_" + entry.fHash;
+   const auto failedMarker = base + ".failed";
+   if (!gSystem->AccessPathName(failedMarker.c_str()))
+      return;
+
+   if (gSystem->AccessPathName(cacheDir.c_str()) && gSystem->mkdir(cacheDir.c_str(), /*recursive=*/true) != 0) {
+      R__LOG_WARNING(ROOT::Internal::RDF::RDFLogChannel()) << "Could not create the jit cache directory " << cacheDir;
+      return;
+   }
+
+   // Several processes could be filling the same entry at the same time: each one builds the library under a name of
+   // its own, which is then moved in place.
+   const auto uniqueBase = base + "_" + std::to_string(gSystem->GetPid());
+   const auto sourcePath = uniqueBase + ".cxx";
+   {
+      std::ofstream sourceFile(sourcePath);
+      sourceFile << entry.fSource;
+      if (!sourceFile) {
+         R__LOG_WARNING(ROOT::Internal::RDF::RDFLogChannel()) << "Could not write " << sourcePath;
+         return;
+      }
+   }
+
+   if (!gSystem->CompileMacro(sourcePath.c_str(), "kOcs")) {
+      std::ofstream{failedMarker};
+      R__LOG_WARNING(ROOT::Internal::RDF::RDFLogChannel())
+         << "The jitted code could not be compiled into the jit cache, see " << sourcePath;
+      return;
+   }
+
+   const auto libPath = base + "." + gSystem->GetSoExt();
+   gSystem->Rename((uniqueBase + "_cxx." + gSystem->GetSoExt()).c_str(), libPath.c_str());
+   R__LOG_INFO(ROOT::Internal::RDF::RDFLogChannel()) << "Stored the jitted code in the jit cache as " << libPath;
+}
+
 } // anonymous namespace
 
 namespace ROOT {
@@ -652,6 +798,24 @@ BookFilterJit(std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string
    if (type != "bool")
       std::runtime_error("Filter: the following expression does not evaluate to bool:\n" + std::string(expression));
 
+   // An unnamed filter with the same expression, inputs and previous node as one booked earlier would select exactly
+   // the same entries: share that node instead of evaluating the expression twice per entry.
+   auto *lmPtr = (*prevNodeOnHeap)->GetLoopManagerUnchecked();
+   std::string sharingKey;
+   if (name.empty()) {
+      std::stringstream key;
+      key << prevNodeOnHeap->get() << '\n' << funcName << JitSharingKeyForColumns(parsedExpr.fUsedCols, colRegister);
+      sharingKey = key.str();
+      auto &sharedFilters = lmPtr->GetSharedJittedFilters();
+      const auto filterIt = sharedFilters.find(sharingKey);
+      if (filterIt != sharedFilters.end()) {
+         if (auto sharedFilter = filterIt->second.lock()) {
+            delete prevNodeOnHeap;
+            return sharedFilter;
+         }
+      }
+   }
+
    // definesOnHeap is deleted by the jitted call to JitFilterHelper
    ROOT::Internal::RDF::RColumnRegister *definesOnHeap = new ROOT::Internal::RDF::RColumnRegister(colRegister);
    const auto definesOnHeapAddr = PrettyPrintAddr(definesOnHeap);
@@ -681,8 +845,9 @@ BookFilterJit(std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string
                     << "reinterpret_cast<ROOT::Internal::RDF::RColumnRegister*>(" << definesOnHeapAddr << ")"
                     << ");\n";
 
-   auto lm = jittedFilter->GetLoopManagerUnchecked();
-   lm->ToJitExec(filterInvocation.str());
+   lmPtr->ToJitExec(filterInvocation.str());
+   if (!sharingKey.empty())
+      lmPtr->GetSharedJittedFilters()[sharingKey] = jittedFilter;
 
    return jittedFilter;
 }
@@ -702,6 +867,19 @@ std::shared_ptr<RJittedDefine> BookDefineJit(std::string_view name, std::string_
    const auto funcName = DeclareFunction(parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes);
    const auto type = RetTypeOfFunc(funcName);
 
+   // A Define with the same name, expression and inputs as one booked earlier (e.g. in another branch of the
+   // computation graph) produces the same values: share that node instead of evaluating the expression twice per entry.
+   const auto sharingKey =
+      std::string(name) + '\n' + funcName + JitSharingKeyForColumns(parsedExpr.fUsedCols, colRegister);
+   auto &sharedDefines = lm.GetSharedJittedDefines();
+   const auto defineIt = sharedDefines.find(sharingKey);
+   if (defineIt != sharedDefines.end()) {
+      if (auto sharedDefine = defineIt->second.lock()) {
+         delete upcastNodeOnHeap;
+         return sharedDefine;
+      }
+   }
+
    auto definesCopy = new RColumnRegister(colRegister);
    auto definesAddr = PrettyPrintAddr(definesCopy);
    auto jittedDefine = std::make_shared<RDFDetail::RJittedDefine>(name, type, lm, colRegister, parsedExpr.fUsedCols);
@@ -727,6 +905,7 @@ std::shared_ptr<RJittedDefine> BookDefineJit(std::string_view name, std::string_
                     << PrettyPrintAddr(upcastNodeOnHeap) << "));\n";
 
    lm.ToJitExec(defineInvocation.str());
+   sharedDefines[sharingKey] = jittedDefine;
    return jittedDefine;
 }
 
@@ -878,6 +1057,31 @@ std::string JitBuildAction(const ColumnNames_t &cols, std::shared_ptr<RDFDetail:
    return createAction_str.str();
 }
 
+/// Run the code booked by the just-in-time compiled nodes of the computation graphs.
+/// If the ROOT_RDF_JIT_CACHE_DIR environment variable is set, the compiled code is looked up in that directory, keyed
+/// on a hash of the expressions, the column types, the structure of the graph and the ROOT version, and loaded from
+/// there instead of being compiled by the interpreter. On a cache miss the code is run through the interpreter as usual
+/// and then compiled into the cache for the benefit of later processes.
+void InterpreterCalcCached(const std::string &code, const std::string &context)
+{
+   const auto cacheDir = GetJitCacheDir();
+   if (cacheDir.empty()) {
+      InterpreterCalc(code, context);
+      return;
+   }
+
+   auto entry = MakeJitCacheEntry(code);
+   const auto libPath = cacheDir + "/rdfjit_" + entry.fHash + "." + gSystem->GetSoExt();
+   if (auto entryPoint = LoadJitCacheEntry(libPath, entry.fEntryPoint)) {
+      R__LOG_INFO(RDFLogChannel()) << "Loaded the jitted code from the jit cache " << libPath;
+      entryPoint(entry.fArgs.data());
+      return;
+   }
+
+   InterpreterCalc(code, context);
+   StoreJitCacheEntry(cacheDir, entry);
+}
+
 bool AtLeastOneEmptyString(const std::vector<std::string_view> strings)
 {
    for (const auto &s : strings) {
@@ -887,6 +1091,55 @@ bool AtLeastOneEmptyString(const std::vector<std::string_view> strings)
    return false;
 }
 
+/// Create the result histograms of a Histo1DBank action, throw if a model does not have fixed axis limits.
+std::shared_ptr<std::vector<::TH1D>> MakeHistoBank(const std::vector<ROOT::RDF::TH1DModel> &models)
+{
+   if (models.empty())
+      throw std::runtime_error("Histo1DBank: at least one histogram model is required.");
+
+   auto hists = std::make_shared<std::vector<::TH1D>>();
+   hists->reserve(models.size());
+   for (const auto &model : models) {
+      {
+         ROOT::Internal::RDF::RIgnoreErrorLevelRAII iel(kError);
+         hists->emplace_back(*model.GetHistogram());
+      }
+      auto &h = hists->back();
+      h.SetDirectory(nullptr);
+      if (!HistoUtils<::TH1D>::HasAxisLimits(h))
+         throw std::runtime_error("Histo1DBank: the model of histogram \"" + std::string(h.GetName()) +
+                                  "\" does not have axis limits. All histograms of a bank must have fixed axes.");
+   }
+   return hists;
+}
+
+namespace {
+/// A chain of the temporary files a Cache spilled to, which deletes them when it is destroyed
+class RSpilledCacheChain final : public TChain {
+   std::vector<std::string> fFileNames;
+
+public:
+   RSpilledCacheChain(const std::vector<std::string> &fileNames) : TChain("rdfcache"), fFileNames(fileNames)
+   {
+      for (const auto &fileName : fFileNames)
+         Add(fileName.c_str());
+   }
+
+   ~RSpilledCacheChain() final
+   {
+      Reset(); // close the current file before removing it
+      for (const auto &fileName : fFileNames)
+         gSystem->Unlink(fileName.c_str());
+   }
+};
+} // anonymous namespace
+
+/// Return a chain of the files a Cache spilled to, which deletes the files when it is destroyed.
+std::unique_ptr<TTree> MakeSpilledCacheChain(const std::vector<std::string> &fileNames)
+{
+   return std::make_unique<RSpilledCacheChain>(fileNames);
+}
+
 std::shared_ptr<RNodeBase> UpcastNode(std::shared_ptr<RNodeBase> ptr)
 {
    return ptr;
@@ -0,0 +1,67 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDFMultiProcess.hxx"
+#include "ROOT/InternalTreeUtils.hxx" // GetClustersAndEntries, MakeClusterAlignedRanges, ExpandGlob
+#include "TROOT.h"                    // IsImplicitMTEnabled
+
+#include <sys/mman.h>
+
+#include <cerrno>
+#include <cstring> // std::strerror
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+RSharedMemory::RSharedMemory(std::size_t size) : fSize(size)
+{
+   fAddress = mmap(nullptr, fSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+   if (fAddress == MAP_FAILED)
+      throw std::runtime_error("RunMultiProcess: could not create a shared memory mapping of " +
+                               std::to_string(fSize) + " bytes: " + std::strerror(errno));
+}
+
+RSharedMemory::~RSharedMemory()
+{
+   munmap(fAddress, fSize);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Split the entries of a chain of trees into cluster-aligned global entry ranges.
+/// The cluster boundaries of all files are joined into those of the whole chain before splitting, so a range can span
+/// several files.
+std::vector<std::pair<Long64_t, Long64_t>> GetMultiProcessRanges(const std::string &treeName,
+                                                                 const std::vector<std::string> &fileNameGlobs,
+                                                                 unsigned int nRanges)
+{
+   std::vector<Long64_t> boundaries{0};
+   for (const auto &glob : fileNameGlobs) {
+      const bool isGlob = glob.find_first_of("[]*?") != std::string::npos;
+      const auto fileNames = isGlob ? ROOT::Internal::TreeUtils::ExpandGlob(glob) : std::vector<std::string>{glob};
+      for (const auto &fileName : fileNames) {
+         const auto offset = boundaries.back();
+         const auto clustersAndEntries = ROOT::Internal::TreeUtils::GetClustersAndEntries(treeName, fileName);
+         const auto &fileBoundaries = clustersAndEntries.first;
+         // the first boundary of each file is its entry 0, which is the last boundary of the chain so far
+         for (std::size_t i = 1u; i < fileBoundaries.size(); ++i)
+            boundaries.push_back(offset + fileBoundaries[i]);
+      }
+   }
+   return ROOT::Internal::TreeUtils::MakeClusterAlignedRanges(boundaries, nRanges);
+}
+
+void CheckMultiProcessPreconditions()
+{
+   if (ROOT::IsImplicitMTEnabled())
+      throw std::runtime_error("RunMultiProcess: implicit multi-threading must be disabled before forking processes.");
+}
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
@@ -12,8 +12,12 @@
 #include "ROOT/RDataSource.hxx"
 #include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RMergeableValue.hxx" // TreeReduce
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RLogger.hxx"
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
 #include "RtypesCore.h"
 #include "TBranch.h"
 #include "TBranchElement.h"
@@ -26,10 +30,12 @@
 #include "TROOT.h" // IsImplicitMTEnabled, GetThreadPoolSize
 #include "TTree.h"
 
+#include <algorithm>
 #include <stdexcept>
 #include <string>
 #include <cstring>
 #include <typeinfo>
+#include <vector>
 
 using namespace ROOT::Detail::RDF;
 using namespace ROOT::RDF;
@@ -442,6 +448,25 @@ auto RStringCache::Insert(const std::string &string) -> decltype(fStrings)::cons
 
    return fStrings.insert(string).first;
 }
+
+void TreeReduce(std::size_t nValues, const std::function<void(std::size_t, std::size_t)> &mergeInto)
+{
+   std::vector<std::size_t> targets;
+   for (std::size_t stride = 1; stride < nValues; stride *= 2) {
+      targets.clear();
+      for (std::size_t i = 0; i + stride < nValues; i += 2 * stride)
+         targets.push_back(i);
+      // always merging the right element into the left one preserves the order of the elements
+      auto mergePair = [&mergeInto, stride](std::size_t to) { mergeInto(to, to + stride); };
+#ifdef R__USE_IMT
+      if (ROOT::IsImplicitMTEnabled() && targets.size() > 1) {
+         ROOT::TThreadExecutor{}.Foreach(mergePair, targets);
+         continue;
+      }
+#endif
+      std::for_each(targets.begin(), targets.end(), mergePair);
+   }
+}
 } // end NS RDF
 } // end NS Internal
 } // end NS ROOT
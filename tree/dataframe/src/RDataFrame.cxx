@@ -129,6 +129,7 @@ produce many different results in one event loop. Instant actions trigger the ev
 | Graph() | Fills a TGraph with the two columns provided. If multi-threading is enabled, the order of the points may not be the one expected, it is therefore suggested to sort if before drawing. |
 | GraphAsymmErrors() | Fills a TGraphAsymmErrors. If multi-threading is enabled, the order of the points may not be the one expected, it is therefore suggested to sort if before drawing. |
 | Histo1D(), Histo2D(), Histo3D() | Fill a one-, two-, three-dimensional histogram with the processed column values. |
+| Histo1DBank() | Fill many one-dimensional histograms at once, the i-th element of a collection column filling the i-th histogram. Faster than booking one Histo1D() per histogram when there are many of them. |
 | HistoND() | Fill an N-dimensional histogram with the processed column values. |
 | Max() | Return the maximum of processed column values. If the type of the column is inferred, the return type is `double`, the type of the column otherwise.|
 | Mean() | Return the mean of processed column values.|
@@ -962,6 +963,19 @@ See [Efficient analysis in Python](#python) for possible ways to speed up hot pa
 Just-in-time compilation happens once, right before starting an event loop. To reduce the runtime cost of this step, make sure to book all operations *for all RDataFrame computation graphs*
 before the first event loop is triggered: just-in-time compilation will happen once for all code required to be generated up to that point, also across different computation graphs.
 
+Applications that run the same computation graph in many short-lived processes (e.g. thousands of grid jobs running on
+different inputs) can avoid paying for just-in-time compilation in each of them by setting the `ROOT_RDF_JIT_CACHE_DIR`
+environment variable to a directory shared between the processes. The first process that runs a given computation graph
+compiles the corresponding code with ACLiC into a library stored in that directory, keyed on the jitted expressions, the
+column types, the structure of the graph and the ROOT version; later processes load the library instead of invoking the
+interpreter. Jitted code that relies on declarations only known to the interpreter (e.g. functions or types declared via
+`gInterpreter->Declare`) cannot be cached and is always just-in-time compiled.
+
+Identical string expressions booked more than once in the same computation graph are compiled and evaluated only once:
+an unnamed `Filter` with the same expression and input columns as an existing one on the same node, or a `Define` of the
+same column with the same expression and input columns, returns the node that already exists. Computation graphs that
+book the same selection or derived quantity in many branches therefore pay for it once per entry.
+
 Also make sure not to count the just-in-time compilation time (which happens once before the event loop and does not depend on the size of the dataset) as part of the event loop runtime (which scales with the size of the dataset). RDataFrame has an experimental logging feature that simplifies measuring the time spent in just-in-time compilation and in the event loop (as well as providing some more interesting information). See [Activating RDataFrame execution logs](\ref rdf-logging).
 
 ### Memory usage
@@ -984,6 +998,9 @@ auto h2 = df2.Histo1D("y");
 h2->Draw("SAME"); // we just-in-time compile again here, as the second Histo1D call is new
 ~~~
 
+Finally, Cache() stores all cached values in memory. If the cached dataset might not fit, pass an RCacheOptions with a
+`fMemoryBudget`: the cached values that exceed the budget are written to temporary files and read back from there.
+
 \anchor more-features
 ## More features
 Here is a list of the most important features that have been omitted in the "Crash course" for brevity.
@@ -1447,6 +1464,12 @@ verbosity = ROOT.Experimental.RLogScopedVerbosity(ROOT.Detail.RDF.RDFLogChannel(
 More information (e.g. start and end of each multi-thread task) is printed using `ELogLevel.kDebug` and even more
 (e.g. a full dump of the generated code that RDataFrame just-in-time-compiles) using `ELogLevel.kDebug+10`.
 
+To find out which nodes of a computation graph dominate the event loop runtime, profiling can be enabled with
+`ROOT::Internal::RDF::EnableProfiling(ROOT::RDF::AsRNode(df))` before triggering the event loop. Afterwards,
+`ROOT::Internal::RDF::GetProfileReport(ROOT::RDF::AsRNode(df))` returns a JSON report with the exclusive time spent in
+each filter, define, action and dataset column, and the busy and idle time of each processing slot. The node times are
+also shown in the output of ROOT::RDF::SaveGraph(). Profiling adds a small overhead per node and per entry.
+
 \anchor rdf-from-spec
 ### Creating an RDataFrame from a dataset specification file
 
@@ -26,7 +26,8 @@ RDefineBase::RDefineBase(std::string_view name, std::string_view type, const RDF
                          const std::string &variationName)
    : fName(name), fType(type), fLastCheckedEntry(lm.GetNSlots() * RDFInternal::CacheLineStep<Long64_t>(), -1),
      fColRegister(colRegister), fLoopManager(&lm), fColumnNames(columnNames), fIsDefine(columnNames.size()),
-     fVariationDeps(fColRegister.GetVariationDeps(fColumnNames)), fVariation(variationName)
+     fVariationDeps(fColRegister.GetVariationDeps(fColumnNames)), fVariation(variationName),
+     fBulkEvaluated(lm.GetNSlots())
 {
    const auto nColumns = fColumnNames.size();
    for (auto i = 0u; i < nColumns; ++i) {
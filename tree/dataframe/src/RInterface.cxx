@@ -28,6 +28,63 @@ void ROOT::Internal::RDF::ChangeSpec(const ROOT::RDF::RNode &node, ROOT::RDF::Ex
    node.GetLoopManager()->ChangeSpec(std::move(spec));
 }
 
+/**
+ * \brief Set the number of entries processed at a time by the nodes of an RDataFrame computation graph.
+ *
+ * \param node Any node of the computation graph.
+ * \param bulkSize The number of entries per bulk. 1 (the default) means entry-by-entry processing.
+ *
+ * With a bulk size larger than 1, event loops without a data source (e.g. `RDataFrame(nEntries)`) call every action
+ * and filter once per bulk of entries instead of once per entry, which reduces the per-entry dispatch overhead of
+ * simple computation graphs. Results are the same as in the entry-by-entry loop, except that callbacks registered
+ * with RResultPtr::OnPartialResult are invoked at the end of a bulk. Event loops over a TTree or an RDataSource, and
+ * computation graphs with Range or Vary, always run entry by entry.
+ * ~~~{.cpp}
+ * ROOT::RDataFrame df(1000000);
+ * ROOT::Internal::RDF::SetBulkSize(ROOT::RDF::AsRNode(df), 256);
+ * ~~~
+ */
+void ROOT::Internal::RDF::SetBulkSize(const ROOT::RDF::RNode &node, std::size_t bulkSize)
+{
+   node.GetLoopManager()->SetBulkSize(bulkSize);
+}
+
+/**
+ * \brief Collect per-node timings in the next event loops of an RDataFrame computation graph.
+ *
+ * \param node Any node of the computation graph.
+ *
+ * Every event loop run after this call measures the exclusive time spent in each filter, define and action, the time
+ * spent reading each dataset column and the time each processing slot was busy. The timings of the last event loop are
+ * returned by GetProfileReport, and are also shown in the output of ROOT::RDF::SaveGraph. Profiling adds the overhead
+ * of two clock reads per node per entry, so it should not be left enabled in production.
+ * ~~~{.cpp}
+ * ROOT::RDataFrame df("tree", "file.root");
+ * ROOT::Internal::RDF::EnableProfiling(ROOT::RDF::AsRNode(df));
+ * auto h = df.Filter("x > 0").Histo1D("x");
+ * h->Draw();
+ * std::cout << ROOT::Internal::RDF::GetProfileReport(ROOT::RDF::AsRNode(df)) << std::endl;
+ * ~~~
+ */
+void ROOT::Internal::RDF::EnableProfiling(const ROOT::RDF::RNode &node)
+{
+   node.GetLoopManager()->EnableProfiling();
+}
+
+/**
+ * \brief Return the profile of the last event loop of an RDataFrame computation graph, as a JSON string.
+ *
+ * \param node Any node of the computation graph.
+ *
+ * The report contains the wall-clock time of the event loop, the number of bytes read from ROOT files, the busy and
+ * idle time of each processing slot, and the exclusive time and number of calls of each node and dataset column,
+ * sorted by decreasing time. An empty JSON object is returned if profiling was not enabled with EnableProfiling.
+ */
+std::string ROOT::Internal::RDF::GetProfileReport(const ROOT::RDF::RNode &node)
+{
+   return node.GetLoopManager()->GetProfileReport();
+}
+
 /**
  * \brief Trigger the execution of an RDataFrame computation graph.
  * \param[in] node A node of the computation graph (not a result).
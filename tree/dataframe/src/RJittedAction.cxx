@@ -73,6 +73,12 @@ void RJittedAction::Run(unsigned int slot, Long64_t entry)
    fConcreteAction->Run(slot, entry);
 }
 
+void RJittedAction::RunBulk(unsigned int slot, RMaskedEntryRange &mask)
+{
+   assert(fConcreteAction != nullptr);
+   fConcreteAction->RunBulk(slot, mask);
+}
+
 void RJittedAction::Initialize()
 {
    assert(fConcreteAction != nullptr);
@@ -125,6 +131,17 @@ void RJittedAction::SetHasRun()
    return fConcreteAction->SetHasRun();
 }
 
+ROOT::Internal::RDF::RNodeProfile &RJittedAction::GetProfile()
+{
+   // before jitting, return the (empty) profile of this node
+   return fConcreteAction != nullptr ? fConcreteAction->GetProfile() : fProfile;
+}
+
+std::string RJittedAction::GetActionName()
+{
+   return fConcreteAction != nullptr ? fConcreteAction->GetActionName() : RActionBase::GetActionName();
+}
+
 std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode> RJittedAction::GetGraph(
    std::unordered_map<void *, std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode>> &visitedMap)
 {
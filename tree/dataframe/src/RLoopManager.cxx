@@ -9,6 +9,7 @@
 #include "RConfigure.h" // R__USE_IMT
 #include "ROOT/RDataSource.hxx"
 #include "ROOT/RDF/GraphNode.hxx"
+#include "ROOT/RDF/RColumnRegister.hxx"
 #include "ROOT/InternalTreeUtils.hxx" // GetTreeFullPaths
 #include "ROOT/RDF/RActionBase.hxx"
 #include "ROOT/RDF/RDefineBase.hxx"
@@ -19,6 +20,7 @@
 #include "ROOT/RDF/RVariationBase.hxx"
 #include "ROOT/RDF/RVariationReader.hxx" // RVariationsWithReaders
 #include "ROOT/RLogger.hxx"
+#include "ROOT/RTraceSpan.hxx"
 #include "RtypesCore.h" // Long64_t
 #include "TStopwatch.h"
 #include "TBranchElement.h"
@@ -32,6 +34,7 @@
 #include "TTree.h" // For MaxTreeSizeRAII. Revert when #6640 will be solved.
 
 #ifdef R__USE_IMT
+#include "ROOT/TTaskGroup.hxx"
 #include "ROOT/TThreadExecutor.hxx"
 #include "ROOT/TTreeProcessorMT.hxx"
 #include "ROOT/RSlotStack.hxx"
@@ -45,9 +48,11 @@
 #include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <exception>
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <sstream>
@@ -72,6 +77,29 @@ std::string &GetCodeToJit()
    return code;
 }
 
+/// The number of code snippets appended to GetCodeToJit() so far. Protected by ROOT::gCoreMutex.
+ULong64_t &GetNSnippetsToJit()
+{
+   static ULong64_t nSnippets = 0;
+   return nSnippets;
+}
+
+/// The number of code snippets appended to GetCodeToJit() that have been jitted and executed.
+std::atomic<ULong64_t> &GetNSnippetsJitted()
+{
+   static std::atomic<ULong64_t> nSnippets{0};
+   return nSnippets;
+}
+
+/// Held by the thread that is jitting the code taken from GetCodeToJit(). As that code can contain the nodes booked by
+/// the RLoopManagers of other threads, they wait on it instead of starting their event loop before their nodes exist.
+/// It is not ROOT::gCoreMutex, so that the other threads can keep booking nodes and looking up dictionaries meanwhile.
+std::mutex &GetJitMutex()
+{
+   static std::mutex jitMutex;
+   return jitMutex;
+}
+
 bool ContainsLeaf(const std::set<TLeaf *> &leaves, TLeaf *leaf)
 {
    return (leaves.find(leaf) != leaves.end());
@@ -386,6 +414,18 @@ RLoopManager::RLoopManager(std::unique_ptr<RDataSource> ds, const ColumnNames_t
    fDataSource->SetNSlots(fNSlots);
 }
 
+/// The inputs of a multi-thread event loop over TTrees, prepared in a background task.
+struct RLoopManager::RPreparedRun {
+#ifdef R__USE_IMT
+   std::unique_ptr<ROOT::TTreeProcessorMT> fProcessor;
+   std::exception_ptr fError;
+   /// Declared last so that it is destroyed, hence waited for, before the processor
+   ROOT::Experimental::TTaskGroup fPrepareClusters;
+#endif
+};
+
+RLoopManager::~RLoopManager() = default;
+
 RLoopManager::RLoopManager(ROOT::RDF::Experimental::RDatasetSpec &&spec)
    : fNSlots(RDFInternal::GetNSlots()),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kROOTFilesMT : ELoopType::kROOTFiles),
@@ -411,6 +451,13 @@ RLoopManager::RLoopManager(ROOT::RDF::Experimental::RDatasetSpec &&spec)
  */
 void RLoopManager::ChangeSpec(ROOT::RDF::Experimental::RDatasetSpec &&spec)
 {
+   if (fLoopType != ELoopType::kROOTFiles && fLoopType != ELoopType::kROOTFilesMT)
+      throw std::logic_error("RDataFrame: only computation graphs that read TTrees can change their dataset.");
+
+   // The new dataset may be stored in trees with a different set of (unused) branches
+   fValidBranchNames.clear();
+   fPreparedRun.reset();
+
    // Change the range of entries to be processed
    fBeginEntry = spec.GetEntryRangeBegin();
    fEndEntry = spec.GetEntryRangeEnd();
@@ -469,17 +516,28 @@ void RLoopManager::RunEmptySourceMT()
       begin = end;
    }
 
+   const bool runBulk = CanRunBulk();
+   if (runBulk)
+      fBulkMasks.resize(fNSlots);
+
    // Each task will generate a subrange of entries
-   auto genFunction = [this, &slotStack](const std::pair<ULong64_t, ULong64_t> &range) {
+   auto genFunction = [this, &slotStack, runBulk](const std::pair<ULong64_t, ULong64_t> &range) {
       ROOT::Internal::RSlotStackRAII slotRAII(slotStack);
       auto slot = slotRAII.fSlot;
+      RDFInternal::RScopedSlotTimer slotTimer(fProfiler.get(), slot);
+      R__TRACE_SPAN("dataframe", "RLoopManager::RunTask");
       RCallCleanUpTask cleanup(*this, slot);
       InitNodeSlots(nullptr, slot);
       R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({"an empty source", range.first, range.second, slot});
       try {
          UpdateSampleInfo(slot, range);
-         for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
-            RunAndCheckFilters(slot, currEntry);
+         if (runBulk) {
+            for (auto firstEntry = range.first; firstEntry < range.second; firstEntry += fBulkSize)
+               RunAndCheckFiltersBulk(slot, firstEntry, std::min<ULong64_t>(fBulkSize, range.second - firstEntry));
+         } else {
+            for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
+               RunAndCheckFilters(slot, currEntry);
+            }
          }
       } catch (...) {
          // Error might throw in experiment frameworks like CMSSW
@@ -497,15 +555,26 @@ void RLoopManager::RunEmptySourceMT()
 /// Run event loop with no source files, in sequence.
 void RLoopManager::RunEmptySource()
 {
+   RDFInternal::RScopedSlotTimer slotTimer(fProfiler.get(), 0u);
+   R__TRACE_SPAN("dataframe", "RLoopManager::RunTask");
    InitNodeSlots(nullptr, 0);
    R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing(
       {"an empty source", fEmptyEntryRange.first, fEmptyEntryRange.second, 0u});
    RCallCleanUpTask cleanup(*this);
    try {
       UpdateSampleInfo(/*slot*/ 0, fEmptyEntryRange);
-      for (ULong64_t currEntry = fEmptyEntryRange.first;
-           currEntry < fEmptyEntryRange.second && fNStopsReceived < fNChildren; ++currEntry) {
-         RunAndCheckFilters(0, currEntry);
+      if (CanRunBulk()) {
+         fBulkMasks.resize(1);
+         for (ULong64_t firstEntry = fEmptyEntryRange.first;
+              firstEntry < fEmptyEntryRange.second && fNStopsReceived < fNChildren; firstEntry += fBulkSize) {
+            RunAndCheckFiltersBulk(
+               0, firstEntry, std::min<ULong64_t>(fBulkSize, fEmptyEntryRange.second - firstEntry));
+         }
+      } else {
+         for (ULong64_t currEntry = fEmptyEntryRange.first;
+              currEntry < fEmptyEntryRange.second && fNStopsReceived < fNChildren; ++currEntry) {
+            RunAndCheckFilters(0, currEntry);
+         }
       }
    } catch (...) {
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -513,23 +582,32 @@ void RLoopManager::RunEmptySource()
    }
 }
 
-/// Run event loop over one or multiple ROOT files, in parallel.
-void RLoopManager::RunTreeProcessorMT()
-{
 #ifdef R__USE_IMT
+/// Create the TTreeProcessorMT that runs the multi-thread event loop over the input tree or chain.
+/// Return nullptr if there is nothing to process.
+std::unique_ptr<ROOT::TTreeProcessorMT> RLoopManager::MakeTreeProcessorMT()
+{
    if (fEndEntry == fBeginEntry) // empty range => no work needed
-      return;
-   ROOT::Internal::RSlotStack slotStack(fNSlots);
+      return nullptr;
    const auto &entryList = fTree->GetEntryList() ? *fTree->GetEntryList() : TEntryList();
-   auto tp = (fBeginEntry != 0 || fEndEntry != std::numeric_limits<Long64_t>::max())
-                ? std::make_unique<ROOT::TTreeProcessorMT>(*fTree, fNSlots, std::make_pair(fBeginEntry, fEndEntry))
-                : std::make_unique<ROOT::TTreeProcessorMT>(*fTree, entryList, fNSlots);
+   return (fBeginEntry != 0 || fEndEntry != std::numeric_limits<Long64_t>::max())
+             ? std::make_unique<ROOT::TTreeProcessorMT>(*fTree, fNSlots, std::make_pair(fBeginEntry, fEndEntry))
+             : std::make_unique<ROOT::TTreeProcessorMT>(*fTree, entryList, fNSlots);
+}
+#endif
 
+/// Run event loop over one or multiple ROOT files, in parallel.
+void RLoopManager::RunTreeProcessorMT(ROOT::TTreeProcessorMT &tp)
+{
+#ifdef R__USE_IMT
+   ROOT::Internal::RSlotStack slotStack(fNSlots);
    std::atomic<ULong64_t> entryCount(0ull);
 
-   tp->Process([this, &slotStack, &entryCount](TTreeReader &r) -> void {
+   tp.Process([this, &slotStack, &entryCount](TTreeReader &r) -> void {
       ROOT::Internal::RSlotStackRAII slotRAII(slotStack);
       auto slot = slotRAII.fSlot;
+      RDFInternal::RScopedSlotTimer slotTimer(fProfiler.get(), slot);
+      R__TRACE_SPAN("dataframe", "RLoopManager::RunTask");
       RCallCleanUpTask cleanup(*this, slot, &r);
       InitNodeSlots(&r, slot);
       R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing(TreeDatasetLogInfo(r, slot));
@@ -556,12 +634,16 @@ void RLoopManager::RunTreeProcessorMT()
                                   std::to_string(r.GetEntryStatus()));
       }
    });
+#else
+   (void)tp;
 #endif // no-op otherwise (will not be called)
 }
 
 /// Run event loop over one or multiple ROOT files, in sequence.
 void RLoopManager::RunTreeReader()
 {
+   RDFInternal::RScopedSlotTimer slotTimer(fProfiler.get(), 0u);
+   R__TRACE_SPAN("dataframe", "RLoopManager::RunTask");
    TTreeReader r(fTree.get(), fTree->GetEntryList());
    if (0 == fTree->GetEntriesFast() || fBeginEntry == fEndEntry)
       return;
@@ -599,6 +681,8 @@ void RLoopManager::RunTreeReader()
 /// Run event loop over data accessed through a DataSource, in sequence.
 void RLoopManager::RunDataSource()
 {
+   RDFInternal::RScopedSlotTimer slotTimer(fProfiler.get(), 0u);
+   R__TRACE_SPAN("dataframe", "RLoopManager::RunTask");
    assert(fDataSource != nullptr);
    fDataSource->Initialize();
    auto ranges = fDataSource->GetEntryRanges();
@@ -639,6 +723,8 @@ void RLoopManager::RunDataSourceMT()
    auto runOnRange = [this, &slotStack](const std::pair<ULong64_t, ULong64_t> &range) {
       ROOT::Internal::RSlotStackRAII slotRAII(slotStack);
       const auto slot = slotRAII.fSlot;
+      RDFInternal::RScopedSlotTimer slotTimer(fProfiler.get(), slot);
+      R__TRACE_SPAN("dataframe", "RLoopManager::RunTask");
       InitNodeSlots(nullptr, slot);
       RCallCleanUpTask cleanup(*this, slot);
       fDataSource->InitSlot(slot, range.first);
@@ -687,12 +773,67 @@ void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
       callback(slot);
 }
 
+/// Execute actions and make sure named filters are called for the `nEntries` entries starting at `firstEntry`.
+/// Each node is called once for the whole bulk of entries instead of once per entry: filters record their results
+/// in a per-entry mask and defines keep one value per entry of the bulk, so that every action sees the same results
+/// as in the entry-by-entry loop. Callbacks registered with RegisterCallback are invoked after the whole bulk.
+void RLoopManager::RunAndCheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t nEntries)
+{
+   // data-block callbacks run before the rest of the graph
+   if (fNewSampleNotifier.CheckFlag(slot)) {
+      for (auto &callback : fSampleCallbacks)
+         callback.second(slot, fSampleInfos[slot]);
+      fNewSampleNotifier.UnsetFlag(slot);
+   }
+
+   for (auto *filterPtr : fBookedFilters)
+      filterPtr->SetBulkRange(slot, firstEntry, nEntries);
+   for (auto *definePtr : fBookedDefines)
+      definePtr->SetBulkRange(slot, firstEntry, nEntries);
+
+   auto &mask = fBulkMasks[slot];
+   for (auto *actionPtr : fBookedActions) {
+      mask.Reset(firstEntry, nEntries);
+      actionPtr->RunBulk(slot, mask);
+   }
+   for (auto *namedFilterPtr : fBookedNamedFilters) {
+      mask.Reset(firstEntry, nEntries);
+      namedFilterPtr->CheckFiltersBulk(slot, mask);
+   }
+   for (auto &callback : fCallbacksEveryNEvents) {
+      for (std::size_t i = 0u; i < nEntries; ++i)
+         callback(slot);
+   }
+}
+
+/// Return true if the event loop can process entries in bulks of fBulkSize entries.
+/// Only loops without a data source qualify: TTree and RDataSource columns can only be read for the current entry.
+/// Ranges count the entries they see and varied actions evaluate their filters entry by entry, so the bulk loop is
+/// not used if the computation graph contains any of them.
+bool RLoopManager::CanRunBulk() const
+{
+   return fBulkSize > 1 && (fLoopType == ELoopType::kNoFiles || fLoopType == ELoopType::kNoFilesMT) &&
+          fBookedRanges.empty() && fBookedVariations.empty();
+}
+
+/// Set the number of entries processed at a time by the nodes of the computation graph.
+/// A value larger than 1 enables the bulk event loop (see RunAndCheckFiltersBulk) for the event loops that support
+/// it, 1 (the default) restores entry-by-entry processing.
+void RLoopManager::SetBulkSize(std::size_t bulkSize)
+{
+   if (bulkSize == 0)
+      throw std::invalid_argument("RDataFrame: the bulk size must be larger than zero.");
+   fBulkSize = bulkSize;
+}
+
 /// Build TTreeReaderValues for all nodes
 /// This method loops over all filters, actions and other booked objects and
 /// calls their `InitSlot` method, to get them ready for running a task.
 void RLoopManager::InitNodeSlots(TTreeReader *r, unsigned int slot)
 {
    SetupSampleCallbacks(r, slot);
+   if (r != nullptr)
+      SetupTreeCache(*r);
    for (auto *ptr : fBookedActions)
       ptr->InitSlot(r, slot);
    for (auto *ptr : fBookedFilters)
@@ -706,6 +847,27 @@ void RLoopManager::InitNodeSlots(TTreeReader *r, unsigned int slot)
       callback(slot);
 }
 
+/// Register all branches read by the computation graph with the TTreeCache of the tree processed by this task, so that
+/// the very first cache fill already contains all the branches that will be read. The TTreeReader then sets the cache
+/// entry range and stops the learning phase when it sets up its proxies. Branches of friend trees are left to the
+/// TTreeReader, as they are not served by this cache.
+void RLoopManager::SetupTreeCache(TTreeReader &r)
+{
+   auto *tree = r.GetTree();
+   if (fColumnReadCounts.empty() || tree == nullptr)
+      return;
+   auto *file = tree->GetCurrentFile();
+   auto *currentTree = tree->GetTree();
+   if (file == nullptr || currentTree == nullptr || currentTree->GetReadCache(file, true) == nullptr)
+      return;
+
+   for (const auto &colAndReads : fColumnReadCounts) {
+      auto *branch = currentTree->GetBranch(colAndReads.first.c_str());
+      if (branch != nullptr && branch->GetTree() == currentTree)
+         tree->AddBranchToCache(branch, /*subbranches*/ true);
+   }
+}
+
 void RLoopManager::SetupSampleCallbacks(TTreeReader *r, unsigned int slot) {
    if (r != nullptr) {
       // we need to set a notifier so that we run the callbacks every time we switch to a new TTree
@@ -810,24 +972,38 @@ void RLoopManager::CleanUpTask(TTreeReader *r, unsigned int slot)
 
 /// Add RDF nodes that require just-in-time compilation to the computation graph.
 /// This method also clears the contents of GetCodeToJit().
+/// If another thread is jitting the code it took from GetCodeToJit(), which may include the nodes of this
+/// RLoopManager, this method waits for it to complete.
 void RLoopManager::Jit()
 {
    {
       R__READ_LOCKGUARD(ROOT::gCoreMutex);
-      if (GetCodeToJit().empty()) {
+      if (GetCodeToJit().empty() && fLastSnippetToJit <= GetNSnippetsJitted()) {
          R__LOG_INFO(RDFLogChannel()) << "Nothing to jit and execute.";
          return;
       }
    }
 
-   const std::string code = []() {
+   std::lock_guard<std::mutex> jitGuard(GetJitMutex());
+
+   ULong64_t nSnippets = 0;
+   const std::string code = [&nSnippets]() {
       R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
-      return std::move(GetCodeToJit());
+      nSnippets = GetNSnippetsToJit();
+      std::string c;
+      std::swap(c, GetCodeToJit());
+      return c;
    }();
+   if (code.empty()) {
+      // the code was jitted by another thread while we were waiting
+      R__LOG_INFO(RDFLogChannel()) << "Nothing to jit and execute.";
+      return;
+   }
 
    TStopwatch s;
    s.Start();
-   RDFInternal::InterpreterCalc(code, "RLoopManager::Run");
+   RDFInternal::InterpreterCalcCached(code, "RLoopManager::Run");
+   GetNSnippetsJitted() = nSnippets;
    s.Stop();
    R__LOG_INFO(RDFLogChannel()) << "Just-in-time compilation phase completed"
                                 << (s.RealTime() > 1e-3 ? " in " + std::to_string(s.RealTime()) + " seconds."
@@ -848,6 +1024,29 @@ void RLoopManager::EvalChildrenCounts()
       namedFilterPtr->TriggerChildrenCount();
 }
 
+/// Start opening the input files and computing the cluster boundaries of the next multi-thread event loop over TTrees
+/// in a background task. Run() calls this itself, so that the preparation overlaps with jitting; RunGraphs calls it
+/// for all computation graphs before jitting the code of all of them at once. Does nothing for other event loops, or
+/// if the next event loop is already being prepared.
+void RLoopManager::PrepareRun()
+{
+#ifdef R__USE_IMT
+   if (fLoopType != ELoopType::kROOTFilesMT || fPreparedRun)
+      return;
+   fPreparedRun = std::make_unique<RPreparedRun>();
+   fPreparedRun->fProcessor = MakeTreeProcessorMT();
+   if (fPreparedRun->fProcessor) {
+      fPreparedRun->fPrepareClusters.Run([preparedRun = fPreparedRun.get()] {
+         try {
+            preparedRun->fProcessor->PrepareClusters();
+         } catch (...) {
+            preparedRun->fError = std::current_exception();
+         }
+      });
+   }
+#endif
+}
+
 /// Start the event loop with a different mechanism depending on IMT/no IMT, data source/no data source.
 /// Also perform a few setup and clean-up operations (jit actions if necessary, clear booked actions after the loop...).
 /// The jitting phase is skipped if the `jit` parameter is `false` (unsafe, use with care).
@@ -860,9 +1059,32 @@ void RLoopManager::Run(bool jit)
 
    ThrowIfNSlotsChanged(GetNSlots());
 
+   // Opening the input files and computing the cluster boundaries of the multi-thread event loop does not depend on the
+   // jitted code: it happens in a separate task while the interpreter compiles it.
+   // The prepared run is destroyed (hence waited for) at the end of this scope, also if jitting throws.
+   PrepareRun();
+   auto preparedRun = std::move(fPreparedRun);
+
    if (jit)
       Jit();
 
+#ifdef R__USE_IMT
+   std::unique_ptr<ROOT::TTreeProcessorMT> tp;
+   if (preparedRun) {
+      preparedRun->fPrepareClusters.Wait();
+      if (preparedRun->fError)
+         std::rethrow_exception(preparedRun->fError);
+      tp = std::move(preparedRun->fProcessor);
+   }
+#endif
+
+   fColumnReadCounts = GetDatasetColumnReadCounts();
+   if (fDataSource)
+      fDataSource->SetColumnReadHints(fColumnReadCounts);
+
+   if (fProfiler)
+      StartProfiling();
+
    InitNodes();
 
    // Exceptions can occur during the event loop. In order to ensure proper cleanup of nodes
@@ -878,12 +1100,18 @@ void RLoopManager::Run(bool jit)
 
    NodesCleanerRAII runKeeper(*this);
 
+   const auto bytesReadBefore = TFile::GetFileBytesRead();
    TStopwatch s;
    s.Start();
 
    switch (fLoopType) {
    case ELoopType::kNoFilesMT: RunEmptySourceMT(); break;
-   case ELoopType::kROOTFilesMT: RunTreeProcessorMT(); break;
+   case ELoopType::kROOTFilesMT:
+#ifdef R__USE_IMT
+      if (tp)
+         RunTreeProcessorMT(*tp);
+#endif
+      break;
    case ELoopType::kDataSourceMT: RunDataSourceMT(); break;
    case ELoopType::kNoFiles: RunEmptySource(); break;
    case ELoopType::kROOTFiles: RunTreeReader(); break;
@@ -891,6 +1119,9 @@ void RLoopManager::Run(bool jit)
    }
    s.Stop();
 
+   if (fProfiler)
+      fProfiler->SetLoopStats(s.RealTime(), TFile::GetFileBytesRead() - bytesReadBefore);
+
    fNRuns++;
 
    R__LOG_INFO(RDFLogChannel()) << "Finished event loop number " << fNRuns - 1 << " (" << s.CpuTime() << "s CPU, "
@@ -993,6 +1224,7 @@ void RLoopManager::ToJitExec(const std::string &code) const
 {
    R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
    GetCodeToJit().append(code);
+   fLastSnippetToJit = ++GetNSnippetsToJit();
 }
 
 void RLoopManager::RegisterCallback(ULong64_t everyNEvents, std::function<void(unsigned int)> &&f)
@@ -1064,6 +1296,49 @@ const ColumnNames_t &RLoopManager::GetBranchNames()
    return fValidBranchNames;
 }
 
+////////////////////////////////////////////////////////////////////////////
+/// \brief Return the dataset columns read by the computation graph, with the number of nodes that read each of them.
+/// Columns produced by Define nodes are not included, but the dataset columns they read are. Only nodes that are
+/// already booked (and jitted) are taken into account, so the result is complete right before the event loop starts.
+std::map<std::string, unsigned int> RLoopManager::GetDatasetColumnReadCounts()
+{
+   std::map<std::string, unsigned int> readCounts;
+   if (!fTree && !fDataSource)
+      return readCounts;
+
+   auto countReads = [&readCounts](const ColumnNames_t &columns, const RDFInternal::RColumnRegister &colRegister) {
+      for (const auto &col : columns) {
+         const std::string resolvedCol{colRegister.ResolveAlias(col)};
+         if (!colRegister.IsDefine(resolvedCol))
+            ++readCounts[resolvedCol];
+      }
+   };
+   for (auto *action : fBookedActions)
+      countReads(action->GetColumnNames(), action->GetColRegister());
+   for (auto *filter : fBookedFilters)
+      countReads(filter->GetColumnNames(), filter->GetColRegister());
+   for (auto *define : fBookedDefines)
+      countReads(define->GetColumnNames(), define->GetColRegister());
+   for (auto *variation : fBookedVariations)
+      countReads(variation->GetInputColumnNames(), variation->GetColRegister());
+
+   // drop whatever the dataset does not provide, e.g. columns that are only known to some nodes' registers
+   const auto isDatasetColumn = [this](const std::string &col) {
+      if (fDataSource)
+         return fDataSource->HasColumn(col);
+      const auto &branchNames = GetBranchNames();
+      return std::find(branchNames.begin(), branchNames.end(), col) != branchNames.end();
+   };
+   for (auto it = readCounts.begin(); it != readCounts.end();) {
+      if (isDatasetColumn(it->first))
+         ++it;
+      else
+         it = readCounts.erase(it);
+   }
+
+   return readCounts;
+}
+
 /// Return true if AddDataSourceColumnReaders was called for column name col.
 bool RLoopManager::HasDataSourceColumnReaders(const std::string &col, const std::type_info &ti) const
 {
@@ -1098,11 +1373,143 @@ RColumnReaderBase *RLoopManager::AddTreeColumnReader(unsigned int slot, const st
    const auto key = MakeDatasetColReadersKey(col, ti);
    // if a reader for this column and this slot was already there, we are doing something wrong
    assert(readers.find(key) == readers.end() || readers[key] == nullptr);
+   if (fProfiler) {
+      if (auto *profile = fProfiler->GetColumnProfile(col))
+         reader = std::make_unique<RDFInternal::RProfiledColumnReader>(std::move(reader), *profile, slot);
+   }
    auto *rptr = reader.get();
    readers[key] = std::move(reader);
    return rptr;
 }
 
+////////////////////////////////////////////////////////////////////////////
+/// \brief Record the time spent in each node, column reader and processing slot in the next event loops.
+/// See GetProfileReport(). Profiling has a small cost per node and per entry, so it is disabled by default.
+void RLoopManager::EnableProfiling()
+{
+   if (!fProfiler)
+      fProfiler = std::make_unique<RDFInternal::RProfiler>(fNSlots);
+}
+
+/// Reset the profiling information and start profiling all nodes and dataset column readers for the next event loop.
+void RLoopManager::StartProfiling()
+{
+   std::vector<std::string> columns;
+   for (const auto &colAndReads : fColumnReadCounts)
+      columns.emplace_back(colAndReads.first);
+   fProfiler->Reset(columns);
+
+   // actions that ran in previous event loops must not appear in the report of this one
+   for (auto *action : fRunActions)
+      action->GetProfile().Disable();
+
+   for (auto *action : fBookedActions)
+      action->GetProfile().Enable(*fProfiler);
+   for (auto *filter : fBookedFilters)
+      filter->GetProfile().Enable(*fProfiler);
+   for (auto *define : fBookedDefines)
+      define->GetProfile().Enable(*fProfiler);
+
+   // data source column readers are created when operations are booked, tree column readers at every task (see
+   // AddTreeColumnReader)
+   if (fDataSource) {
+      for (unsigned int slot = 0u; slot < fNSlots; ++slot) {
+         for (auto &keyAndReader : fDatasetColumnReaders[slot]) {
+            auto &reader = keyAndReader.second;
+            if (!reader || dynamic_cast<RDFInternal::RProfiledColumnReader *>(reader.get()))
+               continue;
+            const auto &key = keyAndReader.first; // see MakeDatasetColReadersKey
+            if (auto *profile = fProfiler->GetColumnProfile(key.substr(0, key.rfind(':'))))
+               reader = std::make_unique<RDFInternal::RProfiledColumnReader>(std::move(reader), *profile, slot);
+         }
+      }
+   }
+}
+
+namespace {
+std::string EscapeJSON(const std::string &s)
+{
+   std::string escaped;
+   for (const auto c : s) {
+      if (c == '"' || c == '\\')
+         escaped += '\\';
+      escaped += c;
+   }
+   return escaped;
+}
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Return the profiling information of the last event loop as a JSON string.
+/// The report contains the elapsed time of the event loop, the bytes read from files while it ran, the time each
+/// processing slot spent processing tasks and idling, and the time spent in each filter, define, action and dataset
+/// column reader, ordered from the most to the least expensive. Node times are exclusive: e.g. the time spent in a
+/// Define that is evaluated because a Filter needs its value is attributed to the Define and not to the Filter.
+/// Return an empty string if profiling is not enabled.
+std::string RLoopManager::GetProfileReport() const
+{
+   if (!fProfiler)
+      return "{}";
+
+   struct RNodeEntry {
+      std::string fType, fName;
+      double fSeconds;
+      ULong64_t fNCalls;
+   };
+   std::vector<RNodeEntry> nodes;
+   for (auto *action : fRunActions) {
+      const auto &profile = action->GetProfile();
+      if (profile.IsEnabled())
+         nodes.push_back({"Action", action->GetActionName(), profile.GetSeconds(), profile.GetNCalls()});
+   }
+   for (auto *filter : fBookedFilters) {
+      const auto &profile = filter->GetProfile();
+      // also skips the jitted placeholders, whose concrete filters are booked separately
+      if (profile.GetNCalls() > 0)
+         nodes.push_back(
+            {"Filter", filter->HasName() ? filter->GetName() : "", profile.GetSeconds(), profile.GetNCalls()});
+   }
+   for (auto *define : fBookedDefines) {
+      const auto &profile = define->GetProfile();
+      if (profile.IsEnabled())
+         nodes.push_back({"Define", define->GetName(), profile.GetSeconds(), profile.GetNCalls()});
+   }
+   std::stable_sort(nodes.begin(), nodes.end(),
+                    [](const RNodeEntry &a, const RNodeEntry &b) { return a.fSeconds > b.fSeconds; });
+
+   std::vector<std::pair<std::string, const RDFInternal::RNodeProfile *>> columns;
+   for (const auto &colAndProfile : fProfiler->GetColumnProfiles()) {
+      if (colAndProfile.second.GetNCalls() > 0)
+         columns.emplace_back(colAndProfile.first, &colAndProfile.second);
+   }
+   std::stable_sort(columns.begin(), columns.end(), [](const auto &a, const auto &b) {
+      return a.second->GetSeconds() > b.second->GetSeconds();
+   });
+
+   std::stringstream report;
+   report << "{\n  \"eventLoop\": {\"realTime\": " << fProfiler->GetLoopSeconds()
+          << ", \"bytesRead\": " << fProfiler->GetBytesRead() << ", \"slots\": [";
+   for (unsigned int slot = 0u; slot < fNSlots; ++slot) {
+      const auto busy = fProfiler->GetBusySeconds(slot);
+      report << (slot == 0u ? "" : ", ") << "{\"slot\": " << slot << ", \"busyTime\": " << busy
+             << ", \"idleTime\": " << std::max(0., fProfiler->GetLoopSeconds() - busy) << "}";
+   }
+   report << "]},\n  \"nodes\": [";
+   for (std::size_t i = 0u; i < nodes.size(); ++i) {
+      report << (i == 0u ? "\n" : ",\n") << "    {\"type\": \"" << nodes[i].fType << "\", \"name\": \""
+             << EscapeJSON(nodes[i].fName) << "\", \"time\": " << nodes[i].fSeconds
+             << ", \"calls\": " << nodes[i].fNCalls << "}";
+   }
+   report << "\n  ],\n  \"columns\": [";
+   for (std::size_t i = 0u; i < columns.size(); ++i) {
+      report << (i == 0u ? "\n" : ",\n") << "    {\"name\": \"" << EscapeJSON(columns[i].first)
+             << "\", \"time\": " << columns[i].second->GetSeconds()
+             << ", \"reads\": " << columns[i].second->GetNCalls() << "}";
+   }
+   report << "\n  ]\n}\n";
+   return report.str();
+}
+
 RColumnReaderBase *
 RLoopManager::GetDatasetColumnReader(unsigned int slot, const std::string &col, const std::type_info &ti) const
 {
@@ -15,6 +15,7 @@
  *************************************************************************/
 
 #include <ROOT/RDF/RColumnReaderBase.hxx>
+#include <ROOT/RColumn.hxx>
 #include <ROOT/RField.hxx>
 #include <ROOT/RPageStorageFile.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
@@ -23,12 +24,20 @@
 #include <ROOT/RPageStorage.hxx>
 #include <string_view>
 
+#include <ROOT/TSeq.hxx>
+#include <RConfigure.h> // R__USE_IMT
 #include <TError.h>
+#include <TROOT.h> // IsImplicitMTEnabled
 #include <TSystem.h>
+#ifdef R__USE_IMT
+#include <ROOT/TThreadExecutor.hxx>
+#endif
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
 #include <mutex>
+#include <stdexcept>
 #include <string>
 #include <vector>
 #include <typeinfo>
@@ -45,6 +54,9 @@
 * For each column containing an array or a collection, a corresponding column `#colname` is available to access
 * `colname.size()` without reading and deserializing the collection values.
 *
+* Columns of fundamental types that are stored as-is (e.g. no bit packing, no type conversion) are not copied: RDataFrame
+* reads the values directly from the RNTuple pages.
+*
 **/
 // clang-format on
 
@@ -150,6 +162,12 @@ public:
 };
 
 /// Every RDF column is represented by exactly one RNTuple field
+/// Gives the column readers access to the principal column of simple fields.
+class RPrincipalColumnAccess : public ROOT::Experimental::RFieldBase {
+public:
+   static RColumn *Get(const RFieldBase &field) { return GetPrincipalColumnOf(field); }
+};
+
 class RNTupleColumnReader : public ROOT::Detail::RDF::RColumnReaderBase {
    using RFieldBase = ROOT::Experimental::RFieldBase;
    using RPageSource = ROOT::Experimental::Internal::RPageSource;
@@ -164,6 +182,10 @@ class RNTupleColumnReader : public ROOT::Detail::RDF::RColumnReaderBase {
    /// The entry offset stores the logical entry number (sum of all previous physical entries) when a file of the corresponding
    /// data source was opened.
    Long64_t fEntryOffset = 0;
+   /// For simple fields (a single column with the in-memory layout of the value type), the column whose pages are
+   /// handed to RDF directly instead of copying the values into fValue. Null for all other fields.
+   RColumn *fMappedColumn = nullptr;
+   void *fMappedAddress = nullptr; ///< Address of the value of fLastEntry inside the page mapped by fMappedColumn
 
 public:
    RNTupleColumnReader(RNTupleDS *ds, RFieldBase *protoField) : fDataSource(ds), fProtoField(protoField) {}
@@ -191,6 +213,13 @@ public:
 
       ROOT::Experimental::Internal::CallConnectPageSourceOnField(*fField, source);
 
+      fMappedColumn = nullptr;
+      if (fField->IsSimple()) {
+         auto column = RPrincipalColumnAccess::Get(*fField);
+         if (column && column->GetElement()->GetSize() == fField->GetValueSize())
+            fMappedColumn = column;
+      }
+
       if (fValuePtr) {
          // When the reader reconnects to a new file, the fValuePtr is already set
          fValue = std::make_unique<RFieldBase::RValue>(fField->BindValue(fValuePtr));
@@ -208,11 +237,22 @@ public:
       }
       fValue = nullptr;
       fField = nullptr;
+      fMappedColumn = nullptr;
+      fMappedAddress = nullptr;
       fLastEntry = -1;
    }
 
+   /// For simple fields, the returned address points into the page buffer and changes from entry to entry.
    void *GetImpl(Long64_t entry) final
    {
+      if (fMappedColumn) {
+         if (entry != fLastEntry) {
+            fMappedAddress = fMappedColumn->MapUntyped(entry - fEntryOffset);
+            fLastEntry = entry;
+         }
+         return fMappedAddress;
+      }
+
       if (entry != fLastEntry) {
          fValue->Read(entry - fEntryOffset);
          fLastEntry = entry;
@@ -404,6 +444,32 @@ CreatePageSource(std::string_view ntupleName, std::string_view fileName)
 {
    return ROOT::Experimental::Internal::RPageSource::Create(ntupleName, fileName, GetOpts());
 }
+
+/// Returns the ID of the leaf field with the given qualified name (of the form a.b.c) if it has one value per entry,
+/// i.e. if it and all its ancestors are neither collections nor fixed-size arrays. Otherwise, returns
+/// kInvalidDescriptorId.
+ROOT::Experimental::DescriptorId_t
+FindSingleValueFieldId(const ROOT::Experimental::RNTupleDescriptor &desc, std::string_view qualifiedName)
+{
+   using ROOT::Experimental::ENTupleStructure;
+   auto fieldId = desc.GetFieldZeroId();
+   while (true) {
+      const auto dot = qualifiedName.find('.');
+      fieldId = desc.FindFieldId(qualifiedName.substr(0, dot), fieldId);
+      if (fieldId == ROOT::Experimental::kInvalidDescriptorId)
+         return fieldId;
+      const auto &fieldDesc = desc.GetFieldDescriptor(fieldId);
+      if (fieldDesc.GetNRepetitions() > 0)
+         return ROOT::Experimental::kInvalidDescriptorId;
+      if (dot == std::string_view::npos) {
+         return (fieldDesc.GetStructure() == ENTupleStructure::kLeaf) ? fieldId
+                                                                        : ROOT::Experimental::kInvalidDescriptorId;
+      }
+      if (fieldDesc.GetStructure() != ENTupleStructure::kRecord)
+         return ROOT::Experimental::kInvalidDescriptorId;
+      qualifiedName = qualifiedName.substr(dot + 1);
+   }
+}
 } // namespace
 
 RNTupleDS::RNTupleDS(std::string_view ntupleName, std::string_view fileName)
@@ -472,18 +538,36 @@ void RNTupleDS::ExecStaging()
 void RNTupleDS::StageNextSources()
 {
    const auto nFiles = fFileNames.empty() ? 1 : fFileNames.size();
-   for (auto i = fNextFileIndex; (i < nFiles) && ((i - fNextFileIndex) < fNSlots); ++i) {
+   const auto endFileIndex = std::min<std::size_t>(nFiles, fNextFileIndex + fNSlots);
+
+   auto fnStage = [this](std::size_t i) {
       if (fStagingThreadShouldTerminate)
          return;
 
       if (fStagingArea[i]) {
          // The first file is already open and was used to read the schema
          assert(i == 0);
-      } else {
-         fStagingArea[i] = CreatePageSource(fNTupleName, fFileNames[i]);
-         fStagingArea[i]->LoadStructure();
+         return;
+      }
+      auto source = CreatePageSource(fNTupleName, fFileNames[i]);
+      try {
+         source->Attach();
+      } catch (const std::exception &) {
+         // Leave it to PrepareNextRanges(), which opens the file again and reports the error from the main thread
+         return;
       }
+      fStagingArea[i] = std::move(source);
+   };
+
+   // Reading and deserializing the meta-data of a file does not depend on the other files
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && (endFileIndex - fNextFileIndex > 1)) {
+      ROOT::TThreadExecutor().Foreach(fnStage, ROOT::TSeq<std::size_t>(fNextFileIndex, endFileIndex));
+      return;
    }
+#endif
+   for (auto i = fNextFileIndex; i < endFileIndex; ++i)
+      fnStage(i);
 }
 
 void RNTupleDS::PrepareNextRanges()
@@ -514,6 +598,7 @@ void RNTupleDS::PrepareNextRanges()
             continue;
 
          range.fLastEntry = nEntries; // whole file per slot, i.e. entry range [0..nEntries - 1]
+         range.fNEntriesInFile = nEntries;
          fNextRanges.emplace_back(std::move(range));
       }
       return;
@@ -576,11 +661,94 @@ void RNTupleDS::PrepareNextRanges()
          range.fSource->SetEntryRange({start, end - start});
          range.fFirstEntry = start;
          range.fLastEntry = end;
+         range.fNEntriesInFile = (iSlot == 0) ? nEntries : 0;
          fNextRanges.emplace_back(std::move(range));
       }
    } // loop over tail of remaining files
 }
 
+void RNTupleDS::ApplyClusterCuts()
+{
+   std::vector<REntryRangeDS> prunedRanges;
+   for (auto &range : fNextRanges) {
+      // The entry ranges [first, last) of the runs of consecutive clusters that can pass all the cuts
+      std::vector<std::pair<ULong64_t, ULong64_t>> runs;
+      {
+         auto descriptorGuard = range.fSource->GetSharedDescriptorGuard();
+         // The physical columns of all the representations of the cut fields, with the allowed value range
+         std::vector<std::pair<DescriptorId_t, const RClusterCut *>> cutColumns;
+         for (const auto &cut : fClusterCuts) {
+            const auto fieldId = FindSingleValueFieldId(descriptorGuard.GetRef(), cut.fFieldName);
+            if (fieldId == kInvalidDescriptorId)
+               continue;
+            const auto &fieldDesc = descriptorGuard->GetFieldDescriptor(fieldId);
+            for (const auto &columnDesc : descriptorGuard->GetColumnIterable(fieldDesc)) {
+               if (columnDesc.GetIndex() == 0)
+                  cutColumns.emplace_back(columnDesc.GetPhysicalId(), &cut);
+            }
+         }
+
+         for (auto clusterId = descriptorGuard->FindClusterId(0, 0); clusterId != kInvalidDescriptorId;
+              clusterId = descriptorGuard->FindNextClusterId(clusterId)) {
+            const auto &clusterDesc = descriptorGuard->GetClusterDescriptor(clusterId);
+            const ULong64_t first = clusterDesc.GetFirstEntryIndex();
+            const ULong64_t last = first + clusterDesc.GetNEntries();
+            if (last <= range.fFirstEntry)
+               continue;
+            if (first >= range.fLastEntry)
+               break;
+            bool canPass = true;
+            for (const auto &[physicalId, cut] : cutColumns) {
+               if (!clusterDesc.ContainsColumn(physicalId))
+                  continue;
+               const auto &columnRange = clusterDesc.GetColumnRange(physicalId);
+               if (columnRange.fIsSuppressed || !columnRange.fValueRange)
+                  continue;
+               if ((columnRange.fValueRange->fMax < cut->fMin) || (columnRange.fValueRange->fMin > cut->fMax)) {
+                  canPass = false;
+                  break;
+               }
+            }
+            if (canPass) {
+               if (!runs.empty() && (runs.back().second == first))
+                  runs.back().second = last;
+               else
+                  runs.emplace_back(first, last);
+            }
+         }
+      }
+
+      if (runs.empty()) {
+         // Keep the first range of the file as an empty placeholder: it carries the number of entries of the file
+         // for GetEntryRanges() and, in single-threaded mode, the page source.
+         if (range.fNEntriesInFile > 0) {
+            range.fFirstEntry = range.fLastEntry = 0;
+            prunedRanges.emplace_back(std::move(range));
+         }
+         continue;
+      }
+
+      if (fNSlots == 1) {
+         // A single page source reads all the runs of the file, so its entry range has to span all of them
+         range.fSource->SetEntryRange({runs.front().first, runs.back().second - runs.front().first});
+      }
+      for (std::size_t i = 0; i < runs.size(); ++i) {
+         REntryRangeDS run;
+         if (fNSlots > 1) {
+            run.fSource = (i == runs.size() - 1) ? std::move(range.fSource) : range.fSource->Clone();
+            run.fSource->SetEntryRange({runs[i].first, runs[i].second - runs[i].first});
+         } else if (i == 0) {
+            run.fSource = std::move(range.fSource);
+         }
+         run.fFirstEntry = runs[i].first;
+         run.fLastEntry = runs[i].second;
+         run.fNEntriesInFile = (i == 0) ? range.fNEntriesInFile : 0;
+         prunedRanges.emplace_back(std::move(run));
+      }
+   }
+   std::swap(fNextRanges, prunedRanges);
+}
+
 std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
 {
    std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
@@ -597,62 +765,71 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
       }
    }
 
-   // If we have fewer files than slots and we run multiple event loops, we can reuse fCurrentRanges and don't need
-   // to worry about loading the fNextRanges. I.e., in this case we don't enter the if block.
-   if (fCurrentRanges.empty() || (fSeenEntries > 0)) {
-      // Otherwise, i.e. start of the first event loop or in the middle of the event loop, prepare the next ranges
-      // and swap with the current ones.
-      {
-         std::unique_lock lock(fMutexStaging);
-         fCvStaging.wait(lock, [this] { return fHasNextSources; });
-      }
-      PrepareNextRanges();
-      if (fNextRanges.empty()) {
-         // No more data
-         return ranges;
-      }
+   // With cluster cuts, all the clusters of the current batch of files may be skipped; continue with the next batch.
+   while (ranges.empty()) {
+      // If we have fewer files than slots and we run multiple event loops, we can reuse fCurrentRanges and don't need
+      // to worry about loading the fNextRanges. I.e., in this case we don't enter the if block.
+      if (fCurrentRanges.empty() || (fSeenEntries > 0)) {
+         // Otherwise, i.e. start of the first event loop or in the middle of the event loop, prepare the next ranges
+         // and swap with the current ones.
+         {
+            std::unique_lock lock(fMutexStaging);
+            fCvStaging.wait(lock, [this] { return fHasNextSources; });
+         }
+         PrepareNextRanges();
+         if (fNextRanges.empty()) {
+            // No more data
+            return ranges;
+         }
+         if (!fClusterCuts.empty())
+            ApplyClusterCuts();
 
-      assert(fNextRanges.size() <= fNSlots);
+         fCurrentRanges.clear();
+         std::swap(fCurrentRanges, fNextRanges);
+      }
 
-      fCurrentRanges.clear();
-      std::swap(fCurrentRanges, fNextRanges);
-   }
+      // Stage next batch of files for the next call to GetEntryRanges()
+      {
+         std::lock_guard _(fMutexStaging);
+         fIsReadyForStaging = true;
+         fHasNextSources = false;
+      }
+      fCvStaging.notify_one();
 
-   // Stage next batch of files for the next call to GetEntryRanges()
-   {
-      std::lock_guard _(fMutexStaging);
-      fIsReadyForStaging = true;
-      fHasNextSources = false;
-   }
-   fCvStaging.notify_one();
+      // Create ranges for the RDF loop manager from the list of REntryRangeDS records.
+      // The entry ranges that are relative to the page source in REntryRangeDS are translated into absolute
+      // entry ranges, given the current state of the entry cursor.
+      // We remember the connection from first absolute entry index of a range to its REntryRangeDS record
+      // so that we can properly rewire the column reader in InitSlot
+      fFirstEntry2RangeIdx.clear();
+      ULong64_t nEntriesPerSource = 0;
+      // The absolute entry index of the first entry of the file of fCurrentRanges[0]
+      ULong64_t firstFileOffset = fSeenEntries;
+      for (std::size_t i = 0; i < fCurrentRanges.size(); ++i) {
+         // Several consecutive ranges may operate on the same file (each with their own page source clone).
+         // The first range of every file carries the number of entries of the file.
+         if (fCurrentRanges[i].fNEntriesInFile > 0) {
+            // New source
+            fSeenEntries += nEntriesPerSource;
+            nEntriesPerSource = fCurrentRanges[i].fNEntriesInFile;
+         }
+         if (i == 0)
+            firstFileOffset = fSeenEntries;
+         // Empty placeholders of files whose clusters were all skipped
+         if (fCurrentRanges[i].fFirstEntry == fCurrentRanges[i].fLastEntry)
+            continue;
+         auto start = fCurrentRanges[i].fFirstEntry + fSeenEntries;
+         auto end = fCurrentRanges[i].fLastEntry + fSeenEntries;
 
-   // Create ranges for the RDF loop manager from the list of REntryRangeDS records.
-   // The entry ranges that are relative to the page source in REntryRangeDS are translated into absolute
-   // entry ranges, given the current state of the entry cursor.
-   // We remember the connection from first absolute entry index of a range to its REntryRangeDS record
-   // so that we can properly rewire the column reader in InitSlot
-   fFirstEntry2RangeIdx.clear();
-   ULong64_t nEntriesPerSource = 0;
-   for (std::size_t i = 0; i < fCurrentRanges.size(); ++i) {
-      // Several consecutive ranges may operate on the same file (each with their own page source clone).
-      // We can detect a change of file when the first entry number jumps back to 0.
-      if (fCurrentRanges[i].fFirstEntry == 0) {
-         // New source
-         fSeenEntries += nEntriesPerSource;
-         nEntriesPerSource = 0;
+         fFirstEntry2RangeIdx[start] = i;
+         ranges.emplace_back(start, end);
       }
-      auto start = fCurrentRanges[i].fFirstEntry + fSeenEntries;
-      auto end = fCurrentRanges[i].fLastEntry + fSeenEntries;
-      nEntriesPerSource += end - start;
+      fSeenEntries += nEntriesPerSource;
 
-      fFirstEntry2RangeIdx[start] = i;
-      ranges.emplace_back(start, end);
-   }
-   fSeenEntries += nEntriesPerSource;
-
-   if ((fNSlots == 1) && (fCurrentRanges[0].fSource)) {
-      for (auto r : fActiveColumnReaders[0]) {
-         r->Connect(*fCurrentRanges[0].fSource, ranges[0].first);
+      if (!ranges.empty() && (fNSlots == 1) && (fCurrentRanges[0].fSource)) {
+         for (auto r : fActiveColumnReaders[0]) {
+            r->Connect(*fCurrentRanges[0].fSource, firstFileOffset);
+         }
       }
    }
 
@@ -736,6 +913,21 @@ void RNTupleDS::Finalize()
    }
 }
 
+void RNTupleDS::SkipClustersOutsideRange(std::string_view fieldName, double min, double max)
+{
+   if (FindSingleValueFieldId(*fPrincipalDescriptor, fieldName) == kInvalidDescriptorId) {
+      throw std::invalid_argument("RNTupleDS: cannot skip clusters based on field '" + std::string(fieldName) +
+                                  "', which is not a leaf field with one value per entry");
+   }
+   if (!(min <= max)) {
+      throw std::invalid_argument("RNTupleDS: invalid value range [" + std::to_string(min) + ", " +
+                                  std::to_string(max) + "] for field '" + std::string(fieldName) + "'");
+   }
+   fClusterCuts.push_back({std::string(fieldName), min, max});
+   // The ranges of a previous event loop, which may be reused, do not know about the new cut
+   fCurrentRanges.clear();
+}
+
 void RNTupleDS::SetNSlots(unsigned int nSlots)
 {
    assert(fNSlots == 0);
@@ -0,0 +1,90 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RProfiler.hxx"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Start profiling with the given profiler, resetting the times collected so far.
+void RNodeProfile::Enable(RProfiler &profiler)
+{
+   const auto nSlots = profiler.GetNSlots();
+   fNs.assign(nSlots * CacheLineStep<Long64_t>(), 0);
+   fNCalls.assign(nSlots * CacheLineStep<ULong64_t>(), 0ull);
+   fNestedNs = &profiler.fNestedNs;
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Return the exclusive time spent in this node, summed over all slots.
+double RNodeProfile::GetSeconds() const
+{
+   Long64_t ns = 0;
+   for (std::size_t i = 0; i < fNs.size(); i += CacheLineStep<Long64_t>())
+      ns += fNs[i];
+   return ns * 1e-9;
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Return the number of timed calls, summed over all slots.
+ULong64_t RNodeProfile::GetNCalls() const
+{
+   ULong64_t nCalls = 0;
+   for (std::size_t i = 0; i < fNCalls.size(); i += CacheLineStep<ULong64_t>())
+      nCalls += fNCalls[i];
+   return nCalls;
+}
+
+RProfiler::RProfiler(unsigned int nSlots)
+   : fNSlots(nSlots),
+     fNestedNs(nSlots * CacheLineStep<Long64_t>(), 0),
+     fBusyNs(nSlots * CacheLineStep<Long64_t>(), 0)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Prepare for a new event loop that will read the given dataset columns.
+void RProfiler::Reset(const std::vector<std::string> &columns)
+{
+   std::fill(fNestedNs.begin(), fNestedNs.end(), 0);
+   std::fill(fBusyNs.begin(), fBusyNs.end(), 0);
+   // existing entries are kept: column readers wrapped in previous event loops still refer to them
+   for (auto &columnAndProfile : fColumnProfiles)
+      columnAndProfile.second.Enable(*this);
+   for (const auto &column : columns)
+      fColumnProfiles[column].Enable(*this);
+   fLoopSeconds = 0.;
+   fBytesRead = 0;
+}
+
+RNodeProfile *RProfiler::GetColumnProfile(const std::string &column)
+{
+   auto it = fColumnProfiles.find(column);
+   return it == fColumnProfiles.end() ? nullptr : &it->second;
+}
+
+std::string GetProfileLabel(const RNodeProfile &profile)
+{
+   if (!profile.IsEnabled() || profile.GetNCalls() == 0)
+      return "";
+   std::stringstream label;
+   label << "\\n" << std::fixed << std::setprecision(3) << profile.GetSeconds() * 1e3 << " ms";
+   return label.str();
+}
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
@@ -11,7 +11,6 @@
 #include <ROOT/RSqliteDS.hxx>
 #include <ROOT/RRawFile.hxx>
 
-#include "TError.h"
 #include "TRandom.h"
 #include "TSystem.h"
 
@@ -325,21 +324,12 @@ namespace Internal {
 struct RSqliteDSDataSet {
    sqlite3 *fDb = nullptr;
    sqlite3_stmt *fQuery = nullptr;
+   /// Set once the query returned SQLITE_DONE, stepping further would restart the query
+   bool fIsDone = false;
 };
 }
 
-RSqliteDS::Value_t::Value_t(RSqliteDS::ETypes type)
-   : fType(type), fIsActive(false), fInteger(0), fReal(0.0), fText(), fBlob(), fNull(nullptr)
-{
-   switch (type) {
-   case ETypes::kInteger: fPtr = &fInteger; break;
-   case ETypes::kReal: fPtr = &fReal; break;
-   case ETypes::kText: fPtr = &fText; break;
-   case ETypes::kBlob: fPtr = &fBlob; break;
-   case ETypes::kNull: fPtr = &fNull; break;
-   default: throw std::runtime_error("Internal error");
-   }
-}
+RSqliteDS::Value_t::Value_t(RSqliteDS::ETypes type) : fType(type), fIsActive(false), fNull(nullptr) {}
 
 constexpr char const *RSqliteDS::fgTypeNames[];
 
@@ -350,7 +340,8 @@ constexpr char const *RSqliteDS::fgTypeNames[];
 ///
 /// The constructor opens the sqlite file, prepares the query engine and determines the column names and types.
 RSqliteDS::RSqliteDS(const std::string &fileName, const std::string &query)
-   : fDataSet(std::make_unique<Internal::RSqliteDSDataSet>()), fNSlots(0), fNRow(0)
+   : fDataSet(std::make_unique<Internal::RSqliteDSDataSet>()), fNSlots(0), fNRow(0), fNRowsPerBatch(1024),
+     fFirstBatchRow(0)
 {
    static bool hasSqliteVfs = RegisterSqliteVfs();
    if (!hasSqliteVfs)
@@ -471,27 +462,94 @@ RDataSource::Record_t RSqliteDS::GetColumnReadersImpl(std::string_view name, con
       throw std::runtime_error(errmsg);
    }
 
-   fValues[index].fIsActive = true;
-   return std::vector<void *>{fNSlots, &fValues[index].fPtr};
+   auto &value = fValues[index];
+   value.fIsActive = true;
+   // The pointers of null columns never change, the others are set by SetEntry
+   value.fPtrs.resize(fNSlots, (type == ETypes::kNull) ? &value.fNull : nullptr);
+   std::vector<void *> ptrs;
+   ptrs.reserve(fNSlots);
+   for (auto &ptr : value.fPtrs)
+      ptrs.emplace_back(&ptr);
+   return ptrs;
 }
 
 ////////////////////////////////////////////////////////////////////////////
-/// Returns a range of size 1 as long as more rows are available in the SQL result set.
-/// This inherently serialized the RDF independent of the number of slots.
+/// Fetches the next batch of up to fNRowsPerBatch rows of the SQL result set and splits it in one range per slot.
+/// Returns no range once all the rows have been fetched.
 std::vector<std::pair<ULong64_t, ULong64_t>> RSqliteDS::GetEntryRanges()
 {
    std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
-   int retval = sqlite3_step(fDataSet->fQuery);
-   switch (retval) {
-   case SQLITE_DONE: return entryRanges;
-   case SQLITE_ROW:
-      entryRanges.emplace_back(fNRow, fNRow + 1);
+   if (fDataSet->fIsDone)
+      return entryRanges;
+
+   fFirstBatchRow = fNRow;
+   while (fNRow - fFirstBatchRow < fNRowsPerBatch) {
+      int retval = sqlite3_step(fDataSet->fQuery);
+      if (retval == SQLITE_DONE) {
+         fDataSet->fIsDone = true;
+         break;
+      }
+      if (retval != SQLITE_ROW)
+         SqliteError(retval);
+      FetchRow(fNRow - fFirstBatchRow);
       fNRow++;
+   }
+
+   const ULong64_t nRows = fNRow - fFirstBatchRow;
+   if (nRows == 0)
       return entryRanges;
-   default:
-      SqliteError(retval);
-      // Never here
-      abort();
+   const ULong64_t nRanges = std::min<ULong64_t>(std::max(fNSlots, 1U), nRows);
+   entryRanges.reserve(nRanges);
+   for (ULong64_t i = 0; i < nRanges; ++i)
+      entryRanges.emplace_back(fFirstBatchRow + i * nRows / nRanges, fFirstBatchRow + (i + 1) * nRows / nRanges);
+   return entryRanges;
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// Copies the active columns of the current row of the sqlite query to the given row of the batch. The buffers are
+/// overwritten rather than cleared from one batch to the next, so that their memory is reused.
+void RSqliteDS::FetchRow(ULong64_t row)
+{
+   unsigned N = fValues.size();
+   for (unsigned i = 0; i < N; ++i) {
+      auto &value = fValues[i];
+      if (!value.fIsActive)
+         continue;
+
+      int nbytes;
+      switch (value.fType) {
+      case ETypes::kInteger:
+         value.fIntegers.resize(std::max<std::size_t>(value.fIntegers.size(), row + 1));
+         value.fIntegers[row] = sqlite3_column_int64(fDataSet->fQuery, i);
+         break;
+      case ETypes::kReal:
+         value.fReals.resize(std::max<std::size_t>(value.fReals.size(), row + 1));
+         value.fReals[row] = sqlite3_column_double(fDataSet->fQuery, i);
+         break;
+      case ETypes::kText: {
+         value.fTexts.resize(std::max<std::size_t>(value.fTexts.size(), row + 1));
+         // sqlite3_column_bytes() has to be called after sqlite3_column_text() to return the size of the text
+         const auto text = reinterpret_cast<const char *>(sqlite3_column_text(fDataSet->fQuery, i));
+         nbytes = sqlite3_column_bytes(fDataSet->fQuery, i);
+         if (nbytes == 0)
+            value.fTexts[row].clear();
+         else
+            value.fTexts[row].assign(text, nbytes);
+         break;
+      }
+      case ETypes::kBlob: {
+         value.fBlobs.resize(std::max<std::size_t>(value.fBlobs.size(), row + 1));
+         auto &blob = value.fBlobs[row];
+         nbytes = sqlite3_column_bytes(fDataSet->fQuery, i);
+         blob.resize(nbytes);
+         if (nbytes > 0) {
+            std::memcpy(blob.data(), sqlite3_column_blob(fDataSet->fQuery, i), nbytes);
+         }
+         break;
+      }
+      case ETypes::kNull: break;
+      default: throw std::runtime_error("Unhandled column type");
+      }
    }
 }
 
@@ -521,6 +579,8 @@ bool RSqliteDS::HasColumn(std::string_view colName) const
 void RSqliteDS::Initialize()
 {
    fNRow = 0;
+   fFirstBatchRow = 0;
+   fDataSet->fIsDone = false;
    int retval = sqlite3_reset(fDataSet->fQuery);
    if (retval != SQLITE_OK)
       throw std::runtime_error("SQlite error, reset");
@@ -542,35 +602,22 @@ RDataFrame FromSqlite(std::string_view fileName, std::string_view query)
 }
 
 ////////////////////////////////////////////////////////////////////////////
-/// Stores the result of the current active sqlite query row as a C++ value.
-bool RSqliteDS::SetEntry(unsigned int /* slot */, ULong64_t entry)
+/// Points the column readers of the slot to the values of the given row of the current batch.
+bool RSqliteDS::SetEntry(unsigned int slot, ULong64_t entry)
 {
-   assert(entry + 1 == fNRow);
-   (void)entry;
+   assert(entry >= fFirstBatchRow && entry < fNRow);
+   const auto row = entry - fFirstBatchRow;
    unsigned N = fValues.size();
    for (unsigned i = 0; i < N; ++i) {
-      if (!fValues[i].fIsActive)
+      auto &value = fValues[i];
+      if (!value.fIsActive)
          continue;
 
-      int nbytes;
-      switch (fValues[i].fType) {
-      case ETypes::kInteger: fValues[i].fInteger = sqlite3_column_int64(fDataSet->fQuery, i); break;
-      case ETypes::kReal: fValues[i].fReal = sqlite3_column_double(fDataSet->fQuery, i); break;
-      case ETypes::kText:
-         nbytes = sqlite3_column_bytes(fDataSet->fQuery, i);
-         if (nbytes == 0) {
-            fValues[i].fText = "";
-         } else {
-            fValues[i].fText = reinterpret_cast<const char *>(sqlite3_column_text(fDataSet->fQuery, i));
-         }
-         break;
-      case ETypes::kBlob:
-         nbytes = sqlite3_column_bytes(fDataSet->fQuery, i);
-         fValues[i].fBlob.resize(nbytes);
-         if (nbytes > 0) {
-            std::memcpy(fValues[i].fBlob.data(), sqlite3_column_blob(fDataSet->fQuery, i), nbytes);
-         }
-         break;
+      switch (value.fType) {
+      case ETypes::kInteger: value.fPtrs[slot] = &value.fIntegers[row]; break;
+      case ETypes::kReal: value.fPtrs[slot] = &value.fReals[row]; break;
+      case ETypes::kText: value.fPtrs[slot] = &value.fTexts[row]; break;
+      case ETypes::kBlob: value.fPtrs[slot] = &value.fBlobs[row]; break;
       case ETypes::kNull: break;
       default: throw std::runtime_error("Unhandled column type");
       }
@@ -579,13 +626,9 @@ bool RSqliteDS::SetEntry(unsigned int /* slot */, ULong64_t entry)
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////
-/// Almost a no-op, many slots can in fact reduce the performance due to thread synchronization.
+/// Sets the number of slots, i.e. the number of ranges in which each batch of rows is split.
 void RSqliteDS::SetNSlots(unsigned int nSlots)
 {
-   if (nSlots > 1) {
-      ::Warning("SetNSlots", "Currently the SQlite data source faces performance degradation in multi-threaded mode. "
-                             "Consider turning off IMT.");
-   }
    fNSlots = nSlots;
 }
 
@@ -6,6 +6,7 @@
 #include <Rtypes.h>
 
 #include <cstddef>
+#include <map>
 #include <memory>
 #include <type_traits>
 #include <vector>
@@ -36,6 +37,7 @@ class RArraysDS : public ROOT::RDF::RDataSource {
    std::vector<int> fVar = {42};
    std::vector<std::string> fColumnNames = {"R_rdf_sizeof_var", "var"};
    std::vector<std::pair<ULong64_t, ULong64_t>> fRanges = {{0ull, 1ull}};
+   std::map<std::string, unsigned int> fColumnReadHints;
 
    bool IsSizeColumn(std::string_view colName) const { return colName.substr(0, 13) == "R_rdf_sizeof_"; }
 
@@ -65,6 +67,13 @@ public:
 
    std::string GetLabel() final { return "ArraysDS"; }
 
+   void SetColumnReadHints(const std::map<std::string, unsigned int> &readCounts) final
+   {
+      fColumnReadHints = readCounts;
+   }
+
+   const std::map<std::string, unsigned int> &GetColumnReadHints() const { return fColumnReadHints; }
+
 protected:
    std::vector<void *> GetColumnReadersImpl(std::string_view, const std::type_info &) final
    {
@@ -338,3 +338,52 @@ TEST(Cache, Alias)
    auto df4 = df3.Cache({"y"});
    EXPECT_EQ(df4.Sum("y").GetValue(), 3u);
 }
+
+TEST(Cache, MemoryBudget)
+{
+   ROOT::RDataFrame df(100);
+   auto d = df.Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+               .Define("v", [](ULong64_t e) { return RVec<float>(e % 5, 1.f); }, {"rdfentry_"});
+
+   auto checkCached = [](RNode cached) {
+      auto xs = cached.Take<int>("x");
+      auto vSum = cached.Define("s", [](const RVec<float> &v) { return Sum(v); }, {"v"}).Sum<float>("s");
+      ASSERT_EQ(xs->size(), 100u);
+      for (int i = 0; i < 100; ++i)
+         EXPECT_EQ((*xs)[i], i);
+      EXPECT_FLOAT_EQ(*vSum, 200.f);
+   };
+
+   // fits in the budget: cached in memory
+   RCacheOptions inMemory;
+   inMemory.fMemoryBudget = 1024ull * 1024ull;
+   auto cachedInMemory = d.Cache<int, RVec<float>>({"x", "v"}, inMemory);
+   EXPECT_EQ(cachedInMemory.GetNFiles(), 0u);
+   checkCached(cachedInMemory);
+
+   // does not fit in the budget: spilled to disk
+   const std::string spillDir = "cache_memorybudget_spill";
+   gSystem->mkdir(spillDir.c_str());
+   auto countSpillFiles = [&spillDir]() {
+      unsigned int n = 0;
+      void *dir = gSystem->OpenDirectory(spillDir.c_str());
+      while (const char *entry = gSystem->GetDirEntry(dir)) {
+         if (std::string(entry).find("rdfcache_") == 0)
+            ++n;
+      }
+      gSystem->FreeDirectory(dir);
+      return n;
+   };
+   {
+      RCacheOptions spilled;
+      spilled.fMemoryBudget = 100;
+      spilled.fSpillDirectory = spillDir;
+      auto cachedOnDisk = d.Cache({"x", "v"}, spilled); // jitted
+      EXPECT_EQ(cachedOnDisk.GetNFiles(), 1u);
+      EXPECT_EQ(countSpillFiles(), 1u);
+      checkCached(cachedOnDisk);
+   }
+   // the temporary files are removed together with the cached dataframe
+   EXPECT_EQ(countSpillFiles(), 0u);
+   gSystem->Unlink(spillDir.c_str());
+}
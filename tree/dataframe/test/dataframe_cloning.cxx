@@ -432,6 +432,48 @@ TEST(RDataFrameCloning, ChangeSpec)
    }
 }
 
+TEST(RDataFrameCloning, ChangeDataset)
+{
+   std::string treeName{"events"};
+   std::vector<std::string> fileNames{"dataframe_cloning_changedataset_0.root",
+                                      "dataframe_cloning_changedataset_1.root"};
+   InputFilesRAII files{treeName, fileNames, 20, {0, 100}};
+
+   std::vector<ROOT::RDF::Experimental::RDatasetSpec> specs(2);
+   specs[0].AddSample({"", treeName, fileNames[0]});
+   specs[1].AddSample({"", treeName, fileNames[1]});
+
+   // The jitted Filter and Define are reused by the results cloned for the second dataset
+   ROOT::RDataFrame df(std::move(specs[0]));
+   auto filtered = df.Filter("x % 2 == 0").Define("y", "double(x) + 0.5");
+   auto count = filtered.Count();
+   auto sum = filtered.Sum<double>("y");
+   auto hist = filtered.Histo1D<double>({"h", "h", 200, 0, 200}, "y");
+   EXPECT_EQ(*count, 10ull);
+   EXPECT_DOUBLE_EQ(*sum, 95.);
+   EXPECT_EQ(hist->GetEntries(), 10.);
+
+   ROOT::RDF::Experimental::ChangeDataset(df, std::move(specs[1]));
+   auto count2 = ROOT::RDF::Experimental::CloneResult(count);
+   auto sum2 = ROOT::RDF::Experimental::CloneResult(sum);
+   auto hist2 = ROOT::RDF::Experimental::CloneResult(hist);
+   EXPECT_EQ(*count2, 10ull);
+   EXPECT_DOUBLE_EQ(*sum2, 1095.);
+   EXPECT_EQ(hist2->GetEntries(), 10.);
+   EXPECT_EQ(hist2->GetXaxis()->GetXmax(), 200.);
+   // the original results are untouched
+   EXPECT_EQ(*count, 10ull);
+   EXPECT_DOUBLE_EQ(*sum, 95.);
+   EXPECT_EQ(hist->GetEntries(), 10.);
+   EXPECT_EQ(df.GetNRuns(), 2u);
+}
+
+TEST(RDataFrameCloning, ChangeDatasetEmptySource)
+{
+   ROOT::RDataFrame df{10};
+   EXPECT_THROW(ROOT::RDF::Experimental::ChangeDataset(df, ROOT::RDF::Experimental::RDatasetSpec()), std::logic_error);
+}
+
 ROOT::RDF::Experimental::RResultMap<TH1D> dataframe_cloning_vary_with_filters_analysis(ROOT::RDF::RNode df)
 {
    auto df1 = df.Define("jet_pt", []() { return ROOT::RVecF{30, 30, 30, 10, 10, 10, 10}; });
@@ -2,6 +2,7 @@
 #include <ROOT/RDataFrame.hxx>
 #include <ROOT/RDF/RInterface.hxx>
 #include <ROOT/TThreadExecutor.hxx>
+#include <algorithm>
 #include <atomic>
 #include <thread>
 #include <vector>
@@ -235,4 +236,41 @@ TEST(RDFConcurrency, ParallelRDFCachesEnableImplicitMT)
    ROOT::DisableImplicitMT();
 }
 
+void ParallelJittedRDFs()
+{
+   // Book jitted nodes in all threads before any of them runs its event loop, so that the first event loop to start
+   // jits the nodes of the other computation graphs too
+   const auto nThreads = std::max(NUM_THREADS, 4u);
+   std::atomic<unsigned int> nBooked{0};
+   auto func = [&nBooked, nThreads](unsigned int i) {
+      ROOT::RDataFrame df(100);
+      auto sum = df.Define("x", "rdfentry_ * " + std::to_string(i)).Filter("x % 2 == 0").Sum<ULong64_t>("x");
+      ++nBooked;
+      while (nBooked < nThreads)
+         std::this_thread::yield();
+      return *sum;
+   };
+
+   std::vector<std::thread> threads;
+   std::vector<ULong64_t> res(nThreads);
+   for (auto i = 0u; i < nThreads; ++i)
+      threads.emplace_back([&res, &func, i] { res[i] = func(i); });
+   for (auto &t : threads)
+      t.join();
+
+   for (auto i = 0u; i < nThreads; ++i) {
+      ULong64_t expected = 0;
+      for (ULong64_t entry = 0; entry < 100; ++entry)
+         if ((entry * i) % 2 == 0)
+            expected += entry * i;
+      EXPECT_EQ(res[i], expected);
+   }
+}
+
+TEST(RDFConcurrency, ParallelJittedRDFsEnableThreadSafety)
+{
+   ROOT::EnableThreadSafety();
+   ParallelJittedRDFs();
+}
+
 #endif
@@ -639,6 +639,38 @@ TEST(RunGraphs, RunGraphsWithJitting)
    EXPECT_EQ(r4.GetValue(), 3u);
 }
 
+TEST(RunGraphs, RunGraphsWithTrees)
+{
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT();
+#endif // R__USE_IMT
+
+   // The input files of all graphs are prepared while the code of all graphs is jitted
+   const std::vector<std::string> fileNames{"dataframe_helpers_rungraphs_0.root", "dataframe_helpers_rungraphs_1.root",
+                                            "dataframe_helpers_rungraphs_2.root"};
+   for (std::size_t i = 0; i < fileNames.size(); ++i)
+      ROOT::RDataFrame(10 * (i + 1)).Define("x", "int(rdfentry_)").Snapshot<int>("t", fileNames[i], {"x"});
+
+   std::vector<ROOT::RDataFrame> dfs;
+   std::vector<RResultPtr<int>> sums;
+   std::vector<RResultHandle> handles;
+   for (std::size_t i = 0; i < fileNames.size(); ++i) {
+      dfs.emplace_back("t", fileNames[i]);
+      sums.emplace_back(dfs.back().Filter("x % 2 == 0").Sum<int>("x"));
+      handles.emplace_back(sums.back());
+   }
+   ROOT::RDF::RunGraphs(handles);
+
+   for (auto &df : dfs)
+      EXPECT_EQ(df.GetNRuns(), 1u);
+   EXPECT_EQ(sums[0].GetValue(), 20);  // 0 + 2 + ... + 8
+   EXPECT_EQ(sums[1].GetValue(), 90);  // 0 + 2 + ... + 18
+   EXPECT_EQ(sums[2].GetValue(), 210); // 0 + 2 + ... + 28
+
+   for (const auto &fileName : fileNames)
+      gSystem->Unlink(fileName.c_str());
+}
+
 TEST(RunGraphs, RunGraphsWithDisabledIMT)
 {
 #ifdef R__USE_IMT
@@ -346,3 +346,50 @@ TEST(RDataFrameHisto, FillVecBool)
     EXPECT_EQ(h->GetBinContent(2), n);
     EXPECT_EQ(h->GetBinContent(3), 0u);
 }
+
+TEST(RDataFrameHisto, Histo1DBank)
+{
+   ROOT::RDataFrame df(100);
+   auto d = df.Define("x", [](ULong64_t e) { return e * 0.13 - 1.; }, {"rdfentry_"})
+               .Define("xs", [](double x) { return ROOT::RVecD{x, 2. * x, -x}; }, {"x"})
+               .Define("ws", [](double x) { return ROOT::RVecD{1., x * x, 0.5}; }, {"x"})
+               .Define("x0", [](const ROOT::RVecD &xs) { return xs[0]; }, {"xs"})
+               .Define("x1", [](const ROOT::RVecD &xs) { return xs[1]; }, {"xs"})
+               .Define("x2", [](const ROOT::RVecD &xs) { return xs[2]; }, {"xs"})
+               .Define("w1", [](const ROOT::RVecD &ws) { return ws[1]; }, {"ws"})
+               .Define("w2", [](const ROOT::RVecD &ws) { return ws[2]; }, {"ws"});
+
+   std::vector<double> edges{-10., -1., 0., 0.5, 3., 10.};
+   std::vector<TH1DModel> models{
+      {"h0", "h0", 10, 0., 10.}, {"h1", "h1", 7, -3., 4.}, {"h2", "h2", (int)edges.size() - 1, edges.data()}};
+   auto bank = d.Histo1DBank<ROOT::RVecD>(models, "xs");
+   auto bankw = d.Histo1DBank(models, "xs", "ws"); // jitted
+   std::vector<RResultPtr<::TH1D>> refs{d.Histo1D(models[0], "x0"), d.Histo1D(models[1], "x1"),
+                                        d.Histo1D(models[2], "x2")};
+   std::vector<RResultPtr<::TH1D>> refsw{d.Histo1D(models[0], "x0"), d.Histo1D(models[1], "x1", "w1"),
+                                         d.Histo1D(models[2], "x2", "w2")};
+
+   auto checkSame = [](const ::TH1D &h, const ::TH1D &ref) {
+      EXPECT_STREQ(h.GetName(), ref.GetName());
+      ASSERT_EQ(h.GetNcells(), ref.GetNcells());
+      for (int bin = 0; bin < h.GetNcells(); ++bin) {
+         EXPECT_DOUBLE_EQ(h.GetBinContent(bin), ref.GetBinContent(bin)) << h.GetName() << " bin " << bin;
+         EXPECT_DOUBLE_EQ(h.GetBinError(bin), ref.GetBinError(bin)) << h.GetName() << " bin " << bin;
+      }
+      EXPECT_DOUBLE_EQ(h.GetEntries(), ref.GetEntries());
+      EXPECT_DOUBLE_EQ(h.GetMean(), ref.GetMean());
+      EXPECT_DOUBLE_EQ(h.GetStdDev(), ref.GetStdDev());
+   };
+   ASSERT_EQ(bank->size(), 3u);
+   ASSERT_EQ(bankw->size(), 3u);
+   for (std::size_t i = 0; i < 3u; ++i) {
+      checkSame((*bank)[i], *refs[i]);
+      checkSame((*bankw)[i], *refsw[i]);
+   }
+   EXPECT_EQ(df.GetNRuns(), 1u);
+
+   // a bank needs as many values per entry as histograms, and fixed axes
+   auto wrongSize = d.Histo1DBank<ROOT::RVecD>({models[0], models[1]}, "xs");
+   EXPECT_THROW(wrongSize.GetValue(), std::runtime_error);
+   EXPECT_THROW(d.Histo1DBank({{"h", "h", 10, 0., 0.}}, "xs"), std::runtime_error);
+}
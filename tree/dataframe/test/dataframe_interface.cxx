@@ -3,6 +3,7 @@
 
 #include "ROOT/RCsvDS.hxx"
 #include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDFHelpers.hxx"
 #include <string_view>
 #include "ROOT/RTrivialDS.hxx"
 #include "ROOT/TestSupport.hxx"
@@ -977,3 +978,81 @@ TEST(RDataFrameInterface, GetNFilesFromMoreFiles)
    ROOT::RDataFrame df{"t", filenames};
    EXPECT_EQ(df.GetNFiles(), 3);
 }
+
+TEST(RDataFrameInterface, JitCache)
+{
+   const std::string cacheDir = "RDataFrameInterface_JitCache";
+   gSystem->Setenv("ROOT_RDF_JIT_CACHE_DIR", cacheDir.c_str());
+
+   // the first event loop fills the cache, the second one has the same graph and is served by it
+   std::vector<double> sums;
+   for (int i = 0; i < 2; ++i) {
+      auto df = ROOT::RDataFrame(10).Define("x", "rdfentry_ * 2.").Filter("x > 4");
+      sums.emplace_back(*df.Sum<double>("x"));
+   }
+   gSystem->Unsetenv("ROOT_RDF_JIT_CACHE_DIR");
+
+   EXPECT_DOUBLE_EQ(sums[0], 84.);
+   EXPECT_DOUBLE_EQ(sums[1], 84.);
+
+   void *dir = gSystem->OpenDirectory(cacheDir.c_str());
+   ASSERT_NE(dir, nullptr);
+   int nLibs = 0;
+   while (const char *entry = gSystem->GetDirEntry(dir)) {
+      if (TString(entry).EndsWith(TString(".") + gSystem->GetSoExt()))
+         ++nLibs;
+   }
+   gSystem->FreeDirectory(dir);
+   EXPECT_GE(nLibs, 1);
+
+   gSystem->Exec(("rm -rf " + cacheDir).c_str());
+}
+
+TEST(RDataFrameInterface, SharedJittedNodes)
+{
+   gInterpreter->Declare("ULong64_t RDataFrameInterface_SharedJittedNodes_count = 0;"
+                         "ULong64_t RDataFrameInterface_SharedJittedNodes_f(ULong64_t e) {"
+                         "   ++RDataFrameInterface_SharedJittedNodes_count; return e; }");
+
+   ROOT::RDataFrame df(10);
+   auto branch1 = df.Filter("rdfentry_ % 2 == 0").Define("x", "RDataFrameInterface_SharedJittedNodes_f(rdfentry_)");
+   auto branch2 = df.Filter("rdfentry_ % 2 == 0").Define("x", "RDataFrameInterface_SharedJittedNodes_f(rdfentry_)");
+   // a named filter is never shared, but the Define downstream of it has the same inputs so it still is
+   auto branch3 = df.Filter("rdfentry_ % 2 == 0", "named").Define("x", "RDataFrameInterface_SharedJittedNodes_f(rdfentry_)");
+   auto s1 = branch1.Sum<ULong64_t>("x");
+   auto s2 = branch2.Sum<ULong64_t>("x");
+   auto s3 = branch3.Sum<ULong64_t>("x");
+
+   EXPECT_EQ(*s1, 20ull);
+   EXPECT_EQ(*s2, 20ull);
+   EXPECT_EQ(*s3, 20ull);
+   // the Define is evaluated once per selected entry, not once per branch
+   EXPECT_EQ(gInterpreter->Calc("RDataFrameInterface_SharedJittedNodes_count"), 5);
+}
+
+TEST(RDataFrameInterface, Profiling)
+{
+   TTree t("t", "t");
+   int x = 0;
+   t.Branch("x", &x);
+   for (x = 0; x < 10; ++x)
+      t.Fill();
+
+   ROOT::RDataFrame df(t);
+   ROOT::Internal::RDF::EnableProfiling(ROOT::RDF::AsRNode(df));
+   auto sum = df.Define("y", [](int x_) { return x_ * 2; }, {"x"})
+                 .Filter([](int y) { return y > 4; }, {"y"}, "ypos")
+                 .Sum<int>("y");
+   EXPECT_EQ(*sum, 84);
+
+   const auto report = ROOT::Internal::RDF::GetProfileReport(ROOT::RDF::AsRNode(df));
+   EXPECT_NE(report.find("\"eventLoop\""), std::string::npos) << report;
+   EXPECT_NE(report.find("{\"type\": \"Define\", \"name\": \"y\""), std::string::npos) << report;
+   EXPECT_NE(report.find("{\"type\": \"Filter\", \"name\": \"ypos\""), std::string::npos) << report;
+   EXPECT_NE(report.find("{\"type\": \"Action\", \"name\": \"Sum\""), std::string::npos) << report;
+   // the action only runs for the entries that pass the filter
+   EXPECT_NE(report.find("\"calls\": 7}"), std::string::npos) << report;
+   EXPECT_NE(report.find("{\"name\": \"x\""), std::string::npos) << report;
+   // the graph representation shows the time spent in each node
+   EXPECT_NE(ROOT::RDF::SaveGraph(sum).find(" ms"), std::string::npos);
+}
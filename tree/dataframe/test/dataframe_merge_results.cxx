@@ -348,6 +348,29 @@ TEST(RDataFrameMergeResults, Merge5Hists)
    EXPECT_DOUBLE_EQ(mh.GetMean(), 49.5);
 }
 
+TEST(RDataFrameMergeResults, MergeVectorOfHists)
+{
+   ROOT::RDataFrame df{100};
+   auto col1 = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"});
+
+   std::vector<ROOT::RDF::RResultPtr<TH1D>> hists;
+   for (int i = 0; i < 7; ++i)
+      hists.emplace_back(col1.Histo1D<double>("x"));
+
+   std::vector<std::unique_ptr<ROOT::Detail::RDF::RMergeableValue<TH1D>>> mergeables;
+   for (auto &h : hists)
+      mergeables.emplace_back(GetMergeableValue(h));
+
+   auto mergedptr = MergeValues(std::move(mergeables));
+   ASSERT_TRUE(!!mergedptr);
+   const auto &mh = mergedptr->GetValue();
+   EXPECT_EQ(mh.GetEntries(), 700);
+   EXPECT_DOUBLE_EQ(mh.GetMean(), 49.5);
+
+   EXPECT_THROW(MergeValues(std::vector<std::unique_ptr<ROOT::Detail::RDF::RMergeableValue<TH1D>>>{}),
+                std::invalid_argument);
+}
+
 TEST(RDataFrameMergeResults, WrongMergeMinMax)
 {
    // Tricky case: two results of the same type with the same RMergeableValue subclass, different action helper.
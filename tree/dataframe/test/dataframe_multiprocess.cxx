@@ -0,0 +1,82 @@
+#include <ROOT/RDataFrame.hxx>
+#include <ROOT/RDFMultiProcess.hxx>
+#include <TFile.h>
+#include <TH1D.h>
+#include <TSystem.h>
+#include <TTree.h>
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <string>
+#include <vector>
+
+using ROOT::RDF::Experimental::RunMultiProcess;
+
+class RDFMultiProcess : public ::testing::Test {
+protected:
+   const std::vector<std::string> fFileNames{"dataframe_multiprocess_0.root", "dataframe_multiprocess_1.root"};
+   static constexpr int fNEntriesPerFile = 1000;
+
+   void SetUp() override
+   {
+      int x = 0;
+      for (const auto &fileName : fFileNames) {
+         TFile f(fileName.c_str(), "recreate");
+         TTree t("t", "t");
+         t.SetAutoFlush(100); // 10 clusters per file
+         t.Branch("x", &x);
+         for (int i = 0; i < fNEntriesPerFile; ++i, ++x)
+            t.Fill();
+         t.Write();
+      }
+   }
+
+   void TearDown() override
+   {
+      for (const auto &fileName : fFileNames)
+         gSystem->Unlink(fileName.c_str());
+   }
+};
+
+TEST_F(RDFMultiProcess, Ranges)
+{
+   const auto ranges = ROOT::Internal::RDF::GetMultiProcessRanges("t", fFileNames, 3);
+   ASSERT_EQ(ranges.size(), 3u);
+   EXPECT_EQ(ranges.front().first, 0);
+   EXPECT_EQ(ranges.back().second, 2 * fNEntriesPerFile);
+   for (std::size_t i = 0u; i < ranges.size(); ++i) {
+      EXPECT_EQ(ranges[i].first % 100, 0);
+      if (i > 0u)
+         EXPECT_EQ(ranges[i].first, ranges[i - 1].second);
+   }
+}
+
+TEST_F(RDFMultiProcess, Sum)
+{
+   const auto sums = RunMultiProcess("t", fFileNames, [](ROOT::RDF::RNode df) { return df.Sum<int>("x"); }, 4);
+   ASSERT_EQ(sums.size(), 4u);
+   const int n = 2 * fNEntriesPerFile;
+   EXPECT_EQ(std::accumulate(sums.begin(), sums.end(), 0.), n * (n - 1) / 2.);
+   // trivially copyable results are returned in entry order
+   for (std::size_t i = 1u; i < sums.size(); ++i)
+      EXPECT_LT(sums[i - 1], sums[i]);
+}
+
+TEST_F(RDFMultiProcess, Histo)
+{
+   const auto histos = RunMultiProcess(
+      "t", fFileNames, [](ROOT::RDF::RNode df) { return df.Histo1D<int>({"h", "h", 20, 0, 2000}, "x"); }, 2);
+   ASSERT_EQ(histos.size(), 2u);
+   TH1D total(histos[0]);
+   total.Add(&histos[1]);
+   EXPECT_EQ(total.GetEntries(), 2 * fNEntriesPerFile);
+   for (int bin = 1; bin <= 20; ++bin)
+      EXPECT_EQ(total.GetBinContent(bin), 100.);
+}
+
+TEST_F(RDFMultiProcess, Empty)
+{
+   const auto counts = RunMultiProcess("t", {}, [](ROOT::RDF::RNode df) { return df.Count(); }, 2);
+   EXPECT_TRUE(counts.empty());
+}
@@ -9,8 +9,11 @@
 
 #include "gtest/gtest.h"
 
-#if defined(R__USE_IMT) && !defined(NDEBUG)
+#ifdef R__USE_IMT
 #include <ROOT/RSlotStack.hxx>
+#endif
+
+#if defined(R__USE_IMT) && !defined(NDEBUG)
 
 TEST(RDataFrameNodes, RSlotStackGetOneTooMuch)
 {
@@ -43,6 +46,21 @@ TEST(RDataFrameNodes, RSlotStackPutBackTooMany)
 
 #endif
 
+#ifdef R__USE_IMT
+TEST(RDataFrameNodes, RSlotStackReuseSlot)
+{
+   ROOT::Internal::RSlotStack s(4);
+   const auto slot = s.GetSlot();
+   const auto other = s.GetSlot();
+   EXPECT_NE(slot, other);
+   s.ReturnSlot(other);
+   s.ReturnSlot(slot);
+   // a thread gets back the slot it returned last
+   EXPECT_EQ(s.GetSlot(), slot);
+   s.ReturnSlot(slot);
+}
+#endif
+
 TEST(RDataFrameNodes, RLoopManagerGetLoopManagerUnchecked)
 {
    ROOT::Detail::RDF::RLoopManager lm(nullptr, {});
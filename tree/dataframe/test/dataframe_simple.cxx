@@ -3,10 +3,13 @@
 
 #include <ROOT/TestSupport.hxx>
 #include <ROOT/RDataFrame.hxx>
+#include <ROOT/RDFHelpers.hxx>
 #include <ROOT/TSeq.hxx>
 #include <TChain.h>
 #include <TFile.h>
 #include <TGraph.h>
+#include <TH2D.h>
+#include <TH3D.h>
 #include <TInterpreter.h>
 #include <Math/Vector4D.h>
 #include <TRandom.h>
@@ -16,6 +19,7 @@
 
 #include <algorithm> // std::sort
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <thread>
 #include <set>
@@ -1082,6 +1086,75 @@ TEST_P(RDFSimpleTests, ReadStdArray)
    }
 }
 
+TEST_P(RDFSimpleTests, BulkEventLoop)
+{
+   auto runGraph = [](std::size_t bulkSize) {
+      ROOT::RDataFrame df(1000);
+      ROOT::Internal::RDF::SetBulkSize(ROOT::RDF::AsRNode(df), bulkSize);
+      auto nEvals = std::make_shared<std::atomic<int>>(0);
+      auto d = df.Define("x",
+                         [nEvals](ULong64_t e) {
+                            ++*nEvals;
+                            return double(e);
+                         },
+                         {"rdfentry_"})
+                  .Filter([](double x) { return int(x) % 3 != 0; }, {"x"}, "notMultipleOf3");
+      auto j = d.Filter("x > 100");
+      auto sum = d.Sum<double>("x");
+      auto count = j.Count();
+      auto h = j.Histo1D<double>({"h", "h", 10, 0, 1000}, "x");
+      auto report = df.Report();
+      return std::make_tuple(*sum, *count, h->GetMean(), (*report)["notMultipleOf3"].GetPass(), nEvals->load());
+   };
+
+   const auto expected = runGraph(1);
+   for (std::size_t bulkSize : {2u, 7u, 256u, 5000u}) {
+      const auto res = runGraph(bulkSize);
+      EXPECT_DOUBLE_EQ(std::get<0>(res), std::get<0>(expected)) << bulkSize;
+      EXPECT_EQ(std::get<1>(res), std::get<1>(expected)) << bulkSize;
+      EXPECT_DOUBLE_EQ(std::get<2>(res), std::get<2>(expected)) << bulkSize;
+      EXPECT_EQ(std::get<3>(res), std::get<3>(expected)) << bulkSize;
+      // every action sees the same values: the Define is evaluated once per entry in bulk mode too
+      EXPECT_EQ(std::get<4>(res), 1000) << bulkSize;
+   }
+}
+
+// The helper used for large Histo2D and Histo3D with IMT fills one histogram from all slots
+TEST(RDFSimpleTests, ConcurrentFillHelper)
+{
+   const unsigned int nSlots = 4;
+   auto h2 = std::make_shared<TH2D>("h2", "h2", 10, 0., 10., 5, -5., 5.);
+   auto h3 = std::make_shared<TH3D>("h3", "h3", 4, 0., 4., 4, 0., 4., 4, 0., 4.);
+   ROOT::Internal::RDF::ConcurrentFillHelper<TH2D> helper2(h2, nSlots, /*isWeighted=*/true);
+   ROOT::Internal::RDF::ConcurrentFillHelper<TH3D> helper3(h3, nSlots, /*isWeighted=*/false);
+   TH2D expected2("e2", "e2", 10, 0., 10., 5, -5., 5.);
+   TH3D expected3("e3", "e3", 4, 0., 4., 4, 0., 4., 4, 0., 4.);
+
+   TRandom r(1);
+   for (int i = 0; i < 1000; ++i) {
+      const double x = r.Uniform(-1., 11.), y = r.Gaus(0., 3.), z = r.Uniform(0., 4.), w = r.Uniform(0., 2.);
+      helper2.Exec(i % nSlots, x, y, w);
+      helper3.Exec(i % nSlots, x / 3., z, int(z));
+      expected2.Fill(x, y, w);
+      expected3.Fill(x / 3., z, int(z));
+   }
+   helper2.Finalize();
+   helper3.Finalize();
+
+   EXPECT_EQ(h2->GetEntries(), expected2.GetEntries());
+   EXPECT_EQ(h3->GetEntries(), expected3.GetEntries());
+   for (int bin = 0; bin < expected2.GetNcells(); ++bin) {
+      EXPECT_NEAR(h2->GetBinContent(bin), expected2.GetBinContent(bin), 1e-10);
+      EXPECT_NEAR(h2->GetBinError(bin), expected2.GetBinError(bin), 1e-10);
+   }
+   for (int bin = 0; bin < expected3.GetNcells(); ++bin)
+      EXPECT_DOUBLE_EQ(h3->GetBinContent(bin), expected3.GetBinContent(bin));
+   EXPECT_NEAR(h2->GetMean(1), expected2.GetMean(1), 1e-10);
+   EXPECT_NEAR(h2->GetCorrelationFactor(), expected2.GetCorrelationFactor(), 1e-10);
+   EXPECT_NEAR(h3->GetMean(3), expected3.GetMean(3), 1e-10);
+   EXPECT_NEAR(h3->GetCovariance(1, 3), expected3.GetCovariance(1, 3), 1e-10);
+}
+
 // run single-thread tests
 INSTANTIATE_TEST_SUITE_P(Seq, RDFSimpleTests, ::testing::Values(false));
 
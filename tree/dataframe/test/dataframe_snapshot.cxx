@@ -1362,4 +1362,30 @@ TEST(RDFSnapshotMore, ZeroOutputEntriesMT)
    gSystem->Unlink(fname);
 }
 
+TEST(RDFSnapshotMore, OutputPerSlotMT)
+{
+   const auto nSlots = 4u;
+   ROOT::EnableImplicitMT(nSlots);
+
+   RSnapshotOptions opts;
+   opts.fOutputPerSlot = true;
+   auto out = ROOT::RDataFrame(1000).Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+                 .Snapshot<int>("t", "snapshot_outputperslot.root", {"x"}, opts);
+
+   // one file per slot, also for slots that processed no entries
+   for (auto slot = 0u; slot < nSlots; ++slot) {
+      const auto fname = "snapshot_outputperslot_" + std::to_string(slot) + ".root";
+      EXPECT_EQ(gSystem->AccessPathName(fname.c_str()), 0) << fname; // This returns 0 if the file IS there
+   }
+   EXPECT_NE(gSystem->AccessPathName("snapshot_outputperslot.root"), 0);
+
+   // the returned dataset reads all the files
+   EXPECT_EQ(*out->Count(), 1000ull);
+   EXPECT_EQ(*out->Sum<int>("x"), 499500);
+
+   for (auto slot = 0u; slot < nSlots; ++slot)
+      gSystem->Unlink(("snapshot_outputperslot_" + std::to_string(slot) + ".root").c_str());
+   ROOT::DisableImplicitMT();
+}
+
 #endif // R__USE_IMT
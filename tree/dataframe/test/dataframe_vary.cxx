@@ -799,6 +799,26 @@ TEST_P(RDFVary, FilterChainDependingOnVariations)
    EXPECT_EQ(sums["y:1"], 30);
 }
 
+// most variations share the nominal filter, a few have their own
+TEST_P(RDFVary, FilterSharedByManyVariations)
+{
+   auto sum = ROOT::RDataFrame(10)
+                 .Define("x", [] { return 1; })
+                 .Vary("x", SimpleVariation, {}, 2)
+                 .Define("y", [] { return 1; })
+                 .Vary("y", [] { return ROOT::RVecI{0, 1, 2, 3, 4, 5, 6, 7}; }, {}, 8)
+                 .Filter([](int x) { return x > 0; }, {"x"})
+                 .Define("z", [](int x, int y) { return x + y; }, {"x", "y"})
+                 .Sum<int>("z");
+   auto sums = VariationsFor(sum);
+
+   EXPECT_EQ(sums["nominal"], 20);
+   EXPECT_EQ(sums["x:0"], 0);
+   EXPECT_EQ(sums["x:1"], 30);
+   for (int i = 0; i < 8; ++i)
+      EXPECT_EQ(sums["y:" + std::to_string(i)], 10 * (1 + i));
+}
+
 TEST_P(RDFVary, JittedAction)
 {
    auto df = ROOT::RDataFrame(10).Define("x", [] { return 1; });
@@ -263,6 +263,25 @@ TEST(RArrowDS, FromARDFWithJitting)
    EXPECT_EQ(40, *min);
 }
 
+TEST(RArrowDS, FromRecordBatchReader)
+{
+   auto table = createTestTable();
+   auto reader = std::make_shared<arrow::TableBatchReader>(*table);
+   reader->set_chunksize(4); // two batches, the last one shorter
+   auto rdf = FromArrow(reader, {"Age", "Height"});
+   auto max = rdf.Max<double>("Height");
+   auto sumAge = rdf.Sum<Long64_t>("Age");
+   auto c = rdf.Count();
+
+   EXPECT_EQ(6U, *c);
+   EXPECT_DOUBLE_EQ(200.5, *max);
+   EXPECT_EQ(186, *sumAge);
+
+   // the stream has been consumed
+   auto c2 = rdf.Count();
+   EXPECT_THROW(c2.GetValue(), std::runtime_error);
+}
+
 // NOW MT!-------------
 #ifdef R__USE_IMT
 
@@ -298,6 +317,21 @@ TEST(RArrowDS, FromARDFMT)
    EXPECT_DOUBLE_EQ(.8, *min);
 }
 
+TEST(RArrowDS, FromRecordBatchReaderMT)
+{
+   auto table = createTestTable();
+   auto reader = std::make_shared<arrow::TableBatchReader>(*table);
+   reader->set_chunksize(1); // more batches than slots
+   auto rdf = FromArrow(reader, {});
+   auto max = rdf.Max<double>("Height");
+   auto sumAge = rdf.Sum<Long64_t>("Age");
+   auto c = rdf.Count();
+
+   EXPECT_EQ(6U, *c);
+   EXPECT_DOUBLE_EQ(200.5, *max);
+   EXPECT_EQ(186, *sumAge);
+}
+
 TEST(RArrowDS, FromARDFWithJittingMT)
 {
    std::unique_ptr<RDataSource> tds(new RArrowDS(createTestTable(), {}));
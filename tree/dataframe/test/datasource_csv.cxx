@@ -6,6 +6,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdio>
+#include <fstream>
+
 using namespace ROOT::RDF;
 
 auto fileName0 = "RCsvDS_test_headers.csv";
@@ -255,6 +258,25 @@ TEST(RCsvDS, WindowsLinebreaks)
    EXPECT_EQ(6U, *tdf.Count());
 }
 
+TEST(RCsvDS, ValueConversions)
+{
+   const auto fileName = "RCsvDS_test_conversions.csv";
+   {
+      std::ofstream f(fileName);
+      f << "i,x,b\n+5,1.5,true\n-7,2e3,false\n 9,.25,true\n";
+   }
+
+   auto df = ROOT::RDF::FromCSV(fileName);
+   EXPECT_EQ(std::vector<Long64_t>({5, -7, 9}), *df.Take<Long64_t>("i"));
+   EXPECT_EQ(std::vector<double>({1.5, 2000., 0.25}), *df.Take<double>("x"));
+   EXPECT_EQ(2ull, *df.Filter([](bool b) { return b; }, {"b"}).Count());
+
+   auto wrong = ROOT::RDF::FromCSV(fileName, true, ',', -1LL, {{"b", 'L'}});
+   EXPECT_THROW(wrong.Sum<Long64_t>("b").GetValue(), std::runtime_error);
+
+   std::remove(fileName);
+}
+
 TEST(RCsvDS, Remote)
 {
 #ifdef R__HAS_DAVIX
@@ -49,6 +49,21 @@ TEST(RArraysDS, ShortSyntaxForCollectionSizes)
    EXPECT_EQ(df.Take<std::vector<int>>("var").GetValue(), std::vector<std::vector<int>>{{42}});
 }
 
+TEST(RArraysDS, ColumnReadHints)
+{
+   auto ds = std::make_unique<RArraysDS>();
+   const auto *dsPtr = ds.get();
+   ROOT::RDataFrame df(std::move(ds));
+   auto withSize = df.Define("size", [](std::size_t n) { return n; }, {"#var"}).Filter("size > 0");
+   auto s1 = withSize.Sum<std::size_t>("size");
+   auto s2 = df.Take<std::vector<int>>("var");
+   auto s3 = df.Alias("v", "var").Define("first", "v[0]").Max<int>("first");
+
+   EXPECT_EQ(*s1, 1ull);
+   const std::map<std::string, unsigned int> expected{{"R_rdf_sizeof_var", 1u}, {"var", 2u}};
+   EXPECT_EQ(dsPtr->GetColumnReadHints(), expected);
+}
+
 TEST(RArraysDS, SnapshotAndShortSyntaxForCollectionSizes)
 {
    const auto fname = "snapshotandshortsyntaxforcollectionsizes.root";
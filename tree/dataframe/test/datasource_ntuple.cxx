@@ -239,6 +239,94 @@ TEST_F(RNTupleDSTest, Chain)
    ChainTest(fNtplName, fFileName);
 }
 
+// Simple fields are read directly from the pages: check values across page and cluster boundaries
+TEST(RNTupleDS, MappedPages)
+{
+   FileRAII guardIn("RNTupleDS_test_mapped_pages.root");
+   FileRAII guardOut("RNTupleDS_test_mapped_pages_snapshot.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto ptrX = model->MakeField<float>("x");
+      auto ptrI = model->MakeField<int>("i");
+      ROOT::Experimental::RNTupleWriteOptions options;
+      options.SetInitialNElementsPerPage(4);
+      options.SetMaxUnzippedPageSize(64);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", guardIn.GetPath(), options);
+      for (int i = 0; i < 100; ++i) {
+         *ptrX = 0.5f * i;
+         *ptrI = i;
+         writer->Fill();
+         if (i % 30 == 29)
+            writer->CommitCluster();
+      }
+   }
+
+   auto df = ROOT::RDF::Experimental::FromRNTuple("ntpl", guardIn.GetPath());
+   auto takeX = df.Take<float>("x");
+   auto sumI = df.Sum<int>("i");
+   auto snapshot = df.Snapshot<float, int>("tree", guardOut.GetPath(), {"x", "i"});
+   EXPECT_EQ(4950, sumI.GetValue());
+   ASSERT_EQ(100u, takeX->size());
+   for (int i = 0; i < 100; ++i)
+      EXPECT_FLOAT_EQ(0.5f * i, takeX->at(i));
+
+   // the input values live at a different address at every entry: all of them must reach the output tree
+   auto mismatches = snapshot->Filter([](float x, int i) { return x != 0.5f * i; }, {"x", "i"}).Count();
+   EXPECT_EQ(0u, mismatches.GetValue());
+}
+
+static void SkipClustersTest()
+{
+   FileRAII guardFile1("RNTupleDS_test_skip_clusters_1.root");
+   FileRAII guardFile2("RNTupleDS_test_skip_clusters_2.root");
+   ROOT::Experimental::RNTupleWriteOptions options;
+   options.SetEnableValueRanges(true);
+   for (const auto &[path, offset] :
+        {std::make_pair(guardFile1.GetPath(), 0), std::make_pair(guardFile2.GetPath(), 100)}) {
+      auto model = RNTupleModel::Create();
+      auto ptrX = model->MakeField<int>("x");
+      auto ptrV = model->MakeField<std::vector<float>>("v");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", path, options);
+      // 10 clusters of 10 entries per file
+      for (int i = 0; i < 100; ++i) {
+         *ptrX = offset + i;
+         *ptrV = std::vector<float>(i % 3, 1.f);
+         writer->Fill();
+         if (i % 10 == 9)
+            writer->CommitCluster();
+      }
+   }
+
+   auto ds = std::make_unique<RNTupleDS>("ntpl", std::vector<std::string>{guardFile1.GetPath(), guardFile2.GetPath()});
+   EXPECT_THROW(ds->SkipClustersOutsideRange("v", 0., 1.), std::invalid_argument);
+   EXPECT_THROW(ds->SkipClustersOutsideRange("y", 0., 1.), std::invalid_argument);
+   // The clusters [20, 100) of the first file and [0, 30) of the second one can pass the cut
+   ds->SkipClustersOutsideRange("x", 25., 125.);
+   ROOT::RDataFrame df(std::move(ds));
+   auto nProcessed = df.Count();
+   auto nSelected = df.Filter([](int x) { return x >= 25 && x <= 125; }, {"x"}).Count();
+   auto nMismatches =
+      df.Filter([](int x, ULong64_t entry) { return ULong64_t(x) != entry; }, {"x", "rdfentry_"}).Count();
+   auto sumSizes = df.Sum<std::size_t>("R_rdf_sizeof_v");
+   EXPECT_EQ(110u, nProcessed.GetValue());
+   EXPECT_EQ(101u, nSelected.GetValue());
+   EXPECT_EQ(0u, nMismatches.GetValue());
+   std::size_t expectedSizes = 0;
+   for (int i = 20; i < 100; ++i)
+      expectedSizes += i % 3;
+   for (int i = 0; i < 30; ++i)
+      expectedSizes += i % 3;
+   EXPECT_EQ(expectedSizes, sumSizes.GetValue());
+
+   // The ranges are reused by a second event loop
+   EXPECT_EQ(110u, *df.Count());
+}
+
+TEST(RNTupleDS, SkipClusters)
+{
+   SkipClustersTest();
+}
+
 #ifdef R__USE_IMT
 struct IMTRAII {
    IMTRAII() { ROOT::EnableImplicitMT(); }
@@ -300,6 +388,13 @@ TEST_F(RNTupleDSTest, ChainTailScheduling)
    auto sumX = df.Aggregate([](int &acc, int x) { acc += x; }, [](int a, int b) { return a + b; }, "x");
    EXPECT_EQ(56, sumX.GetValue());
 }
+
+TEST(RNTupleDS, SkipClustersMT)
+{
+   IMTRAII _;
+
+   SkipClustersTest();
+}
 #endif
 
 const static std::array<ROOT::RVec<std::array<ROOT::RVecI, 3>>, 3> arraysDatasetCol4El{
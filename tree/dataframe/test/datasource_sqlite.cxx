@@ -124,18 +124,19 @@ TEST(RSqliteDS, ColumnReaders)
 {
    RSqliteDS rds(fileName0, query0);
    const auto nSlots = 2U;
-   ROOT_EXPECT_WARNING(rds.SetNSlots(nSlots), "SetNSlots",
-                       "Currently the SQlite data source faces performance degradation in multi-threaded mode. "
-                       "Consider turning off IMT.");
+   rds.SetNSlots(nSlots);
    auto vals = rds.GetColumnReaders<Long64_t>("fint");
    rds.Initialize();
    auto ranges = rds.GetEntryRanges();
-   EXPECT_EQ(1U, ranges.size());
+   EXPECT_EQ(nSlots, ranges.size());
    for (auto i : ROOT::TSeq<unsigned>(0, nSlots)) {
       EXPECT_TRUE(rds.SetEntry(i, ranges[0].first));
       auto val = **vals[i];
       EXPECT_EQ(1, val);
    }
+   EXPECT_TRUE(rds.SetEntry(1, ranges[1].first));
+   EXPECT_EQ(1, **vals[0]);
+   EXPECT_EQ(2, **vals[1]);
 
    EXPECT_THROW(rds.GetColumnReaders<double>("fint"), std::runtime_error);
 }
@@ -147,20 +148,25 @@ TEST(RSqliteDS, GetEntryRanges)
    auto ranges = rds.GetEntryRanges();
    ASSERT_EQ(1U, ranges.size());
    EXPECT_EQ(0U, ranges[0].first);
-   EXPECT_EQ(1U, ranges[0].second);
-   ranges = rds.GetEntryRanges();
-   ASSERT_EQ(1U, ranges.size());
-   EXPECT_EQ(1U, ranges[0].first);
    EXPECT_EQ(2U, ranges[0].second);
    ranges = rds.GetEntryRanges();
    EXPECT_EQ(0U, ranges.size());
+   ranges = rds.GetEntryRanges();
+   EXPECT_EQ(0U, ranges.size());
 
-   // New event loop
+   // New event loop, one row per batch
+   rds.SetNRowsPerBatch(1);
    rds.Initialize();
    ranges = rds.GetEntryRanges();
-   EXPECT_EQ(1U, ranges.size());
+   ASSERT_EQ(1U, ranges.size());
    EXPECT_EQ(0U, ranges[0].first);
    EXPECT_EQ(1U, ranges[0].second);
+   ranges = rds.GetEntryRanges();
+   ASSERT_EQ(1U, ranges.size());
+   EXPECT_EQ(1U, ranges[0].first);
+   EXPECT_EQ(2U, ranges[0].second);
+   ranges = rds.GetEntryRanges();
+   EXPECT_EQ(0U, ranges.size());
 }
 
 TEST(RSqliteDS, SetEntry)
@@ -202,7 +208,6 @@ TEST(RSqliteDS, IMT)
    const auto nSlots = 4U;
    ROOT::EnableImplicitMT(nSlots);
 
-   ROOT::TestSupport::CheckDiagsRAII diagRAII{kWarning, "SetNSlots", "Currently the SQlite data source faces performance degradation in multi-threaded mode. Consider turning off IMT."};
    auto rdf = ROOT::RDF::FromSqlite(fileName0, query0);
    EXPECT_EQ(3, *rdf.Sum("fint"));
    EXPECT_NEAR(3.0, *rdf.Sum("freal"), epsilon);
@@ -44,7 +44,10 @@ The cluster pool steers the preloading of (partial) clusters. There is a two-ste
 compressed pages are read from clusters into a memory buffer. The second pipeline step decompresses the pages
 and pushes them into the page pool. The actual logic of reading and unzipping is implemented by the page source.
 The cluster pool only orchestrates the work queues for reading and unzipping. It uses one extra I/O thread for
-reading waits for data from storage and generates no CPU load.
+reading waits for data from storage and generates no CPU load. A second extra thread picks up the clusters as soon as
+the I/O thread has read them and distributes the decompression of their pages over the page source's task scheduler.
+Thus, the I/O of the next bunch of clusters overlaps with the decompression of the current one. The amount of memory
+in the pipeline is bounded by the look-ahead window of 2 * fClusterBunchSize clusters.
 
 The unzipping step of the pipeline therefore behaves differently depending on whether or not implicit multi-threading
 is turned on. If it is turned off, i.e. in a single-threaded environment, the cluster pool will only read the
@@ -62,6 +65,13 @@ private:
       RCluster::RKey fClusterKey;
    };
 
+   /// Request to unzip the pages of a cluster that has been loaded by the I/O thread. A work item with an empty
+   /// cluster signals the termination of the unzip thread.
+   struct RUnzipItem {
+      std::unique_ptr<RCluster> fCluster;
+      std::promise<std::unique_ptr<RCluster>> fPromise;
+   };
+
    /// Clusters that are currently being processed by the pipeline.  Every in-flight cluster has a corresponding
    /// work item, first a read item and then an unzip item.
    struct RInFlightCluster {
@@ -108,6 +118,16 @@ private:
    /// main threads.
    std::thread fThreadIo;
 
+   /// Protects the unzip work queue shared between the I/O thread and the unzip thread
+   std::mutex fLockUnzipQueue;
+   /// Signals a non-empty unzip work queue
+   std::condition_variable fCvHasUnzipWork;
+   /// The communication channel from the I/O thread to the unzip thread
+   std::deque<RUnzipItem> fUnzipQueue;
+   /// The unzip thread calls RPageSource::UnzipCluster(), which is a noop unless the page source has a task
+   /// scheduler. The thread itself only waits for the unzip tasks to finish.
+   std::thread fThreadUnzip;
+
    /// Every cluster id has at most one corresponding RCluster pointer in the pool
    RCluster *FindInPool(DescriptorId_t clusterId) const;
    /// Returns an index of an unused element in fPool; callers of this function (GetCluster() and WaitFor())
@@ -115,6 +135,10 @@ private:
    size_t FindFreeSlot() const;
    /// The I/O thread routine, there is exactly one I/O thread in-flight for every cluster pool
    void ExecReadClusters();
+   /// The unzip thread routine, there is exactly one unzip thread in-flight for every cluster pool
+   void ExecUnzipClusters();
+   /// Returns true if the user meanwhile requested clusters such that the given in-flight cluster is not needed anymore
+   bool IsExpired(DescriptorId_t clusterId);
    /// Returns the given cluster from the pool, which needs to contain at least the columns `physicalColumns`.
    /// Executed at the end of GetCluster when all missing data pieces have been sent to the load queue.
    /// Ideally, the function returns without blocking if the cluster is already in the pool.
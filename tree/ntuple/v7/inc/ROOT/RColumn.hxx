@@ -24,8 +24,13 @@
 
 #include <TError.h>
 
+#include <algorithm>
+#include <cmath>
 #include <cstring> // for memcpy
+#include <limits>
 #include <memory>
+#include <optional>
+#include <type_traits>
 #include <utility>
 
 namespace ROOT::Experimental::Internal {
@@ -71,9 +76,39 @@ private:
    std::vector<RColumn *> fTeam;
    /// Points into fTeam to the column that successfully returned the last page.
    std::size_t fLastGoodTeamIdx = 0;
+   /// Computes the value range of a page of elements; only set for arithmetic in-memory types
+   std::optional<RClusterDescriptor::RValueRange> (*fValueRangeFunc)(const RPage &page) = nullptr;
 
    RColumn(EColumnType type, std::uint32_t columnIndex, std::uint16_t representationIndex);
 
+   template <typename CppT>
+   static std::optional<RClusterDescriptor::RValueRange> ComputeValueRangeImpl(const RPage &page)
+   {
+      const auto *values = static_cast<const CppT *>(page.GetBuffer());
+      const auto nElements = page.GetNElements();
+      if (nElements == 0)
+         return std::nullopt;
+      CppT min = values[0];
+      CppT max = values[0];
+      for (std::uint32_t i = 1; i < nElements; ++i) {
+         min = std::min(min, values[i]);
+         max = std::max(max, values[i]);
+      }
+      RClusterDescriptor::RValueRange range{static_cast<double>(min), static_cast<double>(max)};
+      if constexpr (std::is_floating_point_v<CppT>) {
+         // NaNs compare false with everything, no cut can be decided on the range of a page that contains one
+         for (std::uint32_t i = 0; i < nElements; ++i) {
+            if (std::isnan(values[i]))
+               return std::nullopt;
+         }
+      } else if constexpr (sizeof(CppT) == 8) {
+         // 64 bit integers may not be representable as double, make sure the range still contains all the values
+         range.fMin = std::nextafter(range.fMin, -std::numeric_limits<double>::infinity());
+         range.fMax = std::nextafter(range.fMax, std::numeric_limits<double>::infinity());
+      }
+      return range;
+   }
+
    /// Used when trying to append to a full write page. If possible, expand the page. Otherwise, flush and reset
    /// to the minimal size.
    void HandleWritePageIfFull()
@@ -107,6 +142,8 @@ public:
    {
       auto column = std::unique_ptr<RColumn>(new RColumn(type, columnIdx, representationIdx));
       column->fElement = RColumnElementBase::Generate<CppT>(type);
+      if constexpr (std::is_arithmetic_v<CppT> && !std::is_same_v<CppT, bool> && !std::is_same_v<CppT, char>)
+         column->fValueRangeFunc = &ComputeValueRangeImpl<CppT>;
       return column;
    }
 
@@ -254,6 +291,17 @@ public:
                                          sizeof(CppT));
    }
 
+   /// Type-erased version of Map(), for callers that only know the element type at run time. The returned address
+   /// points into the currently mapped page and is only valid until the column maps a different page.
+   void *MapUntyped(const NTupleSize_t globalIndex)
+   {
+      if (R__unlikely(!fReadPageRef.Get().Contains(globalIndex))) {
+         MapPage(globalIndex);
+      }
+      return static_cast<unsigned char *>(fReadPageRef.Get().GetBuffer()) +
+             (globalIndex - fReadPageRef.Get().GetGlobalRangeFirst()) * fElement->GetSize();
+   }
+
    NTupleSize_t GetGlobalIndex(RClusterIndex clusterIndex)
    {
       if (!fReadPageRef.Get().Contains(clusterIndex)) {
@@ -344,6 +392,10 @@ public:
 
    void SetBitsOnStorage(std::size_t bits) { fElement->SetBitsOnStorage(bits); }
    std::size_t GetWritePageCapacity() const { return fWritePage.GetCapacity(); }
+
+   /// Returns the minimum and maximum of the values in a page of this column, if the column is of arithmetic type and
+   /// its values are stored losslessly. Empty if the page has no elements or contains a NaN.
+   std::optional<RClusterDescriptor::RValueRange> ComputeValueRange(const RPage &page) const;
 }; // class RColumn
 
 } // namespace ROOT::Experimental::Internal
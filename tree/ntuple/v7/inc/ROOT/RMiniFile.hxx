@@ -129,6 +129,9 @@ private:
       // fHeaderBlock and fBlock are raw pointers because we have to manually call operator new and delete.
       unsigned char *fHeaderBlock;
       std::uint64_t fBlockOffset = 0;
+      /// The file offset of the first byte in fBlock that holds data. It is larger than fBlockOffset if the beginning
+      /// of the block overlaps with a region written by WriteUnbuffered(), which must not be overwritten.
+      std::uint64_t fBlockDataOffset = 0;
       unsigned char *fBlock;
 
       /// For the simplest cases, a C file stream can be used for writing
@@ -153,6 +156,12 @@ private:
 
       /// Writes bytes in the open stream, either at fFilePos or at the given offset
       void Write(const void *buffer, size_t nbytes, std::int64_t offset = -1);
+      /// Writes the buffered data up to fFilePos and then skips the next nbytes, which are left to WriteUnbuffered().
+      void SkipUnbuffered(std::size_t nbytes);
+      /// Writes bytes directly at the given offset of the underlying file descriptor, bypassing the block buffer.
+      /// Thread-safe with respect to itself and to the other methods as long as the written range was previously
+      /// skipped with SkipUnbuffered().
+      void WriteUnbuffered(const void *buffer, size_t nbytes, std::uint64_t offset) const;
       /// Writes a TKey including the data record, given by buffer, into fFile; returns the file offset to the payload.
       /// The payload is already compressed
       std::uint64_t WriteKey(const void *buffer, std::size_t nbytes, std::size_t len, std::int64_t offset = -1,
@@ -226,6 +235,15 @@ public:
    /// Write into a reserved record; the caller is responsible for making sure that the written byte range is in the
    /// previously reserved key.
    void WriteIntoReservedBlob(const void *buffer, size_t nbytes, std::int64_t offset);
+   /// Whether the next reserved record can be written with WriteIntoReservedBlobConcurrent(). This is the case for
+   /// files written by a C file stream without Direct I/O on POSIX systems, once the file header block is written.
+   bool CanWriteConcurrently() const;
+   /// Like ReserveBlob() but the reserved record must be written with WriteIntoReservedBlobConcurrent().
+   /// Requires CanWriteConcurrently().
+   std::uint64_t ReserveBlobConcurrent(size_t nbytes, size_t len);
+   /// Write into a record reserved by ReserveBlobConcurrent(). Multiple threads can write into distinct reserved
+   /// records at the same time, also concurrently to other writer operations, up to the call to Commit().
+   void WriteIntoReservedBlobConcurrent(const void *buffer, size_t nbytes, std::uint64_t offset) const;
    /// Ensures that the streamer info records passed as argument are written to the file
    void UpdateStreamerInfos(const RNTupleSerializer::StreamerInfoMap_t &streamerInfos);
    /// Writes the RNTuple key to the file so that the header and footer keys can be found
@@ -252,6 +252,14 @@ class RClusterDescriptor {
    friend class Internal::RClusterDescriptorBuilder;
 
 public:
+   /// The minimum and maximum value of the elements of a particular column in a particular cluster
+   struct RValueRange {
+      double fMin = 0.;
+      double fMax = 0.;
+
+      bool operator==(const RValueRange &other) const { return fMin == other.fMin && fMax == other.fMax; }
+   };
+
    /// The window of element indexes of a particular column in a particular cluster
    struct RColumnRange {
       DescriptorId_t fPhysicalColumnId = kInvalidDescriptorId;
@@ -266,15 +274,15 @@ public:
       /// Their element index range, however, is aligned with the corresponding column of the
       /// primary column representation (see Section "Suppressed Columns" in the specification)
       bool fIsSuppressed = false;
-
-      // TODO(jblomer): we perhaps want to store summary information, such as average, min/max, etc.
-      // Should this be done on the field level?
+      /// The range of the values of arithmetic columns, if it was recorded by the writer (see
+      /// RNTupleWriteOptions::SetEnableValueRanges()). Readers can skip clusters whose values cannot pass a cut.
+      std::optional<RValueRange> fValueRange;
 
       bool operator==(const RColumnRange &other) const
       {
          return fPhysicalColumnId == other.fPhysicalColumnId && fFirstElementIndex == other.fFirstElementIndex &&
                 fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings &&
-                fIsSuppressed == other.fIsSuppressed;
+                fIsSuppressed == other.fIsSuppressed && fValueRange == other.fValueRange;
       }
 
       bool Contains(NTupleSize_t index) const
@@ -1236,7 +1244,8 @@ public:
    }
 
    RResult<void> CommitColumnRange(DescriptorId_t physicalId, std::uint64_t firstElementIndex,
-                                   std::uint32_t compressionSettings, const RClusterDescriptor::RPageRange &pageRange);
+                                   std::uint32_t compressionSettings, const RClusterDescriptor::RPageRange &pageRange,
+                                   const std::optional<RClusterDescriptor::RValueRange> &valueRange = std::nullopt);
 
    /// Books the given column ID as being suppressed in this cluster. The correct first element index and number of
    /// elements need to be set by CommitSuppressedColumnRanges() once all the calls to CommitColumnRange() and
@@ -72,6 +72,9 @@ private:
    std::size_t fMaxUnzippedClusterSize;
    /// Estimator of uncompressed cluster size, taking into account the estimated compression ratio
    std::size_t fUnzippedClusterSizeEst;
+   /// Moving average of the compression factor of the recently committed clusters; only used with the
+   /// RNTupleWriteOptions::EClusterSizing::kAdaptive policy. Zero until the first cluster is committed.
+   float fCompressionFactorAvg = 0;
 
    /// Whether to enable staged cluster committing, where only an explicit call to CommitStagedClusters() will logically
    /// append the clusters to the RNTuple.
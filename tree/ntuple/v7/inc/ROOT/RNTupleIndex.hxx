@@ -20,9 +20,12 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
+class TFile;
+
 namespace ROOT {
 namespace Experimental {
 namespace Internal {
@@ -31,6 +34,14 @@ namespace Internal {
 \class ROOT::Experimental::Internal::RNTupleIndex
 \ingroup NTuple
 \brief Builds an index on one or several fields of an RNTuple so it can be joined onto other RNTuples.
+
+A built index can be persisted with RNTupleIndex::Write as a separate RNTuple next to the indexed one. Such a persisted
+index is opened with RNTupleIndex::Open. Building it then only reads the compact index RNTuple instead of rescanning
+the index fields of the original RNTuple.
+
+The persisted index RNTuple has one entry per indexed entry, grouped by index value. The index values are stored in
+the fields `_key0`, `_key1`, ..., whose descriptions hold the names of the corresponding indexed fields, and the entry
+number is stored in the field `_entry`.
 */
 // clang-format on
 class RNTupleIndex {
@@ -79,6 +90,11 @@ private:
    /// Only built indexes can be queried.
    bool fIsBuilt = false;
 
+   /// If the index was opened with RNTupleIndex::Open, the name and storage location of the persisted index RNTuple.
+   /// In this case, RNTupleIndex::Build loads the persisted index rather than scanning the indexed RNTuple.
+   std::string fPersistedName;
+   std::string fPersistedStorage;
+
    /////////////////////////////////////////////////////////////////////////////
    /// \brief Create an a new RNTupleIndex for the RNTuple represented by the provided page source.
    ///
@@ -93,6 +109,12 @@ private:
    /// \throws RException If the index has not been built, and can therefore not be used yet.
    void EnsureBuilt() const;
 
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Fill the index from the persisted index RNTuple.
+   ///
+   /// \throws RException If the persisted index does not match the indexed fields or the indexed RNTuple.
+   void Load();
+
 public:
    RNTupleIndex(const RNTupleIndex &other) = delete;
    RNTupleIndex &operator=(const RNTupleIndex &other) = delete;
@@ -113,12 +135,37 @@ public:
    static std::unique_ptr<RNTupleIndex>
    Create(const std::vector<std::string> &fieldNames, const RPageSource &pageSource, bool deferBuild = false);
 
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Open an RNTupleIndex that was previously persisted with RNTupleIndex::Write.
+   ///
+   /// \param[in] fieldNames The names of the indexed fields, in the same order as used to create the persisted index.
+   /// \param[in] pageSource The page source of the indexed RNTuple.
+   /// \param[in] indexName The name of the persisted index RNTuple.
+   /// \param[in] storage The storage location of the persisted index RNTuple.
+   /// \param[in] deferBuild When set to `true`, loading the persisted index is deferred until the first call to
+   /// RNTupleIndex::Build.
+   ///
+   /// \return A pointer to the newly-created index.
+   static std::unique_ptr<RNTupleIndex> Open(const std::vector<std::string> &fieldNames,
+                                             const RPageSource &pageSource, std::string_view indexName,
+                                             std::string_view storage, bool deferBuild = false);
+
    /////////////////////////////////////////////////////////////////////////////
    /// \brief Build the index.
    ///
    /// Only a built index can be queried (with RNTupleIndex::GetFirstEntryNumber or RNTupleIndex::GetAllEntryNumbers).
+   /// For an index opened with RNTupleIndex::Open, the persisted index is loaded instead.
    void Build();
 
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Persist the index as an RNTuple in the given file.
+   ///
+   /// \param[in] indexName The name of the index RNTuple to create.
+   /// \param[in] file The file to which the index RNTuple is appended, typically the file of the indexed RNTuple.
+   ///
+   /// \throws RException If the index has not been built.
+   void Write(std::string_view indexName, TFile &file) const;
+
    /////////////////////////////////////////////////////////////////////////////
    /// \brief Get the number of indexed values.
    ///
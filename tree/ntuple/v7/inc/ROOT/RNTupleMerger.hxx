@@ -77,6 +77,9 @@ struct RNTupleMergeOptions {
  */
 // clang-format on
 class RNTupleMerger final {
+   /// Minimum number of clusters of a source that are read with a single vector read
+   static constexpr unsigned int kMergeClusterBunchSize = 4;
+
    std::unique_ptr<RPageAllocator> fPageAlloc;
    std::optional<TTaskGroup> fTaskGroup;
 
@@ -27,7 +27,9 @@
 #include <ctime> // for CPU time measurement with clock()
 #include <functional>
 #include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -322,10 +324,83 @@ public:
    void ObserveMetrics(RNTupleMetrics &observee);
 
    void Print(std::ostream &output, const std::string &prefix = "") const;
+   /// Calls `func` with the fully qualified name and the counter for all counters of this object and of the observed
+   /// sub metrics, in the same order as Print(). Does nothing if the metrics are disabled.
+   void ForEachCounter(const std::function<void(const std::string &, const RNTuplePerfCounter &)> &func,
+                       const std::string &prefix = "") const;
    void Enable();
    bool IsEnabled() const { return fIsEnabled; }
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RNTupleMetricsRegistry
+\ingroup NTuple
+\brief Process-wide list of the metrics of the active readers and writers, which can be exported at runtime
+
+Readers and writers register their metrics when metrics are enabled and unregister them on destruction. The registry
+renders the current values of all registered counters as JSON or in the Prometheus text exposition format, e.g. to be
+served by a THttpServer handler of a long-running service. Exporting can happen concurrently to reading and writing;
+plain (non-atomic) counters are then read without synchronization and may be slightly out of date.
+*/
+// clang-format on
+class RNTupleMetricsRegistry {
+public:
+   /// RAII handle of a registered RNTupleMetrics object; destruction removes the metrics from the registry.
+   /// Must be destructed before the registered metrics and the sub metrics they observe.
+   class RRegistration {
+      friend class RNTupleMetricsRegistry;
+
+   private:
+      std::uint64_t fId = 0;
+      explicit RRegistration(std::uint64_t id) : fId(id) {}
+
+   public:
+      RRegistration() = default;
+      RRegistration(const RRegistration &other) = delete;
+      RRegistration &operator=(const RRegistration &other) = delete;
+      RRegistration(RRegistration &&other) : fId(other.fId) { other.fId = 0; }
+      RRegistration &operator=(RRegistration &&other);
+      ~RRegistration();
+
+      std::uint64_t GetId() const { return fId; }
+      explicit operator bool() const { return fId != 0; }
+   };
+
+private:
+   struct REntry {
+      const RNTupleMetrics *fMetrics = nullptr;
+      std::string fNTupleName;
+   };
+
+   std::mutex fLock;
+   std::uint64_t fLastId = 0;
+   /// Maps registration IDs to the registered metrics; ordered in order of registration
+   std::map<std::uint64_t, REntry> fEntries;
+
+   RNTupleMetricsRegistry() = default;
+   void Unregister(std::uint64_t id);
+
+public:
+   RNTupleMetricsRegistry(const RNTupleMetricsRegistry &other) = delete;
+   RNTupleMetricsRegistry &operator=(const RNTupleMetricsRegistry &other) = delete;
+
+   static RNTupleMetricsRegistry &Instance();
+
+   /// Adds the metrics of a reader or writer of the given RNTuple to the registry.
+   RRegistration Register(const RNTupleMetrics &metrics, std::string_view ntupleName);
+   std::size_t GetNRegistered();
+
+   /// Returns a JSON array with one object per registered metrics, of the form
+   /// `{"id":1,"ntuple":"ntpl","counters":[{"name":"...","unit":"...","description":"...","value":...},...]}`.
+   /// Values that are not a number are given as `null`.
+   std::string ToJSON();
+   /// Returns the counters of all registered metrics in the Prometheus text format. The counter names are
+   /// converted into metric names of the form `rntuple_RNTupleReader_RPageSourceFile_nReadV`, suffixed by the unit,
+   /// and labeled by the registration `id` and the `ntuple` name.
+   std::string ToPrometheus();
+};
+
 } // namespace Detail
 } // namespace Experimental
 } // namespace ROOT
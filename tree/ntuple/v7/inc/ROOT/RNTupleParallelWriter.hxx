@@ -72,6 +72,8 @@ private:
    /// The original RNTupleModel connected to fSink; needs to be destructed before it.
    std::unique_ptr<RNTupleModel> fModel;
    Detail::RNTupleMetrics fMetrics;
+   /// Set when metrics are enabled; declared after fMetrics so that the metrics are unregistered before destruction
+   Detail::RNTupleMetricsRegistry::RRegistration fMetricsRegistration;
    /// List of all created helpers. They must be destroyed before this RNTupleParallelWriter is destructed.
    std::vector<std::weak_ptr<RNTupleFillContext>> fFillContexts;
 
@@ -98,7 +100,8 @@ public:
    /// Note that all fill contexts must be destroyed before the RNTupleParallelWriter is destructed.
    std::shared_ptr<RNTupleFillContext> CreateFillContext();
 
-   void EnableMetrics() { fMetrics.Enable(); }
+   /// Enabled metrics are also registered with the Detail::RNTupleMetricsRegistry, which exports them at runtime.
+   void EnableMetrics();
    const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
 };
 
@@ -24,6 +24,8 @@
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RSpan.hxx>
 
+#include <functional>
+#include <future>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -75,6 +77,16 @@ The object returned by the RNTupleProcessor iterator is a view on the current st
 access to the global entry index (i.e., the entry index taking into account all processed ntuples), local entry index
 (i.e. the entry index for only the currently processed ntuple), the index of the ntuple currently being processed (with
 respect to the order of provided RNTupleSpecs) and the actual REntry containing the values for the current entry.
+
+Alternatively, ProcessParallel() processes the entries of all RNTuples with a thread pool. The entries are split into
+tasks along cluster boundaries and every processing slot reads into its own REntry:
+
+~~~{.cpp}
+std::vector<double> sumPt(nThreads);
+processor.ProcessParallel([&](unsigned int slot, const RNTupleProcessor::RIterator::RProcessorState &state) {
+   sumPt[slot] += *state->GetPtr<float>("pt");
+}, nThreads);
+~~~
 */
 // clang-format on
 class RNTupleProcessor {
@@ -112,20 +124,33 @@ private:
    };
 
    std::vector<RNTupleSourceSpec> fNTuples;
+   /// Kept in order to create the per-slot entries of ProcessParallel()
+   std::unique_ptr<RNTupleModel> fModel;
    std::unique_ptr<REntry> fEntry;
    std::unique_ptr<Internal::RPageSource> fPageSource;
    std::vector<RFieldContext> fFieldContexts;
+   /// The page source of the RNTuple following the connected one, opened and attached in the background
+   std::future<std::unique_ptr<Internal::RPageSource>> fNextPageSource;
+   std::size_t fNextNTupleIndex = 0; ///< The index in fNTuples of fNextPageSource
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Start opening and attaching the page source of an RNTuple in the background.
+   ///
+   /// \param[in] ntupleIndex The index in fNTuples of the RNTuple; nothing is done if it is out of range.
+   ///
+   /// Reading and deserializing its meta-data thus overlaps with the processing of the current RNTuple.
+   void PrefetchNTuple(std::size_t ntupleIndex);
 
    /////////////////////////////////////////////////////////////////////////////
    /// \brief Connect an RNTuple for processing.
    ///
-   /// \param[in] ntuple The RNTupleSourceSpec describing the RNTuple to connect.
+   /// \param[in] ntupleIndex The index in fNTuples of the RNTuple to connect.
    ///
    /// \return The number of entries in the newly-connected RNTuple.
    ///
-   /// Creates and attaches new page source for the specified RNTuple, and connects the fields that are known by
-   /// the processor to it.
-   NTupleSize_t ConnectNTuple(const RNTupleSourceSpec &ntuple);
+   /// Takes the page source prefetched for the specified RNTuple, or creates and attaches a new one, and connects the
+   /// fields that are known by the processor to it. Starts prefetching the following RNTuple.
+   NTupleSize_t ConnectNTuple(std::size_t ntupleIndex);
 
    /////////////////////////////////////////////////////////////////////////////
    /// \brief Creates and connects concrete fields to the current page source, based on the proto-fields.
@@ -215,7 +240,7 @@ public:
                   return;
                }
                // Skip over empty ntuples we might encounter.
-            } while (fProcessor.ConnectNTuple(fProcessor.fNTuples.at(fState.fNTupleIndex)) == 0);
+            } while (fProcessor.ConnectNTuple(fState.fNTupleIndex) == 0);
 
             fState.fLocalEntryIndex = 0;
          }
@@ -256,6 +281,19 @@ public:
    /// RNTuples are processed in the order in which they are specified.
    RNTupleProcessor(const std::vector<RNTupleSourceSpec> &ntuples, std::unique_ptr<RNTupleModel> model = nullptr);
 
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Processes all entries of all RNTuples in parallel.
+   ///
+   /// \param[in] func The function called for every entry. It receives the processing slot, a number between 0 and
+   /// the number of worker threads, and the processor state for the current entry. The entry in the state is private
+   /// to the slot; calls with the same slot never happen concurrently.
+   /// \param[in] nThreads The number of worker threads; 0 uses the default size of the thread pool.
+   ///
+   /// The RNTuples are split into tasks of consecutive clusters, which are processed in no particular order. Every
+   /// task opens its own page source. Without IMT support, the entries are processed sequentially in slot 0.
+   void ProcessParallel(const std::function<void(unsigned int, const RIterator::RProcessorState &)> &func,
+                        unsigned int nThreads = 0);
+
    RIterator begin() { return RIterator(*this, 0, 0); }
    RIterator end() { return RIterator(*this, fNTuples.size(), kInvalidNTupleIndex); }
 };
@@ -16,6 +16,9 @@
 #ifndef ROOT7_RNTupleReadOptions
 #define ROOT7_RNTupleReadOptions
 
+#include <string>
+#include <vector>
+
 namespace ROOT {
 namespace Experimental {
 
@@ -39,14 +42,23 @@ public:
       kOff,
       kDefault,
    };
+   /// kHeap allocates and frees every page buffer individually; kPool recycles the buffers of released pages
+   enum class EPageAllocator {
+      kHeap,
+      kPool,
+      kDefault = kHeap,
+   };
 
 private:
    EClusterCache fClusterCache = EClusterCache::kDefault;
    unsigned int fClusterBunchSize = 1;
    EImplicitMT fUseImplicitMT = EImplicitMT::kDefault;
+   EPageAllocator fPageAllocator = EPageAllocator::kDefault;
    /// If true, the RNTupleReader will track metrics straight from its construction, as
    /// if calling `RNTupleReader::EnableMetrics()` before having created the object.
    bool fEnableMetrics = false;
+   /// Fields whose pages are read one by one when an entry in them is accessed, see SetOnDemandFields()
+   std::vector<std::string> fOnDemandFields;
 
 public:
    EClusterCache GetClusterCache() const { return fClusterCache; }
@@ -58,8 +70,18 @@ public:
    EImplicitMT GetUseImplicitMT() const { return fUseImplicitMT; }
    void SetUseImplicitMT(EImplicitMT val) { fUseImplicitMT = val; }
 
+   EPageAllocator GetPageAllocator() const { return fPageAllocator; }
+   void SetPageAllocator(EPageAllocator val) { fPageAllocator = val; }
+
    bool HasMetricsEnabled() const { return fEnableMetrics; }
    void SetMetricsEnabled(bool enable) { fEnableMetrics = enable; }
+
+   const std::vector<std::string> &GetOnDemandFields() const { return fOnDemandFields; }
+   /// The pages of the given fields and of their subfields are not loaded together with the clusters but read
+   /// individually, when an entry in them is first accessed. If a selection on other fields rejects most of the
+   /// entries, and the given fields are only read for the entries that pass it (e.g. through an RNTupleView or by
+   /// RDataFrame), the pages without passing entries are neither read nor decompressed.
+   void SetOnDemandFields(const std::vector<std::string> &fieldNames) { fOnDemandFields = fieldNames; }
 };
 
 } // namespace Experimental
@@ -88,6 +88,8 @@ private:
    /// not on a hot code path.
    std::unique_ptr<RNTupleDescriptor> fCachedDescriptor;
    Detail::RNTupleMetrics fMetrics;
+   /// Set when metrics are enabled; declared after fMetrics so that the metrics are unregistered before destruction
+   Detail::RNTupleMetricsRegistry::RRegistration fMetricsRegistration;
 
    RNTupleReader(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Internal::RPageSource> source,
                  const RNTupleReadOptions &options);
@@ -339,7 +341,9 @@ public:
    /// }
    /// ntuple->PrintInfo(ENTupleInfo::kMetrics);
    /// ~~~
-   void EnableMetrics() { fMetrics.Enable(); }
+   ///
+   /// Enabled metrics are also registered with the Detail::RNTupleMetricsRegistry, which exports them at runtime.
+   void EnableMetrics();
    const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
 }; // class RNTupleReader
 
@@ -18,13 +18,16 @@
 
 #include <ROOT/RField.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RSpan.hxx>
 #include <string_view>
 
+#include <algorithm>
 #include <iterator>
 #include <memory>
 #include <type_traits>
 #include <utility>
 #include <unordered_map>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -137,7 +140,9 @@ The view owns a field and its underlying columns in order to fill an ntuple valu
 accessed by index. For top-level fields, the index refers to the entry number. Fields that are part of
 nested collections have global index numbers that are derived from their parent indexes.
 
-Fields of simple types with a Map() method will use that and thus expose zero-copy access.
+Fields of simple types with a Map() method will use that and thus expose zero-copy access. For such fields,
+MapSpan() gives access to the values of a range of entries as a span over the page memory, such that vectorized
+code can run directly on the read buffers.
 */
 // clang-format on
 template <typename T, bool UserProvidedAddress>
@@ -228,6 +233,33 @@ public:
       return fField.MapV(clusterIndex, nItems);
    }
 
+   /// Returns a span over the values of up to `maxItems` consecutive entries starting at `globalIndex`. The span
+   /// points into the page memory (zero copy). It is shorter than `maxItems` if the requested range crosses a page
+   /// boundary, in which case the caller continues at `globalIndex + span.size()`. The span becomes invalid with the
+   /// next read or map operation on this view.
+   // TODO(bgruber): turn enable_if into requires clause with C++20
+   template <typename C = T, std::enable_if_t<Internal::isMappable<FieldT>, C *> = nullptr>
+   std::span<const C> MapSpan(NTupleSize_t globalIndex, NTupleSize_t maxItems)
+   {
+      if (maxItems == 0)
+         return std::span<const C>();
+      NTupleSize_t nItems;
+      const C *values = fField.MapV(globalIndex, nItems);
+      return std::span<const C>(values, std::min(nItems, maxItems));
+   }
+
+   /// Like MapSpan(NTupleSize_t, NTupleSize_t) but for a range of values within a cluster
+   // TODO(bgruber): turn enable_if into requires clause with C++20
+   template <typename C = T, std::enable_if_t<Internal::isMappable<FieldT>, C *> = nullptr>
+   std::span<const C> MapSpan(RClusterIndex clusterIndex, NTupleSize_t maxItems)
+   {
+      if (maxItems == 0)
+         return std::span<const C>();
+      NTupleSize_t nItems;
+      const C *values = fField.MapV(clusterIndex, nItems);
+      return std::span<const C>(values, std::min(nItems, maxItems));
+   }
+
    void Bind(std::shared_ptr<T> objPtr)
    {
       static_assert(
@@ -384,6 +416,38 @@ public:
                                  collectionStart.GetIndex() + size);
    }
 
+   /// Returns the values of an item subfield for the collection at `globalIndex`, without reading the items as a
+   /// whole. `itemView` is a view obtained with GetView() from this collection view, e.g. on "pt" for a collection of
+   /// jet structs. For mappable types, the span points into the page memory, unless the collection crosses a page
+   /// boundary of the item column; then, and for types which are not mappable, the values are copied into `buffer`.
+   /// The span becomes invalid with the next read or map operation on `itemView` or the next change of `buffer`.
+   template <typename T>
+   std::span<const T> MapCollection(NTupleSize_t globalIndex, RNTupleView<T, false> &itemView, std::vector<T> &buffer)
+   {
+      ClusterSize_t size;
+      RClusterIndex collectionStart;
+      fField.GetCollectionInfo(globalIndex, &collectionStart, &size);
+      const auto clusterId = collectionStart.GetClusterId();
+      const auto firstIndex = collectionStart.GetIndex();
+      const NTupleSize_t nItems = size;
+
+      if constexpr (Internal::isMappable<RField<T>>) {
+         auto values = itemView.MapSpan(collectionStart, nItems);
+         if (values.size() == nItems)
+            return values;
+         buffer.assign(values.begin(), values.end());
+         while (buffer.size() < nItems) {
+            auto next = itemView.MapSpan(RClusterIndex(clusterId, firstIndex + buffer.size()), nItems - buffer.size());
+            buffer.insert(buffer.end(), next.begin(), next.end());
+         }
+      } else {
+         buffer.clear();
+         for (NTupleSize_t i = 0; i < nItems; ++i)
+            buffer.emplace_back(itemView(RClusterIndex(clusterId, firstIndex + i)));
+      }
+      return std::span<const T>(buffer.data(), buffer.size());
+   }
+
    /// Raises an exception if there is no field with the given name.
    template <typename T>
    RNTupleView<T, false> GetView(std::string_view fieldName)
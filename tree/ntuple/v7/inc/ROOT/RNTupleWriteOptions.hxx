@@ -52,6 +52,17 @@ public:
       kDefault,
    };
 
+   /// How the fill context estimates the compression factor that translates the target compressed cluster size into
+   /// an uncompressed cluster size.
+   enum class EClusterSizing {
+      /// Use the compression factor of all the data written so far
+      kGlobalRatio,
+      /// Use a moving average of the compression factors of the most recent clusters, which follows changes in the
+      /// compressibility of the data faster
+      kAdaptive,
+      kDefault = kGlobalRatio,
+   };
+
    // clang-format off
    static constexpr std::uint64_t kDefaultMaxKeySize = 0x4000'0000; // 1 GiB
 
@@ -65,6 +76,9 @@ protected:
    /// Memory limit for committing a cluster: with very high compression ratio, we need a limit
    /// on how large the I/O buffer can grow during writing.
    std::size_t fMaxUnzippedClusterSize = 512 * 1024 * 1024;
+   /// The policy for estimating the uncompressed cluster size that results in the target compressed cluster size.
+   /// In any case, clusters are limited by fMaxUnzippedClusterSize.
+   EClusterSizing fClusterSizing = EClusterSizing::kDefault;
    /// Initially, columns start with a page large enough to hold the given number of elements. The initial
    /// page size is the given number of elements multiplied by the column's element size.
    /// If more elements are needed, pages are increased up until the byte limit given by fMaxUnzippedPageSize
@@ -90,6 +104,8 @@ protected:
    EImplicitMT fUseImplicitMT = EImplicitMT::kDefault;
    /// If set, checksums will be calculated and written for every page.
    bool fEnablePageChecksums = true;
+   /// If set, the minimum and maximum value of every arithmetic column is recorded for every cluster.
+   bool fEnableValueRanges = false;
    /// Specifies the max size of a payload storeable into a single TKey. When writing an RNTuple to a ROOT file,
    /// any payload whose size exceeds this will be split into multiple keys.
    std::uint64_t fMaxKeySize = kDefaultMaxKeySize;
@@ -112,6 +128,9 @@ public:
    std::size_t GetMaxUnzippedClusterSize() const { return fMaxUnzippedClusterSize; }
    void SetMaxUnzippedClusterSize(std::size_t val);
 
+   EClusterSizing GetClusterSizing() const { return fClusterSizing; }
+   void SetClusterSizing(EClusterSizing val) { fClusterSizing = val; }
+
    std::size_t GetInitialNElementsPerPage() const { return fInitialNElementsPerPage; }
    void SetInitialNElementsPerPage(std::size_t val);
 
@@ -134,6 +153,11 @@ public:
    /// Note that turning off page checksums will also turn off the same page merging optimization (see tuning.md)
    void SetEnablePageChecksums(bool val) { fEnablePageChecksums = val; }
 
+   bool GetEnableValueRanges() const { return fEnableValueRanges; }
+   /// Value ranges let readers skip the clusters whose values are all outside of a cut, e.g.
+   /// RNTupleDS::SkipClustersOutsideRange(). They are not recorded for floating-point columns with a lossy encoding.
+   void SetEnableValueRanges(bool val) { fEnableValueRanges = val; }
+
    std::uint64_t GetMaxKeySize() const { return fMaxKeySize; }
 };
 
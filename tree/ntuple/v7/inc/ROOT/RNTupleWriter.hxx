@@ -68,6 +68,8 @@ private:
    std::unique_ptr<Internal::RPageStorage::RTaskScheduler> fZipTasks;
    RNTupleFillContext fFillContext;
    Detail::RNTupleMetrics fMetrics;
+   /// Set when metrics are enabled; declared after fMetrics so that the metrics are unregistered before destruction
+   Detail::RNTupleMetricsRegistry::RRegistration fMetricsRegistration;
 
    NTupleSize_t fLastCommittedClusterGroup = 0;
 
@@ -134,7 +136,8 @@ public:
    /// Return the number of entries filled so far.
    NTupleSize_t GetNEntries() const { return fFillContext.GetNEntries(); }
 
-   void EnableMetrics() { fMetrics.Enable(); }
+   /// Enabled metrics are also registered with the Detail::RNTupleMetricsRegistry, which exports them at runtime.
+   void EnableMetrics();
    const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
 
    const RNTupleModel &GetModel() const { return *fFillContext.fModel; }
@@ -21,6 +21,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <cstring>
 #include <functional>
 #include <memory>
@@ -30,6 +31,122 @@ namespace ROOT {
 namespace Experimental {
 namespace Internal {
 
+// clang-format off
+/**
+\class ROOT::Experimental::Internal::RNTupleRLE
+\ingroup NTuple
+\brief Run-length encoding of pages, in a block of the ROOT compression frame format with the "RL" algorithm tag
+
+Pages made of long runs of equal bytes, e.g. the delta-encoded and split offsets of collections with a constant size
+or booleans which seldom change, are much faster to decode from a run-length encoding than from a general-purpose
+compression. A run of n >= 3 equal bytes is encoded as 0x80, the byte and the LEB128 varint of n - 3; up to 128 other
+bytes are copied after a control byte with their number minus one.
+*/
+// clang-format on
+class RNTupleRLE {
+public:
+   static constexpr std::size_t kHeaderSize = 9;
+
+   static bool IsRLEBlock(const unsigned char *block) { return block[0] == 'R' && block[1] == 'L'; }
+
+   /// Return the size of the RLE block of the `nbytes` bytes in `from`, or 0 if it would be larger than `maxSize`
+   static std::size_t Encode(const unsigned char *from, std::size_t nbytes, unsigned char *to, std::size_t maxSize)
+   {
+      if (nbytes > kMAXZIPBUF || maxSize <= kHeaderSize)
+         return 0;
+
+      std::size_t pos = kHeaderSize;
+      std::size_t literalStart = 0;
+      auto fnWriteLiterals = [&](std::size_t end) {
+         while (literalStart < end) {
+            const auto n = std::min<std::size_t>(128, end - literalStart);
+            if (pos + 1 + n > maxSize)
+               return false;
+            to[pos++] = n - 1;
+            memcpy(to + pos, from + literalStart, n);
+            pos += n;
+            literalStart += n;
+         }
+         return true;
+      };
+
+      for (std::size_t i = 0; i < nbytes;) {
+         std::size_t run = 1;
+         while (i + run < nbytes && from[i + run] == from[i])
+            ++run;
+         if (run < 3) {
+            i += run;
+            continue;
+         }
+         if (!fnWriteLiterals(i) || pos + 2 + 4 > maxSize)
+            return 0;
+         to[pos++] = 0x80;
+         to[pos++] = from[i];
+         for (auto n = run - 3; true; n >>= 7) {
+            if (n < 0x80) {
+               to[pos++] = n;
+               break;
+            }
+            to[pos++] = 0x80 | (n & 0x7f);
+         }
+         i += run;
+         literalStart = i;
+      }
+      if (!fnWriteLiterals(nbytes))
+         return 0;
+
+      // Same framing as the other algorithms: tag, method, encoded size and decoded size (24 bit little endian)
+      const auto szEncoded = pos - kHeaderSize;
+      to[0] = 'R';
+      to[1] = 'L';
+      to[2] = 0;
+      for (int i = 0; i < 3; ++i) {
+         to[3 + i] = (szEncoded >> (8 * i)) & 0xff;
+         to[6 + i] = (nbytes >> (8 * i)) & 0xff;
+      }
+      return pos;
+   }
+
+   /// Sizes of the block including its header and of the decoded data
+   static void ReadHeader(const unsigned char *block, int &szBlock, int &szDecoded)
+   {
+      szBlock = kHeaderSize + (block[3] | (block[4] << 8) | (block[5] << 16));
+      szDecoded = block[6] | (block[7] << 8) | (block[8] << 16);
+   }
+
+   static void Decode(const unsigned char *block, std::size_t szBlock, unsigned char *to, std::size_t szDecoded)
+   {
+      std::size_t pos = kHeaderSize;
+      std::size_t nDecoded = 0;
+      while (pos < szBlock) {
+         const auto control = block[pos++];
+         if (control < 0x80) {
+            const std::size_t n = control + 1;
+            R__ASSERT(pos + n <= szBlock && nDecoded + n <= szDecoded);
+            memcpy(to + nDecoded, block + pos, n);
+            pos += n;
+            nDecoded += n;
+            continue;
+         }
+         R__ASSERT(pos < szBlock);
+         const auto value = block[pos++];
+         std::size_t n = 0;
+         for (unsigned int shift = 0; true; shift += 7) {
+            R__ASSERT(pos < szBlock && shift < 32);
+            const auto b = block[pos++];
+            n |= static_cast<std::size_t>(b & 0x7f) << shift;
+            if (b < 0x80)
+               break;
+         }
+         n += 3;
+         R__ASSERT(nDecoded + n <= szDecoded);
+         memset(to + nDecoded, value, n);
+         nDecoded += n;
+      }
+      R__ASSERT(nDecoded == szDecoded);
+   }
+};
+
 // clang-format off
 /**
 \class ROOT::Experimental::Internal::RNTupleCompressor
@@ -165,6 +282,23 @@ public:
       return szZipData;
    }
 
+   /// Pages which the run-length encoding shrinks at least by this factor are not compressed with the general-purpose
+   /// algorithm, see ZipPage()
+   static constexpr std::size_t kMinRLEFactor = 8;
+
+   /// Like Zip(), but if the compression is enabled and the run-length encoding (see RNTupleRLE) reduces the page to
+   /// at most 1/kMinRLEFactor of its size, the run-length encoded page is stored instead, which decodes much faster.
+   static std::size_t ZipPage(const void *from, std::size_t nbytes, int compression, void *to)
+   {
+      if (compression % 100 != 0) {
+         const auto szRLE = RNTupleRLE::Encode(static_cast<const unsigned char *>(from), nbytes,
+                                               static_cast<unsigned char *>(to), nbytes / kMinRLEFactor);
+         if (szRLE > 0)
+            return szRLE;
+      }
+      return Zip(from, nbytes, compression, to);
+   }
+
    void *GetZipBuffer() { return fZipBuffer->data(); }
 };
 
@@ -205,15 +339,23 @@ public:
       do {
          int szSource;
          int szTarget;
-         int retval = R__unzip_header(&szSource, source, &szTarget);
-         R__ASSERT(retval == 0);
+         const bool isRLE = RNTupleRLE::IsRLEBlock(source);
+         if (isRLE) {
+            RNTupleRLE::ReadHeader(source, szSource, szTarget);
+         } else {
+            int retval = R__unzip_header(&szSource, source, &szTarget);
+            R__ASSERT(retval == 0);
+         }
          R__ASSERT(szSource > 0);
          R__ASSERT(szTarget > szSource);
          R__ASSERT(static_cast<unsigned int>(szSource) <= nbytes);
          R__ASSERT(static_cast<unsigned int>(szTarget) <= dataLen);
 
-         int unzipBytes = 0;
-         R__unzip(&szSource, source, &szTarget, target, &unzipBytes);
+         int unzipBytes = szTarget;
+         if (isRLE)
+            RNTupleRLE::Decode(source, szSource, target, szTarget);
+         else
+            R__unzip(&szSource, source, &szTarget, target, &unzipBytes);
          R__ASSERT(unzipBytes == szTarget);
 
          target += szTarget;
@@ -21,6 +21,8 @@
 
 #include <cstddef>
 #include <functional>
+#include <mutex>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -68,6 +70,50 @@ public:
    RPage NewPage(ColumnId_t columnId, std::size_t elementSize, std::size_t nElements) final;
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::Internal::RPageAllocatorPool
+\ingroup NTuple
+\brief Recycles the memory of released pages for subsequent page allocations
+
+Page buffers are grouped in size classes of powers of two bytes. When a page is released, its buffer is kept in a
+free list of its size class, up to a total of fMaxCachedBytes, and handed out again for the next allocation of the
+same size class. This avoids the malloc/free churn of the page pool when the cluster window slides over many small
+columns.
+*/
+// clang-format on
+class RPageAllocatorPool : public RPageAllocator {
+public:
+   static constexpr std::size_t kDefaultMaxCachedBytes = 64 * 1024 * 1024;
+   /// Buffers smaller than this are rounded up to the smallest size class
+   static constexpr std::size_t kMinBufferSize = 64;
+
+private:
+   /// Protects the free lists; pages may be released from a different thread than the one that allocated them
+   std::mutex fLock;
+   /// Indexed by the size class, i.e. the binary logarithm of the buffer size
+   std::vector<std::vector<unsigned char *>> fFreeBuffers;
+   /// The sum of the sizes of all the buffers kept in the free lists
+   std::size_t fCachedBytes = 0;
+   std::size_t fMaxCachedBytes;
+
+   static unsigned int GetSizeClass(std::size_t nbytes);
+
+protected:
+   void DeletePage(RPage &page) final;
+
+public:
+   explicit RPageAllocatorPool(std::size_t maxCachedBytes = kDefaultMaxCachedBytes);
+   RPageAllocatorPool(const RPageAllocatorPool &) = delete;
+   RPageAllocatorPool &operator=(const RPageAllocatorPool &) = delete;
+   ~RPageAllocatorPool() override;
+
+   RPage NewPage(ColumnId_t columnId, std::size_t elementSize, std::size_t nElements) final;
+
+   /// The number of bytes currently held in the free lists, i.e. memory not in use by any page
+   std::size_t GetCachedBytes();
+};
+
 } // namespace Internal
 } // namespace Experimental
 } // namespace ROOT
@@ -36,6 +36,7 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <set>
 #include <shared_mutex>
 #include <unordered_set>
@@ -93,6 +94,8 @@ public:
       std::size_t fBufferSize = 0; ///< Size of the page payload and the trailing checksum (if available)
       std::uint32_t fNElements = 0;
       bool fHasChecksum = false; ///< If set, the last 8 bytes of the buffer are the xxhash of the rest of the buffer
+      /// Range of the page values, set by the sinks that seal pages if RNTupleWriteOptions::GetEnableValueRanges()
+      std::optional<RClusterDescriptor::RValueRange> fValueRange;
 
    public:
       RSealedPage() = default;
@@ -122,6 +125,9 @@ public:
       bool GetHasChecksum() const { return fHasChecksum; }
       void SetHasChecksum(bool hasChecksum) { fHasChecksum = hasChecksum; }
 
+      const std::optional<RClusterDescriptor::RValueRange> &GetValueRange() const { return fValueRange; }
+      void SetValueRange(const std::optional<RClusterDescriptor::RValueRange> &valueRange) { fValueRange = valueRange; }
+
       void ChecksumIfEnabled();
       RResult<void> VerifyChecksumIfEnabled() const;
       /// Returns a failure if the sealed page has no checksum
@@ -145,7 +151,7 @@ public:
 protected:
    Detail::RNTupleMetrics fMetrics;
 
-   /// For the time being, we will use the heap allocator for all sources and sinks. This may change in the future.
+   /// Sinks use the heap allocator; sources use the allocator selected by RNTupleReadOptions::GetPageAllocator()
    std::unique_ptr<RPageAllocator> fPageAllocator;
 
    std::string fNTupleName;
@@ -266,6 +272,7 @@ public:
          RClusterDescriptor::RPageRange fPageRange;
          ClusterSize_t fNElements = kInvalidClusterIndex;
          bool fIsSuppressed = false;
+         std::optional<RClusterDescriptor::RValueRange> fValueRange;
       };
 
       std::vector<RColumnInfo> fColumnInfos;
@@ -423,6 +430,11 @@ public:
       // By default, there is no lock and the guard does nothing.
       return RSinkGuard(nullptr);
    }
+
+   /// Sinks that, while holding the sink guard, only reserve storage in CommitSealedPageV() write the page data here.
+   /// Must be called after releasing the guard and before the committed sealed pages are released.
+   /// By default, CommitSealedPageV() writes the page data itself and this method does nothing.
+   virtual void WriteDeferredPages() {}
 }; // class RPageSink
 
 // clang-format off
@@ -445,6 +457,12 @@ private:
    std::vector<RClusterDescriptor::RColumnRange> fOpenColumnRanges;
    /// Keeps track of the written pages in the currently open cluster. Indexed by column id.
    std::vector<RClusterDescriptor::RPageRange> fOpenPageRanges;
+   /// Set for the columns that got a page without value range in the currently open cluster. Indexed by column id.
+   std::vector<bool> fOpenValueRangesUnknown;
+
+   /// Widens the value range of the open column range by the one of a newly committed page
+   void UpdateValueRange(DescriptorId_t physicalColumnId, std::uint32_t nElements,
+                         const std::optional<RClusterDescriptor::RValueRange> &pageRange);
 
    /// Union of the streamer info records that are sent from unsplit fields to the sink before committing the dataset.
    RNTupleSerializer::StreamerInfoMap_t fStreamerInfos;
@@ -656,6 +674,8 @@ protected:
    RNTupleReadOptions fOptions;
    /// The active columns are implicitly defined by the model fields or views
    RActivePhysicalColumns fActivePhysicalColumns;
+   /// The active columns of the on-demand fields of the read options, whose pages are not part of the clusters
+   std::unordered_set<DescriptorId_t> fOnDemandPhysicalColumns;
 
    /// Pages that are unzipped with IMT are staged into the page pool
    RPagePool fPagePool;
@@ -671,6 +691,15 @@ protected:
    virtual RPageRef LoadPageImpl(ColumnHandle_t columnHandle, const RClusterInfo &clusterInfo,
                                  ClusterSize_t::ValueType idxInCluster) = 0;
 
+   /// Whether the pages of the given column are read one by one instead of with the cluster, see
+   /// RNTupleReadOptions::SetOnDemandFields()
+   bool IsOnDemandColumn(DescriptorId_t physicalColumnId) const
+   {
+      return fOnDemandPhysicalColumns.count(physicalColumnId) > 0;
+   }
+   /// The active columns whose pages are loaded with the clusters
+   RCluster::ColumnSet_t GetClusterColumnSet() const;
+
    /// Prepare a page range read for the column set in `clusterKey`.  Specifically, pages referencing the
    /// `kTypePageZero` locator are filled in `pageZeroMap`; otherwise, `perPageFunc` is called for each page. This is
    /// commonly used as part of `LoadClusters()` in derived classes.
@@ -69,9 +69,22 @@ private:
       size_t fBytesPacked;
    };
 
+public:
+   /// A sealed page for which storage has been reserved but which has not been written yet
+   struct RDeferredWrite {
+      const void *fBuffer = nullptr;
+      std::size_t fSize = 0;
+      std::uint64_t fOffset = 0;
+   };
+
+private:
    std::unique_ptr<RNTupleFileWriter> fWriter;
    /// Number of bytes committed to storage in the current cluster
    std::uint64_t fNBytesCurrentCluster = 0;
+   /// If set, CommitSealedPageV() only reserves storage for the sealed pages if the file writer supports it.
+   bool fDeferWrites = false;
+   /// The sealed pages reserved by CommitSealedPageV() in deferred mode, to be collected with ReleaseDeferredWrites()
+   std::vector<RDeferredWrite> fDeferredWrites;
    RPageSinkFile(std::string_view ntupleName, const RNTupleWriteOptions &options);
 
    /// We pass bytesPacked so that TFile::ls() reports a reasonable value for the compression ratio of the corresponding
@@ -105,6 +118,17 @@ public:
    RPageSinkFile(RPageSinkFile &&) = default;
    RPageSinkFile &operator=(RPageSinkFile &&) = default;
    ~RPageSinkFile() override;
+
+   /// In deferred mode, CommitSealedPageV() reserves storage for the sealed pages but leaves writing the page data
+   /// to WriteDeferred(). This allows for writing the pages of multiple clusters concurrently, e.g. by the fill
+   /// contexts of an RNTupleParallelWriter. Deferral is silently disabled if the underlying file does not support
+   /// concurrent writes.
+   void SetDeferWrites(bool val) { fDeferWrites = val; }
+   /// Returns the sealed pages reserved by CommitSealedPageV() since the last call. Needs the same synchronization
+   /// as CommitSealedPageV().
+   std::vector<RDeferredWrite> ReleaseDeferredWrites() { return std::exchange(fDeferredWrites, {}); }
+   /// Writes the page data of the given deferred writes. Can be called concurrently from multiple threads.
+   void WriteDeferred(const std::vector<RDeferredWrite> &writes);
 }; // class RPageSinkFile
 
 // clang-format off
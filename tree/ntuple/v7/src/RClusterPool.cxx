@@ -16,11 +16,13 @@
 #include <ROOT/RClusterPool.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RPageStorage.hxx>
+#include <ROOT/RTraceSpan.hxx>
 
 #include <TError.h>
 
 #include <algorithm>
 #include <chrono>
+#include <exception>
 #include <future>
 #include <iostream>
 #include <iterator>
@@ -52,7 +54,8 @@ ROOT::Experimental::Internal::RClusterPool::RClusterPool(RPageSource &pageSource
    : fPageSource(pageSource),
      fClusterBunchSize(clusterBunchSize),
      fPool(2 * clusterBunchSize),
-     fThreadIo(&RClusterPool::ExecReadClusters, this)
+     fThreadIo(&RClusterPool::ExecReadClusters, this),
+     fThreadUnzip(&RClusterPool::ExecUnzipClusters, this)
 {
    R__ASSERT(clusterBunchSize > 0);
 }
@@ -66,6 +69,16 @@ ROOT::Experimental::Internal::RClusterPool::~RClusterPool()
       fCvHasReadWork.notify_one();
    }
    fThreadIo.join();
+   // The I/O thread sends the termination marker to the unzip thread before it returns
+   fThreadUnzip.join();
+}
+
+bool ROOT::Experimental::Internal::RClusterPool::IsExpired(DescriptorId_t clusterId)
+{
+   std::unique_lock<std::mutex> lock(fLockWorkQueue);
+   return std::any_of(fInFlightClusters.begin(), fInFlightClusters.end(), [clusterId](auto &inFlight) {
+      return inFlight.fClusterKey.fClusterId == clusterId && inFlight.fIsExpired;
+   });
 }
 
 void ROOT::Experimental::Internal::RClusterPool::ExecReadClusters()
@@ -87,6 +100,9 @@ void ROOT::Experimental::Internal::RClusterPool::ExecReadClusters()
             // thread to terminate; thus, it must appear last in the queue.
             if (R__unlikely(item.fClusterKey.fClusterId == kInvalidDescriptorId)) {
                R__ASSERT(i == (readItems.size() - 1));
+               std::unique_lock<std::mutex> lock(fLockUnzipQueue);
+               fUnzipQueue.emplace_back(RUnzipItem());
+               fCvHasUnzipWork.notify_one();
                return;
             }
             if ((bunchId >= 0) && (item.fBunchId != bunchId))
@@ -95,28 +111,76 @@ void ROOT::Experimental::Internal::RClusterPool::ExecReadClusters()
             clusterKeys.emplace_back(item.fClusterKey);
          }
 
-         auto clusters = fPageSource.LoadClusters(clusterKeys);
+         std::vector<std::unique_ptr<RCluster>> clusters;
+         {
+            R__TRACE_SPAN("ntuple", "RClusterPool::LoadClusters");
+            clusters = fPageSource.LoadClusters(clusterKeys);
+         }
+         std::vector<RUnzipItem> unzipItems;
          for (std::size_t i = 0; i < clusters.size(); ++i) {
             // Meanwhile, the user might have requested clusters outside the look-ahead window, so that we don't
             // need the cluster anymore, in which case we simply discard it right away, before moving it to the pool
-            bool discard;
-            {
-               std::unique_lock<std::mutex> lock(fLockWorkQueue);
-               discard = std::any_of(fInFlightClusters.begin(), fInFlightClusters.end(),
-                                     [thisClusterId = clusters[i]->GetId()](auto &inFlight) {
-                                        return inFlight.fClusterKey.fClusterId == thisClusterId && inFlight.fIsExpired;
-                                     });
-            }
-            if (discard) {
+            if (IsExpired(clusters[i]->GetId())) {
                clusters[i].reset();
                // clusters[i] is now nullptr; also return this via the promise.
                readItems[i].fPromise.set_value(nullptr);
             } else {
-               readItems[i].fPromise.set_value(std::move(clusters[i]));
+               RUnzipItem unzipItem;
+               unzipItem.fCluster = std::move(clusters[i]);
+               unzipItem.fPromise = std::move(readItems[i].fPromise);
+               unzipItems.emplace_back(std::move(unzipItem));
             }
          }
          readItems.erase(readItems.begin(), readItems.begin() + clusters.size());
+
+         // Hand over the clusters to the unzip thread and continue with the next bunch of clusters
+         if (!unzipItems.empty()) {
+            std::unique_lock<std::mutex> lock(fLockUnzipQueue);
+            for (auto &item : unzipItems)
+               fUnzipQueue.emplace_back(std::move(item));
+            fCvHasUnzipWork.notify_one();
+         }
+      }
+   } // while (true)
+}
+
+void ROOT::Experimental::Internal::RClusterPool::ExecUnzipClusters()
+{
+   std::deque<RUnzipItem> unzipItems;
+   while (true) {
+      {
+         std::unique_lock<std::mutex> lock(fLockUnzipQueue);
+         fCvHasUnzipWork.wait(lock, [&] { return !fUnzipQueue.empty(); });
+         std::swap(unzipItems, fUnzipQueue);
       }
+
+      for (unsigned i = 0; i < unzipItems.size(); ++i) {
+         auto &item = unzipItems[i];
+         // An empty cluster is used as a marker for thread cancellation; it must appear last in the queue.
+         if (R__unlikely(!item.fCluster)) {
+            R__ASSERT(i == (unzipItems.size() - 1));
+            return;
+         }
+
+         // The cluster may have expired while it was waiting in the unzip queue; don't waste CPU time on it
+         if (IsExpired(item.fCluster->GetId())) {
+            item.fCluster.reset();
+            item.fPromise.set_value(nullptr);
+            continue;
+         }
+
+         try {
+            R__TRACE_SPAN("ntuple", "RClusterPool::UnzipCluster");
+            // Noop unless the page source has a task scheduler
+            fPageSource.UnzipCluster(item.fCluster.get());
+         } catch (...) {
+            // E.g., a checksum failure; rethrown to the main thread when it collects the cluster
+            item.fPromise.set_exception(std::current_exception());
+            continue;
+         }
+         item.fPromise.set_value(std::move(item.fCluster));
+      }
+      unzipItems.clear();
    } // while (true)
 }
 
@@ -281,9 +345,6 @@ ROOT::Experimental::Internal::RClusterPool::GetCluster(DescriptorId_t clusterId,
             continue;
          }
 
-         // Noop unless the page source has a task scheduler
-         fPageSource.UnzipCluster(cptr.get());
-
          // We either put a fresh cluster into a free slot or we merge the cluster with an existing one
          auto existingCluster = FindInPool(cptr->GetId());
          if (existingCluster) {
@@ -383,9 +444,6 @@ ROOT::Experimental::Internal::RClusterPool::WaitFor(DescriptorId_t clusterId,
       // We were blocked waiting for the cluster, so assume that nobody discarded it.
       R__ASSERT(cptr != nullptr);
 
-      // Noop unless the page source has a task scheduler
-      fPageSource.UnzipCluster(cptr.get());
-
       if (result) {
          result->Adopt(std::move(*cptr));
       } else {
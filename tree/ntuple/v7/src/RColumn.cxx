@@ -126,3 +126,22 @@ void ROOT::Experimental::Internal::RColumn::MergeTeams(RColumn &other)
       c->fTeam = fTeam;
    }
 }
+
+std::optional<ROOT::Experimental::RClusterDescriptor::RValueRange>
+ROOT::Experimental::Internal::RColumn::ComputeValueRange(const RPage &page) const
+{
+   if (!fValueRangeFunc)
+      return std::nullopt;
+   switch (fType) {
+   // Lossy floating-point encodings read back values that differ from the ones used to compute the range
+   case EColumnType::kReal16:
+   case EColumnType::kReal32Trunc: return std::nullopt;
+   case EColumnType::kReal32:
+   case EColumnType::kSplitReal32:
+      if (fElement->GetSize() > 4)
+         return std::nullopt; // double values stored as float
+      break;
+   default: break;
+   }
+   return fValueRangeFunc(page);
+}
@@ -11,7 +11,13 @@
 #include <ROOT/RConfig.hxx>
 #include <Byteswap.h>
 
+#include <algorithm>
 #include <bitset>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 // NOTE: some tests might define R__LITTLE_ENDIAN to simulate a different-endianness machine
 #ifndef R__LITTLE_ENDIAN
@@ -145,6 +151,78 @@ inline void CastUnpack(void *destination, const void *source, std::size_t count)
    }
 }
 
+/// The number of elements that are unsplit at a time into a stack buffer before they are cast, delta or zigzag decoded
+inline constexpr std::size_t kUnsplitBlockSize = 256;
+
+#if defined(__SSE2__)
+/// \brief SSE2 kernel for UnsplitBytes: interleaves the byte planes of 16 elements at a time
+///
+/// Returns the number of elements processed, which is a multiple of 16. Supports element sizes 2, 4, and 8.
+template <std::size_t N>
+inline std::size_t UnsplitBytesSSE2(unsigned char *dst, const unsigned char *src, std::size_t count,
+                                    std::size_t planeStride)
+{
+   const std::size_t nBlocks = (N == 2 || N == 4 || N == 8) ? count / 16 : 0;
+   for (std::size_t k = 0; k < nBlocks; ++k) {
+      auto in = src + 16 * k;
+      auto out = reinterpret_cast<__m128i *>(dst + 16 * k * N);
+      __m128i p[N];
+      for (std::size_t b = 0; b < N; ++b)
+         p[b] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + b * planeStride));
+      if constexpr (N == 2) {
+         _mm_storeu_si128(out + 0, _mm_unpacklo_epi8(p[0], p[1]));
+         _mm_storeu_si128(out + 1, _mm_unpackhi_epi8(p[0], p[1]));
+      } else if constexpr (N == 4) {
+         const __m128i lo01 = _mm_unpacklo_epi8(p[0], p[1]);
+         const __m128i hi01 = _mm_unpackhi_epi8(p[0], p[1]);
+         const __m128i lo23 = _mm_unpacklo_epi8(p[2], p[3]);
+         const __m128i hi23 = _mm_unpackhi_epi8(p[2], p[3]);
+         _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(lo01, lo23));
+         _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(lo01, lo23));
+         _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(hi01, hi23));
+         _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(hi01, hi23));
+      } else if constexpr (N == 8) {
+         // Pairs of bytes of elements 0..7 (lo) and 8..15 (hi)
+         __m128i lo[4], hi[4];
+         for (std::size_t j = 0; j < 4; ++j) {
+            lo[j] = _mm_unpacklo_epi8(p[2 * j], p[2 * j + 1]);
+            hi[j] = _mm_unpackhi_epi8(p[2 * j], p[2 * j + 1]);
+         }
+         // Quadruples of bytes 0..3 and 4..7 of elements 0..3, 4..7, 8..11, 12..15
+         const __m128i q0123[4] = {_mm_unpacklo_epi16(lo[0], lo[1]), _mm_unpackhi_epi16(lo[0], lo[1]),
+                                   _mm_unpacklo_epi16(hi[0], hi[1]), _mm_unpackhi_epi16(hi[0], hi[1])};
+         const __m128i q4567[4] = {_mm_unpacklo_epi16(lo[2], lo[3]), _mm_unpackhi_epi16(lo[2], lo[3]),
+                                   _mm_unpacklo_epi16(hi[2], hi[3]), _mm_unpackhi_epi16(hi[2], hi[3])};
+         for (std::size_t j = 0; j < 4; ++j) {
+            _mm_storeu_si128(out + 2 * j, _mm_unpacklo_epi32(q0123[j], q4567[j]));
+            _mm_storeu_si128(out + 2 * j + 1, _mm_unpackhi_epi32(q0123[j], q4567[j]));
+         }
+      }
+   }
+   return 16 * nBlocks;
+}
+#endif
+
+/// \brief Reverse the byte splitting of `count` elements of size `N`
+///
+/// The i-th byte of the elements is read from the byte plane starting at `source + i * planeStride`. The elements
+/// are written in memory order to `destination`, without byte swapping. Uses SIMD instructions where available.
+template <std::size_t N>
+inline void UnsplitBytes(void *destination, const void *source, std::size_t count, std::size_t planeStride)
+{
+   auto dst = reinterpret_cast<unsigned char *>(destination);
+   auto src = reinterpret_cast<const unsigned char *>(source);
+   std::size_t i = 0;
+#if defined(__SSE2__)
+   i = UnsplitBytesSSE2<N>(dst, src, count, planeStride);
+#endif
+   for (; i < count; ++i) {
+      for (std::size_t b = 0; b < N; ++b) {
+         dst[i * N + b] = src[b * planeStride + i];
+      }
+   }
+}
+
 /// \brief Split encoding of elements, possibly into narrower column
 ///
 /// Used to first cast and then split-encode in-memory values to the on-disk column. Swap bytes if necessary.
@@ -172,13 +250,22 @@ inline void CastSplitUnpack(void *destination, const void *source, std::size_t c
    constexpr std::size_t N = sizeof(SourceT);
    auto dst = reinterpret_cast<DestT *>(destination);
    auto splitArray = reinterpret_cast<const char *>(source);
-   for (std::size_t i = 0; i < count; ++i) {
-      SourceT val = 0;
-      for (std::size_t b = 0; b < N; ++b) {
-         reinterpret_cast<char *>(&val)[b] = splitArray[b * count + i];
+   if constexpr (std::is_same_v<DestT, SourceT>) {
+      UnsplitBytes<N>(dst, splitArray, count, count);
+#if R__LITTLE_ENDIAN == 0
+      InPlaceBswap<N>(dst, count);
+#endif
+   } else {
+      SourceT buffer[kUnsplitBlockSize];
+      for (std::size_t first = 0; first < count; first += kUnsplitBlockSize) {
+         const auto nElements = std::min(kUnsplitBlockSize, count - first);
+         UnsplitBytes<N>(buffer, splitArray + first, nElements, count);
+         for (std::size_t i = 0; i < nElements; ++i) {
+            SourceT val = buffer[i];
+            ByteSwapIfNecessary(val);
+            dst[first + i] = val;
+         }
       }
-      ByteSwapIfNecessary(val);
-      dst[i] = val;
    }
 }
 
@@ -209,13 +296,16 @@ inline void CastDeltaSplitUnpack(void *destination, const void *source, std::siz
    constexpr std::size_t N = sizeof(SourceT);
    auto splitArray = reinterpret_cast<const char *>(source);
    auto dst = reinterpret_cast<DestT *>(destination);
-   for (std::size_t i = 0; i < count; ++i) {
-      SourceT val = 0;
-      for (std::size_t b = 0; b < N; ++b) {
-         reinterpret_cast<char *>(&val)[b] = splitArray[b * count + i];
+   SourceT buffer[kUnsplitBlockSize];
+   for (std::size_t first = 0; first < count; first += kUnsplitBlockSize) {
+      const auto nElements = std::min(kUnsplitBlockSize, count - first);
+      UnsplitBytes<N>(buffer, splitArray + first, nElements, count);
+      for (std::size_t i = 0; i < nElements; ++i) {
+         SourceT val = buffer[i];
+         ByteSwapIfNecessary(val);
+         const auto idx = first + i;
+         dst[idx] = (idx == 0) ? val : dst[idx - 1] + val;
       }
-      ByteSwapIfNecessary(val);
-      dst[i] = (i == 0) ? val : dst[i - 1] + val;
    }
 }
 
@@ -249,13 +339,15 @@ inline void CastZigzagSplitUnpack(void *destination, const void *source, std::si
    constexpr std::size_t N = sizeof(SourceT);
    auto splitArray = reinterpret_cast<const char *>(source);
    auto dst = reinterpret_cast<DestT *>(destination);
-   for (std::size_t i = 0; i < count; ++i) {
-      USourceT val = 0;
-      for (std::size_t b = 0; b < N; ++b) {
-         reinterpret_cast<char *>(&val)[b] = splitArray[b * count + i];
+   USourceT buffer[kUnsplitBlockSize];
+   for (std::size_t first = 0; first < count; first += kUnsplitBlockSize) {
+      const auto nElements = std::min(kUnsplitBlockSize, count - first);
+      UnsplitBytes<N>(buffer, splitArray + first, nElements, count);
+      for (std::size_t i = 0; i < nElements; ++i) {
+         USourceT val = buffer[i];
+         ByteSwapIfNecessary(val);
+         dst[first + i] = static_cast<SourceT>((val >> 1) ^ -(static_cast<SourceT>(val) & 1));
       }
-      ByteSwapIfNecessary(val);
-      dst[i] = static_cast<SourceT>((val >> 1) ^ -(static_cast<SourceT>(val) & 1));
    }
 }
 } // namespace
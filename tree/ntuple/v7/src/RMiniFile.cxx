@@ -43,6 +43,9 @@
 #ifdef R__LINUX
 #include <fcntl.h>
 #endif
+#ifdef R__UNIX
+#include <unistd.h>
+#endif
 
 #ifndef R__LITTLE_ENDIAN
 #ifdef R__BYTESWAP
@@ -917,11 +920,12 @@ void ROOT::Experimental::Internal::RNTupleFileWriter::RFileSimple::Flush()
       memcpy(fBlock, fHeaderBlock, headerBlockSize);
    }
 
-   std::size_t retval = FSeek64(fFile, fBlockOffset, SEEK_SET);
+   std::size_t retval = FSeek64(fFile, fBlockDataOffset, SEEK_SET);
    if (retval)
       throw RException(R__FAIL(std::string("Seek failed: ") + strerror(errno)));
 
-   std::size_t lastBlockSize = fFilePos - fBlockOffset;
+   // Unbuffered writes are not used with Direct I/O, so fBlockDataOffset is aligned in this case
+   std::size_t lastBlockSize = fFilePos - fBlockDataOffset;
    R__ASSERT(lastBlockSize <= kBlockSize);
    if (fDirectIO) {
       // Round up to a multiple of kBlockAlign.
@@ -929,12 +933,12 @@ void ROOT::Experimental::Internal::RNTupleFileWriter::RFileSimple::Flush()
       lastBlockSize = (lastBlockSize / kBlockAlign) * kBlockAlign;
       R__ASSERT(lastBlockSize <= kBlockSize);
    }
-   retval = fwrite(fBlock, 1, lastBlockSize, fFile);
+   retval = fwrite(fBlock + (fBlockDataOffset - fBlockOffset), 1, lastBlockSize, fFile);
    if (retval != lastBlockSize)
       throw RException(R__FAIL(std::string("write failed: ") + strerror(errno)));
 
    // Write the (updated) header block, unless it was part of the write above.
-   if (fBlockOffset > 0) {
+   if (fBlockDataOffset > 0) {
       retval = FSeek64(fFile, 0, SEEK_SET);
       if (retval)
          throw RException(R__FAIL(std::string("Seek failed: ") + strerror(errno)));
@@ -967,23 +971,25 @@ void ROOT::Experimental::Internal::RNTupleFileWriter::RFileSimple::Write(const v
       memcpy(fHeaderBlock + fFilePos, buffer, headerBytes);
    }
 
-   R__ASSERT(fFilePos >= fBlockOffset);
+   R__ASSERT(fFilePos >= fBlockDataOffset);
 
    while (nbytes > 0) {
       std::uint64_t posInBlock = fFilePos % kBlockSize;
       std::uint64_t blockOffset = fFilePos - posInBlock;
       if (blockOffset != fBlockOffset) {
          // Write the block.
-         retval = FSeek64(fFile, fBlockOffset, SEEK_SET);
+         retval = FSeek64(fFile, fBlockDataOffset, SEEK_SET);
          if (retval)
             throw RException(R__FAIL(std::string("Seek failed: ") + strerror(errno)));
 
-         retval = fwrite(fBlock, 1, kBlockSize, fFile);
-         if (retval != kBlockSize)
+         const std::size_t blockDataSize = kBlockSize - (fBlockDataOffset - fBlockOffset);
+         retval = fwrite(fBlock + (fBlockDataOffset - fBlockOffset), 1, blockDataSize, fFile);
+         if (retval != blockDataSize)
             throw RException(R__FAIL(std::string("write failed: ") + strerror(errno)));
 
          // Null the buffer contents for good measure.
          memset(fBlock, 0, kBlockSize);
+         fBlockDataOffset = blockOffset;
       }
 
       fBlockOffset = blockOffset;
@@ -998,6 +1004,61 @@ void ROOT::Experimental::Internal::RNTupleFileWriter::RFileSimple::Write(const v
    }
 }
 
+void ROOT::Experimental::Internal::RNTupleFileWriter::RFileSimple::SkipUnbuffered(std::size_t nbytes)
+{
+   R__ASSERT(fFile);
+   R__ASSERT(!fDirectIO);
+   R__ASSERT(fFilePos >= kHeaderBlockSize);
+
+   // Write out the buffered data now: the rest of the block overlaps with the skipped range and would otherwise
+   // overwrite the unbuffered writes.
+   if (fFilePos > fBlockDataOffset) {
+      std::size_t retval = FSeek64(fFile, fBlockDataOffset, SEEK_SET);
+      if (retval)
+         throw RException(R__FAIL(std::string("Seek failed: ") + strerror(errno)));
+
+      const std::size_t blockDataSize = fFilePos - fBlockDataOffset;
+      retval = fwrite(fBlock + (fBlockDataOffset - fBlockOffset), 1, blockDataSize, fFile);
+      if (retval != blockDataSize)
+         throw RException(R__FAIL(std::string("write failed: ") + strerror(errno)));
+      // Make sure that the data is in the file before the skipped range gets written to the file descriptor
+      retval = fflush(fFile);
+      if (retval)
+         throw RException(R__FAIL(std::string("Flush failed: ") + strerror(errno)));
+   }
+
+   memset(fBlock, 0, kBlockSize);
+   fFilePos += nbytes;
+   fBlockOffset = fFilePos - (fFilePos % kBlockSize);
+   fBlockDataOffset = fFilePos;
+}
+
+void ROOT::Experimental::Internal::RNTupleFileWriter::RFileSimple::WriteUnbuffered(const void *buffer, size_t nbytes,
+                                                                                   std::uint64_t offset) const
+{
+#ifdef R__UNIX
+   R__ASSERT(fFile);
+   const int fd = fileno(fFile);
+   auto bytes = static_cast<const unsigned char *>(buffer);
+   while (nbytes > 0) {
+      auto retval = pwrite(fd, bytes, nbytes, offset);
+      if (retval < 0) {
+         if (errno == EINTR)
+            continue;
+         throw RException(R__FAIL(std::string("pwrite failed: ") + strerror(errno)));
+      }
+      bytes += retval;
+      nbytes -= retval;
+      offset += retval;
+   }
+#else
+   (void)buffer;
+   (void)nbytes;
+   (void)offset;
+   throw RException(R__FAIL("unbuffered writes are not supported on this platform"));
+#endif
+}
+
 std::uint64_t ROOT::Experimental::Internal::RNTupleFileWriter::RFileSimple::WriteKey(
    const void *buffer, std::size_t nbytes, std::size_t len, std::int64_t offset, std::uint64_t directoryOffset,
    const std::string &className, const std::string &objectName, const std::string &title)
@@ -1293,6 +1354,33 @@ void ROOT::Experimental::Internal::RNTupleFileWriter::WriteIntoReservedBlob(cons
    }
 }
 
+bool ROOT::Experimental::Internal::RNTupleFileWriter::CanWriteConcurrently() const
+{
+#ifdef R__UNIX
+   // The header block is kept in memory and rewritten on commit, so reserved records must not overlap with it
+   return fFileSimple && !fFileSimple.fDirectIO && (fFileSimple.fKeyOffset >= RFileSimple::kHeaderBlockSize);
+#else
+   return false;
+#endif
+}
+
+std::uint64_t ROOT::Experimental::Internal::RNTupleFileWriter::ReserveBlobConcurrent(size_t nbytes, size_t len)
+{
+   R__ASSERT(CanWriteConcurrently());
+   auto offset = ReserveBlob(nbytes, len);
+   // For bare files, ReserveBlob() did not touch the stream; for ROOT files, it wrote the key header up to the offset
+   fFileSimple.fFilePos = offset;
+   fFileSimple.SkipUnbuffered(nbytes);
+   return offset;
+}
+
+void ROOT::Experimental::Internal::RNTupleFileWriter::WriteIntoReservedBlobConcurrent(const void *buffer,
+                                                                                      size_t nbytes,
+                                                                                      std::uint64_t offset) const
+{
+   fFileSimple.WriteUnbuffered(buffer, nbytes, offset);
+}
+
 std::uint64_t
 ROOT::Experimental::Internal::RNTupleFileWriter::WriteNTupleHeader(const void *data, size_t nbytes, size_t lenHeader)
 {
@@ -71,20 +71,33 @@ void ROOT::Experimental::RNTupleFillContext::FlushCluster()
       Internal::CallCommitClusterOnField(field);
    }
    auto nEntriesInCluster = fNEntries - fLastFlushed;
+   std::uint64_t nBytesZipped;
    if (fStagedClusterCommitting) {
       auto stagedCluster = fSink->StageCluster(nEntriesInCluster);
-      fNBytesFlushed += stagedCluster.fNBytesWritten;
+      nBytesZipped = stagedCluster.fNBytesWritten;
       fStagedClusters.push_back(std::move(stagedCluster));
    } else {
-      fNBytesFlushed += fSink->CommitCluster(nEntriesInCluster);
+      nBytesZipped = fSink->CommitCluster(nEntriesInCluster);
    }
+   fNBytesFlushed += nBytesZipped;
    fNBytesFilled += fUnzippedClusterSize;
 
    // Cap the compression factor at 1000 to prevent overflow of fUnzippedClusterSizeEst
-   const float compressionFactor =
-      std::min(1000.f, static_cast<float>(fNBytesFilled) / static_cast<float>(fNBytesFlushed));
-   fUnzippedClusterSizeEst =
-      compressionFactor * static_cast<float>(fSink->GetWriteOptions().GetApproxZippedClusterSize());
+   const auto &writeOpts = fSink->GetWriteOptions();
+   float compressionFactor;
+   if (writeOpts.GetClusterSizing() == RNTupleWriteOptions::EClusterSizing::kAdaptive) {
+      const float clusterCompressionFactor =
+         std::min(1000.f, static_cast<float>(fUnzippedClusterSize) /
+                             static_cast<float>(std::max<std::uint64_t>(1, nBytesZipped)));
+      // Exponential moving average that halves the weight of a cluster with every newly committed cluster
+      fCompressionFactorAvg = (fCompressionFactorAvg == 0)
+                                 ? clusterCompressionFactor
+                                 : 0.5f * (fCompressionFactorAvg + clusterCompressionFactor);
+      compressionFactor = fCompressionFactorAvg;
+   } else {
+      compressionFactor = std::min(1000.f, static_cast<float>(fNBytesFilled) / static_cast<float>(fNBytesFlushed));
+   }
+   fUnzippedClusterSizeEst = compressionFactor * static_cast<float>(writeOpts.GetApproxZippedClusterSize());
 
    fLastFlushed = fNEntries;
    fUnzippedClusterSize = 0;
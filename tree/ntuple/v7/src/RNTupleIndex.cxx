@@ -14,6 +14,9 @@
  *************************************************************************/
 
 #include <ROOT/RNTupleIndex.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleReader.hxx>
+#include <ROOT/RNTupleWriter.hxx>
 
 namespace {
 ROOT::Experimental::Internal::RNTupleIndex::NTupleIndexValue_t
@@ -31,6 +34,11 @@ CastValuePtr(void *valuePtr, const ROOT::Experimental::RFieldBase &field)
 
    return value;
 }
+
+std::string GetPersistedKeyFieldName(std::size_t i)
+{
+   return "_key" + std::to_string(i);
+}
 } // anonymous namespace
 
 ROOT::Experimental::Internal::RNTupleIndex::RNTupleIndex(const std::vector<std::string> &fieldNames,
@@ -74,11 +82,104 @@ ROOT::Experimental::Internal::RNTupleIndex::Create(const std::vector<std::string
    return index;
 }
 
+std::unique_ptr<ROOT::Experimental::Internal::RNTupleIndex>
+ROOT::Experimental::Internal::RNTupleIndex::Open(const std::vector<std::string> &fieldNames,
+                                                 const RPageSource &pageSource, std::string_view indexName,
+                                                 std::string_view storage, bool deferBuild)
+{
+   auto index = std::unique_ptr<RNTupleIndex>(new RNTupleIndex(fieldNames, pageSource));
+   index->fPersistedName = std::string(indexName);
+   index->fPersistedStorage = std::string(storage);
+
+   if (!deferBuild)
+      index->Build();
+
+   return index;
+}
+
+void ROOT::Experimental::Internal::RNTupleIndex::Load()
+{
+   auto reader = RNTupleReader::Open(fPersistedName, fPersistedStorage);
+   if (reader->GetNEntries() != fPageSource->GetNEntries()) {
+      throw RException(R__FAIL("persisted index \"" + fPersistedName + "\" has " +
+                               std::to_string(reader->GetNEntries()) + " entries but the indexed RNTuple has " +
+                               std::to_string(fPageSource->GetNEntries())));
+   }
+
+   std::vector<RNTupleView<NTupleIndexValue_t, false>> keyViews;
+   keyViews.reserve(fIndexFields.size());
+   {
+      const auto &desc = reader->GetDescriptor();
+      for (std::size_t i = 0; i < fIndexFields.size(); ++i) {
+         const auto keyFieldName = GetPersistedKeyFieldName(i);
+         const auto fieldId = desc.FindFieldId(keyFieldName);
+         if (fieldId == kInvalidDescriptorId ||
+             desc.GetFieldDescriptor(fieldId).GetFieldDescription() != fIndexFields[i]->GetFieldName()) {
+            throw RException(R__FAIL("persisted index \"" + fPersistedName + "\" does not index field \"" +
+                                     fIndexFields[i]->GetFieldName() + "\" at position " + std::to_string(i)));
+         }
+      }
+      if (desc.FindFieldId(GetPersistedKeyFieldName(fIndexFields.size())) != kInvalidDescriptorId)
+         throw RException(R__FAIL("persisted index \"" + fPersistedName + "\" has more index fields than requested"));
+   }
+   for (std::size_t i = 0; i < fIndexFields.size(); ++i)
+      keyViews.emplace_back(reader->GetView<NTupleIndexValue_t>(GetPersistedKeyFieldName(i)));
+   auto entryView = reader->GetView<NTupleSize_t>("_entry");
+
+   // Entries with the same index value are stored consecutively, so that every index value is hashed only once
+   std::vector<NTupleIndexValue_t> indexValues(fIndexFields.size());
+   std::vector<NTupleSize_t> *entryNumbers = nullptr;
+   for (auto i : reader->GetEntryRange()) {
+      bool isNewValue = (entryNumbers == nullptr);
+      for (std::size_t j = 0; j < keyViews.size(); ++j) {
+         const auto value = keyViews[j](i);
+         if (value != indexValues[j]) {
+            indexValues[j] = value;
+            isNewValue = true;
+         }
+      }
+      if (isNewValue)
+         entryNumbers = &fIndex[RIndexValue(indexValues)];
+      entryNumbers->push_back(entryView(i));
+   }
+
+   fIsBuilt = true;
+}
+
+void ROOT::Experimental::Internal::RNTupleIndex::Write(std::string_view indexName, TFile &file) const
+{
+   EnsureBuilt();
+
+   auto model = RNTupleModel::Create();
+   std::vector<std::shared_ptr<NTupleIndexValue_t>> keyPtrs;
+   keyPtrs.reserve(fIndexFields.size());
+   for (std::size_t i = 0; i < fIndexFields.size(); ++i) {
+      keyPtrs.emplace_back(
+         model->MakeField<NTupleIndexValue_t>({GetPersistedKeyFieldName(i), fIndexFields[i]->GetFieldName()}));
+   }
+   auto entryPtr = model->MakeField<NTupleSize_t>("_entry");
+
+   auto writer = RNTupleWriter::Append(std::move(model), indexName, file);
+   for (const auto &[indexValue, entryNumbers] : fIndex) {
+      for (std::size_t i = 0; i < keyPtrs.size(); ++i)
+         *keyPtrs[i] = indexValue.fFieldValues[i];
+      for (const auto entryNumber : entryNumbers) {
+         *entryPtr = entryNumber;
+         writer->Fill();
+      }
+   }
+}
+
 void ROOT::Experimental::Internal::RNTupleIndex::Build()
 {
    if (fIsBuilt)
       return;
 
+   if (!fPersistedName.empty()) {
+      Load();
+      return;
+   }
+
    static const std::unordered_set<std::string> allowedTypes = {"std::int8_t",   "std::int16_t", "std::int32_t",
                                                                 "std::int64_t",  "std::uint8_t", "std::uint16_t",
                                                                 "std::uint32_t", "std::uint64_t"};
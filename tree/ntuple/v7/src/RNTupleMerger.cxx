@@ -384,19 +384,24 @@ void RNTupleMerger::MergeCommonColumns(RClusterPool &clusterPool, DescriptorId_t
 
    const auto &clusterDesc = mergeData.fSrcDescriptor->GetClusterDescriptor(clusterId);
 
+   // The column elements are referenced by the compression tasks, which may run until the end of the function
+   std::vector<std::unique_ptr<RColumnElementBase>> colElements;
+   colElements.reserve(2 * commonColumns.size());
+
    for (const auto &column : commonColumns) {
       const auto &columnId = column.fInputId;
       R__ASSERT(clusterDesc.ContainsColumn(columnId));
 
       const auto &columnDesc = mergeData.fSrcDescriptor->GetColumnDescriptor(columnId);
-      const auto srcColElement = RColumnElementBase::Generate(columnDesc.GetType());
-      const auto dstColElement = RColumnElementBase::Generate(column.fColumnType);
+      const auto &srcColElement = colElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetType()));
+      const auto &dstColElement = colElements.emplace_back(RColumnElementBase::Generate(column.fColumnType));
 
       // Now get the pages for this column in this cluster
       const auto &pages = clusterDesc.GetPageRange(columnId);
 
-      RPageStorage::SealedPageSequence_t sealedPages;
-      sealedPages.resize(pages.fPageInfos.size());
+      // The sealed pages are updated in place by the compression tasks. They are stored in a std::deque, so the
+      // references to them stay valid while the pages of the next columns are added.
+      auto &sealedPages = sealedPageData.fPagesV.emplace_back(pages.fPageInfos.size());
 
       // Each column range potentially has a distinct compression settings
       const auto colRangeCompressionSettings = clusterDesc.GetColumnRange(columnId).fCompressionSettings;
@@ -451,13 +456,13 @@ void RNTupleMerger::MergeCommonColumns(RClusterPool &clusterPool, DescriptorId_t
 
       } // end of loop over pages
 
-      if (fTaskGroup)
-         fTaskGroup->Wait();
-
-      sealedPageData.fPagesV.push_back(std::move(sealedPages));
-      sealedPageData.fGroups.emplace_back(column.fOutputId, sealedPageData.fPagesV.back().cbegin(),
-                                          sealedPageData.fPagesV.back().cend());
+      sealedPageData.fGroups.emplace_back(column.fOutputId, sealedPages.cbegin(), sealedPages.cend());
    } // end loop over common columns
+
+   // Wait only once for the pages of all the columns, so that the recompression of the different columns of the
+   // cluster runs in parallel
+   if (fTaskGroup)
+      fTaskGroup->Wait();
 }
 
 // Generates default values for columns that are not present in the current source RNTuple
@@ -538,7 +543,9 @@ static void GenerateExtraDstColumns(size_t nClusterEntries, std::span<RColumnInf
 void RNTupleMerger::MergeSourceClusters(RPageSource &source, std::span<RColumnInfo> commonColumns,
                                         std::span<RColumnInfo> extraDstColumns, RNTupleMergeData &mergeData)
 {
-   RClusterPool clusterPool{source};
+   // The pages of several clusters are fetched with a single vector read; the I/O thread of the cluster pool reads
+   // the next bunch of clusters while the pages of the current one are being copied into the destination.
+   RClusterPool clusterPool{source, std::max(source.GetReadOptions().GetClusterBunchSize(), kMergeClusterBunchSize)};
 
    // Convert columns to a ColumnSet for the ClusterPool query
    RCluster::ColumnSet_t commonColumnSet;
@@ -677,6 +684,14 @@ RNTupleMerger::Merge(std::span<RPageSource *> sources, RPageSink &destination, c
       }                                                                              \
    } while (0)
 
+   // Reading and decompressing the header, footer and page list of the sources is independent of the merging
+   // itself and can be done for all sources concurrently. The sources are then merged in order.
+   if (fTaskGroup && sources.size() > 1) {
+      for (RPageSource *source : sources)
+         fTaskGroup->Run([source] { source->Attach(); });
+      fTaskGroup->Wait();
+   }
+
    // Merge main loop
    for (RPageSource *source : sources) {
       source->Attach();
@@ -15,10 +15,79 @@
 
 #include <ROOT/RNTupleMetrics.hxx>
 
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
 #include <ostream>
+#include <sstream>
 
 #include <iostream>
 
+namespace {
+
+std::string EscapeJSON(const std::string &str)
+{
+   std::string result;
+   result.reserve(str.size());
+   for (const char c : str) {
+      switch (c) {
+      case '"': result += "\\\""; break;
+      case '\\': result += "\\\\"; break;
+      case '\n': result += "\\n"; break;
+      case '\t': result += "\\t"; break;
+      default:
+         if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned char>(c));
+            result += buf;
+         } else {
+            result += c;
+         }
+      }
+   }
+   return result;
+}
+
+/// Prometheus label values use the same escaping as JSON strings for backslash, double quote, and new line
+std::string EscapeLabelValue(const std::string &str)
+{
+   std::string result;
+   result.reserve(str.size());
+   for (const char c : str) {
+      switch (c) {
+      case '"': result += "\\\""; break;
+      case '\\': result += "\\\\"; break;
+      case '\n': result += "\\n"; break;
+      default: result += c;
+      }
+   }
+   return result;
+}
+
+/// Metric names must match [a-zA-Z_:][a-zA-Z0-9_:]*
+std::string SanitizeMetricName(const std::string &str)
+{
+   std::string result;
+   result.reserve(str.size());
+   for (const char c : str) {
+      result += std::isalnum(static_cast<unsigned char>(c)) ? c : '_';
+   }
+   return result;
+}
+
+/// Counter values are either integral or floating point numbers; non-finite values are reported as NaN
+bool IsFiniteNumber(const std::string &value)
+{
+   if (value.empty())
+      return false;
+   char *end = nullptr;
+   const double d = std::strtod(value.c_str(), &end);
+   return (*end == '\0') && std::isfinite(d);
+}
+
+} // anonymous namespace
+
 ROOT::Experimental::Detail::RNTuplePerfCounter::~RNTuplePerfCounter()
 {
 }
@@ -78,6 +147,20 @@ void ROOT::Experimental::Detail::RNTupleMetrics::Print(std::ostream &output, con
    }
 }
 
+void ROOT::Experimental::Detail::RNTupleMetrics::ForEachCounter(
+   const std::function<void(const std::string &, const RNTuplePerfCounter &)> &func, const std::string &prefix) const
+{
+   if (!fIsEnabled)
+      return;
+
+   for (const auto &c : fCounters) {
+      func(prefix + fName + kNamespaceSeperator + c->GetName(), *c);
+   }
+   for (const auto c : fObservedMetrics) {
+      c->ForEachCounter(func, prefix + fName + ".");
+   }
+}
+
 void ROOT::Experimental::Detail::RNTupleMetrics::Enable()
 {
    for (auto &c: fCounters)
@@ -91,3 +174,121 @@ void ROOT::Experimental::Detail::RNTupleMetrics::ObserveMetrics(RNTupleMetrics &
 {
    fObservedMetrics.push_back(&observee);
 }
+
+ROOT::Experimental::Detail::RNTupleMetricsRegistry::RRegistration &
+ROOT::Experimental::Detail::RNTupleMetricsRegistry::RRegistration::operator=(RRegistration &&other)
+{
+   if (this == &other)
+      return *this;
+   if (fId != 0)
+      RNTupleMetricsRegistry::Instance().Unregister(fId);
+   fId = other.fId;
+   other.fId = 0;
+   return *this;
+}
+
+ROOT::Experimental::Detail::RNTupleMetricsRegistry::RRegistration::~RRegistration()
+{
+   if (fId != 0)
+      RNTupleMetricsRegistry::Instance().Unregister(fId);
+}
+
+ROOT::Experimental::Detail::RNTupleMetricsRegistry &ROOT::Experimental::Detail::RNTupleMetricsRegistry::Instance()
+{
+   static RNTupleMetricsRegistry instance;
+   return instance;
+}
+
+ROOT::Experimental::Detail::RNTupleMetricsRegistry::RRegistration
+ROOT::Experimental::Detail::RNTupleMetricsRegistry::Register(const RNTupleMetrics &metrics,
+                                                             std::string_view ntupleName)
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   const auto id = ++fLastId;
+   fEntries[id] = REntry{&metrics, std::string(ntupleName)};
+   return RRegistration(id);
+}
+
+void ROOT::Experimental::Detail::RNTupleMetricsRegistry::Unregister(std::uint64_t id)
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   fEntries.erase(id);
+}
+
+std::size_t ROOT::Experimental::Detail::RNTupleMetricsRegistry::GetNRegistered()
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   return fEntries.size();
+}
+
+std::string ROOT::Experimental::Detail::RNTupleMetricsRegistry::ToJSON()
+{
+   std::lock_guard<std::mutex> guard(fLock);
+
+   std::ostringstream os;
+   os << "[";
+   bool isFirstEntry = true;
+   for (const auto &[id, entry] : fEntries) {
+      if (!isFirstEntry)
+         os << ",";
+      isFirstEntry = false;
+      os << "{\"id\":" << id << ",\"ntuple\":\"" << EscapeJSON(entry.fNTupleName) << "\",\"counters\":[";
+      bool isFirstCounter = true;
+      entry.fMetrics->ForEachCounter([&](const std::string &name, const RNTuplePerfCounter &counter) {
+         if (!isFirstCounter)
+            os << ",";
+         isFirstCounter = false;
+         const auto value = counter.GetValueAsString();
+         os << "{\"name\":\"" << EscapeJSON(name) << "\",\"unit\":\"" << EscapeJSON(counter.GetUnit())
+            << "\",\"description\":\"" << EscapeJSON(counter.GetDescription())
+            << "\",\"value\":" << (IsFiniteNumber(value) ? value : "null") << "}";
+      });
+      os << "]}";
+   }
+   os << "]";
+   return os.str();
+}
+
+std::string ROOT::Experimental::Detail::RNTupleMetricsRegistry::ToPrometheus()
+{
+   std::lock_guard<std::mutex> guard(fLock);
+
+   // Samples of the same metric from different registrations must be grouped after a single HELP and TYPE line
+   struct RMetricFamily {
+      std::string fHelp;
+      std::vector<std::string> fSamples;
+   };
+   std::map<std::string, RMetricFamily> families;
+   for (const auto &[id, entry] : fEntries) {
+      const std::string labels =
+         "{id=\"" + std::to_string(id) + "\",ntuple=\"" + EscapeLabelValue(entry.fNTupleName) + "\"}";
+      entry.fMetrics->ForEachCounter([&](const std::string &name, const RNTuplePerfCounter &counter) {
+         std::string metricName = "rntuple_" + SanitizeMetricName(name);
+         if (!counter.GetUnit().empty())
+            metricName += "_" + SanitizeMetricName(counter.GetUnit());
+         auto &family = families[metricName];
+         if (family.fHelp.empty())
+            family.fHelp = counter.GetDescription();
+         const auto value = counter.GetValueAsString();
+         family.fSamples.emplace_back(metricName + labels + " " + (IsFiniteNumber(value) ? value : "NaN"));
+      });
+   }
+
+   std::ostringstream os;
+   for (const auto &[metricName, family] : families) {
+      std::string help;
+      for (const char c : family.fHelp) {
+         if (c == '\\')
+            help += "\\\\";
+         else if (c == '\n')
+            help += "\\n";
+         else
+            help += c;
+      }
+      os << "# HELP " << metricName << " " << help << "\n";
+      os << "# TYPE " << metricName << " gauge\n";
+      for (const auto &sample : family.fSamples)
+         os << sample << "\n";
+   }
+   return os.str();
+}
@@ -35,6 +35,7 @@ using ROOT::Experimental::Internal::RColumn;
 using ROOT::Experimental::Internal::RNTupleModelChangeset;
 using ROOT::Experimental::Internal::RPage;
 using ROOT::Experimental::Internal::RPageSink;
+using ROOT::Experimental::Internal::RPageSinkFile;
 
 /// An internal RPageSink that enables multiple RNTupleFillContext to write into a single common RPageSink.
 ///
@@ -54,15 +55,26 @@ using ROOT::Experimental::Internal::RPageSink;
 /// The mutex used by the synchronizing sinks is owned by the RNTupleParallelWriter that also owns the original model,
 /// the "final" sink (usually a persistent sink) and keeps weak_ptr's of the contexts (to make sure they are destroyed
 /// before the writer is destructed).
+///
+/// If the final sink is an RPageSinkFile in deferred mode, committing sealed pages under the mutex only reserves the
+/// storage for the pages. The page data is written by WriteDeferredPages() after releasing the mutex, so that the
+/// contexts write their clusters concurrently.
 class RPageSynchronizingSink : public RPageSink {
 private:
    /// The wrapped inner sink, not owned by this class.
    RPageSink *fInnerSink;
+   /// Set if the inner sink is a file sink, which supports deferred writes.
+   RPageSinkFile *fInnerFileSink;
    std::mutex *fMutex;
+   /// The sealed pages that the inner sink reserved storage for but did not write yet.
+   std::vector<RPageSinkFile::RDeferredWrite> fDeferredWrites;
 
 public:
    explicit RPageSynchronizingSink(RPageSink &inner, std::mutex &mutex)
-      : RPageSink(inner.GetNTupleName(), inner.GetWriteOptions()), fInnerSink(&inner), fMutex(&mutex)
+      : RPageSink(inner.GetNTupleName(), inner.GetWriteOptions()),
+        fInnerSink(&inner),
+        fInnerFileSink(dynamic_cast<RPageSinkFile *>(&inner)),
+        fMutex(&mutex)
    {
       // Do not observe the sink's metrics: It will contain some counters for all threads, which is misleading for the
       // users.
@@ -96,6 +108,10 @@ public:
    void CommitSealedPageV(std::span<RPageStorage::RSealedPageGroup> ranges) final
    {
       fInnerSink->CommitSealedPageV(ranges);
+      if (fInnerFileSink) {
+         auto deferredWrites = fInnerFileSink->ReleaseDeferredWrites();
+         fDeferredWrites.insert(fDeferredWrites.end(), deferredWrites.begin(), deferredWrites.end());
+      }
    }
    std::uint64_t CommitCluster(NTupleSize_t nNewEntries) final { return fInnerSink->CommitCluster(nNewEntries); }
    RStagedCluster StageCluster(NTupleSize_t nNewEntries) final { return fInnerSink->StageCluster(nNewEntries); }
@@ -110,6 +126,14 @@ public:
    }
 
    RSinkGuard GetSinkGuard() final { return RSinkGuard(fMutex); }
+
+   void WriteDeferredPages() final
+   {
+      if (fDeferredWrites.empty())
+         return;
+      fInnerFileSink->WriteDeferred(fDeferredWrites);
+      fDeferredWrites.clear();
+   }
 };
 
 } // namespace
@@ -121,6 +145,9 @@ ROOT::Experimental::RNTupleParallelWriter::RNTupleParallelWriter(std::unique_ptr
    fModel->Freeze();
    fSink->Init(*fModel.get());
    fMetrics.ObserveMetrics(fSink->GetMetrics());
+   // Only reserve storage for the pages while holding the sink mutex, see RPageSynchronizingSink
+   if (auto fileSink = dynamic_cast<Internal::RPageSinkFile *>(fSink.get()))
+      fileSink->SetDeferWrites(true);
 }
 
 ROOT::Experimental::RNTupleParallelWriter::~RNTupleParallelWriter()
@@ -167,6 +194,14 @@ ROOT::Experimental::RNTupleParallelWriter::Append(std::unique_ptr<RNTupleModel>
    return std::unique_ptr<RNTupleParallelWriter>(new RNTupleParallelWriter(std::move(model), std::move(sink)));
 }
 
+void ROOT::Experimental::RNTupleParallelWriter::EnableMetrics()
+{
+   std::lock_guard g(fMutex);
+   fMetrics.Enable();
+   if (!fMetricsRegistration)
+      fMetricsRegistration = Detail::RNTupleMetricsRegistry::Instance().Register(fMetrics, fSink->GetNTupleName());
+}
+
 std::shared_ptr<ROOT::Experimental::RNTupleFillContext> ROOT::Experimental::RNTupleParallelWriter::CreateFillContext()
 {
    std::lock_guard g(fMutex);
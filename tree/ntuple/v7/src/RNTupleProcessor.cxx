@@ -16,15 +16,44 @@
 #include <ROOT/RNTupleProcessor.hxx>
 
 #include <ROOT/RFieldBase.hxx>
+#include <ROOT/RSlotStack.hxx>
+#include <ROOT/TSeq.hxx>
+
+#ifdef R__USE_IMT
+#include <ROOT/TThreadExecutor.hxx>
+#endif
+
+#include <algorithm>
+#include <utility>
+
+void ROOT::Experimental::Internal::RNTupleProcessor::PrefetchNTuple(std::size_t ntupleIndex)
+{
+   if (ntupleIndex >= fNTuples.size())
+      return;
+
+   fNextNTupleIndex = ntupleIndex;
+   fNextPageSource = std::async(std::launch::async, [ntuple = fNTuples[ntupleIndex]]() {
+      auto source = Internal::RPageSource::Create(ntuple.fName, ntuple.fLocation);
+      source->Attach();
+      return source;
+   });
+}
 
 ROOT::Experimental::NTupleSize_t
-ROOT::Experimental::Internal::RNTupleProcessor::ConnectNTuple(const RNTupleSourceSpec &ntuple)
+ROOT::Experimental::Internal::RNTupleProcessor::ConnectNTuple(std::size_t ntupleIndex)
 {
    for (auto &fieldContext : fFieldContexts) {
       fieldContext.ResetConcreteField();
    }
-   fPageSource = Internal::RPageSource::Create(ntuple.fName, ntuple.fLocation);
-   fPageSource->Attach();
+   if (fNextPageSource.valid() && fNextNTupleIndex == ntupleIndex) {
+      // Rethrows the errors of opening the RNTuple
+      fPageSource = fNextPageSource.get();
+   } else {
+      const auto &ntuple = fNTuples.at(ntupleIndex);
+      fPageSource = Internal::RPageSource::Create(ntuple.fName, ntuple.fLocation);
+      fPageSource->Attach();
+   }
+   PrefetchNTuple(ntupleIndex + 1);
    ConnectFields();
    return fPageSource->GetNEntries();
 }
@@ -87,4 +116,112 @@ ROOT::Experimental::Internal::RNTupleProcessor::RNTupleProcessor(const std::vect
    }
 
    ConnectFields();
+   fModel = std::move(model);
+   PrefetchNTuple(1);
+}
+
+void ROOT::Experimental::Internal::RNTupleProcessor::ProcessParallel(
+   const std::function<void(unsigned int, const RIterator::RProcessorState &)> &func, unsigned int nThreads)
+{
+#ifdef R__USE_IMT
+   ROOT::TThreadExecutor executor(nThreads);
+   const auto nSlots = executor.GetPoolSize();
+
+   // The cluster boundaries of every RNTuple, as pairs of first entry and number of entries
+   std::vector<std::vector<std::pair<NTupleSize_t, NTupleSize_t>>> clusterRanges(fNTuples.size());
+   executor.Foreach(
+      [&](unsigned int ntupleIndex) {
+         auto source = Internal::RPageSource::Create(fNTuples[ntupleIndex].fName, fNTuples[ntupleIndex].fLocation);
+         source->Attach();
+         auto desc = source->GetSharedDescriptorGuard();
+         for (const auto &clusterDesc : desc->GetClusterIterable()) {
+            clusterRanges[ntupleIndex].emplace_back(clusterDesc.GetFirstEntryIndex(), clusterDesc.GetNEntries());
+         }
+         std::sort(clusterRanges[ntupleIndex].begin(), clusterRanges[ntupleIndex].end());
+      },
+      ROOT::TSeqU(fNTuples.size()));
+
+   NTupleSize_t nEntriesTotal = 0;
+   for (const auto &ranges : clusterRanges) {
+      for (const auto &r : ranges)
+         nEntriesTotal += r.second;
+   }
+   if (nEntriesTotal == 0)
+      return;
+
+   struct RTask {
+      std::size_t fNTupleIndex = 0;
+      NTupleSize_t fGlobalEntryOffset = 0;
+      NTupleSize_t fFirstEntry = 0;
+      NTupleSize_t fNEntries = 0;
+   };
+   // Aim at a few tasks per slot for load balancing; tasks never cross RNTuple boundaries
+   const NTupleSize_t nEntriesPerTask = std::max<NTupleSize_t>(1, nEntriesTotal / (4 * nSlots));
+   std::vector<RTask> tasks;
+   NTupleSize_t globalEntryOffset = 0;
+   for (std::size_t i = 0; i < clusterRanges.size(); ++i) {
+      RTask task;
+      for (const auto &[firstEntry, nEntries] : clusterRanges[i]) {
+         if (task.fNEntries == 0) {
+            task.fNTupleIndex = i;
+            task.fGlobalEntryOffset = globalEntryOffset;
+            task.fFirstEntry = firstEntry;
+         }
+         task.fNEntries += nEntries;
+         globalEntryOffset += nEntries;
+         if (task.fNEntries >= nEntriesPerTask) {
+            tasks.emplace_back(task);
+            task = RTask();
+         }
+      }
+      if (task.fNEntries > 0)
+         tasks.emplace_back(task);
+   }
+
+   std::vector<std::unique_ptr<REntry>> slotEntries;
+   for (unsigned int i = 0; i < nSlots; ++i)
+      slotEntries.emplace_back(fModel->CreateEntry());
+   ROOT::Internal::RSlotStack slotStack(nSlots);
+
+   executor.Foreach(
+      [&](const RTask &task) {
+         ROOT::Internal::RSlotStackRAII slotGuard(slotStack);
+         auto &entry = *slotEntries[slotGuard.fSlot];
+
+         const auto &ntuple = fNTuples[task.fNTupleIndex];
+         auto source = Internal::RPageSource::Create(ntuple.fName, ntuple.fLocation);
+         source->Attach();
+         source->SetEntryRange({task.fFirstEntry, task.fNEntries});
+
+         std::vector<std::unique_ptr<RFieldBase>> fields;
+         {
+            auto desc = source->GetSharedDescriptorGuard();
+            for (const auto &fieldContext : fFieldContexts) {
+               const auto &fieldName = fieldContext.GetProtoField().GetFieldName();
+               auto fieldId = desc->FindFieldId(fieldName);
+               if (fieldId == kInvalidDescriptorId)
+                  throw RException(R__FAIL("field \"" + fieldName + "\" not found in RNTuple " + ntuple.fName));
+               fields.emplace_back(fieldContext.GetProtoField().Clone(fieldName));
+               fields.back()->SetOnDiskId(fieldId);
+            }
+         }
+         for (std::size_t i = 0; i < fields.size(); ++i) {
+            Internal::CallConnectPageSourceOnField(*fields[i], *source);
+            auto value = fields[i]->CreateValue();
+            value.Bind(entry.GetPtr<void>(fFieldContexts[i].fToken));
+            entry.UpdateValue(fFieldContexts[i].fToken, value);
+         }
+
+         for (NTupleSize_t i = task.fFirstEntry; i < task.fFirstEntry + task.fNEntries; ++i) {
+            entry.Read(i);
+            func(slotGuard.fSlot, RIterator::RProcessorState(
+                                     entry, task.fGlobalEntryOffset + (i - task.fFirstEntry), i, task.fNTupleIndex));
+         }
+      },
+      tasks);
+#else
+   (void)nThreads;
+   for (const auto &state : *this)
+      func(0, state);
+#endif
 }
@@ -133,6 +133,13 @@ const ROOT::Experimental::RNTupleModel &ROOT::Experimental::RNTupleReader::GetMo
    return *fModel;
 }
 
+void ROOT::Experimental::RNTupleReader::EnableMetrics()
+{
+   fMetrics.Enable();
+   if (!fMetricsRegistration)
+      fMetricsRegistration = Detail::RNTupleMetricsRegistry::Instance().Register(fMetrics, fSource->GetNTupleName());
+}
+
 void ROOT::Experimental::RNTupleReader::PrintInfo(const ENTupleInfo what, std::ostream &output) const
 {
    // TODO(lesimon): In a later version, these variables may be defined by the user or the ideal width may be read out
@@ -499,6 +499,20 @@ RResult<std::uint32_t> DeserializeAliasColumn(const void *buffer, std::uint64_t
    return frameSize;
 }
 
+std::uint64_t DoubleToBits(double val)
+{
+   std::uint64_t bits;
+   std::memcpy(&bits, &val, sizeof(bits));
+   return bits;
+}
+
+double BitsToDouble(std::uint64_t bits)
+{
+   double val;
+   std::memcpy(&val, &bits, sizeof(val));
+   return val;
+}
+
 } // anonymous namespace
 
 std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeXxHash3(const unsigned char *data,
@@ -1549,6 +1563,11 @@ ROOT::Experimental::Internal::RNTupleSerializer::SerializePageList(void *buffer,
             }
             pos += SerializeInt64(columnRange.fFirstElementIndex, *where);
             pos += SerializeUInt32(columnRange.fCompressionSettings, *where);
+            // The optional value range is appended to the frame, where readers that do not know about it skip it
+            if (columnRange.fValueRange) {
+               pos += SerializeUInt64(DoubleToBits(columnRange.fValueRange->fMin), *where);
+               pos += SerializeUInt64(DoubleToBits(columnRange.fValueRange->fMax), *where);
+            }
          }
 
          pos += SerializeFramePostscript(buffer ? innerFrame : nullptr, pos - innerFrame);
@@ -1871,7 +1890,14 @@ ROOT::Experimental::Internal::RNTupleSerializer::DeserializePageList(const void
                return R__FAIL("page list frame too short");
             std::uint32_t compressionSettings;
             bytes += DeserializeUInt32(bytes, compressionSettings);
-            clusterBuilders[i].CommitColumnRange(j, columnOffset, compressionSettings, pageRange);
+            std::optional<RClusterDescriptor::RValueRange> valueRange;
+            if (fnInnerFrameSizeLeft() >= static_cast<int>(2 * sizeof(std::uint64_t))) {
+               std::uint64_t minBits, maxBits;
+               bytes += DeserializeUInt64(bytes, minBits);
+               bytes += DeserializeUInt64(bytes, maxBits);
+               valueRange = RClusterDescriptor::RValueRange{BitsToDouble(minBits), BitsToDouble(maxBits)};
+            }
+            clusterBuilders[i].CommitColumnRange(j, columnOffset, compressionSettings, pageRange, valueRange);
          }
 
          bytes = innerFrame + innerFrameSize;
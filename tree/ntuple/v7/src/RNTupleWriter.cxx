@@ -96,6 +96,15 @@ ROOT::Experimental::RNTupleWriter::Append(std::unique_ptr<RNTupleModel> model, s
    return Create(std::move(model), std::move(sink), options);
 }
 
+void ROOT::Experimental::RNTupleWriter::EnableMetrics()
+{
+   fMetrics.Enable();
+   if (!fMetricsRegistration) {
+      fMetricsRegistration =
+         Detail::RNTupleMetricsRegistry::Instance().Register(fMetrics, fFillContext.fSink->GetNTupleName());
+   }
+}
+
 void ROOT::Experimental::RNTupleWriter::CommitClusterGroup()
 {
    if (GetNEntries() == fLastCommittedClusterGroup)
@@ -34,3 +34,71 @@ void ROOT::Experimental::Internal::RPageAllocatorHeap::DeletePage(RPage &page)
 {
    delete[] reinterpret_cast<unsigned char *>(page.GetBuffer());
 }
+
+ROOT::Experimental::Internal::RPageAllocatorPool::RPageAllocatorPool(std::size_t maxCachedBytes)
+   : fMaxCachedBytes(maxCachedBytes)
+{
+}
+
+ROOT::Experimental::Internal::RPageAllocatorPool::~RPageAllocatorPool()
+{
+   for (auto &freeList : fFreeBuffers) {
+      for (auto buffer : freeList)
+         delete[] buffer;
+   }
+}
+
+unsigned int ROOT::Experimental::Internal::RPageAllocatorPool::GetSizeClass(std::size_t nbytes)
+{
+   unsigned int sizeClass = 0;
+   std::size_t classSize = 1;
+   while (classSize < std::max(nbytes, kMinBufferSize)) {
+      classSize <<= 1;
+      sizeClass++;
+   }
+   return sizeClass;
+}
+
+ROOT::Experimental::Internal::RPage ROOT::Experimental::Internal::RPageAllocatorPool::NewPage(ColumnId_t columnId,
+                                                                                              std::size_t elementSize,
+                                                                                              std::size_t nElements)
+{
+   R__ASSERT((elementSize > 0) && (nElements > 0));
+   const auto sizeClass = GetSizeClass(elementSize * nElements);
+   unsigned char *buffer = nullptr;
+   {
+      std::lock_guard<std::mutex> guard(fLock);
+      if (sizeClass < fFreeBuffers.size() && !fFreeBuffers[sizeClass].empty()) {
+         buffer = fFreeBuffers[sizeClass].back();
+         fFreeBuffers[sizeClass].pop_back();
+         fCachedBytes -= std::size_t(1) << sizeClass;
+      }
+   }
+   if (!buffer)
+      buffer = new unsigned char[std::size_t(1) << sizeClass];
+   return RPage(columnId, buffer, this, elementSize, nElements);
+}
+
+void ROOT::Experimental::Internal::RPageAllocatorPool::DeletePage(RPage &page)
+{
+   auto buffer = reinterpret_cast<unsigned char *>(page.GetBuffer());
+   const auto sizeClass = GetSizeClass(page.GetCapacity());
+   const auto classSize = std::size_t(1) << sizeClass;
+   {
+      std::lock_guard<std::mutex> guard(fLock);
+      if (fCachedBytes + classSize <= fMaxCachedBytes) {
+         if (sizeClass >= fFreeBuffers.size())
+            fFreeBuffers.resize(sizeClass + 1);
+         fFreeBuffers[sizeClass].emplace_back(buffer);
+         fCachedBytes += classSize;
+         return;
+      }
+   }
+   delete[] buffer;
+}
+
+std::size_t ROOT::Experimental::Internal::RPageAllocatorPool::GetCachedBytes()
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   return fCachedBytes;
+}
@@ -140,6 +140,7 @@ void ROOT::Experimental::Internal::RPageSinkBuf::CommitPage(ColumnHandle_t colum
 {
    auto colId = columnHandle.fPhysicalId;
    const auto &element = *columnHandle.fColumn->GetElement();
+   const RColumn *column = GetWriteOptions().GetEnableValueRanges() ? columnHandle.fColumn : nullptr;
 
    // Safety: References are guaranteed to be valid until the element is destroyed. In other words, all buffered page
    // elements are valid until DropBufferedPages().
@@ -158,6 +159,8 @@ void ROOT::Experimental::Internal::RPageSinkBuf::CommitPage(ColumnHandle_t colum
       config.fAllowAlias = false;
       config.fBuffer = zipItem.fBuf.get();
       sealedPage = SealPage(config);
+      if (column)
+         sealedPage.SetValueRange(column->ComputeValueRange(page));
       zipItem.fSealedPage = &sealedPage;
       return;
    }
@@ -171,7 +174,7 @@ void ROOT::Experimental::Internal::RPageSinkBuf::CommitPage(ColumnHandle_t colum
    fCounters->fParallelZip.SetValue(1);
    // Thread safety: Each thread works on a distinct zipItem which owns its
    // compression buffer.
-   fTaskScheduler->AddTask([this, &zipItem, &sealedPage, &element] {
+   fTaskScheduler->AddTask([this, &zipItem, &sealedPage, &element, column] {
       RSealPageConfig config;
       config.fPage = &zipItem.fPage;
       config.fElement = &element;
@@ -179,7 +182,9 @@ void ROOT::Experimental::Internal::RPageSinkBuf::CommitPage(ColumnHandle_t colum
       config.fWriteChecksum = GetWriteOptions().GetEnablePageChecksums();
       config.fAllowAlias = true;
       config.fBuffer = zipItem.fBuf.get();
+      auto valueRange = column ? column->ComputeValueRange(zipItem.fPage) : std::nullopt;
       sealedPage = SealPage(config);
+      sealedPage.SetValueRange(valueRange);
       zipItem.fSealedPage = &sealedPage;
    });
 }
@@ -221,6 +226,8 @@ void ROOT::Experimental::Internal::RPageSinkBuf::FlushClusterImpl(std::function<
 
       FlushClusterFn();
    }
+   // Outside of the critical section, write the pages for which the inner sink only reserved storage
+   fInnerSink->WriteDeferredPages();
 
    for (auto &bufColumn : fBufferedColumns)
       bufColumn.DropBufferedPages();
@@ -137,6 +137,8 @@ bool ROOT::Experimental::Internal::RPageSource::REntryRange::IntersectsWith(cons
 ROOT::Experimental::Internal::RPageSource::RPageSource(std::string_view name, const RNTupleReadOptions &options)
    : RPageStorage(name), fOptions(options)
 {
+   if (fOptions.GetPageAllocator() == RNTupleReadOptions::EPageAllocator::kPool)
+      fPageAllocator = std::make_unique<RPageAllocatorPool>();
 }
 
 ROOT::Experimental::Internal::RPageSource::~RPageSource() {}
@@ -169,9 +171,30 @@ ROOT::Experimental::Internal::RPageSource::AddColumn(DescriptorId_t fieldId, RCo
       GetSharedDescriptorGuard()->FindPhysicalColumnId(fieldId, column.GetIndex(), column.GetRepresentationIndex());
    R__ASSERT(physicalId != kInvalidDescriptorId);
    fActivePhysicalColumns.Insert(physicalId);
+
+   if (!fOptions.GetOnDemandFields().empty()) {
+      const auto fieldName = GetSharedDescriptorGuard()->GetQualifiedFieldName(fieldId);
+      for (const auto &onDemandField : fOptions.GetOnDemandFields()) {
+         // the field itself or one of its subfields
+         if (fieldName.compare(0, onDemandField.size(), onDemandField) == 0 &&
+             (fieldName.size() == onDemandField.size() || fieldName[onDemandField.size()] == '.')) {
+            fOnDemandPhysicalColumns.insert(physicalId);
+            break;
+         }
+      }
+   }
    return ColumnHandle_t{physicalId, &column};
 }
 
+ROOT::Experimental::Internal::RCluster::ColumnSet_t
+ROOT::Experimental::Internal::RPageSource::GetClusterColumnSet() const
+{
+   auto columnSet = fActivePhysicalColumns.ToColumnSet();
+   for (auto columnId : fOnDemandPhysicalColumns)
+      columnSet.erase(columnId);
+   return columnSet;
+}
+
 void ROOT::Experimental::Internal::RPageSource::DropColumn(ColumnHandle_t columnHandle)
 {
    fActivePhysicalColumns.Erase(columnHandle.fPhysicalId);
@@ -631,7 +654,7 @@ ROOT::Experimental::Internal::RPageSink::SealPage(const RSealPageConfig &config)
 
    if ((config.fCompressionSetting != 0) || !config.fElement->IsMappable() || !config.fAllowAlias ||
        config.fWriteChecksum) {
-      nBytesZipped = RNTupleCompressor::Zip(pageBuf, nBytesPacked, config.fCompressionSetting, config.fBuffer);
+      nBytesZipped = RNTupleCompressor::ZipPage(pageBuf, nBytesPacked, config.fCompressionSetting, config.fBuffer);
       if (!isAdoptedBuffer)
          delete[] pageBuf;
       pageBuf = reinterpret_cast<unsigned char *>(config.fBuffer);
@@ -791,6 +814,7 @@ void ROOT::Experimental::Internal::RPagePersistentSink::UpdateSchema(const RNTup
       columnRange.fNElements = 0;
       columnRange.fCompressionSettings = GetWriteOptions().GetCompression();
       fOpenColumnRanges.emplace_back(columnRange);
+      fOpenValueRangesUnknown.emplace_back(false);
       RClusterDescriptor::RPageRange pageRange;
       pageRange.fPhysicalColumnId = i;
       fOpenPageRanges.emplace_back(std::move(pageRange));
@@ -861,7 +885,7 @@ void ROOT::Experimental::Internal::RPagePersistentSink::InitFromDescriptor(const
          const auto &pageRange = cluster.GetPageRange(i);
          R__ASSERT(pageRange.fPhysicalColumnId == i);
          clusterBuilder.CommitColumnRange(i, fOpenColumnRanges[i].fFirstElementIndex, columnRange.fCompressionSettings,
-                                          pageRange);
+                                          pageRange, columnRange.fValueRange);
          fOpenColumnRanges[i].fFirstElementIndex += columnRange.fNElements;
       }
       fDescriptorBuilder.AddCluster(clusterBuilder.MoveDescriptor().Unwrap());
@@ -876,9 +900,35 @@ void ROOT::Experimental::Internal::RPagePersistentSink::CommitSuppressedColumn(C
    fOpenColumnRanges.at(columnHandle.fPhysicalId).fIsSuppressed = true;
 }
 
+void ROOT::Experimental::Internal::RPagePersistentSink::UpdateValueRange(
+   DescriptorId_t physicalColumnId, std::uint32_t nElements,
+   const std::optional<RClusterDescriptor::RValueRange> &pageRange)
+{
+   if (nElements == 0)
+      return;
+   auto &columnRange = fOpenColumnRanges.at(physicalColumnId);
+   if (!pageRange) {
+      // The range of the column in the cluster is only known if it is known for all of its pages
+      fOpenValueRangesUnknown[physicalColumnId] = true;
+      columnRange.fValueRange.reset();
+      return;
+   }
+   if (fOpenValueRangesUnknown[physicalColumnId])
+      return;
+   if (!columnRange.fValueRange) {
+      columnRange.fValueRange = pageRange;
+      return;
+   }
+   columnRange.fValueRange->fMin = std::min(columnRange.fValueRange->fMin, pageRange->fMin);
+   columnRange.fValueRange->fMax = std::max(columnRange.fValueRange->fMax, pageRange->fMax);
+}
+
 void ROOT::Experimental::Internal::RPagePersistentSink::CommitPage(ColumnHandle_t columnHandle, const RPage &page)
 {
    fOpenColumnRanges.at(columnHandle.fPhysicalId).fNElements += page.GetNElements();
+   UpdateValueRange(columnHandle.fPhysicalId, page.GetNElements(),
+                    GetWriteOptions().GetEnableValueRanges() ? columnHandle.fColumn->ComputeValueRange(page)
+                                                             : std::nullopt);
 
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = page.GetNElements();
@@ -891,6 +941,7 @@ void ROOT::Experimental::Internal::RPagePersistentSink::CommitSealedPage(Descrip
                                                                          const RPageStorage::RSealedPage &sealedPage)
 {
    fOpenColumnRanges.at(physicalColumnId).fNElements += sealedPage.GetNElements();
+   UpdateValueRange(physicalColumnId, sealedPage.GetNElements(), sealedPage.GetValueRange());
 
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = sealedPage.GetNElements();
@@ -974,6 +1025,7 @@ void ROOT::Experimental::Internal::RPagePersistentSink::CommitSealedPageV(
    for (auto &range : ranges) {
       for (auto sealedPageIt = range.fFirst; sealedPageIt != range.fLast; ++sealedPageIt) {
          fOpenColumnRanges.at(range.fPhysicalColumnId).fNElements += sealedPageIt->GetNElements();
+         UpdateValueRange(range.fPhysicalColumnId, sealedPageIt->GetNElements(), sealedPageIt->GetValueRange());
 
          RClusterDescriptor::RPageRange::RPageInfo pageInfo;
          pageInfo.fNElements = sealedPageIt->GetNElements();
@@ -1006,7 +1058,10 @@ ROOT::Experimental::Internal::RPagePersistentSink::StageCluster(ROOT::Experiment
 
          columnInfo.fNElements = fOpenColumnRanges[i].fNElements;
          fOpenColumnRanges[i].fNElements = 0;
+         columnInfo.fValueRange = fOpenColumnRanges[i].fValueRange;
+         fOpenColumnRanges[i].fValueRange.reset();
       }
+      fOpenValueRangesUnknown[i] = false;
       stagedCluster.fColumnInfos.push_back(std::move(columnInfo));
    }
 
@@ -1027,7 +1082,8 @@ void ROOT::Experimental::Internal::RPagePersistentSink::CommitStagedClusters(std
             clusterBuilder.MarkSuppressedColumnRange(colId);
          } else {
             clusterBuilder.CommitColumnRange(colId, fOpenColumnRanges[colId].fFirstElementIndex,
-                                             fOpenColumnRanges[colId].fCompressionSettings, columnInfo.fPageRange);
+                                             fOpenColumnRanges[colId].fCompressionSettings, columnInfo.fPageRange,
+                                             columnInfo.fValueRange);
             fOpenColumnRanges[colId].fFirstElementIndex += columnInfo.fNElements;
          }
       }
@@ -128,12 +128,18 @@ void ROOT::Experimental::Internal::RPageSinkFile::CommitBatchOfPages(CommitBatch
 {
    Detail::RNTupleAtomicTimer timer(fCounters->fTimeWallWrite, fCounters->fTimeCpuWrite);
 
-   std::uint64_t offset = fWriter->ReserveBlob(batch.fSize, batch.fBytesPacked);
+   const bool deferWrites = fDeferWrites && fWriter->CanWriteConcurrently();
+   std::uint64_t offset = deferWrites ? fWriter->ReserveBlobConcurrent(batch.fSize, batch.fBytesPacked)
+                                      : fWriter->ReserveBlob(batch.fSize, batch.fBytesPacked);
 
    locators.reserve(locators.size() + batch.fSealedPages.size());
 
    for (const auto *pagePtr : batch.fSealedPages) {
-      fWriter->WriteIntoReservedBlob(pagePtr->GetBuffer(), pagePtr->GetBufferSize(), offset);
+      if (deferWrites) {
+         fDeferredWrites.push_back({pagePtr->GetBuffer(), pagePtr->GetBufferSize(), offset});
+      } else {
+         fWriter->WriteIntoReservedBlob(pagePtr->GetBuffer(), pagePtr->GetBufferSize(), offset);
+      }
       RNTupleLocator locator;
       locator.fPosition = offset;
       locator.fBytesOnStorage = pagePtr->GetDataSize();
@@ -221,6 +227,14 @@ ROOT::Experimental::Internal::RPageSinkFile::CommitSealedPageVImpl(std::span<RPa
    return locators;
 }
 
+void ROOT::Experimental::Internal::RPageSinkFile::WriteDeferred(const std::vector<RDeferredWrite> &writes)
+{
+   Detail::RNTupleAtomicTimer timer(fCounters->fTimeWallWrite, fCounters->fTimeCpuWrite);
+   for (const auto &w : writes) {
+      fWriter->WriteIntoReservedBlobConcurrent(w.fBuffer, w.fSize, w.fOffset);
+   }
+}
+
 std::uint64_t ROOT::Experimental::Internal::RPageSinkFile::StageClusterImpl()
 {
    auto result = fNBytesCurrentCluster;
@@ -443,9 +457,9 @@ ROOT::Experimental::Internal::RPageSourceFile::LoadPageImpl(ColumnHandle_t colum
    sealedPage.SetNElements(pageInfo.fNElements);
    sealedPage.SetHasChecksum(pageInfo.fHasChecksum);
    sealedPage.SetBufferSize(pageInfo.fLocator.fBytesOnStorage + pageInfo.fHasChecksum * kNBytesPageChecksum);
-   std::unique_ptr<unsigned char[]> directReadBuffer; // only used if cluster pool is turned off
+   std::unique_ptr<unsigned char[]> directReadBuffer; // only used if cluster pool is turned off or for on-demand columns
 
-   if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff) {
+   if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff || IsOnDemandColumn(columnId)) {
       directReadBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[sealedPage.GetBufferSize()]);
       fReader.ReadBuffer(directReadBuffer.get(), sealedPage.GetBufferSize(),
                          pageInfo.fLocator.GetPosition<std::uint64_t>());
@@ -455,7 +469,7 @@ ROOT::Experimental::Internal::RPageSourceFile::LoadPageImpl(ColumnHandle_t colum
       sealedPage.SetBuffer(directReadBuffer.get());
    } else {
       if (!fCurrentCluster || (fCurrentCluster->GetId() != clusterId) || !fCurrentCluster->ContainsColumn(columnId))
-         fCurrentCluster = fClusterPool->GetCluster(clusterId, fActivePhysicalColumns.ToColumnSet());
+         fCurrentCluster = fClusterPool->GetCluster(clusterId, GetClusterColumnSet());
       R__ASSERT(fCurrentCluster->ContainsColumn(columnId));
 
       auto cachedPageRef = fPagePool.GetPage(columnId, RClusterIndex(clusterId, idxInCluster));
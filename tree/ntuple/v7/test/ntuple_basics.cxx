@@ -402,6 +402,33 @@ TEST(RNTuple, PageSize)
    EXPECT_EQ(20, col0_pages.fPageInfos.size());
 }
 
+TEST(RNTuple, PageAllocatorPool)
+{
+   FileRaii fileGuard("test_ntuple_page_allocator_pool.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto ptrPt = model->MakeField<float>("pt");
+      RNTupleWriteOptions opt;
+      opt.SetMaxUnzippedPageSize(200);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), opt);
+      for (int i = 0; i < 1000; i++) {
+         *ptrPt = i;
+         writer->Fill();
+         if (i % 100 == 99)
+            writer->CommitCluster();
+      }
+   }
+
+   RNTupleReadOptions options;
+   options.SetPageAllocator(RNTupleReadOptions::EPageAllocator::kPool);
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath(), options);
+   EXPECT_EQ(10U, reader->GetDescriptor().GetNClusters());
+   auto viewPt = reader->GetView<float>("pt");
+   for (auto i : reader->GetEntryRange()) {
+      EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+   }
+}
+
 TEST(RNTupleModel, EnforceValidFieldNames)
 {
    auto model = RNTupleModel::Create();
@@ -799,6 +826,44 @@ TEST(RNTuple, FillBytesWrittenCollections)
    EXPECT_EQ(reader->GetDescriptor().GetNClusters(), 2);
 }
 
+TEST(RNTuple, AdaptiveClusterSizing)
+{
+   // The first part of the data is incompressible, the second part is highly compressible. The adaptive cluster sizing
+   // should follow the change of the compression factor faster and thus write fewer, larger clusters.
+   auto fnWrite = [](const std::string &path, RNTupleWriteOptions::EClusterSizing clusterSizing) {
+      auto model = RNTupleModel::Create();
+      auto fld = model->MakeField<std::uint64_t>("fld");
+      RNTupleWriteOptions options;
+      options.SetApproxZippedClusterSize(64 * 1024);
+      options.SetClusterSizing(clusterSizing);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", path, options);
+      std::uint64_t random = 1;
+      for (unsigned i = 0; i < 64000; ++i) {
+         random = random * 6364136223846793005ULL + 1442695040888963407ULL;
+         *fld = random;
+         writer->Fill();
+      }
+      *fld = 0;
+      for (unsigned i = 0; i < 640000; ++i) {
+         writer->Fill();
+      }
+   };
+
+   FileRaii fileGuardGlobal("test_ntuple_adaptive_cluster_sizing_global.root");
+   FileRaii fileGuardAdaptive("test_ntuple_adaptive_cluster_sizing_adaptive.root");
+   fnWrite(fileGuardGlobal.GetPath(), RNTupleWriteOptions::EClusterSizing::kGlobalRatio);
+   fnWrite(fileGuardAdaptive.GetPath(), RNTupleWriteOptions::EClusterSizing::kAdaptive);
+
+   auto readerGlobal = RNTupleReader::Open("ntuple", fileGuardGlobal.GetPath());
+   auto readerAdaptive = RNTupleReader::Open("ntuple", fileGuardAdaptive.GetPath());
+   EXPECT_EQ(704000U, readerGlobal->GetNEntries());
+   EXPECT_EQ(704000U, readerAdaptive->GetNEntries());
+   EXPECT_LT(readerAdaptive->GetDescriptor().GetNClusters(), readerGlobal->GetDescriptor().GetNClusters());
+
+   auto viewAdaptive = readerAdaptive->GetView<std::uint64_t>("fld");
+   EXPECT_EQ(0U, viewAdaptive(703999));
+}
+
 TEST(RNTuple, RValue)
 {
    auto f1 = RFieldBase::Create("f1", "CustomStruct").Unwrap();
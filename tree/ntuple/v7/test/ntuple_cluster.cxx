@@ -392,4 +392,41 @@ TEST(PageStorageFile, LoadClustersIMT)
 
    ROOT::DisableImplicitMT();
 }
+TEST(PageStorageFile, UnzipPipelineIMT)
+{
+   ROOT::EnableImplicitMT(2);
+
+   FileRaii fileGuard("test_pagestoragefile_unzippipelineimt.root");
+
+   {
+      auto model = ROOT::Experimental::RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrE = model->MakeField<double>("E");
+
+      auto writer = ROOT::Experimental::RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath());
+      for (int i = 0; i < 100; ++i) {
+         *wrPt = i;
+         *wrE = 2 * i;
+         writer->Fill();
+         if (i % 10 == 9)
+            writer->CommitCluster();
+      }
+   }
+
+   ROOT::Experimental::RNTupleReadOptions options;
+   options.SetClusterBunchSize(2);
+   auto reader = ROOT::Experimental::RNTupleReader::Open("myNTuple", fileGuard.GetPath(), options);
+   EXPECT_EQ(10U, reader->GetDescriptor().GetNClusters());
+   auto viewPt = reader->GetView<float>("pt");
+   auto viewE = reader->GetView<double>("E");
+   for (auto i : reader->GetEntryRange()) {
+      EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+      EXPECT_DOUBLE_EQ(2. * i, viewE(i));
+   }
+   // Jump back, which expires the clusters in the look-ahead window
+   EXPECT_FLOAT_EQ(5.f, viewPt(5));
+   EXPECT_FLOAT_EQ(95.f, viewPt(95));
+
+   ROOT::DisableImplicitMT();
+}
 #endif
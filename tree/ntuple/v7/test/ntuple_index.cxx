@@ -257,3 +257,57 @@ TEST(RNTupleIndex, MultipleMatches)
    entryIdxs = index->GetAllEntryNumbers<std::uint64_t>(4);
    EXPECT_EQ(nullptr, entryIdxs);
 }
+
+TEST(RNTupleIndex, Persisted)
+{
+   FileRaii fileGuard("test_ntuple_index_persisted.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fld1 = model->MakeField<std::int16_t>("fld1");
+      auto fld2 = model->MakeField<std::uint64_t>("fld2");
+
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+
+      for (int i = 0; i < 20; ++i) {
+         *fld1 = i % 5;
+         *fld2 = i % 2;
+         ntuple->Fill();
+      }
+   }
+
+   auto pageSource = RPageSource::Create("ntuple", fileGuard.GetPath());
+   {
+      auto index = RNTupleIndex::Create({"fld1", "fld2"}, *pageSource);
+      auto file = std::unique_ptr<TFile>(TFile::Open(fileGuard.GetPath().c_str(), "UPDATE"));
+      index->Write("ntuple_index", *file);
+   }
+
+   auto index = RNTupleIndex::Open({"fld1", "fld2"}, *pageSource, "ntuple_index", fileGuard.GetPath(),
+                                   true /* deferBuild */);
+   EXPECT_FALSE(index->IsBuilt());
+   index->Build();
+   EXPECT_TRUE(index->IsBuilt());
+   EXPECT_EQ(10UL, index->GetSize());
+
+   for (std::int16_t i = 0; i < 5; ++i) {
+      for (std::uint64_t j = 0; j < 2; ++j) {
+         auto entryNumbers = index->GetAllEntryNumbers(i, j);
+         if (i % 2 == static_cast<std::int16_t>(j)) {
+            ASSERT_NE(nullptr, entryNumbers);
+            EXPECT_EQ(std::vector<NTupleSize_t>({static_cast<NTupleSize_t>(i), static_cast<NTupleSize_t>(i + 10)}),
+                      *entryNumbers);
+         } else {
+            ASSERT_NE(nullptr, entryNumbers);
+            EXPECT_EQ(std::vector<NTupleSize_t>({static_cast<NTupleSize_t>(i + 5), static_cast<NTupleSize_t>(i + 15)}),
+                      *entryNumbers);
+         }
+      }
+   }
+
+   try {
+      RNTupleIndex::Open({"fld2", "fld1"}, *pageSource, "ntuple_index", fileGuard.GetPath());
+      FAIL() << "opening a persisted index with mismatching fields should throw";
+   } catch (const RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("does not index field \"fld2\""));
+   }
+}
@@ -994,3 +994,65 @@ TEST(RNTupleMerger, MergeLateModelExtension)
       }
    }
 }
+
+#ifdef R__USE_IMT
+TEST(RNTupleMerger, MergeManyClustersIMT)
+{
+   IMTRAII _;
+
+   // Write two inputs with many small clusters
+   FileRaii fileGuard1("test_ntuple_merge_imt_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_imt_in_2.root");
+   int fileIdx = 0;
+   for (const auto &path : {fileGuard1.GetPath(), fileGuard2.GetPath()}) {
+      auto model = RNTupleModel::Create();
+      auto fieldFoo = model->MakeField<int>("foo", 0);
+      auto fieldBar = model->MakeField<float>("bar", 0);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", path);
+      for (int i = 0; i < 1000; ++i) {
+         *fieldFoo = fileIdx * 1000 + i;
+         *fieldBar = 0.5f * (fileIdx * 1000 + i);
+         ntuple->Fill();
+         if (i % 100 == 99)
+            ntuple->CommitCluster();
+      }
+      ++fileIdx;
+   }
+
+   // Merge them both as they are and changing the compression
+   FileRaii fileGuardFast("test_ntuple_merge_imt_out_fast.root");
+   FileRaii fileGuardComp("test_ntuple_merge_imt_out_comp.root");
+   for (const auto compression : {kUnknownCompressionSettings, 101}) {
+      std::vector<std::unique_ptr<RPageSource>> sources;
+      sources.push_back(RPageSource::Create("ntuple", fileGuard1.GetPath(), RNTupleReadOptions()));
+      sources.push_back(RPageSource::Create("ntuple", fileGuard2.GetPath(), RNTupleReadOptions()));
+      std::vector<RPageSource *> sourcePtrs;
+      for (const auto &s : sources) {
+         sourcePtrs.push_back(s.get());
+      }
+
+      const auto &outPath =
+         compression == kUnknownCompressionSettings ? fileGuardFast.GetPath() : fileGuardComp.GetPath();
+      auto destination = std::make_unique<RPageSinkFile>("ntuple", outPath, RNTupleWriteOptions());
+      RNTupleMerger merger;
+      RNTupleMergeOptions opts;
+      opts.fCompressionSettings = compression;
+      auto res = merger.Merge(sourcePtrs, *destination, opts);
+      EXPECT_TRUE(bool(res));
+   }
+
+   // The entries are in the order of the inputs
+   for (const auto &path : {fileGuardFast.GetPath(), fileGuardComp.GetPath()}) {
+      auto ntuple = RNTupleReader::Open("ntuple", path);
+      EXPECT_EQ(2000u, ntuple->GetNEntries());
+      EXPECT_EQ(20u, ntuple->GetDescriptor().GetNClusters());
+      auto foo = ntuple->GetModel().GetDefaultEntry().GetPtr<int>("foo");
+      auto bar = ntuple->GetModel().GetDefaultEntry().GetPtr<float>("bar");
+      for (auto i : ntuple->GetEntryRange()) {
+         ntuple->LoadEntry(i);
+         EXPECT_EQ(static_cast<int>(i), *foo);
+         EXPECT_FLOAT_EQ(0.5f * i, *bar);
+      }
+   }
+}
+#endif
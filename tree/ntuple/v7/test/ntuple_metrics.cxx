@@ -112,3 +112,46 @@ TEST(Metrics, RNTupleWriter)
    // one page for the int field, one for the float field
    EXPECT_EQ(2, page_counter->GetValueAsInt());
 }
+
+TEST(Metrics, Registry)
+{
+   FileRaii fileGuard("test_ntuple_metrics_registry.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fld = model->MakeField<float>("pt");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      *fld = 1.0;
+      writer->Fill();
+   }
+
+   const auto nRegistered = RNTupleMetricsRegistry::Instance().GetNRegistered();
+   {
+      auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+      EXPECT_EQ(nRegistered, RNTupleMetricsRegistry::Instance().GetNRegistered());
+      reader->EnableMetrics();
+      reader->EnableMetrics();
+      EXPECT_EQ(nRegistered + 1, RNTupleMetricsRegistry::Instance().GetNRegistered());
+      reader->LoadEntry(0);
+
+      RNTupleMetrics metrics("test");
+      auto ctr = metrics.MakeCounter<RNTuplePlainCounter *>("plain", "B", "a \"quoted\" counter");
+      metrics.Enable();
+      ctr->Add(42);
+      auto registration = RNTupleMetricsRegistry::Instance().Register(metrics, "ntpl\"2");
+      EXPECT_EQ(nRegistered + 2, RNTupleMetricsRegistry::Instance().GetNRegistered());
+
+      const auto json = RNTupleMetricsRegistry::Instance().ToJSON();
+      EXPECT_THAT(json, testing::HasSubstr("\"ntuple\":\"ntpl\""));
+      EXPECT_THAT(json, testing::HasSubstr("\"name\":\"RNTupleReader.RPageSourceFile.nReadV\""));
+      EXPECT_THAT(json, testing::HasSubstr("\"ntuple\":\"ntpl\\\"2\""));
+      EXPECT_THAT(json, testing::HasSubstr("{\"name\":\"test.plain\",\"unit\":\"B\",\"description\":\"a "
+                                           "\\\"quoted\\\" counter\",\"value\":42}"));
+
+      const auto prometheus = RNTupleMetricsRegistry::Instance().ToPrometheus();
+      EXPECT_THAT(prometheus, testing::HasSubstr("# TYPE rntuple_test_plain_B gauge\n"));
+      EXPECT_THAT(prometheus, testing::HasSubstr("rntuple_test_plain_B{id=\"" + std::to_string(registration.GetId()) +
+                                                 "\",ntuple=\"ntpl\\\"2\"} 42\n"));
+      EXPECT_THAT(prometheus, testing::HasSubstr("rntuple_RNTupleReader_RPageSourceFile_nReadV{"));
+   }
+   EXPECT_EQ(nRegistered, RNTupleMetricsRegistry::Instance().GetNRegistered());
+}
@@ -218,6 +218,30 @@ TYPED_TEST(PackingInt, SplitInt)
    EXPECT_EQ(mem, cmp);
 }
 
+TYPED_TEST(PackingInt, SplitIntLarge)
+{
+   using Pod_t = typename TestFixture::Helper_t::Pod_t;
+
+   auto element = RColumnElementBase::Generate<Pod_t>(TestFixture::Helper_t::kColumnType);
+
+   // Cover the vectorized unsplitting as well as the remainder elements and the unsplit block boundaries
+   for (std::size_t count : {15, 16, 17, 255, 256, 257, 1000}) {
+      std::vector<Pod_t> mem(count);
+      for (std::size_t i = 0; i < count; ++i) {
+         mem[i] = static_cast<Pod_t>((i * 0x9E3779B97F4A7C15ull) >> 13);
+         if (std::is_signed_v<Pod_t> && (i % 3 == 0))
+            mem[i] = -mem[i];
+      }
+      std::vector<Pod_t> packed(count);
+      std::vector<Pod_t> cmp(count);
+
+      element->Pack(packed.data(), mem.data(), count);
+      element->Unpack(cmp.data(), packed.data(), count);
+
+      EXPECT_EQ(mem, cmp);
+   }
+}
+
 TYPED_TEST(PackingIndex, SplitIndex)
 {
    using Pod_t = typename TestFixture::Helper_t::Pod_t;
@@ -237,6 +261,29 @@ TYPED_TEST(PackingIndex, SplitIndex)
    EXPECT_EQ(mem, cmp);
 }
 
+TYPED_TEST(PackingIndex, SplitIndexLarge)
+{
+   using Pod_t = typename TestFixture::Helper_t::Pod_t;
+
+   auto element = RColumnElementBase::Generate<ClusterSize_t>(TestFixture::Helper_t::kColumnType);
+
+   for (std::size_t count : {15, 16, 17, 255, 256, 257, 1000}) {
+      std::vector<Pod_t> mem(count);
+      Pod_t offset = 0;
+      for (std::size_t i = 0; i < count; ++i) {
+         offset += i % 7;
+         mem[i] = offset;
+      }
+      std::vector<Pod_t> packed(count);
+      std::vector<Pod_t> cmp(count);
+
+      element->Pack(packed.data(), mem.data(), count);
+      element->Unpack(cmp.data(), packed.data(), count);
+
+      EXPECT_EQ(mem, cmp);
+   }
+}
+
 template <typename PodT, EColumnType ColumnT>
 static void AddField(RNTupleModel &model, const std::string &fieldName)
 {
@@ -11,6 +11,41 @@ TEST(Pages, Allocation)
    EXPECT_EQ(0U, page.GetNBytes());
 }
 
+TEST(Pages, AllocatorPool)
+{
+   RPageAllocatorPool allocator(1024);
+   EXPECT_EQ(0U, allocator.GetCachedBytes());
+
+   void *buffer;
+   {
+      auto page = allocator.NewPage(42, 4, 100);
+      EXPECT_FALSE(page.IsNull());
+      EXPECT_EQ(100U, page.GetMaxElements());
+      buffer = page.GetBuffer();
+   }
+   // 400 bytes are rounded up to the 512 bytes size class
+   EXPECT_EQ(512U, allocator.GetCachedBytes());
+
+   {
+      // Same size class: the buffer is recycled
+      auto page = allocator.NewPage(43, 8, 60);
+      EXPECT_EQ(buffer, page.GetBuffer());
+      EXPECT_EQ(0U, allocator.GetCachedBytes());
+
+      // Different size class: fresh allocation
+      auto other = allocator.NewPage(44, 1, 100);
+      EXPECT_NE(buffer, other.GetBuffer());
+   }
+   EXPECT_EQ(512U + 128U, allocator.GetCachedBytes());
+
+   {
+      // Released pages beyond the cache limit are freed
+      auto page1 = allocator.NewPage(45, 1, 1024);
+      auto page2 = allocator.NewPage(46, 1, 1024);
+   }
+   EXPECT_EQ(512U + 128U, allocator.GetCachedBytes());
+}
+
 TEST(Pages, Pool)
 {
    RPageAllocatorHeap allocator;
@@ -1,5 +1,8 @@
 #include "ntuple_test.hxx"
 
+#include <set>
+#include <thread>
+
 TEST(RNTupleParallelWriter, Basics)
 {
    FileRaii fileGuard("test_ntuple_parallel_basics.root");
@@ -237,6 +240,52 @@ TEST(RNTupleParallelWriter, StagedMultiColumn)
    EXPECT_FLOAT_EQ(3.0, viewPx(2));
 }
 
+TEST(RNTupleParallelWriter, Threads)
+{
+   FileRaii fileGuard("test_ntuple_parallel_threads.root");
+
+   static constexpr unsigned kNThreads = 8;
+   static constexpr std::uint64_t kNEntriesPerThread = 100000;
+   // Scramble the values so that the clusters of all threads together span several write blocks of the file.
+   auto fnValue = [](std::uint64_t i) { return i * 6364136223846793005ULL + 1442695040888963407ULL; };
+
+   {
+      auto model = RNTupleModel::CreateBare();
+      model->MakeField<std::uint64_t>("val");
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "f", fileGuard.GetPath());
+
+      std::vector<std::thread> threads;
+      for (unsigned t = 0; t < kNThreads; ++t) {
+         threads.emplace_back([&, t] {
+            auto context = writer->CreateFillContext();
+            auto entry = context->CreateEntry();
+            auto val = entry->GetPtr<std::uint64_t>("val");
+            for (std::uint64_t i = 0; i < kNEntriesPerThread; ++i) {
+               *val = fnValue(t * kNEntriesPerThread + i);
+               context->Fill(*entry);
+               if (i % 10000 == 9999)
+                  context->FlushCluster();
+            }
+         });
+      }
+      for (auto &thread : threads)
+         thread.join();
+   }
+
+   auto reader = RNTupleReader::Open("f", fileGuard.GetPath());
+   EXPECT_EQ(kNThreads * kNEntriesPerThread, reader->GetNEntries());
+   EXPECT_EQ(kNThreads * kNEntriesPerThread / 10000, reader->GetDescriptor().GetNClusters());
+
+   std::set<std::uint64_t> expected;
+   for (std::uint64_t i = 0; i < kNThreads * kNEntriesPerThread; ++i)
+      expected.insert(fnValue(i));
+   auto view = reader->GetView<std::uint64_t>("val");
+   for (auto i : reader->GetEntryRange()) {
+      EXPECT_EQ(1U, expected.erase(view(i)));
+   }
+   EXPECT_TRUE(expected.empty());
+}
+
 TEST(RNTupleParallelWriter, Options)
 {
    FileRaii fileGuard("test_ntuple_parallel_options.root");
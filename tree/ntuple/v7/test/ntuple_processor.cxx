@@ -296,3 +296,53 @@ TEST(RNTupleProcessor, ChainUnalignedModels)
       EXPECT_THAT(err.what(), testing::HasSubstr("field \"y\" not found in current RNTuple"));
    }
 }
+
+TEST(RNTupleProcessor, ProcessParallel)
+{
+   FileRaii fileGuard1("test_ntuple_processor_process_parallel1.root");
+   FileRaii fileGuard2("test_ntuple_processor_process_parallel2.root");
+   std::uint64_t nEntriesWritten = 0;
+   for (auto path : {fileGuard1.GetPath(), fileGuard2.GetPath()}) {
+      auto model = RNTupleModel::Create();
+      auto fldX = model->MakeField<float>("x");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", path);
+      for (unsigned i = 0; i < 1000; ++i) {
+         *fldX = static_cast<float>(nEntriesWritten++);
+         ntuple->Fill();
+         if (i % 100 == 99)
+            ntuple->CommitCluster();
+      }
+   }
+
+   std::vector<RNTupleSourceSpec> ntuples = {{"ntuple", fileGuard1.GetPath()}, {"ntuple", fileGuard2.GetPath()}};
+   RNTupleProcessor proc(ntuples);
+
+   const unsigned int nThreads = 4;
+   std::vector<std::uint64_t> nEntries(nThreads);
+   std::vector<double> sumX(nThreads);
+   std::vector<double> sumGlobalIdx(nThreads);
+   proc.ProcessParallel(
+      [&](unsigned int slot, const RNTupleProcessor::RIterator::RProcessorState &state) {
+         ASSERT_LT(slot, nThreads);
+         auto x = state->GetPtr<float>("x");
+         EXPECT_EQ(static_cast<float>(state.GetGlobalEntryIndex()), *x);
+         EXPECT_EQ(state.GetGlobalEntryIndex() % 1000, state.GetLocalEntryIndex());
+         EXPECT_EQ(state.GetGlobalEntryIndex() / 1000, state.GetNTupleIndex());
+         ++nEntries[slot];
+         sumX[slot] += *x;
+         sumGlobalIdx[slot] += state.GetGlobalEntryIndex();
+      },
+      nThreads);
+
+   std::uint64_t nEntriesTotal = 0;
+   double sumXTotal = 0;
+   double sumGlobalIdxTotal = 0;
+   for (unsigned int i = 0; i < nThreads; ++i) {
+      nEntriesTotal += nEntries[i];
+      sumXTotal += sumX[i];
+      sumGlobalIdxTotal += sumGlobalIdx[i];
+   }
+   EXPECT_EQ(nEntriesWritten, nEntriesTotal);
+   EXPECT_DOUBLE_EQ(1999000., sumXTotal);
+   EXPECT_DOUBLE_EQ(1999000., sumGlobalIdxTotal);
+}
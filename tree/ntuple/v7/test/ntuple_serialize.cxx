@@ -696,7 +696,8 @@ TEST(RNTuple, SerializeFooter)
    pageInfo.fLocator.fPosition = 8000U;
    pageInfo.fHasChecksum = false;
    pageRange.fPageInfos.emplace_back(pageInfo);
-   clusterBuilder.CommitColumnRange(17, 0, 100, pageRange);
+   clusterBuilder.CommitColumnRange(17, 0, 100, pageRange,
+                                    ROOT::Experimental::RClusterDescriptor::RValueRange{-1.5, 42.});
    builder.AddCluster(clusterBuilder.MoveDescriptor().Unwrap());
    RClusterGroupDescriptorBuilder cgBuilder;
    RNTupleLocator cgLocator;
@@ -764,6 +765,9 @@ TEST(RNTuple, SerializeFooter)
    columnRange = clusterDesc.GetColumnRange(0);
    EXPECT_EQ(100u, columnRange.fNElements);
    EXPECT_EQ(0u, columnRange.fFirstElementIndex);
+   ASSERT_TRUE(columnRange.fValueRange);
+   EXPECT_EQ(-1.5, columnRange.fValueRange->fMin);
+   EXPECT_EQ(42., columnRange.fValueRange->fMax);
    pageRange = clusterDesc.GetPageRange(0).Clone();
    EXPECT_EQ(2u, pageRange.fPageInfos.size());
    EXPECT_EQ(40u, pageRange.fPageInfos[0].fNElements);
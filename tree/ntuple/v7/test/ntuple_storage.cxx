@@ -224,6 +224,43 @@ TEST(RNTuple, PageFilling)
    EXPECT_EQ(3u, prY.fPageInfos[1].fNElements);
 }
 
+TEST(RNTuple, OnDemandFields)
+{
+   FileRaii fileGuard("test_ntuple_on_demand_fields.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fldX = model->MakeField<float>("x");
+      auto fldY = model->MakeField<double>("y");
+
+      RNTupleWriteOptions options;
+      options.SetInitialNElementsPerPage(3);
+      options.SetMaxUnzippedPageSize(24);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      // 5 pages of x, 10 pages of y
+      for (int i = 0; i < 30; ++i) {
+         *fldX = i;
+         *fldY = i;
+         writer->Fill();
+      }
+   }
+
+   RNTupleReadOptions options;
+   options.SetOnDemandFields({"y"});
+   options.SetMetricsEnabled(true);
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+   auto viewX = reader->GetView<float>("x");
+   auto viewY = reader->GetView<double>("y");
+   for (auto i : reader->GetEntryRange()) {
+      if (viewX(i) == 4)
+         EXPECT_DOUBLE_EQ(4., viewY(i));
+   }
+
+   // all the pages of x, and the page of y that contains the selected entry
+   const auto &metrics = reader->GetMetrics();
+   EXPECT_EQ(6, metrics.GetCounter("RNTupleReader.RPageSourceFile.nPageRead")->GetValueAsInt());
+   EXPECT_EQ(6, metrics.GetCounter("RNTupleReader.RPageSourceFile.nPageUnsealed")->GetValueAsInt());
+}
+
 TEST(RNTuple, PageFillingString)
 {
    FileRaii fileGuard("test_ntuple_page_filling_string.root");
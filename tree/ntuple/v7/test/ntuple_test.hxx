@@ -83,6 +83,7 @@ using RNTupleAtomicTimer = ROOT::Experimental::Detail::RNTupleAtomicTimer;
 using RNTupleCalcPerf = ROOT::Experimental::Detail::RNTupleCalcPerf;
 using RNTupleCompressor = ROOT::Experimental::Internal::RNTupleCompressor;
 using RNTupleDecompressor = ROOT::Experimental::Internal::RNTupleDecompressor;
+using RNTupleRLE = ROOT::Experimental::Internal::RNTupleRLE;
 using RNTupleDescriptor = ROOT::Experimental::RNTupleDescriptor;
 using RNTupleFillStatus = ROOT::Experimental::RNTupleFillStatus;
 using RNTupleDescriptorBuilder = ROOT::Experimental::Internal::RNTupleDescriptorBuilder;
@@ -95,6 +96,7 @@ using RNTupleWriter = ROOT::Experimental::RNTupleWriter;
 using RNTupleWriteOptions = ROOT::Experimental::RNTupleWriteOptions;
 using RNTupleWriteOptionsDaos = ROOT::Experimental::RNTupleWriteOptionsDaos;
 using RNTupleMetrics = ROOT::Experimental::Detail::RNTupleMetrics;
+using RNTupleMetricsRegistry = ROOT::Experimental::Detail::RNTupleMetricsRegistry;
 using RNTupleMerger = ROOT::Experimental::Internal::RNTupleMerger;
 using RNTupleMergeOptions = ROOT::Experimental::Internal::RNTupleMergeOptions;
 using ENTupleMergingMode = ROOT::Experimental::Internal::ENTupleMergingMode;
@@ -104,6 +106,7 @@ using RNTuplePlainTimer = ROOT::Experimental::Detail::RNTuplePlainTimer;
 using RNTupleSerializer = ROOT::Experimental::Internal::RNTupleSerializer;
 using RPage = ROOT::Experimental::Internal::RPage;
 using RPageAllocatorHeap = ROOT::Experimental::Internal::RPageAllocatorHeap;
+using RPageAllocatorPool = ROOT::Experimental::Internal::RPageAllocatorPool;
 using RPagePool = ROOT::Experimental::Internal::RPagePool;
 using RPageSink = ROOT::Experimental::Internal::RPageSink;
 using RPageSinkBuf = ROOT::Experimental::Internal::RPageSinkBuf;
@@ -92,6 +92,55 @@ TEST(RNTuple, BulkView)
    }
 }
 
+TEST(RNTuple, SpanView)
+{
+   FileRaii fileGuard("test_ntuple_span_view.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldPt = model->MakeField<float>("pt");
+   auto eltsPerPage = 1'000;
+   {
+      RNTupleWriteOptions opt;
+      opt.SetMaxUnzippedPageSize(eltsPerPage * sizeof(float));
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), opt);
+      for (int i = 0; i < 10'000; i++) {
+         *fieldPt = i;
+         ntuple->Fill();
+      }
+   }
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   auto viewPt = ntuple->GetView<float>("pt");
+
+   EXPECT_TRUE(viewPt.MapSpan(0, 0).empty());
+   // Limited by the number of requested items
+   auto span1 = viewPt.MapSpan(10, 5);
+   ASSERT_EQ(5u, span1.size());
+   EXPECT_FLOAT_EQ(10.f, span1[0]);
+   EXPECT_FLOAT_EQ(14.f, span1[4]);
+   // Limited by the page boundary
+   auto span2 = viewPt.MapSpan(eltsPerPage - 2, 5);
+   ASSERT_EQ(2u, span2.size());
+   EXPECT_FLOAT_EQ(eltsPerPage - 2, span2[0]);
+   EXPECT_FLOAT_EQ(eltsPerPage - 1, span2[1]);
+   auto span3 = viewPt.MapSpan(RClusterIndex(0, eltsPerPage), 5);
+   ASSERT_EQ(5u, span3.size());
+   EXPECT_FLOAT_EQ(eltsPerPage, span3[0]);
+
+   // Loop over all entries span by span
+   NTupleSize_t nEntries = ntuple->GetNEntries();
+   NTupleSize_t nSpans = 0;
+   double sum = 0;
+   for (NTupleSize_t i = 0; i < nEntries;) {
+      auto values = viewPt.MapSpan(i, nEntries - i);
+      for (auto v : values)
+         sum += v;
+      i += values.size();
+      nSpans++;
+   }
+   EXPECT_EQ(10u, nSpans);
+   EXPECT_DOUBLE_EQ(49995000., sum);
+}
+
 TEST(RNTuple, BulkCollectionView)
 {
    FileRaii fileGuard("test_ntuple_bulk_view_collection.root");
@@ -131,6 +180,49 @@ TEST(RNTuple, BulkCollectionView)
    }
 }
 
+TEST(RNTuple, MapCollection)
+{
+   FileRaii fileGuard("test_ntuple_map_collection.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldJets = model->MakeField<std::vector<std::pair<float, std::string>>>("jets");
+   {
+      RNTupleWriteOptions opt;
+      // 4 jet momenta per page, so that some collections cross a page boundary
+      opt.SetInitialNElementsPerPage(4);
+      opt.SetMaxUnzippedPageSize(4 * sizeof(float));
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), opt);
+      for (int i = 0; i < 10; i++) {
+         fieldJets->clear();
+         for (int j = 0; j < 3; ++j)
+            fieldJets->emplace_back(10 * i + j, std::to_string(j));
+         ntuple->Fill();
+      }
+   }
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   auto viewJets = ntuple->GetCollectionView("jets");
+   auto viewPt = viewJets.GetView<float>("_0");
+   auto viewName = viewJets.GetView<std::string>("_1");
+
+   std::vector<float> ptBuffer;
+   std::vector<std::string> nameBuffer;
+   for (auto i : ntuple->GetEntryRange()) {
+      auto pt = viewJets.MapCollection(i, viewPt, ptBuffer);
+      ASSERT_EQ(3u, pt.size());
+      for (int j = 0; j < 3; ++j)
+         EXPECT_FLOAT_EQ(10 * i + j, pt[j]);
+      // the momenta of the first entry are in the first page, those of the second one cross a page boundary
+      if (i == 0)
+         EXPECT_NE(ptBuffer.data(), pt.data());
+      if (i == 1)
+         EXPECT_EQ(ptBuffer.data(), pt.data());
+
+      auto names = viewJets.MapCollection(i, viewName, nameBuffer);
+      ASSERT_EQ(3u, names.size());
+      EXPECT_EQ("2", names[2]);
+   }
+}
+
 TEST(RNTuple, Composable)
 {
    FileRaii fileGuard("test_ntuple_composable.root");
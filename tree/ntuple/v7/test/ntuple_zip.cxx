@@ -104,3 +104,29 @@ TEST(RNTupleZip, LargeWithOutputBuffer)
    RNTupleDecompressor::Unzip(zipBuffer.get(), szZip, N, unzipBuffer.get());
    EXPECT_EQ(data, std::string_view(unzipBuffer.get(), N));
 }
+
+TEST(RNTupleZip, RLEPage)
+{
+   // Long runs, short runs and literals, and a run longer than a single varint byte
+   std::string data(1000, 'a');
+   data += "bcbcddde";
+   data += std::string(300, '\0');
+   data += "ff";
+
+   auto zipBuffer = std::make_unique<unsigned char[]>(data.length());
+   auto szZip = RNTupleCompressor::ZipPage(data.data(), data.length(), 505, zipBuffer.get());
+   EXPECT_LT(szZip, data.length() / RNTupleCompressor::kMinRLEFactor);
+   EXPECT_TRUE(RNTupleRLE::IsRLEBlock(zipBuffer.get()));
+
+   std::string unzipped(data.length(), ' ');
+   RNTupleDecompressor::Unzip(zipBuffer.get(), szZip, data.length(), unzipped.data());
+   EXPECT_EQ(data, unzipped);
+
+   // No run-length encoding of uncompressed pages, or if it does not shrink the page enough
+   EXPECT_EQ(data.length(), RNTupleCompressor::ZipPage(data.data(), data.length(), 0, zipBuffer.get()));
+   std::string noRuns;
+   for (int i = 0; i < 1000; ++i)
+      noRuns += static_cast<char>(i % 7 + i % 13);
+   szZip = RNTupleCompressor::ZipPage(noRuns.data(), noRuns.length(), 505, zipBuffer.get());
+   EXPECT_FALSE(RNTupleRLE::IsRLEBlock(zipBuffer.get()));
+}
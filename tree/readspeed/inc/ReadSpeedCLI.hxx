@@ -16,17 +16,22 @@
 
 #include "ReadSpeed.hxx"
 
+#include <iostream>
 #include <vector>
 
 namespace ReadSpeed {
 
 void PrintThroughput(const Result &r);
 
+/// Print the result as a JSON object, with the input description and ROOT version, to compare runs.
+void PrintThroughputJSON(const Result &r, const Data &d, std::ostream &out = std::cout);
+
 struct Args {
    Data fData;
    unsigned int fNThreads = 0;
    bool fAllBranches = false;
    bool fShouldRun = false;
+   bool fJSONOutput = false;
 };
 
 Args ParseArgs(const std::vector<std::string> &args);
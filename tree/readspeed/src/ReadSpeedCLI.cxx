@@ -14,8 +14,12 @@
 #include <ROOT/TTreeProcessorMT.hxx> // for TTreeProcessorMT::SetTasksPerWorkerHint
 #endif
 
+#include <RVersion.h>
+
 #include <iostream>
+#include <iomanip>
 #include <cstring>
+#include <sstream>
 
 using namespace ReadSpeed;
 
@@ -26,6 +30,7 @@ const auto usageText = "Usage:\n"
                        "[bregex2 ...])\n"
                        "               [--threads nthreads]\n"
                        "               [--tasks-per-worker ntasks]\n"
+                       "               [--json]\n"
                        " rootreadspeed (--help|-h)\n"
                        " \n"
                        " Use -h for usage help, --help for detailed information.\n";
@@ -57,7 +62,10 @@ const auto argUsageText =
    "      The number of threads to use for file reading. Will automatically cap to the number of available threads on "
    "the machine.\n"
    "    --tasks-per-worker ntasks\n"
-   "      The number of tasks to generate for each worker thread when using multithreading.";
+   "      The number of tasks to generate for each worker thread when using multithreading.\n"
+   "    --json\n"
+   "      Print the results as a JSON object, which also records the inputs and the ROOT version, e.g. to compare "
+   "storage settings or ROOT versions.";
 
 const auto fullUsageText =
    "Description:\n"
@@ -164,6 +172,58 @@ void ReadSpeed::PrintThroughput(const Result &r)
    std::cout << "For details run with the --help command.\n";
 }
 
+namespace {
+
+std::string JSONString(const std::string &str)
+{
+   std::ostringstream out;
+   out << '"';
+   for (const char c : str) {
+      if (c == '"' || c == '\\')
+         out << '\\' << c;
+      else if (static_cast<unsigned char>(c) < 0x20)
+         out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+      else
+         out << c;
+   }
+   out << '"';
+   return out.str();
+}
+
+std::string JSONArray(const std::vector<std::string> &strs)
+{
+   std::string res = "[";
+   for (std::size_t i = 0; i < strs.size(); ++i)
+      res += (i ? ", " : "") + JSONString(strs[i]);
+   return res + "]";
+}
+
+} // namespace
+
+void ReadSpeed::PrintThroughputJSON(const Result &r, const Data &d, std::ostream &out)
+{
+   const unsigned int effectiveThreads = std::max(r.fThreadPoolSize, 1u);
+   const double mb = 1024. * 1024.;
+
+   out << "{\n";
+   out << "  \"rootVersion\": " << JSONString(ROOT_RELEASE) << ",\n";
+   out << "  \"files\": " << JSONArray(d.fFileNames) << ",\n";
+   out << "  \"trees\": " << JSONArray(d.fTreeNames) << ",\n";
+   out << "  \"branches\": " << JSONArray(d.fBranchNames) << ",\n";
+   out << "  \"branchesRegex\": " << (d.fUseRegex ? "true" : "false") << ",\n";
+   out << "  \"threadPoolSize\": " << r.fThreadPoolSize << ",\n";
+   out << "  \"mtSetupRealTime\": " << r.fMTSetupRealTime << ",\n";
+   out << "  \"mtSetupCpuTime\": " << r.fMTSetupCpuTime << ",\n";
+   out << "  \"realTime\": " << r.fRealTime << ",\n";
+   out << "  \"cpuTime\": " << r.fCpuTime << ",\n";
+   out << "  \"uncompressedBytesRead\": " << r.fUncompressedBytesRead << ",\n";
+   out << "  \"compressedBytesRead\": " << r.fCompressedBytesRead << ",\n";
+   out << "  \"uncompressedThroughputMBs\": " << r.fUncompressedBytesRead / r.fRealTime / mb << ",\n";
+   out << "  \"compressedThroughputMBs\": " << r.fCompressedBytesRead / r.fRealTime / mb << ",\n";
+   out << "  \"cpuEfficiency\": " << (r.fCpuTime / effectiveThreads) / r.fRealTime << "\n";
+   out << "}" << std::endl;
+}
+
 Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
 {
    // Print help message and exit if "--help"
@@ -184,6 +244,7 @@ Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
 
    Data d;
    unsigned int nThreads = 0;
+   bool jsonOutput = false;
 
    enum class EArgState { kNone, kTrees, kFiles, kBranches, kThreads, kTasksPerWorkerHint } argState = EArgState::kNone;
    enum class EBranchState { kNone, kRegular, kRegex, kAll } branchState = EBranchState::kNone;
@@ -225,6 +286,9 @@ Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
          argState = EArgState::kThreads;
       } else if (arg == "--tasks-per-worker") {
          argState = EArgState::kTasksPerWorkerHint;
+      } else if (arg == "--json") {
+         argState = EArgState::kNone;
+         jsonOutput = true;
       } else if (arg[0] == '-') {
          std::cerr << "Unrecognized option '" << arg << "'\n";
          return {};
@@ -251,7 +315,7 @@ Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
       }
    }
 
-   return Args{std::move(d), nThreads, branchState == EBranchState::kAll, /*fShouldRun=*/true};
+   return Args{std::move(d), nThreads, branchState == EBranchState::kAll, /*fShouldRun=*/true, jsonOutput};
 }
 
 Args ReadSpeed::ParseArgs(int argc, char **argv)
@@ -12,6 +12,8 @@
 #include "TSystem.h"
 #include "TTree.h"
 
+#include <sstream>
+
 using namespace ReadSpeed;
 
 // Helper function to generate a .root file with some dummy data in it.
@@ -266,6 +268,28 @@ TEST(ReadSpeedCLI, MultipleThreads)
    EXPECT_EQ(parsedArgs.fNThreads, threads) << "Program not using the correct amount of threads";
 }
 
+TEST(ReadSpeedCLI, JSONOutput)
+{
+   const std::vector<std::string> allArgs{
+      "root-readspeed", "--files", "doesnotexist.root", "--trees", "t", "--branches", "x", "--json",
+   };
+
+   const auto parsedArgs = ParseArgs(allArgs);
+
+   EXPECT_TRUE(parsedArgs.fShouldRun) << "Program not running when given valid arguments";
+   EXPECT_TRUE(parsedArgs.fJSONOutput) << "Program not set to JSON output";
+
+   Result r{2., 1., 0., 0., 4 * 1024 * 1024, 1024 * 1024, 0};
+   std::ostringstream out;
+   PrintThroughputJSON(r, {{"t"}, {"a \"quoted\" name.root"}, {"x"}}, out);
+   const auto json = out.str();
+
+   EXPECT_NE(json.find("\"files\": [\"a \\\"quoted\\\" name.root\"]"), std::string::npos) << json;
+   EXPECT_NE(json.find("\"uncompressedThroughputMBs\": 2,"), std::string::npos) << json;
+   EXPECT_NE(json.find("\"compressedThroughputMBs\": 0.5,"), std::string::npos) << json;
+   EXPECT_NE(json.find("\"cpuEfficiency\": 0.5\n"), std::string::npos) << json;
+}
+
 #ifdef R__USE_IMT
 TEST(ReadSpeedCLI, WorkerThreadsHint)
 {
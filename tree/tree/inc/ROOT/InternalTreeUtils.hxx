@@ -81,7 +81,19 @@ std::vector<std::unique_ptr<TChain>> MakeFriends(const ROOT::TreeUtils::RFriendI
 
 std::vector<std::string> ExpandGlob(const std::string &glob);
 
+/// Cluster layout and data location of a tree in one file, see GetTreeClusterInfo.
+struct RTreeClusterInfo {
+   /// The beginning entry of the first cluster up to the ending entry of the last cluster
+   std::vector<Long64_t> fClusterBoundaries;
+   Long64_t fNEntries = 0;
+   /// Host the file data is read from, e.g. the data server chosen by an XRootD redirector. Empty for local files.
+   std::string fHost;
+};
+
+RTreeClusterInfo GetTreeClusterInfo(std::string_view treename, std::string_view path);
 std::pair<std::vector<Long64_t>, Long64_t> GetClustersAndEntries(std::string_view treename, std::string_view path);
+std::vector<std::pair<Long64_t, Long64_t>>
+MakeClusterAlignedRanges(const std::vector<Long64_t> &clusterBoundaries, unsigned int nRanges);
 
 std::pair<bool, std::string> TreeUsesIndexedFriends(const TTree &tree);
 
@@ -31,6 +31,9 @@
 #include "Compression.h"
 #include "ROOT/TIOFeatures.hxx"
 
+#include <atomic>
+#include <vector>
+
 class TTree;
 class TBasket;
 class TBranchElement;
@@ -72,6 +75,8 @@ class TBulkBranchRead {
 public:
    /// See TBranch::GetBulkEntries(Long64_t evt, TBuffer &user_buf);
    Int_t GetBulkEntries(Long64_t evt, TBuffer &user_buf);
+   /// See TBranch::GetBulkEntries(Long64_t evt, TBuffer &user_buf, std::vector<Int_t> &offsets);
+   Int_t GetBulkEntries(Long64_t evt, TBuffer &user_buf, std::vector<Int_t> &offsets);
    /// See TBranch::GetEntriesSerialized(Long64_t evt, TBuffer &user_buf);
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf);
    /// See TBranch::GetEntriesSerialized(Long64_t evt, TBuffer &user_buf, TBuffer *count_buf);
@@ -153,6 +158,7 @@ protected:
    BulkObj     fBulk;             ///<! Helper for performing bulk IO
 
    bool        fSkipZip;          ///<! After being read, the buffer will not be unzipped.
+   std::atomic<bool> fIMTPendingWrite{false}; ///<! True while a basket is written by a pipelined TTree::Fill task.
 
    using CacheInfo_t = ROOT::Internal::TBranchCacheInfo;
    CacheInfo_t fCacheInfo;        ///<! Hold info about which basket are in the cache and if they have been retrieved from the cache.
@@ -182,6 +188,7 @@ private:
    Int_t    GetBasketAndFirst(TBasket*& basket, Long64_t& first, TBuffer* user_buffer);
    TBasket *GetBasketImpl(Int_t basket, TBuffer* user_buffer);
    Int_t    GetBulkEntries(Long64_t, TBuffer&);
+   Int_t    GetBulkEntries(Long64_t, TBuffer&, std::vector<Int_t>&);
    Int_t    GetEntriesSerialized(Long64_t N, TBuffer& user_buf) {return GetEntriesSerialized(N, user_buf, nullptr);}
    Int_t    GetEntriesSerialized(Long64_t, TBuffer&, TBuffer*);
    Int_t    FillEntryBuffer(TBasket* basket,TBuffer* buf, Int_t& lnew);
@@ -318,6 +325,7 @@ namespace Experimental {
 namespace Internal {
 
 inline Int_t  TBulkBranchRead::GetBulkEntries(Long64_t evt, TBuffer& user_buf) { return fParent.GetBulkEntries(evt, user_buf); }
+inline Int_t  TBulkBranchRead::GetBulkEntries(Long64_t evt, TBuffer& user_buf, std::vector<Int_t>& offsets) { return fParent.GetBulkEntries(evt, user_buf, offsets); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf) { return fParent.GetEntriesSerialized(evt, user_buf); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf, TBuffer* count_buf) { return fParent.GetEntriesSerialized(evt, user_buf, count_buf); }
 inline bool   TBulkBranchRead::SupportsBulkRead() const { return fParent.SupportsBulkRead(); }
@@ -50,6 +50,7 @@ private:
    TChain& operator=(const TChain&); // not implemented
    void
    ParseTreeFilename(const char *name, TString &filename, TString &treename, TString &query, TString &suffix) const;
+   void CountEntriesConcurrently();
 
 protected:
    void InvalidateCurrentTree();
@@ -64,6 +64,7 @@ class TEntryList: public TNamed
    virtual void        Add(const TEntryList *elist);
    void                AddSubList(TEntryList *elist);
    virtual Int_t       Contains(Long64_t entry, TTree *tree = nullptr);
+   virtual bool        ContainsRange(Long64_t min, Long64_t max, Int_t treenum = -1);
    virtual void        DirectoryAutoAdd(TDirectory *);
    virtual bool        Enter(Long64_t entry, TTree *tree = nullptr);
    virtual bool        Enter(Long64_t localentry, const char *treename, const char *filename);
@@ -29,6 +29,7 @@
 // - Merge() - adds all entries from one block to the other. If the first block
 //             uses array representation, it's changed to bits representation only
 //             if the total number of passing entries is still less than kBlockSize
+// - Subtract() - removes all entries of one block from the other
 // - GetEntry(n) - returns n-th non-zero entry.
 // - Next()      - return next non-zero entry. In case of representation 1), Next()
 //                 is faster than GetEntry()
@@ -55,6 +56,7 @@ class TEntryListBlock:public TObject
    Int_t    fLastIndexReturned; ///<! to optimize GetEntry() in a loop
 
    void Transform(bool dir, UShort_t *indexnew);
+   void FillBits(UShort_t *bits) const;
 
  public:
 
@@ -69,6 +71,7 @@ class TEntryListBlock:public TObject
    Int_t   Contains(Int_t entry);
    void    OptimizeStorage();
    Int_t   Merge(TEntryListBlock *block);
+   Int_t   Subtract(TEntryListBlock *block);
    Int_t   Next();
    Int_t   GetEntry(Int_t entry);
    void    ResetIndices() {fLastIndexQueried = -1, fLastIndexReturned = -1;}
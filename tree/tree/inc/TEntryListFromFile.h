@@ -62,6 +62,7 @@ public:
    ~TEntryListFromFile() override;
    void        Add(const TEntryList * /* elist */) override {};
    Int_t       Contains(Long64_t /* entry */, TTree * /* tree = 0 */) override { return 0; };
+   bool        ContainsRange(Long64_t /* min */, Long64_t /* max */, Int_t /* treenum = -1 */) override { return true; };
    bool        Enter(Long64_t /* entry */, TTree * /* tree = 0 */) override { return false; };
    bool        Enter(Long64_t /* entry */, const char * /* treename */, const char * /* filename */) override { return false; };
    TEntryList *GetCurrentList() const override { return fCurrent; };
@@ -73,6 +73,11 @@ class TBasket;
 class TStreamerInfo;
 class TTreeCache;
 class TTreeCloner;
+namespace ROOT {
+namespace Internal {
+class TBranchIMTHelper;
+}
+}
 class TFileMergeInfo;
 class TVirtualPerfStats;
 
@@ -159,10 +164,13 @@ private:
    mutable bool fIMTFlush{false};               ///<! True if we are doing a multithreaded flush.
    mutable std::atomic<Long64_t> fIMTTotBytes;    ///<! Total bytes for the IMT flush baskets
    mutable std::atomic<Long64_t> fIMTZipBytes;    ///<! Zip bytes for the IMT flush baskets.
+   bool fIMTFillPipeline{false};                  ///<! True if TTree::Fill lets basket compression overlap with the next entries.
+   ROOT::Internal::TBranchIMTHelper *fIMTFillTasks{nullptr}; ///<! Basket write tasks still running from previous TTree::Fill calls.
 
    void             InitializeBranchLists(bool checkLeafCount);
    void             SortBranchesByTime();
    Int_t            FlushBasketsImpl() const;
+   void             WaitIMTFillPipeline() const;
    void             MarkEventCluster();
    Long64_t         GetMedianClusterSize();
 
@@ -518,6 +526,7 @@ public:
    virtual const char     *GetFriendAlias(TTree*) const;
            TH1            *GetHistogram() { return GetPlayer()->GetHistogram(); }
    virtual bool            GetImplicitMT() { return fIMTEnabled; }
+           bool            GetIMTFillPipeline() const { return fIMTFillPipeline; }
    virtual Int_t          *GetIndex() { return &fIndex.fArray[0]; }
    virtual Double_t       *GetIndexValues() { return &fIndexValues.fArray[0]; }
            ROOT::TIOFeatures GetIOFeatures() const;
@@ -659,6 +668,7 @@ public:
    virtual void            SetEventList(TEventList* list);
    virtual void            SetEntryList(TEntryList* list, Option_t *opt="");
    virtual void            SetImplicitMT(bool enabled) { fIMTEnabled = enabled; }
+           void            SetIMTFillPipeline(bool enabled);
    virtual void            SetMakeClass(Int_t make);
    virtual void            SetMaxEntryLoop(Long64_t maxev = kMaxEntries) { fMaxEntryLoop = maxev; } // *MENU*
    static  void            SetMaxTreeSize(Long64_t maxsize = 100000000000LL);
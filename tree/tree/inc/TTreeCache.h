@@ -64,6 +64,8 @@ protected:
    EPrefillType fPrefillType;         ///<  Whether a pre-filling is enabled (and if applicable which type)
    static Int_t fgLearnEntries;       ///<  number of entries used for learning mode
    bool         fAutoCreated{false}; ///<! true if cache was automatically created
+   Long64_t     fPrefetchMemoryLimit{0}; ///<! Maximum number of bytes held by both prefetching buffers (0: no limit)
+   Double_t     fSparseReadDensity{0.5}; ///<! Entry list density below which only the selected baskets are read
 
    bool         fLearnPrefilling{false}; ///<! true if we are in the process of executing LearnPrefill
 
@@ -124,6 +126,8 @@ private:
    TBranch *CalculateMissEntries(Long64_t, int, bool);    ///< Given an file read, try to determine the corresponding branch.
    bool     ProcessMiss(Long64_t pos, int len); ///<! Given a file read not in the miss cache, handle (possibly) loading the data.
 
+   Int_t GetFillBufferLimit() const; ///< Number of bytes FillBuffer may gather into the buffer being filled.
+
 public:
 
    TTreeCache();
@@ -144,6 +148,8 @@ public:
    virtual Int_t        GetEntryMax() const {return fEntryMax;}
    static Int_t         GetLearnEntries();
    virtual EPrefillType GetLearnPrefill() const {return fPrefillType;}
+   Long64_t             GetPrefetchMemoryLimit() const {return fPrefetchMemoryLimit;}
+   Double_t             GetSparseReadDensity() const {return fSparseReadDensity;}
    Double_t             GetMissEfficiency() const;
    Double_t             GetMissEfficiencyRel() const;
    TTree               *GetTree() const {return fTree;}
@@ -163,11 +169,14 @@ public:
    void                 ResetMissCache(); // Reset the miss cache.
    void                 SetAutoCreated(bool val) {fAutoCreated = val;}
    Int_t                SetBufferSize(Long64_t buffersize) override;
+   void                 SetEnablePrefetching(Bool_t setPrefetching = kFALSE) override;
    virtual void         SetEntryRange(Long64_t emin,   Long64_t emax);
    void                 SetFile(TFile *file, TFile::ECacheAction action=TFile::kDisconnect) override;
    virtual void         SetLearnPrefill(EPrefillType type = kNoPrefill);
    static void          SetLearnEntries(Int_t n = 10);
    void                 SetOptimizeMisses(bool opt);
+   void                 SetPrefetchMemoryLimit(Long64_t limit);
+   void                 SetSparseReadDensity(Double_t density);
    void                 StartLearningPhase();
    virtual void         StopLearningPhase();
    virtual void         UpdateBranches(TTree *tree);
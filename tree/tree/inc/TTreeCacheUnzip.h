@@ -94,7 +94,7 @@ protected:
 
    // Unzipping related members
    Int_t       fNseekMax;         ///<!  fNseek can change so we need to know its max size
-   Int_t       fUnzipGroupSize;   ///<!  Min accumulated size of a group of baskets ready to be unzipped by a IMT task
+   Int_t       fUnzipGroupSize;   ///<!  Unused, IMT unzip tasks pull single baskets (see CreateTasks())
    Long64_t    fUnzipBufferSize;  ///<!  Max Size for the ready unzipped blocks (default is 2*fBufferSize)
 
    static Double_t fgRelBuffSize; ///< This is the percentage of the TTreeCacheUnzip that will be used
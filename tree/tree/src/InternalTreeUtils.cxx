@@ -20,8 +20,11 @@
 #include "TSystem.h"
 #include "TSystemFile.h"
 #include "TTree.h"
+#include "TUrl.h"
 #include "TVirtualIndex.h"
 
+#include <algorithm> // std::lower_bound
+#include <cstring>   // std::strcmp
 #include <limits>
 #include <utility> // std::pair
 #include <vector>
@@ -523,14 +526,15 @@ std::vector<std::string> ExpandGlob(const std::string &glob)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// \brief Returns the cluster boundaries and number of entries of the input tree.
+/// \brief Returns the cluster boundaries, number of entries and data location of the input tree.
 /// \param[in] treename Name of the tree.
-/// \param[in] filename Path to the file.
-/// \return a pair (cluster_boundaries, n_entries). The vector of cluster
-///         of cluster boundaries contains the beginning entry of the first
-///         cluster up to the ending entry of the last cluster, e.g. for a tree
-///         with 3 clusters of 10 entries each, this will return [0, 10, 20, 30]
-std::pair<std::vector<Long64_t>, Long64_t> GetClustersAndEntries(std::string_view treename, std::string_view path)
+/// \param[in] path Path to the file.
+///
+/// The host is the one the file data is actually read from: for a file opened
+/// through an XRootD redirector (e.g. EOS), the data server holding the replica
+/// that was chosen. Distributed schedulers can use it to prefer co-located
+/// workers.
+RTreeClusterInfo GetTreeClusterInfo(std::string_view treename, std::string_view path)
 {
    ::TDirectory::TContext ctxt; // Avoid changing gDirectory;
    std::unique_ptr<TFile> inFile{TFile::Open(path.data(), "READ_WITHOUT_GLOBALREGISTRATION")};
@@ -540,18 +544,73 @@ std::pair<std::vector<Long64_t>, Long64_t> GetClustersAndEntries(std::string_vie
    if (!tree)
       throw std::invalid_argument("GetClustersAndEntries: could not find tree \"" + std::string(treename) +
                                   "\" in file \"" + std::string(path) + "\".");
+   RTreeClusterInfo info;
    // One TTree in one file, we can assume GetEntriesFast returns the correct number of entries
-   auto nEntries{tree->GetEntriesFast()};
+   info.fNEntries = tree->GetEntriesFast();
 
    auto clusterIt{tree->GetClusterIterator(0)};
    auto clusterBegin{clusterIt()};
-   std::vector boundaries{clusterBegin};
-   while (clusterBegin < nEntries) {
+   info.fClusterBoundaries.push_back(clusterBegin);
+   while (clusterBegin < info.fNEntries) {
       clusterBegin = clusterIt();
-      boundaries.push_back(clusterBegin);
+      info.fClusterBoundaries.push_back(clusterBegin);
    }
 
-   return std::make_pair(std::move(boundaries), std::move(nEntries));
+   const TUrl *url = inFile->GetEndpointUrl();
+   if (url && std::strcmp(url->GetProtocol(), "file") != 0)
+      info.fHost = url->GetHost();
+
+   return info;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns the cluster boundaries and number of entries of the input tree.
+/// \param[in] treename Name of the tree.
+/// \param[in] filename Path to the file.
+/// \return a pair (cluster_boundaries, n_entries). The vector of cluster
+///         of cluster boundaries contains the beginning entry of the first
+///         cluster up to the ending entry of the last cluster, e.g. for a tree
+///         with 3 clusters of 10 entries each, this will return [0, 10, 20, 30]
+std::pair<std::vector<Long64_t>, Long64_t> GetClustersAndEntries(std::string_view treename, std::string_view path)
+{
+   auto info = GetTreeClusterInfo(treename, path);
+   return std::make_pair(std::move(info.fClusterBoundaries), info.fNEntries);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Split a sequence of clusters into entry ranges that start and end at cluster boundaries.
+/// \param[in] clusterBoundaries The cluster boundaries, as returned by GetClustersAndEntries.
+/// \param[in] nRanges The desired number of ranges.
+/// \return At most `nRanges` contiguous, non-empty ranges covering all clusters.
+///
+/// Each range ends at the cluster boundary that is closest to where it would
+/// end if the entries were split evenly, so no cluster is read by two ranges.
+/// Fewer ranges are returned if there are not enough clusters.
+std::vector<std::pair<Long64_t, Long64_t>>
+MakeClusterAlignedRanges(const std::vector<Long64_t> &clusterBoundaries, unsigned int nRanges)
+{
+   std::vector<std::pair<Long64_t, Long64_t>> ranges;
+   if (clusterBoundaries.size() < 2 || nRanges == 0)
+      return ranges;
+
+   const auto first = clusterBoundaries.front();
+   const auto nEntries = clusterBoundaries.back() - first;
+   const auto end = clusterBoundaries.end();
+   auto rangeBegin = clusterBoundaries.begin();
+   for (unsigned int i = 1; i <= nRanges && rangeBegin != end - 1; ++i) {
+      auto rangeEnd = end - 1;
+      if (i < nRanges) {
+         const Long64_t idealEnd = first + nEntries * i / nRanges;
+         rangeEnd = std::min(std::lower_bound(rangeBegin + 1, end, idealEnd), end - 1);
+         if (rangeEnd != rangeBegin + 1 && *rangeEnd - idealEnd > idealEnd - *(rangeEnd - 1))
+            --rangeEnd;
+      }
+      if (*rangeEnd > *rangeBegin) {
+         ranges.emplace_back(*rangeBegin, *rangeEnd);
+         rangeBegin = rangeEnd;
+      }
+   }
+   return ranges;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1209,7 +1209,9 @@ Int_t TBasket::WriteBuffer()
    fObjlen = fBufferRef->Length() - fKeylen;
 
    fHeaderOnly = true;
-   fCycle = fBranch->GetWriteBasket();
+   // A basket written by a pipelined TTree::Fill task no longer is the branch's write basket.
+   fCycle = (fWriteCycle >= 0) ? fWriteCycle : fBranch->GetWriteBasket();
+   fWriteCycle = -1;
    Int_t cxlevel = fBranch->GetCompressionLevel();
    if (cxlevel == ROOT::RCompressionSetting::ELevel::kInherit)
       cxlevel = file->GetCompressionLevel();
@@ -43,6 +43,7 @@
 #include "TTree.h"
 #include "TTreeCache.h"
 #include "TTreeCacheUnzip.h"
+#include "TVirtualCollectionProxy.h"
 #include "TVirtualMutex.h"
 #include "TVirtualPad.h"
 #include "TVirtualPerfStats.h"
@@ -1684,6 +1685,195 @@ Int_t TBranch::GetEntriesSerialized(Long64_t entry, TBuffer &user_buf, TBuffer *
    return N;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Read a basket of events of variable size into the given buffer with
+///        byte swapping.
+///
+/// \return On success, the number of events held by this branch that have been
+///         read into the buffer. -1 on failure.
+///
+/// This extends GetBulkEntries(Long64_t, TBuffer&) to branches whose entries
+/// have a variable number of elements, namely
+///   - leaves with a leaf count, e.g. `"arr[n]/F"`;
+///   - TBranchElement holding a `std::vector` of a fundamental type (top-level or
+///     data member of a split object).
+/// Branches with a fixed number of elements per entry are supported as well.
+///
+/// On success, the values of all the entries are stored back to back, in host
+/// byte order, starting at `user_buf.GetCurrent()` and `offsets` holds N+1
+/// elements: the values of the i-th entry read are the ones from index
+/// `offsets[i]` (included) to `offsets[i+1]` (excluded) of
+///
+/// ~~~{.cpp}
+/// static_cast<T*>(buf.GetCurrent())
+/// ~~~
+///
+/// where T is the type of the elements stored on this branch.  For `std::vector`
+/// branches, the per-entry header (byte count, version and collection size) is
+/// stripped from the buffer in place.
+///
+/// \note This interface is not meant to be exposed to end users, but rather it should
+///       be wrapped by higher-level interfaces.
+
+Int_t TBranch::GetBulkEntries(Long64_t entry, TBuffer &user_buf, std::vector<Int_t> &offsets)
+{
+   offsets.clear();
+
+   // TODO: eventually support multiple leaves.
+   if (R__unlikely(fNleaves != 1)) return -1;
+   TLeaf *leaf = static_cast<TLeaf*>(fLeaves.UncheckedAt(0));
+
+   // Find out how the elements of each entry are laid out in the basket.
+   Int_t elemSize = 0;
+   bool isCollection = false;
+   if (leaf->GetDeserializeType() != TLeaf::DeserializeType::kExternal) {
+      if (!leaf->GetLeafCount()) {
+         // All the entries have the same number of elements.
+         if (R__unlikely(fEntryOffsetLen))
+            return -1;
+         Int_t N = GetBulkEntries(entry, user_buf);
+         if (R__unlikely(N < 0))
+            return -1;
+         offsets.resize(N + 1);
+         for (Int_t i = 0; i <= N; ++i)
+            offsets[i] = i * leaf->GetLen();
+         return N;
+      }
+      elemSize = leaf->GetLenType();
+   } else {
+      TClass *clptr = nullptr;
+      EDataType type = kOther_t;
+      if (GetExpectedType(clptr, type) || !clptr)
+         return -1;
+      TVirtualCollectionProxy *proxy = clptr->GetCollectionProxy();
+      if (!proxy || proxy->GetCollectionType() != ROOT::kSTLvector || proxy->GetValueClass())
+         return -1;
+      switch (proxy->GetType()) {
+      case kChar_t: case kUChar_t: case kShort_t: case kUShort_t: case kInt_t: case kUInt_t:
+      case kFloat_t: case kDouble_t: case kLong64_t: case kULong64_t: break;
+      default: return -1; // Notably excludes vector<bool>, Float16_t and Double32_t.
+      }
+      elemSize = proxy->GetIncrement();
+      isCollection = true;
+   }
+
+   // Remember which entry we are reading.
+   fReadEntry = entry;
+
+   bool enabled = !TestBit(kDoNotProcess);
+   if (R__unlikely(!enabled)) return -1;
+   TBasket *basket = nullptr;
+   Long64_t first;
+   Int_t result = GetBasketAndFirst(basket, first, &user_buf);
+   if (R__unlikely(result < 0)) return -1;
+   // Only support reading from full clusters.
+   if (R__unlikely(entry != first)) return -1;
+
+   basket->PrepareBasket(entry);
+   TBuffer* buf = basket->GetBufferRef();
+
+   // Test for very old ROOT files.
+   if (R__unlikely(!buf)) {
+      Error("GetBulkEntries", "Failed to get a new buffer.\n");
+      return -1;
+   }
+   // Test for displacements, which aren't supported in fast mode.
+   if (R__unlikely(basket->GetDisplacement())) {
+      Error("GetBulkEntries", "Basket has displacement.\n");
+      return -1;
+   }
+   const Int_t *entryOffset = basket->GetEntryOffset();
+   if (R__unlikely(!entryOffset)) {
+      Error("GetBulkEntries", "Basket of a variable size branch has no entry offsets.\n");
+      return -1;
+   }
+
+   Int_t bufend = basket->GetLast();
+   if (&user_buf != buf) {
+      // The basket was already in memory and might (and might not) be backed by persistent
+      // storage.
+      R__ASSERT(result == fReadBasket);
+      if (fBasketSeek[fReadBasket]) {
+         // It is backed, so we can be destructive
+         user_buf.SetBuffer(buf->Buffer(), buf->BufferSize());
+         buf->ResetBit(TBufferIO::kIsOwner);
+         fCurrentBasket = nullptr;
+         fBaskets[fReadBasket] = nullptr;
+      } else {
+         // This is the only copy, we can't return it as is to the user, just make a copy.
+         // The basket is still being filled: its content ends at the current write position.
+         bufend = buf->Length();
+         if (user_buf.BufferSize() < buf->BufferSize()) {
+            user_buf.AutoExpand(buf->BufferSize());
+         }
+         memcpy(user_buf.Buffer(), buf->Buffer(), buf->BufferSize());
+      }
+   }
+
+   Int_t bufbegin = basket->GetKeylen();
+   Int_t N = ((fNextBasketEntry < 0) ? fEntryNumber : fNextBasketEntry) - first;
+
+   // Compute the offsets and, for collections, move the values of each entry
+   // next to the ones of the previous entry.
+   bool failed = false;
+   offsets.resize(N + 1);
+   offsets[0] = 0;
+   char *values = user_buf.Buffer() + bufbegin;
+   for (Int_t i = 0; i < N; ++i) {
+      const Int_t begin = entryOffset[i];
+      const Int_t end = (i + 1 < N) ? entryOffset[i + 1] : bufend;
+      if (R__unlikely(begin < bufbegin || end < begin || end > bufend)) {
+         failed = true;
+         break;
+      }
+      Int_t nbytes = end - begin;
+      const char *payload = user_buf.Buffer() + begin;
+      if (isCollection) {
+         user_buf.SetBufferOffset(begin);
+         user_buf.ReadVersion();
+         Int_t nelems = 0;
+         user_buf >> nelems;
+         payload = user_buf.GetCurrent();
+         nbytes = nelems * elemSize;
+         if (R__unlikely(nelems < 0 || payload + nbytes != user_buf.Buffer() + end)) {
+            failed = true;
+            break;
+         }
+         memmove(values + offsets[i] * elemSize, payload, nbytes);
+      } else if (R__unlikely(nbytes % elemSize || payload != values + offsets[i] * elemSize)) {
+         // Values of leaves with a leaf count are expected to be already contiguous.
+         failed = true;
+         break;
+      }
+      offsets[i + 1] = offsets[i] + nbytes / elemSize;
+   }
+
+   if (fCurrentBasket == nullptr) {
+      R__ASSERT(fExtraBasket == nullptr && "fExtraBasket should have been set to nullptr by GetFreshBasket");
+      fExtraBasket = basket;
+      basket->DisownBuffer();
+   }
+
+   user_buf.SetBufferOffset(bufbegin);
+   if (R__unlikely(failed)) {
+      Error("GetBulkEntries", "Unexpected layout of the entries of the basket.\n");
+      offsets.clear();
+      return -1;
+   }
+
+   if (elemSize > 1) {
+      static constexpr EDataType kSwapType[] = {kOther_t, kOther_t, kShort_t, kOther_t, kInt_t,
+                                                kOther_t, kOther_t, kOther_t, kLong64_t};
+      if (R__unlikely(elemSize > 8 || !user_buf.ByteSwapBuffer(offsets[N], kSwapType[elemSize]))) {
+         Error("GetBulkEntries", "Leaf failed to read.\n");
+         offsets.clear();
+         return -1;
+      }
+   }
+
+   return N;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read all leaves of entry and return total number of bytes read.
 ///
@@ -3265,7 +3455,48 @@ Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBr
       }
       return nout;
    };
-   if (imtHelper) {
+   if (imtHelper && imtHelper->IsPipelined() && where == fWriteBasket) {
+      // Pipelined TTree::Fill: switch to a fresh write basket right away and let the task
+      // compress and write the full one while the following entries are being filled.
+      // At most one basket per branch is in flight; wait for the previous one otherwise.
+      if (fIMTPendingWrite.load(std::memory_order_acquire))
+         imtHelper->Wait();
+      fBaskets[where] = nullptr;
+      --fNBaskets;
+      if (basket == fCurrentBasket) {
+         fCurrentBasket    = nullptr;
+         fFirstBasketEntry = -1;
+         fNextBasketEntry  = -1;
+      }
+      ++fWriteBasket;
+      if (fWriteBasket >= fMaxBaskets) {
+         ExpandBasketArrays();
+      }
+      fBaskets.AddAtAndExpand(nullptr, fWriteBasket);
+      fBasketEntry[fWriteBasket] = fEntryNumber;
+      basket->SetWriteCycle(where);
+      fIMTPendingWrite.store(true, std::memory_order_release);
+
+      imtHelper->Run([this, basket, where, imtHelper]() {
+         Int_t nout = basket->WriteBuffer();
+         if (nout < 0)
+            Error("WriteBasketImpl", "basket's WriteBuffer failed.");
+         fBasketBytes[where] = basket->GetNbytes();
+         fBasketSeek[where]  = basket->GetSeekKey();
+         if (nout > 0) {
+            Int_t addbytes = basket->GetObjlen() + basket->GetKeylen();
+            fZipBytes += nout;
+            fTotBytes += addbytes;
+            imtHelper->AddTotBytes(addbytes);
+            imtHelper->AddZipBytes(nout);
+         }
+         basket->DropBuffers();
+         delete basket;
+         fIMTPendingWrite.store(false, std::memory_order_release);
+         return nout;
+      });
+      return 0;
+   } else if (imtHelper) {
       imtHelper->Run(doUpdates);
       return 0;
    } else {
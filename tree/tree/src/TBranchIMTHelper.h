@@ -14,12 +14,19 @@
 
 #include "RtypesCore.h"
 
+#include <atomic>
+#include <memory>
+
 #ifdef R__USE_IMT
 #include "ROOT/TTaskGroup.hxx"
 #endif
 
 /** \class ROOT::Internal::TBranchIMTHelper
  A helper class for managing IMT work during TTree:Fill operations.
+
+ A pipelined helper outlives a single TTree::Fill call (see TTree::SetIMTFillPipeline):
+ the baskets it writes keep being compressed while the next entries are filled, and
+ their byte counts are accumulated until the tree collects them.
 */
 
 namespace ROOT {
@@ -32,6 +39,9 @@ using TaskGroup_t = ROOT::Experimental::TTaskGroup;
 #endif
 
 public:
+   TBranchIMTHelper() = default;
+   explicit TBranchIMTHelper(bool pipelined) : fPipelined(pipelined) {}
+
    template<typename FN> void Run(const FN &lambda) {
 #ifdef R__USE_IMT
       if (!fGroup) { fGroup.reset(new TaskGroup_t()); }
@@ -57,7 +67,18 @@ public:
    Long64_t GetNbytes() { return fBytes; }
    Long64_t GetNerrors() {  return fNerrors; }
 
+   bool IsPipelined() const { return fPipelined; }
+   void AddTotBytes(Long64_t tot) { fTotBytes += tot; }
+   void AddZipBytes(Long64_t zip) { fZipBytes += zip; }
+   /// Return the byte counts accumulated since the previous call and reset them.
+   Long64_t TakeTotBytes() { return fTotBytes.exchange(0); }
+   Long64_t TakeZipBytes() { return fZipBytes.exchange(0); }
+   Int_t    TakeNerrors() { return fNerrors.exchange(0); }
+
 private:
+   bool fPipelined{false};            ///< True if the tasks may run across several TTree::Fill calls.
+   std::atomic<Long64_t> fTotBytes{0}; ///< Uncompressed bytes of the baskets written by a pipelined helper.
+   std::atomic<Long64_t> fZipBytes{0}; ///< Compressed bytes of the baskets written by a pipelined helper.
    std::atomic<Long64_t> fBytes{0};   ///< Total number of bytes written by this helper.
    std::atomic<Int_t>    fNerrors{0}; ///< Total error count of all tasks done by this helper.
 #ifdef R__USE_IMT
@@ -27,9 +27,12 @@ the trees in the chain.
 #include "TChain.h"
 #include "ROOT/InternalTreeUtils.hxx"
 
+#include <algorithm>
 #include <iostream>
 #include <cfloat>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "TBranch.h"
 #include "TBrowser.h"
@@ -64,6 +67,10 @@ the trees in the chain.
 #include "strlcpy.h"
 #include "snprintf.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
 ClassImp(TChain);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -984,12 +991,68 @@ Long64_t TChain::GetEntries() const
                                " run TChain::SetProof(true, true) first");
       return fProofChain->GetEntries();
    }
+   if (fEntries == TTree::kMaxEntries) {
+      const_cast<TChain*>(this)->CountEntriesConcurrently();
+   }
    if (fEntries == TTree::kMaxEntries) {
       const_cast<TChain*>(this)->LoadTree(TTree::kMaxEntries-1);
    }
    return fEntries;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// If implicit multi-threading is enabled, open the files of the chain elements
+/// whose number of entries is not yet known concurrently and update the offset
+/// table with the number of entries of their trees. For chains of many files,
+/// in particular remote ones, this is much faster than opening the files one
+/// after the other in LoadTree.
+/// Elements whose file or tree cannot be read are left as they are, LoadTree
+/// reports the error once it reaches them.
+
+void TChain::CountEntriesConcurrently()
+{
+#ifdef R__USE_IMT
+   if (!fIMTEnabled || !ROOT::IsImplicitMTEnabled())
+      return;
+
+   std::vector<TChainElement *> elements;
+   for (Int_t i = 0; i < fNtrees; ++i) {
+      auto element = static_cast<TChainElement *>(fFiles->UncheckedAt(i));
+      if (element->GetEntries() == TTree::kMaxEntries)
+         elements.emplace_back(element);
+   }
+   if (elements.size() < 2)
+      return;
+
+   ROOT::TThreadExecutor pool;
+   pool.Foreach(
+      [](TChainElement *element) {
+         TDirectory::TContext ctxt;
+         std::unique_ptr<TFile> file(TFile::Open(element->GetTitle(), "READ_WITHOUT_GLOBALREGISTRATION"));
+         if (!file || file->IsZombie())
+            return;
+         auto tree = file->Get<TTree>(element->GetName());
+         if (!tree)
+            return;
+         // Avoid calling TROOT::RecursiveRemove for this tree, it takes the read lock and we don't need it.
+         tree->ResetBit(kMustCleanup);
+         ROOT::Internal::TreeUtils::ClearMustCleanupBits(*tree->GetListOfBranches());
+         element->SetNumberEntries(tree->GetEntries());
+      },
+      elements);
+
+   // The offsets are known up to the first element whose number of entries is still unknown.
+   for (Int_t i = 0; i < fNtrees; ++i) {
+      const Long64_t nentries = static_cast<TChainElement *>(fFiles->UncheckedAt(i))->GetEntries();
+      if (fTreeOffset[i] == TTree::kMaxEntries || nentries == TTree::kMaxEntries)
+         fTreeOffset[i + 1] = TTree::kMaxEntries;
+      else
+         fTreeOffset[i + 1] = fTreeOffset[i] + nentries;
+   }
+   fEntries = fTreeOffset[fNtrees];
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Get entry from the file to memory.
 ///
@@ -1345,15 +1408,10 @@ Long64_t TChain::LoadTree(Long64_t entry)
    Int_t treenum = fTreeNumber;
    if ((fTreeNumber == -1) || (entry < fTreeOffset[fTreeNumber]) || (entry >= fTreeOffset[fTreeNumber+1]) || (entry==TTree::kMaxEntries-1)) {
       // -- Entry is *not* in the chain's current tree.
-      // Do a linear search of the tree offset array.
-      // FIXME: We could be smarter by starting at the
-      //        current tree number and going forwards,
-      //        then wrapping around at the end.
-      for (treenum = 0; treenum < fNtrees; treenum++) {
-         if (entry < fTreeOffset[treenum+1]) {
-            break;
-         }
-      }
+      // The tree offset array is non-decreasing (trees whose number of entries
+      // is not yet known have an offset of kMaxEntries), so do a binary search
+      // for the first tree ending after the entry.
+      treenum = std::upper_bound(fTreeOffset + 1, fTreeOffset + fNtrees + 1, entry) - (fTreeOffset + 1);
    }
 
    // Calculate the entry number relative to the found tree.
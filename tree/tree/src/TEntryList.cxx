@@ -161,6 +161,8 @@ End_Macro
 #include "TSystem.h"
 #include "TObjString.h"
 
+#include <algorithm>
+
 ClassImp(TEntryList);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -615,6 +617,52 @@ Int_t TEntryList::Contains(Long64_t entry, TTree *tree)
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if at least one entry in [min, max] is in the list.
+///
+/// The entries are local to a tree. If this list has sub-lists, the one
+/// corresponding to the tree number `treenum` in the chain is used (the
+/// current sub-list if `treenum` is negative). Used by TTreeCache to skip the
+/// baskets that do not hold any selected entry.
+
+bool TEntryList::ContainsRange(Long64_t min, Long64_t max, Int_t treenum)
+{
+   if (fLists) {
+      TEntryList *sublist = nullptr;
+      if (treenum < 0) {
+         sublist = fCurrent;
+      } else {
+         TIter next(fLists);
+         while (auto elist = static_cast<TEntryList *>(next())) {
+            if (elist->GetTreeNumber() == treenum) {
+               sublist = elist;
+               break;
+            }
+         }
+      }
+      return sublist && sublist->ContainsRange(min, max);
+   }
+   if (!fBlocks || max < min)
+      return false;
+   if (treenum >= 0 && fTreeNumber >= 0 && fTreeNumber != treenum)
+      return false;
+   if (min < 0)
+      min = 0;
+   for (Int_t nblock = min / kBlockSize; nblock <= max / kBlockSize && nblock < fNBlocks; ++nblock) {
+      auto block = static_cast<TEntryListBlock *>(fBlocks->UncheckedAt(nblock));
+      if (!block || block->GetNPassed() == 0)
+         continue;
+      const Long64_t offset = Long64_t(nblock) * kBlockSize;
+      const Int_t first = std::max(min, offset) - offset;
+      const Int_t last = std::min(max, offset + kBlockSize - 1) - offset;
+      for (Int_t entry = first; entry <= last; ++entry) {
+         if (block->Contains(entry))
+            return true;
+      }
+   }
+   return false;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Called by TKey and others to automatically add us to a directory when we are read from a file.
 
@@ -1341,13 +1389,18 @@ void TEntryList::Subtract(const TEntryList *elist)
          //second list is also only for 1 tree
          if (!strcmp(elist->fTreeName.Data(),fTreeName.Data()) &&
              !strcmp(elist->fFileName.Data(),fFileName.Data())){
-            //same tree
-            Long64_t n2 = elist->GetN();
-            Long64_t entry;
-            for (Int_t i=0; i<n2; i++){
-               entry = (const_cast<TEntryList*>(elist))->GetEntry(i);
-               Remove(entry);
+            //same tree, subtract block by block
+            if (!elist->fBlocks) return;
+            Int_t nmin = TMath::Min(fNBlocks, elist->fNBlocks);
+            for (Int_t i=0; i<nmin; i++){
+               TEntryListBlock *block1 = (TEntryListBlock*)fBlocks->UncheckedAt(i);
+               TEntryListBlock *block2 = (TEntryListBlock*)elist->fBlocks->UncheckedAt(i);
+               Long64_t nold = block1->GetNPassed();
+               Long64_t nnew = block1->Subtract(block2);
+               fN = fN - nold + nnew;
             }
+            fLastIndexQueried = -1;
+            fLastIndexReturned = 0;
          } else {
             //different trees
             return;
@@ -38,6 +38,8 @@ End_Macro
  - __Merge__() - adds all entries from one block to the other. If the first block
              uses array representation, it's changed to bits representation only
              if the total number of passing entries is still less than kBlockSize
+ - __Subtract__() - removes all entries of one block from the other. Like Merge(), it
+             works on the bits representation 16 entries at a time
  - __GetEntry(n)__ - returns n-th non-zero entry.
  - __Next__()      - return next non-zero entry. In case of representation 1), Next()
                  is faster than GetEntry()
@@ -46,6 +48,9 @@ End_Macro
 #include "TEntryListBlock.h"
 #include "TString.h"
 
+#include <algorithm>
+#include <bitset>
+
 ClassImp(TEntryListBlock);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -206,34 +211,15 @@ Int_t TEntryListBlock::Contains(Int_t entry)
       bool result = (fIndices[i] & (1<<j))!=0;
       return result;
    }
-   //list
-   if (entry < fCurrent) fCurrent = 0;
-   if (fPassing && fIndices){
-      for (Int_t i = fCurrent; i<fNPassed; i++){
-         if (fIndices[i]==entry){
-            fCurrent = i;
-            return true;
-         }
-      }
-   } else {
-      if (!fIndices || fNPassed==0){
-         //all entries pass
-         return true;
-      }
-      if (entry > fIndices[fNPassed-1])
-         return true;
-      for (Int_t i= fCurrent; i<fNPassed; i++){
-         if (fIndices[i]==entry){
-            fCurrent = i;
-            return false;
-         }
-         if (fIndices[i]>entry){
-            fCurrent = i;
-            return true;
-         }
-      }
+   //list, sorted
+   if (!fIndices || fNPassed==0){
+      //no entries pass (fPassing=1) or all entries pass (fPassing=0)
+      return !fPassing;
    }
-   return 0;
+   const UShort_t *found = std::lower_bound(fIndices, fIndices + fNPassed, entry);
+   fCurrent = found - fIndices;
+   const bool inList = found != fIndices + fNPassed && *found == entry;
+   return inList == fPassing;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -242,7 +228,7 @@ Int_t TEntryListBlock::Contains(Int_t entry)
 
 Int_t TEntryListBlock::Merge(TEntryListBlock *block)
 {
-   Int_t i, j;
+   Int_t i;
    if (block->GetNPassed() == 0) return GetNPassed();
    if (GetNPassed() == 0){
       //this block is empty
@@ -259,35 +245,13 @@ Int_t TEntryListBlock::Merge(TEntryListBlock *block)
       return fNPassed;
    }
    if (fType==0){
-      //stored as bits
-      if (block->fType == 0){
-         for (i=0; i<kBlockSize*16; i++){
-            if (block->Contains(i))
-               Enter(i);
-         }
-      } else {
-         if (block->fPassing){
-            //the other block stores entries that pass
-            for (i=0; i<block->fNPassed; i++){
-               Enter(block->fIndices[i]);
-            }
-         } else {
-            //the other block stores entries that don't pass
-            if (block->fNPassed==0){
-               for (i=0; i<kBlockSize*16; i++){
-                  Enter(i);
-               }
-            }
-            for (j=0; j<block->fIndices[0]; j++)
-               Enter(j);
-            for (i=0; i<block->fNPassed-1; i++){
-               for (j=block->fIndices[i]+1; j<block->fIndices[i+1]; j++){
-                  Enter(j);
-               }
-            }
-            for (j=block->fIndices[block->fNPassed-1]+1; j<kBlockSize*16; j++)
-               Enter(j);
-         }
+      //stored as bits, merge 16 entries at a time
+      UShort_t bits[kBlockSize];
+      block->FillBits(bits);
+      fNPassed = 0;
+      for (i=0; i<kBlockSize; i++){
+         fIndices[i] |= bits[i];
+         fNPassed += std::bitset<16>(fIndices[i]).count();
       }
    } else {
       //stored as a list
@@ -363,6 +327,31 @@ Int_t TEntryListBlock::Merge(TEntryListBlock *block)
    return GetNPassed();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Remove the entries of the other block from this block
+/// Returns the resulting number of entries in the block
+
+Int_t TEntryListBlock::Subtract(TEntryListBlock *block)
+{
+   if (GetNPassed() == 0 || block->GetNPassed() == 0) return GetNPassed();
+   if (fType!=0){
+      //change to bits
+      UShort_t *bits = new UShort_t[kBlockSize];
+      Transform(true, bits);
+   }
+   UShort_t bits[kBlockSize];
+   block->FillBits(bits);
+   fNPassed = 0;
+   for (Int_t i=0; i<kBlockSize; i++){
+      fIndices[i] &= ~bits[i];
+      fNPassed += std::bitset<16>(fIndices[i]).count();
+   }
+   fLastIndexQueried = -1;
+   fLastIndexReturned = -1;
+   OptimizeStorage();
+   return GetNPassed();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns the number of entries, passing the selection.
 /// In case, when the block stores entries that pass (fPassing=1) returns fNPassed
@@ -556,6 +545,23 @@ void TEntryListBlock::OptimizeStorage()
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill bits, an array of kBlockSize UShort_ts, with the bits representation
+/// of the entries of this block, without changing the representation of the block
+
+void TEntryListBlock::FillBits(UShort_t *bits) const
+{
+   if (fType==0){
+      std::copy(fIndices, fIndices + kBlockSize, bits);
+      return;
+   }
+   //a list of the entries that pass starts from no entry, one of the entries that don't pass from all entries
+   std::fill(bits, bits + kBlockSize, (fType==1 && !fPassing) ? 0xFFFF : 0);
+   if (fType!=1 || !fIndices) return;
+   for (Int_t i=0; i<fNPassed; i++)
+      bits[fIndices[i]>>4] ^= 1<<(fIndices[i] & 15);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Transform the existing fIndices
 /// - dir=0 - transform from bits to a list
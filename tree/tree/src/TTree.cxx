@@ -920,6 +920,11 @@ TTree::TTree(const char* name, const char* title, Int_t splitlevel /* = 99 */,
 
 TTree::~TTree()
 {
+   if (fIMTFillTasks) {
+      WaitIMTFillPipeline();
+      delete fIMTFillTasks;
+      fIMTFillTasks = nullptr;
+   }
    if (auto link = dynamic_cast<TNotifyLinkBase*>(fNotify)) {
       link->Clear();
    }
@@ -1501,6 +1506,8 @@ TFriendElement *TTree::AddFriend(TTree *tree, const char *alias, bool warn)
 Long64_t TTree::AutoSave(Option_t* option)
 {
    if (!fDirectory || fDirectory == gROOT || !fDirectory->IsWritable()) return 0;
+   // The saved header must refer to every basket handed to a write task.
+   WaitIMTFillPipeline();
    if (gDebug > 0) {
       Info("AutoSave", "Tree:%s after %lld bytes written\n",GetName(),GetTotBytes());
    }
@@ -4496,6 +4503,19 @@ Long64_t TTree::Draw(const char* varexp, const TCut& selection, Option_t* option
 /// You can use the option "goff" to turn off the graphics output
 /// of TTree::Draw in the above example.
 ///
+/// ### Multi-threaded filling of histograms
+///
+/// When implicit multi-threading is enabled with ROOT::EnableImplicitMT(),
+/// drawing into a 1-D or 2-D histogram with fixed binning, e.g.
+/// ~~~ {.cpp}
+///     tree->Draw("px>>hpx(100,-4,4)", "pz>1");
+/// ~~~
+/// of a tree read from a file fills one histogram per task over the cluster
+/// ranges of the tree with ROOT::TTreeProcessorMT and merges them at the end
+/// (see TSelectorDraw::ProcessMT). In this mode the arrays returned by
+/// GetV1()...GetV4() and GetW() are not filled; call SetImplicitMT(false)
+/// on the tree to draw sequentially. TTree::Scan always runs sequentially.
+///
 /// ### Automatic interface to TTree::Draw via the TTreeViewer
 ///
 /// A complete graphical interface to this function is implemented
@@ -4600,6 +4620,9 @@ void TTree::DropBuffers(Int_t)
 /// \note This method calls `TTree::ChangeFile` when the tree reaches a size
 ///       greater than `TTree::fgMaxTreeSize`. This doesn't happen if the tree is
 ///       attached to a `TMemFile` or derivate.
+///
+/// \note With implicit multi-threading, the compression of full baskets can be
+///       overlapped with the filling of the next entries, see `TTree::SetIMTFillPipeline`.
 
 Int_t TTree::Fill()
 {
@@ -4618,8 +4641,12 @@ Int_t TTree::Fill()
 
 #ifdef R__USE_IMT
    const auto useIMT = ROOT::IsImplicitMTEnabled() && fIMTEnabled;
+   const auto usePipeline = useIMT && fIMTFillPipeline;
    ROOT::Internal::TBranchIMTHelper imtHelper;
-   if (useIMT) {
+   if (usePipeline) {
+      if (!fIMTFillTasks)
+         fIMTFillTasks = new ROOT::Internal::TBranchIMTHelper(true);
+   } else if (useIMT) {
       fIMTFlush = true;
       fIMTZipBytes.store(0);
       fIMTTotBytes.store(0);
@@ -4636,7 +4663,7 @@ Int_t TTree::Fill()
 #ifndef R__USE_IMT
       nwrite = branch->FillImpl(nullptr);
 #else
-      nwrite = branch->FillImpl(useIMT ? &imtHelper : nullptr);
+      nwrite = branch->FillImpl(usePipeline ? fIMTFillTasks : (useIMT ? &imtHelper : nullptr));
 #endif
       if (nwrite < 0) {
          if (nerror < 2) {
@@ -4667,6 +4694,11 @@ Int_t TTree::Fill()
       const_cast<TTree *>(this)->AddZipBytes(fIMTZipBytes);
       nbytes += imtHelper.GetNbytes();
       nerror += imtHelper.GetNerrors();
+   } else if (usePipeline) {
+      // Collect what the finished write tasks produced so far, without waiting for the others.
+      fTotBytes += fIMTFillTasks->TakeTotBytes();
+      fZipBytes += fIMTFillTasks->TakeZipBytes();
+      nerror += fIMTFillTasks->TakeNerrors();
    }
 #endif
 
@@ -5146,6 +5178,7 @@ Int_t TTree::FlushBaskets(bool create_cluster) const
 ///
 Int_t TTree::FlushBasketsImpl() const
 {
+   WaitIMTFillPipeline();
    if (!fDirectory) return 0;
    Int_t nbytes = 0;
    Int_t nerror = 0;
@@ -5221,6 +5254,48 @@ Int_t TTree::FlushBasketsImpl() const
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Wait for the basket write tasks started by a pipelined TTree::Fill and
+/// account for the bytes they wrote.
+///
+/// See SetIMTFillPipeline().
+
+void TTree::WaitIMTFillPipeline() const
+{
+   if (!fIMTFillTasks)
+      return;
+   fIMTFillTasks->Wait();
+   auto self = const_cast<TTree *>(this);
+   self->fTotBytes += fIMTFillTasks->TakeTotBytes();
+   self->fZipBytes += fIMTFillTasks->TakeZipBytes();
+   if (auto nerrors = fIMTFillTasks->TakeNerrors())
+      Error("WaitIMTFillPipeline", "%d basket(s) of tree %s failed to be written.", nerrors, GetName());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Enable or disable the pipelined implicit multi-threaded TTree::Fill.
+///
+/// By default, when implicit multi-threading is enabled, TTree::Fill compresses
+/// the baskets that became full in parallel and waits for them before returning.
+/// With the pipeline enabled, each branch immediately continues in a new basket
+/// and the full one is compressed and written by a task that keeps running while
+/// the next entries are filled. At most one basket per branch is in flight: a
+/// branch whose previous basket is still being written waits for it first.
+///
+/// The byte counters (GetTotBytes(), GetZipBytes()) and the basket seek tables
+/// only include the baskets whose tasks have finished; they are complete again
+/// after FlushBaskets(), AutoSave(), Reset() or GetEntry(), which wait for the
+/// outstanding tasks. Disabling the pipeline waits for them as well.
+///
+/// The pipeline has no effect if implicit multi-threading is not enabled.
+
+void TTree::SetIMTFillPipeline(bool enabled)
+{
+   if (!enabled)
+      WaitIMTFillPipeline();
+   fIMTFillPipeline = enabled;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns the expanded value of the alias.  Search in the friends if any.
 
@@ -5643,6 +5718,8 @@ Int_t TTree::GetEntry(Long64_t entry, Int_t getall)
    if (kGetEntry & fFriendLockStatus) return 0;
 
    if (entry < 0 || entry >= fEntries) return 0;
+   if (fIMTFillTasks)
+      WaitIMTFillPipeline();
    Int_t i;
    Int_t nbytes = 0;
    fReadEntry = entry;
@@ -8003,6 +8080,7 @@ void TTree::RemoveFriend(TTree* oldFriend)
 
 void TTree::Reset(Option_t* option)
 {
+   WaitIMTFillPipeline();
    fNotify        = nullptr;
    fEntries       = 0;
    fNClusterRange = 0;
@@ -20,6 +20,7 @@
 - [General Description](\ref description)
 - [Changes in behaviour](\ref changesbehaviour)
 - [Self-optimization](\ref cachemisses)
+- [Asynchronous prefetching](\ref asyncprefetch)
 - [Examples of usage](\ref examples)
 - [Check performance and stats](\ref checkPerf)
 
@@ -129,6 +130,36 @@ Additionally, on the first miss of an event, we must iterate through all the
 This can be potentially a CPU-expensive operation compared to, e.g., the
 latency of a SSD.  This is why the miss cache is currently disabled by default.
 
+\anchor asyncprefetch
+## Asynchronous prefetching
+
+By default the cache is refilled synchronously when the reader crosses the
+boundary of the entries held in the cache, which stalls the event loop for the
+duration of a full round trip on high-latency links.
+With asynchronous prefetching the cache uses two buffers: while the entries
+of one buffer are being processed, the baskets of the next cluster(s) are
+transferred into the other one by a separate thread (see TFilePrefetch).
+It can be enabled for all non-local files via the `TFile.AsyncPrefetching`
+resource or, for a given cache and any kind of file, with:
+~~~ {.cpp}
+    T->SetCacheSize(100000000);
+    auto cache = static_cast<TTreeCache *>(f->GetCacheRead(T));
+    cache->SetEnablePrefetching(true);
+    cache->SetPrefetchMemoryLimit(64000000); // both buffers together
+~~~
+Since two buffers are in flight, the memory used can reach twice the cache
+size; SetPrefetchMemoryLimit() bounds the total amount gathered by both buffers.
+
+\anchor sparseread
+## Sparse reads with an entry list
+
+When the tree (or chain) has a TEntryList (or a TEventList) set, the cache
+does not read the baskets of a cluster that do not hold any selected entry.
+The remaining baskets are still fetched with a single vectored read.
+For a TEntryList this is done only if it selects less than a given fraction of
+the entries (by default one half, see SetSparseReadDensity()); for denser
+selections whole clusters are read.
+
 \anchor examples
 ## Example usages of TTreeCache
 
@@ -290,6 +321,7 @@ myTreeOrChain.GetTree()->PrintCacheStats();
 #include "TBranch.h"
 #include "TBranchElement.h"
 #include "TEventList.h"
+#include "TEntryList.h"
 #include "TObjArray.h"
 #include "TObjString.h"
 #include "TRegexp.h"
@@ -299,6 +331,8 @@ myTreeOrChain.GetTree()->PrintCacheStats();
 #include "TMath.h"
 #include "TBranchCacheInfo.h"
 #include "TVirtualPerfStats.h"
+#include "ROOT/RTraceSpan.hxx"
+#include <algorithm>
 #include <climits>
 
 #include <memory>
@@ -1113,6 +1147,7 @@ struct BasketRanges {
 
 bool TTreeCache::FillBuffer()
 {
+   R__TRACE_SPAN("io", "TTreeCache::FillBuffer");
 
    if (fNbranches <= 0) return false;
    TTree *tree = ((TBranch*)fBranches->UncheckedAt(0))->GetTree();
@@ -1306,9 +1341,19 @@ bool TTreeCache::FillBuffer()
          chainOffset = chain->GetTreeOffset()[t];
       }
    }
+   // Likewise for a TEntryList (unless a TEventList is set) selecting a small
+   // enough fraction of the entries, see SetSparseReadDensity. Its entries are
+   // local to the tree, taken from the sub-list of the current tree of a chain.
+   TEntryList *entrylist = elist ? nullptr : fTree->GetEntryList();
+   if (entrylist && entrylist->GetN() >= fSparseReadDensity * fTree->GetEntriesFast())
+      entrylist = nullptr;
+   Int_t entrylistTree = -1;
+   if (entrylist && fTree->IsA() == TChain::Class())
+      entrylistTree = static_cast<TChain *>(fTree)->GetTreeNumber();
 
    //clear cache buffer
    Int_t ntotCurrentBuf = 0;
+   const Int_t fillLimit = GetFillBufferLimit();
    if (fEnablePrefetching){ //prefetching mode
       if (fFirstBuffer) {
          TFileCacheRead::Prefetch(0,0);
@@ -1368,7 +1413,8 @@ bool TTreeCache::FillBuffer()
          kRewind = 3
       };
 
-      auto CollectBaskets = [this, elist, chainOffset, entry, clusterIterations, resetBranchInfo, perfStats,
+      auto CollectBaskets = [this, elist, chainOffset, entrylist, entrylistTree, entry, clusterIterations,
+       resetBranchInfo, perfStats, fillLimit,
        &cursor, &lowestMaxEntry, &maxReadEntry, &minEntry,
        &reachedEnd, &skippedFirst, &oncePerBranch, &nDistinctLoad, &progress,
        &ranges, &memRanges, &reqRanges,
@@ -1461,12 +1507,12 @@ bool TTreeCache::FillBuffer()
                Int_t len = lbaskets[j];
                if (pos <= 0 || len <= 0)
                   continue;
-               if (len > fBufferSizeMin) {
+               if (len > fillLimit) {
                   // Do not cache a basket if it is bigger than the cache size!
                   if ((showMore || gDebug > 7) &&
                       (!(entries[j] < minEntry && (j < nb - 1 && entries[j + 1] <= minEntry))))
                      Info("FillBuffer", "Skipping branch %s basket %d is too large for the cache: %d > %d",
-                          b->GetName(), j, len, fBufferSizeMin);
+                          b->GetName(), j, len, fillLimit);
                   continue;
                }
 
@@ -1499,6 +1545,12 @@ bool TTreeCache::FillBuffer()
                      emax = entries[j + 1] - 1;
                   if (!elist->ContainsRange(entries[j]+chainOffset,emax+chainOffset))
                      continue;
+               } else if (entrylist) {
+                  Long64_t emax = fEntryMax;
+                  if (j<nb-1)
+                     emax = entries[j + 1] - 1;
+                  if (!entrylist->ContainsRange(entries[j], emax, entrylistTree))
+                     continue;
                }
 
                if (b->fCacheInfo.HasBeenUsed(j) || b->fCacheInfo.IsInCache(j) || b->fCacheInfo.IsVetoed(j)) {
@@ -1535,7 +1587,7 @@ bool TTreeCache::FillBuffer()
                   }
                }
 
-               if (((Long64_t)ntotCurrentBuf + len) > fBufferSizeMin) {
+               if (((Long64_t)ntotCurrentBuf + len) > fillLimit) {
                   // Humm ... we are going to go over the requested size.
                   if (clusterIterations > 0 && cursor[i].fLoadedOnce) {
                      // We already have a full cluster and now we would go over the requested
@@ -1545,14 +1597,14 @@ bool TTreeCache::FillBuffer()
                         Info(
                            "FillBuffer",
                            "Breaking early because %lld is greater than %d at cluster iteration %d will restart at %lld",
-                           ((Long64_t)ntotCurrentBuf + len), fBufferSizeMin, clusterIterations, minEntry);
+                           ((Long64_t)ntotCurrentBuf + len), fillLimit, clusterIterations, minEntry);
                      }
                      fEntryNext = minEntry;
                      filled = true;
                      break;
                   } else {
                      if (pass == kStart || !cursor[i].fLoadedOnce) {
-                        if (((Long64_t)ntotCurrentBuf + len) > 4LL * fBufferSizeMin) {
+                        if (((Long64_t)ntotCurrentBuf + len) > 4LL * fillLimit) {
                            // Okay, so we have not even made one pass and we already have
                            // accumulated request for more than twice the memory size ...
                            // So stop for now, and will restart at the same point, hoping
@@ -1562,7 +1614,7 @@ bool TTreeCache::FillBuffer()
                            if (showMore || gDebug > 5) {
                               Info("FillBuffer", "Breaking early because %lld is greater than 4*%d at cluster iteration "
                                                  "%d pass %d will restart at %lld",
-                                   ((Long64_t)ntotCurrentBuf + len), fBufferSizeMin, clusterIterations, pass, fEntryNext);
+                                   ((Long64_t)ntotCurrentBuf + len), fillLimit, clusterIterations, pass, fEntryNext);
                            }
                            filled = true;
                            break;
@@ -1571,12 +1623,12 @@ bool TTreeCache::FillBuffer()
                         // We have made one pass through the branches and thus already
                         // requested one basket per branch, let's stop prefetching
                         // now.
-                        if (((Long64_t)ntotCurrentBuf + len) > 2LL * fBufferSizeMin) {
+                        if (((Long64_t)ntotCurrentBuf + len) > 2LL * fillLimit) {
                            fEntryNext = maxReadEntry;
                            if (showMore || gDebug > 5) {
                               Info("FillBuffer", "Breaking early because %lld is greater than 2*%d at cluster iteration "
                                                  "%d pass %d will restart at %lld",
-                                   ((Long64_t)ntotCurrentBuf + len), fBufferSizeMin, clusterIterations, pass, fEntryNext);
+                                   ((Long64_t)ntotCurrentBuf + len), fillLimit, clusterIterations, pass, fEntryNext);
                            }
                            filled = true;
                            break;
@@ -1624,13 +1676,13 @@ bool TTreeCache::FillBuffer()
                   // Info("FillBuffer","maxCollectEntry incremented from %lld to %lld", maxReadEntry, entries[j+1]);
                   maxReadEntry = entries[j+1];
                }
-               if (ntotCurrentBuf > 4LL * fBufferSizeMin) {
+               if (ntotCurrentBuf > 4LL * fillLimit) {
                   // Humm something wrong happened.
                   Warning("FillBuffer", "There is more data in this cluster (starting at entry %lld to %lld, "
                                         "current=%lld) than usual ... with %d %.3f%% of the branches we already have "
                                         "%d bytes (instead of %d)",
                           fEntryCurrent, fEntryNext, entries[j], i, (100.0 * i) / ((float)fNbranches), ntotCurrentBuf,
-                          fBufferSizeMin);
+                          fillLimit);
                }
                if (pass == kStart) {
                   // In the first pass, we record one basket per branch and move on to the next branch.
@@ -1706,7 +1758,7 @@ bool TTreeCache::FillBuffer()
       // at,
       // which start at 'minEntry', is not past the end of the requested range (minEntry < fEntryMax)
       // and we guess that we not going to go over the requested amount of memory by asking for another set
-      // of entries (fBufferSizeMin > ((Long64_t)ntotCurrentBuf*(clusterIterations+1))/clusterIterations).
+      // of entries (fillLimit > ((Long64_t)ntotCurrentBuf*(clusterIterations+1))/clusterIterations).
       // ntotCurrentBuf / clusterIterations is the average size we are accumulated so far at each loop.
       // and thus (ntotCurrentBuf / clusterIterations) * (clusterIterations+1) is a good guess at what the next total
       // size
@@ -1714,10 +1766,10 @@ bool TTreeCache::FillBuffer()
       // be 'large' (i.e. 30Mb * 300 intervals) and can overflow the numerical limit of Int_t (i.e. become
       // artificially negative).   To avoid this issue we promote ntotCurrentBuf to a long long (64 bits rather than 32
       // bits)
-      if (!((fBufferSizeMin > ((Long64_t)ntotCurrentBuf * (clusterIterations + 1)) / clusterIterations) &&
+      if (!((fillLimit > ((Long64_t)ntotCurrentBuf * (clusterIterations + 1)) / clusterIterations) &&
             (prevNtot < ntotCurrentBuf) && (minEntry < fEntryMax))) {
          if (showMore || gDebug > 6)
-            Info("FillBuffer", "Breaking because %d <= %lld || (%d >= %d) || %lld >= %lld", fBufferSizeMin,
+            Info("FillBuffer", "Breaking because %d <= %lld || (%d >= %d) || %lld >= %lld", fillLimit,
                  ((Long64_t)ntotCurrentBuf * (clusterIterations + 1)) / clusterIterations, prevNtot, ntotCurrentBuf,
                  minEntry, fEntryMax);
          break;
@@ -1775,7 +1827,7 @@ bool TTreeCache::FillBuffer()
    } else {
       if (showMore || gDebug > 5) {
          Info("FillBuffer", "Complete adding %d baskets from %d branches taking in memory %d out of %d",
-              nReadPrefRequest, reqRanges.BranchesRegistered(), ntotCurrentBuf, fBufferSizeMin);
+              nReadPrefRequest, reqRanges.BranchesRegistered(), ntotCurrentBuf, fillLimit);
       }
    }
 
@@ -1908,6 +1960,8 @@ void TTreeCache::Print(Option_t *option) const
    printf("Secondary Efficiency ..............: %f\n", GetMissEfficiency());
    printf("Secondary Efficiency Rel ..........: %f\n", GetMissEfficiencyRel());
    printf("Learn entries......................: %d\n",TTreeCache::GetLearnEntries());
+   if (fEnablePrefetching && fPrefetchMemoryLimit > 0)
+      printf("Prefetching memory limit...........: %lld\n", fPrefetchMemoryLimit);
    if ( opt.Contains("cachedbranches") ) {
       opt.ReplaceAll("cachedbranches","");
       printf("Cached branches....................:\n");
@@ -2098,6 +2152,81 @@ Int_t TTreeCache::SetBufferSize(Long64_t buffersize)
    return 1;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Enable or disable the asynchronous, double-buffered prefetching of the
+/// cache content.
+///
+/// When enabled, the baskets of the next cluster(s) are requested from a
+/// separate thread (see TFilePrefetch) while the entries of the current
+/// buffer are being processed, hiding the latency of the cluster boundaries
+/// on remote files. Contrary to the `TFile.AsyncPrefetching` resource, which
+/// only applies to non-local files, this call takes effect for any file.
+/// The content of the cache is discarded and will be read again.
+
+void TTreeCache::SetEnablePrefetching(Bool_t setPrefetching)
+{
+   if (setPrefetching == fEnablePrefetching)
+      return;
+
+   TFileCacheRead::Prefetch(0, 0);
+   if (fEnablePrefetching)
+      TFileCacheRead::SecondPrefetch(0, 0);
+
+   TFileCacheRead::SetEnablePrefetching(setPrefetching);
+
+   fFirstBuffer = true;
+   fFirstTime = true;
+   fFirstEntry = -1;
+   fReadDirectionSet = false;
+   fReverseRead = false;
+   fEntryCurrent = -1;
+   if (!fIsLearning) {
+      fEntryNext = -1;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set the maximum number of bytes held in memory by the two prefetching
+/// buffers when the asynchronous prefetching is enabled.
+///
+/// Each of the two buffers is then filled with at most `limit / 2` bytes
+/// (and at most the cache buffer size). A `limit` of 0 (the default) keeps
+/// the cache buffer size as the only bound.  The limit is ignored when the
+/// asynchronous prefetching is disabled.
+
+void TTreeCache::SetPrefetchMemoryLimit(Long64_t limit)
+{
+   fPrefetchMemoryLimit = limit > 0 ? limit : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set the entry list density below which the cache reads only the baskets
+/// holding selected entries.
+///
+/// When the tree has a TEntryList selecting less than `density` times its
+/// number of entries, FillBuffer skips the baskets of the cluster that do not
+/// contain any selected entry. Above it, whole clusters are read as without
+/// entry list. A `density` of 0 always reads whole clusters, 1 always reads
+/// only the selected baskets.
+
+void TTreeCache::SetSparseReadDensity(Double_t density)
+{
+   fSparseReadDensity = std::min(std::max(density, 0.), 1.);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of bytes FillBuffer may gather into the buffer currently
+/// being filled, taking into account the prefetching memory limit.
+
+Int_t TTreeCache::GetFillBufferLimit() const
+{
+   if (!fEnablePrefetching || fPrefetchMemoryLimit <= 0)
+      return fBufferSizeMin;
+   // Keep room for at least one basket range per buffer.
+   const Long64_t perBuffer = std::max<Long64_t>(fPrefetchMemoryLimit / 2, 1);
+   return static_cast<Int_t>(std::min<Long64_t>(fBufferSizeMin, perBuffer));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the minimum and maximum entry number to be processed
 /// this information helps to optimize the number of baskets to read
@@ -27,13 +27,18 @@ A TTreeCache which exploits parallelized decompression of its own content.
 #include "TMath.h"
 #include "TROOT.h"
 #include "TMutex.h"
+#include "ROOT/RTraceSpan.hxx"
 
 #ifdef R__USE_IMT
 #include "ROOT/TThreadExecutor.hxx"
 #include "ROOT/TTaskGroup.hxx"
+#include "ROOT/TSeq.hxx"
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <vector>
 
 extern "C" void R__unzip(Int_t *nin, UChar_t *bufin, Int_t *lout, char *bufout, Int_t *nout);
 extern "C" int R__unzip_header(Int_t *nin, UChar_t *bufin, Int_t *lout);
@@ -203,7 +208,7 @@ void TTreeCacheUnzip::Init()
    fCompBuffer = new char[16384];
    fCompBufferSize = 16384;
 
-   fUnzipGroupSize = 102400; // Each task unzips at least 100 KB
+   fUnzipGroupSize = 102400; // Kept for backward compatibility, the IMT tasks pull single baskets
 
    if (fgParallel == kDisable) {
       fParallel = false;
@@ -526,6 +531,7 @@ void TTreeCacheUnzip::ResetCache()
 
 Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
 {
+   R__TRACE_SPAN("unzip", "TTreeCacheUnzip::UnzipCache");
    Int_t myCycle;
    const Int_t hlen = 128;
    Int_t objlen = 0, keylen = 0;
@@ -607,46 +613,43 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
 
 #ifdef R__USE_IMT
 ////////////////////////////////////////////////////////////////////////////////
-/// We create a TTaskGroup and asynchronously maps each group of baskets(> 100 kB in total)
-/// to a task. In TTaskGroup, we use TThreadExecutor to do the actually work of unzipping
-/// a group of basket. The purpose of creating TTaskGroup is to avoid competing with main thread.
+/// We create a TTaskGroup that asynchronously unzips the baskets in the cache. In TTaskGroup, we use
+/// TThreadExecutor to run one unzipping loop per worker thread. The purpose of creating TTaskGroup is to avoid
+/// competing with main thread.
+///
+/// The baskets are not split statically among the workers. Instead, every worker pulls the next basket from a
+/// shared queue as soon as it is done with the previous one, so that a single huge basket does not hold back the
+/// other baskets. The queue is ordered by the position of the baskets in the file, which approximates the order in
+/// which the reader needs them. The main thread additionally unzips untouched baskets itself while it waits for a
+/// basket in progress (see GetUnzipBuffer()).
 
 Int_t TTreeCacheUnzip::CreateTasks()
 {
    auto mapFunction = [&]() {
-      auto unzipFunction = [&](const std::vector<Int_t> &indices) {
-         // If cache is invalidated and we should return immediately.
-         if (!fIsTransferred) return nullptr;
-
-         for (auto ii : indices) {
-            if(fUnzipState.TryUnzipping(ii)) {
+      std::vector<Int_t> basketIndices(fNseek);
+      for (Int_t i = 0; i < fNseek; i++)
+         basketIndices[i] = fSeekIndex[i];
+      std::atomic<Int_t> nextBasket{0};
+
+      auto unzipFunction = [&](unsigned int) {
+         // If cache is invalidated we should return immediately.
+         while (fIsTransferred) {
+            const Int_t i = nextBasket.fetch_add(1, std::memory_order_relaxed);
+            if (i >= (Int_t)basketIndices.size())
+               break;
+            const Int_t ii = basketIndices[i];
+            if (fUnzipState.TryUnzipping(ii)) {
                Int_t res = UnzipCache(ii);
-               if(res)
+               if (res)
                   if (gDebug > 0)
                      Info("UnzipCache", "Unzipping failed or cache is in learning state");
             }
          }
-         return nullptr;
       };
 
-      Int_t accusz = 0;
-      std::vector<std::vector<Int_t>> basketIndices;
-      std::vector<Int_t> indices;
-      if (fUnzipGroupSize <= 0) fUnzipGroupSize = 102400;
-      for (Int_t i = 0; i < fNseek; i++) {
-         while (accusz < fUnzipGroupSize) {
-            accusz += fSeekLen[i];
-            indices.push_back(i);
-            i++;
-            if (i >= fNseek) break;
-         }
-         if (i < fNseek) i--;
-         basketIndices.push_back(indices);
-         indices.clear();
-         accusz = 0;
-      }
       ROOT::TThreadExecutor pool;
-      pool.Foreach(unzipFunction, basketIndices);
+      const unsigned int nWorkers = std::min<unsigned int>(pool.GetPoolSize(), basketIndices.size());
+      pool.Foreach(unzipFunction, ROOT::TSeqU(nWorkers));
    };
 
    fUnzipTaskGroup = std::make_unique<ROOT::Experimental::TTaskGroup>();
@@ -255,3 +255,36 @@ TEST_F(BulkApiTest, BulkInMem)
          break;
    }
 }
+
+TEST(BulkApi, ByteSwapInPlace)
+{
+   // An odd number of elements, such that a vectorized loop needs a scalar tail.
+   constexpr Int_t kN = 37;
+   TBufferFile wbuf(TBuffer::EMode::kWrite, 32 * 1024);
+   for (Int_t i = 0; i < kN; ++i)
+      wbuf << Double_t(i) + 0.5;
+   for (Int_t i = 0; i < kN; ++i)
+      wbuf << Float_t(-i);
+   for (Int_t i = 0; i < kN; ++i)
+      wbuf << Short_t(i * 100);
+
+   TBufferFile rbuf(TBuffer::EMode::kRead, wbuf.Length(), wbuf.Buffer(), false);
+   ASSERT_TRUE(rbuf.ByteSwapBuffer(kN, kDouble_t));
+   auto doubles = reinterpret_cast<Double_t *>(rbuf.GetCurrent());
+   for (Int_t i = 0; i < kN; ++i)
+      EXPECT_EQ(Double_t(i) + 0.5, doubles[i]);
+
+   rbuf.SetBufferOffset(kN * sizeof(Double_t));
+   ASSERT_TRUE(rbuf.ByteSwapBuffer(kN, kFloat_t));
+   auto floats = reinterpret_cast<Float_t *>(rbuf.GetCurrent());
+   for (Int_t i = 0; i < kN; ++i)
+      EXPECT_EQ(Float_t(-i), floats[i]);
+
+   rbuf.SetBufferOffset(kN * (sizeof(Double_t) + sizeof(Float_t)));
+   ASSERT_TRUE(rbuf.ByteSwapBuffer(kN, kShort_t));
+   auto shorts = reinterpret_cast<Short_t *>(rbuf.GetCurrent());
+   for (Int_t i = 0; i < kN; ++i)
+      EXPECT_EQ(Short_t(i * 100), shorts[i]);
+
+   EXPECT_FALSE(rbuf.ByteSwapBuffer(kN, kChar_t));
+}
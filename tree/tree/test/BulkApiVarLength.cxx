@@ -9,12 +9,16 @@
 #include "TTreeReader.h"
 #include "TTreeReaderValue.h"
 #include "TTreeReaderArray.h"
+#include "TSystem.h"
 #include "ROOT/TTreeReaderFast.hxx"
 #include "ROOT/TTreeReaderValueFast.hxx"
 #include "ROOT/TIOFeatures.hxx"
 
 #include "gtest/gtest.h"
 
+#include <memory>
+#include <vector>
+
 class BulkApiVariableTest : public ::testing::Test {
 public:
    static constexpr Long64_t fClusterSize = 1e5;
@@ -233,3 +237,87 @@ TEST_F(BulkApiVariableTest, serializedRead)
    printf("Bulk Serialized API: Successful read of all events.\n");
    printf("Bulk Serialized API: Total elapsed time (seconds) for API: %.2f\n", sw.RealTime());
 }
+
+TEST_F(BulkApiVariableTest, bulkReadWithOffsets)
+{
+   std::unique_ptr<TFile> hfile{TFile::Open(fFileName.c_str())};
+   auto tree = hfile->Get<TTree>("T");
+   ASSERT_TRUE(tree);
+   auto branchFloat = tree->GetBranch("f");
+   ASSERT_TRUE(branchFloat);
+   auto branchDouble = tree->GetBranch("d");
+   ASSERT_TRUE(branchDouble);
+
+   // Mimic the float arithmetic used when filling the tree.
+   float idx_f = 0;
+   Long64_t evt_idx = 0;
+   TBufferFile floatBuf(TBuffer::kWrite, 32 * 1024);
+   TBufferFile doubleBuf(TBuffer::kWrite, 32 * 1024);
+   std::vector<Int_t> floatOffsets;
+   std::vector<Int_t> doubleOffsets;
+
+   while (evt_idx < fEventCount) {
+      auto count = branchFloat->GetBulkRead().GetBulkEntries(evt_idx, floatBuf, floatOffsets);
+      ASSERT_GT(count, 0);
+      ASSERT_EQ(count, branchDouble->GetBulkRead().GetBulkEntries(evt_idx, doubleBuf, doubleOffsets));
+      ASSERT_EQ(static_cast<std::size_t>(count + 1), floatOffsets.size());
+      ASSERT_EQ(floatOffsets, doubleOffsets);
+
+      auto floats = reinterpret_cast<float *>(floatBuf.GetCurrent());
+      auto doubles = reinterpret_cast<double *>(doubleBuf.GetCurrent());
+      for (Int_t idx = 0; idx < count; ++idx) {
+         const Long64_t ev = evt_idx + idx + 1;
+         ASSERT_EQ(ev % 10, floatOffsets[idx + 1] - floatOffsets[idx]) << "event " << ev;
+         for (Int_t j = floatOffsets[idx]; j < floatOffsets[idx + 1]; ++j) {
+            ASSERT_EQ(idx_f++, floats[j]);
+            ASSERT_EQ(static_cast<double>(idx_f + 1), doubles[j]);
+         }
+      }
+      evt_idx += count;
+   }
+   EXPECT_EQ(fEventCount, evt_idx);
+}
+
+TEST(BulkApiVariable, bulkReadVector)
+{
+   const std::string fileName = "BulkApiTestVector.root";
+   constexpr Long64_t kEvents = 5000;
+   {
+      TFile hfile{fileName.c_str(), "RECREATE"};
+      TTree tree{"T", "A ROOT tree with a std::vector<float> branch."};
+      std::vector<float> v;
+      tree.Branch("v", &v);
+      for (Long64_t ev = 0; ev < kEvents; ++ev) {
+         v.clear();
+         for (Long64_t idx = 0; idx < ev % 7; ++idx)
+            v.push_back(ev + 0.25 * idx);
+         tree.Fill();
+      }
+      hfile.Write();
+   }
+
+   std::unique_ptr<TFile> hfile{TFile::Open(fileName.c_str())};
+   auto tree = hfile->Get<TTree>("T");
+   ASSERT_TRUE(tree);
+   auto branch = tree->GetBranch("v");
+   ASSERT_TRUE(branch);
+
+   TBufferFile buf(TBuffer::kWrite, 32 * 1024);
+   std::vector<Int_t> offsets;
+   Long64_t evt_idx = 0;
+   while (evt_idx < kEvents) {
+      auto count = branch->GetBulkRead().GetBulkEntries(evt_idx, buf, offsets);
+      ASSERT_GT(count, 0);
+      ASSERT_EQ(static_cast<std::size_t>(count + 1), offsets.size());
+      auto values = reinterpret_cast<float *>(buf.GetCurrent());
+      for (Int_t idx = 0; idx < count; ++idx) {
+         const Long64_t ev = evt_idx + idx;
+         ASSERT_EQ(ev % 7, offsets[idx + 1] - offsets[idx]) << "event " << ev;
+         for (Int_t j = 0; j < offsets[idx + 1] - offsets[idx]; ++j)
+            ASSERT_EQ(float(ev + 0.25 * j), values[offsets[idx] + j]);
+      }
+      evt_idx += count;
+   }
+   EXPECT_EQ(kEvents, evt_idx);
+   gSystem->Unlink(fileName.c_str());
+}
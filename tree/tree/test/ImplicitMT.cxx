@@ -3,9 +3,13 @@
 #include "TROOT.h"
 #include "TSystem.h"
 #include "TTree.h"
+#include "TTreeCacheUnzip.h"
 
 #include "gtest/gtest.h"
 
+#include <string>
+#include <vector>
+
 #ifdef R__USE_IMT
 
 // ROOT-9668
@@ -57,4 +61,141 @@ TEST(TChainImplicitMT, propagateToTTree)
    gSystem->Unlink(fname1);
 }
 
+TEST(TChainImplicitMT, CountEntriesConcurrently)
+{
+   ROOT::EnableImplicitMT(4);
+   std::vector<std::string> fileNames;
+   for (int i = 0; i < 4; ++i) {
+      fileNames.emplace_back("countEntriesConcurrently" + std::to_string(i) + ".root");
+      TFile f(fileNames.back().c_str(), "RECREATE");
+      TTree t("t", "t");
+      int x = 0;
+      t.Branch("x", &x);
+      for (int j = 0; j <= i; ++j) {
+         x = 10 * i + j;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TChain c("t");
+   // the number of entries of the first file is known, those of the other files are not
+   c.Add(fileNames[0].c_str(), 1);
+   c.Add(fileNames[1].c_str());
+   c.Add(fileNames[2].c_str());
+   c.Add(fileNames[3].c_str());
+   EXPECT_EQ(TTree::kMaxEntries, c.GetEntriesFast());
+   EXPECT_EQ(10, c.GetEntries());
+   const Long64_t expectedOffsets[] = {0, 1, 3, 6, 10};
+   for (int i = 0; i < 5; ++i)
+      EXPECT_EQ(expectedOffsets[i], c.GetTreeOffset()[i]);
+
+   int x = -1;
+   c.SetBranchAddress("x", &x);
+   c.GetEntry(7);
+   EXPECT_EQ(3, c.GetTreeNumber());
+   EXPECT_EQ(31, x);
+   c.ResetBranchAddresses();
+
+   for (const auto &fileName : fileNames)
+      gSystem->Unlink(fileName.c_str());
+}
+
+TEST(TTreeCacheUnzipImplicitMT, SkewedBaskets)
+{
+   ROOT::EnableImplicitMT(4);
+   const auto ofileName = "skewedBasketsUnzipMT.root";
+   constexpr int kNBig = 20000;
+   constexpr int kNSmall = 16;
+   constexpr int kNEntries = 200;
+   {
+      TFile f(ofileName, "RECREATE");
+      TTree t("t", "t");
+      std::vector<float> big(kNBig);
+      int small[kNSmall];
+      t.Branch("big", &big, 8 * 1024 * 1024);
+      for (int b = 0; b < kNSmall; ++b)
+         t.Branch(("small" + std::to_string(b)).c_str(), &small[b], 1024);
+      for (int i = 0; i < kNEntries; ++i) {
+         for (int j = 0; j < kNBig; ++j)
+            big[j] = i + j;
+         for (int b = 0; b < kNSmall; ++b)
+            small[b] = i * b;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   const auto parallelUnzip = TTreeCacheUnzip::GetParallelUnzip();
+   TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::kEnable);
+   {
+      TFile f(ofileName);
+      auto t = f.Get<TTree>("t");
+      ASSERT_NE(nullptr, t);
+      t->SetCacheSize(64 * 1024 * 1024);
+      t->AddBranchToCache("*", true);
+      t->StopCacheLearningPhase();
+      std::vector<float> *big = nullptr;
+      int small[kNSmall];
+      t->SetBranchAddress("big", &big);
+      for (int b = 0; b < kNSmall; ++b)
+         t->SetBranchAddress(("small" + std::to_string(b)).c_str(), &small[b]);
+      for (int i = 0; i < kNEntries; ++i) {
+         ASSERT_GT(t->GetEntry(i), 0);
+         ASSERT_EQ(static_cast<std::size_t>(kNBig), big->size());
+         EXPECT_FLOAT_EQ(static_cast<float>(i), big->front());
+         EXPECT_FLOAT_EQ(static_cast<float>(i + kNBig - 1), big->back());
+         for (int b = 0; b < kNSmall; ++b)
+            EXPECT_EQ(i * b, small[b]);
+      }
+      EXPECT_NE(nullptr, dynamic_cast<TTreeCacheUnzip *>(t->GetReadCache(&f)));
+      t->ResetBranchAddresses();
+      delete big;
+   }
+   TTreeCacheUnzip::SetParallelUnzip(parallelUnzip);
+   gSystem->Unlink(ofileName);
+}
+
+TEST(TTreeImplicitMT, FillPipeline)
+{
+   ROOT::EnableImplicitMT(4);
+   constexpr int kNBranches = 32;
+   constexpr int kNEntries = 20000;
+   for (const bool pipeline : {false, true}) {
+      const auto ofileName = pipeline ? "fillPipelineMT.root" : "fillNoPipelineMT.root";
+      {
+         TFile f(ofileName, "RECREATE");
+         TTree t("t", "t");
+         t.SetIMTFillPipeline(pipeline);
+         EXPECT_EQ(pipeline, t.GetIMTFillPipeline());
+         double x[kNBranches];
+         for (int b = 0; b < kNBranches; ++b)
+            t.Branch(("x" + std::to_string(b)).c_str(), &x[b], 1024);
+         for (int i = 0; i < kNEntries; ++i) {
+            for (int b = 0; b < kNBranches; ++b)
+               x[b] = i * kNBranches + b;
+            ASSERT_GE(t.Fill(), 0);
+         }
+         t.Write();
+         EXPECT_GT(t.GetZipBytes(), 0);
+      }
+
+      TFile f(ofileName);
+      auto t = f.Get<TTree>("t");
+      ASSERT_NE(nullptr, t);
+      ASSERT_EQ(kNEntries, t->GetEntries());
+      double x[kNBranches];
+      for (int b = 0; b < kNBranches; ++b)
+         t->SetBranchAddress(("x" + std::to_string(b)).c_str(), &x[b]);
+      for (int i = 0; i < kNEntries; ++i) {
+         ASSERT_GT(t->GetEntry(i), 0);
+         for (int b = 0; b < kNBranches; ++b)
+            ASSERT_DOUBLE_EQ(i * kNBranches + b, x[b]);
+      }
+      t->ResetBranchAddresses();
+      f.Close();
+      gSystem->Unlink(ofileName);
+   }
+}
+
 #endif // R__USE_IMT
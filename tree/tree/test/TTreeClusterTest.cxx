@@ -1,10 +1,14 @@
 #include "TFile.h"
 #include "TTree.h"
 #include "TBranch.h"
+#include "TTreeCache.h"
 #include "TRandom.h"
+#include "ROOT/InternalTreeUtils.hxx"
 
 #include "gtest/gtest.h"
 
+#include <vector>
+
 class TTreeClusterTest : public ::testing::Test {
 protected:
    void SetUp() override
@@ -53,3 +57,66 @@ TEST_F(TTreeClusterTest, countBaskets)
 
    delete file;
 }
+
+TEST_F(TTreeClusterTest, asyncPrefetch)
+{
+   std::vector<Double_t> expected;
+   {
+      TFile file("TTreeClusterTest.root");
+      auto tree = file.Get<TTree>("tree");
+      Double_t data = 0;
+      tree->SetBranchAddress("branch", &data);
+      for (Long64_t i = 0; i < tree->GetEntries(); ++i) {
+         tree->GetEntry(i);
+         expected.push_back(data);
+      }
+   }
+
+   TFile file("TTreeClusterTest.root");
+   auto tree = file.Get<TTree>("tree");
+   tree->SetCacheSize(100000);
+   auto cache = dynamic_cast<TTreeCache *>(file.GetCacheRead(tree));
+   ASSERT_NE(nullptr, cache);
+   cache->SetEnablePrefetching(true);
+   ASSERT_TRUE(cache->IsEnablePrefetching());
+   // One cluster of 500 doubles takes about 4000 bytes: cap both buffers to about one cluster each.
+   cache->SetPrefetchMemoryLimit(10000);
+   EXPECT_EQ(10000, cache->GetPrefetchMemoryLimit());
+
+   Double_t data = 0;
+   tree->SetBranchAddress("branch", &data);
+   ASSERT_EQ(static_cast<Long64_t>(expected.size()), tree->GetEntries());
+   for (Long64_t i = 0; i < tree->GetEntries(); ++i) {
+      tree->GetEntry(i);
+      EXPECT_EQ(expected[i], data);
+   }
+   EXPECT_GT(cache->GetPrefetchedBlocks(), 1);
+
+   cache->SetEnablePrefetching(false);
+   EXPECT_FALSE(cache->IsEnablePrefetching());
+   tree->GetEntry(0);
+   EXPECT_EQ(expected[0], data);
+}
+
+TEST_F(TTreeClusterTest, clusterInfo)
+{
+   auto info = ROOT::Internal::TreeUtils::GetTreeClusterInfo("tree", "TTreeClusterTest.root");
+   EXPECT_EQ(info.fNEntries, 1000);
+   EXPECT_EQ(info.fClusterBoundaries, (std::vector<Long64_t>{0, 500, 1000}));
+   EXPECT_TRUE(info.fHost.empty()); // local file
+}
+
+TEST(TTreeClusterAlignedRanges, makeRanges)
+{
+   using ROOT::Internal::TreeUtils::MakeClusterAlignedRanges;
+   using Ranges_t = std::vector<std::pair<Long64_t, Long64_t>>;
+
+   const std::vector<Long64_t> boundaries{0, 10, 20, 30, 40, 100};
+   EXPECT_EQ(MakeClusterAlignedRanges(boundaries, 1), (Ranges_t{{0, 100}}));
+   // the ideal split is at 50: the closest boundary is 40
+   EXPECT_EQ(MakeClusterAlignedRanges(boundaries, 2), (Ranges_t{{0, 40}, {40, 100}}));
+   EXPECT_EQ(MakeClusterAlignedRanges(boundaries, 4), (Ranges_t{{0, 30}, {30, 40}, {40, 100}}));
+   // never more ranges than clusters
+   EXPECT_EQ(MakeClusterAlignedRanges(boundaries, 10).size(), 5u);
+   EXPECT_TRUE(MakeClusterAlignedRanges({0}, 3).empty());
+}
@@ -5,6 +5,7 @@
 #include "TFile.h"
 #include "TSystem.h"
 #include "TTree.h"
+#include "TTreeCache.h"
 
 #include "gtest/gtest.h"
 
@@ -60,3 +61,75 @@ TEST(TEntryList, enterRange)
 
    gSystem->Unlink(filename1);
 }
+
+TEST(TEntryList, containsRange)
+{
+   TEntryList elist;
+   elist.EnterRange(100, 110);
+   elist.Enter(200000);
+
+   EXPECT_TRUE(elist.ContainsRange(0, 100));
+   EXPECT_TRUE(elist.ContainsRange(105, 105));
+   EXPECT_FALSE(elist.ContainsRange(110, 199999));
+   EXPECT_TRUE(elist.ContainsRange(150000, 250000));
+   EXPECT_FALSE(elist.ContainsRange(200001, 300000));
+   EXPECT_FALSE(elist.ContainsRange(20, 10));
+}
+
+TEST(TEntryList, sparseReadSkipsBaskets)
+{
+   auto treename{"entrylist_sparse_tree"};
+   auto filename{"entrylist_sparse_tree.root"};
+   constexpr int nentries{100000};
+   {
+      TFile f{filename, "RECREATE"};
+      TTree t{treename, treename};
+      int b;
+      t.Branch("b1", &b, 1024);
+      for (int i = 0; i < nentries; ++i) {
+         b = i * 10;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   auto readAll = [&](TEntryList *elist, Double_t density = 0.5) {
+      TFile f{filename};
+      std::unique_ptr<TTree> t{f.Get<TTree>(treename)};
+      int b1;
+      t->SetBranchAddress("b1", &b1);
+      t->SetCacheSize(10000000);
+      t->AddBranchToCache("*", true);
+      t->StopCacheLearningPhase();
+      auto cache = dynamic_cast<TTreeCache *>(f.GetCacheRead(t.get()));
+      EXPECT_NE(nullptr, cache);
+      if (cache)
+         cache->SetSparseReadDensity(density);
+      if (elist) {
+         t->SetEntryList(elist);
+         for (Long64_t i = 0; i < elist->GetN(); ++i) {
+            const auto entry = elist->GetEntry(i);
+            t->GetEntry(entry);
+            EXPECT_EQ(entry * 10, b1);
+         }
+      } else {
+         for (Long64_t i = 0; i < t->GetEntries(); ++i)
+            t->GetEntry(i);
+      }
+      t->SetEntryList(nullptr);
+      return f.GetBytesRead();
+   };
+
+   TEntryList elist{"", "", treename, filename};
+   for (int i = 0; i < nentries; i += 1000)
+      elist.Enter(i);
+
+   const auto sparseBytes = readAll(&elist);
+   const auto clusterBytes = readAll(&elist, 0.);
+   const auto fullBytes = readAll(nullptr);
+   EXPECT_LT(sparseBytes, fullBytes);
+   // With a density threshold of 0, whole clusters are read as without entry list.
+   EXPECT_LT(sparseBytes, clusterBytes);
+
+   gSystem->Unlink(filename);
+}
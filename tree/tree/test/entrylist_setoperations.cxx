@@ -0,0 +1,76 @@
+#include "TEntryList.h"
+
+#include "gtest/gtest.h"
+
+#include <functional>
+#include <set>
+
+namespace {
+
+constexpr Long64_t kNEntries = 200000;
+
+// Lists of the entries for which `pass` is true, of which the blocks are stored as bits, or after OptimizeStorage()
+// as lists of the entries that pass or of those that don't
+std::pair<TEntryList, std::set<Long64_t>> MakeList(const std::function<bool(Long64_t)> &pass, bool optimize)
+{
+   TEntryList elist;
+   std::set<Long64_t> entries;
+   for (Long64_t i = 0; i < kNEntries; ++i) {
+      if (pass(i)) {
+         elist.Enter(i);
+         entries.insert(i);
+      }
+   }
+   if (optimize)
+      elist.OptimizeStorage();
+   return {elist, entries};
+}
+
+void CheckList(TEntryList &elist, const std::set<Long64_t> &entries)
+{
+   ASSERT_EQ(static_cast<Long64_t>(entries.size()), elist.GetN());
+   Long64_t index = 0;
+   for (auto entry : entries)
+      ASSERT_EQ(entry, elist.GetEntry(index++));
+   for (Long64_t i = 0; i < kNEntries; ++i)
+      ASSERT_EQ(entries.count(i), static_cast<std::size_t>(elist.Contains(i)));
+}
+
+const std::function<bool(Long64_t)> kPasses[] = {
+   [](Long64_t i) { return i % 2 == 0; },    // dense, bits
+   [](Long64_t i) { return i % 1000 == 7; }, // sparse, list of the entries that pass
+   [](Long64_t i) { return i % 500 != 0; },  // almost all, list of the entries that don't pass
+};
+
+} // anonymous namespace
+
+TEST(TEntryList, AddBlocks)
+{
+   for (const auto &pass1 : kPasses) {
+      for (const auto &pass2 : kPasses) {
+         for (bool optimize : {false, true}) {
+            auto list1 = MakeList(pass1, optimize);
+            auto list2 = MakeList(pass2, optimize);
+            list1.first.Add(&list2.first);
+            list1.second.insert(list2.second.begin(), list2.second.end());
+            CheckList(list1.first, list1.second);
+         }
+      }
+   }
+}
+
+TEST(TEntryList, SubtractBlocks)
+{
+   for (const auto &pass1 : kPasses) {
+      for (const auto &pass2 : kPasses) {
+         for (bool optimize : {false, true}) {
+            auto list1 = MakeList(pass1, optimize);
+            auto list2 = MakeList(pass2, optimize);
+            list1.first.Subtract(&list2.first);
+            for (auto entry : list2.second)
+               list1.second.erase(entry);
+            CheckList(list1.first, list1.second);
+         }
+      }
+   }
+}
@@ -91,9 +91,18 @@ private:
 
    std::vector<std::string> FindTreeNames();
    static unsigned int fgTasksPerWorkerHint;
+   static bool fgSplitTailTasks;
 
    std::pair<Long64_t, Long64_t> fGlobalRange{0, std::numeric_limits<Long64_t>::max()};
 
+   /// Cluster boundaries (one vector per file) computed by PrepareClusters, consumed by the next Process call
+   std::vector<std::vector<std::pair<Long64_t, Long64_t>>> fPreparedClusters;
+   std::vector<Long64_t> fPreparedEntries; ///< Number of entries of each file, computed by PrepareClusters
+   bool fClustersPrepared = false;          ///< Whether fPreparedClusters and fPreparedEntries are up to date
+
+   unsigned int GetMaxTasksPerFile() const;
+   bool ShouldRetrieveAllClusters() const;
+
 public:
    TTreeProcessorMT(std::string_view filename, std::string_view treename = "", UInt_t nThreads = 0u,
                     const std::pair<Long64_t, Long64_t> &globalRange = {0, std::numeric_limits<Long64_t>::max()});
@@ -107,10 +116,13 @@ public:
    TTreeProcessorMT(TTree &tree, UInt_t nThreads = 0u,
                     const std::pair<Long64_t, Long64_t> &globalRange = {0, std::numeric_limits<Long64_t>::max()});
 
+   void PrepareClusters();
    void Process(std::function<void(TTreeReader &)> func);
 
    static void SetTasksPerWorkerHint(unsigned int m);
    static unsigned int GetTasksPerWorkerHint();
+   static void SetSplitTailTasks(bool splitTailTasks);
+   static bool GetSplitTailTasks();
 };
 
 } // End of namespace ROOT
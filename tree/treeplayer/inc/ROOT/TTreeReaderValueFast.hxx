@@ -66,7 +66,8 @@ class TTreeReaderValueFastBase {
              }
              fRemaining -= adjust;
           } else {
-             fRemaining = fBranch->GetBulkRead().GetEntriesSerialized(eventNum, fBuffer);
+             fRemaining = IsSwappedInPlace() ? fBranch->GetBulkRead().GetBulkEntries(eventNum, fBuffer)
+                                             : fBranch->GetBulkRead().GetEntriesSerialized(eventNum, fBuffer);
              if (R__unlikely(fRemaining < 0)) {
                 fReadStatus = ROOT::Internal::TTreeReaderValueBase::kReadError;
                 //printf("Failed to retrieve entries from the branch.\n");
@@ -92,6 +93,11 @@ class TTreeReaderValueFastBase {
       }
       virtual UInt_t GetSize() = 0;
 
+      // If true, the whole basket is byte swapped in place when read and the values
+      // are handed out directly from the basket memory; otherwise, each value is
+      // deserialized on access.
+      virtual bool IsSwappedInPlace() const { return false; }
+
       void MarkTreeReaderUnavailable() {
          fTreeReader = nullptr;
       }
@@ -163,9 +169,8 @@ class TTreeReaderValueFast<float> final : public ROOT::Experimental::Internal::T
       const char *GetTypeName() override {return "float";}
       const char *BranchTypeName() override {return "float";}
       UInt_t GetSize() override {return sizeof(float);}
-      float * Deserialize(char *input) {frombuf(input, &fTmp); return &fTmp;}
-
-      float fTmp;
+      bool IsSwappedInPlace() const override {return true;}
+      float* Deserialize(char *input) {return reinterpret_cast<float*>(input);}
 };
 
 template <>
@@ -188,9 +193,8 @@ class TTreeReaderValueFast<double> final : public ROOT::Experimental::Internal::
       const char *GetTypeName() override {return "double";}
       const char *BranchTypeName() override {return "double";}
       UInt_t GetSize() override {return sizeof(double);}
-      double* Deserialize(char *input) {frombuf(input, &fTmp); return &fTmp;}
-
-      double fTmp;
+      bool IsSwappedInPlace() const override {return true;}
+      double* Deserialize(char *input) {return reinterpret_cast<double*>(input);}
 };
 
 template <>
@@ -211,9 +215,8 @@ class TTreeReaderValueFast<Int_t> final : public ROOT::Experimental::Internal::T
       const char *GetTypeName() override {return "integer";}
       const char *BranchTypeName() override {return "integer";}
       UInt_t GetSize() override {return sizeof(Int_t);}
-      Int_t* Deserialize(char *input) {frombuf(input, &fTmp); return &fTmp;}
-
-      Int_t fTmp;
+      bool IsSwappedInPlace() const override {return true;}
+      Int_t* Deserialize(char *input) {return reinterpret_cast<Int_t*>(input);}
 };
 
 template <>
@@ -234,9 +237,8 @@ class TTreeReaderValueFast<UInt_t> final : public ROOT::Experimental::Internal::
       const char *GetTypeName() override {return "unsigned integer";}
       const char *BranchTypeName() override {return "unsigned integer";}
       UInt_t GetSize() override {return sizeof(UInt_t);}
-      UInt_t* Deserialize(char *input) {frombuf(input, &fTmp); return &fTmp;}
-
-      UInt_t fTmp;
+      bool IsSwappedInPlace() const override {return true;}
+      UInt_t* Deserialize(char *input) {return reinterpret_cast<UInt_t*>(input);}
 };
 
 template <>
@@ -73,6 +73,7 @@ private:
    bool        fTreeCacheIsLearning;    ///< Whether cache is in learning phase
    bool        fUseTreeCache;           ///< Control usage of the tree cache
    Long64_t    fCacheSize;              ///< Cache size
+   UInt_t      fNThreads;               ///< Number of implicit multi-threading threads per worker (0: disabled)
 };
 
 template<class F>
@@ -201,7 +202,8 @@ void TMPWorkerTreeFunc<F>::Process(UInt_t code, MPCodeBufPair &msg)
 
    // If we are not done processing entries in the tree, 
    // create a TTreeReader that reads this range of entries
-   if (start >= 0 && start < fTree->GetEntries()) {
+   // (the range is empty if the clusters are larger than the share of each worker)
+   if (start >= 0 && start < finish && start < fTree->GetEntries()) {
       TTreeReader reader(fTree, enl);
 
       TTreeReader::EEntryStatus status = reader.SetEntriesRange(start, finish);
@@ -112,6 +112,7 @@ public:
    void      ProcessFill(Long64_t entry) override;
    virtual void      ProcessFillMultiple(Long64_t entry);
    virtual void      ProcessFillObject(Long64_t entry);
+   virtual bool      ProcessMT(Long64_t firstentry, Long64_t nentries);
    virtual void      SetEstimate(Long64_t n);
    virtual UInt_t    SplitNames(const TString &varexp, std::vector<TString> &names);
    virtual void      TakeAction();
@@ -131,6 +131,10 @@ protected:
 
    RealInstanceCache fRealInstanceCache;              ///<! Cache accelerating the GetRealInstance function
 
+   using JitFunction_t = Double_t (*)(const Double_t *values, const Double_t *constants);
+   JitFunction_t        fJitFunction = nullptr;       ///<! Natively compiled operations of the formula, see SetJitCompilation()
+   Int_t                fJitState = 0;                ///<! 0 if compilation was not attempted, 1 if compiled, -1 if not compilable
+
    TTreeFormula(const char *name, const char *formula, TTree *tree, const std::vector<std::string>& aliases);
    void Init(const char *name, const char *formula);
    bool        BranchHasMethod(TLeaf* leaf, TBranch* branch, const char* method,const char* params, Long64_t readentry) const;
@@ -148,6 +152,8 @@ protected:
    virtual Double_t  GetValueFromMethod(Int_t i, TLeaf *leaf) const;
    virtual void*     GetValuePointerFromMethod(Int_t i, TLeaf *leaf) const;
    Int_t             GetRealInstance(Int_t instance, Int_t codeindex);
+   bool              JitCompile();
+   Double_t          EvalJitted(Int_t instance);
 
    void              LoadBranches();
    bool              LoadCurrentDim();
@@ -213,6 +219,9 @@ public:
    virtual TTree*      GetTree() const {return fTree;}
    virtual void        UpdateFormulaLeaves();
 
+   static  void        SetJitCompilation(bool enable);
+   static  bool        IsJitCompilationEnabled();
+
    ClassDefOverride(TTreeFormula, 10);  //The Tree formula
 };
 
@@ -24,6 +24,8 @@
 
 #include "TVirtualIndex.h"
 
+#include <vector>
+
 class TTreeFormula;
 
 class TTreeIndex : public TVirtualIndex {
@@ -38,9 +40,11 @@ protected:
    TTreeFormula  *fMinorFormula;        ///<! Pointer to minor TreeFormula
    TTreeFormula  *fMajorFormulaParent;  ///<! Pointer to major TreeFormula in Parent tree (if any)
    TTreeFormula  *fMinorFormulaParent;  ///<! Pointer to minor TreeFormula in Parent tree (if any)
+   std::vector<Long64_t> fHashTable;    ///<! Positions in fIndexValues by hash of major,minor (-1: empty slot)
 
    TTreeFormula  *GetMajorFormulaParent(const TTree *parent);
    TTreeFormula  *GetMinorFormulaParent(const TTree *parent);
+   Long64_t       FindValuesInHashTable(Long64_t major, Long64_t minor) const;
 
 private:
    TTreeIndex(const TTreeIndex&) = delete;            // Not implemented.
@@ -52,6 +56,7 @@ public:
    ~TTreeIndex() override;
    void                   Append(const TVirtualIndex *,bool delaySort = false) override;
    bool                   ConvertOldToNew();
+   void                   BuildHashTable();
    Long64_t               FindValues(Long64_t major, Long64_t minor) const;
    Long64_t               GetEntryNumberFriend(const TTree *parent) override;
    Long64_t               GetEntryNumberWithIndex(Long64_t major, Long64_t minor) const override;
@@ -62,6 +67,7 @@ public:
    const char            *GetMajorName()    const override {return fMajorName.Data();}
    const char            *GetMinorName()    const override {return fMinorName.Data();}
    Long64_t               GetN()            const override {return fN;}
+   bool                   HasHashTable()    const {return !fHashTable.empty();}
    virtual TTreeFormula  *GetMajorFormula();
    virtual TTreeFormula  *GetMinorFormula();
    bool           IsValidFor(const TTree *parent) override;
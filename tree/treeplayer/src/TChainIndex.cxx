@@ -27,6 +27,7 @@ and kept inside this chain index.
 #include "TFile.h"
 #include "TError.h"
 
+#include <algorithm>
 #include <cstring> // std::strlen
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -230,13 +231,12 @@ std::pair<TVirtualIndex*, Int_t> TChainIndex::GetSubTreeIndex(Long64_t major, Lo
       return make_pair(static_cast<TVirtualIndex*>(nullptr), 0);
    }
 
-   Int_t treeNo = fEntries.size() - 1;
-   for (unsigned int i = 0; i < fEntries.size() - 1; i++) {
-      if( indexValue < fEntries[i+1].GetMinIndexValPair() ) {
-         treeNo = i;
-         break;
-      }
-   }
+   // The trees are sorted by their index values: find the last one starting at or before the value
+   const auto next = std::upper_bound(fEntries.begin() + 1, fEntries.end(), indexValue,
+                                      [](const TChainIndexEntry::IndexValPair_t &value, const TChainIndexEntry &e) {
+                                         return value < e.GetMinIndexValPair();
+                                      });
+   Int_t treeNo = (next - fEntries.begin()) - 1;
    // Double check we found the right range.
    if( indexValue > fEntries[treeNo].GetMaxIndexValPair() ) {
       return make_pair(static_cast<TVirtualIndex*>(nullptr), 0);
@@ -15,8 +15,25 @@
 #include "TError.h"
 #include "TMPWorkerTree.h"
 #include "TEnv.h"
+#include "TROOT.h"
 #include <string>
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Move the boundary of an entry range back to the start of the cluster which contains it,
+/// so that the ranges of different workers do not share clusters, which would otherwise be
+/// read and decompressed by two workers.
+
+Long64_t SnapToClusterStart(TTree *tree, Long64_t entry)
+{
+   if (entry <= 0 || entry >= tree->GetEntries())
+      return entry;
+   return tree->GetClusterIterator(entry).GetStartEntry();
+}
+
+} // anonymous namespace
+
 //////////////////////////////////////////////////////////////////////////
 ///
 /// \class TMPWorkerTree
@@ -45,7 +62,7 @@
 
 TMPWorkerTree::TMPWorkerTree()
    : TMPWorker(), fFileNames(), fTreeName(), fTree(nullptr), fFile(nullptr), fEntryList(nullptr), fFirstEntry(0),
-     fTreeCache(nullptr), fTreeCacheIsLearning(false), fUseTreeCache(true), fCacheSize(-1)
+     fTreeCache(nullptr), fTreeCacheIsLearning(false), fUseTreeCache(true), fCacheSize(-1), fNThreads(0)
 {
    Setup();
 }
@@ -54,7 +71,7 @@ TMPWorkerTree::TMPWorkerTree(const std::vector<std::string> &fileNames, TEntryLi
                              const std::string &treeName, UInt_t nWorkers, ULong64_t maxEntries, ULong64_t firstEntry)
    : TMPWorker(nWorkers, maxEntries), fFileNames(fileNames), fTreeName(treeName), fTree(nullptr), fFile(nullptr),
      fEntryList(entries), fFirstEntry(firstEntry), fTreeCache(nullptr), fTreeCacheIsLearning(false), fUseTreeCache(true),
-     fCacheSize(-1)
+     fCacheSize(-1), fNThreads(0)
 {
    Setup();
 }
@@ -62,7 +79,7 @@ TMPWorkerTree::TMPWorkerTree(const std::vector<std::string> &fileNames, TEntryLi
 TMPWorkerTree::TMPWorkerTree(TTree *tree, TEntryList *entries, UInt_t nWorkers, ULong64_t maxEntries,
                              ULong64_t firstEntry)
    : TMPWorker(nWorkers, maxEntries), fTree(tree), fFile(nullptr), fEntryList(entries), fFirstEntry(firstEntry),
-     fTreeCache(nullptr), fTreeCacheIsLearning(false), fUseTreeCache(true), fCacheSize(-1)
+     fTreeCache(nullptr), fTreeCacheIsLearning(false), fUseTreeCache(true), fCacheSize(-1), fNThreads(0)
 {
    Setup();
 }
@@ -80,6 +97,8 @@ void TMPWorkerTree::Setup()
    Int_t uc = gEnv->GetValue("MultiProc.UseTreeCache", 1);
    if (uc != 1) fUseTreeCache = false;
    fCacheSize = gEnv->GetValue("MultiProc.CacheSize", -1);
+   Int_t nt = gEnv->GetValue("MultiProc.NThreads", 0);
+   fNThreads = (nt > 0) ? nt : 0;
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -182,6 +201,12 @@ void TMPWorkerTree::Init(Int_t fd, UInt_t workerN)
 
    TMPWorker::Init(fd, workerN);
    fMaxNEntries = EvalMaxEntries(fMaxNEntries);
+#ifdef R__USE_IMT
+   // Each worker reads and decompresses its baskets with its own thread pool, which is only
+   // safe to create after forking
+   if (fNThreads > 0)
+      ROOT::EnableImplicitMT(fNThreads);
+#endif
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -305,7 +330,8 @@ Int_t TMPWorkerTree::LoadTree(UInt_t code, MPCodeBufPair &msg, Long64_t &start,
 
       //create entries range
       //example: for 21 entries, 4 workers we want ranges 0-5, 5-10, 10-15, 15-21
-      //and this worker must take the rangeN-th range
+      //and this worker must take the rangeN-th range; the boundaries are then moved
+      //back to the start of their cluster
       Long64_t nEntries = fTree->GetEntries();
       UInt_t nBunch = nEntries / fNWorkers;
       UInt_t rangeN = nProcessed % fNWorkers;
@@ -318,6 +344,11 @@ Int_t TMPWorkerTree::LoadTree(UInt_t code, MPCodeBufPair &msg, Long64_t &start,
       } else {
          finish = nEntries;
       }
+      // with a maximum number of entries each worker has a fixed share, which must not change
+      if (!fMaxNEntries) {
+         start = SnapToClusterStart(fTree, start);
+         finish = SnapToClusterStart(fTree, finish);
+      }
 
 
       //process tree
@@ -387,7 +418,8 @@ Int_t TMPWorkerTree::LoadTree(UInt_t code, MPCodeBufPair &msg, Long64_t &start,
       //create entries range
       if (code == MPCode::kProcRange) {
          //example: for 21 entries, 4 workers we want ranges 0-5, 5-10, 10-15, 15-21
-         //and this worker must take the rangeN-th range
+         //and this worker must take the rangeN-th range; the boundaries are then moved
+         //back to the start of their cluster
          Long64_t nEntries = tree->GetEntries();
          UInt_t nBunch = nEntries / fNWorkers;
          if(nEntries % fNWorkers) nBunch++;
@@ -399,6 +431,11 @@ Int_t TMPWorkerTree::LoadTree(UInt_t code, MPCodeBufPair &msg, Long64_t &start,
             finish = (rangeN+1)*nBunch;
          else
             finish = nEntries;
+         // with a maximum number of entries each worker has a fixed share, which must not change
+         if (!fMaxNEntries) {
+            start = SnapToClusterStart(tree, start);
+            finish = SnapToClusterStart(tree, finish);
+         }
       } else {
          start = 0;
          finish = tree->GetEntries();
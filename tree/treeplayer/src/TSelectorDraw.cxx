@@ -36,6 +36,16 @@ A specialized TSelector for TTree::Draw.
 #include "TClass.h"
 #include "TColor.h"
 #include "strlcpy.h"
+#include "TChain.h"
+#include "TFile.h"
+#include "TMath.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TTreeProcessorMT.hxx"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#endif
 
 ClassImp(TSelectorDraw);
 
@@ -1345,6 +1355,206 @@ void TSelectorDraw::ProcessFillObject(Long64_t /*entry*/)
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the histogram booked in Begin() in parallel with ROOT::TTreeProcessorMT.
+///
+/// Every task compiles its own copy of the variables and of the selection on
+/// the tree of its cluster range and fills a private copy of the histogram;
+/// the partial histograms are added to the output once all ranges are done.
+/// Only 1-D and 2-D histograms with fixed binning (e.g. `"x>>h(100,0,1)"` or
+/// an existing histogram) drawn from a tree that is read back from a file
+/// qualify, without TEntryList, TEventList, aliases, string expressions or
+/// `Entry$`-like specials and without TTree::SetUpdate. In all other cases
+/// nothing is done and false is returned, so that the caller runs the
+/// sequential entry loop.
+///
+/// On this path the buffers returned by GetVal() and GetW() are not filled;
+/// call TTree::SetImplicitMT(false) to get them back.
+///
+/// Return true if the entries in [firstentry, firstentry+nentries) have been
+/// processed.
+
+bool TSelectorDraw::ProcessMT(Long64_t firstentry, Long64_t nentries)
+{
+#ifdef R__USE_IMT
+   if (!ROOT::IsImplicitMTEnabled() || !fTree || !fTree->GetImplicitMT() || nentries <= 0)
+      return false;
+
+   const Int_t action = TMath::Abs(fAction);
+   if ((action != 1 && action != 2) || fDimension != action || fObjEval || !fObject ||
+       !fObject->InheritsFrom(TH1::Class()))
+      return false;
+   TH1 *hist = (TH1 *)fObject;
+   if (hist->GetXaxis()->CanExtend() || (action == 2 && hist->GetYaxis()->CanExtend()))
+      return false;
+
+   TFile *file = fTree->GetCurrentFile();
+   if (!file || file->IsWritable() || fTree->GetUpdate() || fTree->GetEntryList() || fTree->GetEventList() ||
+       fTreeElistArray)
+      return false;
+   if (fTree->GetListOfAliases() && fTree->GetListOfAliases()->GetSize())
+      return false;
+
+   std::vector<TString> expressions;
+   for (Int_t i = 0; i < fDimension; ++i) {
+      if (!fVar[i] || fVar[i]->IsString())
+         return false;
+      expressions.emplace_back(fVar[i]->GetTitle());
+   }
+   const TString selection = fSelect ? fSelect->GetTitle() : "";
+   for (const TString &expr : expressions) {
+      if (expr.Contains("Entry$") || expr.Contains("Entries$"))
+         return false;
+   }
+   if (selection.Contains("Entry$") || selection.Contains("Entries$"))
+      return false;
+
+   // The weight of a TTree or of a chain with a global weight may have been
+   // set in memory only, the per-file weights of a TChain are read back by
+   // the tasks.
+   const bool constWeight = fTree->GetTree() == fTree || fTree->TestBit(TChain::kGlobalWeight);
+   const Double_t treeWeight = fTree->GetWeight();
+
+   std::mutex histMutex;
+   std::vector<std::unique_ptr<TH1>> partials;
+   std::vector<TH1 *> idle;
+   std::atomic<Long64_t> selectedRows{0};
+
+   auto acquire = [&]() {
+      std::lock_guard<std::mutex> lock(histMutex);
+      if (!idle.empty()) {
+         TH1 *h = idle.back();
+         idle.pop_back();
+         return h;
+      }
+      TH1 *h = (TH1 *)hist->Clone();
+      h->SetDirectory(nullptr);
+      h->Reset();
+      partials.emplace_back(h);
+      return h;
+   };
+   auto release = [&](TH1 *h) {
+      std::lock_guard<std::mutex> lock(histMutex);
+      idle.push_back(h);
+   };
+
+   ROOT::TTreeProcessorMT processor(*fTree, 0u, {firstentry, firstentry + nentries});
+   processor.Process([&](TTreeReader &reader) {
+      TTree *tree = reader.GetTree();
+      std::unique_ptr<TTreeFormula> select;
+      if (!selection.IsNull()) {
+         select = std::make_unique<TTreeFormula>("Selection", selection.Data(), tree);
+         select->SetQuickLoad(true);
+         if (!select->GetNdim())
+            return;
+      }
+      std::vector<std::unique_ptr<TTreeFormula>> vars;
+      for (Int_t i = 0; i < action; ++i) {
+         vars.emplace_back(
+            std::make_unique<TTreeFormula>(TString::Format("Var%i", i + 1), expressions[i].Data(), tree));
+         vars[i]->SetQuickLoad(true);
+         if (!vars[i]->GetNdim())
+            return;
+      }
+      // The manager is deleted together with the last formula it holds.
+      auto manager = new TTreeFormulaManager();
+      if (select)
+         manager->Add(select.get());
+      for (auto &var : vars)
+         manager->Add(var.get());
+      manager->Sync();
+      const bool multiple = manager->GetMultiplicity() >= 1;
+      const bool selectMultiple = select && select->GetMultiplicity();
+      bool varMultiple[2] = {false, false};
+      for (Int_t k = 0; k < action; ++k)
+         varMultiple[k] = vars[k]->GetMultiplicity();
+
+      TH1 *h = acquire();
+      Long64_t rows = 0;
+      auto fill = [&](const Double_t *v, Double_t w) {
+         if (action == 1)
+            h->Fill(v[0], w);
+         else
+            ((TH2 *)h)->Fill(v[1], v[0], w);
+         ++rows;
+      };
+
+      Int_t treeNumber = -1;
+      Double_t weight = treeWeight;
+      Double_t val[2], val0[2];
+      while (reader.Next()) {
+         if (tree->GetTreeNumber() != treeNumber) {
+            treeNumber = tree->GetTreeNumber();
+            if (!constWeight)
+               weight = tree->GetWeight();
+            for (auto &var : vars)
+               var->UpdateFormulaLeaves();
+            if (select)
+               select->UpdateFormulaLeaves();
+         }
+
+         if (!multiple) {
+            const Double_t w = select ? weight * select->EvalInstance(0) : weight;
+            if (!w)
+               continue;
+            for (Int_t k = 0; k < action; ++k)
+               val[k] = vars[k]->EvalInstance(0);
+            fill(val, w);
+            continue;
+         }
+
+         // Same logic as ProcessFillMultiple.
+         const Int_t ndata = manager->GetNdata();
+         if (!ndata)
+            continue;
+         Double_t ww = select ? weight * select->EvalInstance(0) : weight;
+         if (!ww && !selectMultiple)
+            continue;
+         bool filled = false;
+         if (ww) {
+            for (Int_t k = 0; k < action; ++k)
+               val0[k] = vars[k]->EvalInstance(0);
+            fill(val0, ww);
+            filled = true;
+         } else {
+            for (auto &var : vars)
+               var->ResetLoading();
+         }
+         for (Int_t i = 1; i < ndata; ++i) {
+            if (selectMultiple) {
+               ww = weight * select->EvalInstance(i);
+               if (ww == 0)
+                  continue;
+               if (!filled) {
+                  for (Int_t k = 0; k < action; ++k) {
+                     if (!varMultiple[k])
+                        val0[k] = vars[k]->EvalInstance(0);
+                  }
+                  filled = true;
+               }
+            }
+            for (Int_t k = 0; k < action; ++k)
+               val[k] = varMultiple[k] ? vars[k]->EvalInstance(i) : val0[k];
+            fill(val, ww);
+         }
+      }
+      selectedRows += rows;
+      release(h);
+   });
+
+   for (auto &partial : partials)
+      hist->Add(partial.get());
+   fAction = action;
+   fNfill = 0;
+   fSelectedRows = selectedRows;
+   return true;
+#else
+   (void)firstentry;
+   (void)nentries;
+   return false;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set number of entries to estimate variable limits.
 
@@ -44,6 +44,8 @@
 #include "strlcpy.h"
 #include "snprintf.h"
 #include "TEntryList.h"
+#include "TEnv.h"
+#include "TVirtualMutex.h"
 
 #include <cctype>
 #include <cstdio>
@@ -51,6 +53,11 @@
 #include <cstdlib>
 #include <typeinfo>
 #include <algorithm>
+#include <atomic>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
 
 const Int_t kMaxLen     = 2048;
 
@@ -3972,6 +3979,260 @@ template<> inline LongDouble_t TTreeFormula::GetConstant(Int_t k) {
 }
 template<> inline Long64_t TTreeFormula::GetConstant(Int_t k) { return (Long64_t)GetConstant<LongDouble_t>(k); }
 
+namespace {
+
+std::atomic<int> &JitCompilationSetting()
+{
+   static std::atomic<int> setting{gEnv ? gEnv->GetValue("TTreeFormula.JitCompilation", 0) : 0};
+   return setting;
+}
+
+/// Compiled functions, indexed by their generated body; formulas with the same
+/// operations (but possibly different constants and leaves) share them.
+std::unordered_map<std::string, void *> &JitFunctions()
+{
+   static std::unordered_map<std::string, void *> functions;
+   return functions;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Enable or disable the native compilation of the formulas.
+///
+/// When enabled, the first evaluation of a formula made only of arithmetic,
+/// comparison, logical and mathematical operations on constants and numerical
+/// leaves (or data members) translates these operations to C++ and compiles
+/// them with cling. The evaluation of the following entries (and instances) then
+/// reads the leaves and calls the compiled function instead of interpreting the
+/// operations one by one. Formulas using other constructs (strings, aliases,
+/// function calls, ternary operators, TCutG, special variables such as Entry$, ...)
+/// are interpreted as before. Only the evaluation in double precision is
+/// compiled.
+///
+/// The default can be set with the `TTreeFormula.JitCompilation` resource.
+
+void TTreeFormula::SetJitCompilation(bool enable)
+{
+   JitCompilationSetting() = enable;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if the formulas are natively compiled, see SetJitCompilation().
+
+bool TTreeFormula::IsJitCompilationEnabled()
+{
+   return JitCompilationSetting() != 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Translate the operations of this formula to C++ and compile them.
+/// Return false if the formula uses an operation that cannot be compiled.
+///
+/// The generated function takes the values of the tree variables, in the order
+/// in which the operations use them, and the formula constants. Its semantics
+/// follow the ones of EvalInstance (e.g. a division by zero yields zero).
+
+bool TTreeFormula::JitCompile()
+{
+   if (fNoper < 2 || fAxis || TestBit(kMissingLeaf) || !gInterpreter)
+      return false;
+
+   std::vector<std::string> stack;
+   std::string body;
+   Int_t nvalues = 0;
+   Int_t ntemps = 0;
+   auto push = [&](const std::string &expr) {
+      std::string name = "t" + std::to_string(ntemps++);
+      body += "   const double " + name + " = " + expr + ";\n";
+      stack.push_back(name);
+   };
+   auto unary = [&](const std::function<std::string(const std::string &)> &expr) {
+      if (stack.empty())
+         return false;
+      auto a = stack.back();
+      stack.pop_back();
+      push(expr(a));
+      return true;
+   };
+   auto binary = [&](const std::function<std::string(const std::string &, const std::string &)> &expr) {
+      if (stack.size() < 2)
+         return false;
+      auto b = stack.back();
+      stack.pop_back();
+      auto a = stack.back();
+      stack.pop_back();
+      push(expr(a, b));
+      return true;
+   };
+   auto call = [](const char *fn) {
+      return [fn](const std::string &a) { return std::string(fn) + "(" + a + ")"; };
+   };
+   auto infix = [](const char *op) {
+      return [op](const std::string &a, const std::string &b) { return "(" + a + " " + op + " " + b + ")"; };
+   };
+   auto compare = [](const char *op) {
+      return [op](const std::string &a, const std::string &b) { return "(" + a + " " + op + " " + b + " ? 1. : 0.)"; };
+   };
+   auto bitwise = [](const char *op) {
+      return [op](const std::string &a, const std::string &b) {
+         return "double((unsigned long long)" + a + " " + op + " (unsigned long long)" + b + ")";
+      };
+   };
+
+   for (Int_t i = 0; i < fNoper; ++i) {
+      const Int_t oper = GetOper()[i];
+      const Int_t action = oper >> kTFOperShift;
+      bool ok = true;
+      if (action == kDefinedVariable) {
+         const Int_t lookupType = fLookupType[oper & kTFOperMask];
+         if (lookupType != kDirect && lookupType != kDataMember)
+            return false;
+         push("v[" + std::to_string(nvalues++) + "]");
+         continue;
+      }
+      if (action > kDefinedVariable)
+         return false;
+      switch (action) {
+      case kConstant: push("c[" + std::to_string(oper & kTFOperMask) + "]"); break;
+      case kEnd: i = fNoper; break;
+      // Evaluated as a plain kAnd or kOr since all the variables are read anyway.
+      case kBoolOptimize: break;
+      case kAdd: ok = binary(infix("+")); break;
+      case kSubstract: ok = binary(infix("-")); break;
+      case kMultiply: ok = binary(infix("*")); break;
+      case kDivide:
+         ok = binary([](const std::string &a, const std::string &b) { return "(" + b + " == 0 ? 0. : " + a + " / " + b + ")"; });
+         break;
+      case kModulo:
+         ok = binary([](const std::string &a, const std::string &b) { return "double((long long)" + a + " % (long long)" + b + ")"; });
+         break;
+      case kcos: ok = unary(call("std::cos")); break;
+      case ksin: ok = unary(call("std::sin")); break;
+      case ktan:
+         ok = unary([](const std::string &a) { return "(std::cos(" + a + ") == 0 ? 0. : std::tan(" + a + "))"; });
+         break;
+      case kacos:
+         ok = unary([](const std::string &a) { return "(std::abs(" + a + ") > 1 ? 0. : std::acos(" + a + "))"; });
+         break;
+      case kasin:
+         ok = unary([](const std::string &a) { return "(std::abs(" + a + ") > 1 ? 0. : std::asin(" + a + "))"; });
+         break;
+      case katan: ok = unary(call("std::atan")); break;
+      case kcosh: ok = unary(call("std::cosh")); break;
+      case ksinh: ok = unary(call("std::sinh")); break;
+      case ktanh:
+         ok = unary([](const std::string &a) { return "(std::cosh(" + a + ") == 0 ? 0. : std::tanh(" + a + "))"; });
+         break;
+      case kacosh:
+         ok = unary([](const std::string &a) { return "(" + a + " < 1 ? 0. : std::acosh(" + a + "))"; });
+         break;
+      case kasinh: ok = unary(call("std::asinh")); break;
+      case katanh:
+         ok = unary([](const std::string &a) { return "(std::abs(" + a + ") > 1 ? 0. : std::atanh(" + a + "))"; });
+         break;
+      case katan2:
+         ok = binary([](const std::string &a, const std::string &b) { return "std::atan2(" + a + ", " + b + ")"; });
+         break;
+      case kfmod:
+         ok = binary([](const std::string &a, const std::string &b) { return "std::fmod(" + a + ", " + b + ")"; });
+         break;
+      case kpow:
+         ok = binary([](const std::string &a, const std::string &b) { return "std::pow(" + a + ", " + b + ")"; });
+         break;
+      case ksq: ok = unary([](const std::string &a) { return "(" + a + " * " + a + ")"; }); break;
+      case ksqrt: ok = unary([](const std::string &a) { return "std::sqrt(std::abs(" + a + "))"; }); break;
+      case kmin:
+         ok = binary([](const std::string &a, const std::string &b) { return "std::min(" + a + ", " + b + ")"; });
+         break;
+      case kmax:
+         ok = binary([](const std::string &a, const std::string &b) { return "std::max(" + a + ", " + b + ")"; });
+         break;
+      case klog: ok = unary([](const std::string &a) { return "(" + a + " > 0 ? std::log(" + a + ") : 0.)"; }); break;
+      case klog10:
+         ok = unary([](const std::string &a) { return "(" + a + " > 0 ? std::log10(" + a + ") : 0.)"; });
+         break;
+      case kexp:
+         ok = unary([](const std::string &a) {
+            return "(" + a + " < -700 ? 0. : (" + a + " > 700 ? std::exp(700.) : std::exp(" + a + ")))";
+         });
+         break;
+      case kpi: push("3.14159265358979323846"); break;
+      case kabs: ok = unary(call("std::abs")); break;
+      case ksign: ok = unary([](const std::string &a) { return "(" + a + " < 0 ? -1. : 1.)"; }); break;
+      case kint: ok = unary([](const std::string &a) { return "double((long long)" + a + ")"; }); break;
+      case kSignInv: ok = unary([](const std::string &a) { return "(-1 * " + a + ")"; }); break;
+      case kAnd:
+         ok = binary([](const std::string &a, const std::string &b) { return "(" + a + " != 0 && " + b + " != 0 ? 1. : 0.)"; });
+         break;
+      case kOr:
+         ok = binary([](const std::string &a, const std::string &b) { return "(" + a + " != 0 || " + b + " != 0 ? 1. : 0.)"; });
+         break;
+      case kEqual: ok = binary(compare("==")); break;
+      case kNotEqual: ok = binary(compare("!=")); break;
+      case kLess: ok = binary(compare("<")); break;
+      case kGreater: ok = binary(compare(">")); break;
+      case kLessThan: ok = binary(compare("<=")); break;
+      case kGreaterThan: ok = binary(compare(">=")); break;
+      case kNot: ok = unary([](const std::string &a) { return "(" + a + " != 0 ? 0. : 1.)"; }); break;
+      case kBitAnd: ok = binary(bitwise("&")); break;
+      case kBitOr: ok = binary(bitwise("|")); break;
+      case kLeftShift: ok = binary(bitwise("<<")); break;
+      case kRightShift: ok = binary(bitwise(">>")); break;
+      default: return false;
+      }
+      if (!ok)
+         return false;
+   }
+   if (stack.size() != 1 || nvalues == 0)
+      return false;
+   body += "   return " + stack.back() + ";\n";
+
+   R__LOCKGUARD(gROOTMutex);
+   auto &functions = JitFunctions();
+   auto found = functions.find(body);
+   if (found == functions.end()) {
+      const std::string name = "ttreeformula_jit_" + std::to_string(std::hash<std::string>{}(body));
+      const std::string code = "#include <cmath>\n#include <algorithm>\nnamespace ROOT { namespace Internal {\n"
+                               "double " + name + "(const double *v, const double *c)\n{\n" + body + "}\n} }\n";
+      void *address = nullptr;
+      if (gInterpreter->Declare(code.c_str())) {
+         TInterpreter::EErrorCode error = TInterpreter::kNoError;
+         address = reinterpret_cast<void *>(
+            gInterpreter->Calc(("(Longptr_t)&ROOT::Internal::" + name + ";").c_str(), &error));
+         if (error != TInterpreter::kNoError)
+            address = nullptr;
+      }
+      found = functions.emplace(body, address).first;
+   }
+   fJitFunction = reinterpret_cast<JitFunction_t>(found->second);
+   return fJitFunction != nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate this formula with its compiled operations, see JitCompile().
+
+Double_t TTreeFormula::EvalJitted(Int_t instance)
+{
+   const bool willLoad = (instance==0 || fNeedLoading); fNeedLoading = false;
+   if (willLoad) fDidBooleanOptimization = false;
+
+   Double_t values[kMAXFOUND];
+   Int_t nvalues = 0;
+   for (Int_t i=0; i<fNoper ; ++i) {
+      const Int_t oper = GetOper()[i];
+      if ((oper >> kTFOperShift) != kDefinedVariable)
+         continue;
+      const Int_t code = (oper & kTFOperMask);
+      TT_EVAL_INIT_LOOP;
+      if (fLookupType[code] == kDirect)
+         values[nvalues++] = leaf->GetTypedValue<Double_t>(real_instance);
+      else
+         values[nvalues++] = ((TFormLeafInfo*)fDataMembers.UncheckedAt(code))->GetTypedValue<Double_t>(leaf,real_instance);
+   }
+   return fJitFunction(values, fConst);
+}
+
 ////////////////////////////////////////////////////////////////////////////
 /// \brief Evaluate this treeformula
 /// \tparam T The type used to interpret the numbers then used for the operations
@@ -4047,6 +4308,13 @@ T TTreeFormula::EvalInstance(Int_t instance, const char *stringStackArg[])
       }
    }
 
+   if (std::is_same<T, Double_t>::value && fJitState >= 0) {
+      if (fJitState == 0 && IsJitCompilationEnabled())
+         fJitState = JitCompile() ? 1 : -1;
+      if (fJitState == 1)
+         return EvalJitted(instance);
+   }
+
    T tab[kMAXFOUND];
    const Int_t kMAXSTRINGFOUND = 10;
    const char *stringStackLocal[kMAXSTRINGFOUND];
@@ -20,11 +20,29 @@ A Tree Index with majorname and minorname.
 #include "TBuffer.h"
 #include "TMath.h"
 
+#include <algorithm>
 #include <cstring> // std::strlen
+#include <tuple>
 
 ClassImp(TTreeIndex);
 
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Slot of the major,minor pair in a hash table with mask+1 slots
+
+std::size_t HashSlot(Long64_t major, Long64_t minor, std::size_t mask)
+{
+   ULong64_t h = static_cast<ULong64_t>(major) * 0x9E3779B97F4A7C15ull ^ static_cast<ULong64_t>(minor);
+   h ^= h >> 29;
+   h *= 0xBF58476D1CE4E5B9ull;
+   h ^= h >> 32;
+   return h & mask;
+}
+
+} // anonymous namespace
+
 struct IndexSortComparator {
 
   IndexSortComparator(Long64_t *major, Long64_t *minor)
@@ -166,8 +184,8 @@ TTreeIndex::TTreeIndex(const TTree *T, const char *majorname, const char *minorn
    //   return;
    //}
 
-   Long64_t *tmp_major = new Long64_t[fN];
-   Long64_t *tmp_minor = new Long64_t[fN];
+   // major, minor, entry number
+   std::vector<std::tuple<Long64_t, Long64_t, Long64_t>> values(fN);
    Long64_t i;
    Long64_t oldEntry = fTree->GetReadEntry();
    Int_t current = -1;
@@ -198,22 +216,21 @@ TTreeIndex::TTreeIndex(const TTree *T, const char *majorname, const char *minorn
          }
          return ret;
       };
-      tmp_major[i] = GetAndRangeCheck(true, i);
-      tmp_minor[i] = GetAndRangeCheck(false, i);
+      const Long64_t major = GetAndRangeCheck(true, i);
+      const Long64_t minor = GetAndRangeCheck(false, i);
+      values[i] = std::make_tuple(major, minor, i);
    }
+   // Sort the values themselves rather than indirectly through the entry numbers, which is more cache friendly.
+   // Trees are often filled in the order of the index (e.g. by run and event number), then there is nothing to sort.
+   if (!std::is_sorted(values.begin(), values.end()))
+      std::sort(values.begin(), values.end());
    fIndex = new Long64_t[fN];
-   for(i = 0; i < fN; i++) { fIndex[i] = i; }
-   std::sort(fIndex, fIndex + fN, IndexSortComparator(tmp_major, tmp_minor) );
-   //TMath::Sort(fN,w,fIndex,0);
    fIndexValues = new Long64_t[fN];
    fIndexValuesMinor = new Long64_t[fN];
    for (i=0;i<fN;i++) {
-      fIndexValues[i] = tmp_major[fIndex[i]];
-      fIndexValuesMinor[i] = tmp_minor[fIndex[i]];
+      std::tie(fIndexValues[i], fIndexValuesMinor[i], fIndex[i]) = values[i];
    }
 
-   delete [] tmp_major;
-   delete [] tmp_minor;
    fTree->LoadTree(oldEntry);
 }
 
@@ -239,6 +256,7 @@ TTreeIndex::~TTreeIndex()
 
 void TTreeIndex::Append(const TVirtualIndex *add, bool delaySort )
 {
+   fHashTable.clear();
 
    if (add && add->GetN()) {
       // Create new buffer (if needed)
@@ -321,6 +339,7 @@ void TTreeIndex::Append(const TVirtualIndex *add, bool delaySort )
 bool TTreeIndex::ConvertOldToNew()
 {
    if( !fIndexValuesMinor && fN ) {
+      fHashTable.clear();
       fIndexValuesMinor = new Long64_t[fN];
       for(int i=0; i<fN; i++) {
          fIndexValuesMinor[i] = (fIndexValues[i] & 0x7fffffff);
@@ -373,6 +392,49 @@ Long64_t TTreeIndex::GetEntryNumberFriend(const TTree *parent)
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Build a hash table of the index values, so that GetEntryNumberWithIndex
+/// finds the entry number of a major,minor pair in constant time instead of
+/// a binary search. This is worth it if many look-ups are done in a large index,
+/// e.g. to synchronize a friend tree by run and event number: the hash table
+/// takes 16 bytes per entry of the index.
+/// The hash table is not written with the index; it is dropped when entries are
+/// appended to the index.
+
+void TTreeIndex::BuildHashTable()
+{
+   std::size_t nSlots = 1;
+   while (nSlots < 2 * static_cast<std::size_t>(fN))
+      nSlots <<= 1;
+   fHashTable.assign(nSlots, -1);
+   const std::size_t mask = nSlots - 1;
+   for (Long64_t pos = 0; pos < fN; pos++) {
+      std::size_t slot = HashSlot(fIndexValues[pos], fIndexValuesMinor[pos], mask);
+      // For pairs that appear more than once, keep the first one, as FindValues does
+      while (fHashTable[slot] >= 0 && (fIndexValues[fHashTable[slot]] != fIndexValues[pos] ||
+                                       fIndexValuesMinor[fHashTable[slot]] != fIndexValuesMinor[pos]))
+         slot = (slot + 1) & mask;
+      if (fHashTable[slot] < 0)
+         fHashTable[slot] = pos;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the position of the major|minor values in the IndexValues tables, or -1
+/// if they are not in the index. Requires the hash table, see BuildHashTable.
+
+Long64_t TTreeIndex::FindValuesInHashTable(Long64_t major, Long64_t minor) const
+{
+   const std::size_t mask = fHashTable.size() - 1;
+   std::size_t slot = HashSlot(major, minor, mask);
+   for (; fHashTable[slot] >= 0; slot = (slot + 1) & mask) {
+      const Long64_t pos = fHashTable[slot];
+      if (fIndexValues[pos] == major && fIndexValuesMinor[pos] == minor)
+         return pos;
+   }
+   return -1;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// find position where major|minor values are in the IndexValues tables
 /// this is the index in IndexValues table, not entry# !
@@ -435,6 +497,8 @@ Long64_t TTreeIndex::GetEntryNumberWithBestIndex(Long64_t major, Long64_t minor)
 /// The function performs binary search in this sorted table.
 /// If it finds a pair that maches val, it returns directly the
 /// index in the table, otherwise it returns -1.
+/// If the hash table was built with BuildHashTable, it is used instead of the
+/// binary search.
 ///
 /// See also GetEntryNumberWithBestIndex
 
@@ -442,6 +506,11 @@ Long64_t TTreeIndex::GetEntryNumberWithIndex(Long64_t major, Long64_t minor) con
 {
    if (fN == 0) return -1;
 
+   if (!fHashTable.empty()) {
+      const Long64_t pos = FindValuesInHashTable(major, minor);
+      return pos < 0 ? -1 : fIndex[pos];
+   }
+
    Long64_t pos = FindValues(major, minor);
    if( pos < fN && fIndexValues[pos] == major && fIndexValuesMinor[pos] == minor )
       return fIndex[pos];
@@ -585,6 +654,7 @@ void TTreeIndex::Streamer(TBuffer &R__b)
    UInt_t R__s, R__c;
    if (R__b.IsReading()) {
       Version_t R__v = R__b.ReadVersion(&R__s, &R__c); if (R__v) { }
+      fHashTable.clear();
       TVirtualIndex::Streamer(R__b);
       fMajorName.Streamer(R__b);
       fMinorName.Streamer(R__b);
@@ -2255,7 +2255,10 @@ Long64_t TTreePlayer::Process(TSelector *selector,Option_t *option, Long64_t nen
 
    bool process = (selector->GetAbort() != TSelector::kAbortProcess &&
                     (selector->Version() != 0 || selector->GetStatus() != -1)) ? true : false;
-   if (process) {
+   // With implicit multi-threading, TTree::Draw of a histogram with fixed
+   // binning fills per-task histograms over the cluster ranges of the tree.
+   bool processedMT = process && selector == fSelector && fSelector->ProcessMT(firstentry, nentries);
+   if (process && !processedMT) {
 
       Long64_t readbytesatstart = 0;
       readbytesatstart = TFile::GetFileBytesRead();
@@ -3013,6 +3016,8 @@ void TTreePlayer::StartViewer(Int_t ww, Int_t wh)
 /// -  option = "D" Draw the projected histogram with the fitted function
 ///             normalized to the number of selected rows
 ///             and multiplied by the bin width
+/// -  option = "VEC" Evaluate the formula of the function on SIMD vectors (needs ROOT built with VecCore)
+/// -  option = "SERIAL" Do not evaluate the likelihood in multiple threads when implicit multi-threading is enabled
 ///
 /// You can specify boundary limits for some or all parameters via
 /// ~~~{.cpp}
@@ -3085,6 +3090,16 @@ Int_t TTreePlayer::UnbinnedFit(const char *funcname ,const char *varexp, const c
    TString opt = option;
    opt.ToUpper();
    Foption_t fitOption;
+   // evaluate the likelihood in parallel by default, as for histogram fits
+   if (ROOT::IsImplicitMTEnabled()) fitOption.ExecPolicy = ROOT::EExecutionPolicy::kMultiThread;
+   if (opt.Contains("SERIAL")) {
+      fitOption.ExecPolicy = ROOT::EExecutionPolicy::kSequential;
+      opt.ReplaceAll("SERIAL","");
+   }
+   if (opt.Contains("VEC")) {
+      fitOption.Vectorize = 1;
+      opt.ReplaceAll("VEC","");
+   }
    if (opt.Contains("Q")) fitOption.Quiet   = 1;
    if (opt.Contains("V")){fitOption.Verbose = 1; fitOption.Quiet   = 0;}
    if (opt.Contains("E")) fitOption.Errors  = 1;
@@ -69,7 +69,14 @@
 /// in a lambda or via std::bind to give it the right signature.\n
 /// **Note:** the user should take care of initializing random seeds differently in each
 /// process (e.g. using the process id in the seed). Otherwise several parallel executions
-/// might generate the same sequence of pseudo-random numbers.
+/// might generate the same sequence of pseudo-random numbers.\n
+/// **Note:** when a file is split among several workers, the entry ranges of the workers start at
+/// cluster boundaries, so that no cluster is read and decompressed by more than one worker.\n
+/// **Note:** processes and threads can be combined by setting `MultiProc.NThreads` in the ROOT
+/// configuration (e.g. `gEnv->SetValue("MultiProc.NThreads", 4)`): each worker then enables
+/// implicit multi-threading with that many threads after forking, which parallelizes the reading
+/// and decompression of the baskets inside each worker. Implicit multi-threading should not be
+/// enabled in the parent process before the workers are forked.
 ///
 /// #### Return value:
 /// Methods taking 'F func' return the return type of F.
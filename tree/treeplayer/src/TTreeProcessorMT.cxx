@@ -24,6 +24,9 @@ of a ROOT::TThreadedObject, so that each thread works with its own TFile and TTr
 objects.
 */
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <memory>
 
 #include "TROOT.h"
@@ -124,49 +127,73 @@ ConvertToElistClusters(std::vector<std::vector<EntryRange>> &&clusters, TEntryLi
 // EntryRanges and number of entries per file
 using ClustersAndEntries = std::pair<std::vector<std::vector<EntryRange>>, std::vector<Long64_t>>;
 
+////////////////////////////////////////////////////////////////////////
+/// Return the cluster boundaries, with local entry numbers, and the number of entries of the tree in the given file.
+std::pair<std::vector<EntryRange>, Long64_t> GetClustersOfFile(const std::string &treeName, const std::string &fileName)
+{
+   TDirectory::TContext c;
+   std::unique_ptr<TFile> f(TFile::Open(
+      fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION")); // need TFile::Open to load plugins if need be
+   if (!f || f->IsZombie()) {
+      const auto msg = "TTreeProcessorMT::Process: an error occurred while opening file \"" + fileName + "\"";
+      throw std::runtime_error(msg);
+   }
+   auto *t = f->Get<TTree>(treeName.c_str()); // t will be deleted by f
+
+   if (!t) {
+      const auto msg = "TTreeProcessorMT::Process: an error occurred while getting tree \"" + treeName +
+                       "\" from file \"" + fileName + "\"";
+      throw std::runtime_error(msg);
+   }
+
+   // Avoid calling TROOT::RecursiveRemove for this tree, it takes the read lock and we don't need it.
+   t->ResetBit(kMustCleanup);
+   ROOT::Internal::TreeUtils::ClearMustCleanupBits(*t->GetListOfBranches());
+   auto clusterIter = t->GetClusterIterator(0);
+   Long64_t clusterStart = 0ll;
+   const Long64_t entries = t->GetEntries();
+   std::vector<EntryRange> clusters;
+   while ((clusterStart = clusterIter()) < entries)
+      clusters.emplace_back(EntryRange{clusterStart, clusterIter.GetNextEntry()});
+   return {std::move(clusters), entries};
+}
+
 ////////////////////////////////////////////////////////////////////////
 /// Return a vector of cluster boundaries for the given tree and files.
+/// If a pool is given and the range extends to the end of the dataset, the files are opened concurrently.
 ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames,
                                        const std::vector<std::string> &fileNames, const unsigned int maxTasksPerFile,
-                                       const EntryRange &range = {0, std::numeric_limits<Long64_t>::max()})
+                                       const EntryRange &range = {0, std::numeric_limits<Long64_t>::max()},
+                                       ROOT::TThreadExecutor *pool = nullptr)
 {
    // Note that as a side-effect of opening all files that are going to be used in the
    // analysis once, all necessary streamers will be loaded into memory.
-   TDirectory::TContext c;
    const auto nFileNames = fileNames.size();
+
+   // With a range that ends before the end of the dataset, the files past the end of the range are not needed:
+   // they are opened one by one, until the end of the range is reached.
+   std::vector<std::pair<std::vector<EntryRange>, Long64_t>> clustersOfFiles;
+   const bool openConcurrently = pool && nFileNames > 1 && range.second == std::numeric_limits<Long64_t>::max();
+   if (openConcurrently) {
+      clustersOfFiles.resize(nFileNames);
+      std::vector<std::size_t> fileIdxs(nFileNames);
+      std::iota(fileIdxs.begin(), fileIdxs.end(), 0u);
+      pool->Foreach([&](std::size_t i) { clustersOfFiles[i] = GetClustersOfFile(treeNames[i], fileNames[i]); },
+                    fileIdxs);
+   }
+
    std::vector<std::vector<EntryRange>> clustersPerFile;
    std::vector<Long64_t> entriesPerFile;
    entriesPerFile.reserve(nFileNames);
    Long64_t offset = 0ll;
    bool rangeEndReached = false; // flag to break the outer loop
    for (auto i = 0u; i < nFileNames && !rangeEndReached; ++i) {
-      const auto &fileName = fileNames[i];
-      const auto &treeName = treeNames[i];
-
-      std::unique_ptr<TFile> f(TFile::Open(
-         fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION")); // need TFile::Open to load plugins if need be
-      if (!f || f->IsZombie()) {
-         const auto msg = "TTreeProcessorMT::Process: an error occurred while opening file \"" + fileName + "\"";
-         throw std::runtime_error(msg);
-      }
-      auto *t = f->Get<TTree>(treeName.c_str()); // t will be deleted by f
-
-      if (!t) {
-         const auto msg = "TTreeProcessorMT::Process: an error occurred while getting tree \"" + treeName +
-                          "\" from file \"" + fileName + "\"";
-         throw std::runtime_error(msg);
-      }
-
-      // Avoid calling TROOT::RecursiveRemove for this tree, it takes the read lock and we don't need it.
-      t->ResetBit(kMustCleanup);
-      ROOT::Internal::TreeUtils::ClearMustCleanupBits(*t->GetListOfBranches());
-      auto clusterIter = t->GetClusterIterator(0);
-      Long64_t clusterStart = 0ll, clusterEnd = 0ll;
-      const Long64_t entries = t->GetEntries();
+      const auto clustersOfFile =
+         openConcurrently ? std::move(clustersOfFiles[i]) : GetClustersOfFile(treeNames[i], fileNames[i]);
+      const Long64_t entries = clustersOfFile.second;
       // Iterate over the clusters in the current file
       std::vector<EntryRange> entryRanges;
-      while ((clusterStart = clusterIter()) < entries && !rangeEndReached) {
-         clusterEnd = clusterIter.GetNextEntry();
+      for (const auto &cluster : clustersOfFile.first) {
          // Currently, if a user specified a range, the clusters will be only globally obtained
          // Assume that there are 3 files with entries: [0, 100], [0, 150], [0, 200] (in this order)
          // Since the cluster boundaries are obtained sequentially, applying the offsets, the boundaries
@@ -176,14 +203,16 @@ ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames,
          // tree is added, i.e.: currentStart is now 200 and currentEnd is 250 (locally from 100 to 150).
          // Lastly, the last tree would take entries from 250 to 300 (or from 0 to 50 locally).
          // The current file's offset to start and end is added to make them (chain) global
-         const auto currentStart = std::max(clusterStart + offset, range.first);
-         const auto currentEnd = std::min(clusterEnd + offset, range.second);
+         const auto currentStart = std::max(cluster.first + offset, range.first);
+         const auto currentEnd = std::min(cluster.second + offset, range.second);
          // This is not satified if the desired start is larger than the last entry of some cluster
          // In this case, this cluster is not going to be processes further
          if (currentStart < currentEnd)
             entryRanges.emplace_back(EntryRange{currentStart, currentEnd});
-         if (currentEnd == range.second) // if the desired end is reached, stop reading further
+         if (currentEnd == range.second) { // if the desired end is reached, stop reading further
             rangeEndReached = true;
+            break;
+         }
       }
       offset += entries; // consistently keep track of the total number of entries
       clustersPerFile.emplace_back(std::move(entryRanges));
@@ -244,11 +273,73 @@ ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames,
    return std::make_pair(std::move(eventRangesPerFile), std::move(entriesPerFile));
 }
 
+////////////////////////////////////////////////////////////////////////
+/// Keep track of the progress of TTreeProcessorMT::Process in order to split the entry ranges of the last tasks.
+/// Tasks are created per cluster (or groups of clusters), so when a filter rejects most entries in some files and few
+/// in others the tasks can take very different times, and towards the end of the processing workers idle while the
+/// slowest tasks complete. When a task starts and fewer tasks than workers are left to be started, its entry range is
+/// split in sub-ranges, processed by separate tasks that the idle workers pick up. The number of sub-ranges is chosen
+/// based on the processing throughput measured so far, so that each of them takes at least kMinSubTaskDuration.
+class TailTaskSplitter {
+   static constexpr std::chrono::milliseconds kMinSubTaskDuration{20};
+
+   const bool fEnabled;
+   const Long64_t fNWorkers;
+   std::atomic<Long64_t> fNPendingTasks;        ///< Tasks not started yet, including unopened files
+   std::atomic<Long64_t> fNProcessedEntries{0}; ///< Entries processed by the tasks completed so far
+   std::atomic<Long64_t> fProcessingTimeNs{0};  ///< Time spent by the tasks completed so far
+
+public:
+   TailTaskSplitter(bool enabled, unsigned int nWorkers, Long64_t nPendingTasks)
+      : fEnabled(enabled), fNWorkers(nWorkers), fNPendingTasks(nPendingTasks)
+   {
+   }
+
+   void AddPendingTasks(Long64_t nTasks) { fNPendingTasks += nTasks; }
+
+   /// Signal that a task for the given range starts. Return the sub-ranges in which the task should be split, or the
+   /// input range if it should be processed as is.
+   std::vector<EntryRange> StartTask(const EntryRange &range)
+   {
+      const auto nPending = --fNPendingTasks;
+      const auto nEntries = range.second - range.first;
+      const auto nProcessedEntries = fNProcessedEntries.load();
+      if (!fEnabled || nPending >= fNWorkers || nEntries < 2 || nProcessedEntries == 0)
+         return {range};
+
+      const double nsPerEntry = double(fProcessingTimeNs.load()) / nProcessedEntries;
+      const auto minSubTaskNs = std::chrono::duration_cast<std::chrono::nanoseconds>(kMinSubTaskDuration).count();
+      const auto nWorthwhileSubTasks = static_cast<Long64_t>(nsPerEntry * nEntries / minSubTaskNs);
+      const auto nSubTasks = std::min({fNWorkers - nPending, nWorthwhileSubTasks, nEntries});
+      if (nSubTasks < 2)
+         return {range};
+
+      std::vector<EntryRange> subRanges;
+      subRanges.reserve(nSubTasks);
+      auto start = range.first;
+      for (Long64_t i = 0; i < nSubTasks; ++i) {
+         const auto end = start + nEntries / nSubTasks + (i < nEntries % nSubTasks ? 1 : 0);
+         subRanges.emplace_back(start, end);
+         start = end;
+      }
+      fNPendingTasks += nSubTasks;
+      return subRanges;
+   }
+
+   /// Signal that a task processed nEntries in the given time.
+   void EndTask(Long64_t nEntries, std::chrono::steady_clock::duration time)
+   {
+      fNProcessedEntries += nEntries;
+      fProcessingTimeNs += std::chrono::duration_cast<std::chrono::nanoseconds>(time).count();
+   }
+};
+
 } // anonymous namespace
 
 namespace ROOT {
 
 unsigned int TTreeProcessorMT::fgTasksPerWorkerHint = 10U;
+bool TTreeProcessorMT::fgSplitTailTasks = true;
 
 namespace Internal {
 
@@ -434,6 +525,63 @@ TTreeProcessorMT::TTreeProcessorMT(TTree &tree, UInt_t nThreads, const EntryRang
 {
 }
 
+////////////////////////////////////////////////////////////////////////
+/// Return the maximum number of tasks to create for each file.
+unsigned int TTreeProcessorMT::GetMaxTasksPerFile() const
+{
+   return std::ceil(float(GetTasksPerWorkerHint() * fPool.GetPoolSize()) / float(fFileNames.size()));
+}
+
+////////////////////////////////////////////////////////////////////////
+/// Return whether clusters must be generated with global entry numbers, for all files at once.
+/// That is the case if an entry list or friend trees are present, or if a global entry range was requested.
+/// Otherwise clusters contain local entry numbers and can be retrieved concurrently for each file.
+bool TTreeProcessorMT::ShouldRetrieveAllClusters() const
+{
+   // TODO: in practice we could also find clusters per-file in the case of no friends and a TEntryList with
+   // sub-entrylists.
+   const bool hasFriends = !fFriendInfo.fFriendNames.empty();
+   const bool hasEntryList = fEntryList.GetN() > 0;
+   return hasFriends || hasEntryList || fGlobalRange.first > 0 ||
+          fGlobalRange.second != std::numeric_limits<Long64_t>::max();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+/// Open the input files and compute the cluster boundaries that the next call to Process will use.
+/// Calling this method is optional: Process calls it (or retrieves the clusters of each file as part of the
+/// processing of that file) if needed. It allows to overlap the opening of the input files with other work, e.g.
+/// by calling it from a separate task before Process is invoked. It must not run concurrently with Process.
+void TTreeProcessorMT::PrepareClusters()
+{
+   const auto maxTasksPerFile = GetMaxTasksPerFile();
+
+   if (ShouldRetrieveAllClusters()) {
+      auto clustersAndEntries = MakeClusters(fTreeNames, fFileNames, maxTasksPerFile, fGlobalRange, &fPool);
+      if (fEntryList.GetN() > 0)
+         clustersAndEntries.first = ConvertToElistClusters(std::move(clustersAndEntries.first), fEntryList, fTreeNames,
+                                                           fFileNames, clustersAndEntries.second);
+      fPreparedClusters = std::move(clustersAndEntries.first);
+      fPreparedEntries = std::move(clustersAndEntries.second);
+   } else {
+      // clusters with local entry numbers, each file can be opened concurrently
+      const auto nFiles = fFileNames.size();
+      fPreparedClusters.assign(nFiles, {});
+      fPreparedEntries.assign(nFiles, 0ll);
+      std::vector<std::size_t> fileIdxs(nFiles);
+      std::iota(fileIdxs.begin(), fileIdxs.end(), 0u);
+      fPool.Foreach(
+         [&](std::size_t fileIdx) {
+            auto clustersAndEntries =
+               MakeClusters({fTreeNames[fileIdx]}, {fFileNames[fileIdx]}, maxTasksPerFile);
+            fPreparedClusters[fileIdx] = std::move(clustersAndEntries.first[0]);
+            fPreparedEntries[fileIdx] = clustersAndEntries.second[0];
+         },
+         fileIdxs);
+   }
+
+   fClustersPrepared = true;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 /// Process the entries of a TTree in parallel. The user-provided function
 /// receives a TTreeReader which can be used to iterate on a subrange of
@@ -454,65 +602,82 @@ TTreeProcessorMT::TTreeProcessorMT(TTree &tree, UInt_t nThreads, const EntryRang
 void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
 {
    // compute number of tasks per file
-   const unsigned int maxTasksPerFile =
-      std::ceil(float(GetTasksPerWorkerHint() * fPool.GetPoolSize()) / float(fFileNames.size()));
+   const unsigned int maxTasksPerFile = GetMaxTasksPerFile();
 
    // If an entry list or friend trees are present, we need to generate clusters with global entry numbers,
-   // so we do it here for all files.
+   // so we do it here for all files (unless PrepareClusters was already called).
    // Otherwise we can do it later, concurrently for each file, and clusters will contain local entry numbers.
-   // TODO: in practice we could also find clusters per-file in the case of no friends and a TEntryList with
-   // sub-entrylists.
-   const bool hasFriends = !fFriendInfo.fFriendNames.empty();
-   const bool hasEntryList = fEntryList.GetN() > 0;
-   const bool shouldRetrieveAllClusters = hasFriends || hasEntryList || fGlobalRange.first > 0 ||
-                                          fGlobalRange.second != std::numeric_limits<Long64_t>::max();
-   ClustersAndEntries allClusterAndEntries{};
-   auto &allClusters = allClusterAndEntries.first;
-   const auto &allEntries = allClusterAndEntries.second;
-   if (shouldRetrieveAllClusters) {
-      allClusterAndEntries = MakeClusters(fTreeNames, fFileNames, maxTasksPerFile, fGlobalRange);
-      if (hasEntryList)
-         allClusters = ConvertToElistClusters(std::move(allClusters), fEntryList, fTreeNames, fFileNames, allEntries);
-   }
+   const bool shouldRetrieveAllClusters = ShouldRetrieveAllClusters();
+   if (shouldRetrieveAllClusters && !fClustersPrepared)
+      PrepareClusters();
+   const auto &allClusters = fPreparedClusters;
+   const auto &allEntries = fPreparedEntries;
+
+   const auto firstNonEmpty =
+      fGlobalRange.first > 0u ? std::distance(allClusters.begin(), std::find_if(allClusters.begin(), allClusters.end(),
+                                                                                [](auto &c) { return !c.empty(); }))
+                              : 0u;
+
+   std::vector<std::size_t> fileIdxs(allEntries.empty() ? fFileNames.size() : allEntries.size() - firstNonEmpty);
+   std::iota(fileIdxs.begin(), fileIdxs.end(), firstNonEmpty);
+
+   // Until its clusters are retrieved, a file counts as one pending task
+   Long64_t nPendingTasks = 0;
+   for (auto fileIdx : fileIdxs)
+      nPendingTasks += shouldRetrieveAllClusters ? Long64_t(allClusters[fileIdx].size()) : 1;
+   TailTaskSplitter splitter(fgSplitTailTasks, fPool.GetPoolSize(), nPendingTasks);
+
+   // Process an entry range with processOne, or split it in sub-ranges processed by separate tasks
+   std::function<void(const EntryRange &, const std::function<void(const EntryRange &)> &)> processRange;
+   processRange = [&](const EntryRange &range, const std::function<void(const EntryRange &)> &processOne) {
+      const auto subRanges = splitter.StartTask(range);
+      if (subRanges.size() > 1) {
+         fPool.Foreach([&](const EntryRange &subRange) { processRange(subRange, processOne); }, subRanges);
+         return;
+      }
+      const auto start = std::chrono::steady_clock::now();
+      processOne(range);
+      splitter.EndTask(range.second - range.first, std::chrono::steady_clock::now() - start);
+   };
 
    // Per-file processing in case we retrieved all cluster info upfront
    auto processFileUsingGlobalClusters = [&](std::size_t fileIdx) {
-      auto processCluster = [&](const EntryRange &c) {
+      const std::function<void(const EntryRange &)> processCluster = [&](const EntryRange &c) {
          auto r =
             fTreeView->GetTreeReader(c.first, c.second, fTreeNames, fFileNames, fFriendInfo, fEntryList, allEntries);
          func(*r);
       };
-      fPool.Foreach(processCluster, allClusters[fileIdx]);
+      fPool.Foreach([&](const EntryRange &c) { processRange(c, processCluster); }, allClusters[fileIdx]);
    };
 
-   // Per-file processing that also retrieves cluster info for a file
+   // Per-file processing that also retrieves cluster info for a file, unless PrepareClusters already did
    auto processFileRetrievingClusters = [&](std::size_t fileIdx) {
       // Evaluate clusters (with local entry numbers) and number of entries for this file
       const auto &treeNames = std::vector<std::string>({fTreeNames[fileIdx]});
       const auto &fileNames = std::vector<std::string>({fFileNames[fileIdx]});
-      const auto clustersAndEntries = MakeClusters(treeNames, fileNames, maxTasksPerFile);
+      const auto clustersAndEntries =
+         fClustersPrepared ? ClustersAndEntries{{fPreparedClusters[fileIdx]}, {fPreparedEntries[fileIdx]}}
+                           : MakeClusters(treeNames, fileNames, maxTasksPerFile);
       const auto &clusters = clustersAndEntries.first[0];
       const auto &entries = clustersAndEntries.second[0];
-      auto processCluster = [&](const EntryRange &c) {
+      splitter.AddPendingTasks(Long64_t(clusters.size()) - 1);
+      const std::function<void(const EntryRange &)> processCluster = [&](const EntryRange &c) {
          auto r = fTreeView->GetTreeReader(c.first, c.second, treeNames, fileNames, fFriendInfo, fEntryList, {entries});
          func(*r);
       };
-      fPool.Foreach(processCluster, clusters);
+      fPool.Foreach([&](const EntryRange &c) { processRange(c, processCluster); }, clusters);
    };
 
-   const auto firstNonEmpty =
-      fGlobalRange.first > 0u ? std::distance(allClusters.begin(), std::find_if(allClusters.begin(), allClusters.end(),
-                                                                                [](auto &c) { return !c.empty(); }))
-                              : 0u;
-
-   std::vector<std::size_t> fileIdxs(allEntries.empty() ? fFileNames.size() : allEntries.size() - firstNonEmpty);
-   std::iota(fileIdxs.begin(), fileIdxs.end(), firstNonEmpty);
-
    if (shouldRetrieveAllClusters)
       fPool.Foreach(processFileUsingGlobalClusters, fileIdxs);
    else
       fPool.Foreach(processFileRetrievingClusters, fileIdxs);
 
+   // the prepared clusters are only valid for one call to Process
+   fClustersPrepared = false;
+   fPreparedClusters.clear();
+   fPreparedEntries.clear();
+
    // make sure TChains and TFiles are cleaned up since they are not globally tracked
    for (unsigned int islot = 0; islot < fTreeView.GetNSlots(); ++islot) {
       ROOT::Internal::TTreeView *view = fTreeView.GetAtSlotRaw(islot);
@@ -542,3 +707,24 @@ void TTreeProcessorMT::SetTasksPerWorkerHint(unsigned int tasksPerWorkerHint)
 {
    fgTasksPerWorkerHint = tasksPerWorkerHint;
 }
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Return whether the entry ranges of the last tasks of Process are split to keep all workers busy.
+bool TTreeProcessorMT::GetSplitTailTasks()
+{
+   return fgSplitTailTasks;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Set whether the entry ranges of the last tasks of Process are split to keep all workers busy.
+/// \param[in] splitTailTasks Whether tail tasks should be split (the default) or not.
+///
+/// When fewer tasks than workers are left to be started, Process splits the entry range of each new task in
+/// sub-ranges processed by separate tasks, as long as the throughput measured so far indicates that each sub-range
+/// will take at least a few milliseconds to process. This evens out the processing time of the last tasks, e.g. when a
+/// selection rejects most entries of some files and few of others. The user function can then be invoked with entry
+/// ranges that do not correspond to whole clusters.
+void TTreeProcessorMT::SetSplitTailTasks(bool splitTailTasks)
+{
+   fgSplitTailTasks = splitTailTasks;
+}
@@ -342,7 +342,8 @@ namespace {
       void* At(ROOT::Detail::TBranchProxy* proxy, size_t idx) override{
          TClonesArray *myClonesArray = GetCA(proxy);
          if (!myClonesArray) return nullptr;
-         return (Byte_t*)myClonesArray->At(idx) + fOffset;
+         // like TClonesReader::At, rely on the caller to stay within GetSize()
+         return (Byte_t*)myClonesArray->UncheckedAt(idx) + fOffset;
       }
    };
 
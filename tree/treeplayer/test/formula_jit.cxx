@@ -0,0 +1,80 @@
+#include "TTree.h"
+#include "TTreeFormula.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+std::unique_ptr<TTree> MakeFormulaTree()
+{
+   auto tree = std::make_unique<TTree>("formulajit", "formulajit");
+   tree->SetDirectory(nullptr);
+   double x = 0.;
+   float y = 0.f;
+   int n = 0;
+   int a[3]{};
+   tree->Branch("x", &x);
+   tree->Branch("y", &y);
+   tree->Branch("n", &n);
+   tree->Branch("a", a, "a[3]/I");
+   for (int i = 0; i < 200; ++i) {
+      x = 0.37 * i - 20.;
+      y = 1.f / (i + 1);
+      n = i;
+      for (int j = 0; j < 3; ++j)
+         a[j] = i * (j - 1);
+      tree->Fill();
+   }
+   tree->ResetBranchAddresses();
+   return tree;
+}
+
+std::vector<double> Evaluate(TTree *tree, const char *expression, bool jit)
+{
+   TTreeFormula::SetJitCompilation(jit);
+   TTreeFormula formula("f", expression, tree);
+   std::vector<double> values;
+   for (Long64_t i = 0; i < tree->GetEntries(); ++i) {
+      tree->LoadTree(i);
+      formula.GetNdata();
+      for (int k = 0; k < formula.GetNdata(); ++k)
+         values.push_back(formula.EvalInstance(k));
+   }
+   TTreeFormula::SetJitCompilation(false);
+   return values;
+}
+
+} // namespace
+
+TEST(TTreeFormulaJit, SameResultsAsInterpreted)
+{
+   auto tree = MakeFormulaTree();
+   const char *expressions[] = {"x*y + sqrt(x) - y/n",
+                                "x > 0 && y < 0.1 || n == 7",
+                                "pow(x, 2) + exp(y) - log(n) + atan2(x, y)",
+                                "n % 7 + (n & 3) + (n << 2) + int(x) + abs(x) * sign(x)",
+                                "a * x + a[1] - min(x, y) + max(n, 3)",
+                                "!(x < y) + pi * cos(x) + fmod(x, 3)"};
+   for (auto expression : expressions) {
+      const auto interpreted = Evaluate(tree.get(), expression, false);
+      const auto compiled = Evaluate(tree.get(), expression, true);
+      ASSERT_EQ(interpreted.size(), compiled.size()) << expression;
+      EXPECT_FALSE(interpreted.empty()) << expression;
+      for (std::size_t i = 0; i < interpreted.size(); ++i)
+         EXPECT_DOUBLE_EQ(interpreted[i], compiled[i]) << expression << " at " << i;
+   }
+}
+
+TEST(TTreeFormulaJit, DrawSelection)
+{
+   auto tree = MakeFormulaTree();
+   const auto interpreted = tree->Draw("x", "x*y > 0.1 && n > 20", "goff");
+   TTreeFormula::SetJitCompilation(true);
+   const auto compiled = tree->Draw("x", "x*y > 0.1 && n > 20", "goff");
+   TTreeFormula::SetJitCompilation(false);
+   EXPECT_GT(interpreted, 0);
+   EXPECT_EQ(interpreted, compiled);
+}
@@ -1,4 +1,5 @@
 #include <TFile.h>
+#include <TH1.h>
 #include <TParameter.h>
 #include <TTree.h>
 #include <TSystem.h>
@@ -122,6 +123,42 @@ TEST(TreeProcessorMP, moreWorkersThanEvents)
       EXPECT_EQ(2, tparami->GetVal()) << "The counter incremented in the worker processes has the wrong value.";
    }
 }
+
+TEST(TreeProcessorMP, RangesAlignedToClusters)
+{
+   const auto fname = "f_rangesAlignedToClusters.root";
+   {
+      int v = 0;
+      TFile file(fname, "recreate");
+      TTree t("t", "t");
+      t.Branch("v", &v);
+      t.SetAutoFlush(30);
+      for (v = 0; v < 100; ++v)
+         t.Fill();
+      t.Write();
+   }
+
+   // bin 1 counts the entries, bin 2 the worker ranges which do not start at a cluster boundary
+   auto func = [](TTreeReader &r) {
+      auto h = new TH1I("h", "h", 2, 0, 2);
+      bool first = true;
+      while (r.Next()) {
+         if (first && r.GetCurrentEntry() % 30 != 0)
+            h->Fill(1.5);
+         first = false;
+         h->Fill(0.5);
+      }
+      return h;
+   };
+
+   ROOT::TTreeProcessorMP proc(3);
+   auto res = proc.Process(fname, func, "t");
+   EXPECT_EQ(100, res->GetBinContent(1));
+   EXPECT_EQ(0, res->GetBinContent(2));
+   delete res;
+
+   gSystem->Unlink(fname);
+}
 #endif // MSVC
 
 TEST(TreeProcessorMT, EmptyTChain)
@@ -589,3 +626,144 @@ TEST(TreeProcessorMT, TreesInSameFile)
    gSystem->Unlink(fname.c_str());
    ROOT::DisableImplicitMT();
 }
+
+TEST(TreeProcessorMT, DrawHistogram)
+{
+   const auto fname = "treeprocmt_draw.root";
+   {
+      TFile f(fname, "recreate");
+      TTree t("t", "t");
+      t.SetAutoFlush(100);
+      double x;
+      int n;
+      double arr[4];
+      t.Branch("x", &x);
+      t.Branch("n", &n);
+      t.Branch("arr", arr, "arr[n]/D");
+      std::mt19937 gen(42);
+      std::uniform_real_distribution<double> dist(0., 1.);
+      for (int i = 0; i < 5000; ++i) {
+         x = dist(gen);
+         n = i % 5;
+         for (int j = 0; j < n; ++j)
+            arr[j] = dist(gen);
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   ROOT::EnableImplicitMT(4);
+   TFile f(fname);
+   auto t = f.Get<TTree>("t");
+   const std::vector<std::pair<std::string, std::string>> draws{{"x>>h%s(50,0,1)", "n>1"},
+                                                                {"arr>>h%s(50,0,1)", ""},
+                                                                {"arr:x>>h%s(10,0,1,10,0,1)", "arr>0.5"}};
+   for (const auto &draw : draws) {
+      t->SetImplicitMT(true);
+      const auto nmt = t->Draw(Form(draw.first.c_str(), "mt"), draw.second.c_str(), "goff");
+      t->SetImplicitMT(false);
+      const auto nseq = t->Draw(Form(draw.first.c_str(), "seq"), draw.second.c_str(), "goff");
+      EXPECT_EQ(nmt, nseq) << draw.first;
+      auto hmt = f.Get<TH1>("hmt");
+      auto hseq = f.Get<TH1>("hseq");
+      ASSERT_NE(hmt, nullptr);
+      ASSERT_NE(hseq, nullptr);
+      EXPECT_EQ(hmt->GetEntries(), hseq->GetEntries()) << draw.first;
+      for (int bin = 0; bin < hseq->GetNcells(); ++bin)
+         EXPECT_DOUBLE_EQ(hmt->GetBinContent(bin), hseq->GetBinContent(bin)) << draw.first << " bin " << bin;
+      delete hmt;
+      delete hseq;
+   }
+   f.Close();
+
+   gSystem->Unlink(fname);
+   ROOT::DisableImplicitMT();
+}
+
+TEST(TreeProcessorMT, PrepareClusters)
+{
+   const std::vector<std::string> filenames = {"treeprocmt_prepareclusters0.root", "treeprocmt_prepareclusters1.root",
+                                               "treeprocmt_prepareclusters2.root"};
+   FilesRAII files(std::vector<std::string>(filenames.size(), "t"), filenames);
+   const std::vector<std::string_view> fnames(filenames.begin(), filenames.end());
+
+   auto sumValues = [](ROOT::TTreeProcessorMT &proc) {
+      std::atomic_int sum(0);
+      proc.Process([&sum](TTreeReader &r) {
+         TTreeReaderValue<int> v(r, "v");
+         while (r.Next())
+            sum += *v;
+      });
+      return sum.load();
+   };
+
+   // clusters retrieved per file
+   ROOT::TTreeProcessorMT proc(fnames, "t");
+   proc.PrepareClusters();
+   EXPECT_EQ(sumValues(proc), 465); // sum of [1..30]
+   // the prepared clusters are consumed by Process, later calls retrieve them again
+   EXPECT_EQ(sumValues(proc), 465);
+
+   // clusters retrieved for all files at once, with global entry numbers
+   ROOT::TTreeProcessorMT rangeProc(fnames, "t", 0u, {5, 25});
+   rangeProc.PrepareClusters();
+   EXPECT_EQ(sumValues(rangeProc), 310); // sum of [6..25]
+}
+
+TEST(TreeProcessorMT, SplitTailTasks)
+{
+   const auto filename = "treeprocmt_splittailtasks.root";
+   const auto treename = "t";
+   const auto nEntries = 60;
+   {
+      int v = 0;
+      TFile file(filename, "recreate");
+      TTree t(treename, treename);
+      t.Branch("v", &v);
+      for (auto i = 0; i < nEntries; ++i) {
+         ++v;
+         t.Fill();
+         if ((i + 1) % 20 == 0) // three clusters of 20 entries
+            t.FlushBaskets();
+      }
+      t.Write();
+   }
+
+   std::mutex m;
+   std::vector<std::pair<Long64_t, Long64_t>> ranges;
+   std::atomic_int sum(0);
+   auto slowSum = [&](TTreeReader &r) {
+      {
+         std::lock_guard<std::mutex> l(m);
+         ranges.emplace_back(r.GetEntriesRange());
+      }
+      TTreeReaderValue<int> v(r, "v");
+      while (r.Next()) {
+         sum += *v;
+         std::this_thread::sleep_for(std::chrono::milliseconds(2));
+      }
+   };
+
+   ROOT::EnableImplicitMT(2);
+
+   // the last cluster is started when fewer clusters than workers are left, after the throughput was measured:
+   // it is split between the two workers
+   ROOT::TTreeProcessorMT p(filename, treename);
+   p.Process(slowSum);
+   EXPECT_EQ(sum, 1830); // sum of [1..60]
+   EXPECT_GT(ranges.size(), 3u);
+   CheckClusters(ranges, nEntries);
+
+   ranges.clear();
+   sum = 0;
+   ROOT::TTreeProcessorMT::SetSplitTailTasks(false);
+   ROOT::TTreeProcessorMT p2(filename, treename);
+   p2.Process(slowSum);
+   ROOT::TTreeProcessorMT::SetSplitTailTasks(true);
+   EXPECT_EQ(sum, 1830);
+   EXPECT_EQ(ranges.size(), 3u);
+   CheckClusters(ranges, nEntries);
+
+   ROOT::DisableImplicitMT();
+   gSystem->Unlink(filename);
+}
@@ -0,0 +1,84 @@
+#include "TChain.h"
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeIndex.h"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+// Entries with run and event numbers that are not in index order, and with a duplicate run,event pair
+void FillTree(TTree &t, int firstRun, int nRuns)
+{
+   int run, event;
+   t.Branch("run", &run);
+   t.Branch("event", &event);
+   for (run = firstRun + nRuns - 1; run >= firstRun; --run) {
+      for (event = 0; event < 100; ++event)
+         t.Fill();
+   }
+   run = firstRun;
+   event = 42;
+   t.Fill();
+}
+
+} // anonymous namespace
+
+TEST(TTreeIndex, HashTable)
+{
+   TTree t("t", "t");
+   t.SetDirectory(nullptr);
+   FillTree(t, 1, 10);
+   ASSERT_GT(t.BuildIndex("run", "event"), 0);
+   auto index = dynamic_cast<TTreeIndex *>(t.GetTreeIndex());
+   ASSERT_NE(nullptr, index);
+
+   std::vector<Long64_t> expected;
+   for (int run = 0; run <= 11; ++run) {
+      for (int event = -1; event <= 100; ++event)
+         expected.emplace_back(index->GetEntryNumberWithIndex(run, event));
+   }
+   // runs are filled in reverse order, entry 0 holds run 10 event 0
+   EXPECT_EQ(0, index->GetEntryNumberWithIndex(10, 0));
+   EXPECT_EQ(-1, index->GetEntryNumberWithIndex(11, 0));
+
+   EXPECT_FALSE(index->HasHashTable());
+   index->BuildHashTable();
+   EXPECT_TRUE(index->HasHashTable());
+   std::size_t i = 0;
+   for (int run = 0; run <= 11; ++run) {
+      for (int event = -1; event <= 100; ++event)
+         EXPECT_EQ(expected[i++], index->GetEntryNumberWithIndex(run, event)) << run << " " << event;
+   }
+}
+
+TEST(TChainIndex, Lookup)
+{
+   std::vector<std::string> fileNames;
+   for (int i = 0; i < 4; ++i) {
+      fileNames.emplace_back("ttreeindex_lookup" + std::to_string(i) + ".root");
+      TFile f(fileNames.back().c_str(), "RECREATE");
+      TTree t("t", "t");
+      FillTree(t, 10 * i, 5);
+      t.Write();
+   }
+
+   TChain c("t");
+   for (const auto &fileName : fileNames)
+      c.Add(fileName.c_str());
+   ASSERT_GT(c.BuildIndex("run", "event"), 0);
+   for (int i = 0; i < 4; ++i) {
+      // the last run of each file is stored first
+      EXPECT_EQ(501 * i, c.GetEntryNumberWithIndex(10 * i + 4, 0));
+      EXPECT_EQ(501 * i + 499, c.GetEntryNumberWithIndex(10 * i, 99));
+      EXPECT_EQ(-1, c.GetEntryNumberWithIndex(10 * i + 5, 0));
+   }
+   c.Reset();
+
+   for (const auto &fileName : fileNames)
+      gSystem->Unlink(fileName.c_str());
+}